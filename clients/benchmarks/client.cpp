@@ -23,6 +23,7 @@
 
 #include "utility.hpp"
 #include "rocsparse.hpp"
+#include "sweep.hpp"
 
 // Level1
 #include "testing_axpyi.hpp"
@@ -35,27 +36,41 @@
 // Level2
 #include "testing_coomv.hpp"
 #include "testing_csrmv.hpp"
+#include "testing_csrmv_semiring.hpp"
+#include "testing_csrmv_masked.hpp"
+#include "testing_csrmv_stream.hpp"
+#include "testing_csrmv_mapped.hpp"
+#include "testing_cscmspv.hpp"
 #include "testing_csrsv.hpp"
 #include "testing_ellmv.hpp"
 #include "testing_hybmv.hpp"
+#include "testing_pcsrmv.hpp"
+#include "testing_spmv_mixed.hpp"
 
 // Level3
 #include "testing_csrmm.hpp"
 
 // Preconditioner
 #include "testing_csrilu0.hpp"
+#include "testing_csrilu0_mixed.hpp"
+#include "testing_csrilu0_iterative.hpp"
 
 // Conversion
 #include "testing_csr2coo.hpp"
 #include "testing_csr2csc.hpp"
 #include "testing_csr2ell.hpp"
 #include "testing_csr2hyb.hpp"
+#include "testing_csr2hyb_update.hpp"
 #include "testing_coo2csr.hpp"
 #include "testing_ell2csr.hpp"
 #include "testing_identity.hpp"
 #include "testing_csrsort.hpp"
 #include "testing_coosort.hpp"
 
+// Reordering
+#include "testing_csrrcm.hpp"
+#include "testing_csrcolor.hpp"
+
 #include <iostream>
 #include <stdio.h>
 #include <boost/program_options.hpp>
@@ -63,115 +78,38 @@
 
 namespace po = boost::program_options;
 
-int main(int argc, char* argv[])
+// Check whether function is available in precision
+static bool check_precision(const std::string& function, char precision)
 {
-    Arguments argus;
-    argus.unit_check = 0;
-    argus.timing     = 1;
-
-    std::string function;
-    char precision = 's';
-
-    rocsparse_int device_id;
-
-    po::options_description desc("rocsparse client command line options");
-    desc.add_options()("help,h", "produces this help message")
-        // clang-format off
-        ("sizem,m",
-         po::value<rocsparse_int>(&argus.M)->default_value(128),
-         "Specific matrix size testing: sizem is only applicable to SPARSE-2 "
-         "& SPARSE-3: the number of rows.")
-
-        ("sizen,n",
-         po::value<rocsparse_int>(&argus.N)->default_value(128),
-         "Specific matrix/vector size testing: SPARSE-1: the length of the "
-         "dense vector. SPARSE-2 & SPARSE-3: the number of columns")
-
-        ("sizennz,z",
-         po::value<rocsparse_int>(&argus.nnz)->default_value(32),
-         "Specific vector size testing, LEVEL-1: the number of non-zero elements "
-         "of the sparse vector.")
-
-        ("mtx",
-         po::value<std::string>(&argus.filename)->default_value(""), "read from matrix "
-         "market (.mtx) format. This will override parameters m, n, and z.")
-
-        ("laplacian-dim",
-         po::value<rocsparse_int>(&argus.laplacian)->default_value(0), "assemble "
-         "laplacian matrix for 2D unit square with dimension <dim>. This will override "
-         "parameters m, n, z and mtx.")
-
-        ("alpha", 
-          po::value<double>(&argus.alpha)->default_value(1.0), "specifies the scalar alpha")
-
-        ("beta", 
-          po::value<double>(&argus.beta)->default_value(0.0), "specifies the scalar beta")
-
-        ("function,f",
-         po::value<std::string>(&function)->default_value("axpyi"),
-         "SPARSE function to test. Options:\n"
-         "  Level1: axpyi, doti, gthr, gthrz, roti, sctr\n"
-         "  Level2: coomv, csrmv, csrsv, ellmv, hybmv\n"
-         "  Level3: csrmm\n"
-         "  Preconditioner: csrilu0\n"
-         "  Conversion: csr2coo, csr2csc, csr2ell,\n"
-         "              csr2hyb, coo2csr, ell2csr\n"
-         "  Sorting: csrsort, coosort\n"
-         "  Misc: identity")
-
-        ("precision,r",
-         po::value<char>(&precision)->default_value('s'), "Options: s,d")
-
-        ("verify,v",
-         po::value<rocsparse_int>(&argus.unit_check)->default_value(0),
-         "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
-
-        ("iters,i",
-         po::value<rocsparse_int>(&argus.iters)->default_value(10),
-         "Iterations to run inside timing loop")
-
-        ("device,d",
-         po::value<rocsparse_int>(&device_id)->default_value(0),
-         "Set default device to be used for subsequent program runs");
-    // clang-format on
-
-    po::variables_map vm;
-    po::store(po::parse_command_line(argc, argv, desc), vm);
-    po::notify(vm);
-
-    if(vm.count("help"))
-    {
-        std::cout << desc << std::endl;
-        return 0;
-    }
-
-    if(precision != 's' && precision != 'd')
+    if(precision != 's' && precision != 'd' && precision != 'c' && precision != 'z' &&
+       precision != 'h' && precision != 'b')
     {
         fprintf(stderr, "Invalid value for --precision\n");
-        return -1;
+        return false;
     }
 
-    // Device Query
-    rocsparse_int device_count = query_device_property();
-
-    if(device_count <= device_id)
-    {
-        fprintf(stderr, "Error: invalid device ID. There may not be such device ID. Will exit\n");
-        return -1;
-    }
-    else
+    if((precision == 'h' || precision == 'b') && function != "csrmv" && function != "ellmv" &&
+       function != "hybmv")
     {
-        set_device(device_id);
+        fprintf(stderr, "Precision %c is not supported for %s\n", precision, function.c_str());
+        return false;
     }
 
-    /* ============================================================================================
-     */
-    if(argus.M < 0 || argus.N < 0)
+    if((precision == 'c' || precision == 'z') && function != "coomv" && function != "csrsv" &&
+       function != "ellmv" && function != "hybmv" && function != "csrilu0" &&
+       function != "csr2csc" && function != "csr2ell" && function != "csr2hyb" &&
+       function != "csr2hyb_update")
     {
-        fprintf(stderr, "Invalid dimension\n");
-        return -1;
+        fprintf(stderr, "Precision %c is not supported for %s\n", precision, function.c_str());
+        return false;
     }
 
+    return true;
+}
+
+// Run benchmark of function in precision
+static int run_function(const std::string& function, char precision, const Arguments& argus)
+{
     // Level1
     if(function == "axpyi")
     {
@@ -221,6 +159,10 @@ int main(int argc, char* argv[])
             testing_coomv<float>(argus);
         else if(precision == 'd')
             testing_coomv<double>(argus);
+        else if(precision == 'c')
+            testing_coomv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_coomv<rocsparse_double_complex>(argus);
     }
     else if(function == "csrmv")
     {
@@ -228,6 +170,52 @@ int main(int argc, char* argv[])
             testing_csrmv<float>(argus);
         else if(precision == 'd')
             testing_csrmv<double>(argus);
+        else if(precision == 'h')
+            testing_csrmv_mixed<rocsparse_half>(argus);
+        else if(precision == 'b')
+            testing_csrmv_mixed<rocsparse_bfloat16>(argus);
+    }
+    else if(function == "csrmv_semiring")
+    {
+        if(precision == 's')
+            testing_csrmv_semiring<float>(argus);
+        else if(precision == 'd')
+            testing_csrmv_semiring<double>(argus);
+    }
+    else if(function == "csrmv_masked")
+    {
+        if(precision == 's')
+            testing_csrmv_masked<float>(argus);
+        else if(precision == 'd')
+            testing_csrmv_masked<double>(argus);
+    }
+    else if(function == "pcsrmv")
+    {
+        if(precision == 's')
+            testing_pcsrmv<float>(argus);
+        else if(precision == 'd')
+            testing_pcsrmv<double>(argus);
+    }
+    else if(function == "csrmv_stream")
+    {
+        if(precision == 's')
+            testing_csrmv_stream<float>(argus);
+        else if(precision == 'd')
+            testing_csrmv_stream<double>(argus);
+    }
+    else if(function == "csrmv_mapped")
+    {
+        if(precision == 's')
+            testing_csrmv_mapped<float>(argus);
+        else if(precision == 'd')
+            testing_csrmv_mapped<double>(argus);
+    }
+    else if(function == "cscmspv")
+    {
+        if(precision == 's')
+            testing_cscmspv<float>(argus);
+        else if(precision == 'd')
+            testing_cscmspv<double>(argus);
     }
     else if(function == "csrsv")
     {
@@ -235,6 +223,10 @@ int main(int argc, char* argv[])
             testing_csrsv<float>(argus);
         else if(precision == 'd')
             testing_csrsv<double>(argus);
+        else if(precision == 'c')
+            testing_csrsv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csrsv<rocsparse_double_complex>(argus);
     }
     else if(function == "ellmv")
     {
@@ -242,6 +234,14 @@ int main(int argc, char* argv[])
             testing_ellmv<float>(argus);
         else if(precision == 'd')
             testing_ellmv<double>(argus);
+        else if(precision == 'c')
+            testing_ellmv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_ellmv<rocsparse_double_complex>(argus);
+        else if(precision == 'h')
+            testing_ellmv_mixed<rocsparse_half>(argus);
+        else if(precision == 'b')
+            testing_ellmv_mixed<rocsparse_bfloat16>(argus);
     }
     else if(function == "hybmv")
     {
@@ -249,6 +249,14 @@ int main(int argc, char* argv[])
             testing_hybmv<float>(argus);
         else if(precision == 'd')
             testing_hybmv<double>(argus);
+        else if(precision == 'c')
+            testing_hybmv<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_hybmv<rocsparse_double_complex>(argus);
+        else if(precision == 'h')
+            testing_hybmv_mixed<rocsparse_half>(argus);
+        else if(precision == 'b')
+            testing_hybmv_mixed<rocsparse_bfloat16>(argus);
     }
     else if(function == "csrmm")
     {
@@ -263,6 +271,22 @@ int main(int argc, char* argv[])
             testing_csrilu0<float>(argus);
         else if(precision == 'd')
             testing_csrilu0<double>(argus);
+        else if(precision == 'c')
+            testing_csrilu0<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csrilu0<rocsparse_double_complex>(argus);
+    }
+    else if(function == "csrilu0_mixed")
+    {
+        if(precision == 'd')
+            testing_csrilu0_mixed(argus);
+    }
+    else if(function == "csrilu0_iterative")
+    {
+        if(precision == 's')
+            testing_csrilu0_iterative<float>(argus);
+        else if(precision == 'd')
+            testing_csrilu0_iterative<double>(argus);
     }
     else if(function == "csr2coo")
     {
@@ -274,6 +298,10 @@ int main(int argc, char* argv[])
             testing_csr2csc<float>(argus);
         else if(precision == 'd')
             testing_csr2csc<double>(argus);
+        else if(precision == 'c')
+            testing_csr2csc<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csr2csc<rocsparse_double_complex>(argus);
     }
     else if(function == "csr2ell")
     {
@@ -281,6 +309,10 @@ int main(int argc, char* argv[])
             testing_csr2ell<float>(argus);
         else if(precision == 'd')
             testing_csr2ell<double>(argus);
+        else if(precision == 'c')
+            testing_csr2ell<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csr2ell<rocsparse_double_complex>(argus);
     }
     else if(function == "csr2hyb")
     {
@@ -288,6 +320,21 @@ int main(int argc, char* argv[])
             testing_csr2hyb<float>(argus);
         else if(precision == 'd')
             testing_csr2hyb<double>(argus);
+        else if(precision == 'c')
+            testing_csr2hyb<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csr2hyb<rocsparse_double_complex>(argus);
+    }
+    else if(function == "csr2hyb_update")
+    {
+        if(precision == 's')
+            testing_csr2hyb_update<float>(argus);
+        else if(precision == 'd')
+            testing_csr2hyb_update<double>(argus);
+        else if(precision == 'c')
+            testing_csr2hyb_update<rocsparse_float_complex>(argus);
+        else if(precision == 'z')
+            testing_csr2hyb_update<rocsparse_double_complex>(argus);
     }
     else if(function == "coo2csr")
     {
@@ -308,6 +355,20 @@ int main(int argc, char* argv[])
     {
         testing_coosort(argus);
     }
+    else if(function == "csrrcm")
+    {
+        if(precision == 's')
+            testing_csrrcm<float>(argus);
+        else if(precision == 'd')
+            testing_csrrcm<double>(argus);
+    }
+    else if(function == "csrcolor")
+    {
+        if(precision == 's')
+            testing_csrcolor<float>(argus);
+        else if(precision == 'd')
+            testing_csrcolor<double>(argus);
+    }
     else if(function == "identity")
     {
         testing_identity(argus);
@@ -319,3 +380,418 @@ int main(int argc, char* argv[])
     }
     return 0;
 }
+
+// Run functions in all precisions on all matrices of a collection. Each case is run warmup
+// times without recording, then repeats times, each run timing argus.iters calls. Each
+// matrix is read once and reused by all of its cases.
+static int run_sweep(const std::string& path,
+                     const std::vector<std::string>& functions,
+                     const std::vector<std::string>& precisions,
+                     rocsparse_int warmup,
+                     rocsparse_int repeats,
+                     const std::string& output,
+                     Arguments argus)
+{
+    std::vector<std::string> matrices = sweep_matrices(path);
+
+    if(matrices.empty())
+    {
+        fprintf(stderr, "No matrices found in %s\n", path.c_str());
+        return -1;
+    }
+
+    std::vector<sweep_case> cases;
+    std::vector<roofline_result> results;
+
+    roofline_set_sink(&results);
+
+    for(size_t i = 0; i < matrices.size(); ++i)
+    {
+        argus.filename  = matrices[i];
+        argus.laplacian = 0;
+
+        load_matrix_cache_scope cache;
+
+        for(size_t j = 0; j < functions.size(); ++j)
+        {
+            for(size_t k = 0; k < precisions.size(); ++k)
+            {
+                char precision = precisions[k][0];
+
+                if(!check_precision(functions[j], precision))
+                {
+                    continue;
+                }
+
+                sweep_case c;
+                c.matrix = matrices[i].substr(matrices[i].rfind('/') + 1);
+
+                for(rocsparse_int r = 0; r < warmup + repeats; ++r)
+                {
+                    results.clear();
+
+                    if(run_function(functions[j], precision, argus) != 0 || results.empty())
+                    {
+                        fprintf(stderr,
+                                "Skipping %s on %s, no timings reported\n",
+                                functions[j].c_str(),
+                                c.matrix.c_str());
+                        break;
+                    }
+
+                    if(r >= warmup)
+                    {
+                        c.result = results.back();
+                        c.msec.push_back(results.back().msec);
+                    }
+                }
+
+                if(!c.msec.empty())
+                {
+                    cases.push_back(c);
+                }
+            }
+        }
+    }
+
+    roofline_set_sink(nullptr);
+
+    if(!sweep_write_json(output, argus, warmup, repeats, cases))
+    {
+        fprintf(stderr, "Cannot write %s\n", output.c_str());
+        return -1;
+    }
+
+    printf("Wrote %zu cases to %s\n", cases.size(), output.c_str());
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    Arguments argus;
+    argus.unit_check = 0;
+    argus.timing     = 1;
+
+    std::string function;
+    char precision = 's';
+    char transA    = 'N';
+    std::string semiring;
+
+    rocsparse_int device_id;
+
+    std::string sweep;
+    std::string sweep_functions;
+    std::string sweep_precisions;
+    std::string formats;
+    std::string sweep_output;
+    rocsparse_int warmup;
+    rocsparse_int repeats;
+
+    po::options_description desc("rocsparse client command line options");
+    desc.add_options()("help,h", "produces this help message")
+        // clang-format off
+        ("sizem,m",
+         po::value<rocsparse_int>(&argus.M)->default_value(128),
+         "Specific matrix size testing: sizem is only applicable to SPARSE-2 "
+         "& SPARSE-3: the number of rows.")
+
+        ("sizen,n",
+         po::value<rocsparse_int>(&argus.N)->default_value(128),
+         "Specific matrix/vector size testing: SPARSE-1: the length of the "
+         "dense vector. SPARSE-2 & SPARSE-3: the number of columns")
+
+        ("sizennz,z",
+         po::value<rocsparse_int>(&argus.nnz)->default_value(32),
+         "Specific vector size testing, LEVEL-1: the number of non-zero elements "
+         "of the sparse vector.")
+
+        ("mtx",
+         po::value<std::string>(&argus.filename)->default_value(""), "read from matrix "
+         "market (.mtx) format or from an operand capture (.rsc) written by the library. This "
+         "will override parameters m, n, and z.")
+
+        ("laplacian-dim",
+         po::value<rocsparse_int>(&argus.laplacian)->default_value(0), "assemble "
+         "laplacian matrix for 2D unit square with dimension <dim>. This will override "
+         "parameters m, n, z and mtx.")
+
+        ("generator",
+         po::value<std::string>(&argus.generator)->default_value(""), "generate a synthetic "
+         "matrix. Options:\n"
+         "  stencil7, stencil27: 3D stencil on a grid with <gen-dim>^3 points\n"
+         "  block: 27 point connectivity of dense <gen-block-dim>^2 blocks on a grid with\n"
+         "    <gen-dim>^3 nodes, as from FEM\n"
+         "  banded: <gen-dim> rows with full band of width <gen-bandwidth>\n"
+         "  chain: <gen-dim> rows, whose triangular parts form a single dependency chain\n"
+         "    with <gen-bandwidth> extra dependencies per row\n"
+         "  rmat: power-law R-MAT graph with 2^<gen-dim> vertices and <gen-edge-factor>\n"
+         "    edges per vertex\n"
+         "This will override parameters m, n and z.")
+
+        ("gen-dim",
+         po::value<rocsparse_int>(&argus.gen_dim)->default_value(0),
+         "Size of the generated matrix, see --generator")
+
+        ("gen-bandwidth",
+         po::value<rocsparse_int>(&argus.gen_bandwidth)->default_value(1),
+         "Bandwidth of banded matrices and extra dependencies of chain matrices")
+
+        ("gen-block-dim",
+         po::value<rocsparse_int>(&argus.gen_block_dim)->default_value(3),
+         "Block dimension of block matrices")
+
+        ("gen-edge-factor",
+         po::value<rocsparse_int>(&argus.gen_edge_factor)->default_value(16),
+         "Edges per vertex of rmat matrices")
+
+        ("sweeps",
+         po::value<rocsparse_int>(&argus.sweeps)->default_value(0),
+         "Number of sweeps of the iterative solve policy, 0 keeps the library default")
+
+        ("alpha", 
+          po::value<double>(&argus.alpha)->default_value(1.0), "specifies the scalar alpha")
+
+        ("beta", 
+          po::value<double>(&argus.beta)->default_value(0.0), "specifies the scalar beta")
+
+        ("transposeA",
+         po::value<char>(&transA)->default_value('N'),
+         "N = no transpose, T = transpose, C = conjugate transpose")
+
+        ("semiring",
+         po::value<std::string>(&semiring)->default_value("plus_times"),
+         "Semiring of csrmv_semiring. Options: plus_times, min_plus (single source shortest\n"
+         "  paths), max_times, or_and (breadth first search). Traversals from vertex 0 are\n"
+         "  timed for min_plus and or_and on square matrices")
+
+        ("frontier",
+         po::value<double>(&argus.frontier)->default_value(0.0),
+         "Density of the sparse vector of cscmspv, 0 sweeps densities from 1e-4 to 1")
+
+        ("mask-density",
+         po::value<double>(&argus.mask_density)->default_value(0.0),
+         "Fraction of rows that are selected by csrmv_masked, 0 sweeps fractions from 1e-3\n"
+         "  to 1")
+
+        ("panel-nnz",
+         po::value<rocsparse_int>(&argus.panel_nnz)->default_value(0),
+         "Non-zero entries per panel of csrmv_stream, 0 splits the matrix into 8 panels. A\n"
+         "  matrix given by --mtx with .bin extension is streamed from this file")
+
+        ("map-hints",
+         po::value<std::string>(&argus.map_hints)->default_value(""),
+         "Comma separated hints for mapping the matrix of csrmv_mapped: huge (transparent\n"
+         "  huge pages), interleave (pages interleaved across NUMA nodes), populate (prefault)")
+
+        ("function,f",
+         po::value<std::string>(&function)->default_value("axpyi"),
+         "SPARSE function to test. Options:\n"
+         "  Level1: axpyi, doti, gthr, gthrz, roti, sctr\n"
+         "  Level2: coomv, csrmv, csrsv, ellmv, hybmv,\n"
+         "          csrmv_semiring (s and d only, see --semiring),\n"
+         "          csrmv_masked (s and d only, see --mask-density),\n"
+         "          csrmv_stream (s and d only, see --panel-nnz),\n"
+         "          csrmv_mapped (s and d only, host csrmv and csrmm on a mapped file,\n"
+         "          see --map-hints),\n"
+         "          cscmspv (s and d only, see --semiring and --frontier),\n"
+         "          pcsrmv (s and d only, csrmv with packed column indices)\n"
+         "  Level3: csrmm\n"
+         "  Preconditioner: csrilu0, csrilu0_mixed (d only, requires --laplacian-dim),\n"
+         "                  csrilu0_iterative (csrilu0 and csrsv with and without iterative\n"
+         "                  policy)\n"
+         "  Conversion: csr2coo, csr2csc, csr2ell,\n"
+         "              csr2hyb, csr2hyb_update, coo2csr, ell2csr\n"
+         "  Sorting: csrsort, coosort\n"
+         "  Reordering: csrrcm (SpMV before and after RCM reordering)\n"
+         "              csrcolor (csrilu0 and csrsv with and without multicolor reordering)\n"
+         "  Misc: identity")
+
+        ("precision,r",
+         po::value<char>(&precision)->default_value('s'),
+         "Options: s,d,c,z,h,b (c and z are single / double complex and are available\n"
+         "  for coomv, csrsv, ellmv, hybmv, csrilu0, csr2csc, csr2ell, csr2hyb and\n"
+         "  csr2hyb_update only,\n"
+         "  h and b store matrix values in half / bfloat16 and are available for csrmv,\n"
+         "  ellmv and hybmv only)")
+
+        ("verify,v",
+         po::value<rocsparse_int>(&argus.unit_check)->default_value(0),
+         "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
+
+        ("iters,i",
+         po::value<rocsparse_int>(&argus.iters)->default_value(10),
+         "Iterations to run inside timing loop")
+
+        ("peak-bandwidth",
+         po::value<double>(&argus.peak_bandwidth)->default_value(0.0),
+         "Peak memory bandwidth in GB/s the achieved bandwidth is compared to. If not set, "
+         "the bandwidth of a device to device copy is measured.")
+
+        ("report",
+         po::value<std::string>(&argus.report)->default_value(""),
+         "Append the roofline results of csrmv, coomv, ellmv, hybmv and pcsrmv to a report. "
+         "Options: csv, json (one object per line)")
+
+        ("report-file",
+         po::value<std::string>(&argus.report_file)->default_value(""),
+         "File the report is appended to (default: stdout)")
+
+        ("sweep",
+         po::value<std::string>(&sweep)->default_value(""),
+         "Benchmark all matrices of a directory (.mtx and .rsc files) or of a manifest "
+         "listing one matrix per line, and write the results to --sweep-output.")
+
+        ("sweep-functions",
+         po::value<std::string>(&sweep_functions)->default_value(""),
+         "Comma separated list of functions to sweep (default: --function)")
+
+        ("sweep-precisions",
+         po::value<std::string>(&sweep_precisions)->default_value(""),
+         "Comma separated list of precisions to sweep (default: --precision)")
+
+        ("formats",
+         po::value<std::string>(&formats)->default_value(""),
+         "Comma separated list of formats whose SpMV is swept in addition to "
+         "--sweep-functions. Options: csr, coo, ell, hyb")
+
+        ("warmup",
+         po::value<rocsparse_int>(&warmup)->default_value(1),
+         "Sweep runs per case that are not recorded")
+
+        ("repeats",
+         po::value<rocsparse_int>(&repeats)->default_value(5),
+         "Sweep runs per case that are recorded, each timing --iters calls")
+
+        ("sweep-output",
+         po::value<std::string>(&sweep_output)->default_value("rocsparse_sweep.json"),
+         "JSON file the sweep results are written to")
+
+        ("device,d",
+         po::value<rocsparse_int>(&device_id)->default_value(0),
+         "Set default device to be used for subsequent program runs");
+    // clang-format on
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(!check_precision(function, precision))
+    {
+        return -1;
+    }
+
+    if(!argus.report.empty() && argus.report != "csv" && argus.report != "json")
+    {
+        fprintf(stderr, "Invalid value for --report\n");
+        return -1;
+    }
+
+    if(!argus.generator.empty() && argus.generator != "stencil7" &&
+       argus.generator != "stencil27" && argus.generator != "block" &&
+       argus.generator != "banded" && argus.generator != "chain" && argus.generator != "rmat")
+    {
+        fprintf(stderr, "Invalid value for --generator\n");
+        return -1;
+    }
+
+    if(!argus.generator.empty() && argus.gen_dim <= 0)
+    {
+        fprintf(stderr, "Invalid value for --gen-dim\n");
+        return -1;
+    }
+
+    if(transA == 'N')
+    {
+        argus.transA = rocsparse_operation_none;
+    }
+    else if(transA == 'T')
+    {
+        argus.transA = rocsparse_operation_transpose;
+    }
+    else if(transA == 'C')
+    {
+        argus.transA = rocsparse_operation_conjugate_transpose;
+    }
+    else
+    {
+        fprintf(stderr, "Invalid value for --transposeA\n");
+        return -1;
+    }
+
+    if(semiring == "plus_times")
+    {
+        argus.semiring = rocsparse_semiring_plus_times;
+    }
+    else if(semiring == "min_plus")
+    {
+        argus.semiring = rocsparse_semiring_min_plus;
+    }
+    else if(semiring == "max_times")
+    {
+        argus.semiring = rocsparse_semiring_max_times;
+    }
+    else if(semiring == "or_and")
+    {
+        argus.semiring = rocsparse_semiring_or_and;
+    }
+    else
+    {
+        fprintf(stderr, "Invalid value for --semiring\n");
+        return -1;
+    }
+
+    // Device Query
+    rocsparse_int device_count = query_device_property();
+
+    if(device_count <= device_id)
+    {
+        fprintf(stderr, "Error: invalid device ID. There may not be such device ID. Will exit\n");
+        return -1;
+    }
+    else
+    {
+        set_device(device_id);
+    }
+
+    /* ============================================================================================
+     */
+    if(argus.M < 0 || argus.N < 0)
+    {
+        fprintf(stderr, "Invalid dimension\n");
+        return -1;
+    }
+
+    // Sweep over a matrix collection
+    if(!sweep.empty())
+    {
+        if(warmup < 0 || repeats <= 0)
+        {
+            fprintf(stderr, "Invalid value for --warmup or --repeats\n");
+            return -1;
+        }
+
+        // Without explicit functions, formats replace --function
+        std::vector<std::string> functions = sweep_split(
+            (sweep_functions.empty() && formats.empty()) ? function : sweep_functions);
+        std::vector<std::string> precisions =
+            sweep_split(sweep_precisions.empty() ? std::string(1, precision) : sweep_precisions);
+
+        // Formats select the corresponding SpMV routine
+        std::vector<std::string> format_list = sweep_split(formats);
+        for(size_t i = 0; i < format_list.size(); ++i)
+        {
+            functions.push_back(format_list[i] + "mv");
+        }
+
+        return run_sweep(sweep, functions, precisions, warmup, repeats, sweep_output, argus);
+    }
+
+    return run_function(function, precision, argus);
+}
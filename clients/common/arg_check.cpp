@@ -83,6 +83,19 @@ void verify_rocsparse_status_invalid_value(rocsparse_status status, const char*
 #endif
 }
 
+void verify_rocsparse_status_not_implemented(rocsparse_status status, const char* message)
+{
+#ifdef GOOGLE_TEST
+    ASSERT_EQ(status, rocsparse_status_not_implemented);
+#else
+    if(status != rocsparse_status_not_implemented)
+    {
+        std::cerr << "rocSPARSE TEST ERROR: status != rocsparse_status_not_implemented, ";
+        std::cerr << message << std::endl;
+    }
+#endif
+}
+
 void verify_rocsparse_status_zero_pivot(rocsparse_status status, const char* message)
 {
 #ifdef GOOGLE_TEST
@@ -0,0 +1,409 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.hpp"
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+
+/* ============================================================================================ */
+/*  CSR container for zero copy mapping. The header is followed by the row pointer, column
+ *  index and value arrays, each starting at a 2MB boundary, such that each array can be backed
+ *  by huge pages of its own. Indices are stored with the index base of the matrix. */
+#define MAPPED_CSR_MAGIC 0x504D5352
+#define MAPPED_CSR_VERSION 1
+#define MAPPED_CSR_ALIGN (2 << 20)
+
+struct mapped_csr_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t index_size;
+    uint32_t value_type;
+    uint32_t value_size;
+    uint32_t idx_base;
+    int64_t m;
+    int64_t n;
+    int64_t nnz;
+    int64_t ptr_offset;
+    int64_t col_offset;
+    int64_t val_offset;
+    int64_t size;
+};
+
+static inline int64_t mapped_csr_align(int64_t offset)
+{
+    return (offset + MAPPED_CSR_ALIGN - 1) / MAPPED_CSR_ALIGN * MAPPED_CSR_ALIGN;
+}
+
+/* ============================================================================================ */
+/*  NUMA interleaving. Pages of a file are placed by the memory policy of the thread that
+ *  faults them into the page cache, the policy of the mapping is ignored for files. Thus the
+ *  policy of the calling thread is switched to interleave all online nodes while the pages
+ *  are faulted in. */
+#ifndef MPOL_INTERLEAVE
+#define MPOL_INTERLEAVE 3
+#endif
+
+#define MAPPED_CSR_MAX_NODES 4096
+#define MAPPED_CSR_NODE_WORDS (MAPPED_CSR_MAX_NODES / (8 * sizeof(unsigned long)))
+
+// Online nodes from /sys/devices/system/node/online, e.g. "0-3,6"
+static bool mapped_csr_online_nodes(unsigned long* mask)
+{
+    FILE* f = fopen("/sys/devices/system/node/online", "r");
+    if(!f)
+    {
+        return false;
+    }
+
+    char line[4096];
+    bool valid = fgets(line, sizeof(line), f) != nullptr;
+
+    fclose(f);
+
+    memset(mask, 0, sizeof(unsigned long) * MAPPED_CSR_NODE_WORDS);
+
+    int nodes = 0;
+
+    for(char* p = line; valid && *p != '\0' && *p != '\n';)
+    {
+        char* q;
+        long first = strtol(p, &q, 10);
+        long last  = first;
+
+        if(q == p)
+        {
+            return false;
+        }
+
+        if(*q == '-')
+        {
+            p    = q + 1;
+            last = strtol(p, &q, 10);
+        }
+
+        for(long node = first; node <= last && node < MAPPED_CSR_MAX_NODES; ++node)
+        {
+            mask[node / (8 * sizeof(unsigned long))] |= 1UL << (node % (8 * sizeof(unsigned long)));
+            ++nodes;
+        }
+
+        p = (*q == ',') ? q + 1 : q;
+    }
+
+    // Interleaving a single node has no effect
+    return valid && nodes > 1;
+}
+
+static bool mapped_csr_set_policy(int mode, const unsigned long* mask)
+{
+#if defined(SYS_set_mempolicy)
+    return syscall(SYS_set_mempolicy, mode, mask, MAPPED_CSR_MAX_NODES + 1) == 0;
+#else
+    return false;
+#endif
+}
+
+static bool mapped_csr_get_policy(int* mode, unsigned long* mask)
+{
+#if defined(SYS_get_mempolicy)
+    return syscall(SYS_get_mempolicy, mode, mask, MAPPED_CSR_MAX_NODES + 1, nullptr, 0) == 0;
+#else
+    return false;
+#endif
+}
+
+// Fault all pages of the mapping in, from the calling thread
+static void mapped_csr_populate(const char* data, size_t size)
+{
+#if defined(MADV_POPULATE_READ)
+    if(madvise(const_cast<char*>(data), size, MADV_POPULATE_READ) == 0)
+    {
+        return;
+    }
+#endif
+
+    long page = sysconf(_SC_PAGESIZE);
+    volatile char sink;
+
+    for(size_t offset = 0; offset < size; offset += page)
+    {
+        sink = data[offset];
+    }
+
+    (void)sink;
+}
+
+/* ============================================================================================ */
+rocsparse_int parse_mapped_csr_hints(const std::string& list, mapped_csr_hints& hints)
+{
+    std::stringstream ss(list);
+    std::string hint;
+
+    hints = mapped_csr_hints();
+
+    while(std::getline(ss, hint, ','))
+    {
+        if(hint == "huge")
+        {
+            hints.huge_pages = true;
+        }
+        else if(hint == "interleave")
+        {
+            hints.interleave = true;
+        }
+        else if(hint == "populate")
+        {
+            hints.populate = true;
+        }
+        else if(hint != "")
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+rocsparse_int write_mapped_csr(const char* filename,
+                               rocsparse_int m,
+                               rocsparse_int n,
+                               rocsparse_int nnz,
+                               const rocsparse_int* ptr,
+                               const rocsparse_int* col,
+                               const void* val,
+                               uint32_t value_type,
+                               size_t value_size,
+                               rocsparse_index_base idx_base)
+{
+    mapped_csr_header header;
+
+    header.magic      = MAPPED_CSR_MAGIC;
+    header.version    = MAPPED_CSR_VERSION;
+    header.index_size = sizeof(rocsparse_int);
+    header.value_type = value_type;
+    header.value_size = static_cast<uint32_t>(value_size);
+    header.idx_base   = idx_base;
+    header.m          = m;
+    header.n          = n;
+    header.nnz        = nnz;
+    header.ptr_offset = mapped_csr_align(sizeof(header));
+    header.col_offset = mapped_csr_align(header.ptr_offset + sizeof(rocsparse_int) * (m + 1));
+    header.val_offset = mapped_csr_align(header.col_offset + sizeof(rocsparse_int) * nnz);
+    header.size       = header.val_offset + value_size * nnz;
+
+    // Write to a temporary file first, such that concurrent readers never see a partial file
+    std::string tmp = std::string(filename) + "." + std::to_string(getpid());
+
+    FILE* f = fopen(tmp.c_str(), "wb");
+    if(!f)
+    {
+        return -1;
+    }
+
+    // Gaps between the arrays are left as holes of the file
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              fseeko(f, header.ptr_offset, SEEK_SET) == 0 &&
+              fwrite(ptr, sizeof(rocsparse_int), m + 1, f) == static_cast<size_t>(m + 1) &&
+              fseeko(f, header.col_offset, SEEK_SET) == 0 &&
+              fwrite(col, sizeof(rocsparse_int), nnz, f) == static_cast<size_t>(nnz) &&
+              fseeko(f, header.val_offset, SEEK_SET) == 0 &&
+              fwrite(val, value_size, nnz, f) == static_cast<size_t>(nnz);
+
+    ok = (fclose(f) == 0) && ok;
+
+    if(!ok || rename(tmp.c_str(), filename) != 0)
+    {
+        remove(tmp.c_str());
+        return -1;
+    }
+
+    return 0;
+}
+
+rocsparse_int
+    map_csr_matrix(const char* filename, const mapped_csr_hints& hints, mapped_csr_matrix& A)
+{
+    int fd = open(filename, O_RDONLY);
+    if(fd < 0)
+    {
+        return -1;
+    }
+
+    struct stat source;
+    mapped_csr_header header;
+
+    bool valid = fstat(fd, &source) == 0 &&
+                 pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+                 header.magic == MAPPED_CSR_MAGIC && header.version == MAPPED_CSR_VERSION &&
+                 header.index_size == sizeof(rocsparse_int) &&
+                 header.value_size == capture_value_size(header.value_type) &&
+                 header.size == static_cast<int64_t>(source.st_size);
+
+    if(!valid)
+    {
+        close(fd);
+        return -1;
+    }
+
+    size_t size  = header.size;
+    size_t page  = sysconf(_SC_PAGESIZE);
+    size_t align = hints.huge_pages ? MAPPED_CSR_ALIGN : page;
+    size_t span  = (size + page - 1) / page * page;
+
+    // Reserve an address range that is aligned to the huge page size and map the file into it,
+    // such that the 2MB aligned arrays of the file are 2MB aligned in memory
+    char* reserve = static_cast<char*>(
+        mmap(nullptr, span + align, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+
+    if(reserve == MAP_FAILED)
+    {
+        close(fd);
+        return -1;
+    }
+
+    char* base = reinterpret_cast<char*>(
+        (reinterpret_cast<uintptr_t>(reserve) + align - 1) / align * align);
+
+    void* data = mmap(base, size, PROT_READ, MAP_SHARED | MAP_FIXED, fd, 0);
+
+    close(fd);
+
+    if(data == MAP_FAILED)
+    {
+        munmap(reserve, span + align);
+        return -1;
+    }
+
+    // Release the unused parts of the reservation
+    if(base > reserve)
+    {
+        munmap(reserve, base - reserve);
+    }
+
+    if(reserve + span + align > base + span)
+    {
+        munmap(base + span, reserve + align - base);
+    }
+
+    A.m          = static_cast<rocsparse_int>(header.m);
+    A.n          = static_cast<rocsparse_int>(header.n);
+    A.nnz        = static_cast<rocsparse_int>(header.nnz);
+    A.idx_base   = static_cast<rocsparse_index_base>(header.idx_base);
+    A.value_type = header.value_type;
+    A.data       = data;
+    A.size       = size;
+    A.ptr        = reinterpret_cast<const rocsparse_int*>(base + header.ptr_offset);
+    A.col        = reinterpret_cast<const rocsparse_int*>(base + header.col_offset);
+    A.val        = base + header.val_offset;
+
+    A.huge_pages  = false;
+    A.interleaved = false;
+
+#if defined(MADV_HUGEPAGE)
+    // Transparent huge pages of the page cache require kernel support for read only files
+    if(hints.huge_pages)
+    {
+        A.huge_pages = madvise(data, size, MADV_HUGEPAGE) == 0;
+    }
+#endif
+
+    if(hints.interleave)
+    {
+        std::vector<unsigned long> saved(MAPPED_CSR_NODE_WORDS, 0);
+        std::vector<unsigned long> nodes(MAPPED_CSR_NODE_WORDS, 0);
+
+        int mode = 0;
+
+        if(mapped_csr_online_nodes(nodes.data()) && mapped_csr_get_policy(&mode, saved.data()) &&
+           mapped_csr_set_policy(MPOL_INTERLEAVE, nodes.data()))
+        {
+            mapped_csr_populate(base, size);
+            mapped_csr_set_policy(mode, saved.data());
+
+            A.interleaved = true;
+        }
+    }
+
+    if(hints.populate || hints.interleave)
+    {
+        if(!A.interleaved)
+        {
+            mapped_csr_populate(base, size);
+        }
+    }
+    else
+    {
+        // Start reading ahead asynchronously, the first multiplication faults the rest in
+        madvise(data, size, MADV_WILLNEED);
+    }
+
+    return 0;
+}
+
+void unmap_csr_matrix(mapped_csr_matrix& A)
+{
+    if(A.data != nullptr)
+    {
+        munmap(A.data, A.size);
+    }
+
+    A = mapped_csr_matrix();
+}
+
+double mapped_csr_resident(const mapped_csr_matrix& A)
+{
+    size_t page  = sysconf(_SC_PAGESIZE);
+    size_t pages = (A.size + page - 1) / page;
+
+    if(pages == 0)
+    {
+        return 1.0;
+    }
+
+    std::vector<unsigned char> resident(pages);
+
+    if(mincore(A.data, A.size, resident.data()) != 0)
+    {
+        return 0.0;
+    }
+
+    size_t count = 0;
+
+    for(size_t i = 0; i < pages; ++i)
+    {
+        count += resident[i] & 1;
+    }
+
+    return static_cast<double>(count) / pages;
+}
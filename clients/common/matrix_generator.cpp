@@ -0,0 +1,335 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "utility.hpp"
+
+#include <climits>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+/* ============================================================================================ */
+/*  Entries are generated by multiple threads, random numbers are derived from the entry
+ *  position only, such that the matrices do not depend on the number of threads. */
+
+// splitmix64 finalizer
+static inline uint64_t gen_hash(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Uniform random number in [0, 1)
+static inline double gen_uniform(uint64_t x)
+{
+    return (gen_hash(x) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Off-diagonal value in [-1, 0), diagonals are fixed up afterwards
+static inline double gen_value(int64_t i, int64_t j)
+{
+    return gen_uniform((static_cast<uint64_t>(i) << 32) ^ static_cast<uint64_t>(j)) - 1.0;
+}
+
+static inline void gen_push(coo_chunk& chunk, int64_t i, int64_t j, double val)
+{
+    chunk.row.push_back(static_cast<rocsparse_int>(i));
+    chunk.col.push_back(static_cast<rocsparse_int>(j));
+    chunk.re.push_back(val);
+}
+
+// Generates the rows of each thread with row(chunk, i)
+template <typename F>
+static void gen_rows(int64_t m, std::vector<coo_chunk>& chunk, F row)
+{
+    int nthreads = static_cast<int>(chunk.size());
+
+    host_parallel(nthreads, [&](int t) {
+        for(int64_t i = m * t / nthreads; i < m * (t + 1) / nthreads; ++i)
+        {
+            row(chunk[t], i);
+        }
+    });
+}
+
+/* ============================================================================================ */
+/*  3D 7 or 27 point stencil on a dim^3 grid. */
+static void gen_stencil(int64_t dim, bool full, std::vector<coo_chunk>& chunk)
+{
+    gen_rows(dim * dim * dim, chunk, [&](coo_chunk& c, int64_t i) {
+        int64_t x = i % dim;
+        int64_t y = i / dim % dim;
+        int64_t z = i / (dim * dim);
+
+        for(int64_t dz = -1; dz <= 1; ++dz)
+        {
+            for(int64_t dy = -1; dy <= 1; ++dy)
+            {
+                for(int64_t dx = -1; dx <= 1; ++dx)
+                {
+                    bool inside = x + dx >= 0 && x + dx < dim && y + dy >= 0 && y + dy < dim &&
+                                  z + dz >= 0 && z + dz < dim;
+
+                    if(inside && (full || std::abs(dx) + std::abs(dy) + std::abs(dz) <= 1))
+                    {
+                        gen_push(c, i, i + dx + dy * dim + dz * dim * dim, -1.0);
+                    }
+                }
+            }
+        }
+    });
+}
+
+/* ============================================================================================ */
+/*  Block structured matrix, 27 point connectivity on a dim^3 grid of nodes with dense
+ *  block_dim x block_dim blocks, as obtained from FEM with block_dim unknowns per node. */
+static void gen_block(int64_t dim, int64_t block_dim, std::vector<coo_chunk>& chunk)
+{
+    gen_rows(dim * dim * dim * block_dim, chunk, [&](coo_chunk& c, int64_t i) {
+        int64_t node = i / block_dim;
+        int64_t x    = node % dim;
+        int64_t y    = node / dim % dim;
+        int64_t z    = node / (dim * dim);
+
+        for(int64_t dz = -1; dz <= 1; ++dz)
+        {
+            for(int64_t dy = -1; dy <= 1; ++dy)
+            {
+                for(int64_t dx = -1; dx <= 1; ++dx)
+                {
+                    if(x + dx < 0 || x + dx >= dim || y + dy < 0 || y + dy >= dim || z + dz < 0 ||
+                       z + dz >= dim)
+                    {
+                        continue;
+                    }
+
+                    int64_t col = (node + dx + dy * dim + dz * dim * dim) * block_dim;
+
+                    for(int64_t k = 0; k < block_dim; ++k)
+                    {
+                        gen_push(c, i, col + k, gen_value(i, col + k));
+                    }
+                }
+            }
+        }
+    });
+}
+
+/* ============================================================================================ */
+/*  Banded matrix with full band of given bandwidth on both sides of the diagonal. */
+static void gen_banded(int64_t m, int64_t bandwidth, std::vector<coo_chunk>& chunk)
+{
+    gen_rows(m, chunk, [&](coo_chunk& c, int64_t i) {
+        for(int64_t j = std::max<int64_t>(0, i - bandwidth); j <= std::min(m - 1, i + bandwidth);
+            ++j)
+        {
+            gen_push(c, i, j, gen_value(i, j));
+        }
+    });
+}
+
+/* ============================================================================================ */
+/*  Structurally symmetric matrix whose triangular parts form a single dependency chain, row i
+ *  depends on row i - 1 and on extra random rows before it. Triangular solves cannot be
+ *  parallelized over rows, each row is its own level. */
+static void gen_chain(int64_t m, int64_t extra, std::vector<coo_chunk>& chunk)
+{
+    gen_rows(m, chunk, [&](coo_chunk& c, int64_t i) {
+        gen_push(c, i, i, 0.0);
+
+        for(int64_t k = 0; i > 0 && k <= extra; ++k)
+        {
+            int64_t j = (k == 0) ? i - 1 : static_cast<int64_t>(gen_hash(i * (extra + 1) + k) % i);
+
+            // Both triangular parts, duplicates are summed up
+            gen_push(c, i, j, gen_value(i, j));
+            gen_push(c, j, i, gen_value(i, j));
+        }
+    });
+}
+
+/* ============================================================================================ */
+/*  R-MAT graph with 2^scale vertices and edge_factor * 2^scale edges, using the Graph500
+ *  probabilities a = 0.57, b = c = 0.19. The row lengths follow a power law. */
+static void gen_rmat(int64_t scale, int64_t edge_factor, std::vector<coo_chunk>& chunk)
+{
+    const double a = 0.57;
+    const double b = 0.19;
+    const double c = 0.19;
+
+    int64_t m     = int64_t(1) << scale;
+    int64_t edges = m * edge_factor;
+
+    // Diagonal entries, such that the matrix is non-singular
+    gen_rows(m, chunk, [&](coo_chunk& ch, int64_t i) { gen_push(ch, i, i, 0.0); });
+
+    gen_rows(edges, chunk, [&](coo_chunk& ch, int64_t e) {
+        int64_t i = 0;
+        int64_t j = 0;
+
+        // Choose one quadrant per level
+        for(int64_t level = 0; level < scale; ++level)
+        {
+            double r = gen_uniform(e * scale + level);
+
+            i = 2 * i + (r >= a + b);
+            j = 2 * j + ((r >= a && r < a + b) || r >= a + b + c);
+        }
+
+        gen_push(ch, i, j, gen_value(i, j));
+    });
+}
+
+/* ============================================================================================ */
+/*  Generate a synthetic matrix in CSR format. */
+rocsparse_int gen_matrix_csr(const std::string& generator,
+                             rocsparse_int dim,
+                             rocsparse_int bandwidth,
+                             rocsparse_int block_dim,
+                             rocsparse_int edge_factor,
+                             mtx_csr_matrix& A)
+{
+    printf("Generating %s matrix...", generator.c_str());
+    fflush(stdout);
+
+    if(dim <= 0 || bandwidth < 0 || block_dim <= 0 || edge_factor <= 0)
+    {
+        return -1;
+    }
+
+    // Number of rows and estimated number of entries
+    int64_t d = dim;
+    int64_t m;
+    int64_t nnz;
+
+    if(generator == "stencil7" || generator == "stencil27")
+    {
+        m   = d * d * d;
+        nnz = m * (generator == "stencil7" ? 7 : 27);
+    }
+    else if(generator == "block")
+    {
+        m   = d * d * d * block_dim;
+        nnz = m * 27 * block_dim;
+    }
+    else if(generator == "banded")
+    {
+        m   = d;
+        nnz = m * (2 * int64_t(bandwidth) + 1);
+    }
+    else if(generator == "chain")
+    {
+        m   = d;
+        nnz = m * (2 * int64_t(bandwidth) + 3);
+    }
+    else if(generator == "rmat")
+    {
+        if(dim > 30)
+        {
+            return -1;
+        }
+
+        m   = int64_t(1) << dim;
+        nnz = m * (edge_factor + 1);
+    }
+    else
+    {
+        return -1;
+    }
+
+    if(m > INT_MAX || nnz > INT_MAX)
+    {
+        return -1;
+    }
+
+    std::vector<coo_chunk> chunk(host_threads(m / 4096 + 1));
+
+    if(generator == "stencil7" || generator == "stencil27")
+    {
+        gen_stencil(d, generator == "stencil27", chunk);
+    }
+    else if(generator == "block")
+    {
+        gen_block(d, block_dim, chunk);
+    }
+    else if(generator == "banded")
+    {
+        gen_banded(d, bandwidth, chunk);
+    }
+    else if(generator == "chain")
+    {
+        gen_chain(d, bandwidth, chunk);
+    }
+    else
+    {
+        gen_rmat(d, edge_factor, chunk);
+    }
+
+    if(!assemble_csr_matrix(chunk,
+                            static_cast<rocsparse_int>(m),
+                            static_cast<rocsparse_int>(m),
+                            false,
+                            true,
+                            A))
+    {
+        return -1;
+    }
+
+    // Make the matrix strictly diagonally dominant, such that solvers and incomplete
+    // factorizations are well defined
+    int nthreads = static_cast<int>(chunk.size());
+
+    host_parallel(nthreads, [&](int t) {
+        for(int64_t i = m * t / nthreads; i < m * (t + 1) / nthreads; ++i)
+        {
+            double sum  = 1.0;
+            int64_t pos = -1;
+
+            for(rocsparse_int j = A.ptr[i]; j < A.ptr[i + 1]; ++j)
+            {
+                if(A.col[j] == i)
+                {
+                    pos = j;
+                }
+                else
+                {
+                    sum += std::abs(A.re[j]);
+                }
+            }
+
+            if(pos >= 0)
+            {
+                A.re[pos] = sum;
+            }
+        }
+    });
+
+    printf("done.\n");
+    fflush(stdout);
+
+    return 0;
+}
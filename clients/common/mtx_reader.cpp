@@ -0,0 +1,746 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "utility.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+/* ============================================================================================ */
+/*  Binary CSR cache, written next to the MatrixMarket file as <file>.rsmc. The cache is only
+ *  used if its version and index size match and the source file did not change since. */
+#define MTX_CACHE_MAGIC 0x434D5352
+#define MTX_CACHE_VERSION 1
+
+struct mtx_cache_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t index_size;
+    uint32_t complex;
+    int64_t m;
+    int64_t n;
+    int64_t nnz;
+    int64_t source_size;
+    int64_t source_mtime;
+};
+
+static bool mtx_cache_enabled()
+{
+    const char* env = getenv("ROCSPARSE_MTX_CACHE");
+    return env == nullptr || strcmp(env, "0") != 0;
+}
+
+static bool mtx_cache_read(const std::string& path, const struct stat& source, mtx_csr_matrix& mtx)
+{
+    FILE* f = fopen(path.c_str(), "rb");
+    if(!f)
+    {
+        return false;
+    }
+
+    mtx_cache_header header;
+
+    bool valid = fread(&header, sizeof(header), 1, f) == 1 && header.magic == MTX_CACHE_MAGIC &&
+                 header.version == MTX_CACHE_VERSION &&
+                 header.index_size == sizeof(rocsparse_int) &&
+                 header.source_size == static_cast<int64_t>(source.st_size) &&
+                 header.source_mtime == static_cast<int64_t>(source.st_mtime);
+
+    if(valid)
+    {
+        mtx.m   = static_cast<rocsparse_int>(header.m);
+        mtx.n   = static_cast<rocsparse_int>(header.n);
+        mtx.nnz = static_cast<rocsparse_int>(header.nnz);
+
+        size_t nptr = mtx.m + 1;
+        size_t nnz  = mtx.nnz;
+
+        mtx.ptr.resize(nptr);
+        mtx.col.resize(nnz);
+        mtx.re.resize(nnz);
+        mtx.im.resize(header.complex ? nnz : 0);
+
+        valid = fread(mtx.ptr.data(), sizeof(rocsparse_int), nptr, f) == nptr &&
+                fread(mtx.col.data(), sizeof(rocsparse_int), nnz, f) == nnz &&
+                fread(mtx.re.data(), sizeof(double), nnz, f) == nnz &&
+                fread(mtx.im.data(), sizeof(double), mtx.im.size(), f) == mtx.im.size();
+    }
+
+    fclose(f);
+
+    return valid;
+}
+
+static void mtx_cache_write(const std::string& path,
+                            const struct stat& source,
+                            const mtx_csr_matrix& mtx)
+{
+    // Write to a temporary file first, such that concurrent readers never see a partial cache
+    std::string tmp = path + "." + std::to_string(getpid());
+
+    FILE* f = fopen(tmp.c_str(), "wb");
+    if(!f)
+    {
+        // Directory might be read only, loading just stays uncached
+        return;
+    }
+
+    mtx_cache_header header;
+
+    header.magic        = MTX_CACHE_MAGIC;
+    header.version      = MTX_CACHE_VERSION;
+    header.index_size   = sizeof(rocsparse_int);
+    header.complex      = !mtx.im.empty();
+    header.m            = mtx.m;
+    header.n            = mtx.n;
+    header.nnz          = mtx.nnz;
+    header.source_size  = source.st_size;
+    header.source_mtime = source.st_mtime;
+
+    size_t nptr = mtx.ptr.size();
+    size_t nnz  = mtx.col.size();
+
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              fwrite(mtx.ptr.data(), sizeof(rocsparse_int), nptr, f) == nptr &&
+              fwrite(mtx.col.data(), sizeof(rocsparse_int), nnz, f) == nnz &&
+              fwrite(mtx.re.data(), sizeof(double), mtx.re.size(), f) == mtx.re.size() &&
+              fwrite(mtx.im.data(), sizeof(double), mtx.im.size(), f) == mtx.im.size();
+
+    ok = (fclose(f) == 0) && ok;
+
+    if(!ok || rename(tmp.c_str(), path.c_str()) != 0)
+    {
+        remove(tmp.c_str());
+    }
+}
+
+/* ============================================================================================ */
+/*  Parsing */
+
+static inline const char* mtx_skip_blank(const char* p, const char* end)
+{
+    while(p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+    {
+        ++p;
+    }
+
+    return p;
+}
+
+static inline const char* mtx_skip_line(const char* p, const char* end)
+{
+    const char* eol = static_cast<const char*>(memchr(p, '\n', end - p));
+    return eol ? eol + 1 : end;
+}
+
+static inline bool mtx_blank_line(const char* p, const char* end)
+{
+    p = mtx_skip_blank(p, end);
+    return p == end || *p == '\n';
+}
+
+static inline const char* mtx_parse_int(const char* p, const char* end, int64_t& val)
+{
+    p = mtx_skip_blank(p, end);
+
+    bool neg = (p < end && *p == '-');
+    if(neg || (p < end && *p == '+'))
+    {
+        ++p;
+    }
+
+    const char* begin = p;
+    int64_t v         = 0;
+
+    while(p < end && *p >= '0' && *p <= '9' && v < (INT64_MAX - 9) / 10)
+    {
+        v = v * 10 + (*p++ - '0');
+    }
+
+    if(p == begin)
+    {
+        return nullptr;
+    }
+
+    val = neg ? -v : v;
+    return p;
+}
+
+// Decimal numbers with at most 19 significant digits and a small exponent are converted
+// exactly with a single multiplication or division, all others fall back to strtod
+static inline const char* mtx_parse_double(const char* p, const char* end, double& val)
+{
+    static const double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                   1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                   1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    p = mtx_skip_blank(p, end);
+
+    const char* begin = p;
+
+    bool neg = (p < end && *p == '-');
+    if(neg || (p < end && *p == '+'))
+    {
+        ++p;
+    }
+
+    uint64_t mantissa = 0;
+    int digits        = 0;
+    int exponent      = 0;
+    bool any          = false;
+
+    for(; p < end && *p >= '0' && *p <= '9'; ++p, any = true)
+    {
+        if(mantissa == 0 && *p == '0')
+        {
+            continue;
+        }
+
+        if(digits < 19)
+        {
+            mantissa = mantissa * 10 + (*p - '0');
+        }
+        else
+        {
+            ++exponent;
+        }
+
+        ++digits;
+    }
+
+    if(p < end && *p == '.')
+    {
+        for(++p; p < end && *p >= '0' && *p <= '9'; ++p, any = true)
+        {
+            if(mantissa == 0 && *p == '0')
+            {
+                --exponent;
+                continue;
+            }
+
+            if(digits < 19)
+            {
+                mantissa = mantissa * 10 + (*p - '0');
+                --exponent;
+            }
+
+            ++digits;
+        }
+    }
+
+    if(any && p < end && (*p == 'e' || *p == 'E'))
+    {
+        int64_t e;
+        const char* q = mtx_parse_int(p + 1, end, e);
+
+        // No blanks allowed between exponent character and exponent
+        if(q != nullptr && mtx_skip_blank(p + 1, end) == p + 1)
+        {
+            exponent += static_cast<int>(std::max<int64_t>(std::min<int64_t>(e, 100000), -100000));
+            p = q;
+        }
+    }
+
+    if(any && digits <= 19 && mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22)
+    {
+        double v = static_cast<double>(mantissa);
+        v        = (exponent < 0) ? v / pow10[-exponent] : v * pow10[exponent];
+        val      = neg ? -v : v;
+
+        return p;
+    }
+
+    // Slow path, the mapped file is not null terminated
+    char buffer[128];
+    size_t len = 0;
+
+    for(p = begin; p < end && len < sizeof(buffer) - 1; ++p)
+    {
+        if(isspace(static_cast<unsigned char>(*p)))
+        {
+            break;
+        }
+
+        buffer[len++] = *p;
+    }
+
+    buffer[len] = '\0';
+
+    char* stop;
+    val = strtod(buffer, &stop);
+
+    return (stop == buffer) ? nullptr : begin + (stop - buffer);
+}
+
+// Parses the entries in [p, end) into chunk, returns false on invalid entries
+static bool mtx_parse_chunk(const char* p,
+                            const char* end,
+                            int64_t m,
+                            int64_t n,
+                            bool pattern,
+                            bool complex,
+                            bool symmetric,
+                            coo_chunk& chunk,
+                            int64_t& lines)
+{
+    while(p < end)
+    {
+        p = mtx_skip_blank(p, end);
+
+        // Skip empty lines and comments
+        if(mtx_blank_line(p, end) || *p == '%')
+        {
+            p = mtx_skip_line(p, end);
+            continue;
+        }
+
+        int64_t i = 0;
+        int64_t j = 0;
+        double re = 1.0;
+        double im = 0.0;
+
+        p = mtx_parse_int(p, end, i);
+        p = p ? mtx_parse_int(p, end, j) : nullptr;
+        p = (p && !pattern) ? mtx_parse_double(p, end, re) : p;
+        p = (p && complex) ? mtx_parse_double(p, end, im) : p;
+
+        if(p == nullptr || i < 1 || i > m || j < 1 || j > n)
+        {
+            return false;
+        }
+
+        chunk.row.push_back(static_cast<rocsparse_int>(i - 1));
+        chunk.col.push_back(static_cast<rocsparse_int>(j - 1));
+        chunk.re.push_back(re);
+
+        if(complex)
+        {
+            chunk.im.push_back(im);
+        }
+
+        if(symmetric && i != j)
+        {
+            chunk.row.push_back(static_cast<rocsparse_int>(j - 1));
+            chunk.col.push_back(static_cast<rocsparse_int>(i - 1));
+            chunk.re.push_back(re);
+
+            if(complex)
+            {
+                chunk.im.push_back(im);
+            }
+        }
+
+        ++lines;
+
+        p = mtx_skip_line(p, end);
+    }
+
+    return true;
+}
+
+// Parses the MatrixMarket file in memory [data, end) into CSR format
+static bool mtx_parse(const char* data, const char* end, int nthreads, mtx_csr_matrix& mtx)
+{
+    const char* p = data;
+
+    // Banner
+    char banner[16];
+    char array[16];
+    char coord[16];
+    char type[16];
+    char symm[16];
+    char line[1024];
+
+    size_t len = std::min<size_t>(mtx_skip_line(p, end) - p, sizeof(line) - 1);
+
+    memcpy(line, p, len);
+    line[len] = '\0';
+
+    if(sscanf(line, "%15s %15s %15s %15s %15s", banner, array, coord, type, symm) != 5)
+    {
+        return false;
+    }
+
+    // Convert to lower case
+    for(char *c = array; *c != '\0'; *c = tolower(*c), c++)
+        ;
+    for(char *c = coord; *c != '\0'; *c = tolower(*c), c++)
+        ;
+    for(char *c = type; *c != '\0'; *c = tolower(*c), c++)
+        ;
+    for(char *c = symm; *c != '\0'; *c = tolower(*c), c++)
+        ;
+
+    if(strncmp(banner, "%%MatrixMarket", 14) != 0 || strcmp(array, "matrix") != 0 ||
+       strcmp(coord, "coordinate") != 0)
+    {
+        return false;
+    }
+
+    if(strcmp(type, "real") != 0 && strcmp(type, "integer") != 0 && strcmp(type, "pattern") != 0 &&
+       strcmp(type, "complex") != 0)
+    {
+        return false;
+    }
+
+    if(strcmp(symm, "general") != 0 && strcmp(symm, "symmetric") != 0)
+    {
+        return false;
+    }
+
+    bool pattern   = !strcmp(type, "pattern");
+    bool complex   = !strcmp(type, "complex");
+    bool symmetric = !strcmp(symm, "symmetric");
+
+    // Skip comments
+    p = mtx_skip_line(p, end);
+
+    while(p < end && (*p == '%' || mtx_blank_line(p, end)))
+    {
+        p = mtx_skip_line(p, end);
+    }
+
+    // Dimensions
+    int64_t m;
+    int64_t n;
+    int64_t lines;
+
+    p = mtx_parse_int(p, end, m);
+    p = p ? mtx_parse_int(p, end, n) : nullptr;
+    p = p ? mtx_parse_int(p, end, lines) : nullptr;
+
+    if(p == nullptr || m < 0 || m > INT_MAX || n < 0 || n > INT_MAX || lines < 0)
+    {
+        return false;
+    }
+
+    p = mtx_skip_line(p, end);
+
+    // Split the entries into chunks of complete lines, one per thread
+    std::vector<const char*> bound(nthreads + 1, end);
+    std::vector<coo_chunk> chunk(nthreads);
+    std::vector<int64_t> parsed(nthreads, 0);
+    std::vector<int> valid(nthreads);
+
+    bound[0] = p;
+
+    for(int t = 1; t < nthreads; ++t)
+    {
+        bound[t] = std::max(bound[t - 1], mtx_skip_line(p + (end - p) * t / nthreads - 1, end));
+    }
+
+    host_parallel(nthreads, [&](int t) {
+        valid[t] = mtx_parse_chunk(
+            bound[t], bound[t + 1], m, n, pattern, complex, symmetric, chunk[t], parsed[t]);
+    });
+
+    for(int t = 0; t < nthreads; ++t)
+    {
+        if(!valid[t])
+        {
+            return false;
+        }
+
+        lines -= parsed[t];
+    }
+
+    // Duplicate entries are kept, as the MatrixMarket format does not define their meaning
+    return lines == 0 && assemble_csr_matrix(chunk, m, n, complex, false, mtx);
+}
+
+/* ============================================================================================ */
+/*  Assemble CSR matrix from the COO entries of multiple threads. */
+bool assemble_csr_matrix(std::vector<coo_chunk>& chunk,
+                         rocsparse_int m,
+                         rocsparse_int n,
+                         bool complex,
+                         bool sum_duplicates,
+                         mtx_csr_matrix& A)
+{
+    int nthreads = static_cast<int>(chunk.size());
+
+    // Offset of each chunk into the entry list
+    std::vector<int64_t> offset(nthreads + 1, 0);
+
+    for(int t = 0; t < nthreads; ++t)
+    {
+        offset[t + 1] = offset[t] + chunk[t].row.size();
+    }
+
+    if(offset[nthreads] > INT_MAX)
+    {
+        return false;
+    }
+
+    A.m   = m;
+    A.n   = n;
+    A.nnz = static_cast<rocsparse_int>(offset[nthreads]);
+
+    // Count the entries per row
+    std::vector<std::atomic<rocsparse_int>> count(m);
+
+    host_parallel(nthreads, [&](int t) {
+        for(size_t k = 0; k < chunk[t].row.size(); ++k)
+        {
+            count[chunk[t].row[k]].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    A.ptr.resize(m + 1);
+    A.ptr[0] = 0;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        A.ptr[i + 1] = A.ptr[i] + count[i].load(std::memory_order_relaxed);
+        count[i].store(A.ptr[i], std::memory_order_relaxed);
+    }
+
+    // Scatter the entries into their rows, keep the entry index to sort the rows
+    std::vector<rocsparse_int> entry(A.nnz);
+
+    A.col.resize(A.nnz);
+
+    host_parallel(nthreads, [&](int t) {
+        for(size_t k = 0; k < chunk[t].row.size(); ++k)
+        {
+            rocsparse_int pos = count[chunk[t].row[k]].fetch_add(1, std::memory_order_relaxed);
+
+            A.col[pos] = chunk[t].col[k];
+            entry[pos] = static_cast<rocsparse_int>(offset[t] + k);
+        }
+    });
+
+    // Sort each row by column index, duplicates stay in entry order or are summed up
+    std::vector<rocsparse_int> unique(m);
+
+    A.re.resize(A.nnz);
+    A.im.resize(complex ? A.nnz : 0);
+
+    host_parallel(nthreads, [&](int t) {
+        rocsparse_int row_begin = static_cast<rocsparse_int>(int64_t(m) * t / nthreads);
+        rocsparse_int row_end   = static_cast<rocsparse_int>(int64_t(m) * (t + 1) / nthreads);
+
+        std::vector<std::pair<rocsparse_int, rocsparse_int>> key;
+
+        for(rocsparse_int i = row_begin; i < row_end; ++i)
+        {
+            key.clear();
+
+            for(rocsparse_int j = A.ptr[i]; j < A.ptr[i + 1]; ++j)
+            {
+                key.push_back(std::make_pair(A.col[j], entry[j]));
+            }
+
+            std::sort(key.begin(), key.end());
+
+            rocsparse_int pos = A.ptr[i] - 1;
+
+            for(size_t k = 0; k < key.size(); ++k)
+            {
+                int64_t e = key[k].second;
+                int s     = static_cast<int>(std::upper_bound(offset.begin(), offset.end(), e)
+                                         - offset.begin() - 1);
+
+                double re = chunk[s].re[e - offset[s]];
+                double im = complex ? chunk[s].im[e - offset[s]] : 0.0;
+
+                if(sum_duplicates && k > 0 && key[k].first == key[k - 1].first)
+                {
+                    A.re[pos] += re;
+
+                    if(complex)
+                    {
+                        A.im[pos] += im;
+                    }
+
+                    continue;
+                }
+
+                ++pos;
+
+                A.col[pos] = key[k].first;
+                A.re[pos]  = re;
+
+                if(complex)
+                {
+                    A.im[pos] = im;
+                }
+            }
+
+            unique[i] = pos + 1 - A.ptr[i];
+        }
+    });
+
+    if(!sum_duplicates)
+    {
+        return true;
+    }
+
+    // Compress the rows, if duplicates have been summed up
+    mtx_csr_matrix B;
+
+    B.m   = m;
+    B.n   = n;
+    B.ptr.resize(m + 1);
+    B.ptr[0] = 0;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        B.ptr[i + 1] = B.ptr[i] + unique[i];
+    }
+
+    B.nnz = B.ptr[m];
+    B.col.resize(B.nnz);
+    B.re.resize(B.nnz);
+    B.im.resize(complex ? B.nnz : 0);
+
+    host_parallel(nthreads, [&](int t) {
+        rocsparse_int row_begin = static_cast<rocsparse_int>(int64_t(m) * t / nthreads);
+        rocsparse_int row_end   = static_cast<rocsparse_int>(int64_t(m) * (t + 1) / nthreads);
+
+        for(rocsparse_int i = row_begin; i < row_end; ++i)
+        {
+            std::copy(&A.col[A.ptr[i]], &A.col[A.ptr[i]] + unique[i], &B.col[B.ptr[i]]);
+            std::copy(&A.re[A.ptr[i]], &A.re[A.ptr[i]] + unique[i], &B.re[B.ptr[i]]);
+
+            if(complex)
+            {
+                std::copy(&A.im[A.ptr[i]], &A.im[A.ptr[i]] + unique[i], &B.im[B.ptr[i]]);
+            }
+        }
+    });
+
+    std::swap(A, B);
+
+    return true;
+}
+
+/* ============================================================================================ */
+/*  Parse MatrixMarket file in memory into CSR format. */
+rocsparse_int parse_mtx_csr(const char* data, size_t size, int nthreads, mtx_csr_matrix& mtx)
+{
+    if(nthreads < 1 || !mtx_parse(data, data + size, nthreads, mtx))
+    {
+        return -1;
+    }
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*  Read MatrixMarket file into CSR format, using the binary cache if available. */
+rocsparse_int read_mtx_csr(const char* filename, mtx_csr_matrix& mtx)
+{
+    printf("Reading matrix %s...", filename);
+    fflush(stdout);
+
+    std::chrono::high_resolution_clock::time_point start =
+        std::chrono::high_resolution_clock::now();
+
+    int fd = open(filename, O_RDONLY);
+    if(fd < 0)
+    {
+        return -1;
+    }
+
+    struct stat source;
+
+    if(fstat(fd, &source) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    std::string cache = std::string(filename) + ".rsmc";
+    bool use_cache    = mtx_cache_enabled();
+    bool cached       = use_cache && mtx_cache_read(cache, source, mtx);
+    double mbytes     = 0.0;
+
+    if(cached)
+    {
+        close(fd);
+
+        size_t bytes = sizeof(mtx_cache_header) + sizeof(rocsparse_int) * mtx.ptr.size() +
+                       sizeof(rocsparse_int) * mtx.col.size() + sizeof(double) * mtx.re.size() +
+                       sizeof(double) * mtx.im.size();
+
+        mbytes = bytes / 1e6;
+    }
+    else
+    {
+        size_t size = source.st_size;
+        void* data  = (size > 0) ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+
+        close(fd);
+
+        if(data == MAP_FAILED)
+        {
+            return -1;
+        }
+
+        madvise(data, size, MADV_SEQUENTIAL);
+
+        // Few threads for small files, each thread parses at least 1MB
+        int nthreads = host_threads(size / (1 << 20) + 1);
+
+        const char* begin = static_cast<const char*>(data);
+        bool valid        = mtx_parse(begin, begin + size, nthreads, mtx);
+
+        munmap(data, size);
+
+        if(!valid)
+        {
+            return -1;
+        }
+
+        mbytes = size / 1e6;
+    }
+
+    double sec = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start)
+                     .count();
+
+    printf("done (%.1lf MB/s%s).\n", mbytes / std::max(sec, 1e-9), cached ? ", cached" : "");
+    fflush(stdout);
+
+    // Load throughput excludes writing the cache
+    if(use_cache && !cached)
+    {
+        mtx_cache_write(cache, source, mtx);
+    }
+
+    return 0;
+}
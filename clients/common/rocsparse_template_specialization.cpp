@@ -205,6 +205,108 @@ rocsparse_status rocsparse_coomv(rocsparse_handle handle,
         handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
 }
 
+template <>
+rocsparse_status rocsparse_coomv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 rocsparse_int nnz,
+                                 const rocsparse_float_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_float_complex* coo_val,
+                                 const rocsparse_int* coo_row_ind,
+                                 const rocsparse_int* coo_col_ind,
+                                 const rocsparse_float_complex* x,
+                                 const rocsparse_float_complex* beta,
+                                 rocsparse_float_complex* y)
+{
+    return rocsparse_ccoomv(
+        handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_coomv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 rocsparse_int nnz,
+                                 const rocsparse_double_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_double_complex* coo_val,
+                                 const rocsparse_int* coo_row_ind,
+                                 const rocsparse_int* coo_col_ind,
+                                 const rocsparse_double_complex* x,
+                                 const rocsparse_double_complex* beta,
+                                 rocsparse_double_complex* y)
+{
+    return rocsparse_zcoomv(
+        handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_coomv_semiring(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_semiring semiring,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int nnz,
+                                          const float* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const float* coo_val,
+                                          const rocsparse_int* coo_row_ind,
+                                          const rocsparse_int* coo_col_ind,
+                                          const float* x,
+                                          const float* beta,
+                                          float* y)
+{
+    return rocsparse_scoomv_semiring(handle,
+                                     trans,
+                                     semiring,
+                                     m,
+                                     n,
+                                     nnz,
+                                     alpha,
+                                     descr,
+                                     coo_val,
+                                     coo_row_ind,
+                                     coo_col_ind,
+                                     x,
+                                     beta,
+                                     y);
+}
+
+template <>
+rocsparse_status rocsparse_coomv_semiring(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_semiring semiring,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int nnz,
+                                          const double* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const double* coo_val,
+                                          const rocsparse_int* coo_row_ind,
+                                          const rocsparse_int* coo_col_ind,
+                                          const double* x,
+                                          const double* beta,
+                                          double* y)
+{
+    return rocsparse_dcoomv_semiring(handle,
+                                     trans,
+                                     semiring,
+                                     m,
+                                     n,
+                                     nnz,
+                                     alpha,
+                                     descr,
+                                     coo_val,
+                                     coo_row_ind,
+                                     coo_col_ind,
+                                     x,
+                                     beta,
+                                     y);
+}
+
 template <>
 rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle handle,
                                           rocsparse_operation trans,
@@ -237,6 +339,38 @@ rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle handle,
         handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
 }
 
+template <>
+rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_half* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          rocsparse_mat_info info)
+{
+    return rocsparse_hcsrmv_analysis(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_bfloat16* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          rocsparse_mat_info info)
+{
+    return rocsparse_bfcsrmv_analysis(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
 template <>
 rocsparse_status rocsparse_csrmv(rocsparse_handle handle,
                                  rocsparse_operation trans,
@@ -301,6 +435,408 @@ rocsparse_status rocsparse_csrmv(rocsparse_handle handle,
                             y);
 }
 
+template <>
+rocsparse_status rocsparse_csrmv_semiring(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_semiring semiring,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int nnz,
+                                          const float* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const float* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          rocsparse_mat_info info,
+                                          const float* x,
+                                          const float* beta,
+                                          float* y)
+{
+    return rocsparse_scsrmv_semiring(handle,
+                                     trans,
+                                     semiring,
+                                     m,
+                                     n,
+                                     nnz,
+                                     alpha,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     info,
+                                     x,
+                                     beta,
+                                     y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_semiring(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_semiring semiring,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int nnz,
+                                          const double* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const double* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          rocsparse_mat_info info,
+                                          const double* x,
+                                          const double* beta,
+                                          double* y)
+{
+    return rocsparse_dcsrmv_semiring(handle,
+                                     trans,
+                                     semiring,
+                                     m,
+                                     n,
+                                     nnz,
+                                     alpha,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     info,
+                                     x,
+                                     beta,
+                                     y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_masked(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        rocsparse_int nnz,
+                                        const float* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const float* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        const float* x,
+                                        const float* beta,
+                                        rocsparse_int mask_nnz,
+                                        const rocsparse_int* mask_ind,
+                                        float* y)
+{
+    return rocsparse_scsrmv_masked(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   x,
+                                   beta,
+                                   mask_nnz,
+                                   mask_ind,
+                                   y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_masked(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        rocsparse_int nnz,
+                                        const double* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const double* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        const double* x,
+                                        const double* beta,
+                                        rocsparse_int mask_nnz,
+                                        const rocsparse_int* mask_ind,
+                                        double* y)
+{
+    return rocsparse_dcsrmv_masked(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   x,
+                                   beta,
+                                   mask_nnz,
+                                   mask_ind,
+                                   y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_stream(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        rocsparse_int nnz,
+                                        const float* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const rocsparse_int* csr_row_ptr,
+                                        rocsparse_int panel_nnz,
+                                        rocsparse_csr_panel_read read_panel,
+                                        void* user_data,
+                                        const float* x,
+                                        const float* beta,
+                                        float* y)
+{
+    return rocsparse_scsrmv_stream(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_row_ptr,
+                                   panel_nnz,
+                                   read_panel,
+                                   user_data,
+                                   x,
+                                   beta,
+                                   y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_stream(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        rocsparse_int nnz,
+                                        const double* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const rocsparse_int* csr_row_ptr,
+                                        rocsparse_int panel_nnz,
+                                        rocsparse_csr_panel_read read_panel,
+                                        void* user_data,
+                                        const double* x,
+                                        const double* beta,
+                                        double* y)
+{
+    return rocsparse_dcsrmv_stream(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   nnz,
+                                   alpha,
+                                   descr,
+                                   csr_row_ptr,
+                                   panel_nnz,
+                                   read_panel,
+                                   user_data,
+                                   x,
+                                   beta,
+                                   y);
+}
+
+template <>
+rocsparse_status rocsparse_cscmspv(rocsparse_handle handle,
+                                   rocsparse_semiring semiring,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const float* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const float* csc_val,
+                                   const rocsparse_int* csc_col_ptr,
+                                   const rocsparse_int* csc_row_ind,
+                                   rocsparse_mat_info info,
+                                   rocsparse_int x_nnz,
+                                   const float* x_val,
+                                   const rocsparse_int* x_ind,
+                                   rocsparse_int* y_nnz,
+                                   float* y_val,
+                                   rocsparse_int* y_ind)
+{
+    return rocsparse_scscmspv(handle,
+                              semiring,
+                              m,
+                              n,
+                              nnz,
+                              alpha,
+                              descr,
+                              csc_val,
+                              csc_col_ptr,
+                              csc_row_ind,
+                              info,
+                              x_nnz,
+                              x_val,
+                              x_ind,
+                              y_nnz,
+                              y_val,
+                              y_ind);
+}
+
+template <>
+rocsparse_status rocsparse_cscmspv(rocsparse_handle handle,
+                                   rocsparse_semiring semiring,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const double* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const double* csc_val,
+                                   const rocsparse_int* csc_col_ptr,
+                                   const rocsparse_int* csc_row_ind,
+                                   rocsparse_mat_info info,
+                                   rocsparse_int x_nnz,
+                                   const double* x_val,
+                                   const rocsparse_int* x_ind,
+                                   rocsparse_int* y_nnz,
+                                   double* y_val,
+                                   rocsparse_int* y_ind)
+{
+    return rocsparse_dcscmspv(handle,
+                              semiring,
+                              m,
+                              n,
+                              nnz,
+                              alpha,
+                              descr,
+                              csc_val,
+                              csc_col_ptr,
+                              csc_row_ind,
+                              info,
+                              x_nnz,
+                              x_val,
+                              x_ind,
+                              y_nnz,
+                              y_val,
+                              y_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_mixed(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       rocsparse_int nnz,
+                                       const float* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_half* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const float* x,
+                                       const float* beta,
+                                       float* y)
+{
+    return rocsparse_hcsrmv(handle,
+                            trans,
+                            m,
+                            n,
+                            nnz,
+                            alpha,
+                            descr,
+                            csr_val,
+                            csr_row_ptr,
+                            csr_col_ind,
+                            info,
+                            x,
+                            beta,
+                            y);
+}
+
+template <>
+rocsparse_status rocsparse_ellmv_mixed(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       const float* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_half* ell_val,
+                                       const rocsparse_int* ell_col_ind,
+                                       rocsparse_int ell_width,
+                                       const float* x,
+                                       const float* beta,
+                                       float* y)
+{
+    return rocsparse_hellmv(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_hybmv_mixed<rocsparse_half>(rocsparse_handle handle,
+                                                       rocsparse_operation trans,
+                                                       const float* alpha,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_hyb_mat hyb,
+                                                       const float* x,
+                                                       const float* beta,
+                                                       float* y)
+{
+    return rocsparse_hhybmv(handle, trans, alpha, descr, hyb, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_csrmv_mixed(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       rocsparse_int nnz,
+                                       const float* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_bfloat16* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const float* x,
+                                       const float* beta,
+                                       float* y)
+{
+    return rocsparse_bfcsrmv( handle,
+                             trans,
+                             m,
+                             n,
+                             nnz,
+                             alpha,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             x,
+                             beta,
+                             y);
+}
+
+template <>
+rocsparse_status rocsparse_ellmv_mixed(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       const float* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_bfloat16* ell_val,
+                                       const rocsparse_int* ell_col_ind,
+                                       rocsparse_int ell_width,
+                                       const float* x,
+                                       const float* beta,
+                                       float* y)
+{
+    return rocsparse_bfellmv(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_hybmv_mixed<rocsparse_bfloat16>(rocsparse_handle handle,
+                                                           rocsparse_operation trans,
+                                                           const float* alpha,
+                                                           const rocsparse_mat_descr descr,
+                                                           const rocsparse_hyb_mat hyb,
+                                                           const float* x,
+                                                           const float* beta,
+                                                           float* y)
+{
+    return rocsparse_bfhybmv(handle, trans, alpha, descr, hyb, x, beta, y);
+}
+
 template <>
 rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle handle,
                                              rocsparse_operation trans,
@@ -333,6 +869,38 @@ rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle handle,
         handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
 }
 
+template <>
+rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle handle,
+                                             rocsparse_operation trans,
+                                             rocsparse_int m,
+                                             rocsparse_int nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_mat_info info,
+                                             size_t* buffer_size)
+{
+    return rocsparse_ccsrsv_buffer_size(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle handle,
+                                             rocsparse_operation trans,
+                                             rocsparse_int m,
+                                             rocsparse_int nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_mat_info info,
+                                             size_t* buffer_size)
+{
+    return rocsparse_zcsrsv_buffer_size(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
 template <>
 rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle handle,
                                           rocsparse_operation trans,
@@ -389,6 +957,62 @@ rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle handle,
                                      temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_int m,
+                                          rocsparse_int nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_float_complex* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          rocsparse_mat_info info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy solve,
+                                          void* temp_buffer)
+{
+    return rocsparse_ccsrsv_analysis(handle,
+                                     trans,
+                                     m,
+                                     nnz,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_analysis(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_int m,
+                                          rocsparse_int nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const rocsparse_double_complex* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          rocsparse_mat_info info,
+                                          rocsparse_analysis_policy analysis,
+                                          rocsparse_solve_policy solve,
+                                          void* temp_buffer)
+{
+    return rocsparse_zcsrsv_analysis(handle,
+                                     trans,
+                                     m,
+                                     nnz,
+                                     descr,
+                                     csr_val,
+                                     csr_row_ptr,
+                                     csr_col_ind,
+                                     info,
+                                     analysis,
+                                     solve,
+                                     temp_buffer);
+}
+
 template <>
 rocsparse_status rocsparse_csrsv_solve(rocsparse_handle handle,
                                        rocsparse_operation trans,
@@ -453,6 +1077,70 @@ rocsparse_status rocsparse_csrsv_solve(rocsparse_handle handle,
                                   temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csrsv_solve(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int nnz,
+                                       const rocsparse_float_complex* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_float_complex* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const rocsparse_float_complex* x,
+                                       rocsparse_float_complex* y,
+                                       rocsparse_solve_policy policy,
+                                       void* temp_buffer)
+{
+    return rocsparse_ccsrsv_solve(handle,
+                                  trans,
+                                  m,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  info,
+                                  x,
+                                  y,
+                                  policy,
+                                  temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsv_solve(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int nnz,
+                                       const rocsparse_double_complex* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_double_complex* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const rocsparse_double_complex* x,
+                                       rocsparse_double_complex* y,
+                                       rocsparse_solve_policy policy,
+                                       void* temp_buffer)
+{
+    return rocsparse_zcsrsv_solve(handle,
+                                  trans,
+                                  m,
+                                  nnz,
+                                  alpha,
+                                  descr,
+                                  csr_val,
+                                  csr_row_ptr,
+                                  csr_col_ind,
+                                  info,
+                                  x,
+                                  y,
+                                  policy,
+                                  temp_buffer);
+}
+
 template <>
 rocsparse_status rocsparse_ellmv(rocsparse_handle handle,
                                  rocsparse_operation trans,
@@ -489,6 +1177,42 @@ rocsparse_status rocsparse_ellmv(rocsparse_handle handle,
         handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
 }
 
+template <>
+rocsparse_status rocsparse_ellmv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 const rocsparse_float_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_float_complex* ell_val,
+                                 const rocsparse_int* ell_col_ind,
+                                 rocsparse_int ell_width,
+                                 const rocsparse_float_complex* x,
+                                 const rocsparse_float_complex* beta,
+                                 rocsparse_float_complex* y)
+{
+    return rocsparse_cellmv(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_ellmv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 rocsparse_int m,
+                                 rocsparse_int n,
+                                 const rocsparse_double_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_double_complex* ell_val,
+                                 const rocsparse_int* ell_col_ind,
+                                 rocsparse_int ell_width,
+                                 const rocsparse_double_complex* x,
+                                 const rocsparse_double_complex* beta,
+                                 rocsparse_double_complex* y)
+{
+    return rocsparse_zellmv(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
 template <>
 rocsparse_status rocsparse_hybmv(rocsparse_handle handle,
                                  rocsparse_operation trans,
@@ -515,6 +1239,58 @@ rocsparse_status rocsparse_hybmv(rocsparse_handle handle,
     return rocsparse_dhybmv(handle, trans, alpha, descr, hyb, x, beta, y);
 }
 
+template <>
+rocsparse_status rocsparse_hybmv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 const rocsparse_float_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_hyb_mat hyb,
+                                 const rocsparse_float_complex* x,
+                                 const rocsparse_float_complex* beta,
+                                 rocsparse_float_complex* y)
+{
+    return rocsparse_chybmv(handle, trans, alpha, descr, hyb, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_hybmv(rocsparse_handle handle,
+                                 rocsparse_operation trans,
+                                 const rocsparse_double_complex* alpha,
+                                 const rocsparse_mat_descr descr,
+                                 const rocsparse_hyb_mat hyb,
+                                 const rocsparse_double_complex* x,
+                                 const rocsparse_double_complex* beta,
+                                 rocsparse_double_complex* y)
+{
+    return rocsparse_zhybmv(handle, trans, alpha, descr, hyb, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_pcsrmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const float* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_pcsr_mat pcsr,
+                                  const float* x,
+                                  const float* beta,
+                                  float* y)
+{
+    return rocsparse_spcsrmv(handle, trans, alpha, descr, pcsr, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_pcsrmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const double* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_pcsr_mat pcsr,
+                                  const double* x,
+                                  const double* beta,
+                                  double* y)
+{
+    return rocsparse_dpcsrmv(handle, trans, alpha, descr, pcsr, x, beta, y);
+}
+
 template <>
 rocsparse_status rocsparse_csrmm(rocsparse_handle handle,
                                  rocsparse_operation trans_A,
@@ -617,8 +1393,90 @@ rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle handle,
                                                rocsparse_mat_info info,
                                                size_t* buffer_size)
 {
-    return rocsparse_dcsrilu0_buffer_size(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    return rocsparse_dcsrilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               size_t* buffer_size)
+{
+    return rocsparse_ccsrilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               size_t* buffer_size)
+{
+    return rocsparse_zcsrilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy solve,
+                                            void* temp_buffer)
+{
+    return rocsparse_scsrilu0_analysis(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy solve,
+                                            void* temp_buffer)
+{
+    return rocsparse_dcsrilu0_analysis(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
 }
 
 template <>
@@ -626,7 +1484,7 @@ rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
                                             rocsparse_int m,
                                             rocsparse_int nnz,
                                             const rocsparse_mat_descr descr,
-                                            const float* csr_val,
+                                            const rocsparse_float_complex* csr_val,
                                             const rocsparse_int* csr_row_ptr,
                                             const rocsparse_int* csr_col_ind,
                                             rocsparse_mat_info info,
@@ -634,7 +1492,7 @@ rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
                                             rocsparse_solve_policy solve,
                                             void* temp_buffer)
 {
-    return rocsparse_scsrilu0_analysis(handle,
+    return rocsparse_ccsrilu0_analysis(handle,
                                        m,
                                        nnz,
                                        descr,
@@ -652,7 +1510,7 @@ rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
                                             rocsparse_int m,
                                             rocsparse_int nnz,
                                             const rocsparse_mat_descr descr,
-                                            const double* csr_val,
+                                            const rocsparse_double_complex* csr_val,
                                             const rocsparse_int* csr_row_ptr,
                                             const rocsparse_int* csr_col_ind,
                                             rocsparse_mat_info info,
@@ -660,7 +1518,7 @@ rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle handle,
                                             rocsparse_solve_policy solve,
                                             void* temp_buffer)
 {
-    return rocsparse_dcsrilu0_analysis(handle,
+    return rocsparse_zcsrilu0_analysis(handle,
                                        m,
                                        nnz,
                                        descr,
@@ -705,6 +1563,38 @@ rocsparse_status rocsparse_csrilu0(rocsparse_handle handle,
         handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csrilu0(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_mat_info info,
+                                   rocsparse_solve_policy policy,
+                                   void* temp_buffer)
+{
+    return rocsparse_ccsrilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_mat_info info,
+                                   rocsparse_solve_policy policy,
+                                   void* temp_buffer)
+{
+    return rocsparse_zcsrilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
 template <>
 rocsparse_status rocsparse_csr2csc(rocsparse_handle handle,
                                    rocsparse_int m,
@@ -765,6 +1655,66 @@ rocsparse_status rocsparse_csr2csc(rocsparse_handle handle,
                               temp_buffer);
 }
 
+template <>
+rocsparse_status rocsparse_csr2csc(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_float_complex* csc_val,
+                                   rocsparse_int* csc_row_ind,
+                                   rocsparse_int* csc_col_ptr,
+                                   rocsparse_action copy_values,
+                                   rocsparse_index_base idx_base,
+                                   void* temp_buffer)
+{
+    return rocsparse_ccsr2csc(handle,
+                              m,
+                              n,
+                              nnz,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              csc_val,
+                              csc_row_ind,
+                              csc_col_ptr,
+                              copy_values,
+                              idx_base,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csr2csc(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_double_complex* csc_val,
+                                   rocsparse_int* csc_row_ind,
+                                   rocsparse_int* csc_col_ptr,
+                                   rocsparse_action copy_values,
+                                   rocsparse_index_base idx_base,
+                                   void* temp_buffer)
+{
+    return rocsparse_zcsr2csc(handle,
+                              m,
+                              n,
+                              nnz,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              csc_val,
+                              csc_row_ind,
+                              csc_col_ptr,
+                              copy_values,
+                              idx_base,
+                              temp_buffer);
+}
+
 template <>
 rocsparse_status rocsparse_csr2ell(rocsparse_handle handle,
                                    rocsparse_int m,
@@ -813,6 +1763,54 @@ rocsparse_status rocsparse_csr2ell(rocsparse_handle handle,
                               ell_col_ind);
 }
 
+template <>
+rocsparse_status rocsparse_csr2ell(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const rocsparse_mat_descr ell_descr,
+                                   rocsparse_int ell_width,
+                                   rocsparse_float_complex* ell_val,
+                                   rocsparse_int* ell_col_ind)
+{
+    return rocsparse_ccsr2ell(handle,
+                              m,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              ell_descr,
+                              ell_width,
+                              ell_val,
+                              ell_col_ind);
+}
+
+template <>
+rocsparse_status rocsparse_csr2ell(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   const rocsparse_mat_descr csr_descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   const rocsparse_mat_descr ell_descr,
+                                   rocsparse_int ell_width,
+                                   rocsparse_double_complex* ell_val,
+                                   rocsparse_int* ell_col_ind)
+{
+    return rocsparse_zcsr2ell(handle,
+                              m,
+                              csr_descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              ell_descr,
+                              ell_width,
+                              ell_val,
+                              ell_col_ind);
+}
+
 template <>
 rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
                                    rocsparse_int m,
@@ -861,6 +1859,158 @@ rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
                               partition_type);
 }
 
+template <>
+rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_hyb_mat hyb,
+                                   rocsparse_int user_ell_width,
+                                   rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_ccsr2hyb(handle,
+                              m,
+                              n,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              hyb,
+                              user_ell_width,
+                              partition_type);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_hyb_mat hyb,
+                                   rocsparse_int user_ell_width,
+                                   rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_zcsr2hyb(handle,
+                              m,
+                              n,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              hyb,
+                              user_ell_width,
+                              partition_type);
+}
+
+template <>
+rocsparse_status
+    rocsparse_csr2hyb_update(rocsparse_handle handle, const float* csr_val, rocsparse_hyb_mat hyb)
+{
+    return rocsparse_scsr2hyb_update(handle, csr_val, hyb);
+}
+
+template <>
+rocsparse_status
+    rocsparse_csr2hyb_update(rocsparse_handle handle, const double* csr_val, rocsparse_hyb_mat hyb)
+{
+    return rocsparse_dcsr2hyb_update(handle, csr_val, hyb);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb_update(rocsparse_handle handle,
+                                          const rocsparse_float_complex* csr_val,
+                                          rocsparse_hyb_mat hyb)
+{
+    return rocsparse_ccsr2hyb_update(handle, csr_val, hyb);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb_update(rocsparse_handle handle,
+                                          const rocsparse_double_complex* csr_val,
+                                          rocsparse_hyb_mat hyb)
+{
+    return rocsparse_zcsr2hyb_update(handle, csr_val, hyb);
+}
+
+template <>
+rocsparse_status rocsparse_csr2pcsr(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const float* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_pcsr_mat pcsr)
+{
+    return rocsparse_scsr2pcsr(handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, pcsr);
+}
+
+template <>
+rocsparse_status rocsparse_csr2pcsr(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const double* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_pcsr_mat pcsr)
+{
+    return rocsparse_dcsr2pcsr(handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, pcsr);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_half* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_hyb_mat hyb,
+                                   rocsparse_int user_ell_width,
+                                   rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_hcsr2hyb(handle,
+                              m,
+                              n,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              hyb,
+                              user_ell_width,
+                              partition_type);
+}
+
+template <>
+rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_bfloat16* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_hyb_mat hyb,
+                                   rocsparse_int user_ell_width,
+                                   rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_bfcsr2hyb( handle,
+                               m,
+                               n,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               hyb,
+                               user_ell_width,
+                               partition_type);
+}
+
 template <>
 rocsparse_status rocsparse_ell2csr(rocsparse_handle handle,
                                    rocsparse_int m,
@@ -0,0 +1,317 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "roofline.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdio.h>
+#include <hip/hip_runtime_api.h>
+
+/* ============================================================================================ */
+/*  LRU cache model */
+roofline_cache::roofline_cache(size_t capacity, size_t line_size)
+    : line_size(line_size)
+    , num_lines(std::max(capacity / line_size, static_cast<size_t>(1)))
+{
+}
+
+size_t roofline_cache::access(size_t address)
+{
+    size_t line = address / line_size;
+
+    auto it = lines.find(line);
+
+    // Hit, move line to the front
+    if(it != lines.end())
+    {
+        lru.splice(lru.begin(), lru, it->second);
+        return 0;
+    }
+
+    // Miss, evict least recently used line if the cache is full
+    if(lines.size() == num_lines)
+    {
+        lines.erase(lru.back());
+        lru.pop_back();
+    }
+
+    lru.push_front(line);
+    lines[line] = lru.begin();
+
+    return line_size;
+}
+
+/* ============================================================================================ */
+/*  device parameters */
+const roofline_device& roofline_get_device()
+{
+    static roofline_device dev = [] {
+        roofline_device d;
+
+        int device;
+        hipDeviceProp_t prop;
+
+        d.cache_size     = 4 << 20;
+        d.cache_line     = 64;
+        d.wavefront_size = 64;
+        d.max_threads    = 1024;
+        d.num_procs      = 64;
+
+        if(hipGetDevice(&device) == hipSuccess &&
+           hipGetDeviceProperties(&prop, device) == hipSuccess)
+        {
+            d.cache_size     = (prop.l2CacheSize > 0) ? prop.l2CacheSize : d.cache_size;
+            d.wavefront_size = prop.warpSize;
+            d.max_threads    = prop.maxThreadsPerBlock;
+            d.num_procs      = prop.multiProcessorCount;
+        }
+
+        return d;
+    }();
+
+    return dev;
+}
+
+/* ============================================================================================ */
+/*  peak bandwidth of a device to device copy */
+static double roofline_measure_bandwidth()
+{
+    size_t size = 256 << 20;
+    int iters   = 10;
+
+    void* src = nullptr;
+    void* dst = nullptr;
+
+    if(hipMalloc(&src, size) != hipSuccess || hipMalloc(&dst, size) != hipSuccess)
+    {
+        hipFree(src);
+        return 0.0;
+    }
+
+    // Warm up
+    hipMemcpy(dst, src, size, hipMemcpyDeviceToDevice);
+
+    double time = get_time_us();
+
+    for(int i = 0; i < iters; ++i)
+    {
+        hipMemcpy(dst, src, size, hipMemcpyDeviceToDevice);
+    }
+
+    time = get_time_us() - time;
+
+    hipFree(src);
+    hipFree(dst);
+
+    // Each copy reads and writes size bytes
+    return 2.0 * size * iters / time / 1e3;
+}
+
+double roofline_peak_bandwidth(double user_bandwidth)
+{
+    if(user_bandwidth > 0.0)
+    {
+        return user_bandwidth;
+    }
+
+    static double measured = roofline_measure_bandwidth();
+
+    return measured;
+}
+
+/* ============================================================================================ */
+/*  CSR-Adaptive row blocks */
+size_t roofline_csrmv_row_blocks(rocsparse_int m, const rocsparse_int* ptr)
+{
+    // Constants of the CSR-Adaptive partitioning
+    const size_t blocksize        = 1024;
+    const size_t block_multiplier = 3;
+    const size_t max_wgs          = 1 << 24;
+
+    size_t total                  = 1;
+    size_t sum                    = 0;
+    size_t last_i                 = 0;
+    rocsparse_int consecutive_long = 0;
+
+    for(size_t i = 1; i <= static_cast<size_t>(m); ++i)
+    {
+        size_t row_length = ptr[i] - ptr[i - 1];
+        sum += row_length;
+
+        // Track transitions between short and long rows
+        if(row_length > 128)
+        {
+            ++consecutive_long;
+        }
+        else if(consecutive_long > 0)
+        {
+            consecutive_long = (row_length < 32) ? -1 : consecutive_long + 1;
+        }
+
+        if(consecutive_long == 1)
+        {
+            if(i - last_i > 1)
+            {
+                ++total;
+                last_i = i - 1;
+                sum    = row_length;
+            }
+        }
+        else if(consecutive_long == -1)
+        {
+            ++total;
+            last_i           = i - 1;
+            sum              = row_length;
+            consecutive_long = 0;
+        }
+
+        // CSR-Vector for a single long row, CSR-Stream for several short rows
+        if(i - last_i == 1 && sum > blocksize)
+        {
+            size_t wgs = static_cast<size_t>(
+                std::ceil(static_cast<double>(row_length) / (block_multiplier * blocksize)));
+
+            total += std::min(wgs, max_wgs);
+            last_i           = i;
+            sum              = 0;
+            consecutive_long = 0;
+        }
+        else if(i - last_i > 1 && sum > blocksize)
+        {
+            --i;
+
+            ++total;
+            last_i           = i;
+            sum              = 0;
+            consecutive_long = 0;
+        }
+        else if(sum == blocksize)
+        {
+            ++total;
+            last_i           = i;
+            sum              = 0;
+            consecutive_long = 0;
+        }
+    }
+
+    return total + 1;
+}
+
+/* ============================================================================================ */
+/*  report */
+static std::vector<roofline_result>* roofline_sink = nullptr;
+
+void roofline_set_sink(std::vector<roofline_result>* sink)
+{
+    roofline_sink = sink;
+}
+
+void roofline_report(const Arguments& argus, const roofline_result& result)
+{
+    if(roofline_sink != nullptr)
+    {
+        roofline_sink->push_back(result);
+    }
+
+    double peak      = roofline_peak_bandwidth(argus.peak_bandwidth);
+    double gflops    = result.flops / result.msec / 1e6;
+    double gbs       = result.bytes / result.msec / 1e6;
+    double intensity = result.flops / result.bytes;
+    double peak_pct  = (peak > 0.0) ? gbs / peak * 100.0 : 0.0;
+
+    printf("Model: bytes\t\tGB/s\tFlop/B\tPeak GB/s\t%% of peak\n");
+    printf("%12.0lf\t%0.2lf\t%0.3lf\t%0.2lf\t\t%0.1lf\n",
+           result.bytes,
+           gbs,
+           intensity,
+           peak,
+           peak_pct);
+
+    if(argus.report.empty())
+    {
+        return;
+    }
+
+    FILE* f = argus.report_file.empty() ? stdout : fopen(argus.report_file.c_str(), "a");
+
+    if(f == NULL)
+    {
+        fprintf(stderr, "Cannot open report file %s\n", argus.report_file.c_str());
+        return;
+    }
+
+    if(argus.report == "csv")
+    {
+        // Header is written once per file
+        if(ftell(f) <= 0)
+        {
+            fprintf(f,
+                    "function,precision,format,m,n,nnz,msec,gflops,bytes,gbs,intensity,"
+                    "peak_gbs,peak_pct\n");
+        }
+
+        fprintf(f,
+                "%s,%s,%s,%d,%d,%d,%.6lf,%.4lf,%.0lf,%.4lf,%.6lf,%.4lf,%.2lf\n",
+                result.function.c_str(),
+                result.precision.c_str(),
+                result.format.c_str(),
+                result.m,
+                result.n,
+                result.nnz,
+                result.msec,
+                gflops,
+                result.bytes,
+                gbs,
+                intensity,
+                peak,
+                peak_pct);
+    }
+    else
+    {
+        // One JSON object per line
+        fprintf(f,
+                "{\"function\": \"%s\", \"precision\": \"%s\", \"format\": \"%s\", \"m\": %d, "
+                "\"n\": %d, \"nnz\": %d, \"msec\": %.6lf, \"gflops\": %.4lf, \"bytes\": %.0lf, "
+                "\"gbs\": %.4lf, \"intensity\": %.6lf, \"peak_gbs\": %.4lf, \"peak_pct\": %.2lf}\n",
+                result.function.c_str(),
+                result.precision.c_str(),
+                result.format.c_str(),
+                result.m,
+                result.n,
+                result.nnz,
+                result.msec,
+                gflops,
+                result.bytes,
+                gbs,
+                intensity,
+                peak,
+                peak_pct);
+    }
+
+    if(f != stdout)
+    {
+        fclose(f);
+    }
+}
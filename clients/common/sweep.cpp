@@ -0,0 +1,287 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "sweep.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <dirent.h>
+#include <fstream>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <hip/hip_runtime_api.h>
+
+/* ============================================================================================ */
+/*  statistics */
+static double sweep_median(std::vector<double> values)
+{
+    size_t n = values.size();
+
+    std::sort(values.begin(), values.end());
+
+    return (n % 2 == 1) ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+}
+
+sweep_stats sweep_compute_stats(std::vector<double> samples)
+{
+    sweep_stats stats = {samples.size(), 0.0, 0.0, 0.0, 0.0};
+
+    if(samples.empty())
+    {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    stats.median = sweep_median(samples);
+
+    std::vector<double> dev(samples.size());
+    for(size_t i = 0; i < samples.size(); ++i)
+    {
+        dev[i] = std::abs(samples[i] - stats.median);
+    }
+
+    stats.mad = sweep_median(dev);
+
+    // Ranks of the 95% confidence interval of the median, normal approximation of the
+    // binomial distribution of the number of samples below the median
+    double n     = static_cast<double>(samples.size());
+    double delta = 1.96 * std::sqrt(n) / 2.0;
+
+    // Zero based ranks
+    long lo = static_cast<long>(std::floor(n / 2.0 - delta)) - 1;
+    long hi = static_cast<long>(std::ceil(n / 2.0 + delta));
+
+    lo = std::max(lo, 0L);
+    hi = std::min(hi, static_cast<long>(samples.size()) - 1);
+
+    stats.ci_low  = samples[lo];
+    stats.ci_high = samples[hi];
+
+    return stats;
+}
+
+/* ============================================================================================ */
+/*  matrix collection */
+std::vector<std::string> sweep_split(const std::string& list)
+{
+    std::vector<std::string> items;
+
+    size_t begin = 0;
+
+    while(begin < list.size())
+    {
+        size_t end = list.find(',', begin);
+
+        if(end == std::string::npos)
+        {
+            end = list.size();
+        }
+
+        if(end > begin)
+        {
+            items.push_back(list.substr(begin, end - begin));
+        }
+
+        begin = end + 1;
+    }
+
+    return items;
+}
+
+static bool sweep_has_suffix(const std::string& str, const std::string& suffix)
+{
+    return str.size() >= suffix.size() &&
+           str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+std::vector<std::string> sweep_matrices(const std::string& path)
+{
+    std::vector<std::string> matrices;
+
+    struct stat st;
+
+    if(stat(path.c_str(), &st) != 0)
+    {
+        return matrices;
+    }
+
+    // Directory, use all matrix files
+    if(S_ISDIR(st.st_mode))
+    {
+        DIR* dir = opendir(path.c_str());
+
+        if(dir == NULL)
+        {
+            return matrices;
+        }
+
+        struct dirent* entry;
+
+        while((entry = readdir(dir)) != NULL)
+        {
+            std::string name(entry->d_name);
+
+            if(sweep_has_suffix(name, ".mtx") || sweep_has_suffix(name, ".rsc"))
+            {
+                matrices.push_back(path + "/" + name);
+            }
+        }
+
+        closedir(dir);
+
+        std::sort(matrices.begin(), matrices.end());
+
+        return matrices;
+    }
+
+    // Manifest
+    std::ifstream manifest(path.c_str());
+    std::string base;
+
+    size_t slash = path.rfind('/');
+    if(slash != std::string::npos)
+    {
+        base = path.substr(0, slash + 1);
+    }
+
+    std::string line;
+
+    while(std::getline(manifest, line))
+    {
+        // Trim white space
+        size_t begin = line.find_first_not_of(" \t\r");
+        size_t end   = line.find_last_not_of(" \t\r");
+
+        if(begin == std::string::npos || line[begin] == '#')
+        {
+            continue;
+        }
+
+        line = line.substr(begin, end - begin + 1);
+
+        matrices.push_back(line[0] == '/' ? line : base + line);
+    }
+
+    return matrices;
+}
+
+/* ============================================================================================ */
+/*  JSON output */
+static std::string sweep_json_string(const std::string& str)
+{
+    std::string out = "\"";
+
+    for(size_t i = 0; i < str.size(); ++i)
+    {
+        char c = str[i];
+
+        if(c == '"' || c == '\\')
+        {
+            out += '\\';
+            out += c;
+        }
+        else if(static_cast<unsigned char>(c) < 0x20)
+        {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+        }
+        else
+        {
+            out += c;
+        }
+    }
+
+    return out + "\"";
+}
+
+bool sweep_write_json(const std::string& path,
+                      const Arguments& argus,
+                      rocsparse_int warmup,
+                      rocsparse_int repeats,
+                      const std::vector<sweep_case>& cases)
+{
+    FILE* f = fopen(path.c_str(), "w");
+
+    if(f == NULL)
+    {
+        return false;
+    }
+
+    char version[256];
+    query_version(version);
+
+    int device;
+    hipDeviceProp_t prop;
+
+    std::string device_name;
+    if(hipGetDevice(&device) == hipSuccess && hipGetDeviceProperties(&prop, device) == hipSuccess)
+    {
+        device_name = prop.name;
+    }
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"rocsparse_version\": %s,\n", sweep_json_string(version).c_str());
+    fprintf(f, "  \"device\": %s,\n", sweep_json_string(device_name).c_str());
+    fprintf(f, "  \"warmup\": %d,\n", warmup);
+    fprintf(f, "  \"repeats\": %d,\n", repeats);
+    fprintf(f, "  \"iters\": %d,\n", argus.iters);
+    fprintf(f, "  \"alpha\": %.17g,\n", argus.alpha);
+    fprintf(f, "  \"beta\": %.17g,\n", argus.beta);
+    fprintf(f, "  \"cases\": [");
+
+    for(size_t i = 0; i < cases.size(); ++i)
+    {
+        const sweep_case& c     = cases[i];
+        const roofline_result& r = c.result;
+        sweep_stats stats       = sweep_compute_stats(c.msec);
+
+        fprintf(f, "%s\n    {", (i == 0) ? "" : ",");
+        fprintf(f, "\"matrix\": %s, ", sweep_json_string(c.matrix).c_str());
+        fprintf(f, "\"function\": %s, ", sweep_json_string(r.function).c_str());
+        fprintf(f, "\"precision\": %s, ", sweep_json_string(r.precision).c_str());
+        fprintf(f, "\"format\": %s, ", sweep_json_string(r.format).c_str());
+        fprintf(f, "\"m\": %d, \"n\": %d, \"nnz\": %d, ", r.m, r.n, r.nnz);
+        fprintf(f, "\"flops\": %.0lf, \"bytes\": %.0lf, ", r.flops, r.bytes);
+        fprintf(f, "\"samples_msec\": [");
+
+        for(size_t j = 0; j < c.msec.size(); ++j)
+        {
+            fprintf(f, "%s%.6lf", (j == 0) ? "" : ", ", c.msec[j]);
+        }
+
+        fprintf(f, "], ");
+        fprintf(f, "\"median_msec\": %.6lf, \"mad_msec\": %.6lf, ", stats.median, stats.mad);
+        fprintf(f, "\"ci95_msec\": [%.6lf, %.6lf], ", stats.ci_low, stats.ci_high);
+        fprintf(f,
+                "\"median_gflops\": %.4lf, \"median_gbs\": %.4lf}",
+                r.flops / stats.median / 1e6,
+                r.bytes / stats.median / 1e6);
+    }
+
+    fprintf(f, "\n  ]\n}\n");
+
+    return fclose(f) == 0;
+}
@@ -26,6 +26,7 @@
 #include <rocsparse.h>
 #include <hip/hip_runtime_api.h>
 #include <algorithm>
+#include <cmath>
 #include <limits>
 
 #ifdef GOOGLE_TEST
@@ -82,6 +83,48 @@ void unit_check_general(
     }
 }
 
+template <>
+void unit_check_general(rocsparse_int M,
+                        rocsparse_int N,
+                        rocsparse_int lda,
+                        rocsparse_float_complex* hCPU,
+                        rocsparse_float_complex* hGPU)
+{
+    for(rocsparse_int j = 0; j < N; j++)
+    {
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+#ifdef GOOGLE_TEST
+            ASSERT_FLOAT_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
+            ASSERT_FLOAT_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
+#else
+            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+#endif
+        }
+    }
+}
+
+template <>
+void unit_check_general(rocsparse_int M,
+                        rocsparse_int N,
+                        rocsparse_int lda,
+                        rocsparse_double_complex* hCPU,
+                        rocsparse_double_complex* hGPU)
+{
+    for(rocsparse_int j = 0; j < N; j++)
+    {
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+#ifdef GOOGLE_TEST
+            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
+            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
+#else
+            assert(hCPU[i + j * lda] == hGPU[i + j * lda]);
+#endif
+        }
+    }
+}
+
 template <>
 void unit_check_general(
     rocsparse_int M, rocsparse_int N, rocsparse_int lda, rocsparse_int* hCPU, rocsparse_int* hGPU)
@@ -157,3 +200,85 @@ void unit_check_near(
         }
     }
 }
+
+template <>
+void unit_check_near(rocsparse_int M,
+                     rocsparse_int N,
+                     rocsparse_int lda,
+                     rocsparse_float_complex* hCPU,
+                     rocsparse_float_complex* hGPU)
+{
+    for(rocsparse_int j = 0; j < N; j++)
+    {
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+            // Real and imaginary part are compared relative to the magnitude of the
+            // complex number
+            rocsparse_float_complex ref = hCPU[i + j * lda];
+            rocsparse_float_complex val = hGPU[i + j * lda];
+
+            float compare_val = std::max(std::hypot(ref.x, ref.y) * 1e-3f,
+                                         10 * std::numeric_limits<float>::epsilon());
+#ifdef GOOGLE_TEST
+            ASSERT_NEAR(ref.x, val.x, compare_val);
+            ASSERT_NEAR(ref.y, val.y, compare_val);
+#else
+            assert(std::abs(ref.x - val.x) < compare_val);
+            assert(std::abs(ref.y - val.y) < compare_val);
+#endif
+        }
+    }
+}
+
+template <>
+void unit_check_near(rocsparse_int M,
+                     rocsparse_int N,
+                     rocsparse_int lda,
+                     rocsparse_double_complex* hCPU,
+                     rocsparse_double_complex* hGPU)
+{
+    for(rocsparse_int j = 0; j < N; j++)
+    {
+        for(rocsparse_int i = 0; i < M; i++)
+        {
+            // Real and imaginary part are compared relative to the magnitude of the
+            // complex number
+            rocsparse_double_complex ref = hCPU[i + j * lda];
+            rocsparse_double_complex val = hGPU[i + j * lda];
+
+            double compare_val = std::max(std::hypot(ref.x, ref.y) * 1e-10,
+                                          10 * std::numeric_limits<double>::epsilon());
+#ifdef GOOGLE_TEST
+            ASSERT_NEAR(ref.x, val.x, compare_val);
+            ASSERT_NEAR(ref.y, val.y, compare_val);
+#else
+            assert(std::abs(ref.x - val.x) < compare_val);
+            assert(std::abs(ref.y - val.y) < compare_val);
+#endif
+        }
+    }
+}
+
+void unit_check_bound(rocsparse_int M, const double* hCPU, const float* hGPU, const double* bound)
+{
+    for(rocsparse_int i = 0; i < M; i++)
+    {
+#ifdef GOOGLE_TEST
+        ASSERT_NEAR(hCPU[i], static_cast<double>(hGPU[i]), bound[i]);
+#else
+        assert(std::abs(hCPU[i] - static_cast<double>(hGPU[i])) <= bound[i]);
+#endif
+    }
+}
+
+void unit_check_bound(rocsparse_int M, const double* hCPU, const double* hGPU, const double* bound)
+{
+    for(rocsparse_int i = 0; i < M; i++)
+    {
+#ifdef GOOGLE_TEST
+        ASSERT_NEAR(hCPU[i], hGPU[i], bound[i]);
+#else
+        assert(std::abs(hCPU[i] - hGPU[i]) <= bound[i]);
+#endif
+    }
+}
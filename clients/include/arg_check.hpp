@@ -35,6 +35,8 @@ void verify_rocsparse_status_invalid_value(rocsparse_status status, const char*
 
 void verify_rocsparse_status_zero_pivot(rocsparse_status status, const char* message);
 
+void verify_rocsparse_status_not_implemented(rocsparse_status status, const char* message);
+
 void verify_rocsparse_status_invalid_handle(rocsparse_status status);
 
 void verify_rocsparse_status_success(rocsparse_status status, const char* message);
@@ -0,0 +1,587 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef PERF_GATE_HPP
+#define PERF_GATE_HPP
+
+// Comparison of rocsparse-bench sweep results against a baseline. Only reads JSON, such
+// that it runs on build hosts without GPU.
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+/* ============================================================================================ */
+/*  Minimal JSON reader for the sweep results */
+struct json_value
+{
+    enum kind_t
+    {
+        null_value,
+        bool_value,
+        number_value,
+        string_value,
+        array_value,
+        object_value
+    } kind = null_value;
+
+    double number = 0.0;
+    std::string str;
+    std::vector<json_value> array;
+    std::vector<std::pair<std::string, json_value>> object;
+
+    const json_value* find(const std::string& key) const
+    {
+        for(size_t i = 0; i < object.size(); ++i)
+        {
+            if(object[i].first == key)
+            {
+                return &object[i].second;
+            }
+        }
+
+        return nullptr;
+    }
+};
+
+class json_parser
+{
+public:
+    explicit json_parser(const std::string& text)
+        : text(text)
+        , pos(0)
+    {
+    }
+
+    bool parse(json_value& val)
+    {
+        return parse_value(val) && (skip_space(), pos == text.size());
+    }
+
+private:
+    const std::string& text;
+    size_t pos;
+
+    void skip_space()
+    {
+        while(pos < text.size() && isspace(static_cast<unsigned char>(text[pos])))
+        {
+            ++pos;
+        }
+    }
+
+    bool expect(char c)
+    {
+        skip_space();
+
+        if(pos < text.size() && text[pos] == c)
+        {
+            ++pos;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool parse_literal(const char* literal)
+    {
+        size_t len = strlen(literal);
+
+        if(text.compare(pos, len, literal) != 0)
+        {
+            return false;
+        }
+
+        pos += len;
+        return true;
+    }
+
+    bool parse_string(std::string& str)
+    {
+        if(!expect('"'))
+        {
+            return false;
+        }
+
+        while(pos < text.size() && text[pos] != '"')
+        {
+            char c = text[pos++];
+
+            if(c == '\\' && pos < text.size())
+            {
+                c = text[pos++];
+
+                // Control characters are the only escaped code points in the results
+                if(c == 'u' && pos + 4 <= text.size())
+                {
+                    c = static_cast<char>(strtol(text.substr(pos, 4).c_str(), nullptr, 16));
+                    pos += 4;
+                }
+                else if(c == 'n')
+                {
+                    c = '\n';
+                }
+                else if(c == 't')
+                {
+                    c = '\t';
+                }
+            }
+
+            str += c;
+        }
+
+        return expect('"');
+    }
+
+    bool parse_value(json_value& val)
+    {
+        skip_space();
+
+        if(pos >= text.size())
+        {
+            return false;
+        }
+
+        char c = text[pos];
+
+        if(c == '{')
+        {
+            val.kind = json_value::object_value;
+            ++pos;
+
+            if(expect('}'))
+            {
+                return true;
+            }
+
+            do
+            {
+                std::pair<std::string, json_value> member;
+
+                if(!parse_string(member.first) || !expect(':') || !parse_value(member.second))
+                {
+                    return false;
+                }
+
+                val.object.push_back(member);
+            } while(expect(','));
+
+            return expect('}');
+        }
+        else if(c == '[')
+        {
+            val.kind = json_value::array_value;
+            ++pos;
+
+            if(expect(']'))
+            {
+                return true;
+            }
+
+            do
+            {
+                val.array.push_back(json_value());
+
+                if(!parse_value(val.array.back()))
+                {
+                    return false;
+                }
+            } while(expect(','));
+
+            return expect(']');
+        }
+        else if(c == '"')
+        {
+            val.kind = json_value::string_value;
+            return parse_string(val.str);
+        }
+        else if(c == 't' || c == 'f')
+        {
+            val.kind   = json_value::bool_value;
+            val.number = (c == 't');
+            return parse_literal(c == 't' ? "true" : "false");
+        }
+        else if(c == 'n')
+        {
+            val.kind = json_value::null_value;
+            return parse_literal("null");
+        }
+
+        const char* begin = text.c_str() + pos;
+        char* end;
+
+        val.kind   = json_value::number_value;
+        val.number = strtod(begin, &end);
+
+        if(end == begin)
+        {
+            return false;
+        }
+
+        pos += end - begin;
+        return true;
+    }
+};
+
+/* ============================================================================================ */
+/*  Benchmark cases */
+struct gate_case
+{
+    std::string key;
+    std::string matrix;
+    std::string function;
+    std::string precision;
+    std::vector<double> msec;
+};
+
+inline std::string gate_member_string(const json_value& obj, const char* key)
+{
+    const json_value* val = obj.find(key);
+    return (val != nullptr && val->kind == json_value::string_value) ? val->str : "";
+}
+
+inline bool parse_cases(const std::string& text, std::map<std::string, gate_case>& cases)
+{
+    json_value root;
+
+    if(!json_parser(text).parse(root) || root.find("cases") == nullptr)
+    {
+        return false;
+    }
+
+    const json_value& list = *root.find("cases");
+
+    for(size_t i = 0; i < list.array.size(); ++i)
+    {
+        const json_value& obj  = list.array[i];
+        const json_value* msec = obj.find("samples_msec");
+
+        gate_case c;
+
+        c.matrix    = gate_member_string(obj, "matrix");
+        c.function  = gate_member_string(obj, "function");
+        c.precision = gate_member_string(obj, "precision");
+        c.key       = c.function + " " + c.precision + " " + gate_member_string(obj, "format") +
+                " " + c.matrix;
+
+        for(size_t j = 0; msec != nullptr && j < msec->array.size(); ++j)
+        {
+            c.msec.push_back(msec->array[j].number);
+        }
+
+        if(!c.msec.empty())
+        {
+            cases[c.key] = c;
+        }
+    }
+
+    return true;
+}
+
+inline bool read_cases(const char* path, std::map<std::string, gate_case>& cases)
+{
+    std::ifstream file(path);
+
+    if(!file)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+
+    if(!parse_cases(buffer.str(), cases))
+    {
+        fprintf(stderr, "%s is not a rocsparse-bench sweep result\n", path);
+        return false;
+    }
+
+    return true;
+}
+
+/* ============================================================================================ */
+/*  Tolerances, one rule per line: <function> <precision> <matrix> <tolerance>. Fields may be
+ *  *, the last matching rule applies. */
+struct gate_rule
+{
+    std::string function;
+    std::string precision;
+    std::string matrix;
+    double tolerance;
+};
+
+inline bool read_rules(const char* path, std::vector<gate_rule>& rules)
+{
+    std::ifstream file(path);
+
+    if(!file)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+
+    std::string line;
+
+    while(std::getline(file, line))
+    {
+        std::istringstream is(line);
+        gate_rule rule;
+
+        if(line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        if(!(is >> rule.function >> rule.precision >> rule.matrix >> rule.tolerance))
+        {
+            fprintf(stderr, "Invalid tolerance rule: %s\n", line.c_str());
+            return false;
+        }
+
+        rules.push_back(rule);
+    }
+
+    return true;
+}
+
+inline bool gate_rule_match(const std::string& pattern, const std::string& value)
+{
+    return pattern == "*" || pattern == value;
+}
+
+inline double
+    gate_tolerance(const std::vector<gate_rule>& rules, const gate_case& c, double fallback)
+{
+    double tol = fallback;
+
+    for(size_t i = 0; i < rules.size(); ++i)
+    {
+        if(gate_rule_match(rules[i].function, c.function) &&
+           gate_rule_match(rules[i].precision, c.precision) &&
+           gate_rule_match(rules[i].matrix, c.matrix))
+        {
+            tol = rules[i].tolerance;
+        }
+    }
+
+    return tol;
+}
+
+/* ============================================================================================ */
+/*  Statistics */
+inline double gate_median(std::vector<double> values)
+{
+    size_t n = values.size();
+
+    std::sort(values.begin(), values.end());
+
+    return (n % 2 == 1) ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+}
+
+// Exact upper tail probability P(U >= u) of the Mann-Whitney U statistic of n1 current and
+// n2 baseline samples without ties. Counts the arrangements with a given U by dynamic
+// programming over the sample sizes.
+inline double mann_whitney_exact_p(size_t n1, size_t n2, double u)
+{
+    size_t umax = n1 * n2;
+    std::vector<std::vector<double>> prev(n2 + 1, std::vector<double>(umax + 1, 0.0));
+
+    for(size_t b = 0; b <= n2; ++b)
+    {
+        prev[b][0] = 1.0;
+    }
+
+    for(size_t a = 1; a <= n1; ++a)
+    {
+        std::vector<std::vector<double>> next(n2 + 1, std::vector<double>(umax + 1, 0.0));
+
+        next[0][0] = 1.0;
+
+        for(size_t b = 1; b <= n2; ++b)
+        {
+            for(size_t k = 0; k <= umax; ++k)
+            {
+                // Largest sample belongs to current, it exceeds all b baseline samples
+                next[b][k] = ((k >= b) ? prev[b][k - b] : 0.0) + next[b - 1][k];
+            }
+        }
+
+        prev.swap(next);
+    }
+
+    double total = 0.0;
+    double tail  = 0.0;
+
+    for(size_t k = 0; k <= umax; ++k)
+    {
+        total += prev[n2][k];
+        tail += (k >= static_cast<size_t>(u + 0.5)) ? prev[n2][k] : 0.0;
+    }
+
+    return tail / total;
+}
+
+// Upper tail probability of the Mann-Whitney U statistic by the normal approximation with
+// continuity correction. ties is the sum of t^3 - t over all groups of t tied samples.
+inline double mann_whitney_normal_p(size_t n1, size_t n2, double u, double ties)
+{
+    double n     = static_cast<double>(n1 + n2);
+    double mean  = 0.5 * n1 * n2;
+    double var   = n1 * n2 / 12.0 * ((n + 1) - ties / (n * (n - 1)));
+    double sigma = std::sqrt(std::max(var, 0.0));
+
+    if(sigma == 0.0)
+    {
+        return 1.0;
+    }
+
+    double z = (u - mean - 0.5) / sigma;
+
+    return 0.5 * erfc(z / std::sqrt(2.0));
+}
+
+// Largest n1 * n2 for which the exact distribution is evaluated
+#define GATE_EXACT_LIMIT 400
+
+// One sided Mann-Whitney U test, p-value of the hypothesis that current samples are not
+// larger than baseline samples. Exact for small samples without ties, else the normal
+// approximation with tie correction.
+inline double mann_whitney_p(const std::vector<double>& base, const std::vector<double>& cur)
+{
+    size_t n1 = cur.size();
+    size_t n2 = base.size();
+
+    // Rank the pooled samples, ties get their mid rank
+    std::vector<std::pair<double, int>> pool;
+
+    for(size_t i = 0; i < n1; ++i)
+    {
+        pool.push_back(std::make_pair(cur[i], 1));
+    }
+
+    for(size_t i = 0; i < n2; ++i)
+    {
+        pool.push_back(std::make_pair(base[i], 0));
+    }
+
+    std::sort(pool.begin(), pool.end());
+
+    double rank_sum = 0.0;
+    double ties     = 0.0;
+    bool has_ties   = false;
+
+    for(size_t i = 0; i < pool.size();)
+    {
+        size_t j = i;
+        while(j < pool.size() && pool[j].first == pool[i].first)
+        {
+            ++j;
+        }
+
+        double t    = static_cast<double>(j - i);
+        double rank = 0.5 * (i + 1 + j);
+
+        for(size_t k = i; k < j; ++k)
+        {
+            rank_sum += pool[k].second * rank;
+        }
+
+        ties += t * t * t - t;
+        has_ties |= (t > 1);
+
+        i = j;
+    }
+
+    // U statistic of the current samples, large if they are slower
+    double u = rank_sum - 0.5 * n1 * (n1 + 1);
+
+    if(!has_ties && n1 * n2 <= GATE_EXACT_LIMIT)
+    {
+        return mann_whitney_exact_p(n1, n2, u);
+    }
+
+    return mann_whitney_normal_p(n1, n2, u, ties);
+}
+
+/* ============================================================================================ */
+/*  Verdict of a case */
+typedef enum gate_status_
+{
+    gate_status_ok         = 0, // within tolerance
+    gate_status_noise      = 1, // slower beyond tolerance, but not significant
+    gate_status_regression = 2, // slower beyond tolerance and significant
+    gate_status_improved   = 3  // faster beyond tolerance and significant
+} gate_status;
+
+inline const char* gate_status_string(gate_status status)
+{
+    switch(status)
+    {
+    case gate_status_ok: return "ok";
+    case gate_status_noise: return "noise";
+    case gate_status_regression: return "REGRESSION";
+    case gate_status_improved: return "improved";
+    }
+
+    return "invalid";
+}
+
+// Compare the samples of a case, returns the relative change of the median time and the
+// p-value of the slowdown
+inline gate_status gate_compare(const std::vector<double>& base,
+                                const std::vector<double>& cur,
+                                double tol,
+                                double alpha,
+                                double& change,
+                                double& p)
+{
+    change = gate_median(cur) / gate_median(base) - 1.0;
+    p      = mann_whitney_p(base, cur);
+
+    if(change > tol && p < alpha)
+    {
+        return gate_status_regression;
+    }
+    else if(change > tol)
+    {
+        return gate_status_noise;
+    }
+    else if(-change > tol && mann_whitney_p(cur, base) < alpha)
+    {
+        return gate_status_improved;
+    }
+
+    return gate_status_ok;
+}
+
+#endif // PERF_GATE_HPP
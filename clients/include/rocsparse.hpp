@@ -96,6 +96,22 @@ rocsparse_status rocsparse_coomv(rocsparse_handle handle,
                                  const T* beta,
                                  T* y);
 
+template <typename T>
+rocsparse_status rocsparse_coomv_semiring(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_semiring semiring,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int nnz,
+                                          const T* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T* coo_val,
+                                          const rocsparse_int* coo_row_ind,
+                                          const rocsparse_int* coo_col_ind,
+                                          const T* x,
+                                          const T* beta,
+                                          T* y);
+
 template <typename T>
 rocsparse_status rocsparse_csrmv_analysis(rocsparse_handle handle,
                                           rocsparse_operation trans,
@@ -124,6 +140,75 @@ rocsparse_status rocsparse_csrmv(rocsparse_handle handle,
                                  const T* beta,
                                  T* y);
 
+template <typename T>
+rocsparse_status rocsparse_csrmv_semiring(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_semiring semiring,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int nnz,
+                                          const T* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          rocsparse_mat_info info,
+                                          const T* x,
+                                          const T* beta,
+                                          T* y);
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_masked(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        rocsparse_int nnz,
+                                        const T* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const T* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        const T* x,
+                                        const T* beta,
+                                        rocsparse_int mask_nnz,
+                                        const rocsparse_int* mask_ind,
+                                        T* y);
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_stream(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int n,
+                                        rocsparse_int nnz,
+                                        const T* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const rocsparse_int* csr_row_ptr,
+                                        rocsparse_int panel_nnz,
+                                        rocsparse_csr_panel_read read_panel,
+                                        void* user_data,
+                                        const T* x,
+                                        const T* beta,
+                                        T* y);
+
+template <typename T>
+rocsparse_status rocsparse_cscmspv(rocsparse_handle handle,
+                                   rocsparse_semiring semiring,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const T* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const T* csc_val,
+                                   const rocsparse_int* csc_col_ptr,
+                                   const rocsparse_int* csc_row_ind,
+                                   rocsparse_mat_info info,
+                                   rocsparse_int x_nnz,
+                                   const T* x_val,
+                                   const rocsparse_int* x_ind,
+                                   rocsparse_int* y_nnz,
+                                   T* y_val,
+                                   rocsparse_int* y_ind);
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_buffer_size(rocsparse_handle handle,
                                              rocsparse_operation trans,
@@ -190,6 +275,57 @@ rocsparse_status rocsparse_hybmv(rocsparse_handle handle,
                                  const T* beta,
                                  T* y);
 
+template <typename T>
+rocsparse_status rocsparse_pcsrmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const T* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_pcsr_mat pcsr,
+                                  const T* x,
+                                  const T* beta,
+                                  T* y);
+
+// Mixed precision SpMV, matrix values are stored in 16-bit format U
+template <typename U>
+rocsparse_status rocsparse_csrmv_mixed(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       rocsparse_int nnz,
+                                       const float* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const U* csr_val,
+                                       const rocsparse_int* csr_row_ptr,
+                                       const rocsparse_int* csr_col_ind,
+                                       rocsparse_mat_info info,
+                                       const float* x,
+                                       const float* beta,
+                                       float* y);
+
+template <typename U>
+rocsparse_status rocsparse_ellmv_mixed(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       rocsparse_int m,
+                                       rocsparse_int n,
+                                       const float* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const U* ell_val,
+                                       const rocsparse_int* ell_col_ind,
+                                       rocsparse_int ell_width,
+                                       const float* x,
+                                       const float* beta,
+                                       float* y);
+
+template <typename U>
+rocsparse_status rocsparse_hybmv_mixed(rocsparse_handle handle,
+                                       rocsparse_operation trans,
+                                       const float* alpha,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_hyb_mat hyb,
+                                       const float* x,
+                                       const float* beta,
+                                       float* y);
+
 template <typename T>
 rocsparse_status rocsparse_csrmm(rocsparse_handle handle,
                                  rocsparse_operation trans_A,
@@ -284,6 +420,20 @@ rocsparse_status rocsparse_csr2hyb(rocsparse_handle handle,
                                    rocsparse_int user_ell_width,
                                    rocsparse_hyb_partition partition_type);
 
+template <typename T>
+rocsparse_status
+    rocsparse_csr2hyb_update(rocsparse_handle handle, const T* csr_val, rocsparse_hyb_mat hyb);
+
+template <typename T>
+rocsparse_status rocsparse_csr2pcsr(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const T* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_pcsr_mat pcsr);
+
 template <typename T>
 rocsparse_status rocsparse_ell2csr(rocsparse_handle handle,
                                    rocsparse_int m,
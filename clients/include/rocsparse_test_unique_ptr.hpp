@@ -105,6 +105,22 @@ struct hyb_struct
     }
 };
 
+struct pcsr_struct
+{
+    rocsparse_pcsr_mat pcsr;
+    pcsr_struct()
+    {
+        rocsparse_status status = rocsparse_create_pcsr_mat(&pcsr);
+        verify_rocsparse_status_success(status, "ERROR: pcsr_struct constructor");
+    }
+
+    ~pcsr_struct()
+    {
+        rocsparse_status status = rocsparse_destroy_pcsr_mat(pcsr);
+        verify_rocsparse_status_success(status, "ERROR: pcsr_struct destructor");
+    }
+};
+
 struct mat_info_struct
 {
     rocsparse_mat_info info;
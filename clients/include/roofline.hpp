@@ -0,0 +1,384 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROOFLINE_HPP
+#define ROOFLINE_HPP
+
+#include "utility.hpp"
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <rocsparse.h>
+
+/* ============================================================================================ */
+/*! \brief  Least recently used model of the last level cache. Counts the bytes that have to be
+ *  loaded from device memory for a stream of accesses.
+ */
+class roofline_cache
+{
+public:
+    roofline_cache(size_t capacity, size_t line_size);
+
+    // Access byte address, returns the bytes loaded from device memory
+    size_t access(size_t address);
+
+private:
+    size_t line_size;
+    size_t num_lines;
+
+    std::list<size_t> lru;
+    std::unordered_map<size_t, std::list<size_t>::iterator> lines;
+};
+
+/*! \brief  Device parameters the traffic models depend on */
+struct roofline_device
+{
+    size_t cache_size;
+    size_t cache_line;
+    rocsparse_int wavefront_size;
+    rocsparse_int max_threads;
+    rocsparse_int num_procs;
+};
+
+/*! \brief  Parameters of the current device, queried once */
+const roofline_device& roofline_get_device();
+
+/*! \brief  Peak bandwidth in GB/s. Returns the user supplied bandwidth if positive, else
+ *  measures the bandwidth of a device to device copy once.
+ */
+double roofline_peak_bandwidth(double user_bandwidth);
+
+/*! \brief  Result of a benchmark run */
+struct roofline_result
+{
+    std::string function;
+    std::string precision;
+    std::string format;
+
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+
+    double flops;
+    double bytes;
+    double msec;
+};
+
+/*! \brief  Print achieved bandwidth, arithmetic intensity and percentage of peak bandwidth of
+ *  a benchmark run, and append it to the CSV or JSON report if requested by --report.
+ */
+void roofline_report(const Arguments& argus, const roofline_result& result);
+
+/*! \brief  Collect the results of subsequent benchmark runs in sink, nullptr stops collecting */
+void roofline_set_sink(std::vector<roofline_result>* sink);
+
+/* ============================================================================================ */
+/*! \brief  Precision string of value type T, as used by rocsparse-bench -r */
+template <typename T>
+inline const char* roofline_precision();
+
+template <>
+inline const char* roofline_precision<float>()
+{
+    return "s";
+}
+
+template <>
+inline const char* roofline_precision<double>()
+{
+    return "d";
+}
+
+template <>
+inline const char* roofline_precision<rocsparse_float_complex>()
+{
+    return "c";
+}
+
+template <>
+inline const char* roofline_precision<rocsparse_double_complex>()
+{
+    return "z";
+}
+
+template <>
+inline const char* roofline_precision<rocsparse_half>()
+{
+    return "h";
+}
+
+template <>
+inline const char* roofline_precision<rocsparse_bfloat16>()
+{
+    return "b";
+}
+
+/* ============================================================================================ */
+/*! \brief  Bytes of a dense vector of type T that is gathered through the cache, for indices
+ *  in the order they are accessed.
+ */
+template <typename T>
+size_t roofline_gather_bytes(size_t size, const rocsparse_int* ind, rocsparse_index_base idx_base)
+{
+    const roofline_device& dev = roofline_get_device();
+    roofline_cache cache(dev.cache_size, dev.cache_line);
+
+    size_t bytes = 0;
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        bytes += cache.access(sizeof(T) * (ind[i] - idx_base));
+    }
+
+    return bytes;
+}
+
+/*! \brief  Bytes moved by scaling a dense vector with beta. beta = 1 skips the vector, beta = 0
+ *  only writes it.
+ */
+template <typename T>
+size_t roofline_scale_bytes(size_t size, T beta)
+{
+    if(beta == static_cast<T>(1))
+    {
+        return 0;
+    }
+
+    return (beta == static_cast<T>(0) ? 1 : 2) * size * sizeof(T);
+}
+
+/*! \brief  Number of row blocks the csrmv analysis creates for CSR-Adaptive. Mirrors the
+ *  partitioning of the library, see ComputeRowBlocks in rocsparse_csrmv.hpp.
+ */
+size_t roofline_csrmv_row_blocks(rocsparse_int m, const rocsparse_int* ptr);
+
+/*! \brief  Bytes moved by csrmv. Row pointers, column indices and values are streamed once,
+ *  x is gathered through the cache and y is written, and read if beta is non-zero. The
+ *  adaptive algorithm additionally reads its row blocks.
+ */
+template <typename T, typename U = T>
+size_t roofline_csrmv_bytes(rocsparse_int m,
+                            rocsparse_int nnz,
+                            const rocsparse_int* ptr,
+                            const rocsparse_int* col,
+                            rocsparse_index_base idx_base,
+                            T beta,
+                            bool adaptive)
+{
+    size_t bytes = sizeof(rocsparse_int) * (m + 1) + (sizeof(rocsparse_int) + sizeof(U)) * nnz;
+
+    bytes += roofline_gather_bytes<T>(nnz, col, idx_base);
+    bytes += sizeof(T) * m * (beta != static_cast<T>(0) ? 2 : 1);
+
+    if(adaptive)
+    {
+        bytes += sizeof(unsigned long long) * roofline_csrmv_row_blocks(m, ptr);
+    }
+
+    return bytes;
+}
+
+/*! \brief  Bytes moved by pcsrmv. As csrmv, but column indices are streamed as packed deltas
+ *  of delta_size bytes, plus one column base per block of block_dim rows.
+ */
+template <typename T, typename U = T>
+size_t roofline_pcsrmv_bytes(rocsparse_int m,
+                             rocsparse_int nnz,
+                             rocsparse_int block_dim,
+                             rocsparse_int delta_size,
+                             const rocsparse_int* col,
+                             rocsparse_index_base idx_base,
+                             T beta)
+{
+    size_t bytes = sizeof(rocsparse_int) * (m + 1) + (delta_size + sizeof(U)) * nnz;
+
+    bytes += sizeof(rocsparse_int) * ((m - 1) / block_dim + 1);
+    bytes += roofline_gather_bytes<T>(nnz, col, idx_base);
+    bytes += sizeof(T) * m * (beta != static_cast<T>(0) ? 2 : 1);
+
+    return bytes;
+}
+
+/*! \brief  Bytes moved by coomv. For non-transposed matrices, each wavefront reduces segments
+ *  of consecutive entries and updates y once per row segment, the last segment of each
+ *  wavefront is passed on to a block reduction. Transposed matrices update y with one
+ *  atomic per entry.
+ */
+template <typename T, typename U = T>
+size_t roofline_coomv_bytes(rocsparse_operation trans,
+                            rocsparse_int m,
+                            rocsparse_int n,
+                            rocsparse_int nnz,
+                            const rocsparse_int* row,
+                            const rocsparse_int* col,
+                            rocsparse_index_base idx_base,
+                            T beta)
+{
+    size_t bytes = (2 * sizeof(rocsparse_int) + sizeof(U)) * nnz;
+
+    if(trans != rocsparse_operation_none)
+    {
+        bytes += roofline_gather_bytes<T>(nnz, row, idx_base);
+        bytes += roofline_scale_bytes(n, beta);
+        bytes += 2 * sizeof(T) * nnz;
+
+        return bytes;
+    }
+
+    bytes += roofline_gather_bytes<T>(nnz, col, idx_base);
+    bytes += roofline_scale_bytes(m, beta);
+
+    if(nnz == 0)
+    {
+        return bytes;
+    }
+
+    // Launch configuration of the segmented reduction, see rocsparse_coomv.hpp
+    const roofline_device& dev = roofline_get_device();
+
+    size_t maxblocks = (dev.num_procs * dev.max_threads - 1) / 128 + 1;
+    size_t minblocks = (nnz - 1) / 128 + 1;
+    size_t nwfs      = std::min(maxblocks, minblocks) * (128 / dev.wavefront_size);
+    size_t chunk     = ((nnz / dev.wavefront_size + 1) / nwfs + 1) * dev.wavefront_size;
+
+    // Read modify write of y for each completed row segment
+    size_t segments = 0;
+
+    for(size_t begin = 0; begin < static_cast<size_t>(nnz); begin += chunk)
+    {
+        size_t end = std::min(begin + chunk, static_cast<size_t>(nnz));
+
+        for(size_t i = begin + 1; i < end; ++i)
+        {
+            segments += (row[i] != row[i - 1]);
+        }
+    }
+
+    bytes += 2 * sizeof(T) * segments;
+
+    // Block reduction buffers are written and read, their results update y
+    bytes += 2 * (sizeof(rocsparse_int) + sizeof(T)) * nwfs;
+    bytes += 2 * sizeof(T) * ((nnz - 1) / chunk + 1);
+
+    return bytes;
+}
+
+/*! \brief  Bytes moved by ellmv. The padded column index and value arrays are streamed
+ *  completely. Non-transposed matrices gather x through the cache, transposed matrices
+ *  update y with one atomic per non-padding entry.
+ */
+template <typename T, typename U = T>
+size_t roofline_ellmv_bytes(rocsparse_operation trans,
+                            rocsparse_int m,
+                            rocsparse_int n,
+                            rocsparse_int ell_width,
+                            const rocsparse_int* ell_col,
+                            rocsparse_index_base idx_base,
+                            T beta)
+{
+    size_t bytes = (sizeof(rocsparse_int) + sizeof(U)) * m * ell_width;
+
+    // Non-padding column indices in row order, ELL is stored column major
+    std::vector<rocsparse_int> col;
+    col.reserve(static_cast<size_t>(m) * ell_width);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int p = 0; p < ell_width; ++p)
+        {
+            rocsparse_int c = ell_col[static_cast<size_t>(p) * m + i] - idx_base;
+
+            if(c < 0 || c >= n)
+            {
+                break;
+            }
+
+            col.push_back(c + idx_base);
+        }
+    }
+
+    if(trans != rocsparse_operation_none)
+    {
+        bytes += sizeof(T) * m;
+        bytes += roofline_scale_bytes(n, beta);
+        bytes += 2 * sizeof(T) * col.size();
+
+        return bytes;
+    }
+
+    bytes += roofline_gather_bytes<T>(col.size(), col.data(), idx_base);
+    bytes += sizeof(T) * m * (beta != static_cast<T>(0) ? 2 : 1);
+
+    return bytes;
+}
+
+/*! \brief  Bytes moved by hybmv. The ELL part is computed with beta, the COO part accumulates
+ *  into the result of the ELL part. Index arrays are passed as device pointers.
+ */
+template <typename T, typename U = T>
+size_t roofline_hybmv_bytes(rocsparse_operation trans,
+                            rocsparse_int m,
+                            rocsparse_int n,
+                            rocsparse_int ell_width,
+                            const rocsparse_int* ell_col,
+                            rocsparse_int coo_nnz,
+                            const rocsparse_int* coo_row,
+                            const rocsparse_int* coo_col,
+                            rocsparse_index_base idx_base,
+                            T beta)
+{
+    size_t ell_nnz = static_cast<size_t>(m) * ell_width;
+
+    std::vector<rocsparse_int> hell_col(ell_nnz);
+    std::vector<rocsparse_int> hcoo_row(coo_nnz);
+    std::vector<rocsparse_int> hcoo_col(coo_nnz);
+
+    hipMemcpy(hell_col.data(), ell_col, sizeof(rocsparse_int) * ell_nnz, hipMemcpyDeviceToHost);
+    hipMemcpy(hcoo_row.data(), coo_row, sizeof(rocsparse_int) * coo_nnz, hipMemcpyDeviceToHost);
+    hipMemcpy(hcoo_col.data(), coo_col, sizeof(rocsparse_int) * coo_nnz, hipMemcpyDeviceToHost);
+
+    size_t bytes = 0;
+
+    if(ell_nnz > 0)
+    {
+        bytes += roofline_ellmv_bytes<T, U>(
+            trans, m, n, ell_width, hell_col.data(), idx_base, beta);
+    }
+
+    bytes += roofline_coomv_bytes<T, U>(trans,
+                                        m,
+                                        n,
+                                        coo_nnz,
+                                        hcoo_row.data(),
+                                        hcoo_col.data(),
+                                        idx_base,
+                                        ell_nnz > 0 ? static_cast<T>(1) : beta);
+
+    return bytes;
+}
+
+#endif // ROOFLINE_HPP
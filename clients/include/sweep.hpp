@@ -0,0 +1,74 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+
+#include "roofline.hpp"
+
+#include <string>
+#include <vector>
+
+/* ============================================================================================ */
+/*! \brief  Summary statistics of the timing samples of a benchmark case. The confidence
+ *  interval of the median is distribution free, based on order statistics.
+ */
+struct sweep_stats
+{
+    size_t samples;
+    double median;
+    double mad;
+    double ci_low;
+    double ci_high;
+};
+
+/*! \brief  Benchmark case of a sweep, one matrix, function and precision */
+struct sweep_case
+{
+    std::string matrix;
+    roofline_result result;
+    std::vector<double> msec;
+};
+
+/*! \brief  Median, median absolute deviation and 95% confidence interval of the median */
+sweep_stats sweep_compute_stats(std::vector<double> samples);
+
+/*! \brief  Split comma separated list */
+std::vector<std::string> sweep_split(const std::string& list);
+
+/*! \brief  Matrices of a sweep. path is either a directory, whose .mtx and .rsc files are used,
+ *  or a manifest listing one matrix per line. Relative manifest entries are resolved against
+ *  the directory of the manifest, lines starting with # are ignored.
+ */
+std::vector<std::string> sweep_matrices(const std::string& path);
+
+/*! \brief  Write sweep results as JSON, returns false if the file cannot be written */
+bool sweep_write_json(const std::string& path,
+                      const Arguments& argus,
+                      rocsparse_int warmup,
+                      rocsparse_int repeats,
+                      const std::vector<sweep_case>& cases);
+
+#endif // SWEEP_HPP
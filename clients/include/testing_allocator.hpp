@@ -0,0 +1,326 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_ALLOCATOR_HPP
+#define TESTING_ALLOCATOR_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <map>
+#include <string>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+// Device allocator that counts allocations and keeps track of live memory
+struct allocator_counter
+{
+    size_t mallocs = 0;
+    size_t frees   = 0;
+
+    std::map<void*, size_t> live;
+};
+
+inline rocsparse_status
+    allocator_counter_malloc(void* user_data, void** ptr, size_t size, hipStream_t stream)
+{
+    allocator_counter* counter = static_cast<allocator_counter*>(user_data);
+
+    if(hipMalloc(ptr, size) != hipSuccess)
+    {
+        return rocsparse_status_memory_error;
+    }
+
+    ++counter->mallocs;
+    counter->live[*ptr] = size;
+
+    return rocsparse_status_success;
+}
+
+inline rocsparse_status allocator_counter_free(void* user_data, void* ptr, hipStream_t stream)
+{
+    allocator_counter* counter = static_cast<allocator_counter*>(user_data);
+
+    ++counter->frees;
+    counter->live.erase(ptr);
+
+    return (hipFree(ptr) == hipSuccess) ? rocsparse_status_success
+                                        : rocsparse_status_internal_error;
+}
+
+// csrmv_masked on all rows, which obtains two temporary buffers from the workspace
+template <typename T>
+rocsparse_status allocator_csrmv_masked(rocsparse_handle handle,
+                                        const rocsparse_mat_descr descr,
+                                        rocsparse_int m,
+                                        rocsparse_int nnz,
+                                        const rocsparse_int* dptr,
+                                        const rocsparse_int* dcol,
+                                        const T* dval,
+                                        const rocsparse_int* dmask,
+                                        const T* dx,
+                                        T* dy,
+                                        T h_alpha)
+{
+    T h_beta = 0.0;
+
+    return rocsparse_csrmv_masked(handle,
+                                  rocsparse_operation_none,
+                                  m,
+                                  m,
+                                  nnz,
+                                  &h_alpha,
+                                  descr,
+                                  dval,
+                                  dptr,
+                                  dcol,
+                                  dx,
+                                  &h_beta,
+                                  m,
+                                  dmask,
+                                  dy);
+}
+
+// Check csrmv_masked output against the host
+template <typename T>
+void allocator_check(const T* dy,
+                     rocsparse_int m,
+                     T h_alpha,
+                     const std::vector<rocsparse_int>& hcsr_row_ptr,
+                     const std::vector<rocsparse_int>& hcsr_col_ind,
+                     const std::vector<T>& hcsr_val,
+                     const std::vector<T>& hx,
+                     rocsparse_index_base idx_base)
+{
+    std::vector<T> hy(m);
+    std::vector<T> hy_gold(m);
+
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    host_csrmv_parallel(m,
+                        h_alpha,
+                        hcsr_row_ptr.data(),
+                        hcsr_col_ind.data(),
+                        hcsr_val.data(),
+                        hx.data(),
+                        static_cast<T>(0),
+                        hy_gold.data(),
+                        idx_base,
+                        1);
+
+    unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+}
+
+// The workspace is served by the user allocator. Temporary buffers of the first call are
+// allocated separately, the workspace grows once at the end of the call and is reused by
+// subsequent calls, also after the stream has been changed.
+template <typename T>
+rocsparse_status testing_allocator_workspace(Arguments argus)
+{
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int ndim            = argus.laplacian;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    allocator_counter counter;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_allocator(
+        handle, allocator_counter_malloc, allocator_counter_free, &counter));
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    rocsparse_int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<rocsparse_int> hmask(m);
+    std::vector<T> hx(m);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        hmask[i] = i + idx_base;
+    }
+
+    rocsparse_init<T>(hx, 1, m);
+
+    // Allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dmask_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * m), device_free};
+    auto dx_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy1_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy2_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    rocsparse_int* dptr  = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol  = (rocsparse_int*)dcol_managed.get();
+    T* dval              = (T*)dval_managed.get();
+    rocsparse_int* dmask = (rocsparse_int*)dmask_managed.get();
+    T* dx                = (T*)dx_managed.get();
+    T* dy1               = (T*)dy1_managed.get();
+    T* dy2               = (T*)dy2_managed.get();
+
+    if(!dptr || !dcol || !dval || !dmask || !dx || !dy1 || !dy2)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr || !dcol || !dval || !dmask || !dx || !dy1 || "
+                                        "!dy2");
+        return rocsparse_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dmask, hmask.data(), sizeof(rocsparse_int) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    rocsparse_memory_stats stats;
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_memory_stats(handle, &stats));
+
+    size_t zero = 0;
+    size_t one  = 1;
+
+    unit_check_general(1, 1, 1, &zero, &stats.workspace_size);
+    unit_check_general(1, 1, 1, &zero, &stats.workspace_high_water);
+
+    size_t requests = stats.workspace_requests;
+    size_t allocs   = stats.device_allocs;
+
+    // First call, the empty workspace cannot serve the temporary buffers. They are
+    // allocated separately and released at the end of the call, when the workspace grows
+    // to their peak demand with a single allocation.
+    T h_alpha = 1.0;
+
+    CHECK_ROCSPARSE_ERROR(
+        allocator_csrmv_masked(handle, descr, m, nnz, dptr, dcol, dval, dmask, dx, dy1, h_alpha));
+    allocator_check(dy1, m, h_alpha, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hx, idx_base);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_memory_stats(handle, &stats));
+
+    size_t call_requests = stats.workspace_requests - requests;
+    size_t call_allocs   = stats.device_allocs - allocs;
+    size_t call_mallocs  = call_requests + 1;
+    size_t live          = counter.live.size();
+
+    unit_check_general(1, 1, 1, &call_mallocs, &call_allocs);
+    unit_check_general(1, 1, 1, &call_mallocs, &counter.mallocs);
+    unit_check_general(1, 1, 1, &call_requests, &counter.frees);
+    unit_check_general(1, 1, 1, &one, &live);
+
+    if(live != 1)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    unit_check_general(1, 1, 1, &counter.live.begin()->second, &stats.workspace_size);
+
+    if(stats.workspace_high_water == 0 || stats.workspace_high_water > stats.workspace_size)
+    {
+        fprintf(stderr,
+                "Unexpected workspace high water %zu, size %zu\n",
+                stats.workspace_high_water,
+                stats.workspace_size);
+        return rocsparse_status_internal_error;
+    }
+
+    rocsparse_memory_stats first = stats;
+
+    // Subsequent calls are served from the workspace without device allocations
+    for(int i = 0; i < 2; ++i)
+    {
+        CHECK_ROCSPARSE_ERROR(allocator_csrmv_masked(
+            handle, descr, m, nnz, dptr, dcol, dval, dmask, dx, dy1, h_alpha));
+    }
+
+    allocator_check(dy1, m, h_alpha, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hx, idx_base);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_memory_stats(handle, &stats));
+
+    size_t reuse_requests = first.workspace_requests + 2 * call_requests;
+
+    unit_check_general(1, 1, 1, &call_mallocs, &counter.mallocs);
+    unit_check_general(1, 1, 1, &call_requests, &counter.frees);
+    unit_check_general(1, 1, 1, &first.device_allocs, &stats.device_allocs);
+    unit_check_general(1, 1, 1, &first.workspace_size, &stats.workspace_size);
+    unit_check_general(1, 1, 1, &first.workspace_high_water, &stats.workspace_high_water);
+    unit_check_general(1, 1, 1, &reuse_requests, &stats.workspace_requests);
+
+    // Change of stream while the workspace is still used by pending work of the previous
+    // stream. Both calls share the workspace and have to produce correct results.
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    T h_alpha2 = 2.0;
+
+    CHECK_ROCSPARSE_ERROR(
+        allocator_csrmv_masked(handle, descr, m, nnz, dptr, dcol, dval, dmask, dx, dy1, h_alpha));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, stream));
+
+    CHECK_ROCSPARSE_ERROR(
+        allocator_csrmv_masked(handle, descr, m, nnz, dptr, dcol, dval, dmask, dx, dy2, h_alpha2));
+
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_stream(handle, 0));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    allocator_check(dy1, m, h_alpha, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hx, idx_base);
+    allocator_check(dy2, m, h_alpha2, hcsr_row_ptr, hcsr_col_ind, hcsr_val, hx, idx_base);
+
+    unit_check_general(1, 1, 1, &call_mallocs, &counter.mallocs);
+
+    // Restoring the default allocator releases the workspace through the user allocator
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_allocator(handle, nullptr, nullptr, nullptr));
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_memory_stats(handle, &stats));
+
+    size_t frees = call_requests + 1;
+    live         = counter.live.size();
+
+    unit_check_general(1, 1, 1, &frees, &counter.frees);
+    unit_check_general(1, 1, 1, &zero, &live);
+    unit_check_general(1, 1, 1, &zero, &stats.workspace_size);
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_ALLOCATOR_HPP
@@ -0,0 +1,891 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_ANALYSIS_REUSE_HPP
+#define TESTING_ANALYSIS_REUSE_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <string>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+// Laplacian whose first row couples to column ndim + shift instead of ndim, such that each
+// shift yields a different sparsity pattern of identical dimensions
+template <typename T>
+rocsparse_int analysis_reuse_pattern(rocsparse_int ndim,
+                                     rocsparse_int shift,
+                                     std::vector<rocsparse_int>& hcsr_row_ptr,
+                                     std::vector<rocsparse_int>& hcsr_col_ind,
+                                     std::vector<T>& hcsr_val,
+                                     rocsparse_index_base idx_base)
+{
+    rocsparse_int m = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+
+    for(rocsparse_int j = hcsr_row_ptr[0] - idx_base; j < hcsr_row_ptr[1] - idx_base; ++j)
+    {
+        if(hcsr_col_ind[j] - idx_base == ndim)
+        {
+            hcsr_col_ind[j] = ndim + shift + idx_base;
+        }
+    }
+
+    return m;
+}
+
+// Device copy of the arrays of a host CSR matrix
+template <typename T>
+void analysis_reuse_upload(rocsparse_int m,
+                           rocsparse_int nnz,
+                           const std::vector<rocsparse_int>& hcsr_row_ptr,
+                           const std::vector<rocsparse_int>& hcsr_col_ind,
+                           const std::vector<T>& hcsr_val,
+                           rocsparse_int* dptr,
+                           rocsparse_int* dcol,
+                           T* dval)
+{
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+}
+
+// csrmv with analysis meta data, compared against the host. Returns the status of csrmv.
+template <typename T>
+rocsparse_status analysis_reuse_csrmv(rocsparse_handle handle,
+                                      const rocsparse_mat_descr descr,
+                                      rocsparse_mat_info info,
+                                      rocsparse_int m,
+                                      rocsparse_int nnz,
+                                      const rocsparse_int* dptr,
+                                      const rocsparse_int* dcol,
+                                      const T* dval,
+                                      const std::vector<rocsparse_int>& hcsr_row_ptr,
+                                      const std::vector<rocsparse_int>& hcsr_col_ind,
+                                      const std::vector<T>& hcsr_val,
+                                      rocsparse_index_base idx_base)
+{
+    T h_alpha = 2.0;
+    T h_beta  = 0.0;
+
+    std::vector<T> hx(m);
+    std::vector<T> hy(m);
+
+    rocsparse_init<T>(hx, 1, m);
+
+    auto dx_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    T* dx = (T*)dx_managed.get();
+    T* dy = (T*)dy_managed.get();
+
+    if(!dx || !dy)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dx || !dy");
+        return rocsparse_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    rocsparse_status status = rocsparse_csrmv(handle,
+                                              rocsparse_operation_none,
+                                              m,
+                                              m,
+                                              nnz,
+                                              &h_alpha,
+                                              descr,
+                                              dval,
+                                              dptr,
+                                              dcol,
+                                              info,
+                                              dx,
+                                              &h_beta,
+                                              dy);
+
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    std::vector<T> hy_gold(m);
+
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+    host_csrmv_parallel(m,
+                        h_alpha,
+                        hcsr_row_ptr.data(),
+                        hcsr_col_ind.data(),
+                        hcsr_val.data(),
+                        hx.data(),
+                        h_beta,
+                        hy_gold.data(),
+                        idx_base,
+                        1);
+
+    unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+
+    return rocsparse_status_success;
+}
+
+// Two matrices of identical sparsity pattern, stored in different arrays, share their
+// csrilu0 and csrsv analysis data through the handle. Only matrix B has a zero pivot in
+// its first row, which must not be reported for matrix A.
+template <typename T>
+rocsparse_status testing_analysis_reuse_zero_pivot(Arguments argus)
+{
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_operation trans     = rocsparse_operation_none;
+    rocsparse_int ndim            = argus.laplacian;
+    T h_alpha                     = 1.0;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_info_A(new mat_info_struct);
+    rocsparse_mat_info info_A = unique_ptr_info_A->info;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_info_B(new mat_info_struct);
+    rocsparse_mat_info info_B = unique_ptr_info_B->info;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_non_unit));
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val_A;
+
+    rocsparse_int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val_A, idx_base);
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    // Matrix B has a zero diagonal entry in its first row
+    std::vector<T> hcsr_val_B(hcsr_val_A);
+
+    for(rocsparse_int j = hcsr_row_ptr[0] - idx_base; j < hcsr_row_ptr[1] - idx_base; ++j)
+    {
+        if(hcsr_col_ind[j] - idx_base == 0)
+        {
+            hcsr_val_B[j] = static_cast<T>(0);
+        }
+    }
+
+    std::vector<T> hx(m);
+    rocsparse_init<T>(hx, 1, m);
+
+    // Allocate memory on device, each matrix has its own arrays
+    auto dptr_A_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_A_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_A_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dptr_B_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_B_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_B_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed     = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed     = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    rocsparse_int* dptr_A = (rocsparse_int*)dptr_A_managed.get();
+    rocsparse_int* dcol_A = (rocsparse_int*)dcol_A_managed.get();
+    T* dval_A             = (T*)dval_A_managed.get();
+    rocsparse_int* dptr_B = (rocsparse_int*)dptr_B_managed.get();
+    rocsparse_int* dcol_B = (rocsparse_int*)dcol_B_managed.get();
+    T* dval_B             = (T*)dval_B_managed.get();
+    T* dx                 = (T*)dx_managed.get();
+    T* dy                 = (T*)dy_managed.get();
+
+    if(!dptr_A || !dcol_A || !dval_A || !dptr_B || !dcol_B || !dval_B || !dx || !dy)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr_A || !dcol_A || !dval_A || !dptr_B || !dcol_B || "
+                                        "!dval_B || !dx || !dy");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr_A, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcol_A, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_A, hcsr_val_A.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr_B, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcol_B, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval_B, hcsr_val_B.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Obtain buffer size
+    size_t size_ilu0;
+    size_t size_sv;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size(
+        handle, m, nnz, descr, dval_A, dptr_A, dcol_A, info_A, &size_ilu0));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size(
+        handle, trans, m, nnz, descr, dval_A, dptr_A, dcol_A, info_A, &size_sv));
+
+    auto dbuffer_managed = rocsparse_unique_ptr{
+        device_malloc(sizeof(char) * std::max(size_ilu0, size_sv)), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    rocsparse_int no_pivot = -1;
+    rocsparse_int pivot_B  = idx_base;
+    rocsparse_int position;
+
+    // csrilu0 analysis, matrix B re-uses the analysis data of matrix A
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     dval_A,
+                                                     dptr_A,
+                                                     dcol_A,
+                                                     info_A,
+                                                     rocsparse_analysis_policy_reuse,
+                                                     rocsparse_solve_policy_auto,
+                                                     dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     dval_B,
+                                                     dptr_B,
+                                                     dcol_B,
+                                                     info_B,
+                                                     rocsparse_analysis_policy_reuse,
+                                                     rocsparse_solve_policy_auto,
+                                                     dbuffer));
+
+    // Factorize B first, such that its zero pivot would be visible to A if shared
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(handle,
+                                            m,
+                                            nnz,
+                                            descr,
+                                            dval_B,
+                                            dptr_B,
+                                            dcol_B,
+                                            info_B,
+                                            rocsparse_solve_policy_auto,
+                                            dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(handle,
+                                            m,
+                                            nnz,
+                                            descr,
+                                            dval_A,
+                                            dptr_A,
+                                            dcol_A,
+                                            info_A,
+                                            rocsparse_solve_policy_auto,
+                                            dbuffer));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_zero_pivot(handle, info_A, &position));
+    unit_check_general(1, 1, 1, &no_pivot, &position);
+
+    verify_rocsparse_status_zero_pivot(rocsparse_csrilu0_zero_pivot(handle, info_B, &position),
+                                       "expected rocsparse_status_zero_pivot");
+    unit_check_general(1, 1, 1, &pivot_B, &position);
+
+    // Lower triangular analysis on the factors, shared the same way
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                   trans,
+                                                   m,
+                                                   nnz,
+                                                   descr,
+                                                   dval_A,
+                                                   dptr_A,
+                                                   dcol_A,
+                                                   info_A,
+                                                   rocsparse_analysis_policy_reuse,
+                                                   rocsparse_solve_policy_auto,
+                                                   dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                   trans,
+                                                   m,
+                                                   nnz,
+                                                   descr,
+                                                   dval_B,
+                                                   dptr_B,
+                                                   dcol_B,
+                                                   info_B,
+                                                   rocsparse_analysis_policy_reuse,
+                                                   rocsparse_solve_policy_auto,
+                                                   dbuffer));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve(handle,
+                                                trans,
+                                                m,
+                                                nnz,
+                                                &h_alpha,
+                                                descr,
+                                                dval_B,
+                                                dptr_B,
+                                                dcol_B,
+                                                info_B,
+                                                dx,
+                                                dy,
+                                                rocsparse_solve_policy_auto,
+                                                dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve(handle,
+                                                trans,
+                                                m,
+                                                nnz,
+                                                &h_alpha,
+                                                descr,
+                                                dval_A,
+                                                dptr_A,
+                                                dcol_A,
+                                                info_A,
+                                                dx,
+                                                dy,
+                                                rocsparse_solve_policy_auto,
+                                                dbuffer));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_zero_pivot(handle, descr, info_A, &position));
+    unit_check_general(1, 1, 1, &no_pivot, &position);
+
+    verify_rocsparse_status_zero_pivot(
+        rocsparse_csrsv_zero_pivot(handle, descr, info_B, &position),
+        "expected rocsparse_status_zero_pivot");
+    unit_check_general(1, 1, 1, &pivot_B, &position);
+
+    // Repeated factorization of A does not report pivots of earlier factorizations of B
+    CHECK_HIP_ERROR(hipMemcpy(dval_A, hcsr_val_A.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(handle,
+                                            m,
+                                            nnz,
+                                            descr,
+                                            dval_A,
+                                            dptr_A,
+                                            dcol_A,
+                                            info_A,
+                                            rocsparse_solve_policy_auto,
+                                            dbuffer));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_zero_pivot(handle, info_A, &position));
+    unit_check_general(1, 1, 1, &no_pivot, &position);
+
+    // Iterative factorization of the values of B and then of A with the same matrix info
+    // does not report the pivot of B for A
+    std::unique_ptr<mat_info_struct> unique_ptr_info_C(new mat_info_struct);
+    rocsparse_mat_info info_C = unique_ptr_info_C->info;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_info_sweeps(info_C, m + 1, m + 1));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     dval_A,
+                                                     dptr_A,
+                                                     dcol_A,
+                                                     info_C,
+                                                     rocsparse_analysis_policy_force,
+                                                     rocsparse_solve_policy_iterative,
+                                                     dbuffer));
+
+    CHECK_HIP_ERROR(hipMemcpy(dval_A, hcsr_val_B.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(handle,
+                                            m,
+                                            nnz,
+                                            descr,
+                                            dval_A,
+                                            dptr_A,
+                                            dcol_A,
+                                            info_C,
+                                            rocsparse_solve_policy_iterative,
+                                            dbuffer));
+
+    verify_rocsparse_status_zero_pivot(rocsparse_csrilu0_zero_pivot(handle, info_C, &position),
+                                       "expected rocsparse_status_zero_pivot");
+
+    CHECK_HIP_ERROR(hipMemcpy(dval_A, hcsr_val_A.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(handle,
+                                            m,
+                                            nnz,
+                                            descr,
+                                            dval_A,
+                                            dptr_A,
+                                            dcol_A,
+                                            info_C,
+                                            rocsparse_solve_policy_iterative,
+                                            dbuffer));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_zero_pivot(handle, info_C, &position));
+    unit_check_general(1, 1, 1, &no_pivot, &position);
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info_C));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info_A));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info_B));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info_A));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info_B));
+
+    return rocsparse_status_success;
+}
+
+// Analysis meta data remains valid for a matrix that has been copied to new arrays, and
+// the arrays of the analysis have been released
+template <typename T>
+rocsparse_status testing_analysis_reuse_moved(Arguments argus)
+{
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int ndim            = argus.laplacian;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_info->info;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    rocsparse_int m =
+        analysis_reuse_pattern(ndim, 0, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    size_t size;
+
+    // Analysis with the first copy of the matrix
+    {
+        auto dptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+        auto dcol_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T* dval             = (T*)dval_managed.get();
+
+        if(!dptr || !dcol || !dval)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval");
+            return rocsparse_status_memory_error;
+        }
+
+        analysis_reuse_upload(m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, dptr, dcol, dval);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+            handle, rocsparse_operation_none, m, m, nnz, descr, dval, dptr, dcol, info));
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrilu0_buffer_size(handle, m, nnz, descr, dval, dptr, dcol, info, &size));
+
+        auto dbuffer_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+        void* dbuffer = (void*)dbuffer_managed.get();
+
+        if(!dbuffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                         m,
+                                                         nnz,
+                                                         descr,
+                                                         dval,
+                                                         dptr,
+                                                         dcol,
+                                                         info,
+                                                         rocsparse_analysis_policy_reuse,
+                                                         rocsparse_solve_policy_auto,
+                                                         dbuffer));
+    }
+
+    // Execution with a second copy, allocated after the first copy has been released
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    void* dbuffer       = (void*)dbuffer_managed.get();
+
+    if(!dptr || !dcol || !dval || !dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr || !dcol || !dval || !dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    analysis_reuse_upload(m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, dptr, dcol, dval);
+
+    CHECK_ROCSPARSE_ERROR(analysis_reuse_csrmv(handle,
+                                               descr,
+                                               info,
+                                               m,
+                                               nnz,
+                                               dptr,
+                                               dcol,
+                                               dval,
+                                               hcsr_row_ptr,
+                                               hcsr_col_ind,
+                                               hcsr_val,
+                                               idx_base));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(
+        handle, m, nnz, descr, dval, dptr, dcol, info, rocsparse_solve_policy_auto, dbuffer));
+
+    std::vector<T> result(nnz);
+    CHECK_HIP_ERROR(hipMemcpy(result.data(), dval, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+    csrilu0(m, hcsr_row_ptr.data(), hcsr_col_ind.data(), hcsr_val.data(), idx_base);
+
+    unit_check_near(1, nnz, 1, hcsr_val.data(), result.data());
+
+    return rocsparse_status_success;
+}
+
+// A matrix of changed sparsity pattern is rejected, if stored in new arrays and, with
+// rocsparse_pattern_check_always, if modified in place
+template <typename T>
+rocsparse_status testing_analysis_reuse_changed(Arguments argus)
+{
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int ndim            = argus.laplacian;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_info->info;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    // Host structures of the analysed and of the changed pattern
+    std::vector<rocsparse_int> hcsr_row_ptr_A;
+    std::vector<rocsparse_int> hcsr_col_ind_A;
+    std::vector<T> hcsr_val_A;
+    std::vector<rocsparse_int> hcsr_row_ptr_B;
+    std::vector<rocsparse_int> hcsr_col_ind_B;
+    std::vector<T> hcsr_val_B;
+
+    rocsparse_int m =
+        analysis_reuse_pattern(ndim, 0, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, idx_base);
+    rocsparse_int nnz = hcsr_row_ptr_A[m] - idx_base;
+
+    analysis_reuse_pattern(ndim, 1, hcsr_row_ptr_B, hcsr_col_ind_B, hcsr_val_B, idx_base);
+
+    auto dptr_A_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_A_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_A_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dptr_B_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_B_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_B_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    rocsparse_int* dptr_A = (rocsparse_int*)dptr_A_managed.get();
+    rocsparse_int* dcol_A = (rocsparse_int*)dcol_A_managed.get();
+    T* dval_A             = (T*)dval_A_managed.get();
+    rocsparse_int* dptr_B = (rocsparse_int*)dptr_B_managed.get();
+    rocsparse_int* dcol_B = (rocsparse_int*)dcol_B_managed.get();
+    T* dval_B             = (T*)dval_B_managed.get();
+
+    if(!dptr_A || !dcol_A || !dval_A || !dptr_B || !dcol_B || !dval_B)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr_A || !dcol_A || !dval_A || !dptr_B || !dcol_B || "
+                                        "!dval_B");
+        return rocsparse_status_memory_error;
+    }
+
+    analysis_reuse_upload(
+        m, nnz, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, dptr_A, dcol_A, dval_A);
+    analysis_reuse_upload(
+        m, nnz, hcsr_row_ptr_B, hcsr_col_ind_B, hcsr_val_B, dptr_B, dcol_B, dval_B);
+
+    size_t size;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrilu0_buffer_size(handle, m, nnz, descr, dval_A, dptr_A, dcol_A, info, &size));
+
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    // Analysis of pattern A
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+        handle, rocsparse_operation_none, m, m, nnz, descr, dval_A, dptr_A, dcol_A, info));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     dval_A,
+                                                     dptr_A,
+                                                     dcol_A,
+                                                     info,
+                                                     rocsparse_analysis_policy_reuse,
+                                                     rocsparse_solve_policy_auto,
+                                                     dbuffer));
+
+    // Pattern B in other arrays
+    verify_rocsparse_status_invalid_pointer(analysis_reuse_csrmv(handle,
+                                                                 descr,
+                                                                 info,
+                                                                 m,
+                                                                 nnz,
+                                                                 dptr_B,
+                                                                 dcol_B,
+                                                                 dval_B,
+                                                                 hcsr_row_ptr_B,
+                                                                 hcsr_col_ind_B,
+                                                                 hcsr_val_B,
+                                                                 idx_base),
+                                            "Error: csrmv with changed pattern");
+    verify_rocsparse_status_invalid_pointer(rocsparse_csrilu0(handle,
+                                                              m,
+                                                              nnz,
+                                                              descr,
+                                                              dval_B,
+                                                              dptr_B,
+                                                              dcol_B,
+                                                              info,
+                                                              rocsparse_solve_policy_auto,
+                                                              dbuffer),
+                                            "Error: csrilu0 with changed pattern");
+
+    // Pattern A again, the analysis data is still valid
+    CHECK_ROCSPARSE_ERROR(analysis_reuse_csrmv(handle,
+                                               descr,
+                                               info,
+                                               m,
+                                               nnz,
+                                               dptr_A,
+                                               dcol_A,
+                                               dval_A,
+                                               hcsr_row_ptr_A,
+                                               hcsr_col_ind_A,
+                                               hcsr_val_A,
+                                               idx_base));
+
+    // Pattern B written in place of pattern A
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_set_mat_info_pattern_check(info, rocsparse_pattern_check_always));
+
+    analysis_reuse_upload(
+        m, nnz, hcsr_row_ptr_B, hcsr_col_ind_B, hcsr_val_B, dptr_A, dcol_A, dval_A);
+
+    verify_rocsparse_status_invalid_pointer(analysis_reuse_csrmv(handle,
+                                                                 descr,
+                                                                 info,
+                                                                 m,
+                                                                 nnz,
+                                                                 dptr_A,
+                                                                 dcol_A,
+                                                                 dval_A,
+                                                                 hcsr_row_ptr_B,
+                                                                 hcsr_col_ind_B,
+                                                                 hcsr_val_B,
+                                                                 idx_base),
+                                            "Error: csrmv with pattern changed in place");
+    verify_rocsparse_status_invalid_pointer(rocsparse_csrilu0(handle,
+                                                              m,
+                                                              nnz,
+                                                              descr,
+                                                              dval_A,
+                                                              dptr_A,
+                                                              dcol_A,
+                                                              info,
+                                                              rocsparse_solve_policy_auto,
+                                                              dbuffer),
+                                            "Error: csrilu0 with pattern changed in place");
+
+    // Pattern A restored in place
+    analysis_reuse_upload(
+        m, nnz, hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, dptr_A, dcol_A, dval_A);
+
+    CHECK_ROCSPARSE_ERROR(analysis_reuse_csrmv(handle,
+                                               descr,
+                                               info,
+                                               m,
+                                               nnz,
+                                               dptr_A,
+                                               dcol_A,
+                                               dval_A,
+                                               hcsr_row_ptr_A,
+                                               hcsr_col_ind_A,
+                                               hcsr_val_A,
+                                               idx_base));
+
+    return rocsparse_status_success;
+}
+
+// More patterns than the handle caches. Evicted analysis data remains valid for the
+// matrix info structures that still refer to it, and evicted patterns can be analysed
+// again.
+template <typename T>
+rocsparse_status testing_analysis_reuse_eviction(Arguments argus)
+{
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int ndim            = argus.laplacian;
+    rocsparse_int npattern        = 10;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    std::vector<std::vector<rocsparse_int>> hcsr_row_ptr(npattern);
+    std::vector<std::vector<rocsparse_int>> hcsr_col_ind(npattern);
+    std::vector<std::vector<T>> hcsr_val(npattern);
+
+    std::vector<rocsparse_unique_ptr> d_managed;
+    std::vector<std::unique_ptr<mat_info_struct>> infos;
+
+    rocsparse_int m   = 0;
+    rocsparse_int nnz = 0;
+
+    // Analysis of each pattern with its own matrix info
+    for(rocsparse_int k = 0; k < npattern; ++k)
+    {
+        m = analysis_reuse_pattern(
+            ndim, k, hcsr_row_ptr[k], hcsr_col_ind[k], hcsr_val[k], idx_base);
+        nnz = hcsr_row_ptr[k][m] - idx_base;
+
+        d_managed.emplace_back(device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free);
+        d_managed.emplace_back(device_malloc(sizeof(rocsparse_int) * nnz), device_free);
+        d_managed.emplace_back(device_malloc(sizeof(T) * nnz), device_free);
+
+        rocsparse_int* dptr = (rocsparse_int*)d_managed[3 * k + 0].get();
+        rocsparse_int* dcol = (rocsparse_int*)d_managed[3 * k + 1].get();
+        T* dval             = (T*)d_managed[3 * k + 2].get();
+
+        if(!dptr || !dcol || !dval)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval");
+            return rocsparse_status_memory_error;
+        }
+
+        analysis_reuse_upload(
+            m, nnz, hcsr_row_ptr[k], hcsr_col_ind[k], hcsr_val[k], dptr, dcol, dval);
+
+        infos.emplace_back(new mat_info_struct);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+            handle, rocsparse_operation_none, m, m, nnz, descr, dval, dptr, dcol, infos[k]->info));
+    }
+
+    // Every matrix info still holds valid analysis data
+    for(rocsparse_int k = 0; k < npattern; ++k)
+    {
+        CHECK_ROCSPARSE_ERROR(analysis_reuse_csrmv(handle,
+                                                   descr,
+                                                   infos[k]->info,
+                                                   m,
+                                                   nnz,
+                                                   (rocsparse_int*)d_managed[3 * k + 0].get(),
+                                                   (rocsparse_int*)d_managed[3 * k + 1].get(),
+                                                   (T*)d_managed[3 * k + 2].get(),
+                                                   hcsr_row_ptr[k],
+                                                   hcsr_col_ind[k],
+                                                   hcsr_val[k],
+                                                   idx_base));
+    }
+
+    // Release the matrix info structures, then analyse all patterns again with new ones,
+    // starting with the evicted ones
+    infos.clear();
+
+    for(rocsparse_int k = 0; k < npattern; ++k)
+    {
+        std::unique_ptr<mat_info_struct> unique_ptr_info(new mat_info_struct);
+        rocsparse_mat_info info = unique_ptr_info->info;
+
+        rocsparse_int* dptr = (rocsparse_int*)d_managed[3 * k + 0].get();
+        rocsparse_int* dcol = (rocsparse_int*)d_managed[3 * k + 1].get();
+        T* dval             = (T*)d_managed[3 * k + 2].get();
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_analysis(
+            handle, rocsparse_operation_none, m, m, nnz, descr, dval, dptr, dcol, info));
+
+        CHECK_ROCSPARSE_ERROR(analysis_reuse_csrmv(handle,
+                                                   descr,
+                                                   info,
+                                                   m,
+                                                   nnz,
+                                                   dptr,
+                                                   dcol,
+                                                   dval,
+                                                   hcsr_row_ptr[k],
+                                                   hcsr_col_ind[k],
+                                                   hcsr_val[k],
+                                                   idx_base));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_ANALYSIS_REUSE_HPP
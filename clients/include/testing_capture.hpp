@@ -0,0 +1,532 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CAPTURE_HPP
+#define TESTING_CAPTURE_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <string>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+// Matrix file of a log_bench line
+inline std::string capture_bench_mtx(const std::string& line)
+{
+    size_t pos = line.find("--mtx ");
+
+    if(pos == std::string::npos)
+    {
+        return "";
+    }
+
+    pos += 6;
+
+    return line.substr(pos, line.find(' ', pos) - pos);
+}
+
+// Compare a capture against the host matrix in CSR format
+template <typename T>
+rocsparse_status capture_check(const std::string& path,
+                               rocsparse_int m,
+                               rocsparse_int n,
+                               rocsparse_int nnz,
+                               const std::vector<rocsparse_int>& hcsr_row_ptr,
+                               const std::vector<rocsparse_int>& hcsr_col_ind,
+                               const std::vector<T>& hcsr_val,
+                               rocsparse_index_base idx_base)
+{
+    rocsparse_int nrow;
+    rocsparse_int ncol;
+    rocsparse_int cnnz;
+
+    std::vector<rocsparse_int> row;
+    std::vector<rocsparse_int> col;
+    std::vector<T> val;
+
+    if(read_capture_matrix(path.c_str(), nrow, ncol, cnnz, row, col, val, idx_base) != 0)
+    {
+        fprintf(stderr, "Cannot read capture %s\n", path.c_str());
+        return rocsparse_status_internal_error;
+    }
+
+    unit_check_general(1, 1, 1, &m, &nrow);
+    unit_check_general(1, 1, 1, &n, &ncol);
+    unit_check_general(1, 1, 1, &nnz, &cnnz);
+
+    std::vector<rocsparse_int> hcoo_row_ind(nnz);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            hcoo_row_ind[j] = i + idx_base;
+        }
+    }
+
+    unit_check_general(1, nnz, 1, hcoo_row_ind.data(), row.data());
+    unit_check_general(1, nnz, 1, (rocsparse_int*)hcsr_col_ind.data(), col.data());
+    unit_check_general(1, nnz, 1, (T*)hcsr_val.data(), val.data());
+
+    return rocsparse_status_success;
+}
+
+// csrmv operands are captured once per content. Repeated calls log the existing capture,
+// calls with changed values are captured again, and captures read back as the original
+// matrix.
+template <typename T>
+rocsparse_status testing_capture_csrmv(Arguments argus)
+{
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int ndim            = argus.laplacian;
+    T h_alpha                     = 1.0;
+    T h_beta                      = 0.0;
+
+    scoped_temp_dir dir;
+
+    if(dir.path.empty())
+    {
+        verify_rocsparse_status_success(rocsparse_status_internal_error, "mkdtemp");
+        return rocsparse_status_internal_error;
+    }
+
+    std::string bench_path = dir.path + "/bench.log";
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    rocsparse_int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hcsr_val_scaled(hcsr_val);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        hcsr_val_scaled[i] = static_cast<T>(2) * hcsr_val[i];
+    }
+
+    std::vector<T> hx(m, static_cast<T>(1));
+
+    // Allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    T* dx               = (T*)dx_managed.get();
+    T* dy               = (T*)dy_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dx || !dy");
+        return rocsparse_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Handle with bench logging and capturing, log is complete once the handle is destroyed
+    {
+        scoped_env env;
+
+        env.set("ROCSPARSE_LAYER", std::to_string(rocsparse_layer_mode_log_bench));
+        env.set("ROCSPARSE_LOG_BENCH_PATH", bench_path);
+        env.set("ROCSPARSE_CAPTURE_PATH", dir.path);
+        env.set("ROCSPARSE_CAPTURE_FILTER", "csrmv");
+
+        std::unique_ptr<handle_struct> test_handle(new handle_struct);
+        rocsparse_handle handle = test_handle->handle;
+
+        std::unique_ptr<descr_struct> test_descr(new descr_struct);
+        rocsparse_mat_descr descr = test_descr->descr;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Same matrix twice, then with new values
+        for(int i = 0; i < 3; ++i)
+        {
+            if(i == 2)
+            {
+                CHECK_HIP_ERROR(hipMemcpy(
+                    dval, hcsr_val_scaled.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                                  rocsparse_operation_none,
+                                                  m,
+                                                  m,
+                                                  nnz,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dval,
+                                                  dptr,
+                                                  dcol,
+                                                  nullptr,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy));
+        }
+    }
+
+    std::vector<std::string> lines = read_lines(bench_path);
+
+    rocsparse_int nlines = lines.size();
+    rocsparse_int ncalls = 3;
+
+    unit_check_general(1, 1, 1, &ncalls, &nlines);
+
+    if(nlines != ncalls)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    std::string mtx0 = capture_bench_mtx(lines[0]);
+    std::string mtx1 = capture_bench_mtx(lines[1]);
+    std::string mtx2 = capture_bench_mtx(lines[2]);
+
+    // Repeated call logs the existing capture, changed values are captured again
+    if(mtx0 == "<matrix.mtx>" || mtx2 == "<matrix.mtx>" || mtx0 != mtx1 || mtx0 == mtx2)
+    {
+        fprintf(stderr,
+                "Unexpected captures %s, %s, %s\n",
+                mtx0.c_str(),
+                mtx1.c_str(),
+                mtx2.c_str());
+        return rocsparse_status_internal_error;
+    }
+
+    // Captures read back as the matrices that have been passed to csrmv
+    rocsparse_status status =
+        capture_check(mtx0, m, m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    return capture_check(mtx2, m, m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val_scaled, idx_base);
+}
+
+// cscmspv captures its CSC operand, which reads back as the original matrix
+template <typename T>
+rocsparse_status testing_capture_cscmspv(Arguments argus)
+{
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int m               = argus.laplacian * argus.laplacian;
+    rocsparse_int n               = m + 7;
+    rocsparse_int nnz             = 4 * m;
+    rocsparse_int x_nnz           = 1;
+    T h_alpha                     = 1.0;
+
+    scoped_temp_dir dir;
+
+    if(dir.path.empty())
+    {
+        verify_rocsparse_status_success(rocsparse_status_internal_error, "mkdtemp");
+        return rocsparse_status_internal_error;
+    }
+
+    std::string bench_path = dir.path + "/bench.log";
+
+    // Random rectangular matrix in CSR and CSC format
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    srand(12345ULL);
+    gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
+
+    std::vector<rocsparse_int> hcsr_row_ptr(m + 1, 0);
+    std::vector<rocsparse_int> hcsc_col_ptr(n + 1, 0);
+    std::vector<rocsparse_int> hcsc_row_ind(nnz);
+    std::vector<T> hcsc_val(nnz);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
+        ++hcsc_col_ptr[hcsr_col_ind[i] + 1 - idx_base];
+    }
+
+    hcsr_row_ptr[0] = idx_base;
+    hcsc_col_ptr[0] = idx_base;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
+    }
+
+    for(rocsparse_int i = 0; i < n; ++i)
+    {
+        hcsc_col_ptr[i + 1] += hcsc_col_ptr[i];
+    }
+
+    std::vector<rocsparse_int> hcsc_pos(hcsc_col_ptr);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        rocsparse_int idx = hcsc_pos[hcsr_col_ind[i] - idx_base]++ - idx_base;
+
+        hcsc_row_ind[idx] = hcoo_row_ind[i];
+        hcsc_val[idx]     = hcsr_val[i];
+    }
+
+    rocsparse_int hx_ind = idx_base;
+    T hx_val             = static_cast<T>(1);
+
+    // Allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (n + 1)), device_free};
+    auto drow_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto dx_ind_managed = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
+    auto dy_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * m), device_free};
+
+    rocsparse_int* dptr   = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* drow   = (rocsparse_int*)drow_managed.get();
+    T* dval               = (T*)dval_managed.get();
+    T* dx_val             = (T*)dx_val_managed.get();
+    rocsparse_int* dx_ind = (rocsparse_int*)dx_ind_managed.get();
+    T* dy_val             = (T*)dy_val_managed.get();
+    rocsparse_int* dy_ind = (rocsparse_int*)dy_ind_managed.get();
+
+    if(!dptr || !drow || !dval || !dx_val || !dx_ind || !dy_val || !dy_ind)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr || !drow || !dval || !dx_val || !dx_ind || "
+                                        "!dy_val || !dy_ind");
+        return rocsparse_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsc_col_ptr.data(), sizeof(rocsparse_int) * (n + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(drow, hcsc_row_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsc_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, &hx_val, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_ind, &hx_ind, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+
+    // Handle with bench logging and capturing, log is complete once the handle is destroyed
+    {
+        scoped_env env;
+
+        env.set("ROCSPARSE_LAYER", std::to_string(rocsparse_layer_mode_log_bench));
+        env.set("ROCSPARSE_LOG_BENCH_PATH", bench_path);
+        env.set("ROCSPARSE_CAPTURE_PATH", dir.path);
+        env.set("ROCSPARSE_CAPTURE_FILTER", "cscmspv");
+
+        std::unique_ptr<handle_struct> test_handle(new handle_struct);
+        rocsparse_handle handle = test_handle->handle;
+
+        std::unique_ptr<descr_struct> test_descr(new descr_struct);
+        rocsparse_mat_descr descr = test_descr->descr;
+
+        std::unique_ptr<mat_info_struct> test_info(new mat_info_struct);
+        rocsparse_mat_info info = test_info->info;
+
+        rocsparse_int y_nnz;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_cscmspv_analysis(handle, m, n, nnz, descr, dptr, drow, info));
+        CHECK_ROCSPARSE_ERROR(rocsparse_cscmspv(handle,
+                                                rocsparse_semiring_plus_times,
+                                                m,
+                                                n,
+                                                nnz,
+                                                &h_alpha,
+                                                descr,
+                                                dval,
+                                                dptr,
+                                                drow,
+                                                info,
+                                                x_nnz,
+                                                dx_val,
+                                                dx_ind,
+                                                &y_nnz,
+                                                dy_val,
+                                                dy_ind));
+        CHECK_ROCSPARSE_ERROR(rocsparse_cscmspv_clear(handle, info));
+    }
+
+    std::vector<std::string> lines = read_lines(bench_path);
+
+    rocsparse_int nlines = lines.size();
+    rocsparse_int ncalls = 1;
+
+    unit_check_general(1, 1, 1, &ncalls, &nlines);
+
+    if(nlines != ncalls)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    // The capture reads back as the matrix in row major order
+    return capture_check(
+        capture_bench_mtx(lines[0]), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+}
+
+// pcsrmv captures its PCSR operand in CSR format, which reads back as the original matrix.
+// Pattern only matrices read back with unit values.
+template <typename T>
+rocsparse_status testing_capture_pcsrmv(Arguments argus)
+{
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int ndim            = argus.laplacian;
+    T h_alpha                     = 1.0;
+    T h_beta                      = 0.0;
+
+    scoped_temp_dir dir;
+
+    if(dir.path.empty())
+    {
+        verify_rocsparse_status_success(rocsparse_status_internal_error, "mkdtemp");
+        return rocsparse_status_internal_error;
+    }
+
+    std::string bench_path = dir.path + "/bench.log";
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    rocsparse_int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hcsr_val_ones(nnz, static_cast<T>(1));
+    std::vector<T> hx(m, static_cast<T>(1));
+
+    // Allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    T* dx               = (T*)dx_managed.get();
+    T* dy               = (T*)dy_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dx || !dy");
+        return rocsparse_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Handle with bench logging and capturing, log is complete once the handle is destroyed
+    {
+        scoped_env env;
+
+        env.set("ROCSPARSE_LAYER", std::to_string(rocsparse_layer_mode_log_bench));
+        env.set("ROCSPARSE_LOG_BENCH_PATH", bench_path);
+        env.set("ROCSPARSE_CAPTURE_PATH", dir.path);
+        env.set("ROCSPARSE_CAPTURE_FILTER", "pcsrmv");
+
+        std::unique_ptr<handle_struct> test_handle(new handle_struct);
+        rocsparse_handle handle = test_handle->handle;
+
+        std::unique_ptr<descr_struct> test_descr(new descr_struct);
+        rocsparse_mat_descr descr = test_descr->descr;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Matrix with values, then pattern only
+        for(int i = 0; i < 2; ++i)
+        {
+            std::unique_ptr<pcsr_struct> test_pcsr(new pcsr_struct);
+            rocsparse_pcsr_mat pcsr = test_pcsr->pcsr;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr2pcsr(
+                handle, m, m, descr, i == 0 ? dval : nullptr, dptr, dcol, pcsr));
+            CHECK_ROCSPARSE_ERROR(rocsparse_pcsrmv(
+                handle, rocsparse_operation_none, &h_alpha, descr, pcsr, dx, &h_beta, dy));
+        }
+    }
+
+    std::vector<std::string> lines = read_lines(bench_path);
+
+    // Each conversion is logged along with pcsrmv
+    rocsparse_int nlines = lines.size();
+    rocsparse_int ncalls = 4;
+
+    unit_check_general(1, 1, 1, &ncalls, &nlines);
+
+    if(nlines != ncalls)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    std::string mtx_val     = capture_bench_mtx(lines[1]);
+    std::string mtx_pattern = capture_bench_mtx(lines[3]);
+
+    rocsparse_status status =
+        capture_check(mtx_val, m, m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    return capture_check(
+        mtx_pattern, m, m, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val_ones, idx_base);
+}
+
+#endif // TESTING_CAPTURE_HPP
@@ -159,58 +159,11 @@ rocsparse_status testing_coo2csr(Arguments argus)
 
     // Sample initial COO matrix on CPU
     srand(12345ULL);
-    if(binfile != "")
+    if(load_matrix_coo(
+           argus, binfile, filename, m, n, nnz, hcoo_row_ind, hcoo_col_ind, hcoo_val, idx_base) !=
+       0)
     {
-        std::vector<rocsparse_int> hptr(m + 1);
-        if(read_bin_matrix(binfile.c_str(), m, n, nnz, hptr, hcoo_col_ind, hcoo_val, idx_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
-
-        hcoo_row_ind.resize(nnz);
-
-        // Convert to COO
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            for(rocsparse_int j = hptr[i]; j < hptr[i + 1]; ++j)
-            {
-                hcoo_row_ind[j - idx_base] = i + idx_base;
-            }
-        }
-    }
-    else if(argus.laplacian)
-    {
-        std::vector<rocsparse_int> hptr(m + 1);
-        m = n = gen_2d_laplacian(argus.laplacian, hptr, hcoo_col_ind, hcoo_val, idx_base);
-        nnz   = hptr[m];
-        hcoo_row_ind.resize(nnz);
-
-        // Convert to COO
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            for(rocsparse_int j = hptr[i]; j < hptr[i + 1]; ++j)
-            {
-                hcoo_row_ind[j - idx_base] = i + idx_base;
-            }
-        }
-    }
-    else
-    {
-        if(filename != "")
-        {
-            if(read_mtx_matrix(
-                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcoo_col_ind, hcoo_val, idx_base) !=
-               0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcoo_col_ind, hcoo_val, idx_base);
-        }
+        return rocsparse_status_internal_error;
     }
 
     std::vector<rocsparse_int> hcsr_row_ptr(m + 1);
@@ -28,6 +28,7 @@
 #include "rocsparse_test_unique_ptr.hpp"
 #include "rocsparse.hpp"
 #include "utility.hpp"
+#include "roofline.hpp"
 #include "unit.hpp"
 
 #include <string>
@@ -90,14 +91,6 @@ void testing_coomv_bad_arg(void)
             handle, transA, m, n, nnz, &alpha, descr, dval, drow, dcol_null, dx, &beta, dy);
         verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
     }
-    // testing for(nullptr == dval)
-    {
-        T* dval_null = nullptr;
-
-        status = rocsparse_coomv(
-            handle, transA, m, n, nnz, &alpha, descr, dval_null, drow, dcol, dx, &beta, dy);
-        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
-    }
     // testing for(nullptr == dx)
     {
         T* dx_null = nullptr;
@@ -233,69 +226,28 @@ rocsparse_status testing_coomv(Arguments argus)
     }
 
     // Host structures
-    std::vector<rocsparse_int> hptr;
     std::vector<rocsparse_int> hrow;
     std::vector<rocsparse_int> hcol;
     std::vector<T> hval;
 
     // Initial Data on CPU
     srand(12345ULL);
-    if(binfile != "")
+    if(load_matrix_coo(argus, binfile, filename, m, n, nnz, hrow, hcol, hval, idx_base) != 0)
     {
-        if(read_bin_matrix(binfile.c_str(), m, n, nnz, hptr, hcol, hval, idx_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
-
-        // Convert CSR to COO
-        hrow.resize(nnz);
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            for(rocsparse_int j = hptr[i]; j < hptr[i + 1]; ++j)
-            {
-                hrow[j - idx_base] = i + idx_base;
-            }
-        }
+        return rocsparse_status_internal_error;
     }
-    else if(argus.laplacian)
-    {
-        m = n = gen_2d_laplacian(argus.laplacian, hptr, hcol, hval, idx_base);
-        nnz   = hptr[m];
-        hrow.resize(nnz);
 
-        // Convert CSR to COO
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            for(rocsparse_int j = hptr[i]; j < hptr[i + 1]; ++j)
-            {
-                hrow[j - idx_base] = i + idx_base;
-            }
-        }
-    }
-    else
-    {
-        if(filename != "")
-        {
-            if(read_mtx_matrix(filename.c_str(), m, n, nnz, hrow, hcol, hval, idx_base) != 0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(m, n, nnz, hrow, hcol, hval, idx_base);
-        }
-    }
+    // Dimensions of x and y depend on the operation
+    rocsparse_int xsize = (transA == rocsparse_operation_none) ? n : m;
+    rocsparse_int ysize = (transA == rocsparse_operation_none) ? m : n;
 
-    std::vector<T> hx(n);
-    std::vector<T> hy_1(m);
-    std::vector<T> hy_2(m);
-    std::vector<T> hy_gold(m);
+    std::vector<T> hx(xsize);
+    std::vector<T> hy_1(ysize);
+    std::vector<T> hy_2(ysize);
+    std::vector<T> hy_gold(ysize);
 
-    rocsparse_init<T>(hx, 1, n);
-    rocsparse_init<T>(hy_1, 1, m);
+    rocsparse_init<T>(hx, 1, xsize);
+    rocsparse_init<T>(hy_1, 1, ysize);
 
     // copy vector is easy in STL; hy_gold = hx: save a copy in hy_gold which will be output of CPU
     hy_2    = hy_1;
@@ -307,9 +259,9 @@ rocsparse_status testing_coomv(Arguments argus)
     auto dcol_managed =
         rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
     auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
-    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
-    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
-    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * xsize), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ysize), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ysize), device_free};
     auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
     auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
 
@@ -336,14 +288,14 @@ rocsparse_status testing_coomv(Arguments argus)
     CHECK_HIP_ERROR(
         hipMemcpy(dcol, hcol.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * xsize, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
     if(argus.unit_check)
     {
-        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
 
         // ROCSPARSE pointer mode host
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
@@ -356,28 +308,64 @@ rocsparse_status testing_coomv(Arguments argus)
             handle, transA, m, n, nnz, d_alpha, descr, dval, drow, dcol, dx, d_beta, dy_2));
 
         // copy output from device to CPU
-        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * ysize, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * ysize, hipMemcpyDeviceToHost));
 
         // CPU
         double cpu_time_used = get_time_us();
 
-        for(rocsparse_int i = 0; i < m; ++i)
+        for(rocsparse_int i = 0; i < ysize; ++i)
         {
             hy_gold[i] *= h_beta;
         }
 
         for(rocsparse_int i = 0; i < nnz; ++i)
         {
-            hy_gold[hrow[i] - idx_base] += h_alpha * hval[i] * hx[hcol[i] - idx_base];
+            rocsparse_int row = hrow[i] - idx_base;
+            rocsparse_int col = hcol[i] - idx_base;
+
+            if(transA == rocsparse_operation_none)
+            {
+                hy_gold[row] += h_alpha * hval[i] * hx[col];
+            }
+            else
+            {
+                // Transposed product, A^T x is scattered into y
+                T val = (transA == rocsparse_operation_conjugate_transpose) ? host_conj(hval[i])
+                                                                            : hval[i];
+                hy_gold[col] += h_alpha * val * hx[row];
+            }
         }
 
         cpu_time_used = get_time_us() - cpu_time_used;
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
-        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
-        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+        unit_check_near(1, ysize, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, ysize, 1, hy_gold.data(), hy_2.data());
+
+        // Pattern only matrix, must match explicitly stored unit values
+        std::vector<T> hval_one(nnz, static_cast<T>(1));
+
+        auto dval_one_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+        T* dval_one           = (T*)dval_one_managed.get();
+        T* dval_null          = nullptr;
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(dval_one, hval_one.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_2.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_coomv(
+            handle, transA, m, n, nnz, &h_alpha, descr, dval_one, drow, dcol, dx, &h_beta, dy_1));
+        CHECK_ROCSPARSE_ERROR(rocsparse_coomv(
+            handle, transA, m, n, nnz, &h_alpha, descr, dval_null, drow, dcol, dx, &h_beta, dy_2));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * ysize, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * ysize, hipMemcpyDeviceToHost));
+
+        unit_check_near(1, ysize, 1, hy_1.data(), hy_2.data());
     }
 
     if(argus.timing)
@@ -423,11 +411,25 @@ rocsparse_status testing_coomv(Arguments argus)
                m,
                n,
                nnz,
-               h_alpha,
-               h_beta,
+               argus.alpha,
+               argus.beta,
                gpu_gflops,
                bandwidth,
                gpu_time_used);
+
+        size_t bytes = roofline_coomv_bytes<T>(
+            transA, m, n, nnz, hrow.data(), hcol.data(), idx_base, h_beta);
+
+        roofline_report(argus,
+                        {"coomv",
+                         roofline_precision<T>(),
+                         "coo",
+                         m,
+                         n,
+                         nnz,
+                         static_cast<double>(flops),
+                         static_cast<double>(bytes),
+                         gpu_time_used});
     }
     return rocsparse_status_success;
 }
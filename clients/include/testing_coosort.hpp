@@ -294,58 +294,11 @@ rocsparse_status testing_coosort(Arguments argus)
 
     // Sample initial COO matrix on CPU
     srand(12345ULL);
-    if(binfile != "")
+    if(load_matrix_coo(
+           argus, binfile, filename, m, n, nnz, hcoo_row_ind, hcoo_col_ind, hcoo_val, idx_base) !=
+       0)
     {
-        std::vector<rocsparse_int> hcsr_row_ptr;
-        if(read_bin_matrix(
-               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcoo_col_ind, hcoo_val, idx_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
-
-        // Convert CSR to COO
-        hcoo_row_ind.resize(nnz);
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            for(rocsparse_int j = hcsr_row_ptr[i]; j < hcsr_row_ptr[i + 1]; ++j)
-            {
-                hcoo_row_ind[j - idx_base] = i + idx_base;
-            }
-        }
-    }
-    else if(argus.laplacian)
-    {
-        std::vector<rocsparse_int> hcsr_row_ptr;
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcoo_col_ind, hcoo_val, idx_base);
-        nnz   = hcsr_row_ptr[m];
-
-        // Convert CSR to COO
-        hcoo_row_ind.resize(nnz);
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            for(rocsparse_int j = hcsr_row_ptr[i]; j < hcsr_row_ptr[i + 1]; ++j)
-            {
-                hcoo_row_ind[j - idx_base] = i + idx_base;
-            }
-        }
-    }
-    else
-    {
-        if(filename != "")
-        {
-            if(read_mtx_matrix(
-                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcoo_col_ind, hcoo_val, idx_base) !=
-               0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcoo_col_ind, hcoo_val, idx_base);
-        }
+        return rocsparse_status_internal_error;
     }
 
     // Unsort COO columns
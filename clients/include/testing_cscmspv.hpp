@@ -0,0 +1,1034 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSCMSPV_HPP
+#define TESTING_CSCMSPV_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <algorithm>
+#include <string>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_cscmspv_bad_arg(void)
+{
+    rocsparse_int n             = 100;
+    rocsparse_int m             = 100;
+    rocsparse_int nnz           = 100;
+    rocsparse_int x_nnz         = 10;
+    rocsparse_int safe_size     = 100;
+    T alpha                     = 0.6;
+    rocsparse_semiring semiring = rocsparse_semiring_min_plus;
+    rocsparse_int y_nnz;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_mat_info->info;
+
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto drow_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dx_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dx_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dy_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dy_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* dptr   = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* drow   = (rocsparse_int*)drow_managed.get();
+    T* dval               = (T*)dval_managed.get();
+    T* dx_val             = (T*)dx_val_managed.get();
+    rocsparse_int* dx_ind = (rocsparse_int*)dx_ind_managed.get();
+    T* dy_val             = (T*)dy_val_managed.get();
+    rocsparse_int* dy_ind = (rocsparse_int*)dy_ind_managed.get();
+
+    if(!dptr || !drow || !dval || !dx_val || !dx_ind || !dy_val || !dy_ind)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // ###############################################
+    // Tests for rocsparse_cscmspv_analysis
+    // ###############################################
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_cscmspv_analysis(handle, m, n, nnz, descr, dptr_null, drow, info);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == drow)
+    {
+        rocsparse_int* drow_null = nullptr;
+
+        status = rocsparse_cscmspv_analysis(handle, m, n, nnz, descr, dptr, drow_null, info);
+        verify_rocsparse_status_invalid_pointer(status, "Error: drow is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_cscmspv_analysis(handle, m, n, nnz, descr_null, dptr, drow, info);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_cscmspv_analysis(handle, m, n, nnz, descr, dptr, drow, info_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_cscmspv_analysis(handle_null, m, n, nnz, descr, dptr, drow, info);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // ###############################################
+    // Tests for rocsparse_cscmspv
+    // ###############################################
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_cscmspv(handle,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &alpha,
+                                   descr,
+                                   dval,
+                                   dptr_null,
+                                   drow,
+                                   info,
+                                   x_nnz,
+                                   dx_val,
+                                   dx_ind,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == drow)
+    {
+        rocsparse_int* drow_null = nullptr;
+
+        status = rocsparse_cscmspv(handle,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &alpha,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   drow_null,
+                                   info,
+                                   x_nnz,
+                                   dx_val,
+                                   dx_ind,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: drow is nullptr");
+    }
+    // testing for(nullptr == dx_ind)
+    {
+        rocsparse_int* dx_ind_null = nullptr;
+
+        status = rocsparse_cscmspv(handle,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &alpha,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   drow,
+                                   info,
+                                   x_nnz,
+                                   dx_val,
+                                   dx_ind_null,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx_ind is nullptr");
+    }
+    // testing for(nullptr == y_nnz)
+    {
+        rocsparse_int* y_nnz_null = nullptr;
+
+        status = rocsparse_cscmspv(handle,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &alpha,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   drow,
+                                   info,
+                                   x_nnz,
+                                   dx_val,
+                                   dx_ind,
+                                   y_nnz_null,
+                                   dy_val,
+                                   dy_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: y_nnz is nullptr");
+    }
+    // testing for(nullptr == dy_ind)
+    {
+        rocsparse_int* dy_ind_null = nullptr;
+
+        status = rocsparse_cscmspv(handle,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &alpha,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   drow,
+                                   info,
+                                   x_nnz,
+                                   dx_val,
+                                   dx_ind,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dy_ind is nullptr");
+    }
+    // testing for(nullptr == alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_cscmspv(handle,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   d_alpha_null,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   drow,
+                                   info,
+                                   x_nnz,
+                                   dx_val,
+                                   dx_ind,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_cscmspv(handle,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &alpha,
+                                   descr_null,
+                                   dval,
+                                   dptr,
+                                   drow,
+                                   info,
+                                   x_nnz,
+                                   dx_val,
+                                   dx_ind,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_cscmspv(handle,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &alpha,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   drow,
+                                   info_null,
+                                   x_nnz,
+                                   dx_val,
+                                   dx_ind,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for missing analysis
+    {
+        status = rocsparse_cscmspv(handle,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &alpha,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   drow,
+                                   info,
+                                   x_nnz,
+                                   dx_val,
+                                   dx_ind,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind);
+        verify_rocsparse_status_invalid_pointer(status, "Error: analysis is missing");
+    }
+    // testing for invalid semiring
+    {
+        rocsparse_semiring semiring_invalid = static_cast<rocsparse_semiring>(7);
+
+        status = rocsparse_cscmspv(handle,
+                                   semiring_invalid,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &alpha,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   drow,
+                                   info,
+                                   x_nnz,
+                                   dx_val,
+                                   dx_ind,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind);
+        verify_rocsparse_status_invalid_value(status, "Error: semiring is invalid");
+    }
+    // testing for(x_nnz > n)
+    {
+        status = rocsparse_cscmspv(handle,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &alpha,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   drow,
+                                   info,
+                                   n + 1,
+                                   dx_val,
+                                   dx_ind,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind);
+        verify_rocsparse_status_invalid_size(status, "Error: x_nnz > n");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_cscmspv(handle_null,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &alpha,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   drow,
+                                   info,
+                                   x_nnz,
+                                   dx_val,
+                                   dx_ind,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // ###############################################
+    // Tests for rocsparse_set_mat_info_cscmspv_threshold
+    // ###############################################
+
+    // testing for(threshold < 0)
+    {
+        status = rocsparse_set_mat_info_cscmspv_threshold(info, -1.0);
+        verify_rocsparse_status_invalid_value(status, "Error: threshold < 0");
+    }
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_set_mat_info_cscmspv_threshold(info_null, 0.5);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+
+    // ###############################################
+    // Tests for rocsparse_cscmspv_clear
+    // ###############################################
+
+    // testing for(nullptr == info)
+    {
+        rocsparse_mat_info info_null = nullptr;
+
+        status = rocsparse_cscmspv_clear(handle, info_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_cscmspv_clear(handle_null, info);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+// Draws x_nnz distinct column indices in ascending order
+static void cscmspv_gen_frontier(rocsparse_int n,
+                                 rocsparse_int x_nnz,
+                                 std::vector<rocsparse_int>& x_ind,
+                                 rocsparse_index_base idx_base)
+{
+    std::vector<rocsparse_int> perm(n);
+    for(rocsparse_int i = 0; i < n; ++i)
+    {
+        perm[i] = i + idx_base;
+    }
+
+    for(rocsparse_int i = 0; i < x_nnz; ++i)
+    {
+        std::swap(perm[i], perm[i + rand() % (n - i)]);
+    }
+
+    x_ind.assign(perm.begin(), perm.begin() + x_nnz);
+    std::sort(x_ind.begin(), x_ind.end());
+}
+
+// Compares the sparse result vectors, the arithmetic semiring is subject to rounding
+template <typename T>
+static void cscmspv_check(rocsparse_semiring semiring,
+                          rocsparse_int y_nnz_gold,
+                          rocsparse_int y_nnz,
+                          const std::vector<T>& hy_val_gold,
+                          const std::vector<rocsparse_int>& hy_ind_gold,
+                          std::vector<T>& hy_val,
+                          std::vector<rocsparse_int>& hy_ind,
+                          bool check_val)
+{
+    unit_check_general(1, 1, 1, &y_nnz_gold, &y_nnz);
+
+    if(y_nnz_gold == 0)
+    {
+        return;
+    }
+
+    unit_check_general(1, y_nnz_gold, 1, (rocsparse_int*)hy_ind_gold.data(), hy_ind.data());
+
+    if(!check_val)
+    {
+        return;
+    }
+
+    if(semiring == rocsparse_semiring_plus_times)
+    {
+        unit_check_near(1, y_nnz_gold, 1, (T*)hy_val_gold.data(), hy_val.data());
+    }
+    else
+    {
+        unit_check_general(1, y_nnz_gold, 1, (T*)hy_val_gold.data(), hy_val.data());
+    }
+}
+
+template <typename T>
+rocsparse_status testing_cscmspv(Arguments argus)
+{
+    rocsparse_int safe_size       = 100;
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    T h_alpha                     = argus.alpha;
+    rocsparse_semiring semiring   = argus.semiring;
+    rocsparse_index_base idx_base = argus.idx_base;
+    double frontier               = argus.frontier;
+    std::string filename          = "";
+    rocsparse_status status;
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_mat_info->info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto dptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto drow_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dx_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dx_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dy_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dy_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dptr   = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* drow   = (rocsparse_int*)drow_managed.get();
+        T* dval               = (T*)dval_managed.get();
+        T* dx_val             = (T*)dx_val_managed.get();
+        rocsparse_int* dx_ind = (rocsparse_int*)dx_ind_managed.get();
+        T* dy_val             = (T*)dy_val_managed.get();
+        rocsparse_int* dy_ind = (rocsparse_int*)dy_ind_managed.get();
+
+        if(!dptr || !drow || !dval || !dx_val || !dx_ind || !dy_val || !dy_ind)
+        {
+            verify_rocsparse_status_success(
+                rocsparse_status_memory_error,
+                "!dptr || !drow || !dval || !dx_val || !dx_ind || !dy_val || !dy_ind");
+            return rocsparse_status_memory_error;
+        }
+
+        // cscmspv analysis
+        status = rocsparse_cscmspv_analysis(handle, m, n, nnz, descr, dptr, drow, info);
+
+        if(m < 0 || n < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && nnz >= 0");
+        }
+
+        // cscmspv
+        rocsparse_int y_nnz = -1;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_cscmspv(handle,
+                                   semiring,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &h_alpha,
+                                   descr,
+                                   dval,
+                                   dptr,
+                                   drow,
+                                   info,
+                                   0,
+                                   dx_val,
+                                   dx_ind,
+                                   &y_nnz,
+                                   dy_val,
+                                   dy_ind);
+
+        if(m < 0 || n < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && nnz >= 0");
+
+            rocsparse_int y_nnz_gold = 0;
+            unit_check_general(1, 1, 1, &y_nnz_gold, &y_nnz);
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_cscmspv_clear(handle, info));
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcoo_col_ind;
+    std::vector<T> hcoo_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(load_matrix_csr(
+           argus, "", filename, m, n, nnz, hcsr_row_ptr, hcoo_col_ind, hcoo_val, idx_base) != 0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    // Row indices of the COO format, the matrix is sorted by rows
+    hcoo_row_ind.resize(nnz);
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            hcoo_row_ind[j] = i + idx_base;
+        }
+    }
+
+    // Convert COO to CSC, the rows within each column remain sorted
+    std::vector<rocsparse_int> hcsc_col_ptr(n + 1, 0);
+    std::vector<rocsparse_int> hcsc_row_ind(nnz);
+    std::vector<T> hcsc_val(nnz);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ++hcsc_col_ptr[hcoo_col_ind[i] + 1 - idx_base];
+    }
+
+    for(rocsparse_int i = 0; i < n; ++i)
+    {
+        hcsc_col_ptr[i + 1] += hcsc_col_ptr[i];
+    }
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        rocsparse_int idx = hcsc_col_ptr[hcoo_col_ind[i] - idx_base]++;
+
+        hcsc_row_ind[idx] = hcoo_row_ind[i];
+        hcsc_val[idx]     = hcoo_val[i];
+    }
+
+    for(rocsparse_int i = n; i > 0; --i)
+    {
+        hcsc_col_ptr[i] = hcsc_col_ptr[i - 1] + idx_base;
+    }
+    hcsc_col_ptr[0] = idx_base;
+
+    // Sparse vector, the frontier is a random subset of the columns
+    rocsparse_int x_nnz = std::min(n, std::max(1, static_cast<rocsparse_int>(frontier * n)));
+
+    std::vector<rocsparse_int> hx_ind;
+    std::vector<T> hx_val;
+
+    cscmspv_gen_frontier(n, x_nnz, hx_ind, idx_base);
+    rocsparse_init<T>(hx_val, 1, x_nnz);
+
+    // allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (n + 1)), device_free};
+    auto drow_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dx_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * n), device_free};
+    auto dy_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * m), device_free};
+    auto dy_nnz_managed  = rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dptr   = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* drow   = (rocsparse_int*)drow_managed.get();
+    T* dval               = (T*)dval_managed.get();
+    T* dx_val             = (T*)dx_val_managed.get();
+    rocsparse_int* dx_ind = (rocsparse_int*)dx_ind_managed.get();
+    T* dy_val             = (T*)dy_val_managed.get();
+    rocsparse_int* dy_ind = (rocsparse_int*)dy_ind_managed.get();
+    rocsparse_int* dy_nnz = (rocsparse_int*)dy_nnz_managed.get();
+    T* d_alpha            = (T*)d_alpha_managed.get();
+
+    if(!dptr || !drow || !dval || !dx_val || !dx_ind || !dy_val || !dy_ind || !dy_nnz ||
+       !d_alpha)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr || !drow || !dval || !dx_val || !dx_ind || "
+                                        "!dy_val || !dy_ind || !dy_nnz || !d_alpha");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsc_col_ptr.data(), sizeof(rocsparse_int) * (n + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(drow, hcsc_row_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsc_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dx_ind, hx_ind.data(), sizeof(rocsparse_int) * x_nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_val, hx_val.data(), sizeof(T) * x_nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // cscmspv analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_cscmspv_analysis(handle, m, n, nnz, descr, dptr, drow, info));
+
+    if(argus.unit_check)
+    {
+        std::vector<T> hy_val_gold;
+        std::vector<rocsparse_int> hy_ind_gold;
+        std::vector<T> hy_val(m);
+        std::vector<rocsparse_int> hy_ind(m);
+        rocsparse_int y_nnz;
+
+        host_cscmspv(semiring,
+                     m,
+                     h_alpha,
+                     hcsc_col_ptr.data(),
+                     hcsc_row_ind.data(),
+                     hcsc_val.data(),
+                     x_nnz,
+                     hx_val.data(),
+                     hx_ind.data(),
+                     hy_val_gold,
+                     hy_ind_gold,
+                     idx_base);
+
+        rocsparse_int y_nnz_gold = hy_ind_gold.size();
+
+        // Push, pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_info_cscmspv_threshold(info, 2.0));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_cscmspv(handle,
+                                                semiring,
+                                                m,
+                                                n,
+                                                nnz,
+                                                &h_alpha,
+                                                descr,
+                                                dval,
+                                                dptr,
+                                                drow,
+                                                info,
+                                                x_nnz,
+                                                dx_val,
+                                                dx_ind,
+                                                &y_nnz,
+                                                dy_val,
+                                                dy_ind));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_val.data(), dy_val, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_ind.data(), dy_ind, sizeof(rocsparse_int) * m, hipMemcpyDeviceToHost));
+
+        cscmspv_check(semiring, y_nnz_gold, y_nnz, hy_val_gold, hy_ind_gold, hy_val, hy_ind, true);
+
+        // Pull, pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_info_cscmspv_threshold(info, 0.0));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_cscmspv(handle,
+                                                semiring,
+                                                m,
+                                                n,
+                                                nnz,
+                                                d_alpha,
+                                                descr,
+                                                dval,
+                                                dptr,
+                                                drow,
+                                                info,
+                                                x_nnz,
+                                                dx_val,
+                                                dx_ind,
+                                                dy_nnz,
+                                                dy_val,
+                                                dy_ind));
+
+        CHECK_HIP_ERROR(hipMemcpy(&y_nnz, dy_nnz, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_val.data(), dy_val, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_ind.data(), dy_ind, sizeof(rocsparse_int) * m, hipMemcpyDeviceToHost));
+
+        cscmspv_check(semiring, y_nnz_gold, y_nnz, hy_val_gold, hy_ind_gold, hy_val, hy_ind, true);
+
+        // Pattern only, the result is the set of rows that are reached from the frontier
+        host_cscmspv(semiring,
+                     m,
+                     h_alpha,
+                     hcsc_col_ptr.data(),
+                     hcsc_row_ind.data(),
+                     (const T*)nullptr,
+                     x_nnz,
+                     (const T*)nullptr,
+                     hx_ind.data(),
+                     hy_val_gold,
+                     hy_ind_gold,
+                     idx_base);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_info_cscmspv_threshold(info, 0.05));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_cscmspv(handle,
+                                                semiring,
+                                                m,
+                                                n,
+                                                nnz,
+                                                &h_alpha,
+                                                descr,
+                                                (const T*)nullptr,
+                                                dptr,
+                                                drow,
+                                                info,
+                                                x_nnz,
+                                                (const T*)nullptr,
+                                                dx_ind,
+                                                &y_nnz,
+                                                (T*)nullptr,
+                                                dy_ind));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_ind.data(), dy_ind, sizeof(rocsparse_int) * m, hipMemcpyDeviceToHost));
+
+        cscmspv_check(semiring, y_nnz_gold, y_nnz, hy_val_gold, hy_ind_gold, hy_val, hy_ind, false);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Dense baseline, csrmv over the same semiring with a dense input vector
+        auto dcsr_ptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+        auto dcsr_col_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+        auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+        auto dx_managed       = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+        auto dy_managed       = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+        rocsparse_int* dcsr_ptr = (rocsparse_int*)dcsr_ptr_managed.get();
+        rocsparse_int* dcsr_col = (rocsparse_int*)dcsr_col_managed.get();
+        T* dcsr_val             = (T*)dcsr_val_managed.get();
+        T* dx                   = (T*)dx_managed.get();
+        T* dy                   = (T*)dy_managed.get();
+
+        if(!dcsr_ptr || !dcsr_col || !dcsr_val || !dx || !dy)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dcsr_ptr || !dcsr_col || !dcsr_val || !dx || !dy");
+            return rocsparse_status_memory_error;
+        }
+
+        std::vector<T> hx(n);
+        rocsparse_init<T>(hx, 1, n);
+
+        CHECK_HIP_ERROR(hipMemcpy(dcsr_ptr,
+                                  hcsr_row_ptr.data(),
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dcsr_col, hcoo_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcsr_val, hcoo_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+
+        T h_beta = static_cast<T>(0);
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrmv_semiring(handle,
+                                     rocsparse_operation_none,
+                                     semiring,
+                                     m,
+                                     n,
+                                     nnz,
+                                     &h_alpha,
+                                     descr,
+                                     dcsr_val,
+                                     dcsr_ptr,
+                                     dcsr_col,
+                                     nullptr,
+                                     dx,
+                                     &h_beta,
+                                     dy);
+        }
+
+        double dense_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csrmv_semiring(handle,
+                                     rocsparse_operation_none,
+                                     semiring,
+                                     m,
+                                     n,
+                                     nnz,
+                                     &h_alpha,
+                                     descr,
+                                     dcsr_val,
+                                     dcsr_ptr,
+                                     dcsr_col,
+                                     nullptr,
+                                     dx,
+                                     &h_beta,
+                                     dy);
+        }
+
+        // Convert to miliseconds per call
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        dense_time_used = (get_time_us() - dense_time_used) / (number_hot_calls * 1e3);
+
+        // Frontier sweep, a single density if specified by the user
+        std::vector<double> density = {1e-4, 1e-3, 1e-2, 0.05, 0.1, 0.25, 0.5, 1.0};
+        if(frontier > 0.0)
+        {
+            density.assign(1, frontier);
+        }
+
+        // Push only, pull only and the automatic switch at the default threshold
+        double threshold[] = {2.0, 0.0, 0.05};
+
+        printf("m\t\tn\t\tnnz\t\tsemiring\tdensity\t\tx_nnz\t\ty_nnz\t\tpush msec\tpull "
+               "msec\tauto msec\tcsrmv msec\n");
+
+        for(size_t d = 0; d < density.size(); ++d)
+        {
+            x_nnz = std::min(n, std::max(1, static_cast<rocsparse_int>(density[d] * n)));
+
+            cscmspv_gen_frontier(n, x_nnz, hx_ind, idx_base);
+            rocsparse_init<T>(hx_val, 1, x_nnz);
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                dx_ind, hx_ind.data(), sizeof(rocsparse_int) * x_nnz, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(
+                hipMemcpy(dx_val, hx_val.data(), sizeof(T) * x_nnz, hipMemcpyHostToDevice));
+
+            rocsparse_int y_nnz = 0;
+            double gpu_time_used[3];
+
+            for(int t = 0; t < 3; ++t)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_info_cscmspv_threshold(info, threshold[t]));
+
+                for(int iter = 0; iter < number_cold_calls; iter++)
+                {
+                    rocsparse_cscmspv(handle,
+                                      semiring,
+                                      m,
+                                      n,
+                                      nnz,
+                                      &h_alpha,
+                                      descr,
+                                      dval,
+                                      dptr,
+                                      drow,
+                                      info,
+                                      x_nnz,
+                                      dx_val,
+                                      dx_ind,
+                                      &y_nnz,
+                                      dy_val,
+                                      dy_ind);
+                }
+
+                gpu_time_used[t] = get_time_us();
+
+                for(int iter = 0; iter < number_hot_calls; iter++)
+                {
+                    rocsparse_cscmspv(handle,
+                                      semiring,
+                                      m,
+                                      n,
+                                      nnz,
+                                      &h_alpha,
+                                      descr,
+                                      dval,
+                                      dptr,
+                                      drow,
+                                      info,
+                                      x_nnz,
+                                      dx_val,
+                                      dx_ind,
+                                      &y_nnz,
+                                      dy_val,
+                                      dy_ind);
+                }
+
+                gpu_time_used[t] = (get_time_us() - gpu_time_used[t]) / (number_hot_calls * 1e3);
+            }
+
+            printf("%8d\t%8d\t%9d\t%8d\t%0.2e\t%8d\t%8d\t%0.3lf\t\t%0.3lf\t\t%0.3lf\t\t%0.3lf\n",
+                   m,
+                   n,
+                   nnz,
+                   semiring,
+                   density[d],
+                   x_nnz,
+                   y_nnz,
+                   gpu_time_used[0],
+                   gpu_time_used[1],
+                   gpu_time_used[2],
+                   dense_time_used);
+        }
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_cscmspv_clear(handle, info));
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSCMSPV_HPP
@@ -28,6 +28,7 @@
 #include "rocsparse_test_unique_ptr.hpp"
 #include "rocsparse.hpp"
 #include "utility.hpp"
+#include "roofline.hpp"
 #include "unit.hpp"
 
 #include <rocsparse.h>
@@ -165,26 +166,6 @@ void testing_csr2csc_bad_arg(void)
         verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
     }
 
-    // Testing for (csr_val == nullptr)
-    {
-        T* csr_val_null = nullptr;
-
-        status = rocsparse_csr2csc(handle,
-                                   m,
-                                   n,
-                                   nnz,
-                                   csr_val_null,
-                                   csr_row_ptr,
-                                   csr_col_ind,
-                                   csc_val,
-                                   csc_row_ind,
-                                   csc_col_ptr,
-                                   rocsparse_action_numeric,
-                                   rocsparse_index_base_zero,
-                                   buffer);
-        verify_rocsparse_status_invalid_pointer(status, "Error: csr_val is nullptr");
-    }
-
     // Testing for (csc_row_ind == nullptr)
     {
         rocsparse_int* csc_row_ind_null = nullptr;
@@ -284,6 +265,24 @@ void testing_csr2csc_bad_arg(void)
                                    buffer);
         verify_rocsparse_status_invalid_handle(status);
     }
+
+    // Testing for invalid action
+    {
+        status = rocsparse_csr2csc(handle,
+                                   m,
+                                   n,
+                                   nnz,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   csc_val,
+                                   csc_row_ind,
+                                   csc_col_ptr,
+                                   (rocsparse_action)3,
+                                   rocsparse_index_base_zero,
+                                   buffer);
+        verify_rocsparse_status_invalid_value(status, "Error: copy_values is invalid");
+    }
 }
 
 template <typename T>
@@ -407,51 +406,11 @@ rocsparse_status testing_csr2csc(Arguments argus)
 
     // Sample initial COO matrix on CPU
     srand(12345ULL);
-    if(binfile != "")
-    {
-        if(read_bin_matrix(
-               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
-    }
-    else if(argus.laplacian)
+    if(load_matrix_csr(
+           argus, binfile, filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) !=
+       0)
     {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
-        nnz   = hcsr_row_ptr[m];
-    }
-    else
-    {
-        std::vector<rocsparse_int> hcoo_row_ind;
-
-        if(filename != "")
-        {
-            if(read_mtx_matrix(
-                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base) !=
-               0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
-        }
-
-        // Convert COO to CSR
-        hcsr_row_ptr.resize(m + 1, 0);
-        for(rocsparse_int i = 0; i < nnz; ++i)
-        {
-            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
-        }
-
-        hcsr_row_ptr[0] = idx_base;
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
-        }
+        return rocsparse_status_internal_error;
     }
 
     // Allocate memory on the device
@@ -564,7 +523,9 @@ rocsparse_status testing_csr2csc(Arguments argus)
                 rocsparse_int idx = hcsc_col_ptr_gold[col];
 
                 hcsc_row_ind_gold[idx] = i + idx_base;
-                hcsc_val_gold[idx]     = hcsr_val[j - idx_base];
+                hcsc_val_gold[idx]     = (action == rocsparse_action_numeric_conjugate)
+                                         ? host_conj(hcsr_val[j - idx_base])
+                                         : hcsr_val[j - idx_base];
 
                 ++hcsc_col_ptr_gold[col];
             }
@@ -582,11 +543,42 @@ rocsparse_status testing_csr2csc(Arguments argus)
         unit_check_general(1, nnz, 1, hcsc_row_ind_gold.data(), hcsc_row_ind.data());
         unit_check_general(1, n + 1, 1, hcsc_col_ptr_gold.data(), hcsc_col_ptr.data());
 
-        // If action == rocsparse_action_numeric also check values
-        if(action == rocsparse_action_numeric)
+        // If action is numeric also check values
+        if(action != rocsparse_action_symbolic)
         {
             unit_check_general(1, nnz, 1, hcsc_val_gold.data(), hcsc_val.data());
         }
+
+        // Pattern only matrix, csc_val is not accessed
+        T* dcsr_val_null = nullptr;
+        T* dcsc_val_null = nullptr;
+
+        CHECK_HIP_ERROR(hipMemset(dcsc_row_ind, 0, sizeof(rocsparse_int) * nnz));
+        CHECK_HIP_ERROR(hipMemset(dcsc_col_ptr, 0, sizeof(rocsparse_int) * (n + 1)));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2csc(handle,
+                                                m,
+                                                n,
+                                                nnz,
+                                                dcsr_val_null,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                dcsc_val_null,
+                                                dcsc_row_ind,
+                                                dcsc_col_ptr,
+                                                rocsparse_action_numeric,
+                                                idx_base,
+                                                dbuffer));
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcsc_row_ind.data(), dcsc_row_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsc_col_ptr.data(),
+                                  dcsc_col_ptr,
+                                  sizeof(rocsparse_int) * (n + 1),
+                                  hipMemcpyDeviceToHost));
+
+        unit_check_general(1, nnz, 1, hcsc_row_ind_gold.data(), hcsc_row_ind.data());
+        unit_check_general(1, n + 1, 1, hcsc_col_ptr_gold.data(), hcsc_col_ptr.data());
     }
 
     if(argus.timing)
@@ -634,6 +626,20 @@ rocsparse_status testing_csr2csc(Arguments argus)
 
         printf("m\t\tn\t\tnnz\t\tmsec\n");
         printf("%8d\t%8d\t%9d\t%0.2lf\n", m, n, nnz, gpu_time_used);
+
+        // CSR is read and CSC written once
+        size_t bytes = sizeof(rocsparse_int) * (m + n + 2 + 2 * nnz) + sizeof(T) * 2 * nnz;
+
+        roofline_report(argus,
+                        {"csr2csc",
+                         roofline_precision<T>(),
+                         "csr",
+                         m,
+                         n,
+                         nnz,
+                         0.0,
+                         static_cast<double>(bytes),
+                         gpu_time_used});
     }
 
     return rocsparse_status_success;
@@ -409,55 +409,16 @@ rocsparse_status testing_csr2ell(Arguments argus)
 
     // Host structures
     std::vector<rocsparse_int> hcsr_row_ptr;
-    std::vector<rocsparse_int> hcoo_row_ind;
     std::vector<rocsparse_int> hcsr_col_ind;
     std::vector<T> hcsr_val;
 
     // Sample initial COO matrix on CPU
     srand(12345ULL);
-    if(binfile != "")
+    if(load_matrix_csr(
+           argus, binfile, filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, csr_base) !=
+       0)
     {
-        if(read_bin_matrix(
-               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, csr_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
-    }
-    else if(argus.laplacian)
-    {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, csr_base);
-        nnz   = hcsr_row_ptr[m];
-    }
-    else
-    {
-        if(filename != "")
-        {
-            if(read_mtx_matrix(
-                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, csr_base) !=
-               0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, csr_base);
-        }
-
-        // Convert COO to CSR
-        hcsr_row_ptr.resize(m + 1, 0);
-        for(rocsparse_int i = 0; i < nnz; ++i)
-        {
-            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - csr_base];
-        }
-
-        hcsr_row_ptr[0] = csr_base;
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
-        }
+        return rocsparse_status_internal_error;
     }
 
     // Allocate memory on the device
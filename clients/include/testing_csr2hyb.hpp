@@ -121,22 +121,6 @@ void testing_csr2hyb_bad_arg(void)
                                    rocsparse_hyb_partition_auto);
         verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
     }
-    // Testing for(csr_val == nullptr)
-    {
-        T* csr_val_null = nullptr;
-
-        status = rocsparse_csr2hyb(handle,
-                                   m,
-                                   n,
-                                   descr,
-                                   csr_val_null,
-                                   csr_row_ptr,
-                                   csr_col_ind,
-                                   hyb,
-                                   0,
-                                   rocsparse_hyb_partition_auto);
-        verify_rocsparse_status_invalid_pointer(status, "Error: csr_val is nullptr");
-    }
     // Testing for(handle == nullptr)
     {
         rocsparse_handle handle_null = nullptr;
@@ -240,55 +224,16 @@ rocsparse_status testing_csr2hyb(Arguments argus)
 
     // Host structures
     std::vector<rocsparse_int> hcsr_row_ptr;
-    std::vector<rocsparse_int> hcoo_row_ind;
     std::vector<rocsparse_int> hcsr_col_ind;
     std::vector<T> hcsr_val;
 
     // Sample initial COO matrix on CPU
     srand(12345ULL);
-    if(binfile != "")
+    if(load_matrix_csr(
+           argus, binfile, filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) !=
+       0)
     {
-        if(read_bin_matrix(
-               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
-    }
-    else if(argus.laplacian)
-    {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
-        nnz   = hcsr_row_ptr[m];
-    }
-    else
-    {
-        if(filename != "")
-        {
-            if(read_mtx_matrix(
-                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base) !=
-               0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
-        }
-
-        // Convert COO to CSR
-        hcsr_row_ptr.resize(m + 1, 0);
-        for(rocsparse_int i = 0; i < nnz; ++i)
-        {
-            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
-        }
-
-        hcsr_row_ptr[0] = idx_base;
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
-        }
+        return rocsparse_status_internal_error;
     }
 
     // Allocate memory on the device
@@ -507,6 +452,53 @@ rocsparse_status testing_csr2hyb(Arguments argus)
         unit_check_general(1, coo_nnz, 1, hhyb_coo_row_ind_gold.data(), hhyb_coo_row_ind.data());
         unit_check_general(1, coo_nnz, 1, hhyb_coo_col_ind_gold.data(), hhyb_coo_col_ind.data());
         unit_check_general(1, coo_nnz, 1, hhyb_coo_val_gold.data(), hhyb_coo_val.data());
+
+        // Pattern only matrix, the index structure is converted without any values
+        std::unique_ptr<hyb_struct> unique_ptr_hyb_pattern(new hyb_struct);
+        rocsparse_hyb_mat hyb_pattern = unique_ptr_hyb_pattern->hyb;
+
+        T* dcsr_val_null = nullptr;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb(handle,
+                                                m,
+                                                n,
+                                                descr,
+                                                dcsr_val_null,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                hyb_pattern,
+                                                user_ell_width,
+                                                part));
+
+        test_hyb* dhyb_pattern = (test_hyb*)hyb_pattern;
+
+        unit_check_general(1, 1, 1, &ell_width, &dhyb_pattern->ell_width);
+        unit_check_general(1, 1, 1, &ell_nnz, &dhyb_pattern->ell_nnz);
+        unit_check_general(1, 1, 1, &coo_nnz, &dhyb_pattern->coo_nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hhyb_ell_col_ind.data(),
+                                  dhyb_pattern->ell_col_ind,
+                                  sizeof(rocsparse_int) * ell_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hhyb_coo_row_ind.data(),
+                                  dhyb_pattern->coo_row_ind,
+                                  sizeof(rocsparse_int) * coo_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hhyb_coo_col_ind.data(),
+                                  dhyb_pattern->coo_col_ind,
+                                  sizeof(rocsparse_int) * coo_nnz,
+                                  hipMemcpyDeviceToHost));
+
+        unit_check_general(1, ell_nnz, 1, hhyb_ell_col_ind_gold.data(), hhyb_ell_col_ind.data());
+        unit_check_general(1, coo_nnz, 1, hhyb_coo_row_ind_gold.data(), hhyb_coo_row_ind.data());
+        unit_check_general(1, coo_nnz, 1, hhyb_coo_col_ind_gold.data(), hhyb_coo_col_ind.data());
+
+        // No values are stored for pattern only matrices
+        rocsparse_int zero = 0;
+        rocsparse_int val_arrays =
+            (dhyb_pattern->ell_val != nullptr) + (dhyb_pattern->coo_val != nullptr);
+
+        unit_check_general(1, 1, 1, &zero, &val_arrays);
     }
 
     if(argus.timing)
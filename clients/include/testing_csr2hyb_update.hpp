@@ -0,0 +1,407 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSR2HYB_UPDATE_HPP
+#define TESTING_CSR2HYB_UPDATE_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "testing_csr2hyb.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <rocsparse.h>
+#include <algorithm>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csr2hyb_update_bad_arg(void)
+{
+    rocsparse_int m         = 100;
+    rocsparse_int n         = 100;
+    rocsparse_int safe_size = 100;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<hyb_struct> unique_ptr_hyb(new hyb_struct);
+    rocsparse_hyb_mat hyb = unique_ptr_hyb->hyb;
+
+    // Set up a valid HYB matrix with a single entry per row
+    std::vector<rocsparse_int> hcsr_row_ptr(m + 1);
+    std::vector<rocsparse_int> hcsr_col_ind(m);
+    std::vector<T> hcsr_val(m, static_cast<T>(1));
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        hcsr_row_ptr[i] = i;
+        hcsr_col_ind[i] = i;
+    }
+    hcsr_row_ptr[m] = m;
+
+    auto csr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto csr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+    rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+    T* csr_val                 = (T*)csr_val_managed.get();
+
+    if(!csr_row_ptr || !csr_col_ind || !csr_val)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        csr_row_ptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        csr_col_ind, hcsr_col_ind.data(), sizeof(rocsparse_int) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(csr_val, hcsr_val.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Testing for(hyb not converted with value update mapping)
+    {
+        status = rocsparse_csr2hyb(handle,
+                                   m,
+                                   n,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   hyb,
+                                   0,
+                                   rocsparse_hyb_partition_auto);
+        verify_rocsparse_status_success(status, "csr2hyb without value update mapping");
+
+        status = rocsparse_csr2hyb_update(handle, csr_val, hyb);
+        verify_rocsparse_status_invalid_value(status, "Error: hyb has no value update mapping");
+    }
+
+    // Convert with value update mapping
+    status = rocsparse_set_hyb_mat_update(hyb, rocsparse_hyb_update_values);
+    verify_rocsparse_status_success(status, "rocsparse_set_hyb_mat_update");
+
+    status = rocsparse_csr2hyb(handle,
+                               m,
+                               n,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               hyb,
+                               0,
+                               rocsparse_hyb_partition_auto);
+    verify_rocsparse_status_success(status, "csr2hyb with value update mapping");
+
+    // Testing for(csr_val == nullptr)
+    {
+        T* csr_val_null = nullptr;
+
+        status = rocsparse_csr2hyb_update(handle, csr_val_null, hyb);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_val is nullptr");
+    }
+    // Testing for(hyb == nullptr)
+    {
+        rocsparse_hyb_mat hyb_null = nullptr;
+
+        status = rocsparse_csr2hyb_update(handle, csr_val, hyb_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: hyb is nullptr");
+    }
+    // Testing for(handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csr2hyb_update(handle_null, csr_val, hyb);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csr2hyb_update(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    rocsparse_int safe_size       = 100;
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_hyb_partition part  = argus.part;
+    rocsparse_int user_ell_width  = argus.ell_width;
+    std::string filename          = "";
+    rocsparse_status status;
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // HYB matrix with value update mapping
+    std::unique_ptr<hyb_struct> unique_ptr_hyb(new hyb_struct);
+    rocsparse_hyb_mat hyb = unique_ptr_hyb->hyb;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_hyb_mat_update(hyb, rocsparse_hyb_update_values));
+
+    // Reference HYB matrix, fully converted from the updated values
+    std::unique_ptr<hyb_struct> unique_ptr_hyb_gold(new hyb_struct);
+    rocsparse_hyb_mat hyb_gold = unique_ptr_hyb_gold->hyb;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto csr_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        T* csr_val = (T*)csr_val_managed.get();
+
+        if(!csr_val)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error, "!csr_val");
+            return rocsparse_status_memory_error;
+        }
+
+        // Empty HYB matrix is a quick return
+        status = rocsparse_csr2hyb_update(handle, csr_val, hyb);
+        verify_rocsparse_status_success(status, "empty hyb");
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Sample initial COO matrix on CPU
+    srand(12345ULL);
+    if(load_matrix_csr(
+           argus, "", filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) != 0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    // Updated values, sharing the sparsity pattern
+    std::vector<T> hcsr_val_update(nnz);
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        hcsr_val_update[i] = random_generator<T>();
+    }
+
+    // Allocate memory on the device
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcsr_val_update_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+    T* dcsr_val                 = (T*)dcsr_val_managed.get();
+    T* dcsr_val_update          = (T*)dcsr_val_update_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsr_val_update)
+    {
+        verify_rocsparse_status_success(
+            rocsparse_status_memory_error,
+            "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcsr_val_update");
+        return rocsparse_status_memory_error;
+    }
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_val_update, hcsr_val_update.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // User given ELL width, take a reasonable pre-computed width
+    if(part == rocsparse_hyb_partition_user)
+    {
+        user_ell_width = nnz / m;
+    }
+
+    // Initial conversion, skip matrices that cannot be converted with the given partition
+    status = rocsparse_csr2hyb(
+        handle, m, n, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, hyb, user_ell_width, part);
+
+    if(status == rocsparse_status_invalid_value)
+    {
+        return rocsparse_status_success;
+    }
+
+    CHECK_ROCSPARSE_ERROR(status);
+
+    if(argus.unit_check)
+    {
+        // Update values
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb_update(handle, dcsr_val_update, hyb));
+
+        // Full conversion of updated values
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb(handle,
+                                                m,
+                                                n,
+                                                descr,
+                                                dcsr_val_update,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                hyb_gold,
+                                                user_ell_width,
+                                                part));
+
+        test_hyb* dhyb      = (test_hyb*)hyb;
+        test_hyb* dhyb_gold = (test_hyb*)hyb_gold;
+
+        // Check if sizes match
+        unit_check_general(1, 1, 1, &dhyb_gold->ell_nnz, &dhyb->ell_nnz);
+        unit_check_general(1, 1, 1, &dhyb_gold->coo_nnz, &dhyb->coo_nnz);
+
+        rocsparse_int ell_nnz = dhyb->ell_nnz;
+        rocsparse_int coo_nnz = dhyb->coo_nnz;
+
+        std::vector<T> hhyb_ell_val(ell_nnz);
+        std::vector<T> hhyb_ell_val_gold(ell_nnz);
+        std::vector<T> hhyb_coo_val(coo_nnz);
+        std::vector<T> hhyb_coo_val_gold(coo_nnz);
+
+        // Copy output from device to host
+        CHECK_HIP_ERROR(hipMemcpy(
+            hhyb_ell_val.data(), dhyb->ell_val, sizeof(T) * ell_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hhyb_ell_val_gold.data(),
+                                  dhyb_gold->ell_val,
+                                  sizeof(T) * ell_nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hhyb_coo_val.data(), dhyb->coo_val, sizeof(T) * coo_nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hhyb_coo_val_gold.data(),
+                                  dhyb_gold->coo_val,
+                                  sizeof(T) * coo_nnz,
+                                  hipMemcpyDeviceToHost));
+
+        // Unit check
+        unit_check_general(1, ell_nnz, 1, hhyb_ell_val_gold.data(), hhyb_ell_val.data());
+        unit_check_general(1, coo_nnz, 1, hhyb_coo_val_gold.data(), hhyb_coo_val.data());
+    }
+
+    if(argus.timing)
+    {
+        rocsparse_int number_cold_calls = 2;
+        rocsparse_int number_hot_calls  = argus.iters;
+
+        // Full re-conversion
+        for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            rocsparse_csr2hyb(handle,
+                              m,
+                              n,
+                              descr,
+                              dcsr_val_update,
+                              dcsr_row_ptr,
+                              dcsr_col_ind,
+                              hyb_gold,
+                              user_ell_width,
+                              part);
+        }
+
+        double gpu_time_full = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_csr2hyb(handle,
+                              m,
+                              n,
+                              descr,
+                              dcsr_val_update,
+                              dcsr_row_ptr,
+                              dcsr_col_ind,
+                              hyb_gold,
+                              user_ell_width,
+                              part);
+        }
+
+        gpu_time_full = (get_time_us() - gpu_time_full) / (number_hot_calls * 1e3);
+
+        // Value only update
+        for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            rocsparse_csr2hyb_update(handle, dcsr_val_update, hyb);
+        }
+
+        double gpu_time_used = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_csr2hyb_update(handle, dcsr_val_update, hyb);
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // Gather reads the mapping and CSR values, and writes HYB values
+        test_hyb* dhyb        = (test_hyb*)hyb;
+        rocsparse_int hyb_nnz = dhyb->ell_nnz + dhyb->coo_nnz;
+
+        double bandwidth =
+            (sizeof(rocsparse_int) * hyb_nnz + sizeof(T) * (nnz + hyb_nnz)) / gpu_time_used / 1e6;
+
+        printf("m\t\tn\t\tnnz\t\tfull (msec)\tupdate (msec)\tspeedup\tGB/s\n");
+        printf("%8d\t%8d\t%9d\t%0.4lf\t\t%0.4lf\t\t%0.2lf\t%0.2lf\n",
+               m,
+               n,
+               nnz,
+               gpu_time_full,
+               gpu_time_used,
+               gpu_time_full / gpu_time_used,
+               bandwidth);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSR2HYB_UPDATE_HPP
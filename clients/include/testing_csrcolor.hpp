@@ -0,0 +1,848 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSRCOLOR_HPP
+#define TESTING_CSRCOLOR_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <rocsparse.h>
+#include <algorithm>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+void testing_csrcolor_bad_arg(void)
+{
+    rocsparse_int m         = 100;
+    rocsparse_int nnz       = 100;
+    rocsparse_int safe_size = 100;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    size_t buffer_size = 0;
+    rocsparse_int ncolors;
+
+    auto csr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto coloring_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto perm_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto buffer_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+    rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+    rocsparse_int* coloring    = (rocsparse_int*)coloring_managed.get();
+    rocsparse_int* perm        = (rocsparse_int*)perm_managed.get();
+    void* buffer               = (void*)buffer_managed.get();
+
+    if(!csr_row_ptr || !csr_col_ind || !coloring || !perm || !buffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Testing csrcolor_buffer_size for bad args
+
+    // Testing for (csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_csrcolor_buffer_size(
+            handle, m, nnz, csr_row_ptr_null, csr_col_ind, &buffer_size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+
+    // Testing for (csr_col_ind == nullptr)
+    {
+        rocsparse_int* csr_col_ind_null = nullptr;
+
+        status = rocsparse_csrcolor_buffer_size(
+            handle, m, nnz, csr_row_ptr, csr_col_ind_null, &buffer_size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+
+    // Testing for (buffer_size == nullptr)
+    {
+        size_t* buffer_size_null = nullptr;
+
+        status = rocsparse_csrcolor_buffer_size(
+            handle, m, nnz, csr_row_ptr, csr_col_ind, buffer_size_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: buffer_size is nullptr");
+    }
+
+    // Testing for (handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrcolor_buffer_size(
+            handle_null, m, nnz, csr_row_ptr, csr_col_ind, &buffer_size);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // Testing csrcolor for bad args
+
+    // Testing for (csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_csrcolor(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    csr_row_ptr_null,
+                                    csr_col_ind,
+                                    &ncolors,
+                                    coloring,
+                                    perm,
+                                    buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+
+    // Testing for (csr_col_ind == nullptr)
+    {
+        rocsparse_int* csr_col_ind_null = nullptr;
+
+        status = rocsparse_csrcolor(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    csr_row_ptr,
+                                    csr_col_ind_null,
+                                    &ncolors,
+                                    coloring,
+                                    perm,
+                                    buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+
+    // Testing for (ncolors == nullptr)
+    {
+        rocsparse_int* ncolors_null = nullptr;
+
+        status = rocsparse_csrcolor(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    ncolors_null,
+                                    coloring,
+                                    perm,
+                                    buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: ncolors is nullptr");
+    }
+
+    // Testing for (coloring == nullptr)
+    {
+        rocsparse_int* coloring_null = nullptr;
+
+        status = rocsparse_csrcolor(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    &ncolors,
+                                    coloring_null,
+                                    perm,
+                                    buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: coloring is nullptr");
+    }
+
+    // Testing for (buffer == nullptr)
+    {
+        void* buffer_null = nullptr;
+
+        status = rocsparse_csrcolor(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    &ncolors,
+                                    coloring,
+                                    perm,
+                                    buffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: buffer is nullptr");
+    }
+
+    // Testing for (descr == nullptr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrcolor(handle,
+                                    m,
+                                    nnz,
+                                    descr_null,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    &ncolors,
+                                    coloring,
+                                    perm,
+                                    buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+
+    // Testing for (handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrcolor(handle_null,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    &ncolors,
+                                    coloring,
+                                    perm,
+                                    buffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csrcolor(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.M;
+    rocsparse_int safe_size       = 100;
+    rocsparse_index_base idx_base = argus.idx_base;
+    std::string binfile           = "";
+    std::string filename          = "";
+    rocsparse_status status;
+
+    // When in testing mode, M == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m = n = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    size_t buffer_size = 0;
+
+    double scale = 0.02;
+    if(m > 1000)
+    {
+        scale = 2.0 / m;
+    }
+    rocsparse_int nnz = m * scale * m;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_mat_info->info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || nnz <= 0)
+    {
+        auto csr_row_ptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto csr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto coloring_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto buffer_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+        rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+        rocsparse_int* coloring    = (rocsparse_int*)coloring_managed.get();
+        void* buffer               = (void*)buffer_managed.get();
+
+        if(!csr_row_ptr || !csr_col_ind || !coloring || !buffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!csr_row_ptr || !csr_col_ind || !coloring || "
+                                            "!buffer");
+            return rocsparse_status_memory_error;
+        }
+
+        // Rows of a matrix without entries
+        CHECK_HIP_ERROR(hipMemset(csr_row_ptr, 0, sizeof(rocsparse_int) * safe_size));
+
+        status = rocsparse_csrcolor_buffer_size(
+            handle, m, nnz, csr_row_ptr, csr_col_ind, &buffer_size);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        rocsparse_int ncolors;
+        status = rocsparse_csrcolor(
+            handle, m, nnz, descr, csr_row_ptr, csr_col_ind, &ncolors, coloring, nullptr, buffer);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Sample initial COO matrix on CPU
+    srand(12345ULL);
+    if(load_matrix_csr(
+           argus, binfile, filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) !=
+       0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    // Symmetric permutations require square matrices
+    if(m != n)
+    {
+        fprintf(stderr, "csrcolor requires a square matrix, got %d x %d\n", m, n);
+        return rocsparse_status_invalid_size;
+    }
+
+    // Allocate memory on the device
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dcoloring_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * m), device_free};
+    auto dperm_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * m), device_free};
+    auto dncolors_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int)), device_free};
+    auto dx_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+    T* dcsr_val                 = (T*)dcsr_val_managed.get();
+    rocsparse_int* dcoloring    = (rocsparse_int*)dcoloring_managed.get();
+    rocsparse_int* dperm        = (rocsparse_int*)dperm_managed.get();
+    rocsparse_int* dncolors     = (rocsparse_int*)dncolors_managed.get();
+    T* dx                       = (T*)dx_managed.get();
+    T* dy                       = (T*)dy_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcoloring || !dperm || !dncolors || !dx ||
+       !dy)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || "
+                                        "!dcoloring || !dperm || !dncolors || !dx || !dy");
+        return rocsparse_status_memory_error;
+    }
+
+    std::vector<T> hx(m);
+    rocsparse_init<T>(hx, 1, m);
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    // Obtain buffer size, the buffer is shared by coloring, factorization and solve
+    size_t color_size;
+    size_t ilu_size;
+    size_t sv_size;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor_buffer_size(
+        handle, m, nnz, dcsr_row_ptr, dcsr_col_ind, &color_size));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size(
+        handle, m, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info, &ilu_size));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size(handle,
+                                                      rocsparse_operation_none,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      &sv_size));
+
+    buffer_size = std::max(color_size, std::max(ilu_size, sv_size));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(char) * buffer_size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    if(argus.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int hncolors_1;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor(handle,
+                                                 m,
+                                                 nnz,
+                                                 descr,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 &hncolors_1,
+                                                 dcoloring,
+                                                 dperm,
+                                                 dbuffer));
+
+        // Pointer mode device, without permutation
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor(handle,
+                                                 m,
+                                                 nnz,
+                                                 descr,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 dncolors,
+                                                 dcoloring,
+                                                 nullptr,
+                                                 dbuffer));
+
+        // Copy output from device to host
+        rocsparse_int hncolors_2;
+        std::vector<rocsparse_int> hcoloring(m);
+        std::vector<rocsparse_int> hperm(m);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hncolors_2, dncolors, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hcoloring.data(), dcoloring, sizeof(rocsparse_int) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hperm.data(), dperm, sizeof(rocsparse_int) * m, hipMemcpyDeviceToHost));
+
+        // The coloring is deterministic
+        unit_check_general(1, 1, 1, &hncolors_1, &hncolors_2);
+
+        // Every color is used and coupled rows have different colors
+        std::vector<rocsparse_int> hcolor_count(hncolors_1, 0);
+        rocsparse_int conflicts = 0;
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            if(hcoloring[i] < 0 || hcoloring[i] >= hncolors_1)
+            {
+                ++conflicts;
+                continue;
+            }
+
+            ++hcolor_count[hcoloring[i]];
+
+            for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base;
+                ++j)
+            {
+                rocsparse_int col = hcsr_col_ind[j] - idx_base;
+
+                if(col != i && hcoloring[col] == hcoloring[i])
+                {
+                    ++conflicts;
+                }
+            }
+        }
+
+        rocsparse_int empty_colors = std::count(hcolor_count.begin(), hcolor_count.end(), 0);
+        rocsparse_int zero         = 0;
+
+        unit_check_general(1, 1, 1, &zero, &conflicts);
+        unit_check_general(1, 1, 1, &zero, &empty_colors);
+
+        // Rows are sorted by color, keeping their order within a color
+        std::vector<rocsparse_int> hperm_gold(m);
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hperm_gold[i] = i;
+        }
+
+        std::stable_sort(hperm_gold.begin(),
+                         hperm_gold.end(),
+                         [&hcoloring](rocsparse_int a, rocsparse_int b) {
+                             return hcoloring[a] < hcoloring[b];
+                         });
+
+        unit_check_general(1, m, 1, hperm_gold.data(), hperm.data());
+
+        // Host permutation B = P * A * P^T
+        std::vector<rocsparse_int> hinvperm(m);
+        std::vector<rocsparse_int> hcsr_row_ptr_B(m + 1);
+        std::vector<rocsparse_int> hcsr_col_ind_B(nnz);
+        std::vector<rocsparse_int> hmap(nnz);
+        std::vector<T> hcsr_val_B(nnz);
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hinvperm[hperm[i]] = i;
+        }
+
+        hcsr_row_ptr_B[0] = idx_base;
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            rocsparse_int row_begin = hcsr_row_ptr[hperm[i]] - idx_base;
+            rocsparse_int row_end   = hcsr_row_ptr[hperm[i] + 1] - idx_base;
+            rocsparse_int offset    = hcsr_row_ptr_B[i] - idx_base;
+
+            std::vector<std::pair<rocsparse_int, rocsparse_int>> row;
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                row.push_back(std::make_pair(hinvperm[hcsr_col_ind[j] - idx_base], j));
+            }
+
+            std::sort(row.begin(), row.end());
+
+            for(size_t k = 0; k < row.size(); ++k)
+            {
+                hcsr_col_ind_B[offset + k] = row[k].first + idx_base;
+                hmap[offset + k]           = row[k].second;
+                hcsr_val_B[offset + k]     = hcsr_val[row[k].second];
+            }
+
+            hcsr_row_ptr_B[i + 1] = hcsr_row_ptr_B[i] + row_end - row_begin;
+        }
+
+        // Multicolor csrilu0, factors of B are returned in the layout of A
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                         m,
+                                                         nnz,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         info,
+                                                         rocsparse_analysis_policy_force,
+                                                         rocsparse_solve_policy_multicolor,
+                                                         dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(handle,
+                                                m,
+                                                nnz,
+                                                descr,
+                                                dcsr_val,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                info,
+                                                rocsparse_solve_policy_multicolor,
+                                                dbuffer));
+
+        rocsparse_int hposition;
+        rocsparse_status pivot_status = rocsparse_csrilu0_zero_pivot(handle, info, &hposition);
+
+        // Host csrilu0 of B
+        rocsparse_int position_gold = csrilu0(
+            m, hcsr_row_ptr_B.data(), hcsr_col_ind_B.data(), hcsr_val_B.data(), idx_base);
+
+        if(position_gold != -1)
+        {
+            verify_rocsparse_status_zero_pivot(pivot_status,
+                                               "expected rocsparse_status_zero_pivot");
+            return rocsparse_status_success;
+        }
+
+        std::vector<T> hcsr_val_gold(nnz);
+        std::vector<T> result(nnz);
+
+        for(rocsparse_int k = 0; k < nnz; ++k)
+        {
+            hcsr_val_gold[hmap[k]] = hcsr_val_B[k];
+        }
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(result.data(), dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        unit_check_general(1, 1, 1, &position_gold, &hposition);
+        unit_check_general(1, nnz, 1, hcsr_val_gold.data(), result.data());
+
+        // Multicolor lower triangular solve with the unit diagonal factor L of B
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit));
+
+        T h_alpha = static_cast<T>(1);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                       rocsparse_operation_none,
+                                                       m,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       info,
+                                                       rocsparse_analysis_policy_reuse,
+                                                       rocsparse_solve_policy_multicolor,
+                                                       dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve(handle,
+                                                    rocsparse_operation_none,
+                                                    m,
+                                                    nnz,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    info,
+                                                    dx,
+                                                    dy,
+                                                    rocsparse_solve_policy_multicolor,
+                                                    dbuffer));
+
+        // Host solve with B, P * y = L^-1 * P * x
+        hipDeviceProp_t prop;
+        hipGetDeviceProperties(&prop, 0);
+
+        std::vector<T> hx_B(m);
+        std::vector<T> hy_B(m);
+        std::vector<T> hy_gold(m);
+        std::vector<T> hy(m);
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hx_B[i] = hx[hperm[i]];
+        }
+
+        lsolve(m,
+               hcsr_row_ptr_B.data(),
+               hcsr_col_ind_B.data(),
+               hcsr_val_B.data(),
+               h_alpha,
+               hx_B.data(),
+               hy_B.data(),
+               idx_base,
+               rocsparse_diag_type_unit,
+               prop.warpSize);
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hy_gold[hperm[i]] = hy_B[i];
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info));
+    }
+
+    if(argus.timing)
+    {
+        rocsparse_int number_cold_calls = 2;
+        rocsparse_int number_hot_calls  = argus.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Coloring, blocking with respect to the host
+        rocsparse_int ncolors;
+        double gpu_time_used = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_csrcolor(handle,
+                               m,
+                               nnz,
+                               descr,
+                               dcsr_row_ptr,
+                               dcsr_col_ind,
+                               &ncolors,
+                               dcoloring,
+                               dperm,
+                               dbuffer);
+        }
+
+        double color_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // Factorization and lower triangular solve for both policies
+        rocsparse_solve_policy policies[] = {rocsparse_solve_policy_auto,
+                                             rocsparse_solve_policy_multicolor};
+        double ilu_time_used[2];
+        double sv_time_used[2];
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit));
+
+        T h_alpha = static_cast<T>(1);
+
+        for(int p = 0; p < 2; ++p)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                             m,
+                                                             nnz,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             info,
+                                                             rocsparse_analysis_policy_reuse,
+                                                             policies[p],
+                                                             dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                           rocsparse_operation_none,
+                                                           m,
+                                                           nnz,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info,
+                                                           rocsparse_analysis_policy_reuse,
+                                                           policies[p],
+                                                           dbuffer));
+
+            // Warm up
+            for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
+            {
+                rocsparse_csrilu0(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  dcsr_val,
+                                  dcsr_row_ptr,
+                                  dcsr_col_ind,
+                                  info,
+                                  policies[p],
+                                  dbuffer);
+                rocsparse_csrsv_solve(handle,
+                                      rocsparse_operation_none,
+                                      m,
+                                      nnz,
+                                      &h_alpha,
+                                      descr,
+                                      dcsr_val,
+                                      dcsr_row_ptr,
+                                      dcsr_col_ind,
+                                      info,
+                                      dx,
+                                      dy,
+                                      policies[p],
+                                      dbuffer);
+            }
+
+            gpu_time_used = get_time_us();
+
+            for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                rocsparse_csrilu0(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  dcsr_val,
+                                  dcsr_row_ptr,
+                                  dcsr_col_ind,
+                                  info,
+                                  policies[p],
+                                  dbuffer);
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            ilu_time_used[p] = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+            gpu_time_used = get_time_us();
+
+            for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                rocsparse_csrsv_solve(handle,
+                                      rocsparse_operation_none,
+                                      m,
+                                      nnz,
+                                      &h_alpha,
+                                      descr,
+                                      dcsr_val,
+                                      dcsr_row_ptr,
+                                      dcsr_col_ind,
+                                      info,
+                                      dx,
+                                      dy,
+                                      policies[p],
+                                      dbuffer);
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            sv_time_used[p] = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+        }
+
+        printf("m\t\tnnz\t\tcolors\t\tcolor msec\n");
+        printf("%8d\t%9d\t%8d\t%0.2lf\n", m, nnz, ncolors, color_time_used);
+
+        printf("policy\t\tcsrilu0 msec\tcsrsv msec\n");
+        printf("auto\t\t%0.2lf\t\t%0.2lf\n", ilu_time_used[0], sv_time_used[0]);
+        printf("multicolor\t%0.2lf\t\t%0.2lf\n", ilu_time_used[1], sv_time_used[1]);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRCOLOR_HPP
@@ -0,0 +1,707 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSRILU0_ITERATIVE_HPP
+#define TESTING_CSRILU0_ITERATIVE_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <rocsparse.h>
+#include <algorithm>
+#include <string>
+#include <type_traits>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+void testing_csrilu0_iterative_bad_arg(void)
+{
+    rocsparse_int safe_size = 100;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_mat_info->info;
+
+    std::vector<double> history(safe_size);
+    rocsparse_int csrilu0_sweeps;
+    rocsparse_int csrsv_sweeps;
+
+    // testing rocsparse_set_mat_info_sweeps
+
+    // testing for(nullptr == info)
+    {
+        status = rocsparse_set_mat_info_sweeps(nullptr, 1, 1);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(csrilu0_sweeps < 1)
+    {
+        status = rocsparse_set_mat_info_sweeps(info, 0, 1);
+        verify_rocsparse_status_invalid_size(status, "Error: csrilu0_sweeps < 1");
+    }
+    // testing for(csrsv_sweeps < 1)
+    {
+        status = rocsparse_set_mat_info_sweeps(info, 1, 0);
+        verify_rocsparse_status_invalid_size(status, "Error: csrsv_sweeps < 1");
+    }
+
+    // testing rocsparse_get_mat_info_sweeps
+
+    // testing for(nullptr == info)
+    {
+        status = rocsparse_get_mat_info_sweeps(nullptr, &csrilu0_sweeps, &csrsv_sweeps);
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == csrilu0_sweeps)
+    {
+        status = rocsparse_get_mat_info_sweeps(info, nullptr, &csrsv_sweeps);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csrilu0_sweeps is nullptr");
+    }
+    // testing for(nullptr == csrsv_sweeps)
+    {
+        status = rocsparse_get_mat_info_sweeps(info, &csrilu0_sweeps, nullptr);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csrsv_sweeps is nullptr");
+    }
+
+    // Invalid sweeps do not modify the info structure
+    {
+        status = rocsparse_set_mat_info_sweeps(info, 7, 4);
+        verify_rocsparse_status_success(status, "csrilu0_sweeps >= 1 && csrsv_sweeps >= 1");
+
+        status = rocsparse_set_mat_info_sweeps(info, -1, 2);
+        verify_rocsparse_status_invalid_size(status, "Error: csrilu0_sweeps < 1");
+
+        status = rocsparse_get_mat_info_sweeps(info, &csrilu0_sweeps, &csrsv_sweeps);
+        verify_rocsparse_status_success(status, "info, csrilu0_sweeps and csrsv_sweeps are valid");
+
+        rocsparse_int hsweeps[2]      = {csrilu0_sweeps, csrsv_sweeps};
+        rocsparse_int hsweeps_gold[2] = {7, 4};
+
+        unit_check_general(1, 2, 1, hsweeps_gold, hsweeps);
+    }
+
+    // testing rocsparse_csrilu0_convergence
+
+    // testing for(nullptr == handle)
+    {
+        status = rocsparse_csrilu0_convergence(nullptr, info, history.data());
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for(nullptr == info)
+    {
+        status = rocsparse_csrilu0_convergence(handle, nullptr, history.data());
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == history)
+    {
+        status = rocsparse_csrilu0_convergence(handle, info, nullptr);
+        verify_rocsparse_status_invalid_pointer(status, "Error: history is nullptr");
+    }
+
+    // testing rocsparse_csrsv_convergence
+
+    // testing for(nullptr == handle)
+    {
+        status = rocsparse_csrsv_convergence(nullptr, descr, info, history.data());
+        verify_rocsparse_status_invalid_handle(status);
+    }
+    // testing for(nullptr == descr)
+    {
+        status = rocsparse_csrsv_convergence(handle, nullptr, info, history.data());
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == info)
+    {
+        status = rocsparse_csrsv_convergence(handle, descr, nullptr, history.data());
+        verify_rocsparse_status_invalid_pointer(status, "Error: info is nullptr");
+    }
+    // testing for(nullptr == history)
+    {
+        status = rocsparse_csrsv_convergence(handle, descr, info, nullptr);
+        verify_rocsparse_status_invalid_pointer(status, "Error: history is nullptr");
+    }
+
+    // Without iterative computation, the history is zero
+    {
+        status = rocsparse_csrilu0_convergence(handle, info, history.data());
+        verify_rocsparse_status_success(status, "handle, info and history are valid");
+
+        std::vector<double> history_gold(csrilu0_sweeps, 0.0);
+        unit_check_general(1, csrilu0_sweeps, 1, history_gold.data(), history.data());
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csrilu0_iterative(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.M;
+    rocsparse_int safe_size       = 100;
+    rocsparse_index_base idx_base = argus.idx_base;
+    std::string filename          = "";
+    rocsparse_status status;
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    double scale = 0.02;
+    if(m > 1000)
+    {
+        scale = 2.0 / m;
+    }
+    rocsparse_int nnz = m * scale * m;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_mat_info->info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Argument sanity check before allocating invalid memory
+    if((m <= 0 || nnz <= 0) && argus.laplacian == 0)
+    {
+        auto csr_row_ptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto csr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto csr_val_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto buffer_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+        rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+        T* csr_val                 = (T*)csr_val_managed.get();
+        void* buffer               = (void*)buffer_managed.get();
+
+        if(!csr_row_ptr || !csr_col_ind || !csr_val || !buffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!csr_row_ptr || !csr_col_ind || !csr_val || "
+                                            "!buffer");
+            return rocsparse_status_memory_error;
+        }
+
+        status = rocsparse_csrilu0_analysis(handle,
+                                            m,
+                                            nnz,
+                                            descr,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            info,
+                                            rocsparse_analysis_policy_reuse,
+                                            rocsparse_solve_policy_iterative,
+                                            buffer);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        status = rocsparse_csrilu0(handle,
+                                   m,
+                                   nnz,
+                                   descr,
+                                   csr_val,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   info,
+                                   rocsparse_solve_policy_iterative,
+                                   buffer);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Sample initial COO matrix on CPU
+    srand(12345ULL);
+    if(load_matrix_csr(
+           argus, "", filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) != 0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    // Incomplete LU factorization requires square matrices
+    if(m != n)
+    {
+        fprintf(stderr, "csrilu0 requires a square matrix, got %d x %d\n", m, n);
+        return rocsparse_status_invalid_size;
+    }
+
+    // Allocate memory on the device
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed       = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed       = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dalpha_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dcsr_row_ptr = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_col_ind = (rocsparse_int*)dcsr_col_ind_managed.get();
+    T* dcsr_val                 = (T*)dcsr_val_managed.get();
+    T* dx                       = (T*)dx_managed.get();
+    T* dy                       = (T*)dy_managed.get();
+    T* dalpha                   = (T*)dalpha_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dx || !dy || !dalpha)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || "
+                                        "!dx || !dy || !dalpha");
+        return rocsparse_status_memory_error;
+    }
+
+    std::vector<T> hx(m);
+    rocsparse_init<T>(hx, 1, m);
+
+    T h_alpha = static_cast<T>(argus.alpha);
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // Obtain buffer size, the buffer is shared by factorization and solve
+    size_t ilu_size;
+    size_t sv_size;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size(
+        handle, m, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info, &ilu_size));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size(handle,
+                                                      rocsparse_operation_none,
+                                                      m,
+                                                      nnz,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      &sv_size));
+
+    size_t buffer_size = std::max(ilu_size, sv_size);
+
+    // Allocate buffer on the device
+    auto dbuffer_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(char) * buffer_size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    if(argus.unit_check)
+    {
+        // The fixed-point iterations reach the exact factors and solutions after at
+        // most m sweeps, such that the last sweep does not update them anymore
+        rocsparse_int sweeps = m + 1;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_info_sweeps(info, sweeps, sweeps));
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                         m,
+                                                         nnz,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         info,
+                                                         rocsparse_analysis_policy_reuse,
+                                                         rocsparse_solve_policy_iterative,
+                                                         dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0(handle,
+                                                m,
+                                                nnz,
+                                                descr,
+                                                dcsr_val,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                info,
+                                                rocsparse_solve_policy_iterative,
+                                                dbuffer));
+
+        rocsparse_int hposition;
+        rocsparse_status pivot_status = rocsparse_csrilu0_zero_pivot(handle, info, &hposition);
+
+        // Host csrilu0
+        std::vector<T> hcsr_val_gold(hcsr_val);
+
+        rocsparse_int position_gold =
+            csrilu0(m, hcsr_row_ptr.data(), hcsr_col_ind.data(), hcsr_val_gold.data(), idx_base);
+
+        // Zero pivots might be encountered in different order by the sweeps
+        if(position_gold != -1)
+        {
+            verify_rocsparse_status_zero_pivot(pivot_status,
+                                               "expected rocsparse_status_zero_pivot");
+            return rocsparse_status_success;
+        }
+
+        std::vector<T> result(nnz);
+        std::vector<double> hhistory(sweeps);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(result.data(), dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_convergence(handle, info, hhistory.data()));
+
+        unit_check_general(1, 1, 1, &position_gold, &hposition);
+        unit_check_near(1, nnz, 1, hcsr_val_gold.data(), result.data());
+
+        // The last sweep does not change the factors anymore
+        double zero  = 0.0;
+        double bound = std::is_same<T, float>::value ? 1e-4 : 1e-10;
+
+        unit_check_bound(1, &zero, &hhistory[sweeps - 1], &bound);
+
+        // Pointer mode device, lower triangular solve with the unit diagonal factor L
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                       rocsparse_operation_none,
+                                                       m,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       info,
+                                                       rocsparse_analysis_policy_reuse,
+                                                       rocsparse_solve_policy_iterative,
+                                                       dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve(handle,
+                                                    rocsparse_operation_none,
+                                                    m,
+                                                    nnz,
+                                                    dalpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    info,
+                                                    dx,
+                                                    dy,
+                                                    rocsparse_solve_policy_iterative,
+                                                    dbuffer));
+
+        auto dhistory_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(double) * sweeps), device_free};
+        double* dhistory = (double*)dhistory_managed.get();
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_convergence(handle, descr, info, dhistory));
+
+        // Host lower triangular solve
+        hipDeviceProp_t prop;
+        hipGetDeviceProperties(&prop, 0);
+
+        std::vector<T> hy_gold(m);
+        std::vector<T> hy(m);
+
+        lsolve(m,
+               hcsr_row_ptr.data(),
+               hcsr_col_ind.data(),
+               hcsr_val_gold.data(),
+               h_alpha,
+               hx.data(),
+               hy_gold.data(),
+               idx_base,
+               rocsparse_diag_type_unit,
+               prop.warpSize);
+
+        CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(
+            hhistory.data(), dhistory, sizeof(double) * sweeps, hipMemcpyDeviceToHost));
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy.data());
+        unit_check_bound(1, &zero, &hhistory[sweeps - 1], &bound);
+
+        // Pointer mode host, upper triangular solve with the factor U
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_upper));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_non_unit));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                       rocsparse_operation_none,
+                                                       m,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       info,
+                                                       rocsparse_analysis_policy_reuse,
+                                                       rocsparse_solve_policy_iterative,
+                                                       dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve(handle,
+                                                    rocsparse_operation_none,
+                                                    m,
+                                                    nnz,
+                                                    &h_alpha,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    info,
+                                                    dy,
+                                                    dx,
+                                                    rocsparse_solve_policy_iterative,
+                                                    dbuffer));
+
+        rocsparse_int hposition_sv;
+        pivot_status = rocsparse_csrsv_zero_pivot(handle, descr, info, &hposition_sv);
+
+        // Host upper triangular solve
+        std::vector<T> hz_gold(m);
+        std::vector<T> hz(m);
+
+        position_gold = usolve(m,
+                               hcsr_row_ptr.data(),
+                               hcsr_col_ind.data(),
+                               hcsr_val_gold.data(),
+                               h_alpha,
+                               hy_gold.data(),
+                               hz_gold.data(),
+                               idx_base,
+                               rocsparse_diag_type_non_unit,
+                               prop.warpSize);
+
+        if(position_gold != -1)
+        {
+            verify_rocsparse_status_zero_pivot(pivot_status,
+                                               "expected rocsparse_status_zero_pivot");
+            return rocsparse_status_success;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(hz.data(), dx, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_convergence(handle, descr, info, hhistory.data()));
+
+        unit_check_general(1, 1, 1, &position_gold, &hposition_sv);
+        unit_check_near(1, m, 1, hz_gold.data(), hz.data());
+        unit_check_bound(1, &zero, &hhistory[sweeps - 1], &bound);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info));
+    }
+
+    if(argus.timing)
+    {
+        rocsparse_int number_cold_calls = 2;
+        rocsparse_int number_hot_calls  = argus.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Number of sweeps, library defaults are kept if not specified
+        rocsparse_int ilu_sweeps;
+        rocsparse_int sv_sweeps;
+
+        if(argus.sweeps > 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_info_sweeps(info, argus.sweeps, argus.sweeps));
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_mat_info_sweeps(info, &ilu_sweeps, &sv_sweeps));
+
+        // Factorization and lower triangular solve for both policies
+        rocsparse_solve_policy policies[] = {rocsparse_solve_policy_auto,
+                                             rocsparse_solve_policy_iterative};
+        double ilu_time_used[2];
+        double sv_time_used[2];
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, rocsparse_fill_mode_lower));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr, rocsparse_diag_type_unit));
+
+        for(int p = 0; p < 2; ++p)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                             m,
+                                                             nnz,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             info,
+                                                             rocsparse_analysis_policy_reuse,
+                                                             policies[p],
+                                                             dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                           rocsparse_operation_none,
+                                                           m,
+                                                           nnz,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info,
+                                                           rocsparse_analysis_policy_reuse,
+                                                           policies[p],
+                                                           dbuffer));
+
+            // Warm up
+            for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
+            {
+                rocsparse_csrilu0(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  dcsr_val,
+                                  dcsr_row_ptr,
+                                  dcsr_col_ind,
+                                  info,
+                                  policies[p],
+                                  dbuffer);
+                rocsparse_csrsv_solve(handle,
+                                      rocsparse_operation_none,
+                                      m,
+                                      nnz,
+                                      &h_alpha,
+                                      descr,
+                                      dcsr_val,
+                                      dcsr_row_ptr,
+                                      dcsr_col_ind,
+                                      info,
+                                      dx,
+                                      dy,
+                                      policies[p],
+                                      dbuffer);
+            }
+
+            double gpu_time_used = get_time_us();
+
+            for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                rocsparse_csrilu0(handle,
+                                  m,
+                                  nnz,
+                                  descr,
+                                  dcsr_val,
+                                  dcsr_row_ptr,
+                                  dcsr_col_ind,
+                                  info,
+                                  policies[p],
+                                  dbuffer);
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            ilu_time_used[p] = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+            gpu_time_used = get_time_us();
+
+            for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                rocsparse_csrsv_solve(handle,
+                                      rocsparse_operation_none,
+                                      m,
+                                      nnz,
+                                      &h_alpha,
+                                      descr,
+                                      dcsr_val,
+                                      dcsr_row_ptr,
+                                      dcsr_col_ind,
+                                      info,
+                                      dx,
+                                      dy,
+                                      policies[p],
+                                      dbuffer);
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            sv_time_used[p] = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+        }
+
+        // Relative update of the last sweep
+        std::vector<double> ilu_history(ilu_sweeps);
+        std::vector<double> sv_history(sv_sweeps);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_convergence(handle, info, ilu_history.data()));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_convergence(handle, descr, info, sv_history.data()));
+
+        printf("m\t\tnnz\t\tilu sweeps\tsv sweeps\n");
+        printf("%8d\t%9d\t%8d\t%8d\n", m, nnz, ilu_sweeps, sv_sweeps);
+
+        printf("policy\t\tcsrilu0 msec\tcsrsv msec\tilu update\tsv update\n");
+        printf("auto\t\t%0.2lf\t\t%0.2lf\n", ilu_time_used[0], sv_time_used[0]);
+        printf("iterative\t%0.2lf\t\t%0.2lf\t\t%0.2e\t%0.2e\n",
+               ilu_time_used[1],
+               sv_time_used[1],
+               ilu_history[ilu_sweeps - 1],
+               sv_history[sv_sweeps - 1]);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRILU0_ITERATIVE_HPP
@@ -0,0 +1,559 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRILU0_MIXED_HPP
+#define TESTING_CSRILU0_MIXED_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <cmath>
+#include <string>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+inline void testing_csrilu0_mixed_bad_arg(void)
+{
+    rocsparse_int m         = 100;
+    rocsparse_int nnz       = 100;
+    rocsparse_int safe_size = 100;
+    rocsparse_int max_iter  = 10;
+    double tol              = 1e-12;
+    rocsparse_int iter;
+    double res;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_mat_info->info;
+
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(double) * safe_size), device_free};
+    auto db_managed = rocsparse_unique_ptr{device_malloc(sizeof(double) * safe_size), device_free};
+    auto dx_managed = rocsparse_unique_ptr{device_malloc(sizeof(double) * safe_size), device_free};
+    auto dbuffer_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    double* dval        = (double*)dval_managed.get();
+    double* db          = (double*)db_managed.get();
+    double* dx          = (double*)dx_managed.get();
+    void* dbuffer       = (void*)dbuffer_managed.get();
+
+    if(!dval || !dptr || !dcol || !db || !dx || !dbuffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_dscsrilu0 without csrilu0 analysis
+    {
+        status = rocsparse_dscsrilu0(
+            handle, m, nnz, descr, dval, dptr, dcol, info, rocsparse_solve_policy_auto, dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csrilu0 analysis is missing");
+    }
+
+    // testing rocsparse_dscsrilu0 for(nullptr == dval)
+    {
+        double* dval_null = nullptr;
+
+        status = rocsparse_dscsrilu0(handle,
+                                     m,
+                                     nnz,
+                                     descr,
+                                     dval_null,
+                                     dptr,
+                                     dcol,
+                                     info,
+                                     rocsparse_solve_policy_auto,
+                                     dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+
+    // testing rocsparse_dscsrilu0 for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_dscsrilu0(handle_null,
+                                     m,
+                                     nnz,
+                                     descr,
+                                     dval,
+                                     dptr,
+                                     dcol,
+                                     info,
+                                     rocsparse_solve_policy_auto,
+                                     dbuffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_dscsrilu0_solve without factorization
+    {
+        status = rocsparse_dscsrilu0_solve(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           dval,
+                                           dptr,
+                                           dcol,
+                                           info,
+                                           db,
+                                           dx,
+                                           max_iter,
+                                           tol,
+                                           &iter,
+                                           &res,
+                                           rocsparse_solve_policy_auto,
+                                           dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: factors are missing");
+    }
+
+    // testing rocsparse_dscsrilu0_solve for(nullptr == db)
+    {
+        double* db_null = nullptr;
+
+        status = rocsparse_dscsrilu0_solve(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           dval,
+                                           dptr,
+                                           dcol,
+                                           info,
+                                           db_null,
+                                           dx,
+                                           max_iter,
+                                           tol,
+                                           &iter,
+                                           &res,
+                                           rocsparse_solve_policy_auto,
+                                           dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: db is nullptr");
+    }
+
+    // testing rocsparse_dscsrilu0_solve for(max_iter < 0)
+    {
+        status = rocsparse_dscsrilu0_solve(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           dval,
+                                           dptr,
+                                           dcol,
+                                           info,
+                                           db,
+                                           dx,
+                                           -1,
+                                           tol,
+                                           &iter,
+                                           &res,
+                                           rocsparse_solve_policy_auto,
+                                           dbuffer);
+        verify_rocsparse_status_invalid_size(status, "Error: max_iter is invalid");
+    }
+
+    // testing rocsparse_dscsrilu0_solve for(nullptr == iter)
+    {
+        rocsparse_int* iter_null = nullptr;
+
+        status = rocsparse_dscsrilu0_solve(handle,
+                                           m,
+                                           nnz,
+                                           descr,
+                                           dval,
+                                           dptr,
+                                           dcol,
+                                           info,
+                                           db,
+                                           dx,
+                                           max_iter,
+                                           tol,
+                                           iter_null,
+                                           &res,
+                                           rocsparse_solve_policy_auto,
+                                           dbuffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: iter is nullptr");
+    }
+}
+
+inline rocsparse_status testing_csrilu0_mixed(Arguments argus)
+{
+    rocsparse_int ndim            = argus.laplacian;
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int max_iter        = 100;
+    double tol                    = 1e-12;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr_M(new descr_struct);
+    rocsparse_mat_descr descr_M = test_descr_M->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = unique_ptr_mat_info->info;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_M, idx_base));
+
+    // The test system is a shifted 2D laplacian
+    if(ndim <= 0)
+    {
+        fprintf(stderr, "csrilu0_mixed requires a laplacian dimension\n");
+        return rocsparse_status_invalid_size;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<double> hcsr_val;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    rocsparse_int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    // Shift the diagonal, such that ILU0 is a good approximation for refinement
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base;
+            ++j)
+        {
+            if(hcsr_col_ind[j] - idx_base == i)
+            {
+                hcsr_val[j] += 4.0;
+            }
+        }
+    }
+
+    // Right-hand side of a known solution
+    std::vector<double> hx_gold(m);
+    std::vector<double> hb(m, 0.0);
+    std::vector<double> hx(m, 0.0);
+
+    rocsparse_init<double>(hx_gold, 1, m);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base;
+            ++j)
+        {
+            hb[i] += hcsr_val[j] * hx_gold[hcsr_col_ind[j] - idx_base];
+        }
+    }
+
+    // Allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(double) * nnz), device_free};
+    auto db_managed   = rocsparse_unique_ptr{device_malloc(sizeof(double) * m), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(double) * m), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    double* dval        = (double*)dval_managed.get();
+    double* db          = (double*)db_managed.get();
+    double* dx          = (double*)dx_managed.get();
+
+    if(!dval || !dptr || !dcol || !db || !dx)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !db || !dx");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(double) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(db, hb.data(), sizeof(double) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(double) * m, hipMemcpyHostToDevice));
+
+    // Create matrix descriptors for the triangular analysis
+    std::unique_ptr<descr_struct> test_descr_L(new descr_struct);
+    rocsparse_mat_descr descr_L = test_descr_L->descr;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_L, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit));
+
+    std::unique_ptr<descr_struct> test_descr_U(new descr_struct);
+    rocsparse_mat_descr descr_U = test_descr_U->descr;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_U, idx_base));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit));
+
+    // Obtain buffer sizes
+    size_t size_ilu, size_lower, size_upper, size_solve;
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csrilu0_buffer_size(handle, m, nnz, descr_M, dval, dptr, dcol, info, &size_ilu));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size(
+        handle, rocsparse_operation_none, m, nnz, descr_L, dval, dptr, dcol, info, &size_lower));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size(
+        handle, rocsparse_operation_none, m, nnz, descr_U, dval, dptr, dcol, info, &size_upper));
+    CHECK_ROCSPARSE_ERROR(rocsparse_dscsrilu0_solve_buffer_size(
+        handle, m, nnz, descr_M, dval, dptr, dcol, info, &size_solve));
+
+    size_t size = std::max(size_ilu, std::max(size_lower, size_upper));
+
+    // Allocate buffers on the device
+    auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(sizeof(char) * size), device_free};
+    auto dsolve_buffer_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(char) * size_solve), device_free};
+
+    void* dbuffer       = (void*)dbuffer_managed.get();
+    void* dsolve_buffer = (void*)dsolve_buffer_managed.get();
+
+    if(!dbuffer || !dsolve_buffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dbuffer || !dsolve_buffer");
+        return rocsparse_status_memory_error;
+    }
+
+    // Analysis is performed in double precision only, its meta data is shared with the
+    // single precision factorization and triangular solves
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis(handle,
+                                                     m,
+                                                     nnz,
+                                                     descr_M,
+                                                     dval,
+                                                     dptr,
+                                                     dcol,
+                                                     info,
+                                                     rocsparse_analysis_policy_reuse,
+                                                     rocsparse_solve_policy_auto,
+                                                     dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                   rocsparse_operation_none,
+                                                   m,
+                                                   nnz,
+                                                   descr_L,
+                                                   dval,
+                                                   dptr,
+                                                   dcol,
+                                                   info,
+                                                   rocsparse_analysis_policy_reuse,
+                                                   rocsparse_solve_policy_auto,
+                                                   dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis(handle,
+                                                   rocsparse_operation_none,
+                                                   m,
+                                                   nnz,
+                                                   descr_U,
+                                                   dval,
+                                                   dptr,
+                                                   dcol,
+                                                   info,
+                                                   rocsparse_analysis_policy_reuse,
+                                                   rocsparse_solve_policy_auto,
+                                                   dbuffer));
+
+    // Single precision factorization
+    CHECK_ROCSPARSE_ERROR(rocsparse_dscsrilu0(
+        handle, m, nnz, descr_M, dval, dptr, dcol, info, rocsparse_solve_policy_auto, dbuffer));
+
+    // Check for zero pivot, the shifted matrix does not have any
+    rocsparse_int hposition;
+    rocsparse_int hposition_gold = -1;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_zero_pivot(handle, info, &hposition));
+    unit_check_general(1, 1, 1, &hposition_gold, &hposition);
+
+    if(argus.unit_check)
+    {
+        // The matrix values must not be touched by the factorization
+        std::vector<double> hval_result(nnz);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hval_result.data(), dval, sizeof(double) * nnz, hipMemcpyDeviceToHost));
+        unit_check_general(1, nnz, 1, hcsr_val.data(), hval_result.data());
+
+        // Iteration count and residual are always returned on the host, independent of
+        // the pointer mode, which has to be preserved
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+        rocsparse_int iter;
+        double res;
+        CHECK_ROCSPARSE_ERROR(rocsparse_dscsrilu0_solve(handle,
+                                                        m,
+                                                        nnz,
+                                                        descr_M,
+                                                        dval,
+                                                        dptr,
+                                                        dcol,
+                                                        info,
+                                                        db,
+                                                        dx,
+                                                        max_iter,
+                                                        tol,
+                                                        &iter,
+                                                        &res,
+                                                        rocsparse_solve_policy_auto,
+                                                        dsolve_buffer));
+
+        rocsparse_pointer_mode mode;
+        CHECK_ROCSPARSE_ERROR(rocsparse_get_pointer_mode(handle, &mode));
+        rocsparse_int hmode      = mode;
+        rocsparse_int hmode_gold = rocsparse_pointer_mode_device;
+        unit_check_general(1, 1, 1, &hmode_gold, &hmode);
+
+        CHECK_HIP_ERROR(hipMemcpy(hx.data(), dx, sizeof(double) * m, hipMemcpyDeviceToHost));
+
+        // Check convergence
+        rocsparse_int converged      = (res <= tol && iter < max_iter) ? 1 : 0;
+        rocsparse_int converged_gold = 1;
+        unit_check_general(1, 1, 1, &converged_gold, &converged);
+
+        // The residual of the solution has to be within the tolerance, up to the
+        // rounding error of the residual computation itself
+        double nrm_b = 0.0;
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            nrm_b = std::max(nrm_b, std::abs(hb[i]));
+        }
+
+        std::vector<double> hr(m);
+        std::vector<double> hr_gold(m, 0.0);
+        std::vector<double> hbound(m, 2.0 * tol * nrm_b);
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hr[i] = hb[i];
+            for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base;
+                ++j)
+            {
+                hr[i] -= hcsr_val[j] * hx[hcsr_col_ind[j] - idx_base];
+            }
+        }
+
+        unit_check_bound(m, hr_gold.data(), hr.data(), hbound.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int iter = 0;
+        double res         = 0.0;
+
+        for(int i = 0; i < number_cold_calls; ++i)
+        {
+            CHECK_HIP_ERROR(hipMemset(dx, 0, sizeof(double) * m));
+            rocsparse_dscsrilu0(handle,
+                                m,
+                                nnz,
+                                descr_M,
+                                dval,
+                                dptr,
+                                dcol,
+                                info,
+                                rocsparse_solve_policy_auto,
+                                dbuffer);
+            rocsparse_dscsrilu0_solve(handle,
+                                      m,
+                                      nnz,
+                                      descr_M,
+                                      dval,
+                                      dptr,
+                                      dcol,
+                                      info,
+                                      db,
+                                      dx,
+                                      max_iter,
+                                      tol,
+                                      &iter,
+                                      &res,
+                                      rocsparse_solve_policy_auto,
+                                      dsolve_buffer);
+        }
+
+        double gpu_time_used = 0.0;
+
+        for(int i = 0; i < number_hot_calls; ++i)
+        {
+            CHECK_HIP_ERROR(hipMemset(dx, 0, sizeof(double) * m));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            double start = get_time_us();
+
+            rocsparse_dscsrilu0(handle,
+                                m,
+                                nnz,
+                                descr_M,
+                                dval,
+                                dptr,
+                                dcol,
+                                info,
+                                rocsparse_solve_policy_auto,
+                                dbuffer);
+            rocsparse_dscsrilu0_solve(handle,
+                                      m,
+                                      nnz,
+                                      descr_M,
+                                      dval,
+                                      dptr,
+                                      dcol,
+                                      info,
+                                      db,
+                                      dx,
+                                      max_iter,
+                                      tol,
+                                      &iter,
+                                      &res,
+                                      rocsparse_solve_policy_auto,
+                                      dsolve_buffer);
+
+            gpu_time_used += get_time_us() - start;
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used = gpu_time_used / (number_hot_calls * 1e3);
+
+        printf("m\t\tnnz\t\titer\tres\t\tmsec\n");
+        printf("%8d\t%9d\t%4d\t%0.2e\t%0.2lf\n", m, nnz, iter, res, gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRILU0_MIXED_HPP
@@ -401,57 +401,18 @@ rocsparse_status testing_csrmm(Arguments argus)
     std::vector<T> hcsr_valA;
 
     // Initial Data on CPU
-    if(binfile != "")
+    if(load_matrix_csr(argus,
+                       binfile,
+                       filename,
+                       M,
+                       K,
+                       nnz,
+                       hcsr_row_ptrA,
+                       hcsr_col_indA,
+                       hcsr_valA,
+                       idx_base) != 0)
     {
-        if(read_bin_matrix(
-               binfile.c_str(), M, K, nnz, hcsr_row_ptrA, hcsr_col_indA, hcsr_valA, idx_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
-    }
-    else if(argus.laplacian)
-    {
-        M = K =
-            gen_2d_laplacian(argus.laplacian, hcsr_row_ptrA, hcsr_col_indA, hcsr_valA, idx_base);
-        nnz = hcsr_row_ptrA[M];
-    }
-    else
-    {
-        std::vector<rocsparse_int> hcoo_row_indA;
-
-        if(filename != "")
-        {
-            if(read_mtx_matrix(filename.c_str(),
-                               M,
-                               K,
-                               nnz,
-                               hcoo_row_indA,
-                               hcsr_col_indA,
-                               hcsr_valA,
-                               idx_base) != 0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(M, K, nnz, hcoo_row_indA, hcsr_col_indA, hcsr_valA, idx_base);
-        }
-
-        // Convert COO to CSR
-        hcsr_row_ptrA.resize(M + 1, 0);
-        for(rocsparse_int i = 0; i < nnz; ++i)
-        {
-            ++hcsr_row_ptrA[hcoo_row_indA[i] + 1 - idx_base];
-        }
-
-        hcsr_row_ptrA[0] = idx_base;
-        for(rocsparse_int i = 0; i < M; ++i)
-        {
-            hcsr_row_ptrA[i + 1] += hcsr_row_ptrA[i];
-        }
+        return rocsparse_status_internal_error;
     }
 
     if(transB == rocsparse_operation_none)
@@ -28,6 +28,7 @@
 #include "rocsparse_test_unique_ptr.hpp"
 #include "rocsparse.hpp"
 #include "utility.hpp"
+#include "roofline.hpp"
 #include "unit.hpp"
 
 #include <string>
@@ -96,14 +97,6 @@ void testing_csrmv_bad_arg(void)
             rocsparse_csrmv_analysis(handle, transA, m, n, nnz, descr, dval, dptr, dcol_null, info);
         verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
     }
-    // testing for(nullptr == dval)
-    {
-        T* dval_null = nullptr;
-
-        status =
-            rocsparse_csrmv_analysis(handle, transA, m, n, nnz, descr, dval_null, dptr, dcol, info);
-        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
-    }
     // testing for(nullptr == descr)
     {
         rocsparse_mat_descr descr_null = nullptr;
@@ -171,26 +164,6 @@ void testing_csrmv_bad_arg(void)
                                  dy);
         verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
     }
-    // testing for(nullptr == dval)
-    {
-        T* dval_null = nullptr;
-
-        status = rocsparse_csrmv(handle,
-                                 transA,
-                                 m,
-                                 n,
-                                 nnz,
-                                 &alpha,
-                                 descr,
-                                 dval_null,
-                                 dptr,
-                                 dcol,
-                                 nullptr,
-                                 dx,
-                                 &beta,
-                                 dy);
-        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
-    }
     // testing for(nullptr == dx)
     {
         T* dx_null = nullptr;
@@ -455,56 +428,15 @@ rocsparse_status testing_csrmv(Arguments argus)
 
     // Host structures
     std::vector<rocsparse_int> hcsr_row_ptr;
-    std::vector<rocsparse_int> hcoo_row_ind;
     std::vector<rocsparse_int> hcol_ind;
     std::vector<T> hval;
 
     // Initial Data on CPU
     srand(12345ULL);
-    if(binfile != "")
+    if(load_matrix_csr(
+           argus, binfile, filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
     {
-        if(read_bin_matrix(binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
-    }
-    else if(argus.laplacian)
-    {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcol_ind, hval, idx_base);
-        nnz   = hcsr_row_ptr[m];
-    }
-    else
-    {
-        if(filename != "")
-        {
-            if(read_mtx_matrix(
-                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base) != 0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base);
-        }
-
-        // Convert COO to CSR
-        if(!argus.laplacian)
-        {
-            hcsr_row_ptr.resize(m + 1, 0);
-            for(rocsparse_int i = 0; i < nnz; ++i)
-            {
-                ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
-            }
-
-            hcsr_row_ptr[0] = idx_base;
-            for(rocsparse_int i = 0; i < m; ++i)
-            {
-                hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
-            }
-        }
+        return rocsparse_status_internal_error;
     }
 
     std::vector<T> hx(n);
@@ -697,6 +629,53 @@ rocsparse_status testing_csrmv(Arguments argus)
             unit_check_general(1, m, 1, hy_gold.data(), hy_1.data());
             unit_check_general(1, m, 1, hy_gold.data(), hy_2.data());
         }
+
+        // Pattern only matrix, must match explicitly stored unit values
+        std::vector<T> hval_one(nnz, static_cast<T>(1));
+
+        auto dval_one_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+        T* dval_one           = (T*)dval_one_managed.get();
+        T* dval_null          = nullptr;
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(dval_one, hval_one.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              nnz,
+                                              &h_alpha,
+                                              descr,
+                                              dval_one,
+                                              dptr,
+                                              dcol,
+                                              info,
+                                              dx,
+                                              &h_beta,
+                                              dy_1));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              nnz,
+                                              &h_alpha,
+                                              descr,
+                                              dval_null,
+                                              dptr,
+                                              dcol,
+                                              info,
+                                              dx,
+                                              &h_beta,
+                                              dy_2));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        unit_check_near(1, m, 1, hy_1.data(), hy_2.data());
     }
 
     if(argus.timing)
@@ -763,6 +742,20 @@ rocsparse_status testing_csrmv(Arguments argus)
                gpu_gflops,
                bandwidth,
                gpu_time_used);
+
+        size_t bytes = roofline_csrmv_bytes<T>(
+            m, nnz, hcsr_row_ptr.data(), hcol_ind.data(), idx_base, h_beta, adaptive);
+
+        roofline_report(argus,
+                        {"csrmv",
+                         roofline_precision<T>(),
+                         adaptive ? "csr-adaptive" : "csr",
+                         m,
+                         n,
+                         nnz,
+                         static_cast<double>(flops),
+                         static_cast<double>(bytes),
+                         gpu_time_used});
     }
 
     if(adaptive)
@@ -0,0 +1,385 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRMV_MAPPED_HPP
+#define TESTING_CSRMV_MAPPED_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <algorithm>
+#include <string>
+#include <unistd.h>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+// Host csrmv and csrmm on the arrays of a mapped CSR container, compared against the device.
+// M and N are the dimensions of the sparse matrix, K is the number of dense columns of csrmm.
+template <typename T>
+rocsparse_status testing_csrmv_mapped(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    rocsparse_int k               = argus.K;
+    T h_alpha                     = argus.alpha;
+    T h_beta                      = argus.beta;
+    rocsparse_operation transA    = rocsparse_operation_none;
+    rocsparse_operation transB    = rocsparse_operation_none;
+    rocsparse_index_base idx_base = argus.idx_base;
+    std::string filename          = "";
+    int nthreads                  = host_threads(std::numeric_limits<int>::max());
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    mapped_csr_hints hints;
+
+    if(parse_mapped_csr_hints(argus.map_hints, hints) != 0)
+    {
+        fprintf(stderr, "Invalid mapping hints %s\n", argus.map_hints.c_str());
+        return rocsparse_status_invalid_value;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Nothing to map
+    if(m <= 0 || n <= 0 || k <= 0 || nnz <= 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<T> hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(load_matrix_csr(argus, "", filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    // Write the matrix to a container next to the matrix file, or to a temporary file
+    std::string container = (filename != "") ? filename + ".rscm" : "";
+    bool temporary        = (container == "");
+
+    if(temporary)
+    {
+        char path[] = "/tmp/rocsparse_csrmv_mapped_XXXXXX";
+        int fd      = mkstemp(path);
+
+        if(fd < 0)
+        {
+            fprintf(stderr, "Cannot create temporary file\n");
+            return rocsparse_status_internal_error;
+        }
+
+        close(fd);
+        container = path;
+    }
+
+    if(write_mapped_csr(container.c_str(),
+                        m,
+                        n,
+                        nnz,
+                        hcsr_row_ptr.data(),
+                        hcol_ind.data(),
+                        hval.data(),
+                        mapped_csr_value_type<T>(),
+                        sizeof(T),
+                        idx_base) != 0)
+    {
+        fprintf(stderr, "Cannot open [write] %s\n", container.c_str());
+        return rocsparse_status_internal_error;
+    }
+
+    // Map the container, the mapping stays valid after the file has been removed
+    mapped_csr_matrix A;
+
+    double map_time_used = get_time_us();
+    rocsparse_int err    = map_csr_matrix(container.c_str(), hints, A);
+    map_time_used        = (get_time_us() - map_time_used) / 1e3;
+
+    if(temporary)
+    {
+        remove(container.c_str());
+    }
+
+    if(err != 0)
+    {
+        fprintf(stderr, "Cannot map %s\n", container.c_str());
+        return rocsparse_status_internal_error;
+    }
+
+    const T* mval = mapped_csr_values<T>(A);
+
+    // Dense structures, C is m x k and B is n x k
+    rocsparse_int ldb = n;
+    rocsparse_int ldc = m;
+
+    std::vector<T> hx(n);
+    std::vector<T> hy(m);
+    std::vector<T> hB(ldb * k);
+    std::vector<T> hC(ldc * k);
+
+    rocsparse_init<T>(hx, 1, n);
+    rocsparse_init<T>(hy, 1, m);
+    rocsparse_init<T>(hB, ldb, k);
+    rocsparse_init<T>(hC, ldc, k);
+
+    if(argus.unit_check)
+    {
+        // Container
+        unit_check_general(1, 1, 1, &m, &A.m);
+        unit_check_general(1, 1, 1, &n, &A.n);
+        unit_check_general(1, 1, 1, &nnz, &A.nnz);
+        unit_check_general(1, m + 1, 1, hcsr_row_ptr.data(), const_cast<rocsparse_int*>(A.ptr));
+        unit_check_general(1, nnz, 1, hcol_ind.data(), const_cast<rocsparse_int*>(A.col));
+        unit_check_general(1, nnz, 1, hval.data(), const_cast<T*>(mval));
+
+        // allocate memory on device
+        auto dptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+        auto dcol_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+        auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+        auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+        auto dB_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldb * k), device_free};
+        auto dC_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * ldc * k), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T* dval             = (T*)dval_managed.get();
+        T* dx               = (T*)dx_managed.get();
+        T* dy               = (T*)dy_managed.get();
+        T* dB               = (T*)dB_managed.get();
+        T* dC               = (T*)dC_managed.get();
+
+        if(!dptr || !dcol || !dval || !dx || !dy || !dB || !dC)
+        {
+            unmap_csr_matrix(A);
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !dx || !dy || !dB || !dC");
+            return rocsparse_status_memory_error;
+        }
+
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(
+            dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * ldb * k, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * ldc * k, hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                              transA,
+                                              m,
+                                              n,
+                                              nnz,
+                                              &h_alpha,
+                                              descr,
+                                              dval,
+                                              dptr,
+                                              dcol,
+                                              nullptr,
+                                              dx,
+                                              &h_beta,
+                                              dy));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmm(handle,
+                                              transA,
+                                              transB,
+                                              m,
+                                              k,
+                                              n,
+                                              nnz,
+                                              &h_alpha,
+                                              descr,
+                                              dval,
+                                              dptr,
+                                              dcol,
+                                              dB,
+                                              ldb,
+                                              &h_beta,
+                                              dC,
+                                              ldc));
+
+        std::vector<T> hy_gold(m);
+        std::vector<T> hC_gold(ldc * k);
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_gold.data(), dy, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_gold.data(), dC, sizeof(T) * ldc * k, hipMemcpyDeviceToHost));
+
+        // Host, directly on the mapped arrays
+        std::vector<T> hy_1(hy);
+        std::vector<T> hC_1(hC);
+
+        host_csrmv_parallel(
+            m, h_alpha, A.ptr, A.col, mval, hx.data(), h_beta, hy_1.data(), A.idx_base, nthreads);
+        host_csrmm_parallel(m,
+                            k,
+                            transB,
+                            h_alpha,
+                            A.ptr,
+                            A.col,
+                            mval,
+                            hB.data(),
+                            ldb,
+                            h_beta,
+                            hC_1.data(),
+                            ldc,
+                            A.idx_base,
+                            nthreads);
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(m, k, ldc, hC_gold.data(), hC_1.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_hot_calls = argus.iters;
+
+        std::vector<T> hy_1(hy);
+        std::vector<T> hC_1(hC);
+
+        // First multiplication faults all pages in that are not resident yet
+        double resident = mapped_csr_resident(A);
+
+        double first_time_used = get_time_us();
+
+        host_csrmv_parallel(
+            m, h_alpha, A.ptr, A.col, mval, hx.data(), h_beta, hy_1.data(), A.idx_base, nthreads);
+
+        first_time_used = (get_time_us() - first_time_used) / 1e3;
+
+        double csrmv_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            host_csrmv_parallel(m,
+                                h_alpha,
+                                A.ptr,
+                                A.col,
+                                mval,
+                                hx.data(),
+                                h_beta,
+                                hy_1.data(),
+                                A.idx_base,
+                                nthreads);
+        }
+
+        csrmv_time_used = (get_time_us() - csrmv_time_used) / (number_hot_calls * 1e3);
+
+        double csrmm_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            host_csrmm_parallel(m,
+                                k,
+                                transB,
+                                h_alpha,
+                                A.ptr,
+                                A.col,
+                                mval,
+                                hB.data(),
+                                ldb,
+                                h_beta,
+                                hC_1.data(),
+                                ldc,
+                                A.idx_base,
+                                nthreads);
+        }
+
+        csrmm_time_used = (get_time_us() - csrmm_time_used) / (number_hot_calls * 1e3);
+
+        // Copying into private buffers, as avoided by the mapping
+        double copy_time_used = get_time_us();
+
+        std::vector<rocsparse_int> hptr_copy(A.ptr, A.ptr + m + 1);
+        std::vector<rocsparse_int> hcol_copy(A.col, A.col + nnz);
+        std::vector<T> hval_copy(mval, mval + nnz);
+
+        copy_time_used = (get_time_us() - copy_time_used) / 1e3;
+
+        size_t matrix_bytes = (sizeof(rocsparse_int) + sizeof(T)) * nnz +
+                              sizeof(rocsparse_int) * (m + 1);
+        size_t csrmv_bytes = matrix_bytes + sizeof(T) * (n + ((h_beta != 0.0) ? 2 * m : m));
+
+        double bandwidth = csrmv_bytes / csrmv_time_used / 1e6;
+        double gflops    = 2.0 * nnz * k / csrmm_time_used / 1e6;
+
+        printf("m\t\tn\t\tnnz\t\tk\tthreads\tresident\thuge\tinterleaved\tmap msec"
+               "\tfirst msec\tGB/s\tcsrmv msec\tGFlop/s\tcsrmm msec\tcopy msec\n");
+        printf("%8d\t%8d\t%9d\t%d\t%d\t%0.1lf%%\t\t%s\t%s\t\t%0.3lf\t\t%0.3lf\t\t%0.2lf\t%0.3lf"
+               "\t\t%0.2lf\t%0.3lf\t\t%0.3lf\n",
+               m,
+               n,
+               nnz,
+               k,
+               nthreads,
+               resident * 100.0,
+               A.huge_pages ? "yes" : "no",
+               A.interleaved ? "yes" : "no",
+               map_time_used,
+               first_time_used,
+               bandwidth,
+               csrmv_time_used,
+               gflops,
+               csrmm_time_used,
+               copy_time_used);
+    }
+
+    unmap_csr_matrix(A);
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRMV_MAPPED_HPP
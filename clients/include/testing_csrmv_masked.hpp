@@ -0,0 +1,698 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRMV_MASKED_HPP
+#define TESTING_CSRMV_MASKED_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <algorithm>
+#include <string>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csrmv_masked_bad_arg(void)
+{
+    rocsparse_int n            = 100;
+    rocsparse_int m            = 100;
+    rocsparse_int nnz          = 100;
+    rocsparse_int mask_nnz     = 10;
+    rocsparse_int safe_size    = 100;
+    T alpha                    = 0.6;
+    T beta                     = 0.2;
+    rocsparse_operation transA = rocsparse_operation_none;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dmask_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dx_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* dptr  = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol  = (rocsparse_int*)dcol_managed.get();
+    T* dval              = (T*)dval_managed.get();
+    rocsparse_int* dmask = (rocsparse_int*)dmask_managed.get();
+    T* dx                = (T*)dx_managed.get();
+    T* dy                = (T*)dy_managed.get();
+
+    if(!dptr || !dcol || !dval || !dmask || !dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing for(nullptr == dval)
+    {
+        T* dval_null = nullptr;
+
+        status = rocsparse_csrmv_masked(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        dval_null,
+                                        dptr,
+                                        dcol,
+                                        dx,
+                                        &beta,
+                                        mask_nnz,
+                                        dmask,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrmv_masked(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        dval,
+                                        dptr_null,
+                                        dcol,
+                                        dx,
+                                        &beta,
+                                        mask_nnz,
+                                        dmask,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrmv_masked(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        dval,
+                                        dptr,
+                                        dcol_null,
+                                        dx,
+                                        &beta,
+                                        mask_nnz,
+                                        dmask,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dx)
+    {
+        T* dx_null = nullptr;
+
+        status = rocsparse_csrmv_masked(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        dval,
+                                        dptr,
+                                        dcol,
+                                        dx_null,
+                                        &beta,
+                                        mask_nnz,
+                                        dmask,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_csrmv_masked(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        dval,
+                                        dptr,
+                                        dcol,
+                                        dx,
+                                        &beta,
+                                        mask_nnz,
+                                        dmask,
+                                        dy_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dy is nullptr");
+    }
+    // testing for(nullptr == dmask)
+    {
+        rocsparse_int* dmask_null = nullptr;
+
+        status = rocsparse_csrmv_masked(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        dval,
+                                        dptr,
+                                        dcol,
+                                        dx,
+                                        &beta,
+                                        mask_nnz,
+                                        dmask_null,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dmask is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_csrmv_masked(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        d_alpha_null,
+                                        descr,
+                                        dval,
+                                        dptr,
+                                        dcol,
+                                        dx,
+                                        &beta,
+                                        mask_nnz,
+                                        dmask,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == d_beta)
+    {
+        T* d_beta_null = nullptr;
+
+        status = rocsparse_csrmv_masked(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        dval,
+                                        dptr,
+                                        dcol,
+                                        dx,
+                                        d_beta_null,
+                                        mask_nnz,
+                                        dmask,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: beta is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrmv_masked(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr_null,
+                                        dval,
+                                        dptr,
+                                        dcol,
+                                        dx,
+                                        &beta,
+                                        mask_nnz,
+                                        dmask,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(mask_nnz > m)
+    {
+        status = rocsparse_csrmv_masked(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        dval,
+                                        dptr,
+                                        dcol,
+                                        dx,
+                                        &beta,
+                                        m + 1,
+                                        dmask,
+                                        dy);
+        verify_rocsparse_status_invalid_size(status, "Error: mask_nnz > m");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrmv_masked(handle_null,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        dval,
+                                        dptr,
+                                        dcol,
+                                        dx,
+                                        &beta,
+                                        mask_nnz,
+                                        dmask,
+                                        dy);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+// Draws mask_nnz distinct row indices in random order
+static void csrmv_masked_gen_mask(rocsparse_int m,
+                                  rocsparse_int mask_nnz,
+                                  std::vector<rocsparse_int>& mask_ind,
+                                  rocsparse_index_base idx_base)
+{
+    std::vector<rocsparse_int> perm(m);
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        perm[i] = i + idx_base;
+    }
+
+    for(rocsparse_int i = 0; i < mask_nnz; ++i)
+    {
+        std::swap(perm[i], perm[i + rand() % (m - i)]);
+    }
+
+    mask_ind.assign(perm.begin(), perm.begin() + mask_nnz);
+}
+
+template <typename T>
+rocsparse_status testing_csrmv_masked(Arguments argus)
+{
+    rocsparse_int safe_size       = 100;
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    T h_alpha                     = argus.alpha;
+    T h_beta                      = argus.beta;
+    rocsparse_operation transA    = rocsparse_operation_none;
+    rocsparse_index_base idx_base = argus.idx_base;
+    double mask_density           = argus.mask_density;
+    std::string filename          = "";
+    rocsparse_status status;
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto dptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dmask_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dx_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dptr  = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol  = (rocsparse_int*)dcol_managed.get();
+        T* dval              = (T*)dval_managed.get();
+        rocsparse_int* dmask = (rocsparse_int*)dmask_managed.get();
+        T* dx                = (T*)dx_managed.get();
+        T* dy                = (T*)dy_managed.get();
+
+        if(!dptr || !dcol || !dval || !dmask || !dx || !dy)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !dmask || !dx || !dy");
+            return rocsparse_status_memory_error;
+        }
+
+        rocsparse_int mask_nnz = 0;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_csrmv_masked(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &h_alpha,
+                                        descr,
+                                        dval,
+                                        dptr,
+                                        dcol,
+                                        dx,
+                                        &h_beta,
+                                        mask_nnz,
+                                        dmask,
+                                        dy);
+
+        if(m < 0 || n < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<T> hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(load_matrix_csr(argus, "", filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    // Selected rows
+    rocsparse_int mask_nnz =
+        std::min(m, std::max(1, static_cast<rocsparse_int>(mask_density * m)));
+
+    std::vector<rocsparse_int> hmask;
+    csrmv_masked_gen_mask(m, mask_nnz, hmask, idx_base);
+
+    std::vector<T> hx(n);
+    std::vector<T> hy(m);
+
+    rocsparse_init<T>(hx, 1, n);
+    rocsparse_init<T>(hy, 1, m);
+
+    // allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dmask_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * m), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dptr  = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol  = (rocsparse_int*)dcol_managed.get();
+    T* dval              = (T*)dval_managed.get();
+    rocsparse_int* dmask = (rocsparse_int*)dmask_managed.get();
+    T* dx                = (T*)dx_managed.get();
+    T* dy_1              = (T*)dy_1_managed.get();
+    T* dy_2              = (T*)dy_2_managed.get();
+    T* d_alpha           = (T*)d_alpha_managed.get();
+    T* d_beta            = (T*)d_beta_managed.get();
+
+    if(!dptr || !dcol || !dval || !dmask || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dptr || !dcol || !dval || !dmask || !dx || "
+                                        "!dy_1 || !dy_2 || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dmask, hmask.data(), sizeof(rocsparse_int) * mask_nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        std::vector<T> hy_gold(hy);
+        std::vector<T> hy_1(m);
+        std::vector<T> hy_2(m);
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_masked(handle,
+                                                     transA,
+                                                     m,
+                                                     n,
+                                                     nnz,
+                                                     &h_alpha,
+                                                     descr,
+                                                     dval,
+                                                     dptr,
+                                                     dcol,
+                                                     dx,
+                                                     &h_beta,
+                                                     mask_nnz,
+                                                     dmask,
+                                                     dy_1));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_masked(handle,
+                                                     transA,
+                                                     m,
+                                                     n,
+                                                     nnz,
+                                                     d_alpha,
+                                                     descr,
+                                                     dval,
+                                                     dptr,
+                                                     dcol,
+                                                     dx,
+                                                     d_beta,
+                                                     mask_nnz,
+                                                     dmask,
+                                                     dy_2));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        // CPU, rows that are not selected keep their values
+        host_csrmv_masked(h_alpha,
+                          hcsr_row_ptr.data(),
+                          hcol_ind.data(),
+                          hval.data(),
+                          hx.data(),
+                          h_beta,
+                          mask_nnz,
+                          hmask.data(),
+                          hy_gold.data(),
+                          idx_base);
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Full csrmv as baseline
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrmv(handle,
+                            transA,
+                            m,
+                            n,
+                            nnz,
+                            &h_alpha,
+                            descr,
+                            dval,
+                            dptr,
+                            dcol,
+                            nullptr,
+                            dx,
+                            &h_beta,
+                            dy_1);
+        }
+
+        double full_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csrmv(handle,
+                            transA,
+                            m,
+                            n,
+                            nnz,
+                            &h_alpha,
+                            descr,
+                            dval,
+                            dptr,
+                            dcol,
+                            nullptr,
+                            dx,
+                            &h_beta,
+                            dy_1);
+        }
+
+        // Convert to miliseconds per call
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        full_time_used = (get_time_us() - full_time_used) / (number_hot_calls * 1e3);
+
+        // Sweep over the fraction of selected rows, a single fraction if specified by
+        // the user
+        std::vector<double> density = {1e-3, 1e-2, 0.1, 0.25, 0.5, 1.0};
+        if(mask_density > 0.0)
+        {
+            density.assign(1, mask_density);
+        }
+
+        printf("m\t\tn\t\tnnz\t\tdensity\t\tmask_nnz\tselected nnz\tGB/s\tmsec\tcsrmv msec\n");
+
+        for(size_t d = 0; d < density.size(); ++d)
+        {
+            mask_nnz = std::min(m, std::max(1, static_cast<rocsparse_int>(density[d] * m)));
+
+            csrmv_masked_gen_mask(m, mask_nnz, hmask, idx_base);
+            CHECK_HIP_ERROR(hipMemcpy(
+                dmask, hmask.data(), sizeof(rocsparse_int) * mask_nnz, hipMemcpyHostToDevice));
+
+            // Number of non-zero entries of the selected rows
+            rocsparse_int sel_nnz = 0;
+            for(rocsparse_int k = 0; k < mask_nnz; ++k)
+            {
+                rocsparse_int i = hmask[k] - idx_base;
+                sel_nnz += hcsr_row_ptr[i + 1] - hcsr_row_ptr[i];
+            }
+
+            for(int iter = 0; iter < number_cold_calls; iter++)
+            {
+                rocsparse_csrmv_masked(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dx,
+                                       &h_beta,
+                                       mask_nnz,
+                                       dmask,
+                                       dy_1);
+            }
+
+            double gpu_time_used = get_time_us();
+
+            for(int iter = 0; iter < number_hot_calls; iter++)
+            {
+                rocsparse_csrmv_masked(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       nnz,
+                                       &h_alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       dx,
+                                       &h_beta,
+                                       mask_nnz,
+                                       dmask,
+                                       dy_1);
+            }
+
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+            size_t memtrans  = ((h_beta != 0.0) ? 3.0 : 2.0) * mask_nnz + sel_nnz;
+            double bandwidth =
+                (memtrans * sizeof(T) + (3 * mask_nnz + sel_nnz) * sizeof(rocsparse_int)) /
+                gpu_time_used / 1e6;
+
+            printf("%8d\t%8d\t%9d\t%0.2e\t%8d\t%9d\t%0.2lf\t%0.3lf\t%0.3lf\n",
+                   m,
+                   n,
+                   nnz,
+                   density[d],
+                   mask_nnz,
+                   sel_nnz,
+                   bandwidth,
+                   gpu_time_used,
+                   full_time_used);
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRMV_MASKED_HPP
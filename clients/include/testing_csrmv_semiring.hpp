@@ -0,0 +1,984 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRMV_SEMIRING_HPP
+#define TESTING_CSRMV_SEMIRING_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <string>
+#include <cmath>
+#include <limits>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+template <typename T>
+void testing_csrmv_semiring_bad_arg(void)
+{
+    rocsparse_int n             = 100;
+    rocsparse_int m             = 100;
+    rocsparse_int nnz           = 100;
+    rocsparse_int safe_size     = 100;
+    T alpha                     = 0.6;
+    T beta                      = 0.2;
+    rocsparse_operation transA  = rocsparse_operation_none;
+    rocsparse_semiring semiring = rocsparse_semiring_min_plus;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    auto drow_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* drow = (rocsparse_int*)drow_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    T* dx               = (T*)dx_managed.get();
+    T* dy               = (T*)dy_managed.get();
+
+    if(!dval || !drow || !dcol || !dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing rocsparse_csrmv_semiring
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csrmv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          dptr_null,
+                                          dcol,
+                                          nullptr,
+                                          dx,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csrmv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol_null,
+                                          nullptr,
+                                          dx,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dx)
+    {
+        T* dx_null = nullptr;
+
+        status = rocsparse_csrmv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol,
+                                          nullptr,
+                                          dx_null,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_csrmv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol,
+                                          nullptr,
+                                          dx,
+                                          &beta,
+                                          dy_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dy is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_csrmv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          d_alpha_null,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol,
+                                          nullptr,
+                                          dx,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == d_beta)
+    {
+        T* d_beta_null = nullptr;
+
+        status = rocsparse_csrmv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol,
+                                          nullptr,
+                                          dx,
+                                          d_beta_null,
+                                          dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: beta is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrmv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr_null,
+                                          dval,
+                                          drow,
+                                          dcol,
+                                          nullptr,
+                                          dx,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for invalid semiring
+    {
+        rocsparse_semiring semiring_invalid = static_cast<rocsparse_semiring>(7);
+
+        status = rocsparse_csrmv_semiring(handle,
+                                          transA,
+                                          semiring_invalid,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol,
+                                          nullptr,
+                                          dx,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_value(status, "Error: semiring is invalid");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrmv_semiring(handle_null,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol,
+                                          nullptr,
+                                          dx,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // testing rocsparse_coomv_semiring
+
+    // testing for(nullptr == drow)
+    {
+        rocsparse_int* drow_null = nullptr;
+
+        status = rocsparse_coomv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow_null,
+                                          dcol,
+                                          dx,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: drow is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_coomv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol_null,
+                                          dx,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == dx)
+    {
+        T* dx_null = nullptr;
+
+        status = rocsparse_coomv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol,
+                                          dx_null,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_coomv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol,
+                                          dx,
+                                          &beta,
+                                          dy_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dy is nullptr");
+    }
+    // testing for invalid semiring
+    {
+        rocsparse_semiring semiring_invalid = static_cast<rocsparse_semiring>(7);
+
+        status = rocsparse_coomv_semiring(handle,
+                                          transA,
+                                          semiring_invalid,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol,
+                                          dx,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_value(status, "Error: semiring is invalid");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_coomv_semiring(handle_null,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &alpha,
+                                          descr,
+                                          dval,
+                                          drow,
+                                          dcol,
+                                          dx,
+                                          &beta,
+                                          dy);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+// The arithmetic semiring is subject to rounding, all other semirings are exact
+template <typename T>
+static void csrmv_semiring_check(rocsparse_semiring semiring, rocsparse_int n, T* hCPU, T* hGPU)
+{
+    if(semiring == rocsparse_semiring_plus_times)
+    {
+        unit_check_near(1, n, 1, hCPU, hGPU);
+    }
+    else
+    {
+        unit_check_general(1, n, 1, hCPU, hGPU);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csrmv_semiring(Arguments argus)
+{
+    rocsparse_int safe_size       = 100;
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    T h_alpha                     = argus.alpha;
+    T h_beta                      = argus.beta;
+    rocsparse_operation transA    = rocsparse_operation_none;
+    rocsparse_semiring semiring   = argus.semiring;
+    rocsparse_index_base idx_base = argus.idx_base;
+    bool adaptive                 = argus.bswitch;
+    std::string filename          = "";
+    rocsparse_status status;
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = nullptr;
+
+    if(adaptive)
+    {
+        info = unique_ptr_mat_info->info;
+    }
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto dptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T* dval             = (T*)dval_managed.get();
+        T* dx               = (T*)dx_managed.get();
+        T* dy               = (T*)dy_managed.get();
+
+        if(!dval || !dptr || !dcol || !dx || !dy)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !dx || !dy");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_csrmv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &h_alpha,
+                                          descr,
+                                          dval,
+                                          dptr,
+                                          dcol,
+                                          info,
+                                          dx,
+                                          &h_beta,
+                                          dy);
+
+        if(m < 0 || n < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && nnz >= 0");
+        }
+
+        status = rocsparse_coomv_semiring(handle,
+                                          transA,
+                                          semiring,
+                                          m,
+                                          n,
+                                          nnz,
+                                          &h_alpha,
+                                          descr,
+                                          dval,
+                                          dptr,
+                                          dcol,
+                                          dx,
+                                          &h_beta,
+                                          dy);
+
+        if(m < 0 || n < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcoo_row_ind;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<T> hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(load_matrix_csr(argus, "", filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    // Row indices of the COO format, the matrix is sorted by rows
+    hcoo_row_ind.resize(nnz);
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            hcoo_row_ind[j] = i + idx_base;
+        }
+    }
+
+    std::vector<T> hx(n);
+    std::vector<T> hxt(m);
+    std::vector<T> hy(m);
+    std::vector<T> hyt(n);
+
+    rocsparse_init<T>(hx, 1, n);
+    rocsparse_init<T>(hxt, 1, m);
+    rocsparse_init<T>(hy, 1, m);
+    rocsparse_init<T>(hyt, 1, n);
+
+    // allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto drow_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dxt_managed     = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dyt_managed     = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* drow = (rocsparse_int*)drow_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    T* dx               = (T*)dx_managed.get();
+    T* dxt              = (T*)dxt_managed.get();
+    T* dy_1             = (T*)dy_1_managed.get();
+    T* dy_2             = (T*)dy_2_managed.get();
+    T* dyt              = (T*)dyt_managed.get();
+    T* d_alpha          = (T*)d_alpha_managed.get();
+    T* d_beta           = (T*)d_beta_managed.get();
+
+    if(!dval || !dptr || !drow || !dcol || !dx || !dxt || !dy_1 || !dy_2 || !dyt || !d_alpha ||
+       !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !drow || !dcol || !dx || !dxt || "
+                                        "!dy_1 || !dy_2 || !dyt || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(drow, hcoo_row_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dxt, hxt.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(adaptive)
+    {
+        // csrmv analysis
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrmv_analysis(handle, transA, m, n, nnz, descr, dval, dptr, dcol, info));
+    }
+
+    if(argus.unit_check)
+    {
+        std::vector<T> hy_gold(hy);
+        std::vector<T> hy_1(m);
+        std::vector<T> hy_2(m);
+
+        // csrmv_semiring, pointer mode host and device
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_semiring(handle,
+                                                       transA,
+                                                       semiring,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       &h_alpha,
+                                                       descr,
+                                                       dval,
+                                                       dptr,
+                                                       dcol,
+                                                       info,
+                                                       dx,
+                                                       &h_beta,
+                                                       dy_1));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_semiring(handle,
+                                                       transA,
+                                                       semiring,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       d_alpha,
+                                                       descr,
+                                                       dval,
+                                                       dptr,
+                                                       dcol,
+                                                       info,
+                                                       dx,
+                                                       d_beta,
+                                                       dy_2));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        host_csrmv_semiring(semiring,
+                            m,
+                            h_alpha,
+                            hcsr_row_ptr.data(),
+                            hcol_ind.data(),
+                            hval.data(),
+                            hx.data(),
+                            h_beta,
+                            hy_gold.data(),
+                            idx_base);
+
+        csrmv_semiring_check(semiring, m, hy_gold.data(), hy_1.data());
+        csrmv_semiring_check(semiring, m, hy_gold.data(), hy_2.data());
+
+        // csrmv_semiring with pattern only matrix
+        hy_gold = hy;
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_semiring(handle,
+                                                       transA,
+                                                       semiring,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       &h_alpha,
+                                                       descr,
+                                                       (const T*)nullptr,
+                                                       dptr,
+                                                       dcol,
+                                                       info,
+                                                       dx,
+                                                       &h_beta,
+                                                       dy_1));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        host_csrmv_semiring(semiring,
+                            m,
+                            h_alpha,
+                            hcsr_row_ptr.data(),
+                            hcol_ind.data(),
+                            (const T*)nullptr,
+                            hx.data(),
+                            h_beta,
+                            hy_gold.data(),
+                            idx_base);
+
+        csrmv_semiring_check(semiring, m, hy_gold.data(), hy_1.data());
+
+        // coomv_semiring, pointer mode host
+        hy_gold = hy;
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_coomv_semiring(handle,
+                                                       transA,
+                                                       semiring,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       &h_alpha,
+                                                       descr,
+                                                       dval,
+                                                       drow,
+                                                       dcol,
+                                                       dx,
+                                                       &h_beta,
+                                                       dy_1));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        host_coomv_semiring(semiring,
+                            transA,
+                            m,
+                            nnz,
+                            h_alpha,
+                            hcoo_row_ind.data(),
+                            hcol_ind.data(),
+                            hval.data(),
+                            hx.data(),
+                            h_beta,
+                            hy_gold.data(),
+                            idx_base);
+
+        csrmv_semiring_check(semiring, m, hy_gold.data(), hy_1.data());
+
+        // coomv_semiring with transposed pattern only matrix, pointer mode device
+        std::vector<T> hyt_gold(hyt);
+        std::vector<T> hyt_1(n);
+
+        CHECK_HIP_ERROR(hipMemcpy(dyt, hyt.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_coomv_semiring(handle,
+                                                       rocsparse_operation_transpose,
+                                                       semiring,
+                                                       m,
+                                                       n,
+                                                       nnz,
+                                                       d_alpha,
+                                                       descr,
+                                                       (const T*)nullptr,
+                                                       drow,
+                                                       dcol,
+                                                       dxt,
+                                                       d_beta,
+                                                       dyt));
+
+        CHECK_HIP_ERROR(hipMemcpy(hyt_1.data(), dyt, sizeof(T) * n, hipMemcpyDeviceToHost));
+
+        host_coomv_semiring(semiring,
+                            rocsparse_operation_transpose,
+                            n,
+                            nnz,
+                            h_alpha,
+                            hcoo_row_ind.data(),
+                            hcol_ind.data(),
+                            (const T*)nullptr,
+                            hxt.data(),
+                            h_beta,
+                            hyt_gold.data(),
+                            idx_base);
+
+        csrmv_semiring_check(semiring, n, hyt_gold.data(), hyt_1.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        int nthreads          = host_threads(m);
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrmv_semiring(handle,
+                                     transA,
+                                     semiring,
+                                     m,
+                                     n,
+                                     nnz,
+                                     &h_alpha,
+                                     descr,
+                                     dval,
+                                     dptr,
+                                     dcol,
+                                     info,
+                                     dx,
+                                     &h_beta,
+                                     dy_1);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csrmv_semiring(handle,
+                                     transA,
+                                     semiring,
+                                     m,
+                                     n,
+                                     nnz,
+                                     &h_alpha,
+                                     descr,
+                                     dval,
+                                     dptr,
+                                     dcol,
+                                     info,
+                                     dx,
+                                     &h_beta,
+                                     dy_1);
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // Multithreaded host path
+        double cpu_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            host_csrmv_semiring(semiring,
+                                m,
+                                h_alpha,
+                                hcsr_row_ptr.data(),
+                                hcol_ind.data(),
+                                hval.data(),
+                                hx.data(),
+                                h_beta,
+                                hy.data(),
+                                idx_base,
+                                nthreads);
+        }
+
+        cpu_time_used = (get_time_us() - cpu_time_used) / (number_hot_calls * 1e3);
+
+        size_t memtrans = 2 * m + nnz;
+
+        double bandwidth =
+            (memtrans * sizeof(T) + (m + 1 + nnz) * sizeof(rocsparse_int)) / gpu_time_used / 1e6;
+
+        printf("m\t\tn\t\tnnz\t\tsemiring\tGB/s\tmsec\tCPU msec (%d threads)\n", nthreads);
+        printf("%8d\t%8d\t%9d\t%8d\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               m,
+               n,
+               nnz,
+               semiring,
+               bandwidth,
+               gpu_time_used,
+               cpu_time_used);
+
+        // Breadth first search (boolean semiring on the pattern) and single source shortest
+        // paths (tropical semiring) from vertex 0 are the fixed-point iteration
+        // x := A * x + x, which is run until x does not change anymore
+        if(m == n &&
+           (semiring == rocsparse_semiring_or_and || semiring == rocsparse_semiring_min_plus))
+        {
+            bool sssp  = (semiring == rocsparse_semiring_min_plus);
+            T one      = sssp ? static_cast<T>(0) : static_cast<T>(1);
+            T zero     = sssp ? std::numeric_limits<T>::infinity() : static_cast<T>(0);
+            const T* w = sssp ? hval.data() : nullptr;
+
+            std::vector<T> hfront(n, zero);
+            std::vector<T> hnext(n);
+            hfront[0] = one;
+
+            CHECK_HIP_ERROR(hipMemcpy(dx, hfront.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+
+            // Host, the number of iterations is bounded by n for graphs with negative cycles
+            rocsparse_int iterations = 0;
+            cpu_time_used            = get_time_us();
+
+            while(iterations < n)
+            {
+                hnext = hfront;
+                host_csrmv_semiring(semiring,
+                                    m,
+                                    one,
+                                    hcsr_row_ptr.data(),
+                                    hcol_ind.data(),
+                                    w,
+                                    hfront.data(),
+                                    one,
+                                    hnext.data(),
+                                    idx_base,
+                                    nthreads);
+                ++iterations;
+
+                if(hnext == hfront)
+                {
+                    break;
+                }
+
+                hfront.swap(hnext);
+            }
+
+            cpu_time_used = (get_time_us() - cpu_time_used) / 1e3;
+
+            // Device, with the same number of iterations
+            T* dfront = dx;
+            T* dnext  = dy_1;
+
+            gpu_time_used = get_time_us();
+
+            for(rocsparse_int iter = 0; iter < iterations; ++iter)
+            {
+                hipMemcpy(dnext, dfront, sizeof(T) * n, hipMemcpyDeviceToDevice);
+                rocsparse_csrmv_semiring(handle,
+                                         transA,
+                                         semiring,
+                                         m,
+                                         n,
+                                         nnz,
+                                         &one,
+                                         descr,
+                                         sssp ? dval : nullptr,
+                                         dptr,
+                                         dcol,
+                                         info,
+                                         dfront,
+                                         &one,
+                                         dnext);
+                std::swap(dfront, dnext);
+            }
+
+            gpu_time_used = (get_time_us() - gpu_time_used) / 1e3;
+
+            CHECK_HIP_ERROR(hipMemcpy(hnext.data(), dfront, sizeof(T) * n, hipMemcpyDeviceToHost));
+
+            rocsparse_int reached = 0;
+            for(rocsparse_int i = 0; i < n; ++i)
+            {
+                reached += (hfront[i] != zero);
+            }
+
+            printf("%s\titerations\treached\tmsec\tCPU msec\t%s\n",
+                   sssp ? "SSSP" : "BFS",
+                   hnext == hfront ? "" : "MISMATCH");
+            printf("\t%8d\t%8d\t%0.2lf\t%0.2lf\n",
+                   iterations,
+                   reached,
+                   gpu_time_used,
+                   cpu_time_used);
+        }
+    }
+
+    if(adaptive)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_clear(handle, info));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRMV_SEMIRING_HPP
@@ -0,0 +1,828 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_CSRMV_STREAM_HPP
+#define TESTING_CSRMV_STREAM_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <algorithm>
+#include <string>
+#include <sys/types.h>
+#include <unistd.h>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+// CSR matrix in the binary layout of read_bin_matrix, of which only the row pointer array is
+// held in memory. Panels are read from the file on demand.
+struct bin_panel_file
+{
+    FILE* f = nullptr;
+
+    rocsparse_int m   = 0;
+    rocsparse_int n   = 0;
+    rocsparse_int nnz = 0;
+
+    rocsparse_index_base idx_base = rocsparse_index_base_zero;
+
+    // values are stored in double precision
+    std::vector<double> buffer;
+
+    // time spent reading panels in us and number of panels and bytes read
+    double read_time  = 0.0;
+    size_t read_count = 0;
+    size_t read_bytes = 0;
+
+    ~bin_panel_file()
+    {
+        if(f != nullptr)
+        {
+            fclose(f);
+        }
+    }
+};
+
+static rocsparse_int open_bin_panel_file(const char* filename,
+                                         bin_panel_file& file,
+                                         std::vector<rocsparse_int>& ptr,
+                                         rocsparse_index_base idx_base)
+{
+    file.f = fopen(filename, "rb");
+    if(!file.f)
+    {
+        return -1;
+    }
+
+    bool ok = fread(&file.m, sizeof(int), 1, file.f) == 1 &&
+              fread(&file.n, sizeof(int), 1, file.f) == 1 &&
+              fread(&file.nnz, sizeof(int), 1, file.f) == 1;
+
+    if(!ok)
+    {
+        return -1;
+    }
+
+    ptr.resize(file.m + 1);
+
+    if(fread(ptr.data(), sizeof(int), file.m + 1, file.f) != static_cast<size_t>(file.m + 1))
+    {
+        return -1;
+    }
+
+    for(rocsparse_int i = 0; i < file.m + 1; ++i)
+    {
+        ptr[i] += idx_base;
+    }
+
+    file.idx_base = idx_base;
+
+    return 0;
+}
+
+template <typename T>
+rocsparse_status read_bin_panel(rocsparse_int row_begin,
+                                rocsparse_int row_end,
+                                rocsparse_int nnz_begin,
+                                rocsparse_int nnz_end,
+                                rocsparse_int* csr_col_ind,
+                                void* csr_val,
+                                void* user_data)
+{
+    bin_panel_file* file = static_cast<bin_panel_file*>(user_data);
+
+    double start = get_time_us();
+
+    size_t size   = nnz_end - nnz_begin;
+    off_t col_pos = sizeof(int) * (3 + file->m + 1 + static_cast<off_t>(nnz_begin));
+    off_t val_pos = sizeof(int) * (3 + file->m + 1 + static_cast<off_t>(file->nnz)) +
+                    sizeof(double) * static_cast<off_t>(nnz_begin);
+
+    file->buffer.resize(size);
+
+    bool ok = fseeko(file->f, col_pos, SEEK_SET) == 0 &&
+              fread(csr_col_ind, sizeof(int), size, file->f) == size &&
+              fseeko(file->f, val_pos, SEEK_SET) == 0 &&
+              fread(file->buffer.data(), sizeof(double), size, file->f) == size;
+
+    if(!ok)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    T* val = static_cast<T*>(csr_val);
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        csr_col_ind[i] += file->idx_base;
+        val[i] = static_cast<T>(file->buffer[i]);
+    }
+
+    file->read_time += get_time_us() - start;
+    file->read_count += 1;
+    file->read_bytes += (sizeof(int) + sizeof(double)) * size;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+void testing_csrmv_stream_bad_arg(void)
+{
+    rocsparse_int m            = 100;
+    rocsparse_int n            = 100;
+    rocsparse_int nnz          = 0;
+    rocsparse_int panel_nnz    = 100;
+    rocsparse_int safe_size    = 100;
+    T alpha                    = 0.6;
+    T beta                     = 0.2;
+    rocsparse_operation transA = rocsparse_operation_none;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    auto dx_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    T* dx = (T*)dx_managed.get();
+    T* dy = (T*)dy_managed.get();
+
+    if(!dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Row pointer array of an empty matrix, it is held in host memory
+    std::vector<rocsparse_int> hptr(m + 1, 0);
+
+    bin_panel_file file;
+    rocsparse_csr_panel_read read = read_bin_panel<T>;
+
+    // testing for(nullptr == hptr)
+    {
+        rocsparse_int* hptr_null = nullptr;
+
+        status = rocsparse_csrmv_stream(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        hptr_null,
+                                        panel_nnz,
+                                        read,
+                                        &file,
+                                        dx,
+                                        &beta,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: hptr is nullptr");
+    }
+    // testing for(nullptr == read)
+    {
+        rocsparse_csr_panel_read read_null = nullptr;
+
+        status = rocsparse_csrmv_stream(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        hptr.data(),
+                                        panel_nnz,
+                                        read_null,
+                                        &file,
+                                        dx,
+                                        &beta,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: read is nullptr");
+    }
+    // testing for(nullptr == dx)
+    {
+        T* dx_null = nullptr;
+
+        status = rocsparse_csrmv_stream(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        hptr.data(),
+                                        panel_nnz,
+                                        read,
+                                        &file,
+                                        dx_null,
+                                        &beta,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_csrmv_stream(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        hptr.data(),
+                                        panel_nnz,
+                                        read,
+                                        &file,
+                                        dx,
+                                        &beta,
+                                        dy_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dy is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_csrmv_stream(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        d_alpha_null,
+                                        descr,
+                                        hptr.data(),
+                                        panel_nnz,
+                                        read,
+                                        &file,
+                                        dx,
+                                        &beta,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == d_beta)
+    {
+        T* d_beta_null = nullptr;
+
+        status = rocsparse_csrmv_stream(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        hptr.data(),
+                                        panel_nnz,
+                                        read,
+                                        &file,
+                                        dx,
+                                        d_beta_null,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: beta is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrmv_stream(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr_null,
+                                        hptr.data(),
+                                        panel_nnz,
+                                        read,
+                                        &file,
+                                        dx,
+                                        &beta,
+                                        dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(panel_nnz <= 0)
+    {
+        status = rocsparse_csrmv_stream(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        hptr.data(),
+                                        0,
+                                        read,
+                                        &file,
+                                        dx,
+                                        &beta,
+                                        dy);
+        verify_rocsparse_status_invalid_size(status, "Error: panel_nnz <= 0");
+    }
+    // testing for(hptr[m] != nnz)
+    {
+        status = rocsparse_csrmv_stream(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        1,
+                                        &alpha,
+                                        descr,
+                                        hptr.data(),
+                                        panel_nnz,
+                                        read,
+                                        &file,
+                                        dx,
+                                        &beta,
+                                        dy);
+        verify_rocsparse_status_invalid_size(status, "Error: hptr[m] != nnz");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrmv_stream(handle_null,
+                                        transA,
+                                        m,
+                                        n,
+                                        nnz,
+                                        &alpha,
+                                        descr,
+                                        hptr.data(),
+                                        panel_nnz,
+                                        read,
+                                        &file,
+                                        dx,
+                                        &beta,
+                                        dy);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_csrmv_stream(Arguments argus)
+{
+    rocsparse_int safe_size       = 100;
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    rocsparse_int panel_nnz       = argus.panel_nnz;
+    T h_alpha                     = argus.alpha;
+    T h_beta                      = argus.beta;
+    rocsparse_operation transA    = rocsparse_operation_none;
+    rocsparse_index_base idx_base = argus.idx_base;
+    std::string filename          = "";
+    rocsparse_status status;
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto dx_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        T* dx = (T*)dx_managed.get();
+        T* dy = (T*)dy_managed.get();
+
+        if(!dx || !dy)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error, "!dx || !dy");
+            return rocsparse_status_memory_error;
+        }
+
+        std::vector<rocsparse_int> hptr(std::max(m, 0) + 1, idx_base);
+
+        bin_panel_file file;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_csrmv_stream(handle,
+                                        transA,
+                                        m,
+                                        n,
+                                        0,
+                                        &h_alpha,
+                                        descr,
+                                        hptr.data(),
+                                        std::max(panel_nnz, 1),
+                                        read_bin_panel<T>,
+                                        &file,
+                                        dx,
+                                        &h_beta,
+                                        dy);
+
+        if(m < 0 || n < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<T> hval;
+
+    // Binary files are streamed as they are, all other matrices are written to a temporary
+    // binary file first
+    std::string binfile = "";
+    bool temporary      = true;
+
+    if(filename.size() > 4 && filename.compare(filename.size() - 4, 4, ".bin") == 0)
+    {
+        binfile   = filename;
+        temporary = false;
+    }
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(load_matrix_csr(
+           argus, binfile, filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    if(temporary)
+    {
+        char path[] = "/tmp/rocsparse_csrmv_stream_XXXXXX";
+        int fd      = mkstemp(path);
+
+        if(fd < 0)
+        {
+            fprintf(stderr, "Cannot create temporary file\n");
+            return rocsparse_status_internal_error;
+        }
+
+        close(fd);
+        binfile = path;
+
+        if(write_bin_matrix(
+               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
+        {
+            remove(binfile.c_str());
+            fprintf(stderr, "Cannot open [write] %s\n", binfile.c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+
+    // Row pointer array of the streamed matrix, the panels are read on demand
+    bin_panel_file file;
+    std::vector<rocsparse_int> hptr;
+
+    rocsparse_int err = open_bin_panel_file(binfile.c_str(), file, hptr, idx_base);
+
+    // The file stays readable through the open handle
+    if(temporary)
+    {
+        remove(binfile.c_str());
+    }
+
+    if(err != 0)
+    {
+        fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+        return rocsparse_status_internal_error;
+    }
+
+    // By default, the matrix is split into eight panels
+    if(panel_nnz <= 0)
+    {
+        panel_nnz = nnz / 8 + 1;
+    }
+
+    std::vector<T> hx(n);
+    std::vector<T> hy(m);
+
+    rocsparse_init<T>(hx, 1, n);
+    rocsparse_init<T>(hy, 1, m);
+
+    // allocate memory on device
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    T* dx      = (T*)dx_managed.get();
+    T* dy_1    = (T*)dy_1_managed.get();
+    T* dy_2    = (T*)dy_2_managed.get();
+    T* d_alpha = (T*)d_alpha_managed.get();
+    T* d_beta  = (T*)d_beta_managed.get();
+
+    if(!dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dx || !dy_1 || !dy_2 || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_stream(handle,
+                                                     transA,
+                                                     m,
+                                                     n,
+                                                     nnz,
+                                                     &h_alpha,
+                                                     descr,
+                                                     hptr.data(),
+                                                     panel_nnz,
+                                                     read_bin_panel<T>,
+                                                     &file,
+                                                     dx,
+                                                     &h_beta,
+                                                     dy_1));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_stream(handle,
+                                                     transA,
+                                                     m,
+                                                     n,
+                                                     nnz,
+                                                     d_alpha,
+                                                     descr,
+                                                     hptr.data(),
+                                                     panel_nnz,
+                                                     read_bin_panel<T>,
+                                                     &file,
+                                                     dx,
+                                                     d_beta,
+                                                     dy_2));
+
+        std::vector<T> hy_gold(hy);
+        std::vector<T> hy_1(m);
+        std::vector<T> hy_2(m);
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        // CPU
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base;
+                ++j)
+            {
+                sum = std::fma(hval[j], hx[hcol_ind[j] - idx_base], sum);
+            }
+
+            hy_gold[i] = (h_beta != static_cast<T>(0)) ? std::fma(h_beta, hy_gold[i], h_alpha * sum)
+                                                       : h_alpha * sum;
+        }
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Streamed, including reading the panels from the file
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrmv_stream(handle,
+                                   transA,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &h_alpha,
+                                   descr,
+                                   hptr.data(),
+                                   panel_nnz,
+                                   read_bin_panel<T>,
+                                   &file,
+                                   dx,
+                                   &h_beta,
+                                   dy_1);
+        }
+
+        file.read_time  = 0.0;
+        file.read_count = 0;
+        file.read_bytes = 0;
+
+        double stream_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csrmv_stream(handle,
+                                   transA,
+                                   m,
+                                   n,
+                                   nnz,
+                                   &h_alpha,
+                                   descr,
+                                   hptr.data(),
+                                   panel_nnz,
+                                   read_bin_panel<T>,
+                                   &file,
+                                   dx,
+                                   &h_beta,
+                                   dy_1);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        stream_time_used = (get_time_us() - stream_time_used) / (number_hot_calls * 1e3);
+
+        double read_time_used = file.read_time / (number_hot_calls * 1e3);
+        size_t panels         = file.read_count / number_hot_calls;
+
+        // Host to device copies of the panels from pinned memory, without reading
+        size_t panel_bytes = (sizeof(rocsparse_int) + sizeof(T)) * panel_nnz;
+        size_t copy_bytes  = (sizeof(rocsparse_int) + sizeof(T)) * nnz +
+                            sizeof(rocsparse_int) * (m + panels);
+
+        void* hbuffer = nullptr;
+        CHECK_HIP_ERROR(hipHostMalloc(&hbuffer, panel_bytes));
+
+        auto dbuffer_managed = rocsparse_unique_ptr{device_malloc(panel_bytes), device_free};
+        void* dbuffer        = dbuffer_managed.get();
+
+        if(!dbuffer)
+        {
+            hipHostFree(hbuffer);
+            verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+            return rocsparse_status_memory_error;
+        }
+
+        double copy_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            for(size_t offset = 0; offset < copy_bytes; offset += panel_bytes)
+            {
+                hipMemcpyAsync(dbuffer,
+                               hbuffer,
+                               std::min(panel_bytes, copy_bytes - offset),
+                               hipMemcpyHostToDevice,
+                               0);
+            }
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        copy_time_used = (get_time_us() - copy_time_used) / (number_hot_calls * 1e3);
+
+        CHECK_HIP_ERROR(hipHostFree(hbuffer));
+
+        // Multiplication of the resident matrix
+        auto dptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+        auto dcol_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T* dval             = (T*)dval_managed.get();
+
+        if(!dptr || !dcol || !dval)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrmv(handle,
+                            transA,
+                            m,
+                            n,
+                            nnz,
+                            &h_alpha,
+                            descr,
+                            dval,
+                            dptr,
+                            dcol,
+                            nullptr,
+                            dx,
+                            &h_beta,
+                            dy_2);
+        }
+
+        double gpu_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csrmv(handle,
+                            transA,
+                            m,
+                            n,
+                            nnz,
+                            &h_alpha,
+                            descr,
+                            dval,
+                            dptr,
+                            dcol,
+                            nullptr,
+                            dx,
+                            &h_beta,
+                            dy_2);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // Overlap is the fraction of the time that could be hidden behind the slowest stage
+        // and actually was hidden
+        double serial_time_used = read_time_used + copy_time_used + gpu_time_used;
+        double hidden_time_used =
+            serial_time_used - std::max(read_time_used, std::max(copy_time_used, gpu_time_used));
+
+        double overlap = (hidden_time_used > 0.0)
+                             ? (serial_time_used - stream_time_used) / hidden_time_used
+                             : 0.0;
+
+        overlap = std::min(std::max(overlap, 0.0), 1.0);
+
+        double bandwidth = copy_bytes / stream_time_used / 1e6;
+
+        printf("m\t\tn\t\tnnz\t\tpanels\tGB/s\tmsec\tread msec\tcopy msec\tcsrmv msec"
+               "\tserial msec\toverlap\n");
+        printf("%8d\t%8d\t%9d\t%zu\t%0.2lf\t%0.3lf\t%0.3lf\t\t%0.3lf\t\t%0.3lf\t\t%0.3lf"
+               "\t\t%0.1lf%%\n",
+               m,
+               n,
+               nnz,
+               panels,
+               bandwidth,
+               stream_time_used,
+               read_time_used,
+               copy_time_used,
+               gpu_time_used,
+               serial_time_used,
+               overlap * 100.0);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRMV_STREAM_HPP
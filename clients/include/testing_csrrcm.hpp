@@ -0,0 +1,855 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TESTING_CSRRCM_HPP
+#define TESTING_CSRRCM_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "roofline.hpp"
+#include "unit.hpp"
+
+#include <rocsparse.h>
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+void testing_csrrcm_bad_arg(void)
+{
+    rocsparse_int m         = 100;
+    rocsparse_int nnz       = 100;
+    rocsparse_int safe_size = 100;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    size_t buffer_size = 0;
+
+    auto csr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto perm_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_row_ptr_B_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto csr_col_ind_B_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto map_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto buffer_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+    rocsparse_int* csr_row_ptr   = (rocsparse_int*)csr_row_ptr_managed.get();
+    rocsparse_int* csr_col_ind   = (rocsparse_int*)csr_col_ind_managed.get();
+    rocsparse_int* perm          = (rocsparse_int*)perm_managed.get();
+    rocsparse_int* csr_row_ptr_B = (rocsparse_int*)csr_row_ptr_B_managed.get();
+    rocsparse_int* csr_col_ind_B = (rocsparse_int*)csr_col_ind_B_managed.get();
+    rocsparse_int* map           = (rocsparse_int*)map_managed.get();
+    void* buffer                 = (void*)buffer_managed.get();
+
+    if(!csr_row_ptr || !csr_col_ind || !perm || !csr_row_ptr_B || !csr_col_ind_B || !map ||
+       !buffer)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Testing csrrcm for bad args
+
+    // Testing for (csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_csrrcm(handle, m, nnz, descr, csr_row_ptr_null, csr_col_ind, perm);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+
+    // Testing for (csr_col_ind == nullptr)
+    {
+        rocsparse_int* csr_col_ind_null = nullptr;
+
+        status = rocsparse_csrrcm(handle, m, nnz, descr, csr_row_ptr, csr_col_ind_null, perm);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+
+    // Testing for (perm == nullptr)
+    {
+        rocsparse_int* perm_null = nullptr;
+
+        status = rocsparse_csrrcm(handle, m, nnz, descr, csr_row_ptr, csr_col_ind, perm_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: perm is nullptr");
+    }
+
+    // Testing for (descr == nullptr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrrcm(handle, m, nnz, descr_null, csr_row_ptr, csr_col_ind, perm);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+
+    // Testing for (handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrrcm(handle_null, m, nnz, descr, csr_row_ptr, csr_col_ind, perm);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // Testing csrpermute_buffer_size for bad args
+
+    // Testing for (csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_csrpermute_buffer_size(
+            handle, m, nnz, csr_row_ptr_null, csr_col_ind, &buffer_size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+
+    // Testing for (csr_col_ind == nullptr)
+    {
+        rocsparse_int* csr_col_ind_null = nullptr;
+
+        status = rocsparse_csrpermute_buffer_size(
+            handle, m, nnz, csr_row_ptr, csr_col_ind_null, &buffer_size);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+
+    // Testing for (buffer_size == nullptr)
+    {
+        size_t* buffer_size_null = nullptr;
+
+        status = rocsparse_csrpermute_buffer_size(
+            handle, m, nnz, csr_row_ptr, csr_col_ind, buffer_size_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: buffer_size is nullptr");
+    }
+
+    // Testing for (handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrpermute_buffer_size(
+            handle_null, m, nnz, csr_row_ptr, csr_col_ind, &buffer_size);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // Testing csrpermute for bad args
+
+    // Testing for (csr_row_ptr == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_null = nullptr;
+
+        status = rocsparse_csrpermute(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_row_ptr_null,
+                                      csr_col_ind,
+                                      perm,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      map,
+                                      buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr is nullptr");
+    }
+
+    // Testing for (csr_col_ind == nullptr)
+    {
+        rocsparse_int* csr_col_ind_null = nullptr;
+
+        status = rocsparse_csrpermute(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_row_ptr,
+                                      csr_col_ind_null,
+                                      perm,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      map,
+                                      buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind is nullptr");
+    }
+
+    // Testing for (perm == nullptr)
+    {
+        rocsparse_int* perm_null = nullptr;
+
+        status = rocsparse_csrpermute(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      perm_null,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      map,
+                                      buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: perm is nullptr");
+    }
+
+    // Testing for (csr_row_ptr_B == nullptr)
+    {
+        rocsparse_int* csr_row_ptr_B_null = nullptr;
+
+        status = rocsparse_csrpermute(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      perm,
+                                      csr_row_ptr_B_null,
+                                      csr_col_ind_B,
+                                      map,
+                                      buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_row_ptr_B is nullptr");
+    }
+
+    // Testing for (csr_col_ind_B == nullptr)
+    {
+        rocsparse_int* csr_col_ind_B_null = nullptr;
+
+        status = rocsparse_csrpermute(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      perm,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B_null,
+                                      map,
+                                      buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: csr_col_ind_B is nullptr");
+    }
+
+    // Testing for (map == nullptr)
+    {
+        rocsparse_int* map_null = nullptr;
+
+        status = rocsparse_csrpermute(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      perm,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      map_null,
+                                      buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: map is nullptr");
+    }
+
+    // Testing for (buffer == nullptr)
+    {
+        void* buffer_null = nullptr;
+
+        status = rocsparse_csrpermute(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      perm,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      map,
+                                      buffer_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: buffer is nullptr");
+    }
+
+    // Testing for (descr == nullptr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csrpermute(handle,
+                                      m,
+                                      nnz,
+                                      descr_null,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      perm,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      map,
+                                      buffer);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+
+    // Testing for (handle == nullptr)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrpermute(handle_null,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      perm,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      map,
+                                      buffer);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+// Bandwidth of a CSR matrix, max |i - j| over all entries
+static rocsparse_int csrrcm_bandwidth(rocsparse_int m,
+                                      const std::vector<rocsparse_int>& csr_row_ptr,
+                                      const std::vector<rocsparse_int>& csr_col_ind,
+                                      rocsparse_index_base idx_base)
+{
+    rocsparse_int bandwidth = 0;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - idx_base; j < csr_row_ptr[i + 1] - idx_base; ++j)
+        {
+            bandwidth = std::max(bandwidth, std::abs(csr_col_ind[j] - idx_base - i));
+        }
+    }
+
+    return bandwidth;
+}
+
+// Time csrmv with a plain CSR matrix, returns msec per call
+template <typename T>
+static double csrrcm_time_csrmv(rocsparse_handle handle,
+                                rocsparse_int m,
+                                rocsparse_int nnz,
+                                const rocsparse_mat_descr descr,
+                                const T* csr_val,
+                                const rocsparse_int* csr_row_ptr,
+                                const rocsparse_int* csr_col_ind,
+                                const T* x,
+                                T* y,
+                                rocsparse_int number_hot_calls)
+{
+    rocsparse_int number_cold_calls = 2;
+
+    T h_alpha = static_cast<T>(1);
+    T h_beta  = static_cast<T>(0);
+
+    for(rocsparse_int iter = 0; iter < number_cold_calls; ++iter)
+    {
+        rocsparse_csrmv(handle,
+                        rocsparse_operation_none,
+                        m,
+                        m,
+                        nnz,
+                        &h_alpha,
+                        descr,
+                        csr_val,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        nullptr,
+                        x,
+                        &h_beta,
+                        y);
+    }
+
+    double gpu_time_used = get_time_us();
+
+    for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+    {
+        rocsparse_csrmv(handle,
+                        rocsparse_operation_none,
+                        m,
+                        m,
+                        nnz,
+                        &h_alpha,
+                        descr,
+                        csr_val,
+                        csr_row_ptr,
+                        csr_col_ind,
+                        nullptr,
+                        x,
+                        &h_beta,
+                        y);
+    }
+
+    return (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+}
+
+template <typename T>
+rocsparse_status testing_csrrcm(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.M;
+    rocsparse_int safe_size       = 100;
+    rocsparse_index_base idx_base = argus.idx_base;
+    std::string binfile           = "";
+    std::string filename          = "";
+    rocsparse_status status;
+
+    // When in testing mode, M == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    if(m == -99 && argus.timing == 0)
+    {
+        binfile = argus.filename;
+        m = n = safe_size;
+    }
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    size_t buffer_size = 0;
+
+    double scale = 0.02;
+    if(m > 1000)
+    {
+        scale = 2.0 / m;
+    }
+    rocsparse_int nnz = m * scale * m;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || nnz <= 0)
+    {
+        auto csr_row_ptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto csr_col_ind_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto perm_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto map_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto buffer_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(char) * safe_size), device_free};
+
+        rocsparse_int* csr_row_ptr = (rocsparse_int*)csr_row_ptr_managed.get();
+        rocsparse_int* csr_col_ind = (rocsparse_int*)csr_col_ind_managed.get();
+        rocsparse_int* perm        = (rocsparse_int*)perm_managed.get();
+        rocsparse_int* map         = (rocsparse_int*)map_managed.get();
+        void* buffer               = (void*)buffer_managed.get();
+
+        if(!csr_row_ptr || !csr_col_ind || !perm || !map || !buffer)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!csr_row_ptr || !csr_col_ind || !perm || !map || "
+                                            "!buffer");
+            return rocsparse_status_memory_error;
+        }
+
+        // Rows of a matrix without entries
+        CHECK_HIP_ERROR(hipMemset(csr_row_ptr, 0, sizeof(rocsparse_int) * safe_size));
+
+        status = rocsparse_csrrcm(handle, m, nnz, descr, csr_row_ptr, csr_col_ind, perm);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        status = rocsparse_csrpermute_buffer_size(
+            handle, m, nnz, csr_row_ptr, csr_col_ind, &buffer_size);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        status = rocsparse_csrpermute(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      perm,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      map,
+                                      buffer);
+
+        if(m < 0 || nnz < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || nnz < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && nnz >= 0");
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    // Sample initial COO matrix on CPU
+    srand(12345ULL);
+    if(load_matrix_csr(
+           argus, binfile, filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) !=
+       0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    // Symmetric permutations require square matrices
+    if(m != n)
+    {
+        fprintf(stderr, "csrrcm requires a square matrix, got %d x %d\n", m, n);
+        return rocsparse_status_invalid_size;
+    }
+
+    // Allocate memory on the device
+    auto dcsr_row_ptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcsr_col_ind_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcsr_val_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dperm_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * m), device_free};
+    auto dcsr_row_ptr_B_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcsr_col_ind_B_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dcsr_val_B_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dmap_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+
+    rocsparse_int* dcsr_row_ptr   = (rocsparse_int*)dcsr_row_ptr_managed.get();
+    rocsparse_int* dcsr_col_ind   = (rocsparse_int*)dcsr_col_ind_managed.get();
+    T* dcsr_val                   = (T*)dcsr_val_managed.get();
+    rocsparse_int* dperm          = (rocsparse_int*)dperm_managed.get();
+    rocsparse_int* dcsr_row_ptr_B = (rocsparse_int*)dcsr_row_ptr_B_managed.get();
+    rocsparse_int* dcsr_col_ind_B = (rocsparse_int*)dcsr_col_ind_B_managed.get();
+    T* dcsr_val_B                 = (T*)dcsr_val_B_managed.get();
+    rocsparse_int* dmap           = (rocsparse_int*)dmap_managed.get();
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dperm || !dcsr_row_ptr_B ||
+       !dcsr_col_ind_B || !dcsr_val_B || !dmap)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dperm || "
+                                        "!dcsr_row_ptr_B || !dcsr_col_ind_B || !dcsr_val_B || "
+                                        "!dmap");
+        return rocsparse_status_memory_error;
+    }
+
+    // Copy data from host to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain buffer size
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrpermute_buffer_size(
+        handle, m, nnz, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+
+    // Allocate buffer on the device
+    auto dbuffer_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(char) * buffer_size), device_free};
+
+    void* dbuffer = (void*)dbuffer_managed.get();
+
+    if(!dbuffer)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error, "!dbuffer");
+        return rocsparse_status_memory_error;
+    }
+
+    if(argus.unit_check)
+    {
+        // Compute ordering
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrrcm(handle, m, nnz, descr, dcsr_row_ptr, dcsr_col_ind, dperm));
+
+        // Permute the matrix
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrpermute(handle,
+                                                   m,
+                                                   nnz,
+                                                   descr,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   dperm,
+                                                   dcsr_row_ptr_B,
+                                                   dcsr_col_ind_B,
+                                                   dmap,
+                                                   dbuffer));
+        CHECK_ROCSPARSE_ERROR(rocsparse_gthr(
+            handle, nnz, dcsr_val, dcsr_val_B, dmap, rocsparse_index_base_zero));
+
+        // Copy output from device to host
+        std::vector<rocsparse_int> hperm(m);
+        std::vector<rocsparse_int> hcsr_row_ptr_B(m + 1);
+        std::vector<rocsparse_int> hcsr_col_ind_B(nnz);
+        std::vector<rocsparse_int> hmap(nnz);
+        std::vector<T> hcsr_val_B(nnz);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hperm.data(), dperm, sizeof(rocsparse_int) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_B.data(),
+                                  dcsr_row_ptr_B,
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_B.data(),
+                                  dcsr_col_ind_B,
+                                  sizeof(rocsparse_int) * nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hmap.data(), dmap, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_B.data(), dcsr_val_B, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        // The ordering has to be a permutation
+        std::vector<rocsparse_int> hperm_sorted = hperm;
+        std::vector<rocsparse_int> hidentity(m);
+
+        std::sort(hperm_sorted.begin(), hperm_sorted.end());
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hidentity[i] = i;
+        }
+
+        unit_check_general(1, m, 1, hidentity.data(), hperm_sorted.data());
+
+        // Host permutation, using the ordering computed by the device
+        std::vector<rocsparse_int> hinvperm(m);
+        std::vector<rocsparse_int> hcsr_row_ptr_gold(m + 1);
+        std::vector<rocsparse_int> hcsr_col_ind_gold(nnz);
+        std::vector<rocsparse_int> hmap_gold(nnz);
+        std::vector<T> hcsr_val_gold(nnz);
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hinvperm[hperm[i]] = i;
+        }
+
+        hcsr_row_ptr_gold[0] = idx_base;
+
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            rocsparse_int row_begin = hcsr_row_ptr[hperm[i]] - idx_base;
+            rocsparse_int row_end   = hcsr_row_ptr[hperm[i] + 1] - idx_base;
+            rocsparse_int offset    = hcsr_row_ptr_gold[i] - idx_base;
+
+            std::vector<std::pair<rocsparse_int, rocsparse_int>> row;
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                row.push_back(std::make_pair(hinvperm[hcsr_col_ind[j] - idx_base], j));
+            }
+
+            std::sort(row.begin(), row.end());
+
+            for(size_t k = 0; k < row.size(); ++k)
+            {
+                hcsr_col_ind_gold[offset + k] = row[k].first + idx_base;
+                hmap_gold[offset + k]         = row[k].second;
+                hcsr_val_gold[offset + k]     = hcsr_val[row[k].second];
+            }
+
+            hcsr_row_ptr_gold[i + 1] = hcsr_row_ptr_gold[i] + row_end - row_begin;
+        }
+
+        // Unit check
+        unit_check_general(1, m + 1, 1, hcsr_row_ptr_gold.data(), hcsr_row_ptr_B.data());
+        unit_check_general(1, nnz, 1, hcsr_col_ind_gold.data(), hcsr_col_ind_B.data());
+        unit_check_general(1, nnz, 1, hmap_gold.data(), hmap.data());
+        unit_check_general(1, nnz, 1, hcsr_val_gold.data(), hcsr_val_B.data());
+    }
+
+    if(argus.timing)
+    {
+        rocsparse_int number_hot_calls = argus.iters;
+
+        // Ordering, computed on the host and thus timed without warm up
+        double gpu_time_used = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_csrrcm(handle, m, nnz, descr, dcsr_row_ptr, dcsr_col_ind, dperm);
+        }
+
+        double rcm_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // Permutation of structure and values
+        gpu_time_used = get_time_us();
+
+        for(rocsparse_int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            rocsparse_csrpermute(handle,
+                                 m,
+                                 nnz,
+                                 descr,
+                                 dcsr_row_ptr,
+                                 dcsr_col_ind,
+                                 dperm,
+                                 dcsr_row_ptr_B,
+                                 dcsr_col_ind_B,
+                                 dmap,
+                                 dbuffer);
+            rocsparse_gthr(handle, nnz, dcsr_val, dcsr_val_B, dmap, rocsparse_index_base_zero);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        double permute_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // SpMV before and after reordering
+        std::vector<T> hx(m);
+        rocsparse_init<T>(hx, 1, m);
+
+        auto dx_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+        auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+        T* dx = (T*)dx_managed.get();
+        T* dy = (T*)dy_managed.get();
+
+        if(!dx || !dy)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error, "!dx || !dy");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        double spmv_time_A = csrrcm_time_csrmv(
+            handle, m, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, dx, dy, number_hot_calls);
+        double spmv_time_B = csrrcm_time_csrmv(handle,
+                                               m,
+                                               nnz,
+                                               descr,
+                                               dcsr_val_B,
+                                               dcsr_row_ptr_B,
+                                               dcsr_col_ind_B,
+                                               dx,
+                                               dy,
+                                               number_hot_calls);
+
+        std::vector<rocsparse_int> hcsr_row_ptr_B(m + 1);
+        std::vector<rocsparse_int> hcsr_col_ind_B(nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_B.data(),
+                                  dcsr_row_ptr_B,
+                                  sizeof(rocsparse_int) * (m + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_B.data(),
+                                  dcsr_col_ind_B,
+                                  sizeof(rocsparse_int) * nnz,
+                                  hipMemcpyDeviceToHost));
+
+        rocsparse_int bandwidth_A = csrrcm_bandwidth(m, hcsr_row_ptr, hcsr_col_ind, idx_base);
+        rocsparse_int bandwidth_B = csrrcm_bandwidth(m, hcsr_row_ptr_B, hcsr_col_ind_B, idx_base);
+
+        size_t flops   = 2.0 * nnz;
+        size_t bytes_A = roofline_csrmv_bytes<T>(m,
+                                                 nnz,
+                                                 hcsr_row_ptr.data(),
+                                                 hcsr_col_ind.data(),
+                                                 idx_base,
+                                                 static_cast<T>(0),
+                                                 false);
+        size_t bytes_B = roofline_csrmv_bytes<T>(m,
+                                                 nnz,
+                                                 hcsr_row_ptr_B.data(),
+                                                 hcsr_col_ind_B.data(),
+                                                 idx_base,
+                                                 static_cast<T>(0),
+                                                 false);
+
+        printf("m\t\tnnz\t\tbw\t\tbw rcm\t\trcm msec\tpermute msec\n");
+        printf("%8d\t%9d\t%8d\t%8d\t%0.2lf\t\t%0.2lf\n",
+               m,
+               nnz,
+               bandwidth_A,
+               bandwidth_B,
+               rcm_time_used,
+               permute_time_used);
+
+        printf("csrmv\t\tGFlops\tGB/s\tmsec\n");
+        printf("original\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               flops / spmv_time_A / 1e6,
+               bytes_A / spmv_time_A / 1e6,
+               spmv_time_A);
+        printf("rcm\t\t%0.2lf\t%0.2lf\t%0.2lf\n",
+               flops / spmv_time_B / 1e6,
+               bytes_B / spmv_time_B / 1e6,
+               spmv_time_B);
+
+        roofline_report(argus,
+                        {"csrmv",
+                         roofline_precision<T>(),
+                         "csr",
+                         m,
+                         m,
+                         nnz,
+                         static_cast<double>(flops),
+                         static_cast<double>(bytes_A),
+                         spmv_time_A});
+        roofline_report(argus,
+                        {"csrmv",
+                         roofline_precision<T>(),
+                         "csr-rcm",
+                         m,
+                         m,
+                         nnz,
+                         static_cast<double>(flops),
+                         static_cast<double>(bytes_B),
+                         spmv_time_B});
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_CSRRCM_HPP
@@ -28,6 +28,7 @@
 #include "rocsparse_test_unique_ptr.hpp"
 #include "rocsparse.hpp"
 #include "utility.hpp"
+#include "roofline.hpp"
 #include "unit.hpp"
 
 #include <string>
@@ -405,6 +406,25 @@ void testing_csrsv_bad_arg(void)
         verify_rocsparse_status_invalid_handle(status);
     }
 
+    // testing for transposed and conjugate transposed systems, which are not supported
+    rocsparse_operation trans_range[] = {
+        rocsparse_operation_transpose, rocsparse_operation_conjugate_transpose};
+
+    for(rocsparse_operation trans : trans_range)
+    {
+        status = rocsparse_csrsv_buffer_size(
+            handle, trans, m, nnz, descr, dval, dptr, dcol, info, &size);
+        verify_rocsparse_status_not_implemented(status, "Error: buffer_size with trans");
+
+        status = rocsparse_csrsv_analysis(
+            handle, trans, m, nnz, descr, dval, dptr, dcol, info, analysis, solve, dbuffer);
+        verify_rocsparse_status_not_implemented(status, "Error: analysis with trans");
+
+        status = rocsparse_csrsv_solve(
+            handle, trans, m, nnz, &h_alpha, descr, dval, dptr, dcol, info, dx, dy, solve, dbuffer);
+        verify_rocsparse_status_not_implemented(status, "Error: solve with trans");
+    }
+
     // testing rocsparse_csrsv_zero_pivot
     rocsparse_int position;
 
@@ -620,51 +640,11 @@ rocsparse_status testing_csrsv(Arguments argus)
 
     // Initial Data on CPU
     srand(12345ULL);
-    if(binfile != "")
-    {
-        if(read_bin_matrix(
-               binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
-    }
-    else if(argus.laplacian)
-    {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
-        nnz   = hcsr_row_ptr[m];
-    }
-    else
+    if(load_matrix_csr(
+           argus, binfile, filename, m, n, nnz, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base) !=
+       0)
     {
-        std::vector<rocsparse_int> hcoo_row_ind;
-
-        if(filename != "")
-        {
-            if(read_mtx_matrix(
-                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base) !=
-               0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind, hcsr_val, idx_base);
-        }
-
-        // Convert COO to CSR
-        hcsr_row_ptr.resize(m + 1, 0);
-        for(rocsparse_int i = 0; i < nnz; ++i)
-        {
-            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
-        }
-
-        hcsr_row_ptr[0] = idx_base;
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
-        }
+        return rocsparse_status_internal_error;
     }
 
     std::vector<T> hx(m);
@@ -923,10 +903,21 @@ rocsparse_status testing_csrsv(Arguments argus)
         printf("%8d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t%0.2lf\n",
                m,
                nnz,
-               h_alpha,
+               argus.alpha,
                gpu_gflops,
                bandwidth,
                gpu_time_used);
+
+        roofline_report(argus,
+                        {"csrsv",
+                         roofline_precision<T>(),
+                         "csr",
+                         m,
+                         m,
+                         nnz,
+                         static_cast<double>(flops),
+                         static_cast<double>(int_data + flt_data),
+                         gpu_time_used});
     }
 
     CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
@@ -431,63 +431,18 @@ rocsparse_status testing_ell2csr(Arguments argus)
 
     // Sample initial CSR matrix on CPU
     srand(12345ULL);
-    if(binfile != "")
+    if(load_matrix_csr(argus,
+                       binfile,
+                       filename,
+                       m,
+                       n,
+                       nnz,
+                       hcsr_row_ptr_gold,
+                       hcsr_col_ind_gold,
+                       hcsr_val_gold,
+                       csr_base) != 0)
     {
-        if(read_bin_matrix(binfile.c_str(),
-                           m,
-                           n,
-                           nnz,
-                           hcsr_row_ptr_gold,
-                           hcsr_col_ind_gold,
-                           hcsr_val_gold,
-                           csr_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
-    }
-    else if(argus.laplacian)
-    {
-        m = n = gen_2d_laplacian(
-            argus.laplacian, hcsr_row_ptr_gold, hcsr_col_ind_gold, hcsr_val_gold, csr_base);
-        nnz = hcsr_row_ptr_gold[m];
-    }
-    else
-    {
-        std::vector<rocsparse_int> hcoo_row_ind;
-
-        if(filename != "")
-        {
-            if(read_mtx_matrix(filename.c_str(),
-                               m,
-                               n,
-                               nnz,
-                               hcoo_row_ind,
-                               hcsr_col_ind_gold,
-                               hcsr_val_gold,
-                               csr_base) != 0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcsr_col_ind_gold, hcsr_val_gold, csr_base);
-        }
-
-        // Convert COO to CSR
-        hcsr_row_ptr_gold.resize(m + 1, 0);
-        for(rocsparse_int i = 0; i < nnz; ++i)
-        {
-            ++hcsr_row_ptr_gold[hcoo_row_ind[i] + 1 - csr_base];
-        }
-
-        hcsr_row_ptr_gold[0] = csr_base;
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            hcsr_row_ptr_gold[i + 1] += hcsr_row_ptr_gold[i];
-        }
+        return rocsparse_status_internal_error;
     }
 
     rocsparse_int csr_nnz_gold = nnz;
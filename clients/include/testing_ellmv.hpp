@@ -28,6 +28,7 @@
 #include "rocsparse_test_unique_ptr.hpp"
 #include "rocsparse.hpp"
 #include "utility.hpp"
+#include "roofline.hpp"
 #include "unit.hpp"
 
 #include <string>
@@ -83,14 +84,6 @@ void testing_ellmv_bad_arg(void)
             handle, transA, m, n, &alpha, descr, dval, dcol_null, ell_width, dx, &beta, dy);
         verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
     }
-    // testing for(nullptr == dval)
-    {
-        T* dval_null = nullptr;
-
-        status = rocsparse_ellmv(
-            handle, transA, m, n, &alpha, descr, dval_null, dcol, ell_width, dx, &beta, dy);
-        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
-    }
     // testing for(nullptr == dx)
     {
         T* dx_null = nullptr;
@@ -224,56 +217,15 @@ rocsparse_status testing_ellmv(Arguments argus)
 
     // Host structures
     std::vector<rocsparse_int> hcsr_row_ptr;
-    std::vector<rocsparse_int> hcoo_row_ind;
     std::vector<rocsparse_int> hcol_ind;
     std::vector<T> hval;
 
     // Initial Data on CPU
     srand(12345ULL);
-    if(binfile != "")
+    if(load_matrix_csr(
+           argus, binfile, filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
     {
-        if(read_bin_matrix(binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
-    }
-    else if(argus.laplacian)
-    {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcol_ind, hval, idx_base);
-        nnz   = hcsr_row_ptr[m];
-    }
-    else
-    {
-        if(filename != "")
-        {
-            if(read_mtx_matrix(
-                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base) != 0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base);
-        }
-
-        // Convert COO to CSR
-        if(!argus.laplacian)
-        {
-            hcsr_row_ptr.resize(m + 1, 0);
-            for(rocsparse_int i = 0; i < nnz; ++i)
-            {
-                ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
-            }
-
-            hcsr_row_ptr[0] = idx_base;
-            for(rocsparse_int i = 0; i < m; ++i)
-            {
-                hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
-            }
-        }
+        return rocsparse_status_internal_error;
     }
 
     // Convert CSR to ELL
@@ -308,13 +260,17 @@ rocsparse_status testing_ellmv(Arguments argus)
         }
     }
 
-    std::vector<T> hx(n);
-    std::vector<T> hy_1(m);
-    std::vector<T> hy_2(m);
-    std::vector<T> hy_gold(m);
+    // Dimensions of x and y depend on the operation
+    rocsparse_int xsize = (transA == rocsparse_operation_none) ? n : m;
+    rocsparse_int ysize = (transA == rocsparse_operation_none) ? m : n;
+
+    std::vector<T> hx(xsize);
+    std::vector<T> hy_1(ysize);
+    std::vector<T> hy_2(ysize);
+    std::vector<T> hy_gold(ysize);
 
-    rocsparse_init<T>(hx, 1, n);
-    rocsparse_init<T>(hy_1, 1, m);
+    rocsparse_init<T>(hx, 1, xsize);
+    rocsparse_init<T>(hy_1, 1, ysize);
 
     // copy vector is easy in STL; hy_gold = hx: save a copy in hy_gold which will be output of CPU
     hy_2    = hy_1;
@@ -324,9 +280,9 @@ rocsparse_status testing_ellmv(Arguments argus)
     auto dcol_managed =
         rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * ell_nnz), device_free};
     auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ell_nnz), device_free};
-    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
-    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
-    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * xsize), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ysize), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ysize), device_free};
     auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
     auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
 
@@ -350,14 +306,14 @@ rocsparse_status testing_ellmv(Arguments argus)
     CHECK_HIP_ERROR(hipMemcpy(
         dcol, hell_col_ind.data(), sizeof(rocsparse_int) * ell_nnz, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dval, hell_val.data(), sizeof(T) * ell_nnz, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * xsize, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
     if(argus.unit_check)
     {
-        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
 
         // ROCSPARSE pointer mode host
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
@@ -370,37 +326,72 @@ rocsparse_status testing_ellmv(Arguments argus)
             handle, transA, m, n, d_alpha, descr, dval, dcol, ell_width, dx, d_beta, dy_2));
 
         // copy output from device to CPU
-        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * ysize, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * ysize, hipMemcpyDeviceToHost));
 
         // CPU
         double cpu_time_used = get_time_us();
 
-        for(rocsparse_int i = 0; i < m; ++i)
+        if(transA == rocsparse_operation_none)
         {
-            T sum = static_cast<T>(0);
-            for(rocsparse_int p = 0; p < ell_width; ++p)
+            for(rocsparse_int i = 0; i < m; ++i)
             {
-                rocsparse_int idx = ELL_IND(i, p, m, ell_width);
-                rocsparse_int col = hell_col_ind[idx] - idx_base;
+                T sum = static_cast<T>(0);
+                for(rocsparse_int p = 0; p < ell_width; ++p)
+                {
+                    rocsparse_int idx = ELL_IND(i, p, m, ell_width);
+                    rocsparse_int col = hell_col_ind[idx] - idx_base;
+
+                    if(col >= 0 && col < n)
+                    {
+                        sum = host_fma(hell_val[idx], hx[col], sum);
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
 
-                if(col >= 0 && col < n)
+                if(h_beta != static_cast<T>(0))
                 {
-                    sum = std::fma(hell_val[idx], hx[col], sum);
+                    hy_gold[i] = host_fma(h_beta, hy_gold[i], h_alpha * sum);
                 }
                 else
                 {
-                    break;
+                    hy_gold[i] = h_alpha * sum;
                 }
             }
-
-            if(h_beta != static_cast<T>(0))
+        }
+        else
+        {
+            // Transposed product, y is scaled by beta and A^T x is scattered into y
+            for(rocsparse_int i = 0; i < n; ++i)
             {
-                hy_gold[i] = std::fma(h_beta, hy_gold[i], h_alpha * sum);
+                hy_gold[i] = (h_beta != static_cast<T>(0)) ? h_beta * hy_gold[i]
+                                                           : static_cast<T>(0);
             }
-            else
+
+            for(rocsparse_int i = 0; i < m; ++i)
             {
-                hy_gold[i] = h_alpha * sum;
+                T xa = h_alpha * hx[i];
+                for(rocsparse_int p = 0; p < ell_width; ++p)
+                {
+                    rocsparse_int idx = ELL_IND(i, p, m, ell_width);
+                    rocsparse_int col = hell_col_ind[idx] - idx_base;
+
+                    if(col >= 0 && col < n)
+                    {
+                        T val = (transA == rocsparse_operation_conjugate_transpose)
+                                    ? host_conj(hell_val[idx])
+                                    : hell_val[idx];
+
+                        hy_gold[col] = host_fma(val, xa, hy_gold[col]);
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
             }
         }
 
@@ -408,8 +399,45 @@ rocsparse_status testing_ellmv(Arguments argus)
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
-        unit_check_general(1, m, 1, hy_gold.data(), hy_1.data());
-        unit_check_general(1, m, 1, hy_gold.data(), hy_2.data());
+        // Transposed products are accumulated atomically in non-deterministic order
+        if(transA == rocsparse_operation_none)
+        {
+            unit_check_general(1, ysize, 1, hy_gold.data(), hy_1.data());
+            unit_check_general(1, ysize, 1, hy_gold.data(), hy_2.data());
+        }
+        else
+        {
+            unit_check_near(1, ysize, 1, hy_gold.data(), hy_1.data());
+            unit_check_near(1, ysize, 1, hy_gold.data(), hy_2.data());
+        }
+
+        // Pattern only matrix, must match explicitly stored unit values with zero padding
+        std::vector<T> hval_one(ell_nnz);
+        for(rocsparse_int i = 0; i < ell_nnz; ++i)
+        {
+            hval_one[i] = (hell_col_ind[i] >= 0) ? static_cast<T>(1) : static_cast<T>(0);
+        }
+
+        auto dval_one_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(T) * ell_nnz), device_free};
+        T* dval_one  = (T*)dval_one_managed.get();
+        T* dval_null = nullptr;
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(dval_one, hval_one.data(), sizeof(T) * ell_nnz, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_2.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_ellmv(
+            handle, transA, m, n, &h_alpha, descr, dval_one, dcol, ell_width, dx, &h_beta, dy_1));
+        CHECK_ROCSPARSE_ERROR(rocsparse_ellmv(
+            handle, transA, m, n, &h_alpha, descr, dval_null, dcol, ell_width, dx, &h_beta, dy_2));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * ysize, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * ysize, hipMemcpyDeviceToHost));
+
+        unit_check_near(1, ysize, 1, hy_1.data(), hy_2.data());
     }
 
     if(argus.timing)
@@ -447,11 +475,25 @@ rocsparse_status testing_ellmv(Arguments argus)
                m,
                n,
                ell_nnz,
-               h_alpha,
-               h_beta,
+               argus.alpha,
+               argus.beta,
                gpu_gflops,
                bandwidth,
                gpu_time_used);
+
+        size_t bytes = roofline_ellmv_bytes<T>(
+            transA, m, n, ell_width, hell_col_ind.data(), idx_base, h_beta);
+
+        roofline_report(argus,
+                        {"ellmv",
+                         roofline_precision<T>(),
+                         "ell",
+                         m,
+                         n,
+                         nnz,
+                         static_cast<double>(flops),
+                         static_cast<double>(bytes),
+                         gpu_time_used});
     }
 
     return rocsparse_status_success;
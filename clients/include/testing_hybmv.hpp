@@ -28,6 +28,7 @@
 #include "rocsparse_test_unique_ptr.hpp"
 #include "rocsparse.hpp"
 #include "utility.hpp"
+#include "roofline.hpp"
 #include "unit.hpp"
 
 #include <string>
@@ -228,62 +229,28 @@ rocsparse_status testing_hybmv(Arguments argus)
 
     // Host structures
     std::vector<rocsparse_int> hcsr_row_ptr;
-    std::vector<rocsparse_int> hcoo_row_ind;
     std::vector<rocsparse_int> hcol_ind;
     std::vector<T> hval;
 
     // Initial Data on CPU
     srand(12345ULL);
-    if(binfile != "")
+    if(load_matrix_csr(
+           argus, binfile, filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
     {
-        if(read_bin_matrix(binfile.c_str(), m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
-        {
-            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
-            return rocsparse_status_internal_error;
-        }
+        return rocsparse_status_internal_error;
     }
-    else if(argus.laplacian)
-    {
-        m = n = gen_2d_laplacian(argus.laplacian, hcsr_row_ptr, hcol_ind, hval, idx_base);
-        nnz   = hcsr_row_ptr[m];
-    }
-    else
-    {
-        if(filename != "")
-        {
-            if(read_mtx_matrix(
-                   filename.c_str(), m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base) != 0)
-            {
-                fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
-                return rocsparse_status_internal_error;
-            }
-        }
-        else
-        {
-            gen_matrix_coo(m, n, nnz, hcoo_row_ind, hcol_ind, hval, idx_base);
-        }
 
-        // Convert COO to CSR
-        hcsr_row_ptr.resize(m + 1, 0);
-        for(rocsparse_int i = 0; i < nnz; ++i)
-        {
-            ++hcsr_row_ptr[hcoo_row_ind[i] + 1 - idx_base];
-        }
+    // Dimensions of x and y depend on the operation
+    rocsparse_int xsize = (transA == rocsparse_operation_none) ? n : m;
+    rocsparse_int ysize = (transA == rocsparse_operation_none) ? m : n;
 
-        hcsr_row_ptr[0] = idx_base;
-        for(rocsparse_int i = 0; i < m; ++i)
-        {
-            hcsr_row_ptr[i + 1] += hcsr_row_ptr[i];
-        }
-    }
-
-    std::vector<T> hx(n);
-    std::vector<T> hy_1(m);
-    std::vector<T> hy_2(m);
-    std::vector<T> hy_gold(m);
+    std::vector<T> hx(xsize);
+    std::vector<T> hy_1(ysize);
+    std::vector<T> hy_2(ysize);
+    std::vector<T> hy_gold(ysize);
 
-    rocsparse_init<T>(hx, 1, n);
-    rocsparse_init<T>(hy_1, 1, m);
+    rocsparse_init<T>(hx, 1, xsize);
+    rocsparse_init<T>(hy_1, 1, ysize);
 
     // copy vector is easy in STL; hy_gold = hx: save a copy in hy_gold which will be output of CPU
     hy_2    = hy_1;
@@ -295,9 +262,9 @@ rocsparse_status testing_hybmv(Arguments argus)
     auto dcol_managed =
         rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
     auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
-    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
-    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
-    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * xsize), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ysize), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * ysize), device_free};
     auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
     auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
 
@@ -324,8 +291,8 @@ rocsparse_status testing_hybmv(Arguments argus)
     CHECK_HIP_ERROR(
         hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * xsize, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
@@ -396,7 +363,7 @@ rocsparse_status testing_hybmv(Arguments argus)
                 hcoo_val.data(), dhyb->coo_val, sizeof(T) * coo_nnz, hipMemcpyDeviceToHost));
         }
 
-        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
 
         // ROCSPARSE pointer mode host
         CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
@@ -409,67 +376,145 @@ rocsparse_status testing_hybmv(Arguments argus)
             rocsparse_hybmv(handle, transA, d_alpha, descr, hyb, dx, d_beta, dy_2));
 
         // copy output from device to CPU
-        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
-        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * ysize, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * ysize, hipMemcpyDeviceToHost));
 
         // CPU
         double cpu_time_used = get_time_us();
 
-        // ELL part
-        if(ell_nnz > 0)
+        if(transA == rocsparse_operation_none)
         {
-            for(rocsparse_int i = 0; i < m; ++i)
+            // ELL part
+            if(ell_nnz > 0)
             {
-                T sum = static_cast<T>(0);
-                for(rocsparse_int p = 0; p < dhyb->ell_width; ++p)
+                for(rocsparse_int i = 0; i < m; ++i)
                 {
-                    rocsparse_int idx = ELL_IND(i, p, m, dhyb->ell_width);
-                    rocsparse_int col = hell_col[idx] - idx_base;
+                    T sum = static_cast<T>(0);
+                    for(rocsparse_int p = 0; p < dhyb->ell_width; ++p)
+                    {
+                        rocsparse_int idx = ELL_IND(i, p, m, dhyb->ell_width);
+                        rocsparse_int col = hell_col[idx] - idx_base;
+
+                        if(col >= 0 && col < n)
+                        {
+                            sum += hell_val[idx] * hx[col];
+                        }
+                        else
+                        {
+                            break;
+                        }
+                    }
 
-                    if(col >= 0 && col < n)
+                    if(h_beta != static_cast<T>(0))
                     {
-                        sum += hell_val[idx] * hx[col];
+                        hy_gold[i] = h_beta * hy_gold[i] + h_alpha * sum;
                     }
                     else
                     {
-                        break;
+                        hy_gold[i] = h_alpha * sum;
                     }
                 }
+            }
+
+            // COO part
+            if(coo_nnz > 0)
+            {
+                T coo_beta = (ell_nnz > 0) ? static_cast<T>(1) : h_beta;
 
-                if(h_beta != static_cast<T>(0))
+                for(rocsparse_int i = 0; i < m; ++i)
                 {
-                    hy_gold[i] = h_beta * hy_gold[i] + h_alpha * sum;
+                    hy_gold[i] *= coo_beta;
                 }
-                else
+
+                for(rocsparse_int i = 0; i < coo_nnz; ++i)
                 {
-                    hy_gold[i] = h_alpha * sum;
+                    rocsparse_int row = hcoo_row[i] - idx_base;
+                    rocsparse_int col = hcoo_col[i] - idx_base;
+
+                    hy_gold[row] += h_alpha * hcoo_val[i] * hx[col];
                 }
             }
         }
-
-        // COO part
-        if(coo_nnz > 0)
+        else
         {
-            T coo_beta = (ell_nnz > 0) ? static_cast<T>(1) : h_beta;
+            // Transposed product, y is scaled by beta and A^T x is scattered into y
+            for(rocsparse_int i = 0; i < n; ++i)
+            {
+                hy_gold[i] *= h_beta;
+            }
 
-            for(rocsparse_int i = 0; i < m; ++i)
+            bool conj = (transA == rocsparse_operation_conjugate_transpose);
+
+            // ELL part
+            for(rocsparse_int i = 0; i < m && ell_nnz > 0; ++i)
             {
-                hy_gold[i] *= coo_beta;
+                for(rocsparse_int p = 0; p < dhyb->ell_width; ++p)
+                {
+                    rocsparse_int idx = ELL_IND(i, p, m, dhyb->ell_width);
+                    rocsparse_int col = hell_col[idx] - idx_base;
+
+                    if(col >= 0 && col < n)
+                    {
+                        T val = conj ? host_conj(hell_val[idx]) : hell_val[idx];
+                        hy_gold[col] += h_alpha * val * hx[i];
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
             }
 
+            // COO part
             for(rocsparse_int i = 0; i < coo_nnz; ++i)
             {
                 rocsparse_int row = hcoo_row[i] - idx_base;
                 rocsparse_int col = hcoo_col[i] - idx_base;
 
-                hy_gold[row] += h_alpha * hcoo_val[i] * hx[col];
+                T val = conj ? host_conj(hcoo_val[i]) : hcoo_val[i];
+                hy_gold[col] += h_alpha * val * hx[row];
             }
         }
 
         cpu_time_used = get_time_us() - cpu_time_used;
 
-        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
-        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+        unit_check_near(1, ysize, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, ysize, 1, hy_gold.data(), hy_2.data());
+
+        // Pattern only matrix, must match explicitly stored unit values
+        std::vector<T> hval_one(nnz, static_cast<T>(1));
+
+        auto dval_one_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+        T* dval_one           = (T*)dval_one_managed.get();
+        T* dval_null          = nullptr;
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(dval_one, hval_one.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+        std::unique_ptr<hyb_struct> unique_ptr_hyb_one(new hyb_struct);
+        rocsparse_hyb_mat hyb_one = unique_ptr_hyb_one->hyb;
+
+        std::unique_ptr<hyb_struct> unique_ptr_hyb_pattern(new hyb_struct);
+        rocsparse_hyb_mat hyb_pattern = unique_ptr_hyb_pattern->hyb;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb(
+            handle, m, n, descr, dval_one, dptr, dcol, hyb_one, user_ell_width, part));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2hyb(
+            handle, m, n, descr, dval_null, dptr, dcol, hyb_pattern, user_ell_width, part));
+
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_2.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2.data(), sizeof(T) * ysize, hipMemcpyHostToDevice));
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_hybmv(handle, transA, &h_alpha, descr, hyb_one, dx, &h_beta, dy_1));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_hybmv(handle, transA, &h_alpha, descr, hyb_pattern, dx, &h_beta, dy_2));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * ysize, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * ysize, hipMemcpyDeviceToHost));
+
+        unit_check_near(1, ysize, 1, hy_1.data(), hy_2.data());
     }
 
     if(argus.timing)
@@ -508,11 +553,33 @@ rocsparse_status testing_hybmv(Arguments argus)
                m,
                n,
                dhyb->ell_nnz + dhyb->coo_nnz,
-               h_alpha,
-               h_beta,
+               argus.alpha,
+               argus.beta,
                gpu_gflops,
                bandwidth,
                gpu_time_used);
+
+        size_t bytes = roofline_hybmv_bytes<T>(transA,
+                                               m,
+                                               n,
+                                               dhyb->ell_width,
+                                               dhyb->ell_col_ind,
+                                               dhyb->coo_nnz,
+                                               dhyb->coo_row_ind,
+                                               dhyb->coo_col_ind,
+                                               idx_base,
+                                               h_beta);
+
+        roofline_report(argus,
+                        {"hybmv",
+                         roofline_precision<T>(),
+                         "hyb",
+                         m,
+                         n,
+                         dhyb->ell_nnz + dhyb->coo_nnz,
+                         static_cast<double>(flops),
+                         static_cast<double>(bytes),
+                         gpu_time_used});
     }
 
     return rocsparse_status_success;
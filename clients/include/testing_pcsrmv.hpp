@@ -0,0 +1,608 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_PCSRMV_HPP
+#define TESTING_PCSRMV_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+#include "roofline.hpp"
+
+#include <algorithm>
+#include <string>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+struct testpcsr
+{
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+    rocsparse_int block_dim;
+    rocsparse_int delta_size;
+    rocsparse_int* row_ptr;
+    rocsparse_int* col_base;
+    void* col_delta;
+    void* val;
+};
+
+template <typename T>
+void testing_pcsrmv_bad_arg(void)
+{
+    rocsparse_int m            = 100;
+    rocsparse_int n            = 100;
+    rocsparse_int safe_size    = 100;
+    T alpha                    = 0.6;
+    T beta                     = 0.2;
+    rocsparse_operation transA = rocsparse_operation_none;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    std::unique_ptr<pcsr_struct> unique_ptr_pcsr(new pcsr_struct);
+    rocsparse_pcsr_mat pcsr = unique_ptr_pcsr->pcsr;
+
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+    auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    T* dx               = (T*)dx_managed.get();
+    T* dy               = (T*)dy_managed.get();
+
+    if(!dptr || !dcol || !dval || !dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Testing rocsparse_csr2pcsr()
+
+    // testing for(nullptr == dptr)
+    {
+        rocsparse_int* dptr_null = nullptr;
+
+        status = rocsparse_csr2pcsr(handle, m, n, descr, dval, dptr_null, dcol, pcsr);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dptr is nullptr");
+    }
+    // testing for(nullptr == dcol)
+    {
+        rocsparse_int* dcol_null = nullptr;
+
+        status = rocsparse_csr2pcsr(handle, m, n, descr, dval, dptr, dcol_null, pcsr);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dcol is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_csr2pcsr(handle, m, n, descr_null, dval, dptr, dcol, pcsr);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == pcsr)
+    {
+        rocsparse_pcsr_mat pcsr_null = nullptr;
+
+        status = rocsparse_csr2pcsr(handle, m, n, descr, dval, dptr, dcol, pcsr_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: pcsr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csr2pcsr(handle_null, m, n, descr, dval, dptr, dcol, pcsr);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+
+    // Testing rocsparse_pcsrmv()
+
+    // testing for(nullptr == dx)
+    {
+        T* dx_null = nullptr;
+
+        status = rocsparse_pcsrmv(handle, transA, &alpha, descr, pcsr, dx_null, &beta, dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == dy)
+    {
+        T* dy_null = nullptr;
+
+        status = rocsparse_pcsrmv(handle, transA, &alpha, descr, pcsr, dx, &beta, dy_null);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dy is nullptr");
+    }
+    // testing for(nullptr == d_alpha)
+    {
+        T* d_alpha_null = nullptr;
+
+        status = rocsparse_pcsrmv(handle, transA, d_alpha_null, descr, pcsr, dx, &beta, dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: alpha is nullptr");
+    }
+    // testing for(nullptr == d_beta)
+    {
+        T* d_beta_null = nullptr;
+
+        status = rocsparse_pcsrmv(handle, transA, &alpha, descr, pcsr, dx, d_beta_null, dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: beta is nullptr");
+    }
+    // testing for(nullptr == descr)
+    {
+        rocsparse_mat_descr descr_null = nullptr;
+
+        status = rocsparse_pcsrmv(handle, transA, &alpha, descr_null, pcsr, dx, &beta, dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: descr is nullptr");
+    }
+    // testing for(nullptr == pcsr)
+    {
+        rocsparse_pcsr_mat pcsr_null = nullptr;
+
+        status = rocsparse_pcsrmv(handle, transA, &alpha, descr, pcsr_null, dx, &beta, dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: pcsr is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_pcsrmv(handle_null, transA, &alpha, descr, pcsr, dx, &beta, dy);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+// Decodes all column indices of a packed CSR matrix, whose column deltas are given as bytes
+static void pcsr_decode_bytes(rocsparse_int m,
+                              rocsparse_int block_dim,
+                              rocsparse_int delta_size,
+                              const rocsparse_int* ptr,
+                              const rocsparse_int* col_base,
+                              const std::vector<unsigned char>& col_delta,
+                              rocsparse_int* col,
+                              rocsparse_index_base idx_base)
+{
+    if(delta_size == sizeof(unsigned char))
+    {
+        host_pcsr_decode(m, block_dim, ptr, col_base, col_delta.data(), col, idx_base);
+    }
+    else if(delta_size == sizeof(unsigned short))
+    {
+        const unsigned short* delta = reinterpret_cast<const unsigned short*>(col_delta.data());
+        host_pcsr_decode(m, block_dim, ptr, col_base, delta, col, idx_base);
+    }
+    else
+    {
+        const rocsparse_int* delta = reinterpret_cast<const rocsparse_int*>(col_delta.data());
+        host_pcsr_decode(m, block_dim, ptr, col_base, delta, col, idx_base);
+    }
+}
+
+template <typename T>
+rocsparse_status testing_pcsrmv(Arguments argus)
+{
+    rocsparse_int safe_size       = 100;
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    T h_alpha                     = argus.alpha;
+    T h_beta                      = argus.beta;
+    rocsparse_operation transA    = rocsparse_operation_none;
+    rocsparse_index_base idx_base = argus.idx_base;
+    std::string filename          = "";
+    rocsparse_status status;
+
+    if(argus.timing == 1)
+    {
+        filename = argus.filename;
+    }
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    std::unique_ptr<pcsr_struct> test_pcsr(new pcsr_struct);
+    rocsparse_pcsr_mat pcsr = test_pcsr->pcsr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 0 || n <= 0 || nnz <= 0)
+    {
+        auto dptr_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dcol_managed =
+            rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+        auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dx_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+        auto dy_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * safe_size), device_free};
+
+        rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+        rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+        T* dval             = (T*)dval_managed.get();
+        T* dx               = (T*)dx_managed.get();
+        T* dy               = (T*)dy_managed.get();
+
+        if(!dptr || !dcol || !dval || !dx || !dy)
+        {
+            verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                            "!dptr || !dcol || !dval || !dx || !dy");
+            return rocsparse_status_memory_error;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        status = rocsparse_csr2pcsr(handle, m, n, descr, dval, dptr, dcol, pcsr);
+
+        if(m < 0 || n < 0)
+        {
+            verify_rocsparse_status_invalid_size(status, "Error: m < 0 || n < 0");
+        }
+        else
+        {
+            verify_rocsparse_status_success(status, "m >= 0 && n >= 0");
+        }
+
+        // The PCSR matrix is empty, such that pcsrmv returns immediately
+        status = rocsparse_pcsrmv(handle, transA, &h_alpha, descr, pcsr, dx, &h_beta, dy);
+        verify_rocsparse_status_success(status, "empty PCSR matrix");
+
+        return rocsparse_status_success;
+    }
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<T> hval;
+
+    // Initial Data on CPU
+    srand(12345ULL);
+    if(load_matrix_csr(argus, "", filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    std::vector<T> hx(n);
+    std::vector<T> hy(m);
+
+    rocsparse_init<T>(hx, 1, n);
+    rocsparse_init<T>(hy, 1, m);
+
+    // allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(T) * n), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(T)), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    T* dx               = (T*)dx_managed.get();
+    T* dy_1             = (T*)dy_1_managed.get();
+    T* dy_2             = (T*)dy_2_managed.get();
+    T* d_alpha          = (T*)d_alpha_managed.get();
+    T* d_beta           = (T*)d_beta_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dx || "
+                                        "!dy_1 || !dy_2 || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // Host reference of the packed column indices
+    std::vector<rocsparse_int> hcol_base_gold;
+    std::vector<rocsparse_int> hcol_delta_gold;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr2pcsr(handle, m, n, descr, dval, dptr, dcol, pcsr));
+
+    // Copy PCSR structure to host
+    testpcsr* dpcsr = (testpcsr*)pcsr;
+
+    rocsparse_int block_dim  = dpcsr->block_dim;
+    rocsparse_int delta_size = dpcsr->delta_size;
+    rocsparse_int nblocks    = (m - 1) / block_dim + 1;
+
+    rocsparse_int delta_size_gold = host_csr2pcsr(m,
+                                                  block_dim,
+                                                  hcsr_row_ptr.data(),
+                                                  hcol_ind.data(),
+                                                  hcol_base_gold,
+                                                  hcol_delta_gold,
+                                                  idx_base);
+
+    std::vector<rocsparse_int> hcol_base(nblocks);
+    std::vector<unsigned char> hcol_delta(delta_size * nnz);
+
+    CHECK_HIP_ERROR(hipMemcpy(hcol_base.data(),
+                              dpcsr->col_base,
+                              sizeof(rocsparse_int) * nblocks,
+                              hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(
+        hcol_delta.data(), dpcsr->col_delta, delta_size * nnz, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        // Packed structure
+        rocsparse_int delta_size_query = rocsparse_get_pcsr_mat_delta_size(pcsr);
+
+        unit_check_general(1, 1, 1, &delta_size_gold, &delta_size);
+        unit_check_general(1, 1, 1, &delta_size_gold, &delta_size_query);
+        unit_check_general(1, nblocks, 1, hcol_base_gold.data(), hcol_base.data());
+
+        // Decoded column indices
+        std::vector<rocsparse_int> hcol_decoded(nnz);
+        pcsr_decode_bytes(m,
+                          block_dim,
+                          delta_size,
+                          hcsr_row_ptr.data(),
+                          hcol_base.data(),
+                          hcol_delta,
+                          hcol_decoded.data(),
+                          idx_base);
+
+        unit_check_general(1, nnz, 1, hcol_ind.data(), hcol_decoded.data());
+
+        std::vector<T> hy_gold(hy);
+        std::vector<T> hy_1(m);
+        std::vector<T> hy_2(m);
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_pcsrmv(handle, transA, &h_alpha, descr, pcsr, dx, &h_beta, dy_1));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_pcsrmv(handle, transA, d_alpha, descr, pcsr, dx, d_beta, dy_2));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        // CPU
+        host_pcsrmv(m,
+                    block_dim,
+                    h_alpha,
+                    hcsr_row_ptr.data(),
+                    hcol_base_gold.data(),
+                    hcol_delta_gold.data(),
+                    hval.data(),
+                    hx.data(),
+                    h_beta,
+                    hy_gold.data(),
+                    idx_base);
+
+        unit_check_near(1, m, 1, hy_gold.data(), hy_1.data());
+        unit_check_near(1, m, 1, hy_gold.data(), hy_2.data());
+
+        // Pattern only matrix, every entry is one
+        T* dval_null = nullptr;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csr2pcsr(handle, m, n, descr, dval_null, dptr, dcol, pcsr));
+
+        CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_pcsrmv(handle, transA, &h_alpha, descr, pcsr, dx, &h_beta, dy_1));
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(T) * m, hipMemcpyDeviceToHost));
+
+        std::vector<T> hval_one(nnz, static_cast<T>(1));
+        std::vector<T> hy_pattern(hy);
+
+        host_pcsrmv(m,
+                    block_dim,
+                    h_alpha,
+                    hcsr_row_ptr.data(),
+                    hcol_base_gold.data(),
+                    hcol_delta_gold.data(),
+                    hval_one.data(),
+                    hx.data(),
+                    h_beta,
+                    hy_pattern.data(),
+                    idx_base);
+
+        unit_check_near(1, m, 1, hy_pattern.data(), hy_1.data());
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Conversion
+        double convert_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csr2pcsr(handle, m, n, descr, dval, dptr, dcol, pcsr);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        convert_time_used = (get_time_us() - convert_time_used) / (number_hot_calls * 1e3);
+
+        // csrmv as baseline
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrmv(handle,
+                            transA,
+                            m,
+                            n,
+                            nnz,
+                            &h_alpha,
+                            descr,
+                            dval,
+                            dptr,
+                            dcol,
+                            nullptr,
+                            dx,
+                            &h_beta,
+                            dy_1);
+        }
+
+        double csr_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csrmv(handle,
+                            transA,
+                            m,
+                            n,
+                            nnz,
+                            &h_alpha,
+                            descr,
+                            dval,
+                            dptr,
+                            dcol,
+                            nullptr,
+                            dx,
+                            &h_beta,
+                            dy_1);
+        }
+
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        csr_time_used = (get_time_us() - csr_time_used) / (number_hot_calls * 1e3);
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_pcsrmv(handle, transA, &h_alpha, descr, pcsr, dx, &h_beta, dy_1);
+        }
+
+        double gpu_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_pcsrmv(handle, transA, &h_alpha, descr, pcsr, dx, &h_beta, dy_1);
+        }
+
+        // Convert to miliseconds per call
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        // Host decode of all column indices
+        std::vector<rocsparse_int> hcol_decoded(nnz);
+
+        double host_time_used = get_time_us();
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            pcsr_decode_bytes(m,
+                              block_dim,
+                              delta_size,
+                              hcsr_row_ptr.data(),
+                              hcol_base.data(),
+                              hcol_delta,
+                              hcol_decoded.data(),
+                              idx_base);
+        }
+
+        host_time_used = (get_time_us() - host_time_used) / (number_hot_calls * 1e3);
+
+        // Effective bytes per non-zero entry of the index arrays and of the whole matrix
+        double csr_index_bytes  = sizeof(rocsparse_int) * (m + 1.0 + nnz) / nnz;
+        double pcsr_index_bytes = (sizeof(rocsparse_int) * (m + 1.0 + nblocks) +
+                                   static_cast<double>(delta_size) * nnz) /
+                                  nnz;
+
+        size_t flops = (h_alpha != 1.0) ? 3.0 * nnz : 2.0 * nnz;
+        flops        = (h_beta != 0.0) ? flops + m : flops;
+
+        size_t memtrans  = ((h_beta != 0.0) ? 3.0 : 2.0) * m + nnz;
+        double bandwidth = (memtrans * sizeof(T) + pcsr_index_bytes * nnz) / gpu_time_used / 1e6;
+
+        printf("m\t\tn\t\tnnz\t\tdelta\tidx B/nnz\tcsr idx B/nnz\tB/nnz\tcsr B/nnz\tGB/s\tmsec"
+               "\tcsrmv msec\tcsr2pcsr msec\thost decode msec\n");
+        printf("%8d\t%8d\t%9d\t%d\t%0.2lf\t\t%0.2lf\t\t%0.2lf\t%0.2lf\t\t%0.2lf\t%0.3lf\t%0.3lf"
+               "\t\t%0.3lf\t\t%0.3lf\n",
+               m,
+               n,
+               nnz,
+               delta_size,
+               pcsr_index_bytes,
+               csr_index_bytes,
+               pcsr_index_bytes + sizeof(T),
+               csr_index_bytes + sizeof(T),
+               bandwidth,
+               gpu_time_used,
+               csr_time_used,
+               convert_time_used,
+               host_time_used);
+
+        size_t bytes = roofline_pcsrmv_bytes<T>(
+            m, nnz, block_dim, delta_size, hcol_ind.data(), idx_base, h_beta);
+
+        roofline_report(argus,
+                        {"pcsrmv",
+                         roofline_precision<T>(),
+                         "pcsr",
+                         m,
+                         n,
+                         nnz,
+                         static_cast<double>(flops),
+                         static_cast<double>(bytes),
+                         gpu_time_used});
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_PCSRMV_HPP
@@ -0,0 +1,288 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_PROFILE_HPP
+#define TESTING_PROFILE_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <math.h>
+#include <string>
+#include <type_traits>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+// Numeric field of a JSON profile entry, NAN if missing
+inline double profile_field(const std::string& entry, const std::string& key)
+{
+    size_t pos = entry.find("\"" + key + "\": ");
+
+    if(pos == std::string::npos)
+    {
+        return NAN;
+    }
+
+    return atof(entry.c_str() + pos + key.size() + 4);
+}
+
+// Histogram of a JSON profile entry as pairs of bucket upper bound and number of calls
+inline std::vector<std::pair<double, size_t>> profile_histogram(const std::string& entry)
+{
+    std::vector<std::pair<double, size_t>> histogram;
+
+    size_t pos = entry.find("\"histogram\": [");
+
+    if(pos == std::string::npos)
+    {
+        return histogram;
+    }
+
+    const char* str = entry.c_str() + pos + 14;
+
+    while(*str == '[' || *str == ',' || *str == ' ')
+    {
+        if(*str != '[')
+        {
+            ++str;
+            continue;
+        }
+
+        char* end;
+        double bound = strtod(str + 1, &end);
+        size_t count = strtoul(end + 1, &end, 10);
+
+        histogram.push_back(std::make_pair(bound, count));
+        str = end + 1;
+    }
+
+    return histogram;
+}
+
+// Entry of a routine in a JSON profile, one entry per line
+inline std::string profile_entry(const std::string& path, const std::string& routine)
+{
+    std::vector<std::string> lines = read_lines(path);
+
+    for(size_t i = 0; i < lines.size(); ++i)
+    {
+        if(lines[i].find("\"routine\": \"" + routine + "\"") != std::string::npos)
+        {
+            return lines[i];
+        }
+    }
+
+    return "";
+}
+
+// Check a JSON profile entry of calls to a routine with the given matrix shape
+inline rocsparse_status profile_check(const std::string& path,
+                                      const std::string& routine,
+                                      rocsparse_int m,
+                                      rocsparse_int n,
+                                      rocsparse_int nnz,
+                                      size_t calls)
+{
+    std::string entry = profile_entry(path, routine);
+
+    if(entry.empty())
+    {
+        fprintf(stderr, "No profile of %s in %s\n", routine.c_str(), path.c_str());
+        return rocsparse_status_internal_error;
+    }
+
+    rocsparse_int pm     = profile_field(entry, "m");
+    rocsparse_int pn     = profile_field(entry, "n");
+    rocsparse_int pnnz   = profile_field(entry, "nnz");
+    size_t pcalls        = profile_field(entry, "calls");
+    double min           = profile_field(entry, "min_us");
+    double p50           = profile_field(entry, "p50_us");
+    double max           = profile_field(entry, "max_us");
+    size_t histogram_sum = 0;
+
+    unit_check_general(1, 1, 1, &m, &pm);
+    unit_check_general(1, 1, 1, &n, &pn);
+    unit_check_general(1, 1, 1, &nnz, &pnnz);
+    unit_check_general(1, 1, 1, &calls, &pcalls);
+
+    std::vector<std::pair<double, size_t>> histogram = profile_histogram(entry);
+
+    if(histogram.empty())
+    {
+        fprintf(stderr, "No histogram in %s\n", entry.c_str());
+        return rocsparse_status_internal_error;
+    }
+
+    // Buckets are ascending, non empty and account for all calls
+    for(size_t i = 0; i < histogram.size(); ++i)
+    {
+        if(histogram[i].second == 0 || (i > 0 && histogram[i].first <= histogram[i - 1].first))
+        {
+            fprintf(stderr, "Unexpected histogram in %s\n", entry.c_str());
+            return rocsparse_status_internal_error;
+        }
+
+        histogram_sum += histogram[i].second;
+    }
+
+    unit_check_general(1, 1, 1, &calls, &histogram_sum);
+
+    // Fastest and slowest call fall into the first and last bucket, four buckets per power
+    // of two and all calls below 1 us in the first bucket. Times are written with two
+    // decimals.
+    double first_bound = histogram.front().first;
+    double last_bound  = histogram.back().first;
+    double last_lower  = (last_bound > 1.0) ? last_bound / pow(2.0, 0.25) : 0.0;
+
+    if(min > first_bound + 0.01 || max < last_lower - 0.01 || p50 < min || p50 > max)
+    {
+        fprintf(stderr, "Histogram does not match the call times in %s\n", entry.c_str());
+        return rocsparse_status_internal_error;
+    }
+
+    return rocsparse_status_success;
+}
+
+// Profile of repeated csrmv calls is written on demand, discarded on reset and written
+// again when the handle is destroyed
+template <typename T>
+rocsparse_status testing_profile_csrmv(Arguments argus)
+{
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int ndim            = argus.laplacian;
+    T h_alpha                     = 1.0;
+    T h_beta                      = 0.0;
+
+    scoped_temp_dir dir;
+
+    if(dir.path.empty())
+    {
+        verify_rocsparse_status_success(rocsparse_status_internal_error, "mkdtemp");
+        return rocsparse_status_internal_error;
+    }
+
+    std::string profile_path = dir.path + "/profile.json";
+    std::string destroy_path = dir.path + "/destroy.json";
+    std::string routine = std::is_same<T, float>::value ? "rocsparse_scsrmv" : "rocsparse_dcsrmv";
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    rocsparse_int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hx(m, static_cast<T>(1));
+
+    // Allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    T* dx               = (T*)dx_managed.get();
+    T* dy               = (T*)dy_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dx || !dy");
+        return rocsparse_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    size_t ncalls       = 5;
+    size_t ncalls_reset = 2;
+
+    // Handle with profiling, the summary is written once the handle is destroyed
+    {
+        scoped_env env;
+
+        env.set("ROCSPARSE_LAYER", std::to_string(rocsparse_layer_mode_log_profile));
+        env.set("ROCSPARSE_LOG_PROFILE_PATH", destroy_path);
+
+        std::unique_ptr<handle_struct> test_handle(new handle_struct);
+        rocsparse_handle handle = test_handle->handle;
+
+        std::unique_ptr<descr_struct> test_descr(new descr_struct);
+        rocsparse_mat_descr descr = test_descr->descr;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(size_t i = 0; i < ncalls + ncalls_reset; ++i)
+        {
+            // Profile so far is discarded, only subsequent calls are profiled
+            if(i == ncalls)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_write_profile(
+                    handle, rocsparse_profile_format_json, profile_path.c_str()));
+                CHECK_ROCSPARSE_ERROR(rocsparse_reset_profile(handle));
+            }
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                                  rocsparse_operation_none,
+                                                  m,
+                                                  m,
+                                                  nnz,
+                                                  &h_alpha,
+                                                  descr,
+                                                  dval,
+                                                  dptr,
+                                                  dcol,
+                                                  nullptr,
+                                                  dx,
+                                                  &h_beta,
+                                                  dy));
+        }
+    }
+
+    rocsparse_status status = profile_check(profile_path, routine, m, m, nnz, ncalls);
+
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    return profile_check(destroy_path, routine, m, m, nnz, ncalls_reset);
+}
+
+#endif // TESTING_PROFILE_HPP
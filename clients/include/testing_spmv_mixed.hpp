@@ -0,0 +1,825 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_SPMV_MIXED_HPP
+#define TESTING_SPMV_MIXED_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "utility.hpp"
+#include "roofline.hpp"
+#include "unit.hpp"
+#include "testing_hybmv.hpp"
+
+#include <string>
+#include <cmath>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+// Unit roundoff of the 16-bit storage formats
+template <typename U>
+double storage_unit_roundoff();
+
+template <>
+inline double storage_unit_roundoff<rocsparse_half>()
+{
+    return std::ldexp(1.0, -11);
+}
+
+template <>
+inline double storage_unit_roundoff<rocsparse_bfloat16>()
+{
+    return std::ldexp(1.0, -8);
+}
+
+template <typename U>
+void testing_csrmv_mixed_bad_arg(void)
+{
+    rocsparse_int n            = 100;
+    rocsparse_int m            = 100;
+    rocsparse_int nnz          = 100;
+    rocsparse_int safe_size    = 100;
+    float alpha                = 0.6;
+    float beta                 = 0.2;
+    rocsparse_operation transA = rocsparse_operation_none;
+    rocsparse_status status;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    std::unique_ptr<descr_struct> unique_ptr_descr(new descr_struct);
+    rocsparse_mat_descr descr = unique_ptr_descr->descr;
+
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * safe_size), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(U) * safe_size), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+    auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(float) * safe_size), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    U* dval             = (U*)dval_managed.get();
+    float* dx           = (float*)dx_managed.get();
+    float* dy           = (float*)dy_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // testing for(nullptr == dval)
+    {
+        U* dval_null = nullptr;
+
+        status = rocsparse_csrmv_mixed(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval_null,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       &beta,
+                                       dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dval is nullptr");
+    }
+    // testing for(nullptr == dx)
+    {
+        float* dx_null = nullptr;
+
+        status = rocsparse_csrmv_mixed(handle,
+                                       transA,
+                                       m,
+                                       n,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx_null,
+                                       &beta,
+                                       dy);
+        verify_rocsparse_status_invalid_pointer(status, "Error: dx is nullptr");
+    }
+    // testing for(nullptr == handle)
+    {
+        rocsparse_handle handle_null = nullptr;
+
+        status = rocsparse_csrmv_mixed(handle_null,
+                                       transA,
+                                       m,
+                                       n,
+                                       nnz,
+                                       &alpha,
+                                       descr,
+                                       dval,
+                                       dptr,
+                                       dcol,
+                                       nullptr,
+                                       dx,
+                                       &beta,
+                                       dy);
+        verify_rocsparse_status_invalid_handle(status);
+    }
+}
+
+// Generate a CSR test matrix with single precision values
+inline rocsparse_status spmv_mixed_init(const Arguments& argus,
+                                        rocsparse_int& m,
+                                        rocsparse_int& n,
+                                        rocsparse_int& nnz,
+                                        std::vector<rocsparse_int>& hcsr_row_ptr,
+                                        std::vector<rocsparse_int>& hcol_ind,
+                                        std::vector<float>& hval,
+                                        rocsparse_index_base idx_base)
+{
+    // When in testing mode, M == N == -99 indicates that we are testing with a real
+    // matrix from cise.ufl.edu
+    std::string binfile  = (m == -99 && n == -99 && argus.timing == 0) ? argus.filename : "";
+    std::string filename = (argus.timing == 1) ? argus.filename : "";
+
+    srand(12345ULL);
+    if(load_matrix_csr(
+           argus, binfile, filename, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base) != 0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    // Scale the values such that they are not exactly representable in 16-bit
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        hval[i] /= 3.0f;
+    }
+
+    return rocsparse_status_success;
+}
+
+// Verify a mixed precision SpMV result. The result has to match the host implementation,
+// that operates on the same 16-bit values, and stay within the rounding error bound of
+// the double precision product of the original single precision matrix.
+template <typename U>
+void spmv_mixed_check(rocsparse_int m,
+                      float alpha,
+                      float beta,
+                      const std::vector<rocsparse_int>& hcsr_row_ptr,
+                      const std::vector<rocsparse_int>& hcol_ind,
+                      const std::vector<float>& hval,
+                      const std::vector<U>& hval_mixed,
+                      const std::vector<float>& hx,
+                      const std::vector<float>& hy,
+                      const std::vector<float>& hy_result,
+                      rocsparse_index_base idx_base)
+{
+    std::vector<float> hy_gold(hy);
+    std::vector<double> hy_ref(m);
+    std::vector<double> hbound(m);
+
+    host_csrmv_mixed(m,
+                     alpha,
+                     hcsr_row_ptr.data(),
+                     hcol_ind.data(),
+                     hval_mixed.data(),
+                     hx.data(),
+                     beta,
+                     hy_gold.data(),
+                     idx_base);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        double sum = 0.0;
+        for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base;
+            ++j)
+        {
+            sum += static_cast<double>(hval[j]) * hx[hcol_ind[j] - idx_base];
+        }
+
+        hy_ref[i] = static_cast<double>(alpha) * sum + static_cast<double>(beta) * hy[i];
+    }
+
+    csrmv_mixed_error_bound(m,
+                            alpha,
+                            hcsr_row_ptr.data(),
+                            hcol_ind.data(),
+                            hval.data(),
+                            hx.data(),
+                            beta,
+                            hy.data(),
+                            storage_unit_roundoff<U>(),
+                            hbound.data(),
+                            idx_base);
+
+    unit_check_near(1, m, 1, hy_gold.data(), const_cast<float*>(hy_result.data()));
+    unit_check_bound(m, hy_ref.data(), hy_result.data(), hbound.data());
+}
+
+inline void spmv_mixed_print(rocsparse_int m,
+                             rocsparse_int n,
+                             rocsparse_int nnz,
+                             float alpha,
+                             float beta,
+                             size_t matrix_bytes,
+                             double gpu_time_used)
+{
+    size_t flops      = (alpha != 1.0f) ? 3.0 * nnz : 2.0 * nnz;
+    flops             = (beta != 0.0f) ? flops + m : flops;
+    double gpu_gflops = flops / gpu_time_used / 1e6;
+    size_t memtrans   = (m + n) * sizeof(float) + matrix_bytes;
+    memtrans          = (beta != 0.0f) ? memtrans + m * sizeof(float) : memtrans;
+    double bandwidth  = memtrans / gpu_time_used / 1e6;
+
+    printf("m\t\tn\t\tnnz\t\talpha\tbeta\tbytes/nnz\tGFlops\tGB/s\tmsec\n");
+    printf("%8d\t%8d\t%9d\t%0.2lf\t%0.2lf\t%0.2lf\t\t%0.2lf\t%0.2lf\t%0.2lf\n",
+           m,
+           n,
+           nnz,
+           alpha,
+           beta,
+           static_cast<double>(matrix_bytes) / nnz,
+           gpu_gflops,
+           bandwidth,
+           gpu_time_used);
+}
+
+template <typename U>
+void spmv_mixed_report(const Arguments& argus,
+                       const char* function,
+                       const char* format,
+                       rocsparse_int m,
+                       rocsparse_int n,
+                       rocsparse_int nnz,
+                       size_t bytes,
+                       double gpu_time_used)
+{
+    double flops = ((argus.alpha != 1.0) ? 3.0 : 2.0) * nnz + ((argus.beta != 0.0) ? m : 0);
+
+    roofline_report(argus,
+                    {function,
+                     roofline_precision<U>(),
+                     format,
+                     m,
+                     n,
+                     nnz,
+                     flops,
+                     static_cast<double>(bytes),
+                     gpu_time_used});
+}
+
+template <typename U>
+rocsparse_status testing_csrmv_mixed(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    float h_alpha                 = argus.alpha;
+    float h_beta                  = argus.beta;
+    rocsparse_operation transA    = argus.transA;
+    rocsparse_index_base idx_base = argus.idx_base;
+    bool adaptive                 = argus.bswitch;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    std::unique_ptr<mat_info_struct> unique_ptr_mat_info(new mat_info_struct);
+    rocsparse_mat_info info = adaptive ? unique_ptr_mat_info->info : nullptr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<float> hval;
+
+    CHECK_ROCSPARSE_ERROR(
+        spmv_mixed_init(argus, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base));
+
+    std::vector<U> hval_mixed(nnz);
+    convert_values(hval.data(), hval_mixed.data(), nnz);
+
+    std::vector<float> hx(n);
+    std::vector<float> hy(m);
+    std::vector<float> hy_1(m);
+    std::vector<float> hy_2(m);
+
+    rocsparse_init<float>(hx, 1, n);
+    rocsparse_init<float>(hy, 1, m);
+
+    // allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(U) * nnz), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(float) * n), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(float)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(float)), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    U* dval             = (U*)dval_managed.get();
+    float* dx           = (float*)dx_managed.get();
+    float* dy_1         = (float*)dy_1_managed.get();
+    float* dy_2         = (float*)dy_2_managed.get();
+    float* d_alpha      = (float*)d_alpha_managed.get();
+    float* d_beta       = (float*)d_beta_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dx || "
+                                        "!dy_1 || !dy_2 || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval_mixed.data(), sizeof(U) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(float) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(float) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy.data(), sizeof(float) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(float), hipMemcpyHostToDevice));
+
+    if(adaptive)
+    {
+        // csrmv analysis
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrmv_analysis(handle, transA, m, n, nnz, descr, dval, dptr, dcol, info));
+    }
+
+    if(argus.unit_check)
+    {
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_mixed(
+            handle, transA, m, n, nnz, &h_alpha, descr, dval, dptr, dcol, info, dx, &h_beta, dy_1));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv_mixed(
+            handle, transA, m, n, nnz, d_alpha, descr, dval, dptr, dcol, info, dx, d_beta, dy_2));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(float) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(float) * m, hipMemcpyDeviceToHost));
+
+        spmv_mixed_check(
+            m, h_alpha, h_beta, hcsr_row_ptr, hcol_ind, hval, hval_mixed, hx, hy, hy_1, idx_base);
+        spmv_mixed_check(
+            m, h_alpha, h_beta, hcsr_row_ptr, hcol_ind, hval, hval_mixed, hx, hy, hy_2, idx_base);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_csrmv_mixed(handle,
+                                  transA,
+                                  m,
+                                  n,
+                                  nnz,
+                                  &h_alpha,
+                                  descr,
+                                  dval,
+                                  dptr,
+                                  dcol,
+                                  info,
+                                  dx,
+                                  &h_beta,
+                                  dy_1);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_csrmv_mixed(handle,
+                                  transA,
+                                  m,
+                                  n,
+                                  nnz,
+                                  &h_alpha,
+                                  descr,
+                                  dval,
+                                  dptr,
+                                  dcol,
+                                  info,
+                                  dx,
+                                  &h_beta,
+                                  dy_1);
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        spmv_mixed_print(m,
+                         n,
+                         nnz,
+                         h_alpha,
+                         h_beta,
+                         nnz * sizeof(U) + (m + 1 + nnz) * sizeof(rocsparse_int),
+                         gpu_time_used);
+
+        size_t bytes = roofline_csrmv_bytes<float, U>(
+            m, nnz, hcsr_row_ptr.data(), hcol_ind.data(), idx_base, h_beta, adaptive);
+
+        spmv_mixed_report<U>(
+            argus, "csrmv", adaptive ? "csr-adaptive" : "csr", m, n, nnz, bytes, gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename U>
+rocsparse_status testing_ellmv_mixed(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    float h_alpha                 = argus.alpha;
+    float h_beta                  = argus.beta;
+    rocsparse_operation transA    = argus.transA;
+    rocsparse_index_base idx_base = argus.idx_base;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<float> hval;
+
+    CHECK_ROCSPARSE_ERROR(
+        spmv_mixed_init(argus, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base));
+
+    std::vector<U> hval_mixed(nnz);
+    convert_values(hval.data(), hval_mixed.data(), nnz);
+
+    // Convert CSR to ELL
+    rocsparse_int ell_width = 0;
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        ell_width = std::max(hcsr_row_ptr[i + 1] - hcsr_row_ptr[i], ell_width);
+    }
+
+    rocsparse_int ell_nnz = ell_width * m;
+
+    std::vector<rocsparse_int> hell_col_ind(ell_nnz, -1);
+    std::vector<U> hell_val(ell_nnz);
+    float_to_value(0.0f, hell_val[0]);
+    std::fill(hell_val.begin(), hell_val.end(), hell_val[0]);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int p = 0;
+        for(rocsparse_int j = hcsr_row_ptr[i] - idx_base; j < hcsr_row_ptr[i + 1] - idx_base;
+            ++j)
+        {
+            rocsparse_int idx = ELL_IND(i, p++, m, ell_width);
+            hell_col_ind[idx] = hcol_ind[j];
+            hell_val[idx]     = hval_mixed[j];
+        }
+    }
+
+    std::vector<float> hx(n);
+    std::vector<float> hy(m);
+    std::vector<float> hy_1(m);
+    std::vector<float> hy_2(m);
+
+    rocsparse_init<float>(hx, 1, n);
+    rocsparse_init<float>(hy, 1, m);
+
+    // allocate memory on device
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * ell_nnz), device_free};
+    auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(U) * ell_nnz), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(float) * n), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(float)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(float)), device_free};
+
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    U* dval             = (U*)dval_managed.get();
+    float* dx           = (float*)dx_managed.get();
+    float* dy_1         = (float*)dy_1_managed.get();
+    float* dy_2         = (float*)dy_2_managed.get();
+    float* d_alpha      = (float*)d_alpha_managed.get();
+    float* d_beta       = (float*)d_beta_managed.get();
+
+    if(!dval || !dcol || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dcol || !dx || "
+                                        "!dy_1 || !dy_2 || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcol, hell_col_ind.data(), sizeof(rocsparse_int) * ell_nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hell_val.data(), sizeof(U) * ell_nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(float) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(float) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy.data(), sizeof(float) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(float), hipMemcpyHostToDevice));
+
+    if(argus.unit_check)
+    {
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_ellmv_mixed(
+            handle, transA, m, n, &h_alpha, descr, dval, dcol, ell_width, dx, &h_beta, dy_1));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_ellmv_mixed(
+            handle, transA, m, n, d_alpha, descr, dval, dcol, ell_width, dx, d_beta, dy_2));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(float) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(float) * m, hipMemcpyDeviceToHost));
+
+        spmv_mixed_check(
+            m, h_alpha, h_beta, hcsr_row_ptr, hcol_ind, hval, hval_mixed, hx, hy, hy_1, idx_base);
+        spmv_mixed_check(
+            m, h_alpha, h_beta, hcsr_row_ptr, hcol_ind, hval, hval_mixed, hx, hy, hy_2, idx_base);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_ellmv_mixed(
+                handle, transA, m, n, &h_alpha, descr, dval, dcol, ell_width, dx, &h_beta, dy_1);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_ellmv_mixed(
+                handle, transA, m, n, &h_alpha, descr, dval, dcol, ell_width, dx, &h_beta, dy_1);
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        spmv_mixed_print(m,
+                         n,
+                         nnz,
+                         h_alpha,
+                         h_beta,
+                         ell_nnz * (sizeof(U) + sizeof(rocsparse_int)),
+                         gpu_time_used);
+
+        size_t bytes = roofline_ellmv_bytes<float, U>(
+            transA, m, n, ell_width, hell_col_ind.data(), idx_base, h_beta);
+
+        spmv_mixed_report<U>(argus, "ellmv", "ell", m, n, nnz, bytes, gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename U>
+rocsparse_status testing_hybmv_mixed(Arguments argus)
+{
+    rocsparse_int m               = argus.M;
+    rocsparse_int n               = argus.N;
+    float h_alpha                 = argus.alpha;
+    float h_beta                  = argus.beta;
+    rocsparse_operation transA    = argus.transA;
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_hyb_partition part  = argus.part;
+    rocsparse_int user_ell_width  = argus.ell_width;
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    std::unique_ptr<hyb_struct> test_hyb(new hyb_struct);
+    rocsparse_hyb_mat hyb = test_hyb->hyb;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Determine number of non-zero elements
+    double scale = 0.02;
+    if(m > 1000 || n > 1000)
+    {
+        scale = 2.0 / std::max(m, n);
+    }
+    rocsparse_int nnz = m * scale * n;
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcol_ind;
+    std::vector<float> hval;
+
+    CHECK_ROCSPARSE_ERROR(
+        spmv_mixed_init(argus, m, n, nnz, hcsr_row_ptr, hcol_ind, hval, idx_base));
+
+    std::vector<U> hval_mixed(nnz);
+    convert_values(hval.data(), hval_mixed.data(), nnz);
+
+    std::vector<float> hx(n);
+    std::vector<float> hy(m);
+    std::vector<float> hy_1(m);
+    std::vector<float> hy_2(m);
+
+    rocsparse_init<float>(hx, 1, n);
+    rocsparse_init<float>(hy, 1, m);
+
+    // allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed    = rocsparse_unique_ptr{device_malloc(sizeof(U) * nnz), device_free};
+    auto dx_managed      = rocsparse_unique_ptr{device_malloc(sizeof(float) * n), device_free};
+    auto dy_1_managed    = rocsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+    auto dy_2_managed    = rocsparse_unique_ptr{device_malloc(sizeof(float) * m), device_free};
+    auto d_alpha_managed = rocsparse_unique_ptr{device_malloc(sizeof(float)), device_free};
+    auto d_beta_managed  = rocsparse_unique_ptr{device_malloc(sizeof(float)), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    U* dval             = (U*)dval_managed.get();
+    float* dx           = (float*)dx_managed.get();
+    float* dy_1         = (float*)dy_1_managed.get();
+    float* dy_2         = (float*)dy_2_managed.get();
+    float* d_alpha      = (float*)d_alpha_managed.get();
+    float* d_beta       = (float*)d_beta_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy_1 || !dy_2 || !d_alpha || !d_beta)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dx || "
+                                        "!dy_1 || !dy_2 || !d_alpha || !d_beta");
+        return rocsparse_status_memory_error;
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcol_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hval_mixed.data(), sizeof(U) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(float) * n, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy.data(), sizeof(float) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy.data(), sizeof(float) * m, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(float), hipMemcpyHostToDevice));
+
+    // Limit ELL user width
+    if(part == rocsparse_hyb_partition_user)
+    {
+        rocsparse_int width_limit = (2 * nnz - 1) / m + 1;
+
+        user_ell_width = user_ell_width * nnz / m;
+        user_ell_width = std::min(width_limit, user_ell_width);
+    }
+
+    // Convert CSR to HYB
+    CHECK_ROCSPARSE_ERROR(
+        rocsparse_csr2hyb(handle, m, n, descr, dval, dptr, dcol, hyb, user_ell_width, part));
+
+    if(argus.unit_check)
+    {
+        // ROCSPARSE pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_hybmv_mixed<U>(handle, transA, &h_alpha, descr, hyb, dx, &h_beta, dy_1));
+
+        // ROCSPARSE pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_hybmv_mixed<U>(handle, transA, d_alpha, descr, hyb, dx, d_beta, dy_2));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hy_1.data(), dy_1, sizeof(float) * m, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hy_2.data(), dy_2, sizeof(float) * m, hipMemcpyDeviceToHost));
+
+        spmv_mixed_check(
+            m, h_alpha, h_beta, hcsr_row_ptr, hcol_ind, hval, hval_mixed, hx, hy, hy_1, idx_base);
+        spmv_mixed_check(
+            m, h_alpha, h_beta, hcsr_row_ptr, hcol_ind, hval, hval_mixed, hx, hy, hy_2, idx_base);
+    }
+
+    if(argus.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = argus.iters;
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocsparse_hybmv_mixed<U>(handle, transA, &h_alpha, descr, hyb, dx, &h_beta, dy_1);
+        }
+
+        double gpu_time_used = get_time_us(); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocsparse_hybmv_mixed<U>(handle, transA, &h_alpha, descr, hyb, dx, &h_beta, dy_1);
+        }
+
+        // Convert to miliseconds per call
+        gpu_time_used = (get_time_us() - gpu_time_used) / (number_hot_calls * 1e3);
+
+        testhyb* dhyb  = (testhyb*)hyb;
+        size_t ell_mem = dhyb->ell_nnz * (sizeof(rocsparse_int) + sizeof(U));
+        size_t coo_mem = dhyb->coo_nnz * (sizeof(rocsparse_int) * 2 + sizeof(U));
+
+        spmv_mixed_print(m, n, nnz, h_alpha, h_beta, ell_mem + coo_mem, gpu_time_used);
+
+        size_t bytes = roofline_hybmv_bytes<float, U>(transA,
+                                                      m,
+                                                      n,
+                                                      dhyb->ell_width,
+                                                      dhyb->ell_col_ind,
+                                                      dhyb->coo_nnz,
+                                                      dhyb->coo_row_ind,
+                                                      dhyb->coo_col_ind,
+                                                      idx_base,
+                                                      h_beta);
+
+        spmv_mixed_report<U>(argus, "hybmv", "hyb", m, n, nnz, bytes, gpu_time_used);
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // TESTING_SPMV_MIXED_HPP
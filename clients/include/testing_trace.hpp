@@ -0,0 +1,255 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TESTING_TRACE_HPP
+#define TESTING_TRACE_HPP
+
+#include "rocsparse_test_unique_ptr.hpp"
+#include "rocsparse.hpp"
+#include "trace_decode.hpp"
+#include "utility.hpp"
+#include "unit.hpp"
+
+#include <sstream>
+#include <string>
+#include <rocsparse.h>
+
+using namespace rocsparse;
+using namespace rocsparse_test;
+
+// The library opens the binary trace once per process and keeps appending to it, thus
+// all tests share a single trace file that is removed when the process exits
+inline const std::string& trace_binary_path()
+{
+    static scoped_temp_dir dir;
+    static std::string path = dir.path + "/trace.bin";
+
+    return path;
+}
+
+// Last lines of the binary trace, decoded into the text of the given kind
+inline std::vector<std::string> trace_decode_lines(rocsparse_trace_kind kind, size_t nlines)
+{
+    std::ifstream in(trace_binary_path(), std::ios::binary);
+    std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::ostringstream os;
+    std::vector<std::string> lines;
+
+    if(trace_decode(data, kind, false, os) != 0)
+    {
+        return lines;
+    }
+
+    std::istringstream is(os.str());
+    std::string line;
+
+    while(std::getline(is, line))
+    {
+        if(!line.empty())
+        {
+            lines.push_back(line);
+        }
+    }
+
+    if(lines.size() > nlines)
+    {
+        lines.erase(lines.begin(), lines.end() - nlines);
+    }
+
+    return lines;
+}
+
+// Compare decoded lines against the lines of a text log
+inline rocsparse_status trace_compare(const std::vector<std::string>& text,
+                                      const std::vector<std::string>& decoded)
+{
+    size_t ntext    = text.size();
+    size_t ndecoded = decoded.size();
+
+    unit_check_general(1, 1, 1, &ntext, &ndecoded);
+
+    if(ntext != ndecoded || ntext == 0)
+    {
+        return rocsparse_status_internal_error;
+    }
+
+    for(size_t i = 0; i < ntext; ++i)
+    {
+        if(text[i] != decoded[i])
+        {
+            fprintf(stderr, "Logged: %s\nDecoded: %s\n", text[i].c_str(), decoded[i].c_str());
+            return rocsparse_status_internal_error;
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+// Calls of the round trip, covering integer, floating point, pointer and string arguments
+template <typename T>
+rocsparse_status trace_calls(const rocsparse_mat_descr descr,
+                             rocsparse_int m,
+                             rocsparse_int nnz,
+                             const rocsparse_int* dptr,
+                             const rocsparse_int* dcol,
+                             const T* dval,
+                             const T* dx,
+                             T* dy)
+{
+    T h_alpha = 1.5;
+    T h_beta  = 0.25;
+
+    rocsparse_int version;
+    char rev[64];
+
+    std::unique_ptr<handle_struct> test_handle(new handle_struct);
+    rocsparse_handle handle = test_handle->handle;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_version(handle, &version));
+    CHECK_ROCSPARSE_ERROR(rocsparse_get_git_rev(handle, rev));
+
+    for(int i = 0; i < 2; ++i)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrmv(handle,
+                                              rocsparse_operation_none,
+                                              m,
+                                              m,
+                                              nnz,
+                                              &h_alpha,
+                                              descr,
+                                              dval,
+                                              dptr,
+                                              dcol,
+                                              nullptr,
+                                              dx,
+                                              &h_beta,
+                                              dy));
+    }
+
+    return rocsparse_status_success;
+}
+
+// Calls recorded in the binary trace decode to the lines that log_trace and log_bench
+// write for the same calls
+template <typename T>
+rocsparse_status testing_trace_binary(Arguments argus)
+{
+    rocsparse_index_base idx_base = argus.idx_base;
+    rocsparse_int ndim            = argus.laplacian;
+
+    scoped_temp_dir dir;
+
+    if(dir.path.empty() || trace_binary_path() == "/trace.bin")
+    {
+        verify_rocsparse_status_success(rocsparse_status_internal_error, "mkdtemp");
+        return rocsparse_status_internal_error;
+    }
+
+    std::string trace_path = dir.path + "/trace.log";
+    std::string bench_path = dir.path + "/bench.log";
+
+    std::unique_ptr<descr_struct> test_descr(new descr_struct);
+    rocsparse_mat_descr descr = test_descr->descr;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, idx_base));
+
+    // Host structures
+    std::vector<rocsparse_int> hcsr_row_ptr;
+    std::vector<rocsparse_int> hcsr_col_ind;
+    std::vector<T> hcsr_val;
+
+    rocsparse_int m   = gen_2d_laplacian(ndim, hcsr_row_ptr, hcsr_col_ind, hcsr_val, idx_base);
+    rocsparse_int nnz = hcsr_row_ptr[m] - idx_base;
+
+    std::vector<T> hx(m, static_cast<T>(1));
+
+    // Allocate memory on device
+    auto dptr_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * (m + 1)), device_free};
+    auto dcol_managed =
+        rocsparse_unique_ptr{device_malloc(sizeof(rocsparse_int) * nnz), device_free};
+    auto dval_managed = rocsparse_unique_ptr{device_malloc(sizeof(T) * nnz), device_free};
+    auto dx_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+    auto dy_managed   = rocsparse_unique_ptr{device_malloc(sizeof(T) * m), device_free};
+
+    rocsparse_int* dptr = (rocsparse_int*)dptr_managed.get();
+    rocsparse_int* dcol = (rocsparse_int*)dcol_managed.get();
+    T* dval             = (T*)dval_managed.get();
+    T* dx               = (T*)dx_managed.get();
+    T* dy               = (T*)dy_managed.get();
+
+    if(!dval || !dptr || !dcol || !dx || !dy)
+    {
+        verify_rocsparse_status_success(rocsparse_status_memory_error,
+                                        "!dval || !dptr || !dcol || !dx || !dy");
+        return rocsparse_status_memory_error;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        dptr, hcsr_row_ptr.data(), sizeof(rocsparse_int) * (m + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcol, hcsr_col_ind.data(), sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dval, hcsr_val.data(), sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * m, hipMemcpyHostToDevice));
+
+    int layer = rocsparse_layer_mode_log_trace | rocsparse_layer_mode_log_bench;
+
+    // Text logs, complete once the handle is destroyed
+    {
+        scoped_env env;
+
+        env.set("ROCSPARSE_LAYER", std::to_string(layer));
+        env.set("ROCSPARSE_LOG_TRACE_PATH", trace_path);
+        env.set("ROCSPARSE_LOG_BENCH_PATH", bench_path);
+
+        CHECK_ROCSPARSE_ERROR(trace_calls(descr, m, nnz, dptr, dcol, dval, dx, dy));
+    }
+
+    // Binary trace, the records of the thread are flushed when the handle is destroyed
+    {
+        scoped_env env;
+
+        env.set("ROCSPARSE_LAYER", std::to_string(layer | rocsparse_layer_mode_log_binary));
+        env.set("ROCSPARSE_LOG_BINARY_PATH", trace_binary_path());
+
+        CHECK_ROCSPARSE_ERROR(trace_calls(descr, m, nnz, dptr, dcol, dval, dx, dy));
+    }
+
+    std::vector<std::string> trace_lines = read_lines(trace_path);
+    std::vector<std::string> bench_lines = read_lines(bench_path);
+
+    rocsparse_status status = trace_compare(
+        trace_lines, trace_decode_lines(rocsparse_trace_kind_trace, trace_lines.size()));
+
+    if(status != rocsparse_status_success)
+    {
+        return status;
+    }
+
+    return trace_compare(bench_lines,
+                         trace_decode_lines(rocsparse_trace_kind_bench, bench_lines.size()));
+}
+
+#endif // TESTING_TRACE_HPP
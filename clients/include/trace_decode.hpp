@@ -0,0 +1,222 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef TRACE_DECODE_HPP
+#define TRACE_DECODE_HPP
+
+// Decoder for the binary trace written by the log_binary layer. Reproduces the
+// text that the log_trace and log_bench layers write for the same calls.
+
+#include "trace_format.h"
+
+#include <ostream>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+template <typename T>
+inline bool trace_get(const char*& ptr, const char* end, T& val)
+{
+    if(ptr + sizeof(T) > end)
+    {
+        return false;
+    }
+
+    memcpy(&val, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return true;
+}
+
+// Print a single scalar, preceded by separator
+template <typename T>
+inline bool trace_decode_scalar(std::ostream& os,
+                                const std::string& separator,
+                                const char*& ptr,
+                                const char* end)
+{
+    T val;
+
+    if(!trace_get(ptr, end, val))
+    {
+        return false;
+    }
+
+    os << separator << val;
+    return true;
+}
+
+// Print real and imaginary part, each preceded by separator
+template <typename T>
+inline bool trace_decode_complex(std::ostream& os,
+                                 const std::string& separator,
+                                 const char*& ptr,
+                                 const char* end)
+{
+    T val[2];
+
+    if(!trace_get(ptr, end, val))
+    {
+        return false;
+    }
+
+    os << separator << val[0] << separator << val[1];
+    return true;
+}
+
+inline bool trace_decode_pointer(std::ostream& os,
+                                 const std::string& separator,
+                                 const char*& ptr,
+                                 const char* end)
+{
+    uint64_t val;
+
+    if(!trace_get(ptr, end, val))
+    {
+        return false;
+    }
+
+    os << separator << reinterpret_cast<const void*>(static_cast<uintptr_t>(val));
+    return true;
+}
+
+inline bool trace_decode_string(std::ostream& os,
+                                const std::string& separator,
+                                const char*& ptr,
+                                const char* end)
+{
+    uint32_t len;
+
+    if(!trace_get(ptr, end, len) || ptr + len > end)
+    {
+        return false;
+    }
+
+    os << separator << std::string(ptr, len);
+    ptr += len;
+    return true;
+}
+
+// Print a single argument, preceded by separator
+inline bool trace_decode_arg(std::ostream& os,
+                             const std::string& separator,
+                             const char*& ptr,
+                             const char* end)
+{
+    uint8_t tag;
+
+    if(!trace_get(ptr, end, tag))
+    {
+        return false;
+    }
+
+    switch(tag)
+    {
+    case rocsparse_trace_arg_int: return trace_decode_scalar<int64_t>(os, separator, ptr, end);
+    case rocsparse_trace_arg_uint: return trace_decode_scalar<uint64_t>(os, separator, ptr, end);
+    case rocsparse_trace_arg_float: return trace_decode_scalar<float>(os, separator, ptr, end);
+    case rocsparse_trace_arg_double: return trace_decode_scalar<double>(os, separator, ptr, end);
+    case rocsparse_trace_arg_pointer: return trace_decode_pointer(os, separator, ptr, end);
+    case rocsparse_trace_arg_string: return trace_decode_string(os, separator, ptr, end);
+    case rocsparse_trace_arg_float_complex:
+        return trace_decode_complex<float>(os, separator, ptr, end);
+    case rocsparse_trace_arg_double_complex:
+        return trace_decode_complex<double>(os, separator, ptr, end);
+    default: return false;
+    }
+}
+
+/*! \brief  Decode the records of the given kind of a binary trace into the text that
+ *          log_trace or log_bench would have written. If timestamps is set, records are
+ *          prefixed with thread id and time stamp in nanoseconds. Returns 0 on success.
+ */
+inline int trace_decode(const std::vector<char>& data,
+                        rocsparse_trace_kind kind,
+                        bool timestamps,
+                        std::ostream& os)
+{
+    // Same separators as log_trace and log_bench
+    std::string separator = (kind == rocsparse_trace_kind_trace) ? "," : " ";
+
+    const char* ptr = data.data();
+    const char* end = ptr + data.size();
+
+    rocsparse_trace_file_header file_header;
+
+    if(!trace_get(ptr, end, file_header) || file_header.magic != ROCSPARSE_TRACE_MAGIC)
+    {
+        fprintf(stderr, "Not a rocSPARSE trace file\n");
+        return -1;
+    }
+
+    if(file_header.version != ROCSPARSE_TRACE_VERSION)
+    {
+        fprintf(stderr, "Unsupported trace version %u\n", file_header.version);
+        return -1;
+    }
+
+    while(ptr < end)
+    {
+        const char* record = ptr;
+
+        rocsparse_trace_header header;
+
+        if(!trace_get(ptr, end, header) || header.size < sizeof(header) ||
+           record + header.size > end)
+        {
+            fprintf(stderr, "Truncated record at offset %zu\n", (size_t)(record - data.data()));
+            return -1;
+        }
+
+        const char* record_end = record + header.size;
+
+        if(header.kind == kind && header.nargs > 0)
+        {
+            if(timestamps)
+            {
+                os << "\n[" << header.thread << ":" << header.timestamp << "]";
+            }
+
+            // The head is preceded by a new line instead of a separator
+            bool ok = trace_decode_arg(os, timestamps ? " " : "\n", ptr, record_end);
+
+            for(uint16_t i = 1; ok && i < header.nargs; ++i)
+            {
+                ok = trace_decode_arg(os, separator, ptr, record_end);
+            }
+
+            if(!ok)
+            {
+                fprintf(stderr, "Malformed record at offset %zu\n", (size_t)(record - data.data()));
+                return -1;
+            }
+        }
+
+        ptr = record_end;
+    }
+
+    return 0;
+}
+
+#endif // TRACE_DECODE_HPP
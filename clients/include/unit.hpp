@@ -50,4 +50,9 @@ void unit_check_general(rocsparse_int M, rocsparse_int N, rocsparse_int lda, T*
 template <typename T>
 void unit_check_near(rocsparse_int M, rocsparse_int N, rocsparse_int lda, T* hCPU, T* hGPU);
 
+/*! \brief gtest unit compare a vector against a double precision reference within
+ *  element-wise error bounds */
+void unit_check_bound(rocsparse_int M, const double* hCPU, const float* hGPU, const double* bound);
+void unit_check_bound(rocsparse_int M, const double* hCPU, const double* hGPU, const double* bound);
+
 #endif // UNIT_HPP
@@ -27,14 +27,28 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <sstream>
+#include <thread>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <typeinfo>
+#include <dirent.h>
+#include <unistd.h>
 #include <rocsparse.h>
 #include <hip/hip_runtime_api.h>
 
+#if defined(__F16C__) || defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
 /*!\file
  * \brief provide data initialization and timing utilities.
  */
@@ -98,6 +112,47 @@ T random_generator()
     return (T)(rand() % 10 + 1); // generate a integer number between [1, 10]
 };
 
+/*! \brief  generate a random complex number, real and imaginary part between [1, 10] . */
+template <>
+inline rocsparse_float_complex random_generator<rocsparse_float_complex>()
+{
+    float re = static_cast<float>(rand() % 10 + 1);
+    float im = static_cast<float>(rand() % 10 + 1);
+    return rocsparse_float_complex(re, im);
+}
+
+template <>
+inline rocsparse_double_complex random_generator<rocsparse_double_complex>()
+{
+    double re = static_cast<double>(rand() % 10 + 1);
+    double im = static_cast<double>(rand() % 10 + 1);
+    return rocsparse_double_complex(re, im);
+}
+
+/* ============================================================================================ */
+/* host arithmetic for real and complex types :*/
+
+/*! \brief  complex conjugate, identity for real types. */
+template <typename T>
+inline T host_conj(T val)
+{
+    return val;
+}
+
+template <typename T>
+inline rocsparse_complex_num<T> host_conj(rocsparse_complex_num<T> val)
+{
+    return rocsparse_complex_num<T>(val.x, -val.y);
+}
+
+/*! \brief  fused multiply add a * b + c, complex types are resolved by argument lookup. */
+template <typename T>
+inline T host_fma(T a, T b, T c)
+{
+    using std::fma;
+    return fma(a, b, c);
+}
+
 /* ============================================================================================ */
 /*! \brief  matrix/vector initialization: */
 // for vector x (M=1, N=lengthX);
@@ -343,195 +398,302 @@ void gen_matrix_coo(rocsparse_int m,
 }
 
 /* ============================================================================================ */
-/*! \brief  Read matrix from mtx file in COO format */
-template <typename T>
-rocsparse_int read_mtx_matrix(const char* filename,
-                              rocsparse_int& nrow,
-                              rocsparse_int& ncol,
-                              rocsparse_int& nnz,
-                              std::vector<rocsparse_int>& row,
-                              std::vector<rocsparse_int>& col,
-                              std::vector<T>& val,
-                              rocsparse_index_base idx_base)
+/*! \brief  Number of host threads to use for a given number of independent work items */
+inline int host_threads(size_t work)
 {
-    printf("Reading matrix %s...", filename);
-    fflush(stdout);
+    size_t nthreads = std::max(1u, std::thread::hardware_concurrency());
+    return static_cast<int>(std::max<size_t>(1, std::min(nthreads, work)));
+}
 
-    FILE* f = fopen(filename, "r");
-    if(!f)
+/*! \brief  Run f(t) for t = 0, ..., nthreads - 1 on separate host threads */
+template <typename F>
+void host_parallel(int nthreads, F f)
+{
+    std::vector<std::thread> threads;
+
+    for(int t = 1; t < nthreads; ++t)
     {
-        return -1;
+        threads.push_back(std::thread(f, t));
     }
 
-    char line[1024];
+    f(0);
 
-    // Check for banner
-    if(!fgets(line, 1024, f))
+    for(size_t t = 0; t < threads.size(); ++t)
     {
-        return -1;
+        threads[t].join();
     }
+}
 
-    char banner[16];
-    char array[16];
-    char coord[16];
-    char data[16];
-    char type[16];
+/* ============================================================================================ */
+/*! \brief  Host matrix in CSR format with zero based indices, rows are sorted by column index,
+ *          as returned by the MatrixMarket reader and the matrix generators. Values are kept in
+ *          double precision, the imaginary part is only stored for complex matrices.
+ */
+struct mtx_csr_matrix
+{
+    rocsparse_int m   = 0;
+    rocsparse_int n   = 0;
+    rocsparse_int nnz = 0;
 
-    // Extract banner
-    if(sscanf(line, "%s %s %s %s %s", banner, array, coord, data, type) != 5)
-    {
-        return -1;
-    }
+    std::vector<rocsparse_int> ptr;
+    std::vector<rocsparse_int> col;
+    std::vector<double> re;
+    std::vector<double> im;
+};
 
-    // Convert to lower case
-    for(char *p = array; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char *p = coord; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char *p = data; *p != '\0'; *p = tolower(*p), p++)
-        ;
-    for(char *p = type; *p != '\0'; *p = tolower(*p), p++)
-        ;
+/*! \brief  COO entries with zero based indices, produced by a single host thread */
+struct coo_chunk
+{
+    std::vector<rocsparse_int> row;
+    std::vector<rocsparse_int> col;
+    std::vector<double> re;
+    std::vector<double> im;
+};
 
-    // Check banner
-    if(strncmp(line, "%%MatrixMarket", 14) != 0)
-    {
-        return -1;
-    }
+/*! \brief  Assemble a CSR matrix from the COO entries of multiple host threads, one thread per
+ *          chunk. Duplicate entries are summed up if requested, else kept in chunk order.
+ *          Returns false if the matrix exceeds the index range.
+ */
+bool assemble_csr_matrix(std::vector<coo_chunk>& chunk,
+                         rocsparse_int m,
+                         rocsparse_int n,
+                         bool complex,
+                         bool sum_duplicates,
+                         mtx_csr_matrix& A);
+
+/*! \brief  Read matrix from mtx file in CSR format. The file is memory mapped and parsed by
+ *          multiple threads, the result is cached in a binary file next to the mtx file unless
+ *          ROCSPARSE_MTX_CACHE=0. Returns 0 on success.
+ */
+rocsparse_int read_mtx_csr(const char* filename, mtx_csr_matrix& mtx);
 
-    // Check array type
-    if(strcmp(array, "matrix") != 0)
-    {
-        return -1;
-    }
+/*! \brief  Parse a MatrixMarket file in memory [data, data + size) in CSR format, the entries
+ *          are split into nthreads chunks of complete lines. Returns 0 on success.
+ */
+rocsparse_int parse_mtx_csr(const char* data, size_t size, int nthreads, mtx_csr_matrix& mtx);
+
+/*! \brief  Generate a synthetic matrix in CSR format. Generators are
+ *          - stencil7, stencil27: 3D stencil on a dim^3 grid
+ *          - block: 27 point connectivity on a dim^3 grid of dense block_dim^2 blocks
+ *          - banded: dim rows with full band of the given bandwidth
+ *          - chain: dim rows forming a single triangular dependency chain, with bandwidth
+ *            extra dependencies per row
+ *          - rmat: power-law R-MAT graph with 2^dim vertices and edge_factor edges per vertex
+ *          All matrices are square and strictly diagonally dominant. Returns 0 on success.
+ */
+rocsparse_int gen_matrix_csr(const std::string& generator,
+                             rocsparse_int dim,
+                             rocsparse_int bandwidth,
+                             rocsparse_int block_dim,
+                             rocsparse_int edge_factor,
+                             mtx_csr_matrix& A);
 
-    // Check coord
-    if(strcmp(coord, "coordinate") != 0)
-    {
-        return -1;
-    }
+/* ============================================================================================ */
+/*! \brief  CSR matrix of a mapped container file. The arrays point into a read only shared
+ *          mapping of the file, such that all processes that map the same file share a single
+ *          physical copy of the matrix, without copying it into private buffers.
+ */
+struct mapped_csr_matrix
+{
+    rocsparse_int m   = 0;
+    rocsparse_int n   = 0;
+    rocsparse_int nnz = 0;
 
-    // Check data
-    if(strcmp(data, "real") != 0 && strcmp(data, "integer") != 0 && strcmp(data, "pattern") != 0)
-    {
-        return -1;
-    }
+    rocsparse_index_base idx_base = rocsparse_index_base_zero;
 
-    // Check type
-    if(strcmp(type, "general") != 0 && strcmp(type, "symmetric") != 0)
-    {
-        return -1;
-    }
+    // value type, same codes as the value types of operand captures
+    uint32_t value_type = 0;
 
-    // Symmetric flag
-    rocsparse_int symm = !strcmp(type, "symmetric");
+    const rocsparse_int* ptr = nullptr;
+    const rocsparse_int* col = nullptr;
+    const void* val          = nullptr;
 
-    // Skip comments
-    while(fgets(line, 1024, f))
-    {
-        if(line[0] != '%')
-        {
-            break;
-        }
-    }
+    // mapping of the whole file
+    void* data  = nullptr;
+    size_t size = 0;
 
-    // Read dimensions
-    rocsparse_int snnz;
+    // transparent huge pages have been advised, pages have been interleaved
+    bool huge_pages  = false;
+    bool interleaved = false;
+};
 
-    sscanf(line, "%d %d %d", &nrow, &ncol, &snnz);
-    nnz = symm ? (snnz - nrow) * 2 + nrow : snnz;
+/*! \brief  Hints for mapping a CSR container
+ *          - huge_pages: align the mapping to 2MB and advise transparent huge pages
+ *          - interleave: fault the pages that are not cached yet in with NUMA interleaving,
+ *            implies populate
+ *          - populate: fault all pages in before returning, else read ahead asynchronously
+ */
+struct mapped_csr_hints
+{
+    bool huge_pages = false;
+    bool interleave = false;
+    bool populate   = false;
+};
 
-    std::vector<rocsparse_int> unsorted_row(nnz);
-    std::vector<rocsparse_int> unsorted_col(nnz);
-    std::vector<T> unsorted_val(nnz);
+/*! \brief  Parse mapping hints from a comma separated list of huge, interleave and populate.
+ *          Returns 0 on success.
+ */
+rocsparse_int parse_mapped_csr_hints(const std::string& list, mapped_csr_hints& hints);
 
-    // Read entries
-    rocsparse_int idx = 0;
-    while(fgets(line, 1024, f))
-    {
-        if(idx >= nnz)
-        {
-            return true;
-        }
+/*! \brief  Write a CSR matrix to a container file, whose arrays start at 2MB boundaries. The
+ *          file is written to a temporary file and renamed, such that processes mapping it never
+ *          see a partial container. Returns 0 on success.
+ */
+rocsparse_int write_mapped_csr(const char* filename,
+                               rocsparse_int m,
+                               rocsparse_int n,
+                               rocsparse_int nnz,
+                               const rocsparse_int* ptr,
+                               const rocsparse_int* col,
+                               const void* val,
+                               uint32_t value_type,
+                               size_t value_size,
+                               rocsparse_index_base idx_base);
+
+/*! \brief  Map a CSR container file read only and shared. Returns 0 on success. */
+rocsparse_int
+    map_csr_matrix(const char* filename, const mapped_csr_hints& hints, mapped_csr_matrix& A);
+
+/*! \brief  Release the mapping of a CSR container */
+void unmap_csr_matrix(mapped_csr_matrix& A);
+
+/*! \brief  Fraction of the pages of a mapped CSR container that are resident in memory */
+double mapped_csr_resident(const mapped_csr_matrix& A);
 
-        rocsparse_int irow;
-        rocsparse_int icol;
-        T ival;
+template <typename T>
+inline uint32_t mapped_csr_value_type();
 
-        std::istringstream ss(line);
+template <>
+inline uint32_t mapped_csr_value_type<float>()
+{
+    return 0;
+}
 
-        if(!strcmp(data, "pattern"))
-        {
-            ss >> irow >> icol;
-            ival = static_cast<T>(1);
-        }
-        else
-        {
-            ss >> irow >> icol >> ival;
-        }
+template <>
+inline uint32_t mapped_csr_value_type<double>()
+{
+    return 1;
+}
 
-        if(idx_base == rocsparse_index_base_zero)
-        {
-            --irow;
-            --icol;
-        }
+/*! \brief  Values of a mapped CSR container, nullptr if they are not of type T */
+template <typename T>
+const T* mapped_csr_values(const mapped_csr_matrix& A)
+{
+    return (A.value_type == mapped_csr_value_type<T>()) ? static_cast<const T*>(A.val) : nullptr;
+}
+
+/* ============================================================================================ */
+/*! \brief  Header of operand captures written by the library if ROCSPARSE_CAPTURE_PATH is set,
+ *          see library/src/include/capture_format.h for the file layout.
+ */
+#define ROCSPARSE_CAPTURE_MAGIC 0x43505352
+#define ROCSPARSE_CAPTURE_VERSION 1
+
+struct rocsparse_capture_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t format;
+    uint32_t value_type;
+    uint32_t index_size;
+    uint32_t idx_base;
+    int64_t m;
+    int64_t n;
+    int64_t nnz;
+    int64_t ell_width;
+};
+
+template <typename T>
+rocsparse_int read_capture_matrix(const char* filename,
+                                  rocsparse_int& nrow,
+                                  rocsparse_int& ncol,
+                                  rocsparse_int& nnz,
+                                  std::vector<rocsparse_int>& row,
+                                  std::vector<rocsparse_int>& col,
+                                  std::vector<T>& val,
+                                  rocsparse_index_base idx_base);
+
+template <typename T>
+inline void capture_to_value(double re, double im, T& val);
+
+template <typename T>
+inline void capture_to_value(double re, double im, rocsparse_complex_num<T>& val);
+
+/*! \brief  Convert host CSR matrix to sorted COO format with the value type of the test */
+template <typename T>
+void csr_matrix_to_coo(const mtx_csr_matrix& A,
+                       rocsparse_int& nrow,
+                       rocsparse_int& ncol,
+                       rocsparse_int& nnz,
+                       std::vector<rocsparse_int>& row,
+                       std::vector<rocsparse_int>& col,
+                       std::vector<T>& val,
+                       rocsparse_index_base idx_base)
+{
+    nrow = A.m;
+    ncol = A.n;
+    nnz  = A.nnz;
 
-        unsorted_row[idx] = irow;
-        unsorted_col[idx] = icol;
-        unsorted_val[idx] = ival;
+    row.resize(nnz);
+    col.resize(nnz);
+    val.resize(nnz);
 
-        ++idx;
+    rocsparse_int base = (idx_base == rocsparse_index_base_one) ? 1 : 0;
 
-        if(symm && irow != icol)
+    for(rocsparse_int i = 0; i < nrow; ++i)
+    {
+        for(rocsparse_int j = A.ptr[i]; j < A.ptr[i + 1]; ++j)
         {
-            if(idx >= nnz)
-            {
-                return true;
-            }
+            row[j] = i + base;
+            col[j] = A.col[j] + base;
 
-            unsorted_row[idx] = icol;
-            unsorted_col[idx] = irow;
-            unsorted_val[idx] = ival;
-            ++idx;
+            capture_to_value(A.re[j], A.im.empty() ? 0.0 : A.im[j], val[j]);
         }
     }
+}
+
+/*! \brief  Check whether file is an operand capture */
+inline bool is_capture_file(const char* filename)
+{
+    FILE* f = fopen(filename, "rb");
+    if(!f)
+    {
+        return false;
+    }
+
+    uint32_t magic = 0;
+    bool capture   = fread(&magic, sizeof(uint32_t), 1, f) == 1 && magic == ROCSPARSE_CAPTURE_MAGIC;
+
     fclose(f);
 
-    row.resize(nnz);
-    col.resize(nnz);
-    val.resize(nnz);
+    return capture;
+}
 
-    // Sort by row and column index
-    std::vector<rocsparse_int> perm(nnz);
-    for(rocsparse_int i = 0; i < nnz; ++i)
+/*! \brief  Read matrix from mtx file in COO format */
+template <typename T>
+rocsparse_int read_mtx_matrix(const char* filename,
+                              rocsparse_int& nrow,
+                              rocsparse_int& ncol,
+                              rocsparse_int& nnz,
+                              std::vector<rocsparse_int>& row,
+                              std::vector<rocsparse_int>& col,
+                              std::vector<T>& val,
+                              rocsparse_index_base idx_base)
+{
+    // Operand captures can be used wherever a MatrixMarket file is expected
+    if(is_capture_file(filename))
     {
-        perm[i] = i;
+        return read_capture_matrix(filename, nrow, ncol, nnz, row, col, val, idx_base);
     }
 
-    std::sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
-        if(unsorted_row[a] < unsorted_row[b])
-        {
-            return true;
-        }
-        else if(unsorted_row[a] == unsorted_row[b])
-        {
-            return (unsorted_col[a] < unsorted_col[b]);
-        }
-        else
-        {
-            return false;
-        }
-    });
+    mtx_csr_matrix mtx;
 
-    for(rocsparse_int i = 0; i < nnz; ++i)
+    if(read_mtx_csr(filename, mtx) != 0)
     {
-        row[i] = unsorted_row[perm[i]];
-        col[i] = unsorted_col[perm[i]];
-        val[i] = unsorted_val[perm[i]];
+        return -1;
     }
 
-    printf("done.\n");
-    fflush(stdout);
+    csr_matrix_to_coo(mtx, nrow, ncol, nnz, row, col, val, idx_base);
 
     return 0;
 }
@@ -599,6 +761,52 @@ rocsparse_int read_bin_matrix(const char* filename,
     return 0;
 }
 
+/* ============================================================================================ */
+/*! \brief  Write matrix to binary file in CSR format, in the layout of read_bin_matrix. Indices
+ *          are written zero based and values in double precision. Returns 0 on success.
+ */
+template <typename T>
+rocsparse_int write_bin_matrix(const char* filename,
+                               rocsparse_int nrow,
+                               rocsparse_int ncol,
+                               rocsparse_int nnz,
+                               const std::vector<rocsparse_int>& ptr,
+                               const std::vector<rocsparse_int>& col,
+                               const std::vector<T>& val,
+                               rocsparse_index_base idx_base)
+{
+    FILE* f = fopen(filename, "wb");
+    if(!f)
+    {
+        return -1;
+    }
+
+    std::vector<rocsparse_int> tmp_ptr(nrow + 1);
+    std::vector<rocsparse_int> tmp_col(nnz);
+    std::vector<double> tmp_val(nnz);
+
+    for(rocsparse_int i = 0; i < nrow + 1; ++i)
+    {
+        tmp_ptr[i] = ptr[i] - idx_base;
+    }
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        tmp_col[i] = col[i] - idx_base;
+        tmp_val[i] = static_cast<double>(val[i]);
+    }
+
+    bool ok = fwrite(&nrow, sizeof(int), 1, f) == 1 && fwrite(&ncol, sizeof(int), 1, f) == 1 &&
+              fwrite(&nnz, sizeof(int), 1, f) == 1 &&
+              fwrite(tmp_ptr.data(), sizeof(int), nrow + 1, f) == static_cast<size_t>(nrow + 1) &&
+              fwrite(tmp_col.data(), sizeof(int), nnz, f) == static_cast<size_t>(nnz) &&
+              fwrite(tmp_val.data(), sizeof(double), nnz, f) == static_cast<size_t>(nnz);
+
+    ok = (fclose(f) == 0) && ok;
+
+    return ok ? 0 : -1;
+}
+
 /* ============================================================================================ */
 /*! \brief  Compute incomplete LU factorization without fill-ins and no pivoting using CSR
  *  matrix storage format.
@@ -901,51 +1109,1226 @@ rocsparse_int usolve(rocsparse_int m,
     return -1;
 }
 
-#ifdef __cplusplus
-extern "C" {
-#endif
-
 /* ============================================================================================ */
-/*  query for rocsparse version and git commit SHA-1. */
-void query_version(char* version);
+/*! \brief  Convert single precision into half precision, rounding to nearest even. */
+inline rocsparse_half float_to_half(float f)
+{
+    rocsparse_half h;
+#if defined(__F16C__)
+    h.data = _cvtss_sh(f, 0);
+#else
+    uint32_t x;
+    memcpy(&x, &f, sizeof(uint32_t));
 
-/* ============================================================================================ */
-/*  device query and print out their ID and name */
-rocsparse_int query_device_property();
+    uint32_t sign = (x >> 16) & 0x8000;
+    uint32_t absx = x & 0x7fffffff;
 
-/*  set current device to device_id */
-void set_device(rocsparse_int device_id);
+    if(absx >= 0x7f800000)
+    {
+        // Inf and NaN
+        h.data = sign | 0x7c00 | (absx > 0x7f800000 ? 0x200 | ((absx >> 13) & 0x3ff) : 0);
+    }
+    else if(absx >= 0x477ff000)
+    {
+        // Overflow, rounds to Inf
+        h.data = sign | 0x7c00;
+    }
+    else if(absx < 0x38800000)
+    {
+        // Subnormal half precision number or zero
+        if(absx < 0x33000000)
+        {
+            h.data = sign;
+        }
+        else
+        {
+            uint32_t shift = 126 - (absx >> 23);
+            uint32_t mant  = (absx & 0x7fffff) | 0x800000;
+            uint32_t hm    = mant >> shift;
+            uint32_t rem   = mant & ((1u << shift) - 1);
+            uint32_t tie   = 1u << (shift - 1);
 
-/* ============================================================================================ */
-/*  timing: HIP only provides very limited timers function clock() and not general;
-            rocsparse sync CPU and device and use more accurate CPU timer*/
+            if(rem > tie || (rem == tie && (hm & 1)))
+            {
+                ++hm;
+            }
 
-/*! \brief  CPU Timer(in microsecond): synchronize with the default device and return wall time */
-double get_time_us(void);
+            h.data = sign | hm;
+        }
+    }
+    else
+    {
+        // Normal number, rebias exponent and round mantissa
+        uint32_t hm  = (absx - 0x38000000) >> 13;
+        uint32_t rem = absx & 0x1fff;
 
-/*! \brief  CPU Timer(in microsecond): synchronize with given queue/stream and return wall time */
-double get_time_us_sync(hipStream_t stream);
+        if(rem > 0x1000 || (rem == 0x1000 && (hm & 1)))
+        {
+            ++hm;
+        }
 
-#ifdef __cplusplus
-}
+        h.data = sign | hm;
+    }
 #endif
+    return h;
+}
 
-/* ============================================================================================ */
+/*! \brief  Convert half precision into single precision. */
+inline float half_to_float(rocsparse_half h)
+{
+#if defined(__F16C__)
+    return _cvtsh_ss(h.data);
+#else
+    uint32_t sign = static_cast<uint32_t>(h.data & 0x8000) << 16;
+    uint32_t exp  = (h.data >> 10) & 0x1f;
+    uint32_t mant = h.data & 0x3ff;
+    uint32_t x;
+
+    if(exp == 0)
+    {
+        if(mant == 0)
+        {
+            x = sign;
+        }
+        else
+        {
+            // Normalize subnormal number
+            exp = 113;
+            while(!(mant & 0x400))
+            {
+                mant <<= 1;
+                --exp;
+            }
 
-/*! \brief Class used to parse command arguments in both client & gtest   */
+            x = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+        }
+    }
+    else if(exp == 0x1f)
+    {
+        x = sign | 0x7f800000 | (mant << 13);
+    }
+    else
+    {
+        x = sign | ((exp + 112) << 23) | (mant << 13);
+    }
 
-// has to compile with option "-std=c++11", and this rocsparse library uses c++11 everywhere
-// c++11 allows intilization of member of a struct
+    float f;
+    memcpy(&f, &x, sizeof(float));
+    return f;
+#endif
+}
 
-class Arguments
+/*! \brief  Convert single precision into bfloat16, rounding to nearest even. */
+inline rocsparse_bfloat16 float_to_bfloat16(float f)
 {
-    public:
-    rocsparse_int M   = 128;
-    rocsparse_int N   = 128;
-    rocsparse_int K   = 128;
-    rocsparse_int nnz = 32;
+    uint32_t x;
+    memcpy(&x, &f, sizeof(uint32_t));
 
-    rocsparse_int ldb;
+    rocsparse_bfloat16 b;
+    if((x & 0x7fffffff) > 0x7f800000)
+    {
+        // Keep NaN quiet
+        b.data = (x >> 16) | 0x40;
+    }
+    else
+    {
+        b.data = (x + 0x7fff + ((x >> 16) & 1)) >> 16;
+    }
+
+    return b;
+}
+
+/*! \brief  Convert bfloat16 into single precision. */
+inline float bfloat16_to_float(rocsparse_bfloat16 b)
+{
+    uint32_t x = static_cast<uint32_t>(b.data) << 16;
+
+    float f;
+    memcpy(&f, &x, sizeof(float));
+    return f;
+}
+
+// Overloads to be used in code that is generic in the storage type
+inline float value_to_float(rocsparse_half h) { return half_to_float(h); }
+inline float value_to_float(rocsparse_bfloat16 b) { return bfloat16_to_float(b); }
+inline void float_to_value(float f, rocsparse_half& h) { h = float_to_half(f); }
+inline void float_to_value(float f, rocsparse_bfloat16& b) { b = float_to_bfloat16(f); }
+
+/*! \brief  Convert an array of single precision values into 16-bit storage format. */
+inline void convert_values(const float* in, rocsparse_half* out, size_t size)
+{
+    size_t i = 0;
+#if defined(__AVX512F__)
+    for(; i + 16 <= size; i += 16)
+    {
+        __m256i h = _mm512_cvtps_ph(_mm512_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), h);
+    }
+#endif
+#if defined(__F16C__)
+    for(; i + 8 <= size; i += 8)
+    {
+        __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), h);
+    }
+#endif
+    for(; i < size; ++i)
+    {
+        out[i] = float_to_half(in[i]);
+    }
+}
+
+inline void convert_values(const float* in, rocsparse_bfloat16* out, size_t size)
+{
+    size_t i = 0;
+#if defined(__AVX512BF16__)
+    for(; i + 16 <= size; i += 16)
+    {
+        __m256bh b = _mm512_cvtneps_pbh(_mm512_loadu_ps(in + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), (__m256i)b);
+    }
+#endif
+    for(; i < size; ++i)
+    {
+        out[i] = float_to_bfloat16(in[i]);
+    }
+}
+
+/*! \brief  Convert an array of 16-bit values into single precision. */
+inline void convert_values(const rocsparse_half* in, float* out, size_t size)
+{
+    size_t i = 0;
+#if defined(__AVX512F__)
+    for(; i + 16 <= size; i += 16)
+    {
+        __m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        _mm512_storeu_ps(out + i, _mm512_cvtph_ps(h));
+    }
+#endif
+#if defined(__F16C__)
+    for(; i + 8 <= size; i += 8)
+    {
+        __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(h));
+    }
+#endif
+    for(; i < size; ++i)
+    {
+        out[i] = half_to_float(in[i]);
+    }
+}
+
+inline void convert_values(const rocsparse_bfloat16* in, float* out, size_t size)
+{
+    size_t i = 0;
+#if defined(__AVX512F__)
+    for(; i + 16 <= size; i += 16)
+    {
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        _mm512_storeu_ps(out + i,
+                         _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(b), 16)));
+    }
+#endif
+    for(; i < size; ++i)
+    {
+        out[i] = bfloat16_to_float(in[i]);
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Convert a captured value to the value type of the test, the imaginary part is
+ *          dropped for real types.
+ */
+template <typename T>
+inline void capture_to_value(double re, double /*im*/, T& val)
+{
+    val = static_cast<T>(re);
+}
+
+template <typename T>
+inline void capture_to_value(double re, double im, rocsparse_complex_num<T>& val)
+{
+    val = rocsparse_complex_num<T>(static_cast<T>(re), static_cast<T>(im));
+}
+
+/*! \brief  Decode value i of a captured value array */
+template <typename T>
+inline void capture_decode_value(const char* data, uint32_t type, size_t i, T& val)
+{
+    double re = 0.0;
+    double im = 0.0;
+
+    switch(type)
+    {
+    case 0:
+    {
+        float v;
+        memcpy(&v, data + i * sizeof(float), sizeof(float));
+        re = v;
+        break;
+    }
+    case 1:
+    {
+        memcpy(&re, data + i * sizeof(double), sizeof(double));
+        break;
+    }
+    case 2:
+    {
+        float v[2];
+        memcpy(v, data + i * sizeof(v), sizeof(v));
+        re = v[0];
+        im = v[1];
+        break;
+    }
+    case 3:
+    {
+        double v[2];
+        memcpy(v, data + i * sizeof(v), sizeof(v));
+        re = v[0];
+        im = v[1];
+        break;
+    }
+    case 4:
+    {
+        rocsparse_half v;
+        memcpy(&v, data + i * sizeof(v), sizeof(v));
+        re = half_to_float(v);
+        break;
+    }
+    case 5:
+    {
+        rocsparse_bfloat16 v;
+        memcpy(&v, data + i * sizeof(v), sizeof(v));
+        re = bfloat16_to_float(v);
+        break;
+    }
+    }
+
+    capture_to_value(re, im, val);
+}
+
+/*! \brief  Size of a captured value in bytes */
+inline size_t capture_value_size(uint32_t type)
+{
+    switch(type)
+    {
+    case 0: return sizeof(float);
+    case 1: return sizeof(double);
+    case 2: return 2 * sizeof(float);
+    case 3: return 2 * sizeof(double);
+    case 4: return sizeof(rocsparse_half);
+    case 5: return sizeof(rocsparse_bfloat16);
+    }
+
+    return 0;
+}
+
+/*! \brief  Read matrix from an operand capture in COO format. CSR, CSC, COO, ELL and HYB
+ *          captures are converted to COO, ELL padding is dropped and entries are sorted by row
+ *          and column index.
+ */
+template <typename T>
+rocsparse_int read_capture_matrix(const char* filename,
+                                  rocsparse_int& nrow,
+                                  rocsparse_int& ncol,
+                                  rocsparse_int& nnz,
+                                  std::vector<rocsparse_int>& row,
+                                  std::vector<rocsparse_int>& col,
+                                  std::vector<T>& val,
+                                  rocsparse_index_base idx_base)
+{
+    printf("Reading capture %s...", filename);
+    fflush(stdout);
+
+    FILE* f = fopen(filename, "rb");
+    if(!f)
+    {
+        return -1;
+    }
+
+    rocsparse_capture_header header;
+
+    if(fread(&header, sizeof(header), 1, f) != 1 || header.magic != ROCSPARSE_CAPTURE_MAGIC ||
+       header.version != ROCSPARSE_CAPTURE_VERSION || header.index_size != sizeof(rocsparse_int) ||
+       capture_value_size(header.value_type) == 0)
+    {
+        fclose(f);
+        return -1;
+    }
+
+    size_t vsize   = capture_value_size(header.value_type);
+    size_t ell_nnz = (header.format == 2 || header.format == 3) ? header.m * header.ell_width : 0;
+    size_t coo_nnz = (header.format == 2) ? 0 : header.nnz;
+
+    // CSR stores row pointers instead of row indices, CSC column pointers instead of column
+    // indices
+    size_t nptr = (header.format == 0) ? header.m + 1 : (header.format == 4) ? header.n + 1 : 0;
+
+    std::vector<rocsparse_int> ptr(nptr);
+    std::vector<rocsparse_int> ell_col(ell_nnz);
+    std::vector<char> ell_val(ell_nnz * vsize);
+    std::vector<rocsparse_int> coo_row(header.format == 0 ? 0 : coo_nnz);
+    std::vector<rocsparse_int> coo_col(header.format == 4 ? 0 : coo_nnz);
+    std::vector<char> coo_val(coo_nnz * vsize);
+
+    // Arrays are stored in the order of capture_format.h
+    bool ok = fread(ptr.data(), sizeof(rocsparse_int), ptr.size(), f) == ptr.size() &&
+              fread(ell_col.data(), sizeof(rocsparse_int), ell_nnz, f) == ell_nnz &&
+              fread(ell_val.data(), 1, ell_val.size(), f) == ell_val.size() &&
+              fread(coo_row.data(), sizeof(rocsparse_int), coo_row.size(), f) == coo_row.size() &&
+              fread(coo_col.data(), sizeof(rocsparse_int), coo_col.size(), f) == coo_col.size() &&
+              fread(coo_val.data(), 1, coo_val.size(), f) == coo_val.size();
+
+    fclose(f);
+
+    if(!ok)
+    {
+        return -1;
+    }
+
+    rocsparse_int base  = header.idx_base;
+    rocsparse_int shift = idx_base - base;
+
+    // Expand CSR row pointers
+    if(header.format == 0)
+    {
+        coo_row.resize(coo_nnz);
+
+        for(int64_t i = 0; i < header.m; ++i)
+        {
+            for(rocsparse_int j = ptr[i] - base; j < ptr[i + 1] - base; ++j)
+            {
+                coo_row[j] = i + base;
+            }
+        }
+    }
+
+    // Expand CSC column pointers
+    if(header.format == 4)
+    {
+        coo_col.resize(coo_nnz);
+
+        for(int64_t i = 0; i < header.n; ++i)
+        {
+            for(rocsparse_int j = ptr[i] - base; j < ptr[i + 1] - base; ++j)
+            {
+                coo_col[j] = i + base;
+            }
+        }
+    }
+
+    std::vector<rocsparse_int> unsorted_row;
+    std::vector<rocsparse_int> unsorted_col;
+    std::vector<T> unsorted_val;
+
+    unsorted_row.reserve(ell_nnz + coo_nnz);
+    unsorted_col.reserve(ell_nnz + coo_nnz);
+    unsorted_val.reserve(ell_nnz + coo_nnz);
+
+    // ELL is stored column major, padding carries a negative column index
+    for(size_t i = 0; i < ell_nnz; ++i)
+    {
+        if(ell_col[i] - base < 0)
+        {
+            continue;
+        }
+
+        T v;
+        capture_decode_value(ell_val.data(), header.value_type, i, v);
+
+        unsorted_row.push_back(static_cast<rocsparse_int>(i % header.m) + idx_base);
+        unsorted_col.push_back(ell_col[i] + shift);
+        unsorted_val.push_back(v);
+    }
+
+    for(size_t i = 0; i < coo_nnz; ++i)
+    {
+        T v;
+        capture_decode_value(coo_val.data(), header.value_type, i, v);
+
+        unsorted_row.push_back(coo_row[i] + shift);
+        unsorted_col.push_back(coo_col[i] + shift);
+        unsorted_val.push_back(v);
+    }
+
+    nrow = header.m;
+    ncol = header.n;
+    nnz  = unsorted_row.size();
+
+    row.resize(nnz);
+    col.resize(nnz);
+    val.resize(nnz);
+
+    // Sort by row and column index
+    std::vector<rocsparse_int> perm(nnz);
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        perm[i] = i;
+    }
+
+    std::stable_sort(perm.begin(), perm.end(), [&](const int& a, const int& b) {
+        if(unsorted_row[a] != unsorted_row[b])
+        {
+            return unsorted_row[a] < unsorted_row[b];
+        }
+
+        return unsorted_col[a] < unsorted_col[b];
+    });
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        row[i] = unsorted_row[perm[i]];
+        col[i] = unsorted_col[perm[i]];
+        val[i] = unsorted_val[perm[i]];
+    }
+
+    printf("done.\n");
+    fflush(stdout);
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  First row of each of nthreads row blocks of a CSR matrix with about the same number
+ *          of non-zero entries, followed by m.
+ */
+inline std::vector<rocsparse_int> host_row_partition(rocsparse_int m,
+                                                     const rocsparse_int* ptr,
+                                                     int nthreads,
+                                                     rocsparse_index_base idx_base)
+{
+    std::vector<rocsparse_int> part(nthreads + 1, m);
+
+    int64_t nnz = ptr[m] - idx_base;
+
+    part[0] = 0;
+
+    for(int t = 1; t < nthreads; ++t)
+    {
+        rocsparse_int target = static_cast<rocsparse_int>(nnz * t / nthreads) + idx_base;
+
+        part[t] = static_cast<rocsparse_int>(std::lower_bound(ptr, ptr + m, target) - ptr);
+        part[t] = std::max(part[t], part[t - 1]);
+    }
+
+    return part;
+}
+
+/*! \brief  Sparse matrix vector multiplication using CSR storage format on nthreads host
+ *          threads, each thread computes a row block of about the same number of non-zero
+ *          entries.
+ */
+template <typename T>
+void host_csrmv_parallel(rocsparse_int m,
+                         T alpha,
+                         const rocsparse_int* ptr,
+                         const rocsparse_int* col,
+                         const T* val,
+                         const T* x,
+                         T beta,
+                         T* y,
+                         rocsparse_index_base idx_base,
+                         int nthreads)
+{
+    std::vector<rocsparse_int> part = host_row_partition(m, ptr, nthreads, idx_base);
+
+    host_parallel(nthreads, [&](int t) {
+        for(rocsparse_int i = part[t]; i < part[t + 1]; ++i)
+        {
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+            {
+                sum = std::fma(val[j], x[col[j] - idx_base], sum);
+            }
+
+            y[i] = (beta != static_cast<T>(0)) ? std::fma(beta, y[i], alpha * sum) : alpha * sum;
+        }
+    });
+}
+
+/*! \brief  Sparse matrix dense matrix multiplication using CSR storage format on nthreads host
+ *          threads, with the dense n columns of C and of op(B) in column major order.
+ */
+template <typename T>
+void host_csrmm_parallel(rocsparse_int m,
+                         rocsparse_int n,
+                         rocsparse_operation trans_B,
+                         T alpha,
+                         const rocsparse_int* ptr,
+                         const rocsparse_int* col,
+                         const T* val,
+                         const T* B,
+                         rocsparse_int ldb,
+                         T beta,
+                         T* C,
+                         rocsparse_int ldc,
+                         rocsparse_index_base idx_base,
+                         int nthreads)
+{
+    std::vector<rocsparse_int> part = host_row_partition(m, ptr, nthreads, idx_base);
+
+    host_parallel(nthreads, [&](int t) {
+        for(rocsparse_int i = part[t]; i < part[t + 1]; ++i)
+        {
+            for(rocsparse_int j = 0; j < n; ++j)
+            {
+                T sum = static_cast<T>(0);
+
+                for(rocsparse_int k = ptr[i] - idx_base; k < ptr[i + 1] - idx_base; ++k)
+                {
+                    rocsparse_int c = col[k] - idx_base;
+                    T b = (trans_B == rocsparse_operation_none) ? B[c + j * ldb] : B[j + c * ldb];
+
+                    sum = std::fma(val[k], b, sum);
+                }
+
+                T& c = C[i + j * ldc];
+
+                c = (beta != static_cast<T>(0)) ? std::fma(beta, c, alpha * sum) : alpha * sum;
+            }
+        }
+    });
+}
+
+/* ============================================================================================ */
+/*! \brief  Sparse matrix vector multiplication using CSR storage format with 16-bit matrix
+ *  values. Values are decoded in chunks and accumulated in single precision.
+ */
+template <typename U>
+void host_csrmv_mixed(rocsparse_int m,
+                      float alpha,
+                      const rocsparse_int* ptr,
+                      const rocsparse_int* col,
+                      const U* val,
+                      const float* x,
+                      float beta,
+                      float* y,
+                      rocsparse_index_base idx_base)
+{
+#define CSRMV_MIXED_CHUNK 64
+    float chunk[CSRMV_MIXED_CHUNK];
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        float sum = 0.0f;
+
+        rocsparse_int row_begin = ptr[i] - idx_base;
+        rocsparse_int row_end   = ptr[i + 1] - idx_base;
+
+        for(rocsparse_int l = row_begin; l < row_end; l += CSRMV_MIXED_CHUNK)
+        {
+            rocsparse_int size = std::min(row_end - l, CSRMV_MIXED_CHUNK);
+            convert_values(val + l, chunk, size);
+
+            for(rocsparse_int k = 0; k < size; ++k)
+            {
+                sum = std::fma(chunk[k], x[col[l + k] - idx_base], sum);
+            }
+        }
+
+        if(beta != 0.0f)
+        {
+            y[i] = std::fma(beta, y[i], alpha * sum);
+        }
+        else
+        {
+            y[i] = alpha * sum;
+        }
+    }
+#undef CSRMV_MIXED_CHUNK
+}
+
+/* ============================================================================================ */
+/*! \brief  Error bound of csrmv with 16-bit matrix values and single precision accumulation,
+ *  relative to the exact product of the original matrix. u is the unit roundoff of the
+ *  storage format.
+ */
+template <typename T>
+void csrmv_mixed_error_bound(rocsparse_int m,
+                             double alpha,
+                             const rocsparse_int* ptr,
+                             const rocsparse_int* col,
+                             const T* val,
+                             const float* x,
+                             double beta,
+                             const float* y,
+                             double u,
+                             double* bound,
+                             rocsparse_index_base idx_base)
+{
+    const double uf = std::numeric_limits<float>::epsilon() / 2.0;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        double abs_sum = 0.0;
+
+        rocsparse_int row_begin = ptr[i] - idx_base;
+        rocsparse_int row_end   = ptr[i + 1] - idx_base;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            abs_sum += std::abs(static_cast<double>(val[j]) * x[col[j] - idx_base]);
+        }
+
+        // Rounding of the values plus accumulation of row_end - row_begin products
+        double gamma = u + (row_end - row_begin + 2) * uf;
+
+        bound[i] = 2.0 * gamma * (std::abs(alpha) * abs_sum + std::abs(beta * y[i]))
+                   + std::numeric_limits<float>::min();
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Additive and multiplicative identity, addition and multiplication of a semiring */
+template <rocsparse_semiring S, typename T>
+struct host_semiring
+{
+    static T zero() { return static_cast<T>(0); }
+    static T one() { return static_cast<T>(1); }
+    static T add(T a, T b) { return a + b; }
+    static T mul(T a, T b) { return a * b; }
+};
+
+template <typename T>
+struct host_semiring<rocsparse_semiring_min_plus, T>
+{
+    static T zero() { return std::numeric_limits<T>::infinity(); }
+    static T one() { return static_cast<T>(0); }
+    static T add(T a, T b) { return std::min(a, b); }
+    static T mul(T a, T b) { return a + b; }
+};
+
+template <typename T>
+struct host_semiring<rocsparse_semiring_max_times, T>
+{
+    static T zero() { return static_cast<T>(0); }
+    static T one() { return static_cast<T>(1); }
+    static T add(T a, T b) { return std::max(a, b); }
+    static T mul(T a, T b) { return a * b; }
+};
+
+template <typename T>
+struct host_semiring<rocsparse_semiring_or_and, T>
+{
+    static T zero() { return static_cast<T>(0); }
+    static T one() { return static_cast<T>(1); }
+    static T add(T a, T b)
+    {
+        return (a != static_cast<T>(0) || b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    }
+    static T mul(T a, T b)
+    {
+        return (a != static_cast<T>(0) && b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    }
+};
+
+template <rocsparse_semiring S, typename T>
+void host_csrmv_semiring(rocsparse_int m,
+                         T alpha,
+                         const rocsparse_int* ptr,
+                         const rocsparse_int* col,
+                         const T* val,
+                         const T* x,
+                         T beta,
+                         T* y,
+                         rocsparse_index_base idx_base,
+                         int nthreads)
+{
+    typedef host_semiring<S, T> op;
+
+    host_parallel(nthreads, [&](int t) {
+        rocsparse_int begin = static_cast<rocsparse_int>(static_cast<int64_t>(m) * t / nthreads);
+        rocsparse_int end =
+            static_cast<rocsparse_int>(static_cast<int64_t>(m) * (t + 1) / nthreads);
+
+        for(rocsparse_int i = begin; i < end; ++i)
+        {
+            T sum = op::zero();
+
+            for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+            {
+                T a = (val == nullptr) ? op::one() : val[j];
+                sum = op::add(sum, op::mul(a, x[col[j] - idx_base]));
+            }
+
+            sum  = op::mul(alpha, sum);
+            y[i] = (beta == op::zero()) ? sum : op::add(sum, op::mul(beta, y[i]));
+        }
+    });
+}
+
+/*! \brief  Sparse matrix vector multiplication over a semiring using CSR storage format. Rows
+ *  are distributed over nthreads host threads, nthreads = 1 gives the host reference. val can
+ *  be NULL for pattern only matrices.
+ */
+template <typename T>
+void host_csrmv_semiring(rocsparse_semiring semiring,
+                         rocsparse_int m,
+                         T alpha,
+                         const rocsparse_int* ptr,
+                         const rocsparse_int* col,
+                         const T* val,
+                         const T* x,
+                         T beta,
+                         T* y,
+                         rocsparse_index_base idx_base,
+                         int nthreads = 1)
+{
+    switch(semiring)
+    {
+    case rocsparse_semiring_plus_times:
+        host_csrmv_semiring<rocsparse_semiring_plus_times>(
+            m, alpha, ptr, col, val, x, beta, y, idx_base, nthreads);
+        break;
+    case rocsparse_semiring_min_plus:
+        host_csrmv_semiring<rocsparse_semiring_min_plus>(
+            m, alpha, ptr, col, val, x, beta, y, idx_base, nthreads);
+        break;
+    case rocsparse_semiring_max_times:
+        host_csrmv_semiring<rocsparse_semiring_max_times>(
+            m, alpha, ptr, col, val, x, beta, y, idx_base, nthreads);
+        break;
+    case rocsparse_semiring_or_and:
+        host_csrmv_semiring<rocsparse_semiring_or_and>(
+            m, alpha, ptr, col, val, x, beta, y, idx_base, nthreads);
+        break;
+    }
+}
+
+template <rocsparse_semiring S, typename T>
+void host_coomv_semiring(rocsparse_operation trans,
+                         rocsparse_int ysize,
+                         rocsparse_int nnz,
+                         T alpha,
+                         const rocsparse_int* row,
+                         const rocsparse_int* col,
+                         const T* val,
+                         const T* x,
+                         T beta,
+                         T* y,
+                         rocsparse_index_base idx_base)
+{
+    typedef host_semiring<S, T> op;
+
+    for(rocsparse_int i = 0; i < ysize; ++i)
+    {
+        y[i] = (beta == op::zero()) ? op::zero() : op::mul(beta, y[i]);
+    }
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        rocsparse_int r = row[i] - idx_base;
+        rocsparse_int c = col[i] - idx_base;
+        T a             = (val == nullptr) ? op::one() : val[i];
+
+        if(trans != rocsparse_operation_none)
+        {
+            std::swap(r, c);
+        }
+
+        y[r] = op::add(y[r], op::mul(alpha, op::mul(a, x[c])));
+    }
+}
+
+/*! \brief  Sparse matrix vector multiplication over a semiring using COO storage format. ysize
+ *  is the length of y, i.e. m or n for the (transposed) matrix.
+ */
+template <typename T>
+void host_coomv_semiring(rocsparse_semiring semiring,
+                         rocsparse_operation trans,
+                         rocsparse_int ysize,
+                         rocsparse_int nnz,
+                         T alpha,
+                         const rocsparse_int* row,
+                         const rocsparse_int* col,
+                         const T* val,
+                         const T* x,
+                         T beta,
+                         T* y,
+                         rocsparse_index_base idx_base)
+{
+    switch(semiring)
+    {
+    case rocsparse_semiring_plus_times:
+        host_coomv_semiring<rocsparse_semiring_plus_times>(
+            trans, ysize, nnz, alpha, row, col, val, x, beta, y, idx_base);
+        break;
+    case rocsparse_semiring_min_plus:
+        host_coomv_semiring<rocsparse_semiring_min_plus>(
+            trans, ysize, nnz, alpha, row, col, val, x, beta, y, idx_base);
+        break;
+    case rocsparse_semiring_max_times:
+        host_coomv_semiring<rocsparse_semiring_max_times>(
+            trans, ysize, nnz, alpha, row, col, val, x, beta, y, idx_base);
+        break;
+    case rocsparse_semiring_or_and:
+        host_coomv_semiring<rocsparse_semiring_or_and>(
+            trans, ysize, nnz, alpha, row, col, val, x, beta, y, idx_base);
+        break;
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Sparse matrix vector multiplication using CSR storage format on the rows that are
+ *  listed in mask_ind only.
+ */
+template <typename T>
+void host_csrmv_masked(T alpha,
+                       const rocsparse_int* ptr,
+                       const rocsparse_int* col,
+                       const T* val,
+                       const T* x,
+                       T beta,
+                       rocsparse_int mask_nnz,
+                       const rocsparse_int* mask_ind,
+                       T* y,
+                       rocsparse_index_base idx_base)
+{
+    for(rocsparse_int k = 0; k < mask_nnz; ++k)
+    {
+        rocsparse_int i = mask_ind[k] - idx_base;
+        T sum           = static_cast<T>(0);
+
+        for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+        {
+            sum = std::fma(val[j], x[col[j] - idx_base], sum);
+        }
+
+        if(beta != static_cast<T>(0))
+        {
+            y[i] = std::fma(beta, y[i], alpha * sum);
+        }
+        else
+        {
+            y[i] = alpha * sum;
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  Pack the column indices of a CSR matrix. Rows are grouped into blocks of block_dim
+ *  rows, each block stores its smallest zero based column index and each entry the distance of
+ *  its column index to the base of its block. Returns the size of a column delta in bytes, the
+ *  smallest of 1, 2 and 4 bytes that can represent all distances.
+ */
+inline rocsparse_int host_csr2pcsr(rocsparse_int m,
+                                   rocsparse_int block_dim,
+                                   const rocsparse_int* ptr,
+                                   const rocsparse_int* col,
+                                   std::vector<rocsparse_int>& col_base,
+                                   std::vector<rocsparse_int>& col_delta,
+                                   rocsparse_index_base idx_base)
+{
+    rocsparse_int nblocks = (m - 1) / block_dim + 1;
+    rocsparse_int range   = 0;
+
+    col_base.assign(nblocks, 0);
+    col_delta.resize(ptr[m] - idx_base);
+
+    for(rocsparse_int b = 0; b < nblocks; ++b)
+    {
+        rocsparse_int begin = ptr[b * block_dim] - idx_base;
+        rocsparse_int end   = ptr[std::min(b * block_dim + block_dim, m)] - idx_base;
+
+        if(begin == end)
+        {
+            continue;
+        }
+
+        rocsparse_int cmin = *std::min_element(col + begin, col + end) - idx_base;
+        rocsparse_int cmax = *std::max_element(col + begin, col + end) - idx_base;
+
+        for(rocsparse_int j = begin; j < end; ++j)
+        {
+            col_delta[j] = col[j] - idx_base - cmin;
+        }
+
+        col_base[b] = cmin;
+        range       = std::max(range, cmax - cmin);
+    }
+
+    if(range <= std::numeric_limits<unsigned char>::max())
+    {
+        return sizeof(unsigned char);
+    }
+    else if(range <= std::numeric_limits<unsigned short>::max())
+    {
+        return sizeof(unsigned short);
+    }
+
+    return sizeof(rocsparse_int);
+}
+
+/*! \brief  Decode size packed column deltas relative to base. 8 or 16 deltas are widened and
+ *  added at once if the host supports AVX2 or AVX-512.
+ */
+inline void host_pcsr_decode(rocsparse_int base,
+                             const unsigned char* delta,
+                             rocsparse_int size,
+                             rocsparse_int* col)
+{
+    rocsparse_int k = 0;
+#if defined(__AVX512F__)
+    for(; k + 16 <= size; k += 16)
+    {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(delta + k));
+        _mm512_storeu_si512(col + k,
+                            _mm512_add_epi32(_mm512_cvtepu8_epi32(d), _mm512_set1_epi32(base)));
+    }
+#endif
+#if defined(__AVX2__)
+    for(; k + 8 <= size; k += 8)
+    {
+        __m128i d = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(delta + k));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(col + k),
+                            _mm256_add_epi32(_mm256_cvtepu8_epi32(d), _mm256_set1_epi32(base)));
+    }
+#endif
+    for(; k < size; ++k)
+    {
+        col[k] = base + delta[k];
+    }
+}
+
+inline void host_pcsr_decode(rocsparse_int base,
+                             const unsigned short* delta,
+                             rocsparse_int size,
+                             rocsparse_int* col)
+{
+    rocsparse_int k = 0;
+#if defined(__AVX512F__)
+    for(; k + 16 <= size; k += 16)
+    {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(delta + k));
+        _mm512_storeu_si512(col + k,
+                            _mm512_add_epi32(_mm512_cvtepu16_epi32(d), _mm512_set1_epi32(base)));
+    }
+#endif
+#if defined(__AVX2__)
+    for(; k + 8 <= size; k += 8)
+    {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(delta + k));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(col + k),
+                            _mm256_add_epi32(_mm256_cvtepu16_epi32(d), _mm256_set1_epi32(base)));
+    }
+#endif
+    for(; k < size; ++k)
+    {
+        col[k] = base + delta[k];
+    }
+}
+
+inline void host_pcsr_decode(rocsparse_int base,
+                             const rocsparse_int* delta,
+                             rocsparse_int size,
+                             rocsparse_int* col)
+{
+    for(rocsparse_int k = 0; k < size; ++k)
+    {
+        col[k] = base + delta[k];
+    }
+}
+
+/*! \brief  Decode all column indices of a packed CSR matrix, one row block at a time */
+template <typename D>
+void host_pcsr_decode(rocsparse_int m,
+                      rocsparse_int block_dim,
+                      const rocsparse_int* ptr,
+                      const rocsparse_int* col_base,
+                      const D* col_delta,
+                      rocsparse_int* col,
+                      rocsparse_index_base idx_base)
+{
+    for(rocsparse_int b = 0; b * block_dim < m; ++b)
+    {
+        rocsparse_int begin = ptr[b * block_dim] - idx_base;
+        rocsparse_int end   = ptr[std::min(b * block_dim + block_dim, m)] - idx_base;
+
+        host_pcsr_decode(col_base[b] + idx_base, col_delta + begin, end - begin, col + begin);
+    }
+}
+
+/*! \brief  Sparse matrix vector multiplication using CSR storage format with packed column
+ *  indices. Column indices are decoded in chunks, followed by the products of the chunk.
+ */
+template <typename T, typename D>
+void host_pcsrmv(rocsparse_int m,
+                 rocsparse_int block_dim,
+                 T alpha,
+                 const rocsparse_int* ptr,
+                 const rocsparse_int* col_base,
+                 const D* col_delta,
+                 const T* val,
+                 const T* x,
+                 T beta,
+                 T* y,
+                 rocsparse_index_base idx_base)
+{
+#define PCSRMV_CHUNK 64
+    rocsparse_int chunk[PCSRMV_CHUNK];
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        T sum = static_cast<T>(0);
+
+        rocsparse_int row_begin = ptr[i] - idx_base;
+        rocsparse_int row_end   = ptr[i + 1] - idx_base;
+
+        for(rocsparse_int l = row_begin; l < row_end; l += PCSRMV_CHUNK)
+        {
+            rocsparse_int size = std::min(row_end - l, PCSRMV_CHUNK);
+            host_pcsr_decode(col_base[i / block_dim], col_delta + l, size, chunk);
+
+            for(rocsparse_int k = 0; k < size; ++k)
+            {
+                sum = std::fma(val[l + k], x[chunk[k]], sum);
+            }
+        }
+
+        if(beta != static_cast<T>(0))
+        {
+            y[i] = std::fma(beta, y[i], alpha * sum);
+        }
+        else
+        {
+            y[i] = alpha * sum;
+        }
+    }
+#undef PCSRMV_CHUNK
+}
+
+template <rocsparse_semiring S, typename T>
+void host_cscmspv(rocsparse_int m,
+                  T alpha,
+                  const rocsparse_int* ptr,
+                  const rocsparse_int* row,
+                  const T* val,
+                  rocsparse_int x_nnz,
+                  const T* x_val,
+                  const rocsparse_int* x_ind,
+                  std::vector<T>& y_val,
+                  std::vector<rocsparse_int>& y_ind,
+                  rocsparse_index_base idx_base)
+{
+    typedef host_semiring<S, T> op;
+
+    std::vector<T> acc(m, op::zero());
+    std::vector<bool> reached(m, false);
+
+    for(rocsparse_int i = 0; i < x_nnz; ++i)
+    {
+        rocsparse_int c = x_ind[i] - idx_base;
+        T x             = (x_val == nullptr) ? op::one() : x_val[i];
+
+        for(rocsparse_int j = ptr[c] - idx_base; j < ptr[c + 1] - idx_base; ++j)
+        {
+            rocsparse_int r = row[j] - idx_base;
+            T a             = (val == nullptr) ? op::one() : val[j];
+
+            acc[r]     = op::add(acc[r], op::mul(a, x));
+            reached[r] = true;
+        }
+    }
+
+    y_val.clear();
+    y_ind.clear();
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        if(reached[i])
+        {
+            y_val.push_back(op::mul(alpha, acc[i]));
+            y_ind.push_back(i + idx_base);
+        }
+    }
+}
+
+/*! \brief  Sparse matrix sparse vector multiplication over a semiring using CSC storage
+ *  format. The result holds the rows that are reached from x, in ascending order.
+ */
+template <typename T>
+void host_cscmspv(rocsparse_semiring semiring,
+                  rocsparse_int m,
+                  T alpha,
+                  const rocsparse_int* ptr,
+                  const rocsparse_int* row,
+                  const T* val,
+                  rocsparse_int x_nnz,
+                  const T* x_val,
+                  const rocsparse_int* x_ind,
+                  std::vector<T>& y_val,
+                  std::vector<rocsparse_int>& y_ind,
+                  rocsparse_index_base idx_base)
+{
+    switch(semiring)
+    {
+    case rocsparse_semiring_plus_times:
+        host_cscmspv<rocsparse_semiring_plus_times>(
+            m, alpha, ptr, row, val, x_nnz, x_val, x_ind, y_val, y_ind, idx_base);
+        break;
+    case rocsparse_semiring_min_plus:
+        host_cscmspv<rocsparse_semiring_min_plus>(
+            m, alpha, ptr, row, val, x_nnz, x_val, x_ind, y_val, y_ind, idx_base);
+        break;
+    case rocsparse_semiring_max_times:
+        host_cscmspv<rocsparse_semiring_max_times>(
+            m, alpha, ptr, row, val, x_nnz, x_val, x_ind, y_val, y_ind, idx_base);
+        break;
+    case rocsparse_semiring_or_and:
+        host_cscmspv<rocsparse_semiring_or_and>(
+            m, alpha, ptr, row, val, x_nnz, x_val, x_ind, y_val, y_ind, idx_base);
+        break;
+    }
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================ */
+/*  query for rocsparse version and git commit SHA-1. */
+void query_version(char* version);
+
+/* ============================================================================================ */
+/*  device query and print out their ID and name */
+rocsparse_int query_device_property();
+
+/*  set current device to device_id */
+void set_device(rocsparse_int device_id);
+
+/* ============================================================================================ */
+/*  timing: HIP only provides very limited timers function clock() and not general;
+            rocsparse sync CPU and device and use more accurate CPU timer*/
+
+/*! \brief  CPU Timer(in microsecond): synchronize with the default device and return wall time */
+double get_time_us(void);
+
+/*! \brief  CPU Timer(in microsecond): synchronize with given queue/stream and return wall time */
+double get_time_us_sync(hipStream_t stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* ============================================================================================ */
+
+/*! \brief Class used to parse command arguments in both client & gtest   */
+
+// has to compile with option "-std=c++11", and this rocsparse library uses c++11 everywhere
+// c++11 allows intilization of member of a struct
+
+class Arguments
+{
+    public:
+    rocsparse_int M   = 128;
+    rocsparse_int N   = 128;
+    rocsparse_int K   = 128;
+    rocsparse_int nnz = 32;
+
+    rocsparse_int ldb;
     rocsparse_int ldc;
 
     double alpha = 1.0;
@@ -960,6 +2343,7 @@ class Arguments
     rocsparse_diag_type diag_type      = rocsparse_diag_type_non_unit;
     rocsparse_fill_mode fill_mode      = rocsparse_fill_mode_lower;
     rocsparse_analysis_policy analysis = rocsparse_analysis_policy_reuse;
+    rocsparse_semiring semiring        = rocsparse_semiring_plus_times;
 
     rocsparse_int norm_check = 0;
     rocsparse_int unit_check = 1;
@@ -969,10 +2353,27 @@ class Arguments
     rocsparse_int laplacian = 0;
     rocsparse_int ell_width = 0;
     rocsparse_int temp      = 0;
+    rocsparse_int sweeps    = 0;
 
     std::string filename = "";
     bool bswitch         = false;
 
+    std::string generator         = "";
+    rocsparse_int gen_dim         = 0;
+    rocsparse_int gen_bandwidth   = 1;
+    rocsparse_int gen_block_dim   = 3;
+    rocsparse_int gen_edge_factor = 16;
+
+    double frontier     = 0.0;
+    double mask_density = 0.0;
+
+    rocsparse_int panel_nnz = 0;
+    std::string map_hints   = "";
+
+    double peak_bandwidth   = 0.0;
+    std::string report      = "";
+    std::string report_file = "";
+
     Arguments& operator=(const Arguments& rhs)
     {
         this->M   = rhs.M;
@@ -995,6 +2396,7 @@ class Arguments
         this->diag_type = rhs.diag_type;
         this->fill_mode = rhs.fill_mode;
         this->analysis  = rhs.analysis;
+        this->semiring  = rhs.semiring;
 
         this->norm_check = rhs.norm_check;
         this->unit_check = rhs.unit_check;
@@ -1004,12 +2406,381 @@ class Arguments
         this->laplacian = rhs.laplacian;
         this->ell_width = rhs.ell_width;
         this->temp      = rhs.temp;
+        this->sweeps    = rhs.sweeps;
 
         this->filename = rhs.filename;
         this->bswitch  = rhs.bswitch;
 
+        this->generator       = rhs.generator;
+        this->gen_dim         = rhs.gen_dim;
+        this->gen_bandwidth   = rhs.gen_bandwidth;
+        this->gen_block_dim   = rhs.gen_block_dim;
+        this->gen_edge_factor = rhs.gen_edge_factor;
+
+        this->frontier     = rhs.frontier;
+        this->mask_density = rhs.mask_density;
+
+        this->panel_nnz = rhs.panel_nnz;
+        this->map_hints = rhs.map_hints;
+
+        this->peak_bandwidth = rhs.peak_bandwidth;
+        this->report         = rhs.report;
+        this->report_file    = rhs.report_file;
+
         return *this;
     }
 };
 
+/* ============================================================================================ */
+/*! \brief  Environment variables of the logging layers. The variables are set for the lifetime
+ *          of the object, such that handles created meanwhile pick them up, and are restored
+ *          on destruction.
+ */
+class scoped_env
+{
+    public:
+    scoped_env() {}
+
+    ~scoped_env()
+    {
+        for(size_t i = saved.size(); i-- > 0;)
+        {
+            if(saved[i].set)
+            {
+                setenv(saved[i].name.c_str(), saved[i].value.c_str(), 1);
+            }
+            else
+            {
+                unsetenv(saved[i].name.c_str());
+            }
+        }
+    }
+
+    void set(const std::string& name, const std::string& value)
+    {
+        const char* old = getenv(name.c_str());
+
+        saved.push_back({name, old != NULL, old != NULL ? old : ""});
+
+        setenv(name.c_str(), value.c_str(), 1);
+    }
+
+    private:
+    struct variable
+    {
+        std::string name;
+        bool set;
+        std::string value;
+    };
+
+    std::vector<variable> saved;
+};
+
+/*! \brief  Temporary directory that is removed together with its files on destruction */
+class scoped_temp_dir
+{
+    public:
+    scoped_temp_dir()
+    {
+        char tmpl[] = "/tmp/rocsparse_test_XXXXXX";
+
+        if(mkdtemp(tmpl) != NULL)
+        {
+            path = tmpl;
+        }
+    }
+
+    ~scoped_temp_dir()
+    {
+        if(path.empty())
+        {
+            return;
+        }
+
+        DIR* dir = opendir(path.c_str());
+
+        if(dir != NULL)
+        {
+            struct dirent* entry;
+
+            while((entry = readdir(dir)) != NULL)
+            {
+                if(strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+                {
+                    remove((path + "/" + entry->d_name).c_str());
+                }
+            }
+
+            closedir(dir);
+        }
+
+        rmdir(path.c_str());
+    }
+
+    std::string path;
+};
+
+/*! \brief  Lines of a text file */
+inline std::vector<std::string> read_lines(const std::string& filename)
+{
+    std::vector<std::string> lines;
+    std::ifstream in(filename);
+    std::string line;
+
+    while(std::getline(in, line))
+    {
+        if(!line.empty())
+        {
+            lines.push_back(line);
+        }
+    }
+
+    return lines;
+}
+
+/* ============================================================================================ */
+/*! \brief  Generate the synthetic matrix selected by the arguments in COO format */
+template <typename T>
+rocsparse_int gen_synthetic_matrix(const Arguments& argus,
+                                   rocsparse_int& nrow,
+                                   rocsparse_int& ncol,
+                                   rocsparse_int& nnz,
+                                   std::vector<rocsparse_int>& row,
+                                   std::vector<rocsparse_int>& col,
+                                   std::vector<T>& val,
+                                   rocsparse_index_base idx_base)
+{
+    mtx_csr_matrix A;
+
+    if(gen_matrix_csr(argus.generator,
+                      argus.gen_dim,
+                      argus.gen_bandwidth,
+                      argus.gen_block_dim,
+                      argus.gen_edge_factor,
+                      A) != 0)
+    {
+        return -1;
+    }
+
+    csr_matrix_to_coo(A, nrow, ncol, nnz, row, col, val, idx_base);
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief  Cache of the matrix files read by load_matrix_csr. While a load_matrix_cache_scope
+ *          is alive, each file is read once per precision and index base, and subsequent loads
+ *          copy the cached matrix.
+ */
+struct load_matrix_cache_entry
+{
+    virtual ~load_matrix_cache_entry() {}
+};
+
+template <typename T>
+struct load_matrix_cache_csr : load_matrix_cache_entry
+{
+    rocsparse_int nrow;
+    rocsparse_int ncol;
+    rocsparse_int nnz;
+
+    std::vector<rocsparse_int> ptr;
+    std::vector<rocsparse_int> col;
+    std::vector<T> val;
+};
+
+struct load_matrix_cache
+{
+    bool enabled = false;
+
+    std::map<std::string, std::unique_ptr<load_matrix_cache_entry>> entries;
+};
+
+inline load_matrix_cache& get_load_matrix_cache()
+{
+    static load_matrix_cache cache;
+
+    return cache;
+}
+
+class load_matrix_cache_scope
+{
+    public:
+    load_matrix_cache_scope() { get_load_matrix_cache().enabled = true; }
+
+    ~load_matrix_cache_scope()
+    {
+        get_load_matrix_cache().enabled = false;
+        get_load_matrix_cache().entries.clear();
+    }
+};
+
+/* ============================================================================================ */
+/*! \brief  Reads or generates the host matrix of load_matrix_csr.
+ */
+template <typename T>
+rocsparse_int read_matrix_csr(const Arguments& argus,
+                              const std::string& binfile,
+                              const std::string& filename,
+                              rocsparse_int& nrow,
+                              rocsparse_int& ncol,
+                              rocsparse_int& nnz,
+                              std::vector<rocsparse_int>& ptr,
+                              std::vector<rocsparse_int>& col,
+                              std::vector<T>& val,
+                              rocsparse_index_base idx_base)
+{
+    if(binfile != "")
+    {
+        if(read_bin_matrix(binfile.c_str(), nrow, ncol, nnz, ptr, col, val, idx_base) != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", binfile.c_str());
+            return -1;
+        }
+
+        return 0;
+    }
+
+    if(argus.laplacian)
+    {
+        nrow = ncol = gen_2d_laplacian(argus.laplacian, ptr, col, val, idx_base);
+        nnz         = ptr[nrow] - idx_base;
+
+        return 0;
+    }
+
+    std::vector<rocsparse_int> row;
+
+    if(filename != "")
+    {
+        if(read_mtx_matrix(filename.c_str(), nrow, ncol, nnz, row, col, val, idx_base) != 0)
+        {
+            fprintf(stderr, "Cannot open [read] %s\n", filename.c_str());
+            return -1;
+        }
+    }
+    else if(argus.generator != "")
+    {
+        if(gen_synthetic_matrix(argus, nrow, ncol, nnz, row, col, val, idx_base) != 0)
+        {
+            fprintf(stderr, "Cannot generate %s matrix\n", argus.generator.c_str());
+            return -1;
+        }
+    }
+    else
+    {
+        gen_matrix_coo(nrow, ncol, nnz, row, col, val, idx_base);
+    }
+
+    // Convert COO to CSR, COO entries are sorted by row
+    ptr.assign(nrow + 1, 0);
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ++ptr[row[i] + 1 - idx_base];
+    }
+
+    ptr[0] = idx_base;
+    for(rocsparse_int i = 0; i < nrow; ++i)
+    {
+        ptr[i + 1] += ptr[i];
+    }
+
+    return 0;
+}
+
+/*! \brief  Host matrix of a test in CSR format. In order of precedence, the matrix is read from
+ *          binfile, generated as 2D laplacian if argus.laplacian is set, read from filename,
+ *          which is a MatrixMarket file or an operand capture, generated by argus.generator or
+ *          generated randomly with the given dimensions and nnz. Prints the reason and returns
+ *          -1 if the matrix cannot be read or generated, else 0. Matrix files are read once
+ *          while a load_matrix_cache_scope is alive.
+ */
+template <typename T>
+rocsparse_int load_matrix_csr(const Arguments& argus,
+                              const std::string& binfile,
+                              const std::string& filename,
+                              rocsparse_int& nrow,
+                              rocsparse_int& ncol,
+                              rocsparse_int& nnz,
+                              std::vector<rocsparse_int>& ptr,
+                              std::vector<rocsparse_int>& col,
+                              std::vector<T>& val,
+                              rocsparse_index_base idx_base)
+{
+    load_matrix_cache& cache = get_load_matrix_cache();
+
+    // Only matrix files are cached, generated matrices are cheap to obtain
+    if(!cache.enabled || (binfile == "" && (argus.laplacian || filename == "")))
+    {
+        return read_matrix_csr(argus, binfile, filename, nrow, ncol, nnz, ptr, col, val, idx_base);
+    }
+
+    std::string key = binfile + "\n" + filename + "\n" + typeid(T).name() + "\n" +
+                      std::to_string(idx_base);
+
+    std::unique_ptr<load_matrix_cache_entry>& entry = cache.entries[key];
+
+    if(entry == nullptr)
+    {
+        std::unique_ptr<load_matrix_cache_csr<T>> A(new load_matrix_cache_csr<T>);
+
+        rocsparse_int status = read_matrix_csr(
+            argus, binfile, filename, A->nrow, A->ncol, A->nnz, A->ptr, A->col, A->val, idx_base);
+
+        if(status != 0)
+        {
+            cache.entries.erase(key);
+            return -1;
+        }
+
+        entry.reset(A.release());
+    }
+
+    const load_matrix_cache_csr<T>* A = static_cast<const load_matrix_cache_csr<T>*>(entry.get());
+
+    nrow = A->nrow;
+    ncol = A->ncol;
+    nnz  = A->nnz;
+    ptr  = A->ptr;
+    col  = A->col;
+    val  = A->val;
+
+    return 0;
+}
+
+/*! \brief  Host matrix of a test in COO format, sorted by row. The matrix is selected as in
+ *          load_matrix_csr.
+ */
+template <typename T>
+rocsparse_int load_matrix_coo(const Arguments& argus,
+                              const std::string& binfile,
+                              const std::string& filename,
+                              rocsparse_int& nrow,
+                              rocsparse_int& ncol,
+                              rocsparse_int& nnz,
+                              std::vector<rocsparse_int>& row,
+                              std::vector<rocsparse_int>& col,
+                              std::vector<T>& val,
+                              rocsparse_index_base idx_base)
+{
+    std::vector<rocsparse_int> ptr;
+
+    if(load_matrix_csr(argus, binfile, filename, nrow, ncol, nnz, ptr, col, val, idx_base) != 0)
+    {
+        return -1;
+    }
+
+    // Convert CSR to COO
+    row.resize(nnz);
+    for(rocsparse_int i = 0; i < nrow; ++i)
+    {
+        for(rocsparse_int j = ptr[i] - idx_base; j < ptr[i + 1] - idx_base; ++j)
+        {
+            row[j] = i + idx_base;
+        }
+    }
+
+    return 0;
+}
+
 #endif // TESTING_UTILITY_HPP
@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#include <hip/hip_runtime_api.h>
+#include <rocsparse.h>
+
+// Wall clock time in microseconds, without device synchronization
+static double get_wall_time_us(void)
+{
+    return std::chrono::duration<double, std::micro>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static void print_stats(const char* name, const std::vector<double>& t)
+{
+    double tmin = *std::min_element(t.begin(), t.end());
+    double tmax = *std::max_element(t.begin(), t.end());
+    double tavg = 0.0;
+
+    for(size_t i = 0; i < t.size(); ++i)
+    {
+        tavg += t[i];
+    }
+
+    tavg /= t.size();
+
+    printf("%-24s min %10.2f us  avg %10.2f us  max %10.2f us\n", name, tmin, tavg, tmax);
+}
+
+int main(int argc, char* argv[])
+{
+    int trials = 1000;
+
+    if(argc > 1)
+    {
+        trials = atoi(argv[1]);
+    }
+
+    if(trials < 1)
+    {
+        fprintf(stderr, "%s [<trials>]\n", argv[0]);
+        return -1;
+    }
+
+    // Warm up the runtime, such that device initialization is not accounted to
+    // the first handle
+    hipFree(0);
+
+    std::vector<double> t_create(trials);
+    std::vector<double> t_destroy(trials);
+    std::vector<double> t_first(trials);
+    std::vector<double> t_second(trials);
+
+    // Offload a single element sparse dot product to measure the cost of the
+    // first call, which sets up the handle device buffer
+    rocsparse_int hxind = 0;
+    float hxval         = 1.0f;
+    float hy            = 1.0f;
+    float result;
+
+    rocsparse_int* dxind;
+    float* dxval;
+    float* dy;
+
+    hipMalloc((void**)&dxind, sizeof(rocsparse_int));
+    hipMalloc((void**)&dxval, sizeof(float));
+    hipMalloc((void**)&dy, sizeof(float));
+
+    hipMemcpy(dxind, &hxind, sizeof(rocsparse_int), hipMemcpyHostToDevice);
+    hipMemcpy(dxval, &hxval, sizeof(float), hipMemcpyHostToDevice);
+    hipMemcpy(dy, &hy, sizeof(float), hipMemcpyHostToDevice);
+
+    for(int i = 0; i < trials; ++i)
+    {
+        rocsparse_handle handle;
+
+        double time = get_wall_time_us();
+        rocsparse_create_handle(&handle);
+        t_create[i] = get_wall_time_us() - time;
+
+        time = get_wall_time_us();
+        rocsparse_sdoti(handle, 1, dxval, dxind, dy, &result, rocsparse_index_base_zero);
+        t_first[i] = get_wall_time_us() - time;
+
+        time = get_wall_time_us();
+        rocsparse_sdoti(handle, 1, dxval, dxind, dy, &result, rocsparse_index_base_zero);
+        t_second[i] = get_wall_time_us() - time;
+
+        time = get_wall_time_us();
+        rocsparse_destroy_handle(handle);
+        t_destroy[i] = get_wall_time_us() - time;
+    }
+
+    hipFree(dxind);
+    hipFree(dxval);
+    hipFree(dy);
+
+    printf("Handle latency over %d trials\n", trials);
+    print_stats("rocsparse_create_handle", t_create);
+    print_stats("first rocsparse_sdoti", t_first);
+    print_stats("second rocsparse_sdoti", t_second);
+    print_stats("rocsparse_destroy_handle", t_destroy);
+
+    return 0;
+}
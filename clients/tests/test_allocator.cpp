@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_allocator.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, base> allocator_tuple;
+
+int allocator_dim_range[] = {16, 200};
+
+base allocator_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_allocator : public testing::TestWithParam<allocator_tuple>
+{
+    protected:
+    parameterized_allocator() {}
+    virtual ~parameterized_allocator() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_allocator_arguments(allocator_tuple tup)
+{
+    Arguments arg;
+    arg.laplacian = std::get<0>(tup);
+    arg.idx_base  = std::get<1>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(allocator_bad_arg, allocator)
+{
+    rocsparse_memory_stats stats;
+
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    EXPECT_EQ(rocsparse_set_allocator(nullptr, nullptr, nullptr, nullptr),
+              rocsparse_status_invalid_handle);
+    EXPECT_EQ(rocsparse_set_allocator(handle, allocator_counter_malloc, nullptr, nullptr),
+              rocsparse_status_invalid_pointer);
+    EXPECT_EQ(rocsparse_set_allocator(handle, nullptr, allocator_counter_free, nullptr),
+              rocsparse_status_invalid_pointer);
+    EXPECT_EQ(rocsparse_get_memory_stats(nullptr, &stats), rocsparse_status_invalid_handle);
+    EXPECT_EQ(rocsparse_get_memory_stats(handle, nullptr), rocsparse_status_invalid_pointer);
+}
+
+TEST_P(parameterized_allocator, workspace_float)
+{
+    Arguments arg = setup_allocator_arguments(GetParam());
+
+    rocsparse_status status = testing_allocator_workspace<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_allocator, workspace_double)
+{
+    Arguments arg = setup_allocator_arguments(GetParam());
+
+    rocsparse_status status = testing_allocator_workspace<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(allocator,
+                        parameterized_allocator,
+                        testing::Combine(testing::ValuesIn(allocator_dim_range),
+                                         testing::ValuesIn(allocator_idxbase_range)));
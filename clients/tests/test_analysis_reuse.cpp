@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_analysis_reuse.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, base> analysis_reuse_tuple;
+
+int analysis_reuse_dim_range[] = {4, 33};
+
+base analysis_reuse_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_analysis_reuse : public testing::TestWithParam<analysis_reuse_tuple>
+{
+    protected:
+    parameterized_analysis_reuse() {}
+    virtual ~parameterized_analysis_reuse() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_analysis_reuse_arguments(analysis_reuse_tuple tup)
+{
+    Arguments arg;
+    arg.laplacian = std::get<0>(tup);
+    arg.idx_base  = std::get<1>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST_P(parameterized_analysis_reuse, zero_pivot_float)
+{
+    Arguments arg = setup_analysis_reuse_arguments(GetParam());
+
+    rocsparse_status status = testing_analysis_reuse_zero_pivot<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_analysis_reuse, zero_pivot_double)
+{
+    Arguments arg = setup_analysis_reuse_arguments(GetParam());
+
+    rocsparse_status status = testing_analysis_reuse_zero_pivot<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_analysis_reuse, moved_float)
+{
+    Arguments arg = setup_analysis_reuse_arguments(GetParam());
+
+    rocsparse_status status = testing_analysis_reuse_moved<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_analysis_reuse, moved_double)
+{
+    Arguments arg = setup_analysis_reuse_arguments(GetParam());
+
+    rocsparse_status status = testing_analysis_reuse_moved<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_analysis_reuse, changed_float)
+{
+    Arguments arg = setup_analysis_reuse_arguments(GetParam());
+
+    rocsparse_status status = testing_analysis_reuse_changed<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_analysis_reuse, changed_double)
+{
+    Arguments arg = setup_analysis_reuse_arguments(GetParam());
+
+    rocsparse_status status = testing_analysis_reuse_changed<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_analysis_reuse, eviction_float)
+{
+    Arguments arg = setup_analysis_reuse_arguments(GetParam());
+
+    rocsparse_status status = testing_analysis_reuse_eviction<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_analysis_reuse, eviction_double)
+{
+    Arguments arg = setup_analysis_reuse_arguments(GetParam());
+
+    rocsparse_status status = testing_analysis_reuse_eviction<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(analysis_reuse,
+                        parameterized_analysis_reuse,
+                        testing::Combine(testing::ValuesIn(analysis_reuse_dim_range),
+                                         testing::ValuesIn(analysis_reuse_idxbase_range)));
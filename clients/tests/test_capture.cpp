@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_capture.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, base> capture_tuple;
+
+int capture_dim_range[] = {4, 50};
+
+base capture_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_capture : public testing::TestWithParam<capture_tuple>
+{
+    protected:
+    parameterized_capture() {}
+    virtual ~parameterized_capture() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_capture_arguments(capture_tuple tup)
+{
+    Arguments arg;
+    arg.laplacian = std::get<0>(tup);
+    arg.idx_base  = std::get<1>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST_P(parameterized_capture, csrmv_float)
+{
+    Arguments arg = setup_capture_arguments(GetParam());
+
+    rocsparse_status status = testing_capture_csrmv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_capture, csrmv_double)
+{
+    Arguments arg = setup_capture_arguments(GetParam());
+
+    rocsparse_status status = testing_capture_csrmv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_capture, cscmspv_float)
+{
+    Arguments arg = setup_capture_arguments(GetParam());
+
+    rocsparse_status status = testing_capture_cscmspv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_capture, cscmspv_double)
+{
+    Arguments arg = setup_capture_arguments(GetParam());
+
+    rocsparse_status status = testing_capture_cscmspv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_capture, pcsrmv_float)
+{
+    Arguments arg = setup_capture_arguments(GetParam());
+
+    rocsparse_status status = testing_capture_pcsrmv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_capture, pcsrmv_double)
+{
+    Arguments arg = setup_capture_arguments(GetParam());
+
+    rocsparse_status status = testing_capture_pcsrmv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(capture,
+                        parameterized_capture,
+                        testing::Combine(testing::ValuesIn(capture_dim_range),
+                                         testing::ValuesIn(capture_idxbase_range)));
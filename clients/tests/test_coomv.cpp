@@ -30,7 +30,7 @@
 #include <string>
 
 typedef rocsparse_index_base base;
-typedef std::tuple<int, int, double, double, base> coomv_tuple;
+typedef std::tuple<int, int, double, double, base, rocsparse_operation> coomv_tuple;
 typedef std::tuple<double, double, base, std::string> coomv_bin_tuple;
 
 int coo_M_range[] = {-1, 0, 10, 500, 7111, 10000};
@@ -41,6 +41,10 @@ std::vector<double> coo_beta_range  = {0.0, 0.67, 1.0};
 
 base coo_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
 
+rocsparse_operation coo_trans_range[] = {rocsparse_operation_none,
+                                         rocsparse_operation_transpose,
+                                         rocsparse_operation_conjugate_transpose};
+
 std::string coo_bin[] = {"rma10.bin",
                          "mac_econ_fwd500.bin",
                          "bibd_22_8.bin",
@@ -82,6 +86,7 @@ Arguments setup_coomv_arguments(coomv_tuple tup)
     arg.alpha    = std::get<2>(tup);
     arg.beta     = std::get<3>(tup);
     arg.idx_base = std::get<4>(tup);
+    arg.transA   = std::get<5>(tup);
     arg.timing   = 0;
     return arg;
 }
@@ -135,6 +140,22 @@ TEST_P(parameterized_coomv, coomv_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_coomv, coomv_float_complex)
+{
+    Arguments arg = setup_coomv_arguments(GetParam());
+
+    rocsparse_status status = testing_coomv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_coomv, coomv_double_complex)
+{
+    Arguments arg = setup_coomv_arguments(GetParam());
+
+    rocsparse_status status = testing_coomv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_coomv_bin, coomv_bin_float)
 {
     Arguments arg = setup_coomv_arguments(GetParam());
@@ -151,13 +172,30 @@ TEST_P(parameterized_coomv_bin, coomv_bin_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_coomv_bin, coomv_bin_float_complex)
+{
+    Arguments arg = setup_coomv_arguments(GetParam());
+
+    rocsparse_status status = testing_coomv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_coomv_bin, coomv_bin_double_complex)
+{
+    Arguments arg = setup_coomv_arguments(GetParam());
+
+    rocsparse_status status = testing_coomv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 INSTANTIATE_TEST_CASE_P(coomv,
                         parameterized_coomv,
                         testing::Combine(testing::ValuesIn(coo_M_range),
                                          testing::ValuesIn(coo_N_range),
                                          testing::ValuesIn(coo_alpha_range),
                                          testing::ValuesIn(coo_beta_range),
-                                         testing::ValuesIn(coo_idxbase_range)));
+                                         testing::ValuesIn(coo_idxbase_range),
+                                         testing::ValuesIn(coo_trans_range)));
 
 INSTANTIATE_TEST_CASE_P(coomv_bin,
                         parameterized_coomv_bin,
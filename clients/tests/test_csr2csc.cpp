@@ -35,7 +35,8 @@ typedef std::tuple<rocsparse_action, rocsparse_index_base, std::string> csr2csc_
 int csr2csc_M_range[] = {-1, 0, 10, 500, 872, 1000};
 int csr2csc_N_range[] = {-3, 0, 33, 242, 623, 1000};
 
-rocsparse_action csr2csc_action_range[] = {rocsparse_action_numeric, rocsparse_action_symbolic};
+rocsparse_action csr2csc_action_range[] = {
+    rocsparse_action_numeric, rocsparse_action_symbolic, rocsparse_action_numeric_conjugate};
 
 rocsparse_index_base csr2csc_csr_base_range[] = {rocsparse_index_base_zero,
                                                  rocsparse_index_base_one};
@@ -132,6 +133,22 @@ TEST_P(parameterized_csr2csc, csr2csc_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csr2csc, csr2csc_float_complex)
+{
+    Arguments arg = setup_csr2csc_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2csc<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2csc, csr2csc_double_complex)
+{
+    Arguments arg = setup_csr2csc_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2csc<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_csr2csc_bin, csr2csc_bin_float)
 {
     Arguments arg = setup_csr2csc_arguments(GetParam());
@@ -148,6 +165,22 @@ TEST_P(parameterized_csr2csc_bin, csr2csc_bin_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csr2csc_bin, csr2csc_bin_float_complex)
+{
+    Arguments arg = setup_csr2csc_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2csc<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2csc_bin, csr2csc_bin_double_complex)
+{
+    Arguments arg = setup_csr2csc_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2csc<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 INSTANTIATE_TEST_CASE_P(csr2csc,
                         parameterized_csr2csc,
                         testing::Combine(testing::ValuesIn(csr2csc_M_range),
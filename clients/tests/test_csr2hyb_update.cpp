@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csr2hyb_update.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+
+typedef std::tuple<int, int, rocsparse_index_base, rocsparse_hyb_partition> csr2hyb_update_tuple;
+typedef std::tuple<int, rocsparse_index_base, rocsparse_hyb_partition> csr2hyb_update_lap_tuple;
+
+int csr2hyb_update_M_range[] = {-1, 0, 10, 500, 872, 1000};
+int csr2hyb_update_N_range[] = {-3, 0, 33, 242, 623, 1000};
+
+int csr2hyb_update_laplacian_range[] = {8, 33, 100};
+
+rocsparse_index_base csr2hyb_update_idx_base_range[] = {rocsparse_index_base_zero,
+                                                        rocsparse_index_base_one};
+
+rocsparse_hyb_partition csr2hyb_update_partition[] = {
+    rocsparse_hyb_partition_auto, rocsparse_hyb_partition_max, rocsparse_hyb_partition_user};
+
+class parameterized_csr2hyb_update : public testing::TestWithParam<csr2hyb_update_tuple>
+{
+    protected:
+    parameterized_csr2hyb_update() {}
+    virtual ~parameterized_csr2hyb_update() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csr2hyb_update_lap : public testing::TestWithParam<csr2hyb_update_lap_tuple>
+{
+    protected:
+    parameterized_csr2hyb_update_lap() {}
+    virtual ~parameterized_csr2hyb_update_lap() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csr2hyb_update_arguments(csr2hyb_update_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.idx_base = std::get<2>(tup);
+    arg.part     = std::get<3>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+Arguments setup_csr2hyb_update_arguments(csr2hyb_update_lap_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup) * std::get<0>(tup);
+    arg.N         = std::get<0>(tup) * std::get<0>(tup);
+    arg.laplacian = std::get<0>(tup);
+    arg.idx_base  = std::get<1>(tup);
+    arg.part      = std::get<2>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(csr2hyb_update_bad_arg, csr2hyb_update) { testing_csr2hyb_update_bad_arg<float>(); }
+
+TEST_P(parameterized_csr2hyb_update, csr2hyb_update_float)
+{
+    Arguments arg = setup_csr2hyb_update_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2hyb_update<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2hyb_update, csr2hyb_update_double)
+{
+    Arguments arg = setup_csr2hyb_update_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2hyb_update<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2hyb_update, csr2hyb_update_float_complex)
+{
+    Arguments arg = setup_csr2hyb_update_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2hyb_update<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2hyb_update, csr2hyb_update_double_complex)
+{
+    Arguments arg = setup_csr2hyb_update_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2hyb_update<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2hyb_update_lap, csr2hyb_update_lap_float)
+{
+    Arguments arg = setup_csr2hyb_update_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2hyb_update<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csr2hyb_update_lap, csr2hyb_update_lap_double)
+{
+    Arguments arg = setup_csr2hyb_update_arguments(GetParam());
+
+    rocsparse_status status = testing_csr2hyb_update<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csr2hyb_update,
+                        parameterized_csr2hyb_update,
+                        testing::Combine(testing::ValuesIn(csr2hyb_update_M_range),
+                                         testing::ValuesIn(csr2hyb_update_N_range),
+                                         testing::ValuesIn(csr2hyb_update_idx_base_range),
+                                         testing::ValuesIn(csr2hyb_update_partition)));
+
+INSTANTIATE_TEST_CASE_P(csr2hyb_update_lap,
+                        parameterized_csr2hyb_update_lap,
+                        testing::Combine(testing::ValuesIn(csr2hyb_update_laplacian_range),
+                                         testing::ValuesIn(csr2hyb_update_idx_base_range),
+                                         testing::ValuesIn(csr2hyb_update_partition)));
@@ -125,6 +125,22 @@ TEST_P(parameterized_csrilu0, csrilu0_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csrilu0, csrilu0_float_complex)
+{
+    Arguments arg = setup_csrilu0_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilu0, csrilu0_double_complex)
+{
+    Arguments arg = setup_csrilu0_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_csrilu0_bin, csrilu0_bin_float)
 {
     Arguments arg = setup_csrilu0_arguments(GetParam());
@@ -141,6 +157,22 @@ TEST_P(parameterized_csrilu0_bin, csrilu0_bin_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csrilu0_bin, csrilu0_bin_float_complex)
+{
+    Arguments arg = setup_csrilu0_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilu0_bin, csrilu0_bin_double_complex)
+{
+    Arguments arg = setup_csrilu0_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 INSTANTIATE_TEST_CASE_P(csrilu0,
                         parameterized_csrilu0,
                         testing::Combine(testing::ValuesIn(csrilu0_M_range),
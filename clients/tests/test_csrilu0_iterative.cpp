@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_csrilu0_iterative.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef std::tuple<int, rocsparse_index_base> csrilu0_iterative_tuple;
+typedef std::tuple<int, rocsparse_index_base> csrilu0_iterative_laplacian_tuple;
+
+int csrilu0_iterative_M_range[]         = {-1, 0, 10, 100, 500};
+int csrilu0_iterative_laplacian_range[] = {4, 16, 24};
+
+rocsparse_index_base csrilu0_iterative_base[] = {rocsparse_index_base_zero,
+                                                 rocsparse_index_base_one};
+
+class parameterized_csrilu0_iterative : public testing::TestWithParam<csrilu0_iterative_tuple>
+{
+    protected:
+    parameterized_csrilu0_iterative() {}
+    virtual ~parameterized_csrilu0_iterative() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_csrilu0_iterative_laplacian
+    : public testing::TestWithParam<csrilu0_iterative_laplacian_tuple>
+{
+    protected:
+    parameterized_csrilu0_iterative_laplacian() {}
+    virtual ~parameterized_csrilu0_iterative_laplacian() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrilu0_iterative_arguments(csrilu0_iterative_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.idx_base = std::get<1>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+Arguments setup_csrilu0_iterative_laplacian_arguments(csrilu0_iterative_laplacian_tuple tup)
+{
+    Arguments arg;
+    arg.laplacian = std::get<0>(tup);
+    arg.idx_base  = std::get<1>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(csrilu0_iterative_bad_arg, csrilu0_iterative) { testing_csrilu0_iterative_bad_arg(); }
+
+TEST_P(parameterized_csrilu0_iterative, csrilu0_iterative_float)
+{
+    Arguments arg = setup_csrilu0_iterative_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0_iterative<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilu0_iterative, csrilu0_iterative_double)
+{
+    Arguments arg = setup_csrilu0_iterative_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0_iterative<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilu0_iterative_laplacian, csrilu0_iterative_laplacian_float)
+{
+    Arguments arg = setup_csrilu0_iterative_laplacian_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0_iterative<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrilu0_iterative_laplacian, csrilu0_iterative_laplacian_double)
+{
+    Arguments arg = setup_csrilu0_iterative_laplacian_arguments(GetParam());
+
+    rocsparse_status status = testing_csrilu0_iterative<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrilu0_iterative,
+                        parameterized_csrilu0_iterative,
+                        testing::Combine(testing::ValuesIn(csrilu0_iterative_M_range),
+                                         testing::ValuesIn(csrilu0_iterative_base)));
+
+INSTANTIATE_TEST_CASE_P(csrilu0_iterative_laplacian,
+                        parameterized_csrilu0_iterative_laplacian,
+                        testing::Combine(testing::ValuesIn(csrilu0_iterative_laplacian_range),
+                                         testing::ValuesIn(csrilu0_iterative_base)));
@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrmv_mapped.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, int, double, double, base, std::string> csrmv_mapped_tuple;
+
+int csrmv_mapped_M_range[] = {500, 7111};
+int csrmv_mapped_N_range[] = {842, 4441};
+int csrmv_mapped_K_range[] = {1, 7};
+
+std::vector<double> csrmv_mapped_alpha_range = {2.0, 3.0};
+std::vector<double> csrmv_mapped_beta_range  = {0.0, 1.0};
+
+base csrmv_mapped_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+// Plain mapping and a prefaulted mapping backed by huge pages, interleaved across nodes
+std::string csrmv_mapped_hints_range[] = {"", "huge,interleave,populate"};
+
+class parameterized_csrmv_mapped : public testing::TestWithParam<csrmv_mapped_tuple>
+{
+    protected:
+    parameterized_csrmv_mapped() {}
+    virtual ~parameterized_csrmv_mapped() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrmv_mapped_arguments(csrmv_mapped_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.K         = std::get<2>(tup);
+    arg.alpha     = std::get<3>(tup);
+    arg.beta      = std::get<4>(tup);
+    arg.idx_base  = std::get<5>(tup);
+    arg.map_hints = std::get<6>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST_P(parameterized_csrmv_mapped, csrmv_mapped_float)
+{
+    Arguments arg = setup_csrmv_mapped_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_mapped<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_mapped, csrmv_mapped_double)
+{
+    Arguments arg = setup_csrmv_mapped_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_mapped<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrmv_mapped,
+                        parameterized_csrmv_mapped,
+                        testing::Combine(testing::ValuesIn(csrmv_mapped_M_range),
+                                         testing::ValuesIn(csrmv_mapped_N_range),
+                                         testing::ValuesIn(csrmv_mapped_K_range),
+                                         testing::ValuesIn(csrmv_mapped_alpha_range),
+                                         testing::ValuesIn(csrmv_mapped_beta_range),
+                                         testing::ValuesIn(csrmv_mapped_idxbase_range),
+                                         testing::ValuesIn(csrmv_mapped_hints_range)));
@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrmv_masked.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, double, double, base, double> csrmv_masked_tuple;
+
+int csrmv_masked_M_range[] = {-1, 0, 500, 7111};
+int csrmv_masked_N_range[] = {-3, 0, 842, 4441};
+
+std::vector<double> csrmv_masked_alpha_range = {2.0, 3.0};
+std::vector<double> csrmv_masked_beta_range  = {0.0, 1.0};
+
+base csrmv_masked_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+double csrmv_masked_density_range[] = {0.0, 0.05, 0.5, 1.0};
+
+class parameterized_csrmv_masked : public testing::TestWithParam<csrmv_masked_tuple>
+{
+    protected:
+    parameterized_csrmv_masked() {}
+    virtual ~parameterized_csrmv_masked() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrmv_masked_arguments(csrmv_masked_tuple tup)
+{
+    Arguments arg;
+    arg.M            = std::get<0>(tup);
+    arg.N            = std::get<1>(tup);
+    arg.alpha        = std::get<2>(tup);
+    arg.beta         = std::get<3>(tup);
+    arg.idx_base     = std::get<4>(tup);
+    arg.mask_density = std::get<5>(tup);
+    arg.timing       = 0;
+    return arg;
+}
+
+TEST(csrmv_masked_bad_arg, csrmv_masked_float) { testing_csrmv_masked_bad_arg<float>(); }
+
+TEST_P(parameterized_csrmv_masked, csrmv_masked_float)
+{
+    Arguments arg = setup_csrmv_masked_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_masked<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_masked, csrmv_masked_double)
+{
+    Arguments arg = setup_csrmv_masked_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_masked<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrmv_masked,
+                        parameterized_csrmv_masked,
+                        testing::Combine(testing::ValuesIn(csrmv_masked_M_range),
+                                         testing::ValuesIn(csrmv_masked_N_range),
+                                         testing::ValuesIn(csrmv_masked_alpha_range),
+                                         testing::ValuesIn(csrmv_masked_beta_range),
+                                         testing::ValuesIn(csrmv_masked_idxbase_range),
+                                         testing::ValuesIn(csrmv_masked_density_range)));
@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_csrmv_semiring.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, double, double, base, rocsparse_semiring, bool> csrmv_semiring_tuple;
+
+int csrmv_semiring_M_range[] = {-1, 0, 500, 2000};
+int csrmv_semiring_N_range[] = {-3, 0, 842};
+
+std::vector<double> csrmv_semiring_alpha_range = {2.0};
+std::vector<double> csrmv_semiring_beta_range  = {0.0, 1.0};
+
+base csrmv_semiring_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+rocsparse_semiring csrmv_semiring_range[] = {rocsparse_semiring_plus_times,
+                                             rocsparse_semiring_min_plus,
+                                             rocsparse_semiring_max_times,
+                                             rocsparse_semiring_or_and};
+
+bool csrmv_semiring_adaptive[] = {false, true};
+
+class parameterized_csrmv_semiring : public testing::TestWithParam<csrmv_semiring_tuple>
+{
+    protected:
+    parameterized_csrmv_semiring() {}
+    virtual ~parameterized_csrmv_semiring() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrmv_semiring_arguments(csrmv_semiring_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.alpha    = std::get<2>(tup);
+    arg.beta     = std::get<3>(tup);
+    arg.idx_base = std::get<4>(tup);
+    arg.semiring = std::get<5>(tup);
+    arg.bswitch  = std::get<6>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(csrmv_semiring_bad_arg, csrmv_semiring_float) { testing_csrmv_semiring_bad_arg<float>(); }
+
+TEST_P(parameterized_csrmv_semiring, csrmv_semiring_float)
+{
+    Arguments arg = setup_csrmv_semiring_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_semiring<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_semiring, csrmv_semiring_double)
+{
+    Arguments arg = setup_csrmv_semiring_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_semiring<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrmv_semiring,
+                        parameterized_csrmv_semiring,
+                        testing::Combine(testing::ValuesIn(csrmv_semiring_M_range),
+                                         testing::ValuesIn(csrmv_semiring_N_range),
+                                         testing::ValuesIn(csrmv_semiring_alpha_range),
+                                         testing::ValuesIn(csrmv_semiring_beta_range),
+                                         testing::ValuesIn(csrmv_semiring_idxbase_range),
+                                         testing::ValuesIn(csrmv_semiring_range),
+                                         testing::ValuesIn(csrmv_semiring_adaptive)));
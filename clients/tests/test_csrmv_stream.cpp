@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_csrmv_stream.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, double, double, base, int> csrmv_stream_tuple;
+
+int csrmv_stream_M_range[] = {-1, 0, 500, 7111};
+int csrmv_stream_N_range[] = {-3, 0, 842, 4441};
+
+std::vector<double> csrmv_stream_alpha_range = {2.0, 3.0};
+std::vector<double> csrmv_stream_beta_range  = {0.0, 1.0};
+
+base csrmv_stream_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+// Single row panels, panels of a few rows and the default of eight panels
+int csrmv_stream_panel_range[] = {1, 97, 0};
+
+class parameterized_csrmv_stream : public testing::TestWithParam<csrmv_stream_tuple>
+{
+    protected:
+    parameterized_csrmv_stream() {}
+    virtual ~parameterized_csrmv_stream() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_csrmv_stream_arguments(csrmv_stream_tuple tup)
+{
+    Arguments arg;
+    arg.M         = std::get<0>(tup);
+    arg.N         = std::get<1>(tup);
+    arg.alpha     = std::get<2>(tup);
+    arg.beta      = std::get<3>(tup);
+    arg.idx_base  = std::get<4>(tup);
+    arg.panel_nnz = std::get<5>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(csrmv_stream_bad_arg, csrmv_stream_float) { testing_csrmv_stream_bad_arg<float>(); }
+
+TEST_P(parameterized_csrmv_stream, csrmv_stream_float)
+{
+    Arguments arg = setup_csrmv_stream_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_stream<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrmv_stream, csrmv_stream_double)
+{
+    Arguments arg = setup_csrmv_stream_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_stream<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(csrmv_stream,
+                        parameterized_csrmv_stream,
+                        testing::Combine(testing::ValuesIn(csrmv_stream_M_range),
+                                         testing::ValuesIn(csrmv_stream_N_range),
+                                         testing::ValuesIn(csrmv_stream_alpha_range),
+                                         testing::ValuesIn(csrmv_stream_beta_range),
+                                         testing::ValuesIn(csrmv_stream_idxbase_range),
+                                         testing::ValuesIn(csrmv_stream_panel_range)));
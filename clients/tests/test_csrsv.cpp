@@ -141,6 +141,22 @@ TEST_P(parameterized_csrsv, csrsv_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csrsv, csrsv_float_complex)
+{
+    Arguments arg = setup_csrsv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrsv, csrsv_double_complex)
+{
+    Arguments arg = setup_csrsv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_csrsv_bin, csrsv_bin_float)
 {
     Arguments arg = setup_csrsv_arguments(GetParam());
@@ -157,6 +173,22 @@ TEST_P(parameterized_csrsv_bin, csrsv_bin_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_csrsv_bin, csrsv_bin_float_complex)
+{
+    Arguments arg = setup_csrsv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_csrsv_bin, csrsv_bin_double_complex)
+{
+    Arguments arg = setup_csrsv_arguments(GetParam());
+
+    rocsparse_status status = testing_csrsv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 INSTANTIATE_TEST_CASE_P(csrsv,
                         parameterized_csrsv,
                         testing::Combine(testing::ValuesIn(csrsv_M_range),
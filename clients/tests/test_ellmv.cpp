@@ -30,7 +30,7 @@
 #include <string>
 
 typedef rocsparse_index_base base;
-typedef std::tuple<int, int, double, double, base> ellmv_tuple;
+typedef std::tuple<int, int, double, double, base, rocsparse_operation> ellmv_tuple;
 typedef std::tuple<double, double, base, std::string> ellmv_bin_tuple;
 
 int ell_M_range[] = {-1, 0, 10, 500, 7111, 10000};
@@ -41,6 +41,10 @@ std::vector<double> ell_beta_range  = {0.0, 0.6};
 
 base ell_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
 
+rocsparse_operation ell_trans_range[] = {rocsparse_operation_none,
+                                         rocsparse_operation_transpose,
+                                         rocsparse_operation_conjugate_transpose};
+
 std::string ell_bin[] = {"rma10.bin",
                          "mac_econ_fwd500.bin",
                          "bibd_22_8.bin",
@@ -81,6 +85,7 @@ Arguments setup_ellmv_arguments(ellmv_tuple tup)
     arg.alpha    = std::get<2>(tup);
     arg.beta     = std::get<3>(tup);
     arg.idx_base = std::get<4>(tup);
+    arg.transA   = std::get<5>(tup);
     arg.timing   = 0;
     return arg;
 }
@@ -134,6 +139,22 @@ TEST_P(parameterized_ellmv, ellmv_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_ellmv, ellmv_float_complex)
+{
+    Arguments arg = setup_ellmv_arguments(GetParam());
+
+    rocsparse_status status = testing_ellmv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_ellmv, ellmv_double_complex)
+{
+    Arguments arg = setup_ellmv_arguments(GetParam());
+
+    rocsparse_status status = testing_ellmv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_ellmv_bin, ellmv_bin_float)
 {
     Arguments arg = setup_ellmv_arguments(GetParam());
@@ -150,13 +171,30 @@ TEST_P(parameterized_ellmv_bin, ellmv_bin_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_ellmv_bin, ellmv_bin_float_complex)
+{
+    Arguments arg = setup_ellmv_arguments(GetParam());
+
+    rocsparse_status status = testing_ellmv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_ellmv_bin, ellmv_bin_double_complex)
+{
+    Arguments arg = setup_ellmv_arguments(GetParam());
+
+    rocsparse_status status = testing_ellmv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 INSTANTIATE_TEST_CASE_P(ellmv,
                         parameterized_ellmv,
                         testing::Combine(testing::ValuesIn(ell_M_range),
                                          testing::ValuesIn(ell_N_range),
                                          testing::ValuesIn(ell_alpha_range),
                                          testing::ValuesIn(ell_beta_range),
-                                         testing::ValuesIn(ell_idxbase_range)));
+                                         testing::ValuesIn(ell_idxbase_range),
+                                         testing::ValuesIn(ell_trans_range)));
 
 INSTANTIATE_TEST_CASE_P(ellmv_bin,
                         parameterized_ellmv_bin,
@@ -29,7 +29,14 @@
 #include <vector>
 #include <string>
 
-typedef std::tuple<int, int, double, double, rocsparse_index_base, rocsparse_hyb_partition, int>
+typedef std::tuple<int,
+                   int,
+                   double,
+                   double,
+                   rocsparse_index_base,
+                   rocsparse_hyb_partition,
+                   int,
+                   rocsparse_operation>
     hybmv_tuple;
 typedef std::tuple<double, double, rocsparse_index_base, rocsparse_hyb_partition, int, std::string>
     hybmv_bin_tuple;
@@ -42,6 +49,10 @@ std::vector<double> hyb_beta_range  = {0.0, 0.67, 1.0};
 
 rocsparse_index_base hyb_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
 
+rocsparse_operation hyb_trans_range[] = {rocsparse_operation_none,
+                                         rocsparse_operation_transpose,
+                                         rocsparse_operation_conjugate_transpose};
+
 rocsparse_hyb_partition hyb_partition[] = {
     rocsparse_hyb_partition_auto, rocsparse_hyb_partition_max, rocsparse_hyb_partition_user};
 
@@ -90,6 +101,7 @@ Arguments setup_hybmv_arguments(hybmv_tuple tup)
     arg.idx_base  = std::get<4>(tup);
     arg.part      = std::get<5>(tup);
     arg.ell_width = std::get<6>(tup);
+    arg.transA    = std::get<7>(tup);
     arg.timing    = 0;
     return arg;
 }
@@ -145,6 +157,22 @@ TEST_P(parameterized_hybmv, hybmv_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_hybmv, hybmv_float_complex)
+{
+    Arguments arg = setup_hybmv_arguments(GetParam());
+
+    rocsparse_status status = testing_hybmv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_hybmv, hybmv_double_complex)
+{
+    Arguments arg = setup_hybmv_arguments(GetParam());
+
+    rocsparse_status status = testing_hybmv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 TEST_P(parameterized_hybmv_bin, hybmv_bin_float)
 {
     Arguments arg = setup_hybmv_arguments(GetParam());
@@ -161,6 +189,22 @@ TEST_P(parameterized_hybmv_bin, hybmv_bin_double)
     EXPECT_EQ(status, rocsparse_status_success);
 }
 
+TEST_P(parameterized_hybmv_bin, hybmv_bin_float_complex)
+{
+    Arguments arg = setup_hybmv_arguments(GetParam());
+
+    rocsparse_status status = testing_hybmv<rocsparse_float_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_hybmv_bin, hybmv_bin_double_complex)
+{
+    Arguments arg = setup_hybmv_arguments(GetParam());
+
+    rocsparse_status status = testing_hybmv<rocsparse_double_complex>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
 INSTANTIATE_TEST_CASE_P(hybmv,
                         parameterized_hybmv,
                         testing::Combine(testing::ValuesIn(hyb_M_range),
@@ -169,7 +213,8 @@ INSTANTIATE_TEST_CASE_P(hybmv,
                                          testing::ValuesIn(hyb_beta_range),
                                          testing::ValuesIn(hyb_idxbase_range),
                                          testing::ValuesIn(hyb_partition),
-                                         testing::ValuesIn(hyb_ELL_range)));
+                                         testing::ValuesIn(hyb_ELL_range),
+                                         testing::ValuesIn(hyb_trans_range)));
 
 INSTANTIATE_TEST_CASE_P(hybmv_bin,
                         parameterized_hybmv_bin,
@@ -0,0 +1,385 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.hpp"
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Generate matrix, the generator parameters not given take their command line defaults
+static mtx_csr_matrix generate(const std::string& generator,
+                               rocsparse_int dim,
+                               rocsparse_int bandwidth   = 1,
+                               rocsparse_int block_dim   = 3,
+                               rocsparse_int edge_factor = 16)
+{
+    mtx_csr_matrix A;
+
+    EXPECT_EQ(gen_matrix_csr(generator, dim, bandwidth, block_dim, edge_factor, A), 0);
+
+    return A;
+}
+
+// Square, consistent row pointer and strictly increasing column indices within each row
+static void check_structure(const mtx_csr_matrix& A)
+{
+    ASSERT_EQ(A.m, A.n);
+    ASSERT_EQ(A.ptr.size(), static_cast<size_t>(A.m + 1));
+    ASSERT_EQ(A.ptr[0], 0);
+    ASSERT_EQ(A.ptr[A.m], A.nnz);
+    ASSERT_EQ(A.col.size(), static_cast<size_t>(A.nnz));
+    ASSERT_EQ(A.re.size(), static_cast<size_t>(A.nnz));
+
+    for(rocsparse_int i = 0; i < A.m; ++i)
+    {
+        for(rocsparse_int j = A.ptr[i]; j < A.ptr[i + 1]; ++j)
+        {
+            ASSERT_GE(A.col[j], 0);
+            ASSERT_LT(A.col[j], A.n);
+
+            if(j > A.ptr[i])
+            {
+                ASSERT_LT(A.col[j - 1], A.col[j]);
+            }
+        }
+    }
+}
+
+// Every row holds its diagonal entry, which exceeds the sum of the off-diagonal magnitudes
+static void check_diagonal_dominance(const mtx_csr_matrix& A)
+{
+    for(rocsparse_int i = 0; i < A.m; ++i)
+    {
+        double diag = 0.0;
+        double sum  = 0.0;
+        bool found  = false;
+
+        for(rocsparse_int j = A.ptr[i]; j < A.ptr[i + 1]; ++j)
+        {
+            if(A.col[j] == i)
+            {
+                diag  = A.re[j];
+                found = true;
+            }
+            else
+            {
+                sum += std::abs(A.re[j]);
+            }
+        }
+
+        ASSERT_TRUE(found) << "row " << i;
+        ASSERT_GT(diag, sum) << "row " << i;
+    }
+}
+
+// Entries of A by position
+static std::map<std::pair<rocsparse_int, rocsparse_int>, double> entries(const mtx_csr_matrix& A)
+{
+    std::map<std::pair<rocsparse_int, rocsparse_int>, double> e;
+
+    for(rocsparse_int i = 0; i < A.m; ++i)
+    {
+        for(rocsparse_int j = A.ptr[i]; j < A.ptr[i + 1]; ++j)
+        {
+            e[std::make_pair(i, A.col[j])] = A.re[j];
+        }
+    }
+
+    return e;
+}
+
+// Structurally symmetric, and numerically symmetric if requested
+static void check_symmetry(const mtx_csr_matrix& A, bool values)
+{
+    std::map<std::pair<rocsparse_int, rocsparse_int>, double> e = entries(A);
+
+    for(auto it = e.begin(); it != e.end(); ++it)
+    {
+        auto t = e.find(std::make_pair(it->first.second, it->first.first));
+
+        ASSERT_TRUE(t != e.end()) << "(" << it->first.first << ", " << it->first.second << ")";
+
+        if(values)
+        {
+            ASSERT_EQ(t->second, it->second);
+        }
+    }
+}
+
+TEST(matrix_generator, stencil7)
+{
+    mtx_csr_matrix A = generate("stencil7", 5);
+
+    // 7 points per grid point, minus the missing neighbor on each side of the 6 faces
+    check_structure(A);
+    EXPECT_EQ(A.m, 125);
+    EXPECT_EQ(A.nnz, 7 * 125 - 6 * 25);
+    check_symmetry(A, true);
+    check_diagonal_dominance(A);
+}
+
+TEST(matrix_generator, stencil27)
+{
+    mtx_csr_matrix A = generate("stencil27", 5);
+
+    // Number of pairs of neighbors is (3 * dim - 2) per dimension
+    check_structure(A);
+    EXPECT_EQ(A.m, 125);
+    EXPECT_EQ(A.nnz, 13 * 13 * 13);
+    check_symmetry(A, true);
+    check_diagonal_dominance(A);
+}
+
+TEST(matrix_generator, banded)
+{
+    mtx_csr_matrix A = generate("banded", 100, 3);
+
+    // Full band, minus the triangles cut off in the corners
+    check_structure(A);
+    EXPECT_EQ(A.m, 100);
+    EXPECT_EQ(A.nnz, 100 * 7 - 3 * 4);
+    check_symmetry(A, false);
+    check_diagonal_dominance(A);
+
+    for(rocsparse_int i = 0; i < A.m; ++i)
+    {
+        EXPECT_EQ(A.col[A.ptr[i]], std::max(0, i - 3));
+        EXPECT_EQ(A.col[A.ptr[i + 1] - 1], std::min(A.m - 1, i + 3));
+    }
+}
+
+TEST(matrix_generator, block)
+{
+    mtx_csr_matrix A = generate("block", 3, 1, 2);
+
+    // 27 point connectivity of the nodes with dense 2 x 2 blocks
+    check_structure(A);
+    EXPECT_EQ(A.m, 27 * 2);
+    EXPECT_EQ(A.nnz, 7 * 7 * 7 * 2 * 2);
+    check_symmetry(A, false);
+    check_diagonal_dominance(A);
+}
+
+TEST(matrix_generator, chain)
+{
+    mtx_csr_matrix A = generate("chain", 200, 2);
+
+    // Duplicate dependencies are summed up, such that there are at most 2 * 3 off-diagonal
+    // entries per row, and at least the sub- and superdiagonal
+    check_structure(A);
+    EXPECT_EQ(A.m, 200);
+    EXPECT_GE(A.nnz, 3 * 200 - 2);
+    EXPECT_LE(A.nnz, 200 * (2 * 2 + 3));
+    check_symmetry(A, true);
+    check_diagonal_dominance(A);
+
+    std::map<std::pair<rocsparse_int, rocsparse_int>, double> e = entries(A);
+
+    for(rocsparse_int i = 1; i < A.m; ++i)
+    {
+        EXPECT_TRUE(e.count(std::make_pair(i, i - 1)) == 1) << "row " << i;
+    }
+}
+
+TEST(matrix_generator, rmat)
+{
+    mtx_csr_matrix A = generate("rmat", 10, 1, 3, 8);
+
+    // Duplicate edges are summed up, diagonal entries are added to each row
+    check_structure(A);
+    EXPECT_EQ(A.m, 1024);
+    EXPECT_GE(A.nnz, 1024);
+    EXPECT_LE(A.nnz, 1024 * (8 + 1));
+    check_diagonal_dominance(A);
+
+    // Power law, the longest row is far longer than the average row
+    rocsparse_int max_row = 0;
+
+    for(rocsparse_int i = 0; i < A.m; ++i)
+    {
+        max_row = std::max(max_row, A.ptr[i + 1] - A.ptr[i]);
+    }
+
+    EXPECT_GT(max_row, 8 * A.nnz / A.m);
+
+    // Generated matrices do not depend on the number of host threads
+    mtx_csr_matrix B = generate("rmat", 10, 1, 3, 8);
+
+    EXPECT_EQ(A.ptr, B.ptr);
+    EXPECT_EQ(A.col, B.col);
+    EXPECT_EQ(A.re, B.re);
+}
+
+TEST(matrix_generator, bad_arg)
+{
+    mtx_csr_matrix A;
+
+    EXPECT_NE(gen_matrix_csr("stencil5", 4, 1, 3, 16, A), 0);
+    EXPECT_NE(gen_matrix_csr("stencil7", 0, 1, 3, 16, A), 0);
+    EXPECT_NE(gen_matrix_csr("banded", 4, -1, 3, 16, A), 0);
+    EXPECT_NE(gen_matrix_csr("rmat", 31, 1, 3, 16, A), 0);
+    EXPECT_NE(gen_matrix_csr("stencil7", 2000, 1, 3, 16, A), 0);
+}
+
+TEST(matrix_generator, load_matrix)
+{
+    Arguments argus;
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+
+    std::vector<rocsparse_int> ptr;
+    std::vector<rocsparse_int> row;
+    std::vector<rocsparse_int> col;
+    std::vector<double> val;
+
+    // Generated matrices in one based CSR and COO format
+    mtx_csr_matrix A = generate("banded", 50, 2);
+
+    argus.generator     = "banded";
+    argus.gen_dim       = 50;
+    argus.gen_bandwidth = 2;
+
+    ASSERT_EQ(load_matrix_csr(argus, "", "", m, n, nnz, ptr, col, val, rocsparse_index_base_one),
+              0);
+    ASSERT_EQ(m, A.m);
+    ASSERT_EQ(n, A.n);
+    ASSERT_EQ(nnz, A.nnz);
+
+    for(rocsparse_int i = 0; i <= m; ++i)
+    {
+        EXPECT_EQ(ptr[i], A.ptr[i] + 1);
+    }
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        EXPECT_EQ(col[i], A.col[i] + 1);
+        EXPECT_EQ(val[i], A.re[i]);
+    }
+
+    ASSERT_EQ(load_matrix_coo(argus, "", "", m, n, nnz, row, col, val, rocsparse_index_base_one),
+              0);
+    ASSERT_EQ(row.size(), static_cast<size_t>(nnz));
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = A.ptr[i]; j < A.ptr[i + 1]; ++j)
+        {
+            EXPECT_EQ(row[j], i + 1);
+        }
+    }
+
+    // The laplacian takes precedence over the generator, nnz does not include the index base
+    argus.laplacian = 4;
+
+    ASSERT_EQ(load_matrix_csr(argus, "", "", m, n, nnz, ptr, col, val, rocsparse_index_base_one),
+              0);
+    EXPECT_EQ(m, 16);
+    EXPECT_EQ(n, 16);
+    EXPECT_EQ(nnz, 16 * 5 - 4 * 4);
+    EXPECT_EQ(ptr[m], nnz + 1);
+
+    // Missing files are reported
+    argus.laplacian = 0;
+
+    EXPECT_NE(load_matrix_csr(argus,
+                              "",
+                              "missing.mtx",
+                              m,
+                              n,
+                              nnz,
+                              ptr,
+                              col,
+                              val,
+                              rocsparse_index_base_zero),
+              0);
+}
+
+TEST(matrix_generator, load_matrix_cache)
+{
+    Arguments argus;
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+
+    std::vector<rocsparse_int> ptr;
+    std::vector<rocsparse_int> col;
+    std::vector<double> val;
+    std::vector<float> fval;
+
+    scoped_temp_dir dir;
+    ASSERT_FALSE(dir.path.empty());
+
+    std::string filename = dir.path + "/A.mtx";
+
+    {
+        std::ofstream out(filename);
+        out << "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1.0\n2 2 2.0\n";
+    }
+
+    {
+        load_matrix_cache_scope cache;
+
+        ASSERT_EQ(load_matrix_csr(
+                      argus, "", filename, m, n, nnz, ptr, col, val, rocsparse_index_base_zero),
+                  0);
+        ASSERT_EQ(nnz, 2);
+
+        // Changed file is not read again while the scope is alive
+        {
+            std::ofstream out(filename);
+            out << "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 2 3.0\n";
+        }
+
+        ASSERT_EQ(load_matrix_csr(
+                      argus, "", filename, m, n, nnz, ptr, col, val, rocsparse_index_base_zero),
+                  0);
+        ASSERT_EQ(nnz, 2);
+        EXPECT_EQ(ptr[2], 2);
+        EXPECT_EQ(col[1], 1);
+        EXPECT_EQ(val[1], 2.0);
+
+        // Other precisions and index bases are read separately
+        ASSERT_EQ(load_matrix_csr(
+                      argus, "", filename, m, n, nnz, ptr, col, fval, rocsparse_index_base_zero),
+                  0);
+        EXPECT_EQ(nnz, 1);
+
+        ASSERT_EQ(load_matrix_csr(
+                      argus, "", filename, m, n, nnz, ptr, col, val, rocsparse_index_base_one),
+                  0);
+        EXPECT_EQ(nnz, 1);
+    }
+
+    // Cache is dropped with the scope
+    ASSERT_EQ(
+        load_matrix_csr(argus, "", filename, m, n, nnz, ptr, col, val, rocsparse_index_base_zero),
+        0);
+    ASSERT_EQ(nnz, 1);
+    EXPECT_EQ(col[0], 1);
+    EXPECT_EQ(val[0], 3.0);
+}
@@ -0,0 +1,471 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "utility.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <vector>
+
+// MatrixMarket files kept next to the binary test matrices
+std::string mtx_shipped[] = {"nos1", "nos2", "nos3", "nos4", "nos5", "nos6", "nos7"};
+
+// Sorted COO matrix with zero based indices
+struct mtx_reference
+{
+    rocsparse_int m   = 0;
+    rocsparse_int n   = 0;
+    rocsparse_int nnz = 0;
+
+    std::vector<rocsparse_int> row;
+    std::vector<rocsparse_int> col;
+    std::vector<double> val;
+};
+
+// Line by line reader, as used before the parallel reader. Duplicates and mirrored entries of
+// symmetric matrices stay in file order within a row.
+static bool read_mtx_reference(const std::string& filename, mtx_reference& A)
+{
+    std::ifstream f(filename.c_str());
+    std::string line;
+
+    if(!std::getline(f, line))
+    {
+        return false;
+    }
+
+    std::string banner;
+    std::string array;
+    std::string coord;
+    std::string type;
+    std::string symm;
+
+    std::istringstream header(line);
+    header >> banner >> array >> coord >> type >> symm;
+
+    std::transform(type.begin(), type.end(), type.begin(), ::tolower);
+    std::transform(symm.begin(), symm.end(), symm.begin(), ::tolower);
+
+    bool pattern   = (type == "pattern");
+    bool symmetric = (symm == "symmetric");
+    bool sizes     = false;
+
+    std::vector<std::pair<std::pair<rocsparse_int, rocsparse_int>, double>> entry;
+
+    while(std::getline(f, line))
+    {
+        std::istringstream ss(line);
+        rocsparse_int i;
+        rocsparse_int j;
+        double val = 1.0;
+
+        // Skip comments and blank lines
+        if(line.find_first_not_of(" \t\r") == std::string::npos || line[0] == '%')
+        {
+            continue;
+        }
+
+        if(!sizes)
+        {
+            ss >> A.m >> A.n;
+            sizes = true;
+            continue;
+        }
+
+        if(!(ss >> i >> j) || (!pattern && !(ss >> val)))
+        {
+            return false;
+        }
+
+        entry.push_back(std::make_pair(std::make_pair(i - 1, j - 1), val));
+
+        if(symmetric && i != j)
+        {
+            entry.push_back(std::make_pair(std::make_pair(j - 1, i - 1), val));
+        }
+    }
+
+    std::stable_sort(entry.begin(),
+                     entry.end(),
+                     [](const std::pair<std::pair<rocsparse_int, rocsparse_int>, double>& a,
+                        const std::pair<std::pair<rocsparse_int, rocsparse_int>, double>& b) {
+                         return a.first < b.first;
+                     });
+
+    A.nnz = static_cast<rocsparse_int>(entry.size());
+
+    for(size_t k = 0; k < entry.size(); ++k)
+    {
+        A.row.push_back(entry[k].first.first);
+        A.col.push_back(entry[k].first.second);
+        A.val.push_back(entry[k].second);
+    }
+
+    return sizes;
+}
+
+// Expect the COO matrix to match the reference exactly, including the values
+static void mtx_compare(const mtx_reference& A,
+                        rocsparse_int m,
+                        rocsparse_int n,
+                        rocsparse_int nnz,
+                        const std::vector<rocsparse_int>& row,
+                        const std::vector<rocsparse_int>& col,
+                        const std::vector<double>& val)
+{
+    ASSERT_EQ(m, A.m);
+    ASSERT_EQ(n, A.n);
+    ASSERT_EQ(nnz, A.nnz);
+
+    for(rocsparse_int i = 0; i < nnz; ++i)
+    {
+        ASSERT_EQ(row[i], A.row[i]) << "entry " << i;
+        ASSERT_EQ(col[i], A.col[i]) << "entry " << i;
+        ASSERT_EQ(val[i], A.val[i]) << "entry " << i;
+    }
+}
+
+// Read the file with read_mtx_matrix and compare against the reference reader
+static void mtx_check_file(const std::string& filename)
+{
+    mtx_reference A;
+    ASSERT_TRUE(read_mtx_reference(filename, A)) << filename;
+
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+
+    std::vector<rocsparse_int> row;
+    std::vector<rocsparse_int> col;
+    std::vector<double> val;
+
+    ASSERT_EQ(
+        read_mtx_matrix(filename.c_str(), m, n, nnz, row, col, val, rocsparse_index_base_zero), 0)
+        << filename;
+
+    mtx_compare(A, m, n, nnz, row, col, val);
+}
+
+// Parse the file in memory with nthreads threads and compare against the reference reader
+static void mtx_check_parse(const std::string& text, int nthreads, const mtx_reference& A)
+{
+    mtx_csr_matrix mtx;
+
+    ASSERT_EQ(parse_mtx_csr(text.data(), text.size(), nthreads, mtx), 0) << nthreads << " threads";
+
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+
+    std::vector<rocsparse_int> row;
+    std::vector<rocsparse_int> col;
+    std::vector<double> val;
+
+    csr_matrix_to_coo(mtx, m, n, nnz, row, col, val, rocsparse_index_base_zero);
+
+    mtx_compare(A, m, n, nnz, row, col, val);
+}
+
+static void mtx_write(const std::string& filename, const std::string& text)
+{
+    std::ofstream f(filename.c_str(), std::ios::binary | std::ios::trunc);
+    f << text;
+}
+
+// Set modification time of the file, relative to now
+static void mtx_touch(const std::string& filename, long offset)
+{
+    struct timeval now;
+    gettimeofday(&now, NULL);
+
+    struct timeval times[2];
+    times[0].tv_sec  = now.tv_sec + offset;
+    times[0].tv_usec = 0;
+    times[1]         = times[0];
+
+    utimes(filename.c_str(), times);
+}
+
+// Values of the matrix read with read_mtx_matrix, empty if the file cannot be read
+static std::vector<double> mtx_values(const std::string& filename)
+{
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+
+    std::vector<rocsparse_int> row;
+    std::vector<rocsparse_int> col;
+    std::vector<double> val;
+
+    if(read_mtx_matrix(filename.c_str(), m, n, nnz, row, col, val, rocsparse_index_base_zero) != 0)
+    {
+        val.clear();
+    }
+
+    return val;
+}
+
+static bool mtx_exists(const std::string& filename)
+{
+    struct stat st;
+    return stat(filename.c_str(), &st) == 0;
+}
+
+TEST(mtx_reader, shipped)
+{
+    scoped_env env;
+
+    // Get current executables absolute path, matrices are stored in the matrices directory
+    char path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    for(size_t i = 0; i < sizeof(mtx_shipped) / sizeof(mtx_shipped[0]); ++i)
+    {
+        std::string filename = std::string(path_exe) + "matrices/" + mtx_shipped[i] + ".mtx";
+
+        if(!mtx_exists(filename))
+        {
+            printf("Skipping %s, file not found\n", filename.c_str());
+            continue;
+        }
+
+        // Parsed, then parsed or read from the cache
+        env.set("ROCSPARSE_MTX_CACHE", "0");
+        mtx_check_file(filename);
+
+        env.set("ROCSPARSE_MTX_CACHE", "1");
+        mtx_check_file(filename);
+        mtx_check_file(filename);
+    }
+}
+
+TEST(mtx_reader, headers)
+{
+    const char* text[] = {
+        // Comments and blank lines before the sizes and between the entries, duplicates are
+        // kept in file order, values taking the fast path and the strtod fallback
+        "%%MatrixMarket matrix coordinate real general\n"
+        "% comment\n"
+        "%\n"
+        "   \n"
+        "4 5 8\n"
+        "1 1 1.0\n"
+        "1 3 -2.5e-3\n"
+        "% comment between entries\n"
+        "\n"
+        "2 2 3.14159265358979\n"
+        "3 1 1e300\n"
+        "3 5 -.5\n"
+        "4 4 123456789012345678901234\n"
+        "4 2 +7.\n"
+        "2 2 0.1\n",
+        // Case insensitive banner, DOS line endings, no final newline
+        "%%MatrixMarket MATRIX Coordinate Real General\r\n"
+        "2 2 2\r\n"
+        "1 2 0.30000000000000004\r\n"
+        "2 1 1E-5",
+        // Integer symmetric, mirrored entries
+        "%%MatrixMarket matrix coordinate integer symmetric\n"
+        "% symmetric\n"
+        "3 3 4\n"
+        "1 1 2\n"
+        "2 1 -1\n"
+        "3 2 -1\n"
+        "3 3 2\n",
+        // Pattern general, values are one
+        "%%MatrixMarket matrix coordinate pattern general\n"
+        "3 4 3\n"
+        "1 4\n"
+        "2 1\n"
+        "3 3\n",
+        // Pattern symmetric without diagonal
+        "%%MatrixMarket matrix coordinate pattern symmetric\n"
+        "3 3 2\n"
+        "2 1\n"
+        "3 1\n"};
+
+    scoped_temp_dir dir;
+    scoped_env env;
+
+    env.set("ROCSPARSE_MTX_CACHE", "0");
+
+    for(size_t i = 0; i < sizeof(text) / sizeof(text[0]); ++i)
+    {
+        std::string filename = dir.path + "/header" + std::to_string(i) + ".mtx";
+
+        mtx_write(filename, text[i]);
+        mtx_check_file(filename);
+    }
+}
+
+TEST(mtx_reader, chunks)
+{
+    // Lines of varying length with comments and blank lines in between, such that the chunk
+    // boundaries of the threads fall into the middle of entry, comment and blank lines
+    std::ostringstream text;
+
+    rocsparse_int m       = 37;
+    rocsparse_int n       = 41;
+    rocsparse_int entries = 500;
+
+    text << "%%MatrixMarket matrix coordinate real general\n";
+    text << m << " " << n << " " << entries << "\n";
+
+    for(rocsparse_int k = 0; k < entries; ++k)
+    {
+        rocsparse_int i = (k * 7) % m + 1;
+        rocsparse_int j = (k * 13) % n + 1;
+
+        if(k % 17 == 0)
+        {
+            text << "% comment " << k << "\n";
+        }
+
+        if(k % 23 == 0)
+        {
+            text << "  \n";
+        }
+
+        switch(k % 4)
+        {
+        case 0: text << i << " " << j << " " << k << "\n"; break;
+        case 1: text << i << " " << j << " " << -1.0 / (k + 1) << "\n"; break;
+        case 2: text << "  " << i << "\t" << j << "  " << k * 1.234567890123e-7 << "  \n"; break;
+        default: text << i << " " << j << " " << 1.0 / 3.0 * k << "e10\n"; break;
+        }
+    }
+
+    scoped_temp_dir dir;
+    std::string filename = dir.path + "/chunks.mtx";
+
+    mtx_write(filename, text.str());
+
+    mtx_reference A;
+    ASSERT_TRUE(read_mtx_reference(filename, A));
+    ASSERT_EQ(A.nnz, entries);
+
+    // More threads than lines leaves empty chunks
+    int nthreads[] = {1, 2, 3, 5, 7, 8, 13, 16, 64, 1000};
+
+    for(size_t t = 0; t < sizeof(nthreads) / sizeof(nthreads[0]); ++t)
+    {
+        mtx_check_parse(text.str(), nthreads[t], A);
+    }
+}
+
+TEST(mtx_reader, bad_file)
+{
+    const char* text[] = {
+        // Not a MatrixMarket file
+        "4 4 1\n1 1 1.0\n",
+        // Dense array format
+        "%%MatrixMarket matrix array real general\n2 2\n1.0\n2.0\n3.0\n4.0\n",
+        // Fewer entries than announced
+        "%%MatrixMarket matrix coordinate real general\n2 2 3\n1 1 1.0\n2 2 1.0\n",
+        // More entries than announced
+        "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1 1.0\n2 2 1.0\n",
+        // Index out of range
+        "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1.0\n",
+        // Missing value
+        "%%MatrixMarket matrix coordinate real general\n2 2 1\n1 1\n"};
+
+    for(size_t i = 0; i < sizeof(text) / sizeof(text[0]); ++i)
+    {
+        mtx_csr_matrix mtx;
+        std::string str = text[i];
+
+        EXPECT_NE(parse_mtx_csr(str.data(), str.size(), 1, mtx), 0) << str;
+        EXPECT_NE(parse_mtx_csr(str.data(), str.size(), 4, mtx), 0) << str;
+    }
+}
+
+TEST(mtx_reader, cache)
+{
+    // Both files have the same size, such that only the modification time tells them apart
+    std::string old_text = "%%MatrixMarket matrix coordinate real general\n"
+                           "2 2 2\n1 1 1.0\n2 2 2.0\n";
+    std::string new_text = "%%MatrixMarket matrix coordinate real general\n"
+                           "2 2 2\n1 1 3.0\n2 2 4.0\n";
+
+    std::vector<double> old_val = {1.0, 2.0};
+    std::vector<double> new_val = {3.0, 4.0};
+
+    scoped_temp_dir dir;
+    scoped_env env;
+
+    std::string filename = dir.path + "/cache.mtx";
+    std::string cache    = filename + ".rsmc";
+
+    // Disabled cache is neither read nor written
+    env.set("ROCSPARSE_MTX_CACHE", "0");
+
+    mtx_write(filename, old_text);
+    mtx_touch(filename, -100);
+
+    EXPECT_EQ(mtx_values(filename), old_val);
+    EXPECT_FALSE(mtx_exists(cache));
+
+    // First read writes the cache
+    env.set("ROCSPARSE_MTX_CACHE", "1");
+
+    EXPECT_EQ(mtx_values(filename), old_val);
+    ASSERT_TRUE(mtx_exists(cache));
+
+    // Same size and modification time, the cache is used even though the content changed
+    mtx_write(filename, new_text);
+    mtx_touch(filename, -100);
+
+    EXPECT_EQ(mtx_values(filename), old_val);
+
+    // Modification time changed, the cache is stale and gets rewritten
+    mtx_touch(filename, -50);
+
+    EXPECT_EQ(mtx_values(filename), new_val);
+    EXPECT_EQ(mtx_values(filename), new_val);
+    mtx_check_file(filename);
+
+    // Size changed, the cache is stale
+    mtx_write(filename, old_text + "% trailing comment\n");
+    mtx_touch(filename, -50);
+
+    EXPECT_EQ(mtx_values(filename), old_val);
+
+    // Corrupt cache is ignored
+    mtx_write(cache, "corrupt");
+
+    EXPECT_EQ(mtx_values(filename), old_val);
+}
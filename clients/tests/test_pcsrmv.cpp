@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing_pcsrmv.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, int, double, double, base> pcsrmv_tuple;
+
+// Column ranges of 200, 4441 and 100000 require 8, 16 and 32 bit column deltas
+int pcsrmv_M_range[] = {-1, 0, 500, 7111};
+int pcsrmv_N_range[] = {-3, 0, 200, 4441, 100000};
+
+std::vector<double> pcsrmv_alpha_range = {2.0, 3.0};
+std::vector<double> pcsrmv_beta_range  = {0.0, 1.0};
+
+base pcsrmv_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_pcsrmv : public testing::TestWithParam<pcsrmv_tuple>
+{
+    protected:
+    parameterized_pcsrmv() {}
+    virtual ~parameterized_pcsrmv() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_pcsrmv_arguments(pcsrmv_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.alpha    = std::get<2>(tup);
+    arg.beta     = std::get<3>(tup);
+    arg.idx_base = std::get<4>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+TEST(pcsrmv_bad_arg, pcsrmv_float) { testing_pcsrmv_bad_arg<float>(); }
+
+TEST_P(parameterized_pcsrmv, pcsrmv_float)
+{
+    Arguments arg = setup_pcsrmv_arguments(GetParam());
+
+    rocsparse_status status = testing_pcsrmv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_pcsrmv, pcsrmv_double)
+{
+    Arguments arg = setup_pcsrmv_arguments(GetParam());
+
+    rocsparse_status status = testing_pcsrmv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(pcsrmv,
+                        parameterized_pcsrmv,
+                        testing::Combine(testing::ValuesIn(pcsrmv_M_range),
+                                         testing::ValuesIn(pcsrmv_N_range),
+                                         testing::ValuesIn(pcsrmv_alpha_range),
+                                         testing::ValuesIn(pcsrmv_beta_range),
+                                         testing::ValuesIn(pcsrmv_idxbase_range)));
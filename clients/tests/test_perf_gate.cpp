@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "perf_gate.hpp"
+
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <vector>
+
+// Samples start + step * i, i = 0, ..., n - 1
+static std::vector<double> gate_samples(size_t n, double start, double step)
+{
+    std::vector<double> samples(n);
+
+    for(size_t i = 0; i < n; ++i)
+    {
+        samples[i] = start + step * i;
+    }
+
+    return samples;
+}
+
+TEST(perf_gate, exact)
+{
+    // Completely separated samples take the most extreme of all C(n1 + n2, n1) arrangements
+    EXPECT_DOUBLE_EQ(mann_whitney_p({1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}), 1.0 / 20.0);
+    EXPECT_DOUBLE_EQ(mann_whitney_p({1.0, 2.0, 3.0, 4.0}, {5.0, 6.0, 7.0, 8.0}), 1.0 / 70.0);
+    EXPECT_DOUBLE_EQ(mann_whitney_p({4.0, 5.0, 6.0}, {1.0, 2.0, 3.0}), 1.0);
+
+    // P(U >= 0) covers all arrangements
+    EXPECT_DOUBLE_EQ(mann_whitney_exact_p(5, 7, 0.0), 1.0);
+}
+
+TEST(perf_gate, exact_normal_threshold)
+{
+    // Exact distribution up to GATE_EXACT_LIMIT, the normal approximation beyond
+    std::vector<double> base   = gate_samples(20, 0.0, 1.0);
+    std::vector<double> cur_20 = gate_samples(20, 100.0, 1.0);
+    std::vector<double> cur_21 = gate_samples(21, 100.0, 1.0);
+
+    ASSERT_EQ(20 * 20, GATE_EXACT_LIMIT);
+
+    EXPECT_DOUBLE_EQ(mann_whitney_p(base, cur_20), mann_whitney_exact_p(20, 20, 400.0));
+    EXPECT_DOUBLE_EQ(mann_whitney_p(base, cur_21), mann_whitney_normal_p(21, 20, 420.0, 0.0));
+    EXPECT_NEAR(mann_whitney_exact_p(20, 20, 400.0), 1.0 / 137846528820.0, 1e-20);
+
+    // Both agree to a few thousandths close to the threshold
+    for(double u = 200.0; u <= 300.0; u += 10.0)
+    {
+        EXPECT_NEAR(mann_whitney_exact_p(20, 20, u), mann_whitney_normal_p(20, 20, u, 0.0), 5e-3);
+    }
+}
+
+TEST(perf_gate, ties)
+{
+    // Ties select the normal approximation with tie correction, also for small samples.
+    // Four pairs of ties give sum(t^3 - t) = 24, the current samples have U = 16.
+    double p = mann_whitney_p({1.0, 1.0, 2.0, 2.0}, {3.0, 3.0, 4.0, 4.0});
+
+    EXPECT_DOUBLE_EQ(p, mann_whitney_normal_p(4, 4, 16.0, 24.0));
+    EXPECT_NEAR(p, 0.013259, 1e-6);
+
+    // Identical samples have no variance and are never significant
+    EXPECT_DOUBLE_EQ(mann_whitney_p({1.0, 1.0, 1.0}, {1.0, 1.0, 1.0}), 1.0);
+}
+
+TEST(perf_gate, verdicts)
+{
+    std::vector<double> base = gate_samples(10, 1.0, 0.001);
+
+    double change;
+    double p;
+
+    // Significantly slower beyond tolerance
+    EXPECT_EQ(gate_compare(base, gate_samples(10, 1.2, 0.001), 0.05, 0.05, change, p),
+              gate_status_regression);
+    EXPECT_NEAR(change, 0.2, 1e-2);
+    EXPECT_LT(p, 0.05);
+
+    // Significantly faster beyond tolerance
+    EXPECT_EQ(gate_compare(base, gate_samples(10, 0.8, 0.001), 0.05, 0.05, change, p),
+              gate_status_improved);
+    EXPECT_NEAR(change, -0.2, 1e-2);
+
+    // Significantly slower, but within tolerance
+    EXPECT_EQ(gate_compare(base, gate_samples(10, 1.02, 0.001), 0.05, 0.05, change, p),
+              gate_status_ok);
+    EXPECT_LT(p, 0.05);
+
+    // Slower beyond tolerance, but three samples each cannot reach p < 0.05
+    EXPECT_EQ(gate_compare({1.0, 1.1, 1.2}, {0.9, 1.2, 1.3}, 0.05, 0.05, change, p),
+              gate_status_noise);
+    EXPECT_GE(p, 0.05);
+
+    // Unchanged
+    EXPECT_EQ(gate_compare(base, base, 0.05, 0.05, change, p), gate_status_ok);
+    EXPECT_DOUBLE_EQ(change, 0.0);
+}
+
+TEST(perf_gate, parse_cases)
+{
+    std::string text = "{\"cases\": ["
+                       "{\"matrix\": \"a.mtx\", \"function\": \"csrmv\", \"precision\": \"d\", "
+                       "\"format\": \"csr\", \"samples_msec\": [0.5, 0.25, 1.0]}, "
+                       "{\"matrix\": \"b.mtx\", \"function\": \"csrsv\", \"precision\": \"s\", "
+                       "\"format\": \"csr\", \"samples_msec\": []}]}";
+
+    std::map<std::string, gate_case> cases;
+
+    ASSERT_TRUE(parse_cases(text, cases));
+
+    // Cases without samples are skipped
+    ASSERT_EQ(cases.size(), 1);
+
+    const gate_case& c = cases.begin()->second;
+
+    EXPECT_EQ(c.key, "csrmv d csr a.mtx");
+    EXPECT_EQ(c.msec, std::vector<double>({0.5, 0.25, 1.0}));
+    EXPECT_DOUBLE_EQ(gate_median(c.msec), 0.5);
+
+    // Not a sweep result
+    EXPECT_FALSE(parse_cases("{\"results\": []}", cases));
+    EXPECT_FALSE(parse_cases("{\"cases\": [", cases));
+}
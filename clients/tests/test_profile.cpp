@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_profile.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+typedef rocsparse_index_base base;
+typedef std::tuple<int, base> profile_tuple;
+
+int profile_dim_range[] = {16, 200};
+
+base profile_idxbase_range[] = {rocsparse_index_base_zero, rocsparse_index_base_one};
+
+class parameterized_profile : public testing::TestWithParam<profile_tuple>
+{
+    protected:
+    parameterized_profile() {}
+    virtual ~parameterized_profile() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_profile_arguments(profile_tuple tup)
+{
+    Arguments arg;
+    arg.laplacian = std::get<0>(tup);
+    arg.idx_base  = std::get<1>(tup);
+    arg.timing    = 0;
+    return arg;
+}
+
+TEST(profile_bad_arg, profile)
+{
+    std::unique_ptr<handle_struct> unique_ptr_handle(new handle_struct);
+    rocsparse_handle handle = unique_ptr_handle->handle;
+
+    EXPECT_EQ(rocsparse_write_profile(nullptr, rocsparse_profile_format_json, nullptr),
+              rocsparse_status_invalid_handle);
+    EXPECT_EQ(rocsparse_write_profile(handle, (rocsparse_profile_format)2, nullptr),
+              rocsparse_status_invalid_value);
+    EXPECT_EQ(rocsparse_reset_profile(nullptr), rocsparse_status_invalid_handle);
+}
+
+TEST_P(parameterized_profile, csrmv_float)
+{
+    Arguments arg = setup_profile_arguments(GetParam());
+
+    rocsparse_status status = testing_profile_csrmv<float>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_profile, csrmv_double)
+{
+    Arguments arg = setup_profile_arguments(GetParam());
+
+    rocsparse_status status = testing_profile_csrmv<double>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(profile,
+                        parameterized_profile,
+                        testing::Combine(testing::ValuesIn(profile_dim_range),
+                                         testing::ValuesIn(profile_idxbase_range)));
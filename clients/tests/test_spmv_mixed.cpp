@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_spmv_mixed.hpp"
+#include "utility.hpp"
+
+#include <rocsparse.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+
+typedef std::tuple<int, int, double, double, rocsparse_index_base, bool> spmv_mixed_tuple;
+typedef std::tuple<double, double, rocsparse_index_base, bool, std::string> spmv_mixed_bin_tuple;
+
+int spmv_mixed_M_range[] = {10, 500, 7111, 10000};
+int spmv_mixed_N_range[] = {33, 842, 4441, 10000};
+
+std::vector<double> spmv_mixed_alpha_range = {2.0, 3.0};
+std::vector<double> spmv_mixed_beta_range  = {0.0, 1.0};
+
+rocsparse_index_base spmv_mixed_idxbase_range[] = {rocsparse_index_base_zero,
+                                                   rocsparse_index_base_one};
+
+bool spmv_mixed_adaptive[] = {false, true};
+
+std::string spmv_mixed_bin[] = {"rma10.bin", "mac_econ_fwd500.bin", "bmwcra_1.bin", "nos3.bin"};
+
+class parameterized_spmv_mixed : public testing::TestWithParam<spmv_mixed_tuple>
+{
+    protected:
+    parameterized_spmv_mixed() {}
+    virtual ~parameterized_spmv_mixed() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class parameterized_spmv_mixed_bin : public testing::TestWithParam<spmv_mixed_bin_tuple>
+{
+    protected:
+    parameterized_spmv_mixed_bin() {}
+    virtual ~parameterized_spmv_mixed_bin() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+Arguments setup_spmv_mixed_arguments(spmv_mixed_tuple tup)
+{
+    Arguments arg;
+    arg.M        = std::get<0>(tup);
+    arg.N        = std::get<1>(tup);
+    arg.alpha    = std::get<2>(tup);
+    arg.beta     = std::get<3>(tup);
+    arg.idx_base = std::get<4>(tup);
+    arg.bswitch  = std::get<5>(tup);
+    arg.timing   = 0;
+    return arg;
+}
+
+Arguments setup_spmv_mixed_arguments(spmv_mixed_bin_tuple tup)
+{
+    Arguments arg;
+    arg.M        = -99;
+    arg.N        = -99;
+    arg.alpha    = std::get<0>(tup);
+    arg.beta     = std::get<1>(tup);
+    arg.idx_base = std::get<2>(tup);
+    arg.bswitch  = std::get<3>(tup);
+    arg.timing   = 0;
+
+    // Determine absolute path of test matrix
+    std::string bin_file = std::get<4>(tup);
+
+    // Get current executables absolute path
+    char path_exe[PATH_MAX];
+    ssize_t len = readlink("/proc/self/exe", path_exe, sizeof(path_exe) - 1);
+    if(len < 14)
+    {
+        path_exe[0] = '\0';
+    }
+    else
+    {
+        path_exe[len - 14] = '\0';
+    }
+
+    // Matrices are stored at the same path in matrices directory
+    arg.filename = std::string(path_exe) + "matrices/" + bin_file;
+
+    return arg;
+}
+
+TEST(csrmv_mixed_bad_arg, csrmv_half) { testing_csrmv_mixed_bad_arg<rocsparse_half>(); }
+
+TEST(csrmv_mixed_bad_arg, csrmv_bfloat16) { testing_csrmv_mixed_bad_arg<rocsparse_bfloat16>(); }
+
+TEST_P(parameterized_spmv_mixed, csrmv_half)
+{
+    Arguments arg = setup_spmv_mixed_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_mixed<rocsparse_half>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_spmv_mixed, csrmv_bfloat16)
+{
+    Arguments arg = setup_spmv_mixed_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_mixed<rocsparse_bfloat16>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_spmv_mixed, ellmv_half)
+{
+    Arguments arg = setup_spmv_mixed_arguments(GetParam());
+
+    rocsparse_status status = testing_ellmv_mixed<rocsparse_half>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_spmv_mixed, ellmv_bfloat16)
+{
+    Arguments arg = setup_spmv_mixed_arguments(GetParam());
+
+    rocsparse_status status = testing_ellmv_mixed<rocsparse_bfloat16>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_spmv_mixed, hybmv_half)
+{
+    Arguments arg = setup_spmv_mixed_arguments(GetParam());
+
+    rocsparse_status status = testing_hybmv_mixed<rocsparse_half>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_spmv_mixed, hybmv_bfloat16)
+{
+    Arguments arg = setup_spmv_mixed_arguments(GetParam());
+
+    rocsparse_status status = testing_hybmv_mixed<rocsparse_bfloat16>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_spmv_mixed_bin, csrmv_bin_half)
+{
+    Arguments arg = setup_spmv_mixed_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_mixed<rocsparse_half>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+TEST_P(parameterized_spmv_mixed_bin, csrmv_bin_bfloat16)
+{
+    Arguments arg = setup_spmv_mixed_arguments(GetParam());
+
+    rocsparse_status status = testing_csrmv_mixed<rocsparse_bfloat16>(arg);
+    EXPECT_EQ(status, rocsparse_status_success);
+}
+
+INSTANTIATE_TEST_CASE_P(spmv_mixed,
+                        parameterized_spmv_mixed,
+                        testing::Combine(testing::ValuesIn(spmv_mixed_M_range),
+                                         testing::ValuesIn(spmv_mixed_N_range),
+                                         testing::ValuesIn(spmv_mixed_alpha_range),
+                                         testing::ValuesIn(spmv_mixed_beta_range),
+                                         testing::ValuesIn(spmv_mixed_idxbase_range),
+                                         testing::ValuesIn(spmv_mixed_adaptive)));
+
+INSTANTIATE_TEST_CASE_P(spmv_mixed_bin,
+                        parameterized_spmv_mixed_bin,
+                        testing::Combine(testing::ValuesIn(spmv_mixed_alpha_range),
+                                         testing::ValuesIn(spmv_mixed_beta_range),
+                                         testing::ValuesIn(spmv_mixed_idxbase_range),
+                                         testing::ValuesIn(spmv_mixed_adaptive),
+                                         testing::ValuesIn(spmv_mixed_bin)));
@@ -0,0 +1,213 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+// Performance regression gate. Compares stored results of a rocsparse-bench sweep
+// against stored baseline results and fails if a case got significantly slower
+// than its tolerance allows. Never runs the benchmark itself, such that it runs on
+// build hosts without GPU.
+
+#include "perf_gate.hpp"
+
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+/* ============================================================================================ */
+static void usage(const char* name)
+{
+    fprintf(stderr,
+            "%s --baseline <baseline.json> --current <current.json> [options]\n"
+            "  --tolerance <t>    allowed relative slowdown of the median time (default: 0.05)\n"
+            "  --tolerances <f>   per case tolerances, one rule per line:\n"
+            "                     <function> <precision> <matrix> <tolerance>, * matches all\n"
+            "  --alpha <a>        significance level of the Mann-Whitney U test (default: 0.05)\n"
+            "  --functions <l>    comma separated functions to gate (default: all)\n"
+            "  --strict           fail if a baseline case is missing in the current results\n",
+            name);
+}
+
+int main(int argc, char* argv[])
+{
+    const char* baseline_path  = nullptr;
+    const char* current_path   = nullptr;
+    const char* tolerance_path = nullptr;
+    std::string functions;
+    double default_tolerance = 0.05;
+    double alpha             = 0.05;
+    bool strict              = false;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        bool has_value = (i + 1 < argc);
+
+        if(arg == "--baseline" && has_value)
+        {
+            baseline_path = argv[++i];
+        }
+        else if(arg == "--current" && has_value)
+        {
+            current_path = argv[++i];
+        }
+        else if(arg == "--tolerance" && has_value)
+        {
+            default_tolerance = atof(argv[++i]);
+        }
+        else if(arg == "--tolerances" && has_value)
+        {
+            tolerance_path = argv[++i];
+        }
+        else if(arg == "--alpha" && has_value)
+        {
+            alpha = atof(argv[++i]);
+        }
+        else if(arg == "--functions" && has_value)
+        {
+            functions = "," + std::string(argv[++i]) + ",";
+        }
+        else if(arg == "--strict")
+        {
+            strict = true;
+        }
+        else
+        {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if(baseline_path == nullptr || current_path == nullptr)
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    std::map<std::string, gate_case> baseline;
+    std::map<std::string, gate_case> current;
+    std::vector<gate_rule> rules;
+
+    if(!read_cases(baseline_path, baseline) || !read_cases(current_path, current) ||
+       (tolerance_path != nullptr && !read_rules(tolerance_path, rules)))
+    {
+        return 2;
+    }
+
+    int regressions = 0;
+    int missing     = 0;
+
+    printf("%-48s %12s %12s %9s %9s %9s  %s\n",
+           "case",
+           "base msec",
+           "cur msec",
+           "change %",
+           "tol %",
+           "p-value",
+           "status");
+
+    for(std::map<std::string, gate_case>::const_iterator it = baseline.begin();
+        it != baseline.end();
+        ++it)
+    {
+        const gate_case& base = it->second;
+
+        if(!functions.empty() && functions.find("," + base.function + ",") == std::string::npos)
+        {
+            continue;
+        }
+
+        std::map<std::string, gate_case>::const_iterator cur = current.find(it->first);
+
+        if(cur == current.end())
+        {
+            printf("%-48s %12.4lf %12s %9s %9s %9s  %s\n",
+                   base.key.c_str(),
+                   gate_median(base.msec),
+                   "-",
+                   "-",
+                   "-",
+                   "-",
+                   "missing");
+            ++missing;
+            continue;
+        }
+
+        double base_median = gate_median(base.msec);
+        double cur_median  = gate_median(cur->second.msec);
+        double tol         = gate_tolerance(rules, base, default_tolerance);
+        double change;
+        double p;
+
+        gate_status status = gate_compare(base.msec, cur->second.msec, tol, alpha, change, p);
+
+        if(status == gate_status_regression)
+        {
+            ++regressions;
+        }
+
+        printf("%-48s %12.4lf %12.4lf %+9.2lf %9.2lf %9.4lf  %s\n",
+               base.key.c_str(),
+               base_median,
+               cur_median,
+               100.0 * change,
+               100.0 * tol,
+               p,
+               gate_status_string(status));
+    }
+
+    for(std::map<std::string, gate_case>::const_iterator it = current.begin();
+        it != current.end();
+        ++it)
+    {
+        const gate_case& cur = it->second;
+
+        if(!functions.empty() && functions.find("," + cur.function + ",") == std::string::npos)
+        {
+            continue;
+        }
+
+        if(baseline.find(it->first) == baseline.end())
+        {
+            printf("%-48s %12s %12.4lf %9s %9s %9s  %s\n",
+                   it->first.c_str(),
+                   "-",
+                   gate_median(cur.msec),
+                   "-",
+                   "-",
+                   "-",
+                   "new");
+        }
+    }
+
+    if(regressions > 0 || (strict && missing > 0))
+    {
+        printf("\nFAILED: %d regression(s), %d missing case(s)\n", regressions, missing);
+        return 1;
+    }
+
+    printf("\nPASSED\n");
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// Decoder for the binary trace written by the log_binary layer. Reproduces the
+// text that the log_trace and log_bench layers write for the same calls.
+
+#include "trace_decode.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+static void usage(const char* name)
+{
+    fprintf(stderr,
+            "%s [-k trace|bench] [-t] <trace.bin>\n"
+            "  -k  kind of records to decode (default: trace)\n"
+            "  -t  prefix records with thread id and time stamp in nanoseconds\n",
+            name);
+}
+
+int main(int argc, char* argv[])
+{
+    std::string kind = "trace";
+    bool timestamps  = false;
+    const char* path = NULL;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        if(strcmp(argv[i], "-k") == 0 && i + 1 < argc)
+        {
+            kind = argv[++i];
+        }
+        else if(strcmp(argv[i], "-t") == 0)
+        {
+            timestamps = true;
+        }
+        else if(argv[i][0] != '-' && path == NULL)
+        {
+            path = argv[i];
+        }
+        else
+        {
+            usage(argv[0]);
+            return -1;
+        }
+    }
+
+    if(path == NULL || (kind != "trace" && kind != "bench"))
+    {
+        usage(argv[0]);
+        return -1;
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    if(!in.good() && !in.eof())
+    {
+        fprintf(stderr, "Cannot read %s\n", path);
+        return -1;
+    }
+
+    return trace_decode(data,
+                        (kind == "trace") ? rocsparse_trace_kind_trace : rocsparse_trace_kind_bench,
+                        timestamps,
+                        std::cout);
+}
@@ -173,6 +173,118 @@ ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle handle,
                                             rocsparse_pointer_mode* pointer_mode);
 
+/*! \ingroup aux_module
+ *  \brief Specify user defined device memory allocator
+ *
+ *  \details
+ *  \p rocsparse_set_allocator specifies the callbacks that are used by the rocSPARSE
+ *  library context to allocate and release device memory, e.g. for meta data gathered
+ *  by analysis functions, converted matrices and the library context workspace. If
+ *  \p malloc_func and \p free_func are \p NULL, the default allocator, based on
+ *  \p hipMalloc and \p hipFree, is restored.
+ *
+ *  Temporary buffers of library calls are served from a workspace that is owned by
+ *  the library context. The workspace grows to the largest amount of temporary memory
+ *  that has been required by a single call, such that subsequent calls do not allocate
+ *  device memory. Memory that has been obtained from a previous allocator is released
+ *  with the same allocator.
+ *
+ *  \note
+ *  The workspace is reused in stream order. If the stream of the library context is
+ *  changed, rocsparse_set_stream() waits for the previous stream to finish.
+ *
+ *  @param[inout]
+ *  handle      the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  malloc_func device memory allocation callback.
+ *  @param[in]
+ *  free_func   device memory release callback.
+ *  @param[in]
+ *  user_data   pointer that is passed to \p malloc_func and \p free_func.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer only one of \p malloc_func and
+ *          \p free_func is \p NULL.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_allocator(rocsparse_handle handle,
+                                         rocsparse_device_malloc malloc_func,
+                                         rocsparse_device_free free_func,
+                                         void* user_data);
+
+/*! \ingroup aux_module
+ *  \brief Get device memory statistics of the library context
+ *
+ *  \details
+ *  \p rocsparse_get_memory_stats returns the current workspace size, the workspace
+ *  high water mark and the number of device allocations of the rocSPARSE library
+ *  context.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  stats   the device memory statistics.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p stats pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_memory_stats(rocsparse_handle handle,
+                                            rocsparse_memory_stats* stats);
+
+/*! \ingroup aux_module
+ *  \brief Write the profile of the library context
+ *
+ *  \details
+ *  \p rocsparse_write_profile writes the summary that has been collected by the
+ *  profiling layer, see \ref rocsparse_layer_mode_log_profile. For each routine,
+ *  precision and matrix shape, the summary contains the number of calls, the total,
+ *  minimum, maximum and percentile device times, the average host time and the
+ *  bandwidth estimated from the bytes moved by the routine. The JSON summary also
+ *  lists the non-empty buckets of the log scale time histogram. If the profiling layer
+ *  is not active, the summary is empty.
+ *
+ *  \note
+ *  The device time of a call is measured with events that are recorded into the
+ *  stream of the library context. \p rocsparse_write_profile waits for all calls
+ *  that are still pending.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  format  \ref rocsparse_profile_format_table or \ref rocsparse_profile_format_json.
+ *  @param[in]
+ *  path    file the summary is written to. If \p NULL, the summary is written to the
+ *          file given by \p ROCSPARSE_LOG_PROFILE_PATH, or to \p stderr.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_value \p format is invalid or \p path cannot be
+ *          opened.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_write_profile(rocsparse_handle handle,
+                                         rocsparse_profile_format format,
+                                         const char* path);
+
+/*! \ingroup aux_module
+ *  \brief Reset the profile of the library context
+ *
+ *  \details
+ *  \p rocsparse_reset_profile discards the summary that has been collected by the
+ *  profiling layer, e.g. to exclude a setup phase from the profile.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_reset_profile(rocsparse_handle handle);
+
 /*! \ingroup aux_module
  *  \brief Get rocSPARSE version
  *
@@ -435,6 +547,92 @@ rocsparse_status rocsparse_create_hyb_mat(rocsparse_hyb_mat* hyb);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb);
 
+/*! \ingroup aux_module
+ *  \brief Specify the value update type of a \p HYB matrix structure
+ *
+ *  \details
+ *  \p rocsparse_set_hyb_mat_update sets the value update type of a \p HYB matrix
+ *  structure. If set to \ref rocsparse_hyb_update_values, subsequent conversions using
+ *  rocsparse_csr2hyb() store the mapping of CSR entries into the \p HYB matrix, such
+ *  that its values can be updated using rocsparse_csr2hyb_update(). Valid options are
+ *  \ref rocsparse_hyb_update_full or \ref rocsparse_hyb_update_values.
+ *
+ *  @param[inout]
+ *  hyb     the hybrid matrix structure.
+ *  @param[in]
+ *  update  \ref rocsparse_hyb_update_full or \ref rocsparse_hyb_update_values.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p hyb pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p update is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_hyb_mat_update(rocsparse_hyb_mat hyb, rocsparse_hyb_update update);
+
+/*! \ingroup aux_module
+ *  \brief Get the value update type of a \p HYB matrix structure
+ *
+ *  \details
+ *  \p rocsparse_get_hyb_mat_update returns the value update type of a \p HYB matrix
+ *  structure.
+ *
+ *  @param[in]
+ *  hyb     the hybrid matrix structure.
+ *
+ *  \returns \ref rocsparse_hyb_update_full or \ref rocsparse_hyb_update_values.
+ */
+ROCSPARSE_EXPORT
+rocsparse_hyb_update rocsparse_get_hyb_mat_update(const rocsparse_hyb_mat hyb);
+
+/*! \ingroup aux_module
+ *  \brief Create a \p PCSR matrix structure
+ *
+ *  \details
+ *  \p rocsparse_create_pcsr_mat creates a structure that holds the matrix in \p PCSR
+ *  storage format. It should be destroyed at the end using
+ *  rocsparse_destroy_pcsr_mat().
+ *
+ *  @param[inout]
+ *  pcsr the pointer to the packed CSR matrix.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p pcsr pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_create_pcsr_mat(rocsparse_pcsr_mat* pcsr);
+
+/*! \ingroup aux_module
+ *  \brief Destroy a \p PCSR matrix structure
+ *
+ *  \details
+ *  \p rocsparse_destroy_pcsr_mat destroys a \p PCSR structure.
+ *
+ *  @param[in]
+ *  pcsr the packed CSR matrix structure.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p pcsr pointer is invalid.
+ *  \retval rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_destroy_pcsr_mat(rocsparse_pcsr_mat pcsr);
+
+/*! \ingroup aux_module
+ *  \brief Get the column delta size of a \p PCSR matrix structure
+ *
+ *  \details
+ *  \p rocsparse_get_pcsr_mat_delta_size returns the number of bytes that are stored
+ *  per non-zero entry to represent its column index, as selected by
+ *  rocsparse_csr2pcsr().
+ *
+ *  @param[in]
+ *  pcsr    the packed CSR matrix structure.
+ *
+ *  \returns 1, 2 or 4 for a converted matrix, 0 otherwise.
+ */
+ROCSPARSE_EXPORT
+rocsparse_int rocsparse_get_pcsr_mat_delta_size(const rocsparse_pcsr_mat pcsr);
+
 /*! \ingroup aux_module
  *  \brief Create a matrix info structure
  *
@@ -468,6 +666,105 @@ rocsparse_status rocsparse_create_mat_info(rocsparse_mat_info* info);
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info);
 
+/*! \ingroup aux_module
+ *  \brief Specify the number of sweeps of the iterative solve policy
+ *
+ *  \details
+ *  \p rocsparse_set_mat_info_sweeps sets the number of fixed-point sweeps that are
+ *  performed by rocsparse_csrilu0() and by each triangular solve, e.g.
+ *  rocsparse_csrsv_solve(), with \ref rocsparse_solve_policy_iterative. Valid
+ *  numbers are at least 1. Default values are 5 sweeps for the factorization and 3
+ *  sweeps for the triangular solves.
+ *
+ *  @param[inout]
+ *  info            the matrix info structure.
+ *  @param[in]
+ *  csrilu0_sweeps  number of sweeps of the incomplete LU factorization.
+ *  @param[in]
+ *  csrsv_sweeps    number of sweeps of each triangular solve.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval rocsparse_status_invalid_size \p csrilu0_sweeps or \p csrsv_sweeps is
+ *          invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_mat_info_sweeps(rocsparse_mat_info info,
+                                               rocsparse_int csrilu0_sweeps,
+                                               rocsparse_int csrsv_sweeps);
+
+/*! \ingroup aux_module
+ *  \brief Get the number of sweeps of the iterative solve policy
+ *
+ *  \details
+ *  \p rocsparse_get_mat_info_sweeps returns the number of fixed-point sweeps that are
+ *  performed with \ref rocsparse_solve_policy_iterative.
+ *
+ *  @param[in]
+ *  info            the matrix info structure.
+ *  @param[out]
+ *  csrilu0_sweeps  number of sweeps of the incomplete LU factorization.
+ *  @param[out]
+ *  csrsv_sweeps    number of sweeps of each triangular solve.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p info, \p csrilu0_sweeps or
+ *          \p csrsv_sweeps pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_mat_info_sweeps(const rocsparse_mat_info info,
+                                               rocsparse_int* csrilu0_sweeps,
+                                               rocsparse_int* csrsv_sweeps);
+
+/*! \ingroup aux_module
+ *  \brief Specify the frontier density at which rocsparse_cscmspv switches to pull
+ *
+ *  \details
+ *  \p rocsparse_set_mat_info_cscmspv_threshold sets the density \p x_nnz / \p n of
+ *  the sparse vector at and above which rocsparse_scscmspv() and rocsparse_dcscmspv()
+ *  gather all rows of the matrix from a dense copy of the vector (pull), instead of
+ *  scattering the columns of its non-zero entries (push). A threshold of 0 always
+ *  selects pull, a threshold larger than 1 always selects push. The default
+ *  threshold is 0.05.
+ *
+ *  @param[inout]
+ *  info        the matrix info structure.
+ *  @param[in]
+ *  threshold   frontier density at which pull is used.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p threshold is negative.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_mat_info_cscmspv_threshold(rocsparse_mat_info info,
+                                                          double threshold);
+
+/*! \ingroup aux_module
+ *  \brief Specify when the sparsity pattern is validated during execution
+ *
+ *  \details
+ *  \p rocsparse_set_mat_info_pattern_check sets whether functions that require analysis
+ *  meta data re-compute the fingerprint of the sparsity pattern only if the matrix
+ *  arrays have been moved since the last call (default), or on every call. The latter
+ *  detects sparsity patterns that have been modified in place, at the cost of hashing
+ *  the row pointer and column index arrays and a synchronization with the host per
+ *  call. Calls with a pattern that does not match the analysed pattern return
+ *  \ref rocsparse_status_invalid_pointer.
+ *
+ *  @param[inout]
+ *  info    the matrix info structure.
+ *  @param[in]
+ *  check   \ref rocsparse_pattern_check_moved or \ref rocsparse_pattern_check_always.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval rocsparse_status_invalid_value \p check is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_mat_info_pattern_check(rocsparse_mat_info info,
+                                                      rocsparse_pattern_check check);
+
 #ifdef __cplusplus
 }
 #endif
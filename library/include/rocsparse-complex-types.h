@@ -0,0 +1,181 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+/*! \file
+ * \brief rocsparse-complex-types.h defines the complex data types used by rocsparse
+ */
+
+#pragma once
+#ifndef _ROCSPARSE_COMPLEX_TYPES_H_
+#define _ROCSPARSE_COMPLEX_TYPES_H_
+
+#if !defined(__cplusplus)
+
+/*! \ingroup types_module
+ *  \brief Single precision complex number.
+ *
+ *  \details
+ *  \ref rocsparse_float_complex holds the real part in \p x and the imaginary part
+ *  in \p y.
+ */
+typedef struct
+{
+    float x, y;
+} rocsparse_float_complex;
+
+/*! \ingroup types_module
+ *  \brief Double precision complex number.
+ *
+ *  \details
+ *  \ref rocsparse_double_complex holds the real part in \p x and the imaginary part
+ *  in \p y.
+ */
+typedef struct
+{
+    double x, y;
+} rocsparse_double_complex;
+
+#else // __cplusplus
+
+#include <math.h>
+
+#if defined(__HIPCC__)
+#include <hip/hip_runtime.h>
+#define ROCSPARSE_HOST_DEVICE __host__ __device__
+#else
+#define ROCSPARSE_HOST_DEVICE
+#endif
+
+// In C++, the complex types are classes with the same memory layout as their C
+// counterparts, providing the arithmetic that is required by the templated kernels
+// and host reference code.
+template <typename T>
+class rocsparse_complex_num
+{
+public:
+    T x; // real part
+    T y; // imaginary part
+
+    // Keep the default constructor trivial, such that the type can be placed in
+    // shared memory
+    rocsparse_complex_num() = default;
+
+    ROCSPARSE_HOST_DEVICE constexpr rocsparse_complex_num(T r, T i = static_cast<T>(0))
+        : x(r)
+        , y(i)
+    {
+    }
+
+    ROCSPARSE_HOST_DEVICE constexpr T real() const { return x; }
+    ROCSPARSE_HOST_DEVICE constexpr T imag() const { return y; }
+
+    ROCSPARSE_HOST_DEVICE rocsparse_complex_num& operator+=(const rocsparse_complex_num& rhs)
+    {
+        x += rhs.x;
+        y += rhs.y;
+        return *this;
+    }
+
+    ROCSPARSE_HOST_DEVICE rocsparse_complex_num& operator-=(const rocsparse_complex_num& rhs)
+    {
+        x -= rhs.x;
+        y -= rhs.y;
+        return *this;
+    }
+
+    ROCSPARSE_HOST_DEVICE rocsparse_complex_num& operator*=(const rocsparse_complex_num& rhs)
+    {
+        T re = x * rhs.x - y * rhs.y;
+        y    = x * rhs.y + y * rhs.x;
+        x    = re;
+        return *this;
+    }
+
+    ROCSPARSE_HOST_DEVICE rocsparse_complex_num& operator/=(const rocsparse_complex_num& rhs)
+    {
+        T den = rhs.x * rhs.x + rhs.y * rhs.y;
+        T re  = (x * rhs.x + y * rhs.y) / den;
+        y     = (y * rhs.x - x * rhs.y) / den;
+        x     = re;
+        return *this;
+    }
+
+    // Operators are defined as friends, such that real scalars convert implicitly
+    // on either side
+    friend ROCSPARSE_HOST_DEVICE rocsparse_complex_num operator+(rocsparse_complex_num lhs,
+                                                                 const rocsparse_complex_num& rhs)
+    {
+        return lhs += rhs;
+    }
+
+    friend ROCSPARSE_HOST_DEVICE rocsparse_complex_num operator-(rocsparse_complex_num lhs,
+                                                                 const rocsparse_complex_num& rhs)
+    {
+        return lhs -= rhs;
+    }
+
+    friend ROCSPARSE_HOST_DEVICE rocsparse_complex_num operator*(rocsparse_complex_num lhs,
+                                                                 const rocsparse_complex_num& rhs)
+    {
+        return lhs *= rhs;
+    }
+
+    friend ROCSPARSE_HOST_DEVICE rocsparse_complex_num operator/(rocsparse_complex_num lhs,
+                                                                 const rocsparse_complex_num& rhs)
+    {
+        return lhs /= rhs;
+    }
+
+    friend ROCSPARSE_HOST_DEVICE rocsparse_complex_num operator-(const rocsparse_complex_num& z)
+    {
+        return rocsparse_complex_num(-z.x, -z.y);
+    }
+
+    friend ROCSPARSE_HOST_DEVICE bool operator==(const rocsparse_complex_num& lhs,
+                                                 const rocsparse_complex_num& rhs)
+    {
+        return lhs.x == rhs.x && lhs.y == rhs.y;
+    }
+
+    friend ROCSPARSE_HOST_DEVICE bool operator!=(const rocsparse_complex_num& lhs,
+                                                 const rocsparse_complex_num& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    // Fused multiply add, a * b + c
+    friend ROCSPARSE_HOST_DEVICE rocsparse_complex_num fma(const rocsparse_complex_num& a,
+                                                           const rocsparse_complex_num& b,
+                                                           const rocsparse_complex_num& c)
+    {
+        return rocsparse_complex_num(fma(-a.y, b.y, fma(a.x, b.x, c.x)),
+                                     fma(a.y, b.x, fma(a.x, b.y, c.y)));
+    }
+};
+
+typedef rocsparse_complex_num<float>  rocsparse_float_complex;
+typedef rocsparse_complex_num<double> rocsparse_double_complex;
+
+#endif // __cplusplus
+
+#endif // _ROCSPARSE_COMPLEX_TYPES_H_
@@ -559,7 +559,14 @@ rocsparse_status rocsparse_zsctr(rocsparse_handle handle,
  *  It may return before the actual computation has finished.
  *
  *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *  If \p coo_val is \p NULL, every entry of the matrix is one. Such pattern only
+ *  matrices, e.g. the adjacency matrix of an unweighted graph, are processed without
+ *  loading any values.
+ *
+ *  \note
+ *  For \p trans != \ref rocsparse_operation_none, the contributions of each entry are
+ *  accumulated into \p y using atomic operations. The order of the summation is thus
+ *  not deterministic.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -577,7 +584,8 @@ rocsparse_status rocsparse_zsctr(rocsparse_handle handle,
  *  descr       descriptor of the sparse COO matrix. Currently, only
  *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  coo_val     array of \p nnz elements of the sparse COO matrix.
+ *  coo_val     array of \p nnz elements of the sparse COO matrix, or \p NULL for a
+ *              pattern only matrix.
  *  @param[in]
  *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
  *              matrix.
@@ -600,7 +608,6 @@ rocsparse_status rocsparse_zsctr(rocsparse_handle handle,
  *              \p coo_row_ind, \p coo_col_ind, \p x, \p beta or \p y pointer is invalid.
  *  \retval     rocsparse_status_arch_mismatch the device is not supported.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
@@ -633,7 +640,6 @@ rocsparse_status rocsparse_dcoomv(rocsparse_handle handle,
                                   const double* x,
                                   const double* beta,
                                   double* y);
-/*
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_ccoomv(rocsparse_handle handle,
                                   rocsparse_operation trans,
@@ -663,7 +669,106 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle handle,
                                   const rocsparse_double_complex* x,
                                   const rocsparse_double_complex* beta,
                                   rocsparse_double_complex* y);
-*/
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication over a semiring using COO storage format
+ *
+ *  \details
+ *  \p rocsparse_coomv_semiring multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times n\f$ matrix, defined in COO storage format, and the dense vector \f$x\f$
+ *  and adds the result to the dense vector \f$y\f$ that is multiplied by the scalar
+ *  \f$\beta\f$, where addition and multiplication are replaced by the operations
+ *  \f$\oplus\f$ and \f$\otimes\f$ of the \ref rocsparse_semiring, such that
+ *  \f[
+ *    y := \alpha \otimes op(A) \otimes x \oplus \beta \otimes y.
+ *  \f]
+ *  If \f$\beta\f$ is the additive identity of the semiring, \f$y\f$ is not read. If
+ *  \p coo_val is \p NULL, every stored entry of the matrix is the multiplicative
+ *  identity, such that the sparsity pattern of e.g. an unweighted graph can be used
+ *  directly.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  semiring    semiring \ref rocsparse_semiring.
+ *  @param[in]
+ *  m           number of rows of the sparse COO matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse COO matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse COO matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse COO matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  coo_val     array of \p nnz elements of the sparse COO matrix, or \p NULL for a
+ *              pattern only matrix.
+ *  @param[in]
+ *  coo_row_ind array of \p nnz elements containing the row indices of the sparse COO
+ *              matrix.
+ *  @param[in]
+ *  coo_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              COO matrix.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) = A\f$) or \p m elements
+ *              (\f$op(A) = A^T\f$ or \f$op(A) = A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) = A\f$) or \p n elements
+ *              (\f$op(A) = A^T\f$ or \f$op(A) = A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p semiring is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p coo_row_ind,
+ *              \p coo_col_ind, \p x, \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scoomv_semiring(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           rocsparse_semiring semiring,
+                                           rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int nnz,
+                                           const float* alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float* coo_val,
+                                           const rocsparse_int* coo_row_ind,
+                                           const rocsparse_int* coo_col_ind,
+                                           const float* x,
+                                           const float* beta,
+                                           float* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcoomv_semiring(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           rocsparse_semiring semiring,
+                                           rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int nnz,
+                                           const double* alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double* coo_val,
+                                           const rocsparse_int* coo_row_ind,
+                                           const rocsparse_int* coo_col_ind,
+                                           const double* x,
+                                           const double* beta,
+                                           double* y);
 /**@}*/
 
 /*! \ingroup level2_module
@@ -677,6 +782,10 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle handle,
  *
  *  \note
  *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *  Matrices whose arrays have been moved are validated against the analysed sparsity
+ *  pattern during execution. A sparsity pattern that is modified in place, using the
+ *  same arrays, is only detected with \ref rocsparse_pattern_check_always, see
+ *  rocsparse_set_mat_info_pattern_check().
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -695,7 +804,8 @@ rocsparse_status rocsparse_zcoomv(rocsparse_handle handle,
  *  @param[in]
  *  descr       descriptor of the sparse CSR matrix.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix, or \p NULL for a
+ *              pattern only matrix.
  *  @param[in]
  *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
  *              sparse CSR matrix.
@@ -772,6 +882,254 @@ rocsparse_status rocsparse_dcsrmv_analysis(rocsparse_handle handle,
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_info info);
 
+/*! \ingroup level2_module
+ *  \brief Sparse matrix sparse vector multiplication using CSC storage format
+ *
+ *  \details
+ *  \p rocsparse_cscmspv_analysis performs the analysis step for rocsparse_scscmspv()
+ *  and rocsparse_dcscmspv(). It builds the row wise sparsity pattern of the matrix,
+ *  that is required to process dense frontiers, and allocates the sparse accumulator
+ *  of the result. It is expected that this function will be executed only once for a
+ *  given sparsity pattern. The gathered analysis meta data can be cleared by
+ *  rocsparse_cscmspv_clear().
+ *
+ *  \note
+ *  The analysis only depends on the sparsity pattern and can be used for both
+ *  precisions.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSC matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSC matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSC matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSC matrix.
+ *  @param[in]
+ *  csc_col_ptr array of \p n+1 elements that point to the start of every column of
+ *              the sparse CSC matrix.
+ *  @param[in]
+ *  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
+ *              matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis
+ *              step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csc_col_ptr,
+ *              \p csc_row_ind or \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the gathered information
+ *              could not be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cscmspv_analysis(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int n,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_int* csc_col_ptr,
+                                            const rocsparse_int* csc_row_ind,
+                                            rocsparse_mat_info info);
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix sparse vector multiplication using CSC storage format
+ *
+ *  \details
+ *  \p rocsparse_cscmspv multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times n\f$ matrix, defined in CSC storage format, and the sparse vector
+ *  \f$x\f$, where addition and multiplication are replaced by the operations
+ *  \f$\oplus\f$ and \f$\otimes\f$ of the \ref rocsparse_semiring, such that
+ *  \f[
+ *    y := \alpha \otimes A \otimes x.
+ *  \f]
+ *  The sparse vector \f$x\f$ is given by \p x_nnz values \p x_val and their indices
+ *  \p x_ind, as for the level 1 routines. The result \f$y\f$ is again a sparse
+ *  vector that holds an entry for each row of \f$A\f$ with at least one stored entry
+ *  in the columns of \p x_ind. Its \p y_nnz indices are returned in ascending order.
+ *  If \p csc_val is \p NULL, every stored entry of the matrix is the multiplicative
+ *  identity. If \p x_val is \p NULL, every entry of \f$x\f$ is the multiplicative
+ *  identity, such that e.g. a breadth first search frontier can be passed by its
+ *  indices only. If \p y_val is \p NULL, only the indices of \f$y\f$ are computed.
+ *
+ *  Depending on the density \p x_nnz / \p n of \f$x\f$, either the columns of
+ *  \p x_ind are scattered into the sparse accumulator (push), or all rows of the
+ *  matrix are gathered from a dense copy of \f$x\f$ (pull). Pull is used at and above
+ *  the density that is set by rocsparse_set_mat_info_cscmspv_threshold(). The work of
+ *  push is proportional to the number of entries in the columns of \p x_ind, such
+ *  that very sparse frontiers do not touch the remaining matrix.
+ *
+ *  \note
+ *  \p x_ind must not contain duplicate indices. The index base of \p x_ind and
+ *  \p y_ind is the index base of \p descr.
+ *
+ *  \note
+ *  This function is blocking with respect to the host, as the number of entries of
+ *  the result is required to sort its indices.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  semiring    semiring \ref rocsparse_semiring.
+ *  @param[in]
+ *  m           number of rows of the sparse CSC matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSC matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSC matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSC matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csc_val     array of \p nnz elements of the sparse CSC matrix, or \p NULL for a
+ *              pattern only matrix.
+ *  @param[in]
+ *  csc_col_ptr array of \p n+1 elements that point to the start of every column of
+ *              the sparse CSC matrix.
+ *  @param[in]
+ *  csc_row_ind array of \p nnz elements containing the row indices of the sparse CSC
+ *              matrix.
+ *  @param[in]
+ *  info        information collected by rocsparse_cscmspv_analysis().
+ *  @param[in]
+ *  x_nnz       number of non-zero entries of \f$x\f$.
+ *  @param[in]
+ *  x_val       array of \p x_nnz elements containing the values of \f$x\f$, or
+ *              \p NULL.
+ *  @param[in]
+ *  x_ind       array of \p x_nnz elements containing the indices of the non-zero
+ *              values of \f$x\f$.
+ *  @param[out]
+ *  y_nnz       number of non-zero entries of \f$y\f$, in host or device memory
+ *              depending on the pointer mode.
+ *  @param[out]
+ *  y_val       array of at least \p m elements, the first \p y_nnz hold the values of
+ *              \f$y\f$, or \p NULL.
+ *  @param[out]
+ *  y_ind       array of at least \p m elements, the first \p y_nnz hold the indices
+ *              of the non-zero values of \f$y\f$.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz or \p x_nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p semiring is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csc_col_ptr,
+ *              \p csc_row_ind, \p info, \p x_ind, \p y_nnz or \p y_ind pointer is
+ *              invalid, or \p info does not hold analysis data of the matrix.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example expands the frontier of a breadth first search on an unweighted
+ *  graph, given by the indices of its vertices.
+ *  \code{.c}
+ *      float one = 1.0f;
+ *
+ *      rocsparse_cscmspv_analysis(handle, m, n, nnz, descr, csc_col_ptr, csc_row_ind, info);
+ *
+ *      // next = A * frontier over the boolean semiring
+ *      rocsparse_scscmspv(handle,
+ *                         rocsparse_semiring_or_and,
+ *                         m,
+ *                         n,
+ *                         nnz,
+ *                         &one,
+ *                         descr,
+ *                         NULL,
+ *                         csc_col_ptr,
+ *                         csc_row_ind,
+ *                         info,
+ *                         frontier_nnz,
+ *                         NULL,
+ *                         frontier_ind,
+ *                         &next_nnz,
+ *                         NULL,
+ *                         next_ind);
+ *
+ *      rocsparse_cscmspv_clear(handle, info);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scscmspv(rocsparse_handle handle,
+                                    rocsparse_semiring semiring,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    rocsparse_int nnz,
+                                    const float* alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const float* csc_val,
+                                    const rocsparse_int* csc_col_ptr,
+                                    const rocsparse_int* csc_row_ind,
+                                    rocsparse_mat_info info,
+                                    rocsparse_int x_nnz,
+                                    const float* x_val,
+                                    const rocsparse_int* x_ind,
+                                    rocsparse_int* y_nnz,
+                                    float* y_val,
+                                    rocsparse_int* y_ind);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcscmspv(rocsparse_handle handle,
+                                    rocsparse_semiring semiring,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    rocsparse_int nnz,
+                                    const double* alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const double* csc_val,
+                                    const rocsparse_int* csc_col_ptr,
+                                    const rocsparse_int* csc_row_ind,
+                                    rocsparse_mat_info info,
+                                    rocsparse_int x_nnz,
+                                    const double* x_val,
+                                    const rocsparse_int* x_ind,
+                                    rocsparse_int* y_nnz,
+                                    double* y_val,
+                                    rocsparse_int* y_ind);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix sparse vector multiplication using CSC storage format
+ *
+ *  \details
+ *  \p rocsparse_cscmspv_clear deallocates all memory that was allocated by
+ *  rocsparse_cscmspv_analysis(). This is especially useful, if memory is an issue and
+ *  the analysis data is not required anymore for further computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_cscmspv_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the gathered information
+ *              could not be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cscmspv_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
 /*! \ingroup level2_module
  *  \brief Sparse matrix vector multiplication using CSR storage format
  *
@@ -816,6 +1174,11 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
  *  It may return before the actual computation has finished.
  *
  *  \note
+ *  If \p csr_val is \p NULL, every entry of the matrix is one. Such pattern only
+ *  matrices, e.g. the adjacency matrix of an unweighted graph, are processed without
+ *  loading any values.
+ *
+ *  \note
  *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
  *
  *  @param[in]
@@ -834,7 +1197,8 @@ rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_in
  *  descr       descriptor of the sparse CSR matrix. Currently, only
  *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix, or \p NULL for a
+ *              pattern only matrix.
  *  @param[in]
  *  csr_row_ptr array of \p m+1 elements that point to the start
  *              of every row of the sparse CSR matrix.
@@ -976,53 +1340,16 @@ rocsparse_status rocsparse_zcsrmv(rocsparse_handle handle,
 /**@}*/
 
 /*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+ *  \brief Sparse matrix vector multiplication using CSR storage format and 16-bit values
  *
  *  \details
- *  \p rocsparse_csrsv_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_scsrsv_solve() or
- *  rocsparse_dcsrsv_solve() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
- *  is stored in \p position, using same index base as the CSR matrix.
- *
- *  \p position can be in host or device memory. If no zero pivot has been found,
- *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
- *
- *  \note \p rocsparse_csrsv_zero_pivot is a blocking function. It might influence
- *  performance negatively.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  descr       descriptor of the sparse CSR matrix.
- *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[inout]
- *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
- *              invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
- */
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
-                                            const rocsparse_mat_descr descr,
-                                            rocsparse_mat_info info,
-                                            rocsparse_int* position);
-
-/*! \ingroup level2_module
- *  \brief Sparse triangular solve using CSR storage format
+ *  \p rocsparse_hcsrmv_analysis and \p rocsparse_bfcsrmv_analysis perform the analysis
+ *  step for rocsparse_hcsrmv() and rocsparse_bfcsrmv(), respectively. The analysis only
+ *  depends on the sparsity pattern and is identical to rocsparse_scsrmv_analysis().
  *
- *  \details
- *  \p rocsparse_csrsv_buffer_size returns the size of the temporary storage buffer that
- *  is required by rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
- *  rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve(). The temporary storage buffer
- *  must be allocated by the user. The size of the temporary storage buffer is identical
- *  to the size returned by rocsparse_scsrilu0_buffer_size() and
- *  rocsparse_dcsrilu0_buffer_size() if the matrix sparsity pattern is identical. The
- *  user allocated buffer can thus be shared between subsequent calls to those functions.
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -1031,11 +1358,14 @@ rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
  *  @param[in]
  *  m           number of rows of the sparse CSR matrix.
  *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
  *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
  *  descr       descriptor of the sparse CSR matrix.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix, or \p NULL for a
+ *              pattern only matrix.
  *  @param[in]
  *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
  *              sparse CSR matrix.
@@ -1044,41 +1374,769 @@ rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
  *              CSR matrix.
  *  @param[out]
  *  info        structure that holds the information collected during the analysis step.
- *  @param[in]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
- *              rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve().
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
  *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
- *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *              \p csr_col_ind or \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the gathered information
+ *              could not be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_hcsrmv_analysis(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_half* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bfcsrmv_analysis(rocsparse_handle handle,
+                                            rocsparse_operation trans,
+                                            rocsparse_int m,
+                                            rocsparse_int n,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_bfloat16* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using CSR storage format and 16-bit values
+ *
+ *  \details
+ *  \p rocsparse_hcsrmv and \p rocsparse_bfcsrmv compute
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  where the values of the sparse CSR matrix are stored in half precision
+ *  (\ref rocsparse_half) or bfloat16 (\ref rocsparse_bfloat16) format. Matrix values
+ *  are converted on load and all arithmetic, including accumulation, is performed in
+ *  single precision. Halving the size of the value array reduces the memory traffic of
+ *  this bandwidth bound operation. See rocsparse_scsrmv() for a detailed description.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix in 16-bit format, or
+ *              \p NULL for a pattern only matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        information collected by rocsparse_hcsrmv_analysis() or
+ *              rocsparse_bfcsrmv_analysis(), can be \p NULL if no information is
+ *              available.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta or \p y pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_hcsrmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int nnz,
+                                  const float* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_half* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  rocsparse_mat_info info,
+                                  const float* x,
+                                  const float* beta,
+                                  float* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bfcsrmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   rocsparse_int nnz,
+                                   const float* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_bfloat16* csr_val,
+                                   const rocsparse_int* csr_row_ptr,
+                                   const rocsparse_int* csr_col_ind,
+                                   rocsparse_mat_info info,
+                                   const float* x,
+                                   const float* beta,
+                                   float* y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication over a semiring using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmv_semiring multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times n\f$ matrix, defined in CSR storage format, and the dense vector \f$x\f$
+ *  and adds the result to the dense vector \f$y\f$ that is multiplied by the scalar
+ *  \f$\beta\f$, where addition and multiplication are replaced by the operations
+ *  \f$\oplus\f$ and \f$\otimes\f$ of the \ref rocsparse_semiring, such that
+ *  \f[
+ *    y := \alpha \otimes A \otimes x \oplus \beta \otimes y.
+ *  \f]
+ *  If \f$\beta\f$ is the additive identity of the semiring, \f$y\f$ is not read. If
+ *  \p csr_val is \p NULL, every stored entry of the matrix is the multiplicative
+ *  identity, such that the sparsity pattern of e.g. an unweighted graph can be used
+ *  directly.
+ *
+ *  The \p info parameter is optional. If it contains information collected by
+ *  rocsparse_scsrmv_analysis() or rocsparse_dcsrmv_analysis(), the CSR-Adaptive load
+ *  balancing of rocsparse_scsrmv() is used, which is preferable for graphs with a
+ *  skewed degree distribution.
+ *
+ *  \code{.c}
+ *      for(i = 0; i < m; ++i)
+ *      {
+ *          sum = zero;
+ *
+ *          for(j = csr_row_ptr[i]; j < csr_row_ptr[i + 1]; ++j)
+ *          {
+ *              sum = sum (+) csr_val[j] (*) x[csr_col_ind[j]];
+ *          }
+ *
+ *          y[i] = alpha (*) sum (+) beta (*) y[i];
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  semiring    semiring \ref rocsparse_semiring.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix, or \p NULL for a
+ *              pattern only matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        information collected by rocsparse_scsrmv_analysis() or
+ *              rocsparse_dcsrmv_analysis(), can be \p NULL if no information is
+ *              available.
+ *  @param[in]
+ *  x           array of \p n elements.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_value \p semiring is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_row_ptr,
+ *              \p csr_col_ind, \p x, \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example performs a breadth first search step on an unweighted graph, where
+ *  \p frontier holds ones for the vertices of the current level.
+ *  \code{.c}
+ *      float zero = 0.0f;
+ *      float one  = 1.0f;
+ *
+ *      // next = A * frontier over the boolean semiring
+ *      rocsparse_scsrmv_semiring(handle,
+ *                                rocsparse_operation_none,
+ *                                rocsparse_semiring_or_and,
+ *                                m,
+ *                                n,
+ *                                nnz,
+ *                                &one,
+ *                                descr,
+ *                                NULL,
+ *                                csr_row_ptr,
+ *                                csr_col_ind,
+ *                                info,
+ *                                frontier,
+ *                                &zero,
+ *                                next);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_semiring(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           rocsparse_semiring semiring,
+                                           rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int nnz,
+                                           const float* alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const float* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           const float* x,
+                                           const float* beta,
+                                           float* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_semiring(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           rocsparse_semiring semiring,
+                                           rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int nnz,
+                                           const double* alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const double* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           const double* x,
+                                           const double* beta,
+                                           double* y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication on a subset of rows using CSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_csrmv_masked multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times n\f$ matrix, defined in CSR storage format, and the dense vector \f$x\f$
+ *  and adds the result to the dense vector \f$y\f$ that is multiplied by the scalar
+ *  \f$\beta\f$, for the \p mask_nnz rows that are listed in \p mask_ind only, such
+ *  that
+ *  \f[
+ *    y_i := \alpha \cdot (A \cdot x)_i + \beta \cdot y_i, \quad i \in mask\_ind.
+ *  \f]
+ *  All other entries of \f$y\f$ are left unchanged. The row indices are given like
+ *  the indices of a sparse vector of rocsparse_sgthr(), using the index base of
+ *  \p descr.
+ *
+ *  The selected non-zero entries are split into tiles of equal size, independent of
+ *  the rows they belong to, such that the work is proportional to the number of
+ *  non-zero entries of the selected rows and balanced for rows of any length.
+ *
+ *  \code{.c}
+ *      for(k = 0; k < mask_nnz; ++k)
+ *      {
+ *          i   = mask_ind[k];
+ *          sum = 0;
+ *
+ *          for(j = csr_row_ptr[i]; j < csr_row_ptr[i + 1]; ++j)
+ *          {
+ *              sum += csr_val[j] * x[csr_col_ind[j]];
+ *          }
+ *
+ *          y[i] = alpha * sum + beta * y[i];
+ *      }
+ *  \endcode
+ *
+ *  \note
+ *  \p mask_ind must not contain duplicate entries. The order of the entries is
+ *  arbitrary.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  x           array of \p n elements.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[in]
+ *  mask_nnz    number of selected rows, at most \p m.
+ *  @param[in]
+ *  mask_ind    array of \p mask_nnz elements containing the indices of the selected
+ *              rows.
+ *  @param[inout]
+ *  y           array of \p m elements.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz or \p mask_nnz is
+ *              invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_val,
+ *              \p csr_row_ptr, \p csr_col_ind, \p x, \p beta, \p mask_ind or \p y
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the workspace could not be allocated.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
  *  \retval     rocsparse_status_not_implemented
  *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example updates the rows of the active set of an iterative method only.
+ *  \code{.c}
+ *      float alpha = 1.0f;
+ *      float beta  = 0.0f;
+ *
+ *      // y(active) = A(active, :) * x
+ *      rocsparse_scsrmv_masked(handle,
+ *                              rocsparse_operation_none,
+ *                              m,
+ *                              n,
+ *                              nnz,
+ *                              &alpha,
+ *                              descr,
+ *                              csr_val,
+ *                              csr_row_ptr,
+ *                              csr_col_ind,
+ *                              x,
+ *                              &beta,
+ *                              active_nnz,
+ *                              active_ind,
+ *                              y);
+ *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrsv_buffer_size(rocsparse_handle handle,
+rocsparse_status rocsparse_scsrmv_masked(rocsparse_handle handle,
+                                         rocsparse_operation trans,
+                                         rocsparse_int m,
+                                         rocsparse_int n,
+                                         rocsparse_int nnz,
+                                         const float* alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const float* csr_val,
+                                         const rocsparse_int* csr_row_ptr,
+                                         const rocsparse_int* csr_col_ind,
+                                         const float* x,
+                                         const float* beta,
+                                         rocsparse_int mask_nnz,
+                                         const rocsparse_int* mask_ind,
+                                         float* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_masked(rocsparse_handle handle,
+                                         rocsparse_operation trans,
+                                         rocsparse_int m,
+                                         rocsparse_int n,
+                                         rocsparse_int nnz,
+                                         const double* alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const double* csr_val,
+                                         const rocsparse_int* csr_row_ptr,
+                                         const rocsparse_int* csr_col_ind,
+                                         const double* x,
+                                         const double* beta,
+                                         rocsparse_int mask_nnz,
+                                         const rocsparse_int* mask_ind,
+                                         double* y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Streamed sparse matrix vector multiplication using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrmv_stream multiplies the scalar \f$\alpha\f$ with a sparse
+ *  \f$m \times n\f$ matrix, defined in CSR storage format, and the dense vector \f$x\f$
+ *  and adds the result to the dense vector \f$y\f$ that is multiplied by the scalar
+ *  \f$\beta\f$, such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  for matrices whose column indices and values do not fit into device memory.
+ *
+ *  Only the row pointer array is passed to the function, and it is kept in host
+ *  memory. The rows are split into panels of at most \p panel_nnz non-zero entries,
+ *  or a single row if it is longer. The column indices and values of each panel are
+ *  requested from \p read_panel, e.g. from a file, copied to the device and multiplied
+ *  with \f$x\f$. Two panels are in flight at any time, such that reading and copying
+ *  of the next panel overlaps with the multiplication of the current one. The device
+ *  memory required is bounded by two panels, independent of \p nnz.
+ *
+ *  \note
+ *  This function blocks until all panels have been read and copied to the device.
+ *  The multiplication of the last panel may still be pending when it returns.
+ *
+ *  \note
+ *  \p read_panel is called from the calling host thread, in the order of the panels.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_row_ptr host array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  panel_nnz   maximum number of non-zero entries of a panel.
+ *  @param[in]
+ *  read_panel  callback that provides the column indices and values of a panel.
+ *  @param[in]
+ *  user_data   pointer that is passed to \p read_panel.
+ *  @param[in]
+ *  x           array of \p n elements.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n, \p nnz or \p panel_nnz is
+ *              invalid or \p nnz does not match \p csr_row_ptr.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p csr_row_ptr,
+ *              \p read_panel, \p x, \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the staging buffers could not be allocated.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *  \return     the status returned by \p read_panel, if it failed.
+ *
+ *  \par Example
+ *  This example reads the panels of a matrix from a file with the column indices
+ *  stored behind the row pointer array, followed by the values.
+ *  \code{.c}
+ *      rocsparse_status read_panel(rocsparse_int row_begin,
+ *                                  rocsparse_int row_end,
+ *                                  rocsparse_int nnz_begin,
+ *                                  rocsparse_int nnz_end,
+ *                                  rocsparse_int* csr_col_ind,
+ *                                  void* csr_val,
+ *                                  void* user_data)
+ *      {
+ *          FILE* f = (FILE*)user_data;
+ *          size_t size = nnz_end - nnz_begin;
+ *
+ *          fseek(f, col_offset + sizeof(rocsparse_int) * nnz_begin, SEEK_SET);
+ *          fread(csr_col_ind, sizeof(rocsparse_int), size, f);
+ *
+ *          fseek(f, val_offset + sizeof(float) * nnz_begin, SEEK_SET);
+ *          fread(csr_val, sizeof(float), size, f);
+ *
+ *          return rocsparse_status_success;
+ *      }
+ *
+ *      // y = A * x, with at most 2^24 entries per panel
+ *      rocsparse_scsrmv_stream(handle,
+ *                              rocsparse_operation_none,
+ *                              m,
+ *                              n,
+ *                              nnz,
+ *                              &alpha,
+ *                              descr,
+ *                              h_csr_row_ptr,
+ *                              1 << 24,
+ *                              read_panel,
+ *                              f,
+ *                              x,
+ *                              &beta,
+ *                              y);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrmv_stream(rocsparse_handle handle,
+                                         rocsparse_operation trans,
+                                         rocsparse_int m,
+                                         rocsparse_int n,
+                                         rocsparse_int nnz,
+                                         const float* alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const rocsparse_int* csr_row_ptr,
+                                         rocsparse_int panel_nnz,
+                                         rocsparse_csr_panel_read read_panel,
+                                         void* user_data,
+                                         const float* x,
+                                         const float* beta,
+                                         float* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrmv_stream(rocsparse_handle handle,
+                                         rocsparse_operation trans,
+                                         rocsparse_int m,
+                                         rocsparse_int n,
+                                         rocsparse_int nnz,
+                                         const double* alpha,
+                                         const rocsparse_mat_descr descr,
+                                         const rocsparse_int* csr_row_ptr,
+                                         rocsparse_int panel_nnz,
+                                         rocsparse_csr_panel_read read_panel,
+                                         void* user_data,
+                                         const double* x,
+                                         const double* beta,
+                                         double* y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_scsrsv_solve() or
+ *  rocsparse_dcsrsv_solve() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+ *  is stored in \p position, using same index base as the CSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note \p rocsparse_csrsv_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
+                                            const rocsparse_mat_descr descr,
+                                            rocsparse_mat_info info,
+                                            rocsparse_int* position);
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_convergence returns the convergence history of the last
+ *  rocsparse_scsrsv_solve() or rocsparse_dcsrsv_solve() computation with the fill
+ *  mode of \p descr that has been performed with \ref rocsparse_solve_policy_iterative.
+ *  For each Jacobi sweep \f$k\f$, the relative update \f$\|y_k - y_{k-1}\|_2 /
+ *  \|y_k\|_2\f$ is stored in \p history, which holds one entry per sweep, see
+ *  rocsparse_set_mat_info_sweeps(). Entries are zero, if no iterative solve has been
+ *  performed.
+ *
+ *  \note \p rocsparse_csrsv_convergence is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the solve.
+ *  @param[out]
+ *  history     array of relative updates per sweep, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p info or \p history
+ *              pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_convergence(rocsparse_handle handle,
+                                             const rocsparse_mat_descr descr,
+                                             rocsparse_mat_info info,
+                                             double* history);
+
+/*! \ingroup level2_module
+ *  \brief Sparse triangular solve using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_csrsv_buffer_size returns the size of the temporary storage buffer that
+ *  is required by rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *  rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve(). The temporary storage buffer
+ *  must be allocated by the user. The size of the temporary storage buffer is identical
+ *  to the size returned by rocsparse_scsrilu0_buffer_size() and
+ *  rocsparse_dcsrilu0_buffer_size() if the matrix sparsity pattern is identical. The
+ *  user allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+ *              rocsparse_scsrsv_solve() and rocsparse_dcsrsv_solve().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsv_buffer_size(rocsparse_handle handle,
+                                              rocsparse_operation trans,
+                                              rocsparse_int m,
+                                              rocsparse_int nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              rocsparse_mat_info info,
+                                              size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle handle,
+                                              rocsparse_operation trans,
+                                              rocsparse_int m,
+                                              rocsparse_int nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              rocsparse_mat_info info,
+                                              size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrsv_buffer_size(rocsparse_handle handle,
                                               rocsparse_operation trans,
                                               rocsparse_int m,
                                               rocsparse_int nnz,
                                               const rocsparse_mat_descr descr,
-                                              const float* csr_val,
+                                              const rocsparse_float_complex* csr_val,
                                               const rocsparse_int* csr_row_ptr,
                                               const rocsparse_int* csr_col_ind,
                                               rocsparse_mat_info info,
                                               size_t* buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle handle,
+rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle handle,
                                               rocsparse_operation trans,
                                               rocsparse_int m,
                                               rocsparse_int nnz,
                                               const rocsparse_mat_descr descr,
-                                              const double* csr_val,
+                                              const rocsparse_double_complex* csr_val,
                                               const rocsparse_int* csr_row_ptr,
                                               const rocsparse_int* csr_col_ind,
                                               rocsparse_mat_info info,
@@ -1103,6 +2161,10 @@ rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle handle,
  *
  *  \note
  *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *  Matrices whose arrays have been moved are validated against the analysed sparsity
+ *  pattern during execution. A sparsity pattern that is modified in place, using the
+ *  same arrays, is only detected with \ref rocsparse_pattern_check_always, see
+ *  rocsparse_set_mat_info_pattern_check().
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -1133,7 +2195,9 @@ rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle handle,
  *  analysis    \ref rocsparse_analysis_policy_reuse or
  *              \ref rocsparse_analysis_policy_force.
  *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
+ *  solve       \ref rocsparse_solve_policy_auto,
+ *              \ref rocsparse_solve_policy_multicolor or
+ *              \ref rocsparse_solve_policy_iterative.
  *  @param[in]
  *  temp_buffer temporary storage buffer allocated by the user.
  *
@@ -1175,6 +2239,34 @@ rocsparse_status rocsparse_dcsrsv_analysis(rocsparse_handle handle,
                                            rocsparse_analysis_policy analysis,
                                            rocsparse_solve_policy solve,
                                            void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrsv_analysis(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_float_complex* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy solve,
+                                           void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrsv_analysis(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_double_complex* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy solve,
+                                           void* temp_buffer);
 /**@}*/
 
 /*! \ingroup level2_module
@@ -1276,7 +2368,9 @@ rocsparse_status rocsparse_csrsv_clear(rocsparse_handle handle,
  *  @param[out]
  *  y           array of \p m elements, holding the solution.
  *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
+ *  policy      \ref rocsparse_solve_policy_auto,
+ *              \ref rocsparse_solve_policy_multicolor or
+ *              \ref rocsparse_solve_policy_iterative.
  *  @param[in]
  *  temp_buffer temporary storage buffer allocated by the user.
  *
@@ -1397,6 +2491,38 @@ rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle handle,
                                         double* y,
                                         rocsparse_solve_policy policy,
                                         void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrsv_solve(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int nnz,
+                                        const rocsparse_float_complex* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const rocsparse_float_complex* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        rocsparse_mat_info info,
+                                        const rocsparse_float_complex* x,
+                                        rocsparse_float_complex* y,
+                                        rocsparse_solve_policy policy,
+                                        void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrsv_solve(rocsparse_handle handle,
+                                        rocsparse_operation trans,
+                                        rocsparse_int m,
+                                        rocsparse_int nnz,
+                                        const rocsparse_double_complex* alpha,
+                                        const rocsparse_mat_descr descr,
+                                        const rocsparse_double_complex* csr_val,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        rocsparse_mat_info info,
+                                        const rocsparse_double_complex* x,
+                                        rocsparse_double_complex* y,
+                                        rocsparse_solve_policy policy,
+                                        void* temp_buffer);
 /**@}*/
 
 /*! \ingroup level2_module
@@ -1443,7 +2569,14 @@ rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle handle,
  *  It may return before the actual computation has finished.
  *
  *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *  If \p ell_val is \p NULL, every entry of the matrix is one. Such pattern only
+ *  matrices, e.g. the adjacency matrix of an unweighted graph, are processed without
+ *  loading any values.
+ *
+ *  \note
+ *  For \p trans != \ref rocsparse_operation_none, the contributions of each entry are
+ *  accumulated into \p y using atomic operations. The order of the summation is thus
+ *  not deterministic.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -1460,7 +2593,7 @@ rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle handle,
  *              \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
  *  ell_val     array that contains the elements of the sparse ELL matrix. Padded
- *              elements should be zero.
+ *              elements should be zero. \p NULL for a pattern only matrix.
  *  @param[in]
  *  ell_col_ind array that contains the column indices of the sparse ELL matrix.
  *              Padded column indices should be -1.
@@ -1481,7 +2614,6 @@ rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle handle,
  *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p ell_val,
  *              \p ell_col_ind, \p x, \p beta or \p y pointer is invalid.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
@@ -1513,9 +2645,8 @@ rocsparse_status rocsparse_dellmv(rocsparse_handle handle,
                                   const double* beta,
                                   double* y);
 
-/*
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
+rocsparse_status rocsparse_cellmv(rocsparse_handle handle,
                                   rocsparse_operation trans,
                                   rocsparse_int m,
                                   rocsparse_int n,
@@ -1529,7 +2660,7 @@ rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
                                   rocsparse_float_complex* y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
+rocsparse_status rocsparse_zellmv(rocsparse_handle handle,
                                   rocsparse_operation trans,
                                   rocsparse_int m,
                                   rocsparse_int n,
@@ -1541,7 +2672,96 @@ rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
                                   const rocsparse_double_complex* x,
                                   const rocsparse_double_complex* beta,
                                   rocsparse_double_complex* y);
-*/
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using ELL storage format and 16-bit values
+ *
+ *  \details
+ *  \p rocsparse_hellmv and \p rocsparse_bfellmv compute
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  where the values of the sparse ELL matrix are stored in half precision
+ *  (\ref rocsparse_half) or bfloat16 (\ref rocsparse_bfloat16) format. All arithmetic
+ *  is performed in single precision. See rocsparse_sellmv() for a detailed description.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  For \p trans != \ref rocsparse_operation_none, the contributions of each entry are
+ *  accumulated into \p y using atomic operations. The order of the summation is thus
+ *  not deterministic.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  m           number of rows of the sparse ELL matrix.
+ *  @param[in]
+ *  n           number of columns of the sparse ELL matrix.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse ELL matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  ell_val     array that contains the elements of the sparse ELL matrix in 16-bit
+ *              format. Padded elements should be zero. \p NULL for a pattern only
+ *              matrix.
+ *  @param[in]
+ *  ell_col_ind array that contains the column indices of the sparse ELL matrix.
+ *              Padded column indices should be -1.
+ *  @param[in]
+ *  ell_width   number of non-zero elements per row of the sparse ELL matrix.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p n or \p ell_width is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p ell_val,
+ *              \p ell_col_ind, \p x, \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_hellmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const float* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_half* ell_val,
+                                  const rocsparse_int* ell_col_ind,
+                                  rocsparse_int ell_width,
+                                  const float* x,
+                                  const float* beta,
+                                  float* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bfellmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   rocsparse_int m,
+                                   rocsparse_int n,
+                                   const float* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_bfloat16* ell_val,
+                                   const rocsparse_int* ell_col_ind,
+                                   rocsparse_int ell_width,
+                                   const float* x,
+                                   const float* beta,
+                                   float* y);
 /**@}*/
 
 /*! \ingroup level2_module
@@ -1571,7 +2791,13 @@ rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
  *  It may return before the actual computation has finished.
  *
  *  \note
- *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *  If the HYB matrix has been converted from a pattern only CSR matrix, every entry of
+ *  the matrix is one and no values are loaded.
+ *
+ *  \note
+ *  For \p trans != \ref rocsparse_operation_none, the contributions of each entry are
+ *  accumulated into \p y using atomic operations. The order of the summation is thus
+ *  not deterministic.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -1605,7 +2831,6 @@ rocsparse_status rocsparse_sellmv(rocsparse_handle handle,
  *  \retval     rocsparse_status_memory_error the buffer could not be allocated.
  *  \retval     rocsparse_status_internal_error an internal error occurred.
  *  \retval     rocsparse_status_not_implemented
- *              \p trans != \ref rocsparse_operation_none or
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  */
 /**@{*/
@@ -1628,27 +2853,195 @@ rocsparse_status rocsparse_dhybmv(rocsparse_handle handle,
                                   const double* x,
                                   const double* beta,
                                   double* y);
-/*
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_shybmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  const rocsparse_float_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat hyb,
-                                  const rocsparse_float_complex* x,
-                                  const rocsparse_float_complex* beta,
-                                  rocsparse_float_complex* y);
+rocsparse_status rocsparse_chybmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat hyb,
+                                  const rocsparse_float_complex* x,
+                                  const rocsparse_float_complex* beta,
+                                  rocsparse_float_complex* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zhybmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat hyb,
+                                  const rocsparse_double_complex* x,
+                                  const rocsparse_double_complex* beta,
+                                  rocsparse_double_complex* y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using HYB storage format and 16-bit values
+ *
+ *  \details
+ *  \p rocsparse_hhybmv and \p rocsparse_bfhybmv compute
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  where \p hyb has been created by rocsparse_hcsr2hyb() or rocsparse_bfcsr2hyb(),
+ *  respectively. All arithmetic is performed in single precision. See
+ *  rocsparse_shybmv() for a detailed description.
+ *
+ *  \note
+ *  The HYB matrix does not record the precision of its values. Passing a HYB matrix
+ *  that has been created with a different precision results in undefined behaviour.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  For \p trans != \ref rocsparse_operation_none, the contributions of each entry are
+ *  accumulated into \p y using atomic operations. The order of the summation is thus
+ *  not deterministic.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse HYB matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  hyb         matrix in HYB storage format with 16-bit values.
+ *  @param[in]
+ *  x           array of \p n elements (\f$op(A) == A\f$) or \p m elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements (\f$op(A) == A\f$) or \p n elements
+ *              (\f$op(A) == A^T\f$ or \f$op(A) == A^H\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p hyb structure was not initialized with
+ *              valid matrix sizes.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p hyb, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p hyb structure was not initialized
+ *              with a valid partitioning type.
+ *  \retval     rocsparse_status_memory_error the buffer could not be allocated.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_hhybmv(rocsparse_handle handle,
+                                  rocsparse_operation trans,
+                                  const float* alpha,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat hyb,
+                                  const float* x,
+                                  const float* beta,
+                                  float* y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bfhybmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   const float* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_hyb_mat hyb,
+                                   const float* x,
+                                   const float* beta,
+                                   float* y);
+/**@}*/
+
+/*! \ingroup level2_module
+ *  \brief Sparse matrix vector multiplication using PCSR storage format
+ *
+ *  \details
+ *  \p rocsparse_pcsrmv multiplies the scalar \f$\alpha\f$ with a sparse \f$m \times n\f$
+ *  matrix, defined in PCSR storage format, and the dense vector \f$x\f$ and adds the
+ *  result to the dense vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$,
+ *  such that
+ *  \f[
+ *    y := \alpha \cdot op(A) \cdot x + \beta \cdot y,
+ *  \f]
+ *  with
+ *  \f[
+ *    op(A) = \left\{
+ *    \begin{array}{ll}
+ *        A,   & \text{if trans == rocsparse_operation_none} \\
+ *        A^T, & \text{if trans == rocsparse_operation_transpose} \\
+ *        A^H, & \text{if trans == rocsparse_operation_conjugate_transpose}
+ *    \end{array}
+ *    \right.
+ *  \f]
+ *
+ *  The column indices of the PCSR matrix are decoded on the fly, such that only the
+ *  packed column deltas are loaded from memory. For banded or reordered matrices, this
+ *  reduces the amount of index data to a quarter or a half, compared to
+ *  rocsparse_scsrmv().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  \note
+ *  If the PCSR matrix has been converted from a pattern only CSR matrix, every entry of
+ *  the matrix is one and no values are loaded.
+ *
+ *  \note
+ *  Currently, only \p trans == \ref rocsparse_operation_none is supported.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  trans       matrix operation type.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  descr       descriptor of the sparse PCSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  pcsr        matrix in PCSR storage format, converted by rocsparse_scsr2pcsr().
+ *  @param[in]
+ *  x           array of \p n elements.
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p m elements.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p pcsr structure was not initialized with
+ *              valid matrix sizes.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p alpha, \p pcsr, \p x,
+ *              \p beta or \p y pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p pcsr structure was not initialized
+ *              with a valid column delta size.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_not_implemented
+ *              \p trans != \ref rocsparse_operation_none or
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spcsrmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   const float* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_pcsr_mat pcsr,
+                                   const float* x,
+                                   const float* beta,
+                                   float* y);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dhybmv(rocsparse_handle handle,
-                                  rocsparse_operation trans,
-                                  const rocsparse_double_complex* alpha,
-                                  const rocsparse_mat_descr descr,
-                                  const rocsparse_hyb_mat hyb,
-                                  const rocsparse_double_complex* x,
-                                  const rocsparse_double_complex* beta,
-                                  rocsparse_double_complex* y);
-*/
+rocsparse_status rocsparse_dpcsrmv(rocsparse_handle handle,
+                                   rocsparse_operation trans,
+                                   const double* alpha,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_pcsr_mat pcsr,
+                                   const double* x,
+                                   const double* beta,
+                                   double* y);
 /**@}*/
 
 /*
@@ -1943,6 +3336,40 @@ rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle handle,
                                               rocsparse_mat_info info,
                                               rocsparse_int* position);
 
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_csrilu0_convergence returns the convergence history of the last
+ *  rocsparse_scsrilu0() or rocsparse_dcsrilu0() computation that has been performed
+ *  with \ref rocsparse_solve_policy_iterative. For each sweep \f$k\f$, the relative
+ *  update \f$\|F_k - F_{k-1}\|_F / \|F_k\|_F\f$ of the combined factors \f$F = L + U\f$
+ *  is stored in \p history, which holds one entry per sweep, see
+ *  rocsparse_set_mat_info_sweeps(). Entries are zero, if no iterative factorization
+ *  has been performed.
+ *
+ *  \note \p rocsparse_csrilu0_convergence is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the factorization.
+ *  @param[out]
+ *  history     array of relative updates per sweep, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p history pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_convergence(rocsparse_handle handle,
+                                               rocsparse_mat_info info,
+                                               double* history);
+
 /*! \ingroup precond_module
  *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
  *  storage format
@@ -2011,6 +3438,28 @@ rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle handle,
                                                 const rocsparse_int* csr_col_ind,
                                                 rocsparse_mat_info info,
                                                 size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_buffer_size(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_mat_info info,
+                                                size_t* buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_mat_info info,
+                                                size_t* buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
@@ -2032,6 +3481,10 @@ rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle handle,
  *
  *  \note
  *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *  Matrices whose arrays have been moved are validated against the analysed sparsity
+ *  pattern during execution. A sparsity pattern that is modified in place, using the
+ *  same arrays, is only detected with \ref rocsparse_pattern_check_always, see
+ *  rocsparse_set_mat_info_pattern_check().
  *
  *  \note
  *  This function is non blocking and executed asynchronously with respect to the host.
@@ -2060,7 +3513,9 @@ rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle handle,
  *  analysis    \ref rocsparse_analysis_policy_reuse or
  *              \ref rocsparse_analysis_policy_force.
  *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
+ *  solve       \ref rocsparse_solve_policy_auto,
+ *              \ref rocsparse_solve_policy_multicolor or
+ *              \ref rocsparse_solve_policy_iterative.
  *  @param[in]
  *  temp_buffer temporary storage buffer allocated by the user.
  *
@@ -2100,6 +3555,32 @@ rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle handle,
                                              rocsparse_analysis_policy analysis,
                                              rocsparse_solve_policy solve,
                                              void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_analysis(rocsparse_handle handle,
+                                             rocsparse_int m,
+                                             rocsparse_int nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_mat_info info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy solve,
+                                             void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_analysis(rocsparse_handle handle,
+                                             rocsparse_int m,
+                                             rocsparse_int nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_mat_info info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy solve,
+                                             void* temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
@@ -2108,7 +3589,8 @@ rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle handle,
  *
  *  \details
  *  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
- *  rocsparse_scsrilu0_analysis() or rocsparse_dcsrilu0_analysis(). This is especially
+ *  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis() or
+ *  rocsparse_dscsrilu0(). This is especially
  *  useful, if memory is an issue and the analysis data is not required for further
  *  computation.
  *
@@ -2177,7 +3659,9 @@ rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *  @param[in]
  *  info        structure that holds the information collected during the analysis step.
  *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
+ *  policy      \ref rocsparse_solve_policy_auto,
+ *              \ref rocsparse_solve_policy_multicolor or
+ *              \ref rocsparse_solve_policy_iterative.
  *  @param[in]
  *  temp_buffer temporary storage buffer allocated by the user.
  *
@@ -2395,8 +3879,298 @@ rocsparse_status rocsparse_dcsrilu0(rocsparse_handle handle,
                                     rocsparse_mat_info info,
                                     rocsparse_solve_policy policy,
                                     void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_mat_info info,
+                                    rocsparse_solve_policy policy,
+                                    void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_mat_info info,
+                                    rocsparse_solve_policy policy,
+                                    void* temp_buffer);
 /**@}*/
 
+/*! \ingroup precond_module
+ *  \brief Mixed precision incomplete LU factorization with 0 fill-ins and no pivoting
+ *  using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_dscsrilu0 computes the incomplete LU factorization with 0 fill-ins and
+ *  no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$ in single precision,
+ *  such that
+ *  \f[
+ *    A \approx LU.
+ *  \f]
+ *  Other than rocsparse_dcsrilu0(), the double precision values of \f$A\f$ are not
+ *  overwritten. The single precision factors are kept in the \ref rocsparse_mat_info
+ *  struct and are used by rocsparse_dscsrilu0_solve() to solve \f$Ax = b\f$ by
+ *  iterative refinement.
+ *
+ *  \p rocsparse_dscsrilu0 requires a user allocated temporary buffer. Its size is
+ *  returned by rocsparse_scsrilu0_buffer_size() or rocsparse_dcsrilu0_buffer_size().
+ *  Furthermore, analysis meta data is required. It only depends on the sparsity pattern
+ *  and can be obtained by rocsparse_scsrilu0_analysis() or
+ *  rocsparse_dcsrilu0_analysis(). \p rocsparse_dscsrilu0 reports the first zero pivot
+ *  (either numerical or structural zero). The zero pivot status can be obtained by
+ *  calling rocsparse_csrilu0_zero_pivot().
+ *
+ *  \note
+ *  The sparse CSR matrix has to be sorted. This can be achieved by calling
+ *  rocsparse_csrsort().
+ *
+ *  \note
+ *  The single precision factors can be released by calling rocsparse_csrilu0_clear().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step
+ *              and the single precision factors.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto,
+ *              \ref rocsparse_solve_policy_multicolor or
+ *              \ref rocsparse_solve_policy_iterative.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind or \p info pointer is invalid, or the csrilu0 analysis
+ *              has not been performed.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_memory_error the buffer holding the single precision
+ *              factors could not be allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dscsrilu0(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int nnz,
+                                     const rocsparse_mat_descr descr,
+                                     const double* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_mat_info info,
+                                     rocsparse_solve_policy policy,
+                                     void* temp_buffer);
+
+/*! \ingroup precond_module
+ *  \brief Mixed precision iterative refinement using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_dscsrilu0_solve_buffer_size returns the size of the temporary storage
+ *  buffer that is required by rocsparse_dscsrilu0_solve(). The temporary storage buffer
+ *  must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_dscsrilu0_solve().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dscsrilu0_solve_buffer_size(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const double* csr_val,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       rocsparse_mat_info info,
+                                                       size_t* buffer_size);
+
+/*! \ingroup precond_module
+ *  \brief Mixed precision iterative refinement using CSR storage format
+ *
+ *  \details
+ *  \p rocsparse_dscsrilu0_solve solves the sparse linear system \f$Ax = b\f$ of a
+ *  sparse \f$m \times m\f$ CSR matrix \f$A\f$ by iterative refinement. The residual
+ *  \f$r = b - Ax\f$ is computed in double precision, while the correction \f$LUz = r\f$
+ *  is obtained by triangular solves in single precision, using the factors computed by
+ *  rocsparse_dscsrilu0(). The iteration
+ *  \f[
+ *    x_{k+1} = x_k + (LU)^{-1} (b - A x_k)
+ *  \f]
+ *  starts with the initial guess passed in \p x and stops, when
+ *  \f$\|b - Ax_k\|_{\infty} \le tol \cdot \|b\|_{\infty}\f$ or after \p max_iter
+ *  corrections.
+ *
+ *  \p rocsparse_dscsrilu0_solve requires a user allocated temporary buffer. Its size is
+ *  returned by rocsparse_dscsrilu0_solve_buffer_size(). Furthermore, triangular analysis
+ *  meta data of the lower and the upper factor is required. It only depends on the
+ *  sparsity pattern and can be obtained by rocsparse_scsrsv_analysis() or
+ *  rocsparse_dcsrsv_analysis(). The lower part analysis can re-use the csrilu0 meta data
+ *  by passing \ref rocsparse_analysis_policy_reuse. If csrmv analysis meta data, obtained
+ *  by rocsparse_dcsrmv_analysis() with the same \p descr, is present in \p info, it is
+ *  used for the residual computation.
+ *
+ *  \note
+ *  Iterative refinement converges, if \f$LU\f$ is a sufficiently good approximation of
+ *  \f$A\f$, e.g. for diagonally dominant matrices.
+ *
+ *  \note
+ *  This function is blocking with respect to the host, since the residual norm is
+ *  checked after each step.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start
+ *              of every row of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[in]
+ *  info        structure that holds the analysis meta data and the single precision
+ *              factors.
+ *  @param[in]
+ *  b           array of \p m elements, holding the right-hand side.
+ *  @param[inout]
+ *  x           array of \p m elements, holding the initial guess on input and the
+ *              solution on output.
+ *  @param[in]
+ *  max_iter    maximum number of refinement steps.
+ *  @param[in]
+ *  tol         relative residual tolerance.
+ *  @param[out]
+ *  iter        number of refinement steps performed, on the host.
+ *  @param[out]
+ *  res         final relative residual \f$\|b - Ax\|_{\infty} / \|b\|_{\infty}\f$, on
+ *              the host.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto,
+ *              \ref rocsparse_solve_policy_multicolor or
+ *              \ref rocsparse_solve_policy_iterative.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p max_iter is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+ *              \p csr_col_ind, \p b, \p x, \p iter, \p res or \p temp_buffer pointer is
+ *              invalid, or the single precision factors or the analysis meta data are
+ *              missing.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  \code{.c}
+ *      // Analysis is shared between the double and single precision routines
+ *      rocsparse_dcsrilu0_analysis(handle, m, nnz, descr_M, csr_val, csr_row_ptr,
+ *                                  csr_col_ind, info, rocsparse_analysis_policy_reuse,
+ *                                  rocsparse_solve_policy_auto, temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle, rocsparse_operation_none, m, nnz, descr_L,
+ *                                csr_val, csr_row_ptr, csr_col_ind, info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto, temp_buffer);
+ *      rocsparse_dcsrsv_analysis(handle, rocsparse_operation_none, m, nnz, descr_U,
+ *                                csr_val, csr_row_ptr, csr_col_ind, info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto, temp_buffer);
+ *
+ *      // Single precision factorization, csr_val remains untouched
+ *      rocsparse_dscsrilu0(handle, m, nnz, descr_M, csr_val, csr_row_ptr, csr_col_ind,
+ *                          info, rocsparse_solve_policy_auto, temp_buffer);
+ *
+ *      // Solve A x = b up to double precision accuracy
+ *      rocsparse_int iter;
+ *      double res;
+ *      rocsparse_dscsrilu0_solve(handle, m, nnz, descr_M, csr_val, csr_row_ptr,
+ *                                csr_col_ind, info, b, x, 100, 1e-12, &iter, &res,
+ *                                rocsparse_solve_policy_auto, solve_buffer);
+ *  \endcode
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dscsrilu0_solve(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double* csr_val,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_mat_info info,
+                                           const double* b,
+                                           double* x,
+                                           rocsparse_int max_iter,
+                                           double tol,
+                                           rocsparse_int* iter,
+                                           double* res,
+                                           rocsparse_solve_policy policy,
+                                           void* temp_buffer);
+
 /*
  * ===========================================================================
  *    Sparse Format Conversions
@@ -2497,8 +4271,8 @@ rocsparse_status rocsparse_csr2coo(rocsparse_handle handle,
  *
  *  \details
  *  \p rocsparse_csr2csc_buffer_size returns the size of the temporary storage buffer
- *  required by rocsparse_scsr2csc() and rocsparse_dcsr2csc(). The temporary storage
- *  buffer must be allocated by the user.
+ *  required by rocsparse_scsr2csc(), rocsparse_dcsr2csc(), rocsparse_ccsr2csc() and
+ *  rocsparse_zcsr2csc(). The temporary storage buffer must be allocated by the user.
  *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
@@ -2515,7 +4289,8 @@ rocsparse_status rocsparse_csr2coo(rocsparse_handle handle,
  *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
  *              CSR matrix.
  *  @param[in]
- *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  copy_values \ref rocsparse_action_symbolic, \ref rocsparse_action_numeric or
+ *              \ref rocsparse_action_numeric_conjugate.
  *  @param[out]
  *  buffer_size number of bytes of the temporary storage buffer required by
  *              sparse_csr2csc().
@@ -2544,7 +4319,9 @@ rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle handle,
  *  \p rocsparse_csr2csc converts a CSR matrix into a CSC matrix. \p rocsparse_csr2csc
  *  can also be used to convert a CSC matrix into a CSR matrix. \p copy_values decides
  *  whether \p csc_val is being filled during conversion (\ref rocsparse_action_numeric)
- *  or not (\ref rocsparse_action_symbolic).
+ *  or not (\ref rocsparse_action_symbolic). \ref rocsparse_action_numeric_conjugate
+ *  fills \p csc_val with the conjugated values, such that the resulting matrix is the
+ *  conjugate transpose of the input matrix.
  *
  *  \p rocsparse_csr2csc requires extra temporary storage buffer that has to be allocated
  *  by the user. Storage buffer size can be determined by rocsparse_csr2csc_buffer_size().
@@ -2556,6 +4333,10 @@ rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle handle,
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
+ *  \note
+ *  If \p csr_val is \p NULL, the matrix is treated as pattern only matrix. Only
+ *  \p csc_row_ind and \p csc_col_ptr are computed and \p csc_val is not accessed.
+ *
  *  @param[in]
  *  handle      handle to the rocsparse library context queue.
  *  @param[in]
@@ -2565,7 +4346,8 @@ rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle handle,
  *  @param[in]
  *  nnz         number of non-zero entries of the sparse CSR matrix.
  *  @param[in]
- *  csr_val     array of \p nnz elements of the sparse CSR matrix.
+ *  csr_val     array of \p nnz elements of the sparse CSR matrix, or \p NULL for a
+ *              pattern only matrix.
  *  @param[in]
  *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
  *              sparse CSR matrix.
@@ -2581,7 +4363,8 @@ rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle handle,
  *  csc_col_ptr array of \p n+1 elements that point to the start of every column of the
  *              sparse CSC matrix.
  *  @param[in]
- *  copy_values \ref rocsparse_action_symbolic or \ref rocsparse_action_numeric.
+ *  copy_values \ref rocsparse_action_symbolic, \ref rocsparse_action_numeric or
+ *              \ref rocsparse_action_numeric_conjugate.
  *  @param[in]
  *  idx_base    \ref rocsparse_index_base_zero or \ref rocsparse_index_base_one.
  *  @param[in]
@@ -2590,6 +4373,7 @@ rocsparse_status rocsparse_csr2csc_buffer_size(rocsparse_handle handle,
  *
  *  \retval     rocsparse_status_success the operation completed successfully.
  *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p copy_values or \p idx_base is invalid.
  *  \retval     rocsparse_status_invalid_size \p m, \p n or \p nnz is invalid.
  *  \retval     rocsparse_status_invalid_pointer \p csr_val, \p csr_row_ptr,
  *              \p csr_col_ind, \p csc_val, \p csc_row_ind, \p csc_col_ptr or
@@ -2685,6 +4469,36 @@ rocsparse_status rocsparse_dcsr2csc(rocsparse_handle handle,
                                     rocsparse_action copy_values,
                                     rocsparse_index_base idx_base,
                                     void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2csc(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    rocsparse_int nnz,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_float_complex* csc_val,
+                                    rocsparse_int* csc_row_ind,
+                                    rocsparse_int* csc_col_ptr,
+                                    rocsparse_action copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void* temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2csc(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    rocsparse_int nnz,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_double_complex* csc_val,
+                                    rocsparse_int* csc_row_ind,
+                                    rocsparse_int* csc_col_ptr,
+                                    rocsparse_action copy_values,
+                                    rocsparse_index_base idx_base,
+                                    void* temp_buffer);
 /**@}*/
 
 /*! \ingroup conv_module
@@ -2856,9 +4670,8 @@ rocsparse_status rocsparse_dcsr2ell(rocsparse_handle handle,
                                     double* ell_val,
                                     rocsparse_int* ell_col_ind);
 
-/*
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
+rocsparse_status rocsparse_ccsr2ell(rocsparse_handle handle,
                                     rocsparse_int m,
                                     const rocsparse_mat_descr csr_descr,
                                     const rocsparse_float_complex* csr_val,
@@ -2870,7 +4683,7 @@ rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
                                     rocsparse_int* ell_col_ind);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
+rocsparse_status rocsparse_zcsr2ell(rocsparse_handle handle,
                                     rocsparse_int m,
                                     const rocsparse_mat_descr csr_descr,
                                     const rocsparse_double_complex* csr_val,
@@ -2880,7 +4693,6 @@ rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
                                     rocsparse_int ell_width,
                                     rocsparse_double_complex* ell_val,
                                     rocsparse_int* ell_col_ind);
-*/
 /**@}*/
 
 /*! \ingroup conv_module
@@ -2898,6 +4710,12 @@ rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
  *  This function is non blocking and executed asynchronously with respect to the host.
  *  It may return before the actual computation has finished.
  *
+ *  \note
+ *  If \p csr_val is \p NULL, the matrix is treated as pattern only matrix and the
+ *  resulting HYB matrix does not store any values. It can be used with
+ *  rocsparse_shybmv() and friends, where every entry of the matrix is one, but not
+ *  with rocsparse_scsr2hyb_update().
+ *
  *  @param[in]
  *  handle          handle to the rocsparse library context queue.
  *  @param[in]
@@ -2908,7 +4726,8 @@ rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
  *  descr           descriptor of the sparse CSR matrix. Currently, only
  *                  \ref rocsparse_matrix_type_general is supported.
  *  @param[in]
- *  csr_val         array containing the values of the sparse CSR matrix.
+ *  csr_val         array containing the values of the sparse CSR matrix, or \p NULL for
+ *                  a pattern only matrix.
  *  @param[in]
  *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
  *                  sparse CSR matrix.
@@ -2937,82 +4756,359 @@ rocsparse_status rocsparse_scsr2ell(rocsparse_handle handle,
  *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
  *
  *  \par Example
- *  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
+ *  This example converts a CSR matrix into a HYB matrix using user defined partitioning.
+ *  \code{.c}
+ *      // Create HYB matrix structure
+ *      rocsparse_hyb_mat hyb;
+ *      rocsparse_create_hyb_mat(&hyb);
+ *
+ *      // User defined ell width
+ *      rocsparse_int user_ell_width = 5;
+ *
+ *      // Perform the conversion
+ *      rocsparse_scsr2hyb(handle,
+ *                         m,
+ *                         n,
+ *                         descr,
+ *                         csr_val,
+ *                         csr_row_ptr,
+ *                         csr_col_ind,
+ *                         hyb,
+ *                         user_ell_width,
+ *                         rocsparse_hyb_partition_user);
+ *
+ *      // Do some work
+ *
+ *      // Clean up
+ *      rocsparse_destroy_hyb_mat(hyb);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const float* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const double* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix with 16-bit values into a sparse HYB matrix
+ *
+ *  \details
+ *  \p rocsparse_hcsr2hyb and \p rocsparse_bfcsr2hyb convert a CSR matrix, whose values
+ *  are stored in half precision or bfloat16 format, into a HYB matrix with values of the
+ *  same format. The resulting HYB matrix can be used with rocsparse_hhybmv() and
+ *  rocsparse_bfhybmv(), respectively. See rocsparse_scsr2hyb() for a detailed
+ *  description.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array containing the values of the sparse CSR matrix, or \p NULL for
+ *                  a pattern only matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+ *  @param[out]
+ *  hyb             sparse matrix in HYB format.
+ *  @param[in]
+ *  user_ell_width  width of the ELL part of the HYB matrix (only required if
+ *                  \p partition_type == \ref rocsparse_hyb_partition_user).
+ *  @param[in]
+ *  partition_type  \ref rocsparse_hyb_partition_auto (recommended),
+ *                  \ref rocsparse_hyb_partition_user or
+ *                  \ref rocsparse_hyb_partition_max.
+ *
+ *  \retval        rocsparse_status_success the operation completed successfully.
+ *  \retval        rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval        rocsparse_status_invalid_size \p m, \p n or \p user_ell_width is invalid.
+ *  \retval        rocsparse_status_invalid_value \p partition_type is invalid.
+ *  \retval        rocsparse_status_invalid_pointer \p descr, \p hyb, \p csr_val,
+ *                  \p csr_row_ptr or \p csr_col_ind pointer is invalid.
+ *  \retval        rocsparse_status_memory_error the buffer for the HYB matrix could not be
+ *                  allocated.
+ *  \retval        rocsparse_status_internal_error an internal error occurred.
+ *  \retval        rocsparse_status_not_implemented
+ *                  \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_hcsr2hyb(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int n,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_half* csr_val,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_hyb_mat hyb,
+                                    rocsparse_int user_ell_width,
+                                    rocsparse_hyb_partition partition_type);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bfcsr2hyb(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int n,
+                                     const rocsparse_mat_descr descr,
+                                     const rocsparse_bfloat16* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_hyb_mat hyb,
+                                     rocsparse_int user_ell_width,
+                                     rocsparse_hyb_partition partition_type);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Update the values of a sparse HYB matrix from a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2hyb_update updates the values of a HYB matrix, that has previously
+ *  been converted from a CSR matrix using rocsparse_csr2hyb(), with the values of a CSR
+ *  matrix of identical sparsity pattern. The ELL width and the partitioning are kept,
+ *  and only a single gather over \p csr_val is performed, instead of a full conversion.
+ *
+ *  \note
+ *  The value update type of the HYB matrix must have been set to
+ *  \ref rocsparse_hyb_update_values using rocsparse_set_hyb_mat_update() prior to the
+ *  conversion. The mapping of CSR entries into the HYB matrix requires additional
+ *  storage of one integer per ELL and COO entry.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  csr_val     array containing the updated values of the sparse CSR matrix.
+ *  @param[inout]
+ *  hyb         sparse matrix in HYB format.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p hyb or \p csr_val pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p hyb has not been converted with
+ *              \ref rocsparse_hyb_update_values or is a pattern only matrix.
+ *
+ *  \par Example
+ *  This example keeps a HYB matrix up to date with changing CSR values.
+ *  \code{.c}
+ *      // Create HYB matrix structure that allows value updates
+ *      rocsparse_hyb_mat hyb;
+ *      rocsparse_create_hyb_mat(&hyb);
+ *      rocsparse_set_hyb_mat_update(hyb, rocsparse_hyb_update_values);
+ *
+ *      // Perform the conversion once
+ *      rocsparse_scsr2hyb(handle,
+ *                         m,
+ *                         n,
+ *                         descr,
+ *                         csr_val,
+ *                         csr_row_ptr,
+ *                         csr_col_ind,
+ *                         hyb,
+ *                         0,
+ *                         rocsparse_hyb_partition_auto);
+ *
+ *      for(int step = 0; step < nsteps; ++step)
+ *      {
+ *          // Compute new csr_val
+ *
+ *          // Update HYB values
+ *          rocsparse_scsr2hyb_update(handle, csr_val, hyb);
+ *
+ *          // Do some work
+ *      }
+ *
+ *      // Clean up
+ *      rocsparse_destroy_hyb_mat(hyb);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsr2hyb_update(rocsparse_handle handle,
+                                           const float* csr_val,
+                                           rocsparse_hyb_mat hyb);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsr2hyb_update(rocsparse_handle handle,
+                                           const double* csr_val,
+                                           rocsparse_hyb_mat hyb);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsr2hyb_update(rocsparse_handle handle,
+                                           const rocsparse_float_complex* csr_val,
+                                           rocsparse_hyb_mat hyb);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsr2hyb_update(rocsparse_handle handle,
+                                           const rocsparse_double_complex* csr_val,
+                                           rocsparse_hyb_mat hyb);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_hcsr2hyb_update(rocsparse_handle handle,
+                                           const rocsparse_half* csr_val,
+                                           rocsparse_hyb_mat hyb);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bfcsr2hyb_update(rocsparse_handle handle,
+                                            const rocsparse_bfloat16* csr_val,
+                                            rocsparse_hyb_mat hyb);
+/**@}*/
+
+/*! \ingroup conv_module
+ *  \brief Convert a sparse CSR matrix into a sparse PCSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csr2pcsr converts a CSR matrix into a PCSR matrix, a CSR matrix with
+ *  packed column indices. It is assumed that \p pcsr has been initialized with
+ *  rocsparse_create_pcsr_mat().
+ *
+ *  The rows of the matrix are grouped into blocks of 32 consecutive rows. For each
+ *  block, the smallest column index of its entries is stored, and each entry stores the
+ *  distance of its column index to the base of its block. The distances are stored in
+ *  1, 2 or 4 bytes per entry, depending on the largest column range of all blocks. The
+ *  selected size can be obtained using rocsparse_get_pcsr_mat_delta_size(). Banded
+ *  and reordered matrices, e.g. using rocsparse_csrrcm(), typically require 1 or 2
+ *  bytes per entry.
+ *
+ *  \note
+ *  This function is blocking with respect to the host, as the column delta size is
+ *  determined on the device.
+ *
+ *  \note
+ *  If \p csr_val is \p NULL, the matrix is treated as pattern only matrix and the
+ *  resulting PCSR matrix does not store any values.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows of the sparse CSR matrix.
+ *  @param[in]
+ *  n               number of columns of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_val         array containing the values of the sparse CSR matrix, or \p NULL for
+ *                  a pattern only matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array containing the column indices of the sparse CSR matrix.
+ *  @param[out]
+ *  pcsr            sparse matrix in PCSR format.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p n is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p pcsr, \p csr_row_ptr or
+ *              \p csr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer for the PCSR matrix could not be
+ *              allocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  This example converts a CSR matrix into a PCSR matrix and runs a matrix vector
+ *  product.
  *  \code{.c}
- *      // Create HYB matrix structure
- *      rocsparse_hyb_mat hyb;
- *      rocsparse_create_hyb_mat(&hyb);
- *
- *      // User defined ell width
- *      rocsparse_int user_ell_width = 5;
+ *      // Create PCSR matrix structure
+ *      rocsparse_pcsr_mat pcsr;
+ *      rocsparse_create_pcsr_mat(&pcsr);
  *
  *      // Perform the conversion
- *      rocsparse_scsr2hyb(handle,
- *                         m,
- *                         n,
- *                         descr,
- *                         csr_val,
- *                         csr_row_ptr,
- *                         csr_col_ind,
- *                         hyb,
- *                         user_ell_width,
- *                         rocsparse_hyb_partition_user);
- *
- *      // Do some work
+ *      rocsparse_scsr2pcsr(handle, m, n, descr, csr_val, csr_row_ptr, csr_col_ind, pcsr);
+ *
+ *      // Compute y = alpha * A * x + beta * y
+ *      rocsparse_spcsrmv(handle,
+ *                        rocsparse_operation_none,
+ *                        &alpha,
+ *                        descr,
+ *                        pcsr,
+ *                        x,
+ *                        &beta,
+ *                        y);
  *
  *      // Clean up
- *      rocsparse_destroy_hyb_mat(hyb);
+ *      rocsparse_destroy_pcsr_mat(pcsr);
  *  \endcode
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2hyb(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr descr,
-                                    const float* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    rocsparse_hyb_mat hyb,
-                                    rocsparse_int user_ell_width,
-                                    rocsparse_hyb_partition partition_type);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr descr,
-                                    const double* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    rocsparse_hyb_mat hyb,
-                                    rocsparse_int user_ell_width,
-                                    rocsparse_hyb_partition partition_type);
-/*
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsr2hyb(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr descr,
-                                    const rocsparse_float_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    rocsparse_hyb_mat hyb,
-                                    rocsparse_int user_ell_width,
-                                    rocsparse_hyb_partition partition_type);
+rocsparse_status rocsparse_scsr2pcsr(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int n,
+                                     const rocsparse_mat_descr descr,
+                                     const float* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_pcsr_mat pcsr);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
-                                    rocsparse_int m,
-                                    rocsparse_int n,
-                                    const rocsparse_mat_descr descr,
-                                    const rocsparse_double_complex* csr_val,
-                                    const rocsparse_int* csr_row_ptr,
-                                    const rocsparse_int* csr_col_ind,
-                                    rocsparse_hyb_mat hyb,
-                                    rocsparse_int user_ell_width,
-                                    rocsparse_hyb_partition partition_type);
-*/
+rocsparse_status rocsparse_dcsr2pcsr(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int n,
+                                     const rocsparse_mat_descr descr,
+                                     const double* csr_val,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_pcsr_mat pcsr);
 /**@}*/
 
 /*! \ingroup conv_module
@@ -3773,6 +5869,333 @@ rocsparse_status rocsparse_coosort_by_column(rocsparse_handle handle,
                                              rocsparse_int* perm,
                                              void* temp_buffer);
 
+/*
+ * ===========================================================================
+ *    Sparse Reordering
+ * ===========================================================================
+ */
+
+/*! \ingroup reorder_module
+ *  \brief Reverse Cuthill-McKee ordering of a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csrrcm computes the reverse Cuthill-McKee (RCM) ordering of the
+ *  \f$m \times m\f$ sparse CSR matrix \f$A\f$. The ordering is computed on the graph of
+ *  \f$A + A^T\f$, such that also unsymmetric matrices are supported. Each connected
+ *  component is ordered by a breadth first search that starts at a pseudo-peripheral
+ *  node. The symmetrically permuted matrix \f$B = P \cdot A \cdot P^T\f$, with
+ *  \f$B(i,j) = A(perm[i], perm[j])\f$, typically has a much smaller bandwidth than
+ *  \f$A\f$, which improves the locality of the accesses to \f$x\f$ in sparse
+ *  matrix vector multiplication and reduces fill-in of incomplete factorizations.
+ *  \f$B\f$ can be obtained using rocsparse_csrpermute().
+ *
+ *  \note
+ *  The ordering is a sequential graph traversal and is computed on the host.
+ *  This function is blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m           number of rows and columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz         number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse CSR matrix. Currently, only
+ *              \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+ *              sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+ *              CSR matrix.
+ *  @param[out]
+ *  perm        array of \p m integers containing the zero based permutation, where
+ *              \p perm[i] is the original index of row and column \p i.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind or \p perm pointer is invalid.
+ *  \retval     rocsparse_status_invalid_value \p csr_col_ind contains an index that
+ *              is out of range.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrrcm(rocsparse_handle handle,
+                                  rocsparse_int m,
+                                  rocsparse_int nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind,
+                                  rocsparse_int* perm);
+
+/*! \ingroup reorder_module
+ *  \brief Multicolor ordering of a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csrcolor_buffer_size returns the size of the temporary storage buffer
+ *  required by rocsparse_csrcolor(). The temporary storage buffer must be allocated by
+ *  the user.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows and columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+ *                  CSR matrix.
+ *  @param[out]
+ *  buffer_size     number of bytes of the temporary storage buffer required by
+ *                  rocsparse_csrcolor().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+ *              \p buffer_size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrcolor_buffer_size(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                size_t* buffer_size);
+
+/*! \ingroup reorder_module
+ *  \brief Multicolor ordering of a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csrcolor computes a coloring of the rows of the \f$m \times m\f$ sparse
+ *  CSR matrix \f$A\f$, such that no two rows of the same color are coupled by an entry
+ *  of \f$A\f$ or \f$A^T\f$. The coloring is computed on the device by a
+ *  Jones-Plassmann type algorithm, which colors the independent sets of rows with
+ *  locally maximal and locally minimal random priority in each round. Optionally,
+ *  \p perm returns the multicolor permutation that sorts the rows by color, keeping
+ *  the original order of rows of the same color.
+ *
+ *  In the symmetrically permuted matrix \f$B = P \cdot A \cdot P^T\f$, see
+ *  rocsparse_csrpermute(), the diagonal block of each color is diagonal. Thus,
+ *  triangular solves and the incomplete LU factorization of \f$B\f$ have at most as
+ *  many dependency levels as there are colors, which exposes parallelism for
+ *  matrices with long dependency chains. This is applied transparently by
+ *  \ref rocsparse_solve_policy_multicolor.
+ *
+ *  \p rocsparse_csrcolor requires extra temporary storage buffer that has to be
+ *  allocated by the user. Storage buffer size can be determined by
+ *  rocsparse_csrcolor_buffer_size().
+ *
+ *  \note
+ *  The number of coloring rounds is determined on the host. This function is
+ *  blocking with respect to the host.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows and columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrix. Currently, only
+ *                  \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+ *                  CSR matrix.
+ *  @param[out]
+ *  ncolors         number of colors. Pointer can be in host or device memory,
+ *                  depending on the pointer mode.
+ *  @param[out]
+ *  coloring        array of \p m integers containing the zero based color of each row.
+ *  @param[out]
+ *  perm            array of \p m integers containing the zero based permutation, where
+ *                  \p perm[i] is the original index of row and column \p i. Can be
+ *                  \p nullptr if the permutation is not required.
+ *  @param[in]
+ *  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+ *                  rocsparse_csrcolor_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p ncolors, \p coloring or \p temp_buffer pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrcolor(rocsparse_handle handle,
+                                    rocsparse_int m,
+                                    rocsparse_int nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    rocsparse_int* ncolors,
+                                    rocsparse_int* coloring,
+                                    rocsparse_int* perm,
+                                    void* temp_buffer);
+
+/*! \ingroup reorder_module
+ *  \brief Symmetric permutation of a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csrpermute_buffer_size returns the size of the temporary storage buffer
+ *  required by rocsparse_csrpermute(). The temporary storage buffer must be allocated by
+ *  the user.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows and columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+ *                  sparse CSR matrix.
+ *  @param[in]
+ *  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+ *                  CSR matrix.
+ *  @param[out]
+ *  buffer_size     number of bytes of the temporary storage buffer required by
+ *                  rocsparse_csrpermute().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p csr_row_ptr, \p csr_col_ind or
+ *              \p buffer_size pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrpermute_buffer_size(rocsparse_handle handle,
+                                                  rocsparse_int m,
+                                                  rocsparse_int nnz,
+                                                  const rocsparse_int* csr_row_ptr,
+                                                  const rocsparse_int* csr_col_ind,
+                                                  size_t* buffer_size);
+
+/*! \ingroup reorder_module
+ *  \brief Symmetric permutation of a sparse CSR matrix
+ *
+ *  \details
+ *  \p rocsparse_csrpermute computes the sparsity pattern of the symmetrically permuted
+ *  matrix \f$B = P \cdot A \cdot P^T\f$, where \f$B(i,j) = A(perm[i], perm[j])\f$. The
+ *  column indices of \f$B\f$ are sorted within each row. For each entry of \f$B\f$,
+ *  \p map holds the zero based position of the corresponding entry of \f$A\f$, such
+ *  that the values of \f$B\f$ can be obtained by rocsparse_gthr(). \p map only
+ *  depends on the sparsity pattern and can be reused whenever the values of \f$A\f$
+ *  change.
+ *
+ *  \p rocsparse_csrpermute requires extra temporary storage buffer that has to be
+ *  allocated by the user. Storage buffer size can be determined by
+ *  rocsparse_csrpermute_buffer_size().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  m               number of rows and columns of the sparse CSR matrix.
+ *  @param[in]
+ *  nnz             number of non-zero entries of the sparse CSR matrix.
+ *  @param[in]
+ *  descr           descriptor of the sparse CSR matrices \f$A\f$ and \f$B\f$. Currently,
+ *                  only \ref rocsparse_matrix_type_general is supported.
+ *  @param[in]
+ *  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+ *                  \f$A\f$.
+ *  @param[in]
+ *  csr_col_ind     array of \p nnz elements containing the column indices of \f$A\f$.
+ *  @param[in]
+ *  perm            array of \p m integers containing the zero based permutation, e.g.
+ *                  computed by rocsparse_csrrcm() or rocsparse_csrcolor().
+ *  @param[out]
+ *  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of
+ *                  \f$B\f$.
+ *  @param[out]
+ *  csr_col_ind_B   array of \p nnz elements containing the column indices of \f$B\f$.
+ *  @param[out]
+ *  map             array of \p nnz integers containing the zero based positions of the
+ *                  entries of \f$B\f$ within \f$A\f$.
+ *  @param[in]
+ *  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+ *                  rocsparse_csrpermute_buffer_size().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr,
+ *              \p csr_col_ind, \p perm, \p csr_row_ptr_B, \p csr_col_ind_B, \p map or
+ *              \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  The following example reorders a CSR matrix by RCM.
+ *  \code{.c}
+ *      // Compute RCM ordering
+ *      rocsparse_int* perm;
+ *      hipMalloc((void**)&perm, sizeof(rocsparse_int) * m);
+ *      rocsparse_csrrcm(handle, m, nnz, descr, csr_row_ptr, csr_col_ind, perm);
+ *
+ *      // Allocate temporary buffer
+ *      size_t buffer_size;
+ *      void* temp_buffer;
+ *      rocsparse_csrpermute_buffer_size(
+ *          handle, m, nnz, csr_row_ptr, csr_col_ind, &buffer_size);
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Permute the sparsity pattern
+ *      rocsparse_csrpermute(handle,
+ *                           m,
+ *                           nnz,
+ *                           descr,
+ *                           csr_row_ptr,
+ *                           csr_col_ind,
+ *                           perm,
+ *                           csr_row_ptr_B,
+ *                           csr_col_ind_B,
+ *                           map,
+ *                           temp_buffer);
+ *
+ *      // Gather permuted csr_val array
+ *      rocsparse_sgthr(handle, nnz, csr_val, csr_val_B, map, rocsparse_index_base_zero);
+ *
+ *      // Permute right-hand side and solution accordingly
+ *      rocsparse_sgthr(handle, m, b, b_B, perm, rocsparse_index_base_zero);
+ *      rocsparse_ssctr(handle, m, x_B, perm, x, rocsparse_index_base_zero);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      hipFree(perm);
+ *  \endcode
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrpermute(rocsparse_handle handle,
+                                      rocsparse_int m,
+                                      rocsparse_int nnz,
+                                      const rocsparse_mat_descr descr,
+                                      const rocsparse_int* csr_row_ptr,
+                                      const rocsparse_int* csr_col_ind,
+                                      const rocsparse_int* perm,
+                                      rocsparse_int* csr_row_ptr_B,
+                                      rocsparse_int* csr_col_ind_B,
+                                      rocsparse_int* map,
+                                      void* temp_buffer);
+
 #ifdef __cplusplus
 }
 #endif
@@ -29,6 +29,10 @@
 #ifndef _ROCSPARSE_TYPES_H_
 #define _ROCSPARSE_TYPES_H_
 
+#include "rocsparse-complex-types.h"
+
+#include <hip/hip_runtime_api.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /*! \ingroup types_module
@@ -40,6 +44,32 @@ typedef int64_t rocsparse_int;
 typedef int32_t rocsparse_int;
 #endif
 
+/*! \ingroup types_module
+ *  \brief Half precision (IEEE 754 binary16) storage type.
+ *
+ *  \details
+ *  \ref rocsparse_half is a storage-only type holding the raw bits of a 16-bit
+ *  floating point number. It is used to store matrix values, while all arithmetic
+ *  is carried out in single precision.
+ */
+typedef struct
+{
+    uint16_t data;
+} rocsparse_half;
+
+/*! \ingroup types_module
+ *  \brief Brain floating point (bfloat16) storage type.
+ *
+ *  \details
+ *  \ref rocsparse_bfloat16 is a storage-only type holding the upper 16 bits of a
+ *  single precision floating point number. It is used to store matrix values, while
+ *  all arithmetic is carried out in single precision.
+ */
+typedef struct
+{
+    uint16_t data;
+} rocsparse_bfloat16;
+
 /*! \ingroup types_module
  *  \brief Handle to the rocSPARSE library context queue.
  *
@@ -73,6 +103,17 @@ typedef struct _rocsparse_mat_descr* rocsparse_mat_descr;
  */
 typedef struct _rocsparse_hyb_mat* rocsparse_hyb_mat;
 
+/*! \ingroup types_module
+ *  \brief PCSR matrix storage format.
+ *
+ *  \details
+ *  The rocSPARSE PCSR matrix structure holds a CSR matrix with packed column indices.
+ *  It must be initialized using rocsparse_create_pcsr_mat() and the returned PCSR
+ *  matrix must be passed to all subsequent library calls that involve the matrix. It
+ *  should be destroyed at the end using rocsparse_destroy_pcsr_mat().
+ */
+typedef struct _rocsparse_pcsr_mat* rocsparse_pcsr_mat;
+
 /*! \ingroup types_module
  *  \brief Info structure to hold all matrix meta data.
  *
@@ -167,11 +208,14 @@ typedef enum rocsparse_fill_mode_ {
  *
  *  \details
  *  The \ref rocsparse_action indicates whether the operation is performed on the full
- *  matrix, or only on the sparsity pattern of the matrix.
+ *  matrix, or only on the sparsity pattern of the matrix. With
+ *  \ref rocsparse_action_numeric_conjugate, complex values are conjugated, which is
+ *  identical to \ref rocsparse_action_numeric for real values.
  */
 typedef enum rocsparse_action_ {
-    rocsparse_action_symbolic = 0, /**< Operate only on indices. */
-    rocsparse_action_numeric  = 1  /**< Operate on data and indices. */
+    rocsparse_action_symbolic          = 0, /**< Operate only on indices. */
+    rocsparse_action_numeric           = 1, /**< Operate on data and indices. */
+    rocsparse_action_numeric_conjugate = 2  /**< Operate on conjugated data and indices. */
 } rocsparse_action;
 
 /*! \ingroup types_module
@@ -187,6 +231,20 @@ typedef enum rocsparse_hyb_partition_ {
     rocsparse_hyb_partition_max  = 2  /**< max ELL nnz per row, no COO part. */
 } rocsparse_hyb_partition;
 
+/*! \ingroup types_module
+ *  \brief HYB matrix value update type.
+ *
+ *  \details
+ *  The \ref rocsparse_hyb_update type indicates whether the conversion into the hybrid
+ *  format keeps the mapping of CSR entries into ELL and COO slots. This mapping allows
+ *  subsequent updates of the HYB values with rocsparse_csr2hyb_update(), as long as the
+ *  sparsity pattern of the CSR matrix is unchanged.
+ */
+typedef enum rocsparse_hyb_update_ {
+    rocsparse_hyb_update_full   = 0, /**< values require a full conversion. */
+    rocsparse_hyb_update_values = 1  /**< keep mapping for value only updates. */
+} rocsparse_hyb_update;
+
 /*! \ingroup types_module
  *  \brief Specify policy in analysis functions.
  *
@@ -195,22 +253,82 @@ typedef enum rocsparse_hyb_partition_ {
  *  re-used or not. If meta data from a previous e.g. rocsparse_csrilu0_analysis() call
  *  is available, it can be re-used for subsequent calls to e.g.
  *  rocsparse_csrsv_analysis() and greatly improve performance of the analysis function.
+ *  Meta data is identified by a fingerprint of the sparsity pattern, such that it is only
+ *  re-used for matrices with identical structure, regardless of where they are stored.
  */
 typedef enum rocsparse_analysis_policy_ {
     rocsparse_analysis_policy_reuse = 0, /**< try to re-use meta data. */
     rocsparse_analysis_policy_force = 1  /**< force to re-build meta data. */
 } rocsparse_analysis_policy;
 
+/*! \ingroup types_module
+ *  \brief Specify when the sparsity pattern is validated during execution.
+ *
+ *  \details
+ *  The \ref rocsparse_pattern_check specifies when functions that require analysis meta
+ *  data, e.g. rocsparse_csrmv(), rocsparse_csrsv_solve() or rocsparse_csrilu0(),
+ *  re-compute the fingerprint of the sparsity pattern to validate it against the
+ *  analysed pattern. By default, the fingerprint is only re-computed if the matrix
+ *  arrays have been moved since the last call, such that a sparsity pattern that has
+ *  been modified in place, using the same arrays, is not detected. It can be set using
+ *  rocsparse_set_mat_info_pattern_check().
+ */
+typedef enum rocsparse_pattern_check_ {
+    rocsparse_pattern_check_moved  = 0, /**< validate pattern if the arrays moved. */
+    rocsparse_pattern_check_always = 1  /**< validate pattern on every call. */
+} rocsparse_pattern_check;
+
 /*! \ingroup types_module
  *  \brief Specify policy in triangular solvers and factorizations.
  *
  *  \details
- *  This is a placeholder.
+ *  The \ref rocsparse_solve_policy specifies how the dependencies between the rows of
+ *  a triangular solve or an incomplete factorization are resolved. With
+ *  \ref rocsparse_solve_policy_multicolor, the analysis functions compute a multicolor
+ *  reordering \f$P \cdot A \cdot P^T\f$ of the matrix, see rocsparse_csrcolor(). Rows
+ *  of the same color are independent, such that the number of levels is bounded by the
+ *  number of colors. The factorization and the triangular solves then transparently
+ *  operate on the reordered matrix. Since the incomplete factors of the reordered matrix
+ *  differ from those of the original matrix, the same policy has to be used for
+ *  rocsparse_csrilu0() and all subsequent triangular solves with its factors.
+ *
+ *  \ref rocsparse_solve_policy_iterative does not resolve the dependencies at all. The
+ *  incomplete factorization is approximated by asynchronous fixed-point sweeps that
+ *  update all entries of the factors in parallel, and the triangular solves by Jacobi
+ *  sweeps. The number of sweeps is set by rocsparse_set_mat_info_sweeps(), the
+ *  convergence of the last call can be queried by rocsparse_csrilu0_convergence() and
+ *  rocsparse_csrsv_convergence(). Both converge to the exact result once the number of
+ *  sweeps reaches the number of levels, but typically a few sweeps are sufficient for
+ *  preconditioning.
  */
 typedef enum rocsparse_solve_policy_ {
-    rocsparse_solve_policy_auto = 0 /**< automatically decide on level information. */
+    rocsparse_solve_policy_auto       = 0, /**< automatically decide on level information. */
+    rocsparse_solve_policy_multicolor = 1, /**< solve on the multicolor reordered matrix. */
+    rocsparse_solve_policy_iterative  = 2  /**< approximate by parallel fixed-point sweeps. */
 } rocsparse_solve_policy;
 
+/*! \ingroup types_module
+ *  \brief Specify the semiring of a sparse matrix vector multiplication.
+ *
+ *  \details
+ *  The \ref rocsparse_semiring specifies the addition \f$\oplus\f$ and multiplication
+ *  \f$\otimes\f$ that are used by e.g. rocsparse_scsrmv_semiring(). Replacing the
+ *  arithmetic semiring expresses many graph algorithms as a sequence of sparse matrix
+ *  vector products, e.g. single source shortest paths with
+ *  \ref rocsparse_semiring_min_plus and breadth first search with
+ *  \ref rocsparse_semiring_or_and. The additive identity is \f$0\f$ for all semirings
+ *  except \ref rocsparse_semiring_min_plus, where it is \f$+\infty\f$.
+ *  \ref rocsparse_semiring_max_times requires non-negative values, and
+ *  \ref rocsparse_semiring_or_and treats every non-zero value as true and returns
+ *  \f$0\f$ or \f$1\f$.
+ */
+typedef enum rocsparse_semiring_ {
+    rocsparse_semiring_plus_times = 0, /**< \f$(+, \cdot)\f$, arithmetic semiring. */
+    rocsparse_semiring_min_plus   = 1, /**< \f$(\min, +)\f$, tropical semiring. */
+    rocsparse_semiring_max_times  = 2, /**< \f$(\max, \cdot)\f$, reliability semiring. */
+    rocsparse_semiring_or_and     = 3  /**< \f$(\lor, \land)\f$, boolean semiring. */
+} rocsparse_semiring;
+
 /*! \ingroup types_module
  *  \brief Indicates if the pointer is device pointer or host pointer.
  *
@@ -232,11 +350,25 @@ typedef enum rocsparse_pointer_mode_ {
  *  The \ref rocsparse_layer_mode bit mask indicates the logging characteristics.
  */
 typedef enum rocsparse_layer_mode {
-    rocsparse_layer_mode_none      = 0x0, /**< layer is not active. */
-    rocsparse_layer_mode_log_trace = 0x1, /**< layer is in logging mode. */
-    rocsparse_layer_mode_log_bench = 0x2  /**< layer is in benchmarking mode. */
+    rocsparse_layer_mode_none        = 0x0, /**< layer is not active. */
+    rocsparse_layer_mode_log_trace   = 0x1, /**< layer is in logging mode. */
+    rocsparse_layer_mode_log_bench   = 0x2, /**< layer is in benchmarking mode. */
+    rocsparse_layer_mode_log_binary  = 0x4, /**< logging is recorded in binary form. */
+    rocsparse_layer_mode_log_profile = 0x8  /**< layer is in profiling mode. */
 } rocsparse_layer_mode;
 
+/*! \ingroup types_module
+ *  \brief Specify the output format of the profiling layer.
+ *
+ *  \details
+ *  The \ref rocsparse_profile_format indicates whether the per routine summary of
+ *  the profiling layer is written as a text table or as JSON.
+ */
+typedef enum rocsparse_profile_format_ {
+    rocsparse_profile_format_table = 0, /**< text table. */
+    rocsparse_profile_format_json  = 1  /**< JSON array. */
+} rocsparse_profile_format;
+
 /*! \ingroup types_module
  *  \brief List of rocsparse status codes definition.
  *
@@ -257,6 +389,68 @@ typedef enum rocsparse_status_ {
     rocsparse_status_zero_pivot      = 9  /**< encountered zero pivot. */
 } rocsparse_status;
 
+/*! \ingroup types_module
+ *  \brief Device memory allocation callback.
+ *
+ *  \details
+ *  A \ref rocsparse_device_malloc callback allocates \p size bytes of device memory and
+ *  returns it in \p ptr. The memory is used by work that is subsequently enqueued into
+ *  \p stream. \p user_data is the pointer that has been passed to
+ *  rocsparse_set_allocator().
+ */
+typedef rocsparse_status (*rocsparse_device_malloc)(void* user_data,
+                                                    void** ptr,
+                                                    size_t size,
+                                                    hipStream_t stream);
+
+/*! \ingroup types_module
+ *  \brief Device memory release callback.
+ *
+ *  \details
+ *  A \ref rocsparse_device_free callback releases device memory that has been obtained
+ *  from the corresponding \ref rocsparse_device_malloc callback. Work that uses \p ptr
+ *  might still be pending in \p stream, thus the memory must not be reused before this
+ *  work has finished. Memory that is released outside of a library call, e.g. by
+ *  rocsparse_destroy_hyb_mat(), is released with the default stream.
+ */
+typedef rocsparse_status (*rocsparse_device_free)(void* user_data, void* ptr, hipStream_t stream);
+
+/*! \ingroup types_module
+ *  \brief Row panel callback of streamed sparse matrix vector multiplication.
+ *
+ *  \details
+ *  A \ref rocsparse_csr_panel_read callback provides the rows \p row_begin to
+ *  \p row_end - 1 of a CSR matrix to rocsparse_scsrmv_stream() and
+ *  rocsparse_dcsrmv_stream(). It writes the column indices and values of the entries
+ *  \p nnz_begin to \p nnz_end - 1, counted from the first entry of the matrix, to the
+ *  host arrays \p csr_col_ind and \p csr_val. The column indices have the index base of
+ *  the matrix descriptor. \p user_data is the pointer that has been passed to the
+ *  streamed function. Any status other than \ref rocsparse_status_success stops the
+ *  multiplication and is returned by it.
+ */
+typedef rocsparse_status (*rocsparse_csr_panel_read)(rocsparse_int row_begin,
+                                                     rocsparse_int row_end,
+                                                     rocsparse_int nnz_begin,
+                                                     rocsparse_int nnz_end,
+                                                     rocsparse_int* csr_col_ind,
+                                                     void* csr_val,
+                                                     void* user_data);
+
+/*! \ingroup types_module
+ *  \brief Device memory statistics of a library context.
+ *
+ *  \details
+ *  \ref rocsparse_memory_stats holds the device memory statistics of a rocSPARSE
+ *  library context, that can be obtained using rocsparse_get_memory_stats().
+ */
+typedef struct rocsparse_memory_stats_
+{
+    size_t workspace_size;       /**< current size of the workspace in bytes. */
+    size_t workspace_high_water; /**< largest workspace in bytes required by a call. */
+    size_t workspace_requests;   /**< number of temporary buffers served by the workspace. */
+    size_t device_allocs;        /**< number of device allocations through the allocator. */
+} rocsparse_memory_stats;
+
 #ifdef __cplusplus
 }
 #endif
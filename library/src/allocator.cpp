@@ -0,0 +1,186 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "allocator.h"
+#include "definitions.h"
+#include "handle.h"
+
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+// Alignment of temporary buffers within the workspace
+#define WORKSPACE_ALIGNMENT 256
+// Granularity of workspace growth
+#define WORKSPACE_GRANULARITY (64 * 1024)
+
+/********************************************************************************
+ * \brief Allocate persistent device memory through the handle allocator.
+ *******************************************************************************/
+rocsparse_status rocsparse_device_malloc_memory(rocsparse_handle handle, void** ptr, size_t size)
+{
+    *ptr = nullptr;
+
+    if(size == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    ++handle->device_allocs;
+
+    // Default allocator
+    if(handle->allocator.malloc_func == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(ptr, size));
+        return rocsparse_status_success;
+    }
+
+    return handle->allocator.malloc_func(handle->allocator.user_data, ptr, size, handle->stream);
+}
+
+/********************************************************************************
+ * \brief Release device memory that has been obtained from the given allocator.
+ *******************************************************************************/
+rocsparse_status rocsparse_device_free_memory(const rocsparse_allocator& allocator,
+                                              void* ptr,
+                                              hipStream_t stream)
+{
+    if(ptr == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Default allocator
+    if(allocator.free_func == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(ptr));
+        return rocsparse_status_success;
+    }
+
+    return allocator.free_func(allocator.user_data, ptr, stream);
+}
+
+/********************************************************************************
+ * \brief Obtain a temporary device buffer from the handle workspace. The buffer
+ * is valid until the enclosing rocsparse_workspace_scope ends.
+ *******************************************************************************/
+rocsparse_status rocsparse_workspace_malloc(rocsparse_handle handle, void** ptr, size_t size)
+{
+    rocsparse_workspace& workspace = handle->workspace;
+
+    ++workspace.requests;
+
+    // Never hand out empty buffers, hipcub treats them as size queries
+    size = std::max(size, (size_t)1);
+    size = ((size - 1) / WORKSPACE_ALIGNMENT + 1) * WORKSPACE_ALIGNMENT;
+
+    if(workspace.offset + size <= workspace.size)
+    {
+        // Carve buffer from the arena
+        *ptr = reinterpret_cast<char*>(workspace.base) + workspace.offset;
+        workspace.offset += size;
+    }
+    else
+    {
+        // Arena is exhausted, serve request separately until the arena has grown
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_malloc_memory(handle, ptr, size));
+
+        workspace.overflow.push_back(*ptr);
+        workspace.overflow_size += size;
+    }
+
+    // Track peak demand
+    workspace.peak       = std::max(workspace.peak, workspace.offset + workspace.overflow_size);
+    workspace.high_water = std::max(workspace.high_water, workspace.peak);
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Release the handle workspace, e.g. before the allocator is changed.
+ *******************************************************************************/
+rocsparse_status rocsparse_workspace_release(rocsparse_handle handle)
+{
+    rocsparse_workspace& workspace = handle->workspace;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_device_free_memory(handle->allocator, workspace.base, handle->stream));
+
+    workspace.base   = nullptr;
+    workspace.size   = 0;
+    workspace.offset = 0;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_workspace_scope marks the lifetime of temporary buffers that
+ * are obtained from the handle workspace.
+ *******************************************************************************/
+rocsparse_workspace_scope::rocsparse_workspace_scope(rocsparse_handle handle)
+    : handle(handle)
+    , offset(handle->workspace.offset)
+{
+    ++handle->workspace.depth;
+}
+
+rocsparse_workspace_scope::~rocsparse_workspace_scope()
+{
+    rocsparse_workspace& workspace = handle->workspace;
+
+    // Return temporary buffers of this scope
+    workspace.offset = offset;
+
+    if(--workspace.depth > 0)
+    {
+        return;
+    }
+
+    // Outermost scope, release separately served requests. Pending work is
+    // ordered by the stream.
+    for(size_t i = 0; i < workspace.overflow.size(); ++i)
+    {
+        rocsparse_device_free_memory(handle->allocator, workspace.overflow[i], handle->stream);
+    }
+
+    workspace.overflow.clear();
+    workspace.overflow_size = 0;
+
+    // Grow arena to the peak demand, such that subsequent calls are served
+    // without device allocations
+    if(workspace.peak > workspace.size)
+    {
+        size_t size = ((workspace.peak - 1) / WORKSPACE_GRANULARITY + 1) * WORKSPACE_GRANULARITY;
+
+        void* base = nullptr;
+
+        if(rocsparse_workspace_release(handle) == rocsparse_status_success &&
+           rocsparse_device_malloc_memory(handle, &base, size) == rocsparse_status_success)
+        {
+            workspace.base = base;
+            workspace.size = size;
+        }
+    }
+
+    workspace.peak = 0;
+}
@@ -0,0 +1,180 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "capture.h"
+#include "definitions.h"
+#include "handle.h"
+
+#include <atomic>
+#include <map>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+// Plain routine name, e.g. csrmv
+static std::string capture_name(const char* routine)
+{
+    std::string name(routine);
+
+    if(name.compare(0, 10, "rocsparse_") == 0)
+    {
+        name = name.substr(10);
+    }
+
+    return name;
+}
+
+// 64 bit FNV-1a hash of the capture content
+static uint64_t capture_hash(const std::vector<char>& data)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    for(size_t i = 0; i < data.size(); ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+// Check whether routine is contained in the comma separated filter list
+static bool capture_filter_match(const std::string& filter, const std::string& routine)
+{
+    if(filter.empty())
+    {
+        return true;
+    }
+
+    size_t begin = 0;
+
+    while(begin <= filter.size())
+    {
+        size_t end = filter.find(',', begin);
+
+        if(end == std::string::npos)
+        {
+            end = filter.size();
+        }
+
+        if(filter.compare(begin, end - begin, routine) == 0)
+        {
+            return true;
+        }
+
+        begin = end + 1;
+    }
+
+    return false;
+}
+
+bool rocsparse_capture_begin(rocsparse_handle handle, const char* routine)
+{
+    if(handle == nullptr || !(handle->layer_mode & rocsparse_layer_mode_log_bench) ||
+       handle->capture_path.empty())
+    {
+        return false;
+    }
+
+    return capture_filter_match(handle->capture_filter, capture_name(routine));
+}
+
+std::string rocsparse_capture_write(rocsparse_handle handle,
+                                    const char* routine,
+                                    const rocsparse_capture_header& header,
+                                    const std::vector<rocsparse_capture_array>& arrays)
+{
+    // Operands might still be written by previous kernels
+    if(hipStreamSynchronize(handle->stream) != hipSuccess)
+    {
+        return ROCSPARSE_CAPTURE_NONE;
+    }
+
+    // Gather header and arrays on the host
+    std::vector<char> host(sizeof(header));
+
+    memcpy(host.data(), &header, sizeof(header));
+
+    for(size_t i = 0; i < arrays.size(); ++i)
+    {
+        if(arrays[i].size == 0)
+        {
+            continue;
+        }
+
+        size_t offset = host.size();
+
+        host.resize(offset + arrays[i].size);
+
+        if(arrays[i].host)
+        {
+            memcpy(&host[offset], arrays[i].ptr, arrays[i].size);
+        }
+        else if(hipMemcpy(&host[offset], arrays[i].ptr, arrays[i].size, hipMemcpyDeviceToHost) !=
+                hipSuccess)
+        {
+            return ROCSPARSE_CAPTURE_NONE;
+        }
+    }
+
+    // Operands of identical content share their capture, operands that changed since
+    // the last call, e.g. new values, are captured again
+    std::string name = capture_name(routine);
+    std::string key  = name + ":" + std::to_string(capture_hash(host));
+
+    std::map<std::string, std::string>::const_iterator it = handle->captured.find(key);
+
+    if(it != handle->captured.end())
+    {
+        return it->second;
+    }
+
+    static std::atomic<unsigned int> seq(0);
+
+    std::string path = handle->capture_path + "/" + name + "_" + std::to_string(getpid()) + "_"
+                       + std::to_string(seq++) + ".rsc";
+
+    FILE* file = fopen(path.c_str(), "wb");
+
+    if(file == NULL)
+    {
+        return ROCSPARSE_CAPTURE_NONE;
+    }
+
+    bool ok = fwrite(host.data(), 1, host.size(), file) == host.size();
+
+    ok = (fclose(file) == 0) && ok;
+
+    // Do not leave truncated captures behind
+    if(!ok)
+    {
+        remove(path.c_str());
+        return ROCSPARSE_CAPTURE_NONE;
+    }
+
+    handle->captured[key] = path;
+
+    return path;
+}
@@ -25,9 +25,11 @@
 #ifndef CSR2CSC_DEVICE_H
 #define CSR2CSC_DEVICE_H
 
+#include "complex.h"
+
 #include <hip/hip_runtime.h>
 
-template <typename T>
+template <typename T, bool CONJ>
 __global__ void csr2csc_permute_kernel(rocsparse_int nnz,
                                        const rocsparse_int* in1,
                                        const T* in2,
@@ -43,7 +45,7 @@ __global__ void csr2csc_permute_kernel(rocsparse_int nnz,
     }
 
     out1[gid] = in1[map[gid]];
-    out2[gid] = in2[map[gid]];
+    out2[gid] = CONJ ? rocsparse_conj(in2[map[gid]]) : in2[map[gid]];
 }
 
 #endif // CSR2CSC_DEVICE_H
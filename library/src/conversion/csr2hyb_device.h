@@ -26,6 +26,7 @@
 #define CSR2HYB_DEVICE_H
 
 #include "handle.h"
+#include "half.h"
 
 #include <hip/hip_runtime.h>
 
@@ -60,7 +61,8 @@ __global__ void hyb_coo_nnz(rocsparse_int m,
     }
 }
 
-// CSR to HYB format conversion kernel
+// CSR to HYB format conversion kernel, T is rocsparse_pattern_value for pattern only
+// matrices
 template <typename T>
 __global__ void csr2hyb_kernel(rocsparse_int m,
                                const T* csr_val,
@@ -73,6 +75,8 @@ __global__ void csr2hyb_kernel(rocsparse_int m,
                                rocsparse_int* coo_col_ind,
                                T* coo_val,
                                rocsparse_int* workspace,
+                               rocsparse_int* ell_perm,
+                               rocsparse_int* coo_perm,
                                rocsparse_index_base idx_base)
 {
     rocsparse_int ai = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
@@ -96,14 +100,25 @@ __global__ void csr2hyb_kernel(rocsparse_int m,
             // Fill ELL part
             rocsparse_int idx = ELL_IND(ai, p++, m, ell_width);
             ell_col_ind[idx]  = csr_col_ind[aj];
-            ell_val[idx]      = csr_val[aj];
+            matrix_value_copy(ell_val, idx, csr_val, aj);
+
+            if(ell_perm != nullptr)
+            {
+                ell_perm[idx] = aj;
+            }
         }
         else
         {
             // Fill COO part
             coo_row_ind[coo_idx] = ai + idx_base;
             coo_col_ind[coo_idx] = csr_col_ind[aj];
-            coo_val[coo_idx]     = csr_val[aj];
+            matrix_value_copy(coo_val, coo_idx, csr_val, aj);
+
+            if(coo_perm != nullptr)
+            {
+                coo_perm[coo_idx] = aj;
+            }
+
             ++coo_idx;
         }
     }
@@ -113,7 +128,44 @@ __global__ void csr2hyb_kernel(rocsparse_int m,
     {
         rocsparse_int idx = ELL_IND(ai, p++, m, ell_width);
         ell_col_ind[idx]  = -1;
-        ell_val[idx]      = static_cast<T>(0);
+        matrix_value_pad(ell_val, idx);
+
+        if(ell_perm != nullptr)
+        {
+            ell_perm[idx] = -1;
+        }
+    }
+}
+
+// Gather updated CSR values into the HYB slots, using the mapping that has been
+// stored during conversion. ELL padding keeps its explicit zeros.
+template <typename T>
+__global__ void csr2hyb_update_kernel(rocsparse_int ell_nnz,
+                                      rocsparse_int coo_nnz,
+                                      const rocsparse_int* __restrict__ csr_perm,
+                                      const T* __restrict__ csr_val,
+                                      T* __restrict__ ell_val,
+                                      T* __restrict__ coo_val)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= ell_nnz + coo_nnz)
+    {
+        return;
+    }
+
+    rocsparse_int idx = csr_perm[gid];
+
+    if(gid < ell_nnz)
+    {
+        if(idx >= 0)
+        {
+            ell_val[gid] = csr_val[idx];
+        }
+    }
+    else
+    {
+        coo_val[gid - ell_nnz] = csr_val[idx];
     }
 }
 
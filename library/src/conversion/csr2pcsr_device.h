@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSR2PCSR_DEVICE_H
+#define CSR2PCSR_DEVICE_H
+
+#include "handle.h"
+
+#include <hip/hip_runtime.h>
+
+// The entries of a block of consecutive rows are contiguous in the CSR arrays. Each
+// thread block reduces the smallest and largest column index of one row block and
+// stores the smallest index as base of the row block and the column range in a
+// workspace for the final reduction.
+template <rocsparse_int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2pcsr_range_kernel(rocsparse_int m,
+                               rocsparse_int block_dim,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               rocsparse_int* __restrict__ col_base,
+                               rocsparse_int* __restrict__ col_range,
+                               rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int bid = hipBlockIdx_x;
+
+    __shared__ rocsparse_int smin[BLOCKSIZE];
+    __shared__ rocsparse_int smax[BLOCKSIZE];
+
+    rocsparse_int row_begin = bid * block_dim;
+    rocsparse_int row_end   = min(row_begin + block_dim, m);
+
+    rocsparse_int block_begin = csr_row_ptr[row_begin] - idx_base;
+    rocsparse_int block_end   = csr_row_ptr[row_end] - idx_base;
+
+    // Empty row blocks have base and range 0
+    rocsparse_int col_min = (block_begin == block_end) ? 0 : csr_col_ind[block_begin] - idx_base;
+    rocsparse_int col_max = col_min;
+
+    for(rocsparse_int j = block_begin + tid; j < block_end; j += BLOCKSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        col_min = min(col_min, col);
+        col_max = max(col_max, col);
+    }
+
+    smin[tid] = col_min;
+    smax[tid] = col_max;
+
+    __syncthreads();
+
+    for(rocsparse_int i = BLOCKSIZE >> 1; i > 0; i >>= 1)
+    {
+        if(tid < i)
+        {
+            smin[tid] = min(smin[tid], smin[tid + i]);
+            smax[tid] = max(smax[tid], smax[tid + i]);
+        }
+
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        col_base[bid]  = smin[0];
+        col_range[bid] = smax[0] - smin[0];
+    }
+}
+
+// Store the column index of each entry relative to the base of its row block
+template <rocsparse_int BLOCKSIZE, typename D>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr2pcsr_delta_kernel(rocsparse_int m,
+                               rocsparse_int block_dim,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               const rocsparse_int* __restrict__ col_base,
+                               D* __restrict__ col_delta,
+                               rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int bid = hipBlockIdx_x;
+
+    rocsparse_int row_begin = bid * block_dim;
+    rocsparse_int row_end   = min(row_begin + block_dim, m);
+
+    rocsparse_int block_begin = csr_row_ptr[row_begin] - idx_base;
+    rocsparse_int block_end   = csr_row_ptr[row_end] - idx_base;
+
+    rocsparse_int base = col_base[bid] + idx_base;
+
+    for(rocsparse_int j = block_begin + tid; j < block_end; j += BLOCKSIZE)
+    {
+        col_delta[j] = static_cast<D>(csr_col_ind[j] - base);
+    }
+}
+
+#endif // CSR2PCSR_DEVICE_H
@@ -72,6 +72,14 @@ extern "C" rocsparse_status rocsparse_csr2coo(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_csr2coo",
+                                    "",
+                                    m,
+                                    0,
+                                    nnz,
+                                    sizeof(rocsparse_int) * (nnz + m + 1));
+
     // Quick return if possible
     if(nnz == 0 || m == 0)
     {
@@ -178,3 +178,61 @@ extern "C" rocsparse_status rocsparse_dcsr2csc(rocsparse_handle handle,
                                               idx_base,
                                               temp_buffer);
 }
+
+extern "C" rocsparse_status rocsparse_ccsr2csc(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               rocsparse_int nnz,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_float_complex* csc_val,
+                                               rocsparse_int* csc_row_ind,
+                                               rocsparse_int* csc_col_ptr,
+                                               rocsparse_action copy_values,
+                                               rocsparse_index_base idx_base,
+                                               void* temp_buffer)
+{
+    return rocsparse_csr2csc_template<rocsparse_float_complex>(handle,
+                                                               m,
+                                                               n,
+                                                               nnz,
+                                                               csr_val,
+                                                               csr_row_ptr,
+                                                               csr_col_ind,
+                                                               csc_val,
+                                                               csc_row_ind,
+                                                               csc_col_ptr,
+                                                               copy_values,
+                                                               idx_base,
+                                                               temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsr2csc(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               rocsparse_int nnz,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_double_complex* csc_val,
+                                               rocsparse_int* csc_row_ind,
+                                               rocsparse_int* csc_col_ptr,
+                                               rocsparse_action copy_values,
+                                               rocsparse_index_base idx_base,
+                                               void* temp_buffer)
+{
+    return rocsparse_csr2csc_template<rocsparse_double_complex>(handle,
+                                                                m,
+                                                                n,
+                                                                nnz,
+                                                                csr_val,
+                                                                csr_row_ptr,
+                                                                csr_col_ind,
+                                                                csc_val,
+                                                                csc_row_ind,
+                                                                csc_col_ptr,
+                                                                copy_values,
+                                                                idx_base,
+                                                                temp_buffer);
+}
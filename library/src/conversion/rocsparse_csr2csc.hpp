@@ -79,18 +79,22 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle handle,
         return rocsparse_status_invalid_value;
     }
 
+    // Check action
+    if(copy_values != rocsparse_action_symbolic && copy_values != rocsparse_action_numeric &&
+       copy_values != rocsparse_action_numeric_conjugate)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
     // Check sizes
     if(m < 0 || n < 0 || nnz < 0)
     {
         return rocsparse_status_invalid_size;
     }
 
-    // Check pointer arguments
-    if(csr_val == nullptr && rocsparse_action_numeric)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_row_ptr == nullptr)
+    // Check pointer arguments, csr_val is NULL for pattern only matrices, in which case
+    // csc_val is not accessed
+    if(csr_row_ptr == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -98,7 +102,7 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle handle,
     {
         return rocsparse_status_invalid_pointer;
     }
-    else if(csc_val == nullptr && copy_values == rocsparse_action_numeric)
+    else if(csc_val == nullptr && csr_val != nullptr && copy_values != rocsparse_action_symbolic)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -115,6 +119,15 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsr2csc",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    n,
+                                    nnz,
+                                    2 * (sizeof(T) + sizeof(rocsparse_int)) * nnz +
+                                        sizeof(rocsparse_int) * (m + n + 2));
+
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
     {
@@ -149,7 +162,8 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle handle,
     RETURN_IF_HIP_ERROR(hipMemcpyAsync(
         tmp_work1, csr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
 
-    if(copy_values == rocsparse_action_symbolic)
+    // Pattern only matrices have no values to permute
+    if(copy_values == rocsparse_action_symbolic || csr_val == nullptr)
     {
         // action symbolic
 
@@ -212,17 +226,34 @@ rocsparse_status rocsparse_csr2csc_template(rocsparse_handle handle,
         dim3 csr2csc_blocks((nnz - 1) / CSR2CSC_DIM + 1);
         dim3 csr2csc_threads(CSR2CSC_DIM);
 
-        hipLaunchKernelGGL((csr2csc_permute_kernel<T>),
-                           csr2csc_blocks,
-                           csr2csc_threads,
-                           0,
-                           stream,
-                           nnz,
-                           tmp_work1,
-                           csr_val,
-                           vals.Current(),
-                           csc_row_ind,
-                           csc_val);
+        if(copy_values == rocsparse_action_numeric_conjugate)
+        {
+            hipLaunchKernelGGL((csr2csc_permute_kernel<T, true>),
+                               csr2csc_blocks,
+                               csr2csc_threads,
+                               0,
+                               stream,
+                               nnz,
+                               tmp_work1,
+                               csr_val,
+                               vals.Current(),
+                               csc_row_ind,
+                               csc_val);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csr2csc_permute_kernel<T, false>),
+                               csr2csc_blocks,
+                               csr2csc_threads,
+                               0,
+                               stream,
+                               nnz,
+                               tmp_work1,
+                               csr_val,
+                               vals.Current(),
+                               csc_row_ind,
+                               csc_val);
+        }
 #undef CSR2CSC_DIM
     }
 
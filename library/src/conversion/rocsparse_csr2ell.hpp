@@ -123,6 +123,14 @@ rocsparse_status rocsparse_csr2ell_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsr2ell",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    0,
+                                    m * ell_width,
+                                    2 * (sizeof(T) + sizeof(rocsparse_int)) * m * ell_width);
+
     // Quick return if possible
     if(m == 0 || ell_width == 0)
     {
@@ -75,3 +75,137 @@ extern "C" rocsparse_status rocsparse_dcsr2hyb(rocsparse_handle handle,
                                       user_ell_width,
                                       partition_type);
 }
+
+extern "C" rocsparse_status rocsparse_ccsr2hyb(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_hyb_mat hyb,
+                                               rocsparse_int user_ell_width,
+                                               rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_csr2hyb_template(handle,
+                                      m,
+                                      n,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      hyb,
+                                      user_ell_width,
+                                      partition_type);
+}
+
+extern "C" rocsparse_status rocsparse_zcsr2hyb(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_hyb_mat hyb,
+                                               rocsparse_int user_ell_width,
+                                               rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_csr2hyb_template(handle,
+                                      m,
+                                      n,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      hyb,
+                                      user_ell_width,
+                                      partition_type);
+}
+
+extern "C" rocsparse_status rocsparse_hcsr2hyb(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_half* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_hyb_mat hyb,
+                                               rocsparse_int user_ell_width,
+                                               rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_csr2hyb_template(handle,
+                                      m,
+                                      n,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      hyb,
+                                      user_ell_width,
+                                      partition_type);
+}
+
+extern "C" rocsparse_status rocsparse_bfcsr2hyb(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int n,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_bfloat16* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_hyb_mat hyb,
+                                                rocsparse_int user_ell_width,
+                                                rocsparse_hyb_partition partition_type)
+{
+    return rocsparse_csr2hyb_template(handle,
+                                      m,
+                                      n,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      hyb,
+                                      user_ell_width,
+                                      partition_type);
+}
+
+extern "C" rocsparse_status rocsparse_scsr2hyb_update(rocsparse_handle handle,
+                                                      const float* csr_val,
+                                                      rocsparse_hyb_mat hyb)
+{
+    return rocsparse_csr2hyb_update_template(handle, csr_val, hyb);
+}
+
+extern "C" rocsparse_status rocsparse_dcsr2hyb_update(rocsparse_handle handle,
+                                                      const double* csr_val,
+                                                      rocsparse_hyb_mat hyb)
+{
+    return rocsparse_csr2hyb_update_template(handle, csr_val, hyb);
+}
+
+extern "C" rocsparse_status rocsparse_ccsr2hyb_update(rocsparse_handle handle,
+                                                      const rocsparse_float_complex* csr_val,
+                                                      rocsparse_hyb_mat hyb)
+{
+    return rocsparse_csr2hyb_update_template(handle, csr_val, hyb);
+}
+
+extern "C" rocsparse_status rocsparse_zcsr2hyb_update(rocsparse_handle handle,
+                                                      const rocsparse_double_complex* csr_val,
+                                                      rocsparse_hyb_mat hyb)
+{
+    return rocsparse_csr2hyb_update_template(handle, csr_val, hyb);
+}
+
+extern "C" rocsparse_status rocsparse_hcsr2hyb_update(rocsparse_handle handle,
+                                                      const rocsparse_half* csr_val,
+                                                      rocsparse_hyb_mat hyb)
+{
+    return rocsparse_csr2hyb_update_template(handle, csr_val, hyb);
+}
+
+extern "C" rocsparse_status rocsparse_bfcsr2hyb_update(rocsparse_handle handle,
+                                                       const rocsparse_bfloat16* csr_val,
+                                                       rocsparse_hyb_mat hyb)
+{
+    return rocsparse_csr2hyb_update_template(handle, csr_val, hyb);
+}
@@ -105,12 +105,8 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
         return rocsparse_status_invalid_size;
     }
 
-    // Check pointer arguments
-    if(csr_val == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_row_ptr == nullptr)
+    // Check pointer arguments, csr_val is NULL for pattern only matrices
+    if(csr_row_ptr == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -119,6 +115,14 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsr2hyb",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    n,
+                                    0,
+                                    sizeof(rocsparse_int) * (m + 1));
+
     // Quick return if possible
     if(m == 0 || n == 0)
     {
@@ -162,26 +166,30 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
     hyb->ell_width = 0;
     hyb->coo_nnz   = 0;
 
-    if(hyb->ell_col_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->ell_col_ind));
-    }
-    if(hyb->ell_val)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
-    }
-    if(hyb->coo_row_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_ind));
-    }
-    if(hyb->coo_col_ind)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_col_ind));
-    }
-    if(hyb->coo_val)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
-    }
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_device_free_memory(hyb->allocator, hyb->ell_col_ind, stream));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(hyb->allocator, hyb->ell_val, stream));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_device_free_memory(hyb->allocator, hyb->coo_row_ind, stream));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_device_free_memory(hyb->allocator, hyb->coo_col_ind, stream));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(hyb->allocator, hyb->coo_val, stream));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(hyb->allocator, hyb->csr_perm, stream));
+
+    hyb->ell_col_ind = nullptr;
+    hyb->ell_val     = nullptr;
+    hyb->coo_row_ind = nullptr;
+    hyb->coo_col_ind = nullptr;
+    hyb->coo_val     = nullptr;
+    hyb->csr_perm    = nullptr;
+
+    // HYB arrays are obtained from the handle allocator
+    hyb->allocator = handle->allocator;
+
+    // Temporary buffers are obtained from the handle workspace
+    rocsparse_workspace_scope workspace_scope(handle);
+
+    hyb->csr_nnz = csr_nnz;
 
 // Determine ELL width
 
@@ -203,7 +211,8 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
     {
         // Allocate workspace
         rocsparse_int* workspace = nullptr;
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace, sizeof(rocsparse_int) * blocks));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(
+            handle, (void**)&workspace, sizeof(rocsparse_int) * blocks));
 
         // HYB == ELL - no COO part - compute maximum nnz per row
         hipLaunchKernelGGL((ell_width_kernel_part1<CSR2ELL_DIM>),
@@ -225,8 +234,6 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
         // Copy ell width back to host
         RETURN_IF_HIP_ERROR(
             hipMemcpy(&hyb->ell_width, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
-
-        RETURN_IF_HIP_ERROR(hipFree(workspace));
     }
 
     // Re-check ELL width
@@ -241,14 +248,21 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
     // Allocate ELL part
     if(hyb->ell_nnz > 0)
     {
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&hyb->ell_col_ind, sizeof(rocsparse_int) * hyb->ell_nnz));
-        RETURN_IF_HIP_ERROR(hipMalloc(&hyb->ell_val, sizeof(T) * hyb->ell_nnz));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_malloc_memory(
+            handle, (void**)&hyb->ell_col_ind, sizeof(rocsparse_int) * hyb->ell_nnz));
+
+        // Pattern only matrices do not store any values
+        if(csr_val != nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_device_malloc_memory(handle, &hyb->ell_val, sizeof(T) * hyb->ell_nnz));
+        }
     }
 
     // Allocate workspace
     rocsparse_int* workspace = NULL;
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace, sizeof(rocsparse_int) * (m + 1)));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_workspace_malloc(handle, (void**)&workspace, sizeof(rocsparse_int) * (m + 1)));
 
     // If there is a COO part, compute the COO non-zero elements per row
     if(partition_type != rocsparse_hyb_partition_max)
@@ -282,15 +296,13 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
                 d_temp_storage, temp_storage_bytes, workspace, workspace, m + 1));
 
             // Allocate hipcub buffer
-            RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_workspace_malloc(handle, &d_temp_storage, temp_storage_bytes));
 
             // Do inclusive sum
             RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
                 d_temp_storage, temp_storage_bytes, workspace, workspace, m + 1));
 
-            // Clear hipcub buffer
-            RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
-
             // Obtain coo nnz from workspace
             RETURN_IF_HIP_ERROR(hipMemcpy(
                 &hyb->coo_nnz, workspace + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
@@ -302,36 +314,163 @@ rocsparse_status rocsparse_csr2hyb_template(rocsparse_handle handle,
     // Allocate COO part
     if(hyb->coo_nnz > 0)
     {
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&hyb->coo_row_ind, sizeof(rocsparse_int) * hyb->coo_nnz));
-        RETURN_IF_HIP_ERROR(
-            hipMalloc((void**)&hyb->coo_col_ind, sizeof(rocsparse_int) * hyb->coo_nnz));
-        RETURN_IF_HIP_ERROR(hipMalloc(&hyb->coo_val, sizeof(T) * hyb->coo_nnz));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_malloc_memory(
+            handle, (void**)&hyb->coo_row_ind, sizeof(rocsparse_int) * hyb->coo_nnz));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_malloc_memory(
+            handle, (void**)&hyb->coo_col_ind, sizeof(rocsparse_int) * hyb->coo_nnz));
+
+        // Pattern only matrices do not store any values
+        if(csr_val != nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(
+                rocsparse_device_malloc_memory(handle, &hyb->coo_val, sizeof(T) * hyb->coo_nnz));
+        }
+    }
+
+    // Allocate mapping for subsequent value updates
+    rocsparse_int* ell_perm = nullptr;
+    rocsparse_int* coo_perm = nullptr;
+
+    if(hyb->update == rocsparse_hyb_update_values && hyb->ell_nnz + hyb->coo_nnz > 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_device_malloc_memory(handle,
+                                           (void**)&hyb->csr_perm,
+                                           sizeof(rocsparse_int) * (hyb->ell_nnz + hyb->coo_nnz)));
+
+        ell_perm = hyb->csr_perm;
+        coo_perm = hyb->csr_perm + hyb->ell_nnz;
     }
 
     dim3 csr2ell_blocks((m - 1) / CSR2ELL_DIM + 1);
     dim3 csr2ell_threads(CSR2ELL_DIM);
 
-    hipLaunchKernelGGL((csr2hyb_kernel<T>),
-                       csr2ell_blocks,
-                       csr2ell_threads,
+    if(csr_val == nullptr)
+    {
+        // Pattern only matrix, only the index structure is converted
+        hipLaunchKernelGGL((csr2hyb_kernel<rocsparse_pattern_value>),
+                           csr2ell_blocks,
+                           csr2ell_threads,
+                           0,
+                           stream,
+                           m,
+                           static_cast<const rocsparse_pattern_value*>(nullptr),
+                           csr_row_ptr,
+                           csr_col_ind,
+                           hyb->ell_width,
+                           hyb->ell_col_ind,
+                           static_cast<rocsparse_pattern_value*>(nullptr),
+                           hyb->coo_row_ind,
+                           hyb->coo_col_ind,
+                           static_cast<rocsparse_pattern_value*>(nullptr),
+                           workspace,
+                           ell_perm,
+                           coo_perm,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csr2hyb_kernel<T>),
+                           csr2ell_blocks,
+                           csr2ell_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_val,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           hyb->ell_width,
+                           hyb->ell_col_ind,
+                           (T*)hyb->ell_val,
+                           hyb->coo_row_ind,
+                           hyb->coo_col_ind,
+                           (T*)hyb->coo_val,
+                           workspace,
+                           ell_perm,
+                           coo_perm,
+                           descr->base);
+    }
+#undef CSR2ELL_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2hyb_update_template(rocsparse_handle handle,
+                                                   const T* csr_val,
+                                                   rocsparse_hyb_mat hyb)
+{
+    // Check for valid handle and HYB matrix
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(hyb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2hyb_update"),
+              (const void*&)csr_val,
+              (const void*&)hyb);
+
+    log_bench(
+        handle, "./rocsparse-bench -f csr2hyb_update -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsr2hyb_update",
+                                    rocsparse_precision_string<T>(),
+                                    hyb->m,
+                                    hyb->n,
+                                    hyb->csr_nnz,
+                                    (2 * sizeof(T) + sizeof(rocsparse_int)) * hyb->csr_nnz);
+
+    // Quick return if possible
+    if(hyb->csr_nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // HYB matrix must have been converted with the value update mapping
+    if(hyb->csr_perm == nullptr)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Pattern only HYB matrices do not hold any values that could be updated
+    if((hyb->ell_nnz > 0 && hyb->ell_val == nullptr) ||
+       (hyb->coo_nnz > 0 && hyb->coo_val == nullptr))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSR2HYB_UPDATE_DIM 512
+    dim3 csr2hyb_blocks((hyb->ell_nnz + hyb->coo_nnz - 1) / CSR2HYB_UPDATE_DIM + 1);
+    dim3 csr2hyb_threads(CSR2HYB_UPDATE_DIM);
+
+    hipLaunchKernelGGL((csr2hyb_update_kernel<T>),
+                       csr2hyb_blocks,
+                       csr2hyb_threads,
                        0,
                        stream,
-                       m,
+                       hyb->ell_nnz,
+                       hyb->coo_nnz,
+                       hyb->csr_perm,
                        csr_val,
-                       csr_row_ptr,
-                       csr_col_ind,
-                       hyb->ell_width,
-                       hyb->ell_col_ind,
                        (T*)hyb->ell_val,
-                       hyb->coo_row_ind,
-                       hyb->coo_col_ind,
-                       (T*)hyb->coo_val,
-                       workspace,
-                       descr->base);
-
-    RETURN_IF_HIP_ERROR(hipFree(workspace));
-#undef CSR2ELL_DIM
+                       (T*)hyb->coo_val);
+#undef CSR2HYB_UPDATE_DIM
 
     return rocsparse_status_success;
 }
@@ -0,0 +1,283 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSR2PCSR_HPP
+#define ROCSPARSE_CSR2PCSR_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "csr2pcsr_device.h"
+
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+#include <limits>
+
+// Number of consecutive rows that share a column base
+#define PCSR_BLOCK_DIM 32
+
+template <typename D>
+static void rocsparse_csr2pcsr_delta(rocsparse_handle handle,
+                                     rocsparse_int m,
+                                     rocsparse_int nblocks,
+                                     const rocsparse_mat_descr descr,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     rocsparse_pcsr_mat pcsr)
+{
+#define CSR2PCSR_DIM 64
+    hipLaunchKernelGGL((csr2pcsr_delta_kernel<CSR2PCSR_DIM, D>),
+                       dim3(nblocks),
+                       dim3(CSR2PCSR_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       pcsr->block_dim,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       pcsr->col_base,
+                       (D*)pcsr->col_delta,
+                       descr->base);
+#undef CSR2PCSR_DIM
+}
+
+template <typename T>
+rocsparse_status rocsparse_csr2pcsr_template(rocsparse_handle handle,
+                                             rocsparse_int m,
+                                             rocsparse_int n,
+                                             const rocsparse_mat_descr descr,
+                                             const T* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_pcsr_mat pcsr)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(pcsr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsr2pcsr"),
+              m,
+              n,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)pcsr);
+
+    log_bench(handle, "./rocsparse-bench -f pcsrmv -r", replaceX<T>("X"), "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments, csr_val is NULL for pattern only matrices
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsr2pcsr",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    n,
+                                    0,
+                                    sizeof(rocsparse_int) * (m + 1));
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Get number of CSR non-zeros
+    rocsparse_int nnz;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&nnz, csr_row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    // Correct by index base
+    nnz -= descr->base;
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Clear PCSR structure if already allocated
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(pcsr->allocator, pcsr->row_ptr, stream));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_device_free_memory(pcsr->allocator, pcsr->col_base, stream));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_device_free_memory(pcsr->allocator, pcsr->col_delta, stream));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(pcsr->allocator, pcsr->val, stream));
+
+    pcsr->m          = m;
+    pcsr->n          = n;
+    pcsr->nnz        = nnz;
+    pcsr->block_dim  = PCSR_BLOCK_DIM;
+    pcsr->delta_size = 0;
+    pcsr->row_ptr    = nullptr;
+    pcsr->col_base   = nullptr;
+    pcsr->col_delta  = nullptr;
+    pcsr->val        = nullptr;
+
+    // PCSR arrays are obtained from the handle allocator
+    pcsr->allocator = handle->allocator;
+
+    // Temporary buffers are obtained from the handle workspace
+    rocsparse_workspace_scope workspace_scope(handle);
+
+    rocsparse_int nblocks = (m - 1) / PCSR_BLOCK_DIM + 1;
+
+    // Row offsets are kept as they are
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_malloc_memory(
+        handle, (void**)&pcsr->row_ptr, sizeof(rocsparse_int) * (m + 1)));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(pcsr->row_ptr,
+                                       csr_row_ptr,
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+
+    // Column base and column range of each row block
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_malloc_memory(
+        handle, (void**)&pcsr->col_base, sizeof(rocsparse_int) * nblocks));
+
+    rocsparse_int* col_range;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(
+        handle, (void**)&col_range, sizeof(rocsparse_int) * (nblocks + 1)));
+
+#define CSR2PCSR_DIM 64
+    hipLaunchKernelGGL((csr2pcsr_range_kernel<CSR2PCSR_DIM>),
+                       dim3(nblocks),
+                       dim3(CSR2PCSR_DIM),
+                       0,
+                       stream,
+                       m,
+                       pcsr->block_dim,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       pcsr->col_base,
+                       col_range,
+                       descr->base);
+#undef CSR2PCSR_DIM
+
+    // Largest column range of all row blocks
+    size_t size = 0;
+    void* tmp_hipcub;
+
+    RETURN_IF_HIP_ERROR(
+        hipcub::DeviceReduce::Max(nullptr, size, col_range, col_range + nblocks, nblocks, stream));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(handle, &tmp_hipcub, size));
+    RETURN_IF_HIP_ERROR(hipcub::DeviceReduce::Max(
+        tmp_hipcub, size, col_range, col_range + nblocks, nblocks, stream));
+
+    rocsparse_int max_range;
+    RETURN_IF_HIP_ERROR(hipMemcpy(
+        &max_range, col_range + nblocks, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    // Narrowest column delta type that can represent all column ranges
+    if(max_range <= std::numeric_limits<unsigned char>::max())
+    {
+        pcsr->delta_size = sizeof(unsigned char);
+    }
+    else if(max_range <= std::numeric_limits<unsigned short>::max())
+    {
+        pcsr->delta_size = sizeof(unsigned short);
+    }
+    else
+    {
+        pcsr->delta_size = sizeof(rocsparse_int);
+    }
+
+    // Quick return if there are no entries to be stored
+    if(nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_device_malloc_memory(handle, &pcsr->col_delta, pcsr->delta_size * nnz));
+
+    if(pcsr->delta_size == sizeof(unsigned char))
+    {
+        rocsparse_csr2pcsr_delta<unsigned char>(
+            handle, m, nblocks, descr, csr_row_ptr, csr_col_ind, pcsr);
+    }
+    else if(pcsr->delta_size == sizeof(unsigned short))
+    {
+        rocsparse_csr2pcsr_delta<unsigned short>(
+            handle, m, nblocks, descr, csr_row_ptr, csr_col_ind, pcsr);
+    }
+    else
+    {
+        rocsparse_csr2pcsr_delta<rocsparse_int>(
+            handle, m, nblocks, descr, csr_row_ptr, csr_col_ind, pcsr);
+    }
+
+    // Pattern only matrices do not store any values
+    if(csr_val != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_device_malloc_memory(handle, &pcsr->val, sizeof(T) * nnz));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            pcsr->val, csr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSR2PCSR_HPP
@@ -186,6 +186,14 @@ extern "C" rocsparse_status rocsparse_csrsort(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_csrsort",
+                                    "",
+                                    m,
+                                    n,
+                                    nnz,
+                                    4 * sizeof(rocsparse_int) * nnz);
+
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
     {
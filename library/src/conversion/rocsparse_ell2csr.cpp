@@ -116,6 +116,14 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle handle,
 
     hipStream_t stream = handle->stream;
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_ell2csr_nnz",
+                                    "",
+                                    m,
+                                    n,
+                                    m * ell_width,
+                                    sizeof(rocsparse_int) * (m * ell_width + m + 1));
+
     // Quick return if possible
     if(m == 0 || n == 0 || ell_width == 0)
     {
@@ -157,19 +165,19 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle handle,
         nullptr, temp_storage_bytes, csr_row_ptr, csr_row_ptr, m + 1));
 
     // Get hipcub buffer
-    bool d_temp_alloc;
     void* d_temp_storage;
+    rocsparse_workspace_scope workspace_scope(handle);
 
     // Device buffer should be sufficient for hipcub in most cases
+    RETURN_IF_ROCSPARSE_ERROR(handle->init_buffer());
     if(handle->buffer_size >= temp_storage_bytes)
     {
         d_temp_storage = handle->buffer;
-        d_temp_alloc   = false;
     }
     else
     {
-        RETURN_IF_HIP_ERROR(hipMalloc(&d_temp_storage, temp_storage_bytes));
-        d_temp_alloc = true;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_workspace_malloc(handle, &d_temp_storage, temp_storage_bytes));
     }
 
     // Perform actual inclusive sum
@@ -210,12 +218,6 @@ extern "C" rocsparse_status rocsparse_ell2csr_nnz(rocsparse_handle handle,
         }
     }
 
-    // Free hipcub buffer, if allocated
-    if(d_temp_alloc == true)
-    {
-        RETURN_IF_HIP_ERROR(hipFree(d_temp_storage));
-    }
-
     return rocsparse_status_success;
 }
 
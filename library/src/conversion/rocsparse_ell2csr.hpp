@@ -126,6 +126,14 @@ rocsparse_status rocsparse_ell2csr_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xell2csr",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    n,
+                                    m * ell_width,
+                                    2 * (sizeof(T) + sizeof(rocsparse_int)) * m * ell_width);
+
     // Quick return if possible
     if(m == 0 || n == 0 || ell_width == 0)
     {
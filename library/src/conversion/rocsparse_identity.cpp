@@ -54,6 +54,14 @@ rocsparse_create_identity_permutation(rocsparse_handle handle, rocsparse_int n,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_create_identity_permutation",
+                                    "",
+                                    n,
+                                    0,
+                                    0,
+                                    sizeof(rocsparse_int) * n);
+
     // Quick return if possible
     if(n == 0)
     {
@@ -24,10 +24,13 @@
 #include "definitions.h"
 #include "handle.h"
 #include "logging.h"
+#include "trace.h"
 
 #include <hip/hip_runtime.h>
+#include <string.h>
 
-__global__ void init_kernel() {};
+// Maximum number of analysis meta data structures that are cached per handle
+#define ANALYSIS_CACHE_SIZE 8
 
 /*******************************************************************************
  * constructor
@@ -36,10 +39,11 @@ _rocsparse_handle::_rocsparse_handle()
 {
     // Default device is active device
     THROW_IF_HIP_ERROR(hipGetDevice(&device));
-    THROW_IF_HIP_ERROR(hipGetDeviceProperties(&properties, device));
 
-    // Device wavefront size
-    wavefront_size = properties.warpSize;
+    // Device wavefront size, querying a single attribute is much cheaper than
+    // obtaining all device properties
+    THROW_IF_HIP_ERROR(
+        hipDeviceGetAttribute(&wavefront_size, hipDeviceAttributeWarpSize, device));
 
     // Layer mode
     char* str_layer_mode;
@@ -52,41 +56,42 @@ _rocsparse_handle::_rocsparse_handle()
         layer_mode = (rocsparse_layer_mode)(atoi(str_layer_mode));
     }
 
-    // Obtain size for coomv device buffer
-    rocsparse_int nthreads = properties.maxThreadsPerBlock;
-    rocsparse_int nprocs   = properties.multiProcessorCount;
-    rocsparse_int nblocks  = (nprocs * nthreads - 1) / 128 + 1;
-    rocsparse_int nwfs     = nblocks * (128 / properties.warpSize);
-
-    size_t coomv_size = (((sizeof(rocsparse_int) + 16) * nwfs - 1) / 256 + 1) * 256;
-
-    // Allocate device buffer
-    buffer_size = (coomv_size > 1024 * 1024) ? coomv_size : 1024 * 1024;
-    THROW_IF_HIP_ERROR(hipMalloc(&buffer, buffer_size));
-
-    // Device one
-    THROW_IF_HIP_ERROR(hipMalloc(&sone, sizeof(float)));
-    THROW_IF_HIP_ERROR(hipMalloc(&done, sizeof(double)));
+    // Open log file, binary logging is recorded in per thread trace buffers
+    if((layer_mode & rocsparse_layer_mode_log_trace) &&
+       !(layer_mode & rocsparse_layer_mode_log_binary))
+    {
+        open_log_stream(&log_trace_os, &log_trace_ofs, "ROCSPARSE_LOG_TRACE_PATH");
+    }
 
-    // Execute empty kernel for initialization
-    hipLaunchKernelGGL(init_kernel, dim3(1), dim3(1), 0, 0);
+    // Open log_bench file
+    if((layer_mode & rocsparse_layer_mode_log_bench) &&
+       !(layer_mode & rocsparse_layer_mode_log_binary))
+    {
+        open_log_stream(&log_bench_os, &log_bench_ofs, "ROCSPARSE_LOG_BENCH_PATH");
+    }
 
-    float hsone  = 1.0f;
-    double hdone = 1.0;
+    // Open log_profile file, the summary is written as JSON to .json files
+    if(layer_mode & rocsparse_layer_mode_log_profile)
+    {
+        open_log_stream(&log_profile_os, &log_profile_ofs, "ROCSPARSE_LOG_PROFILE_PATH");
 
-    THROW_IF_HIP_ERROR(hipMemcpy(sone, &hsone, sizeof(float), hipMemcpyHostToDevice));
-    THROW_IF_HIP_ERROR(hipMemcpy(done, &hdone, sizeof(double), hipMemcpyHostToDevice));
+        const char* path = getenv("ROCSPARSE_LOG_PROFILE_PATH");
+        size_t len       = (path != NULL) ? strlen(path) : 0;
 
-    // Open log file
-    if(layer_mode & rocsparse_layer_mode_log_trace)
-    {
-        open_log_stream(&log_trace_os, &log_trace_ofs, "ROCSPARSE_LOG_TRACE_PATH");
+        if(len >= 5 && strcmp(path + len - 5, ".json") == 0)
+        {
+            log_profile_format = rocsparse_profile_format_json;
+        }
     }
 
-    // Open log_bench file
+    // Operands of log_bench calls are captured into ROCSPARSE_CAPTURE_PATH
     if(layer_mode & rocsparse_layer_mode_log_bench)
     {
-        open_log_stream(&log_bench_os, &log_bench_ofs, "ROCSPARSE_LOG_BENCH_PATH");
+        const char* path   = getenv("ROCSPARSE_CAPTURE_PATH");
+        const char* filter = getenv("ROCSPARSE_CAPTURE_FILTER");
+
+        capture_path   = (path != NULL) ? path : "";
+        capture_filter = (filter != NULL) ? filter : "";
     }
 }
 
@@ -95,9 +100,36 @@ _rocsparse_handle::_rocsparse_handle()
  ******************************************************************************/
 _rocsparse_handle::~_rocsparse_handle()
 {
-    PRINT_IF_HIP_ERROR(hipFree(buffer));
-    PRINT_IF_HIP_ERROR(hipFree(sone));
-    PRINT_IF_HIP_ERROR(hipFree(done));
+    // Release cached analysis meta data
+    for(size_t i = 0; i < csrmv_cache.size(); ++i)
+    {
+        rocsparse_destroy_csrmv_info(csrmv_cache[i]);
+    }
+    for(size_t i = 0; i < csrtr_cache.size(); ++i)
+    {
+        rocsparse_destroy_csrtr_info(csrtr_cache[i]);
+    }
+
+    // Write profile summary
+    if(layer_mode & rocsparse_layer_mode_log_profile)
+    {
+        profile.write(*log_profile_os, log_profile_format);
+    }
+
+    // Flush binary trace records of the calling thread
+    if(layer_mode & rocsparse_layer_mode_log_binary)
+    {
+        rocsparse_trace_flush();
+    }
+
+    // Release workspace
+    rocsparse_workspace_release(this);
+
+    // Device ones are part of the device buffer
+    if(buffer != nullptr)
+    {
+        PRINT_IF_HIP_ERROR(hipFree(buffer));
+    }
 
     // Close log files
     if(log_trace_ofs.is_open())
@@ -108,6 +140,64 @@ _rocsparse_handle::~_rocsparse_handle()
     {
         log_bench_ofs.close();
     }
+    if(log_profile_ofs.is_open())
+    {
+        log_profile_ofs.close();
+    }
+}
+
+/*******************************************************************************
+ * init buffer:
+   Handle creation does not touch the device beyond querying the device id and
+   the wavefront size. Device properties, the device buffer and the device ones
+   are set up by the first routine that requires them.
+ ******************************************************************************/
+rocsparse_status _rocsparse_handle::init_buffer()
+{
+    if(buffer != nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_HIP_ERROR(hipGetDeviceProperties(&properties, device));
+
+    // Obtain size for coomv device buffer
+    rocsparse_int nthreads = properties.maxThreadsPerBlock;
+    rocsparse_int nprocs   = properties.multiProcessorCount;
+    rocsparse_int nblocks  = (nprocs * nthreads - 1) / 128 + 1;
+    rocsparse_int nwfs     = nblocks * (128 / properties.warpSize);
+
+    size_t coomv_size = (((sizeof(rocsparse_int) + 16) * nwfs - 1) / 256 + 1) * 256;
+    size_t size       = (coomv_size > 1024 * 1024) ? coomv_size : 1024 * 1024;
+
+    // Device ones are stored in 16 byte slots behind the buffer, such that a
+    // single allocation and a single copy are sufficient
+    alignas(16) char hone[64] = {};
+
+    *reinterpret_cast<float*>(hone)       = 1.0f;
+    *reinterpret_cast<double*>(hone + 16) = 1.0;
+
+    *reinterpret_cast<rocsparse_float_complex*>(hone + 32) = rocsparse_float_complex(1.0f, 0.0f);
+    *reinterpret_cast<rocsparse_double_complex*>(hone + 48) = rocsparse_double_complex(1.0, 0.0);
+
+    char* ptr = nullptr;
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&ptr, size + sizeof(hone)));
+
+    hipError_t err = hipMemcpy(ptr + size, hone, sizeof(hone), hipMemcpyHostToDevice);
+    if(err != hipSuccess)
+    {
+        hipFree(ptr);
+        return get_rocsparse_status_for_hip_status(err);
+    }
+
+    buffer_size = size;
+    buffer      = ptr;
+    sone        = reinterpret_cast<float*>(ptr + size);
+    done        = reinterpret_cast<double*>(ptr + size + 16);
+    cone        = reinterpret_cast<rocsparse_float_complex*>(ptr + size + 32);
+    zone        = reinterpret_cast<rocsparse_double_complex*>(ptr + size + 48);
+
+    return rocsparse_status_success;
 }
 
 /*******************************************************************************
@@ -122,6 +212,14 @@ _rocsparse_handle::~_rocsparse_handle()
 rocsparse_status _rocsparse_handle::set_stream(hipStream_t user_stream)
 {
     // TODO check if stream is valid
+
+    // The workspace is reused in stream order, thus pending work on the previous
+    // stream has to finish before the workspace can be used by another stream
+    if(user_stream != stream && workspace.size > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
     stream = user_stream;
     return rocsparse_status_success;
 }
@@ -163,7 +261,8 @@ rocsparse_status rocsparse_create_csrmv_info(rocsparse_csrmv_info* info)
 }
 
 /********************************************************************************
- * \brief Destroy csrmv info.
+ * \brief Destroy csrmv info. If the info is shared, only the reference is
+ * released.
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
 {
@@ -172,10 +271,16 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
         return rocsparse_status_success;
     }
 
+    // Release reference
+    if(--info->use_count > 0)
+    {
+        return rocsparse_status_success;
+    }
+
     // Clean up row blocks
     if(info->size > 0)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->row_blocks));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(info->allocator, info->row_blocks));
     }
 
     // Destruct
@@ -190,6 +295,58 @@ rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Look up csrmv info with matching sparsity pattern and operation in the
+ * handle cache. On success, a new reference to the shared info is returned,
+ * otherwise nullptr.
+ *******************************************************************************/
+rocsparse_csrmv_info rocsparse_find_csrmv_info(rocsparse_handle handle,
+                                               const rocsparse_pattern_key& key,
+                                               rocsparse_operation trans)
+{
+    for(size_t i = 0; i < handle->csrmv_cache.size(); ++i)
+    {
+        rocsparse_csrmv_info info = handle->csrmv_cache[i];
+
+        if(info->key == key && info->trans == trans)
+        {
+            ++info->use_count;
+            return info;
+        }
+    }
+
+    return nullptr;
+}
+
+/********************************************************************************
+ * \brief Insert csrmv info into the handle cache. The least recently inserted
+ * entry is released if the cache is full.
+ *******************************************************************************/
+rocsparse_status rocsparse_cache_csrmv_info(rocsparse_handle handle, rocsparse_csrmv_info info)
+{
+    // Replace outdated entry of the same pattern
+    for(size_t i = 0; i < handle->csrmv_cache.size(); ++i)
+    {
+        if(handle->csrmv_cache[i]->key == info->key && handle->csrmv_cache[i]->trans == info->trans)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(handle->csrmv_cache[i]));
+            handle->csrmv_cache.erase(handle->csrmv_cache.begin() + i);
+            break;
+        }
+    }
+
+    if(handle->csrmv_cache.size() == ANALYSIS_CACHE_SIZE)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(handle->csrmv_cache.front()));
+        handle->csrmv_cache.erase(handle->csrmv_cache.begin());
+    }
+
+    ++info->use_count;
+    handle->csrmv_cache.push_back(info);
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  * \brief rocsparse_csrtr_info is a structure holding the rocsparse csrsv and
  * csrilu0 data gathered during csrsv_analysis and csrilu0_analysis. It must be
@@ -218,7 +375,8 @@ rocsparse_status rocsparse_create_csrtr_info(rocsparse_csrtr_info* info)
 }
 
 /********************************************************************************
- * \brief Destroy csrmv info.
+ * \brief Destroy csrtr info. If the info is shared, only the reference is
+ * released.
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info)
 {
@@ -227,11 +385,20 @@ rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info)
         return rocsparse_status_success;
     }
 
-    // Clean up
+    // Release reference
+    if(--info->use_count > 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up, row map, diagonal entry points and structural zero pivot share one
+    // allocation
     if(info->d_row_map != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->d_row_map));
-        info->d_row_map = nullptr;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(info->allocator, info->d_row_map));
+        info->d_row_map        = nullptr;
+        info->csr_diag_ind     = nullptr;
+        info->structural_pivot = nullptr;
     }
 
     if(info->h_row_map != nullptr)
@@ -240,16 +407,190 @@ rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info)
         info->h_row_map = nullptr;
     }
 
-    if(info->csr_diag_ind != nullptr)
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Look up csrtr info with matching sparsity pattern and fill mode in the
+ * handle cache. On success, a new reference to the shared info is returned,
+ * otherwise nullptr.
+ *******************************************************************************/
+rocsparse_csrtr_info rocsparse_find_csrtr_info(rocsparse_handle handle,
+                                               const rocsparse_pattern_key& key,
+                                               rocsparse_fill_mode fill_mode)
+{
+    for(size_t i = 0; i < handle->csrtr_cache.size(); ++i)
+    {
+        rocsparse_csrtr_info info = handle->csrtr_cache[i];
+
+        if(info->key == key && info->fill_mode == fill_mode)
+        {
+            ++info->use_count;
+            return info;
+        }
+    }
+
+    return nullptr;
+}
+
+/********************************************************************************
+ * \brief Insert csrtr info into the handle cache. The least recently inserted
+ * entry is released if the cache is full.
+ *******************************************************************************/
+rocsparse_status rocsparse_cache_csrtr_info(rocsparse_handle handle, rocsparse_csrtr_info info)
+{
+    // Replace outdated entry of the same pattern
+    for(size_t i = 0; i < handle->csrtr_cache.size(); ++i)
+    {
+        if(handle->csrtr_cache[i]->key == info->key &&
+           handle->csrtr_cache[i]->fill_mode == info->fill_mode)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(handle->csrtr_cache[i]));
+            handle->csrtr_cache.erase(handle->csrtr_cache.begin() + i);
+            break;
+        }
+    }
+
+    if(handle->csrtr_cache.size() == ANALYSIS_CACHE_SIZE)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(handle->csrtr_cache.front()));
+        handle->csrtr_cache.erase(handle->csrtr_cache.begin());
+    }
+
+    ++info->use_count;
+    handle->csrtr_cache.push_back(info);
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_reorder_info is a structure holding the multicolor reordering
+ * of a matrix, computed by the csrsv and csrilu0 analysis for
+ * rocsparse_solve_policy_multicolor. It must be initialized using the
+ * rocsparse_create_reorder_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_reorder_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_reorder_info(rocsparse_reorder_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_reorder_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy reorder info, including the analysis data of the reordered
+ * matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_reorder_info(rocsparse_reorder_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clean up, permutation, reordered pattern and map share one allocation
+    if(info->perm != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(info->allocator, info->perm));
+        info->perm        = nullptr;
+        info->csr_row_ptr = nullptr;
+        info->csr_col_ind = nullptr;
+        info->map         = nullptr;
+    }
+
+    // Analysis data of the reordered matrix
+    if(info->info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(info->info));
+        info->info = nullptr;
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_cscmspv_info is a structure holding the row wise sparsity
+ * pattern and the sparse accumulator of a matrix, computed by
+ * rocsparse_cscmspv_analysis(). It must be initialized using the
+ * rocsparse_create_cscmspv_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_cscmspv_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_cscmspv_info(rocsparse_cscmspv_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_cscmspv_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy cscmspv info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_cscmspv_info(rocsparse_cscmspv_info info)
+{
+    if(info == nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->csr_diag_ind));
-        info->csr_diag_ind = nullptr;
+        return rocsparse_status_success;
     }
 
-    if(info->zero_pivot != nullptr)
+    // Clean up, all device arrays share one allocation
+    if(info->csr_row_ptr != nullptr)
     {
-        RETURN_IF_HIP_ERROR(hipFree(info->zero_pivot));
-        info->zero_pivot = nullptr;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(info->allocator, info->csr_row_ptr));
+        info->csr_row_ptr = nullptr;
+        info->csr_col_ind = nullptr;
+        info->map         = nullptr;
+        info->acc         = nullptr;
+        info->flag        = nullptr;
+        info->list        = nullptr;
+        info->count       = nullptr;
+        info->x           = nullptr;
+        info->xflag       = nullptr;
     }
 
     // Destruct
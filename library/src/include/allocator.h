@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ALLOCATOR_H
+#define ALLOCATOR_H
+
+#include "rocsparse.h"
+
+#include <vector>
+#include <hip/hip_runtime_api.h>
+
+/********************************************************************************
+ * \brief rocsparse_allocator holds the device memory callbacks of a handle.
+ * Structures that own device memory keep a copy of the allocator that has been
+ * used, such that the memory can be released without access to the handle.
+ *******************************************************************************/
+struct rocsparse_allocator
+{
+    // allocation callbacks, nullptr for hipMalloc and hipFree
+    rocsparse_device_malloc malloc_func = nullptr;
+    rocsparse_device_free free_func     = nullptr;
+    void* user_data                     = nullptr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_workspace is a growable arena of temporary device memory that
+ * is owned by the handle. Temporary buffers are carved from the arena and are
+ * valid until the enclosing rocsparse_workspace_scope ends. Requests that exceed
+ * the arena are served by separate allocations and the arena grows to the peak
+ * demand at the begin of the next library call. Since all work of a handle is
+ * enqueued into its stream, the arena can be reused without synchronization.
+ *******************************************************************************/
+struct rocsparse_workspace
+{
+    // arena
+    void* base    = nullptr;
+    size_t size   = 0;
+    size_t offset = 0;
+
+    // nesting depth of workspace scopes
+    int depth = 0;
+
+    // allocations that have been required while the arena was exhausted
+    std::vector<void*> overflow;
+    size_t overflow_size = 0;
+
+    // peak demand of the current library call
+    size_t peak = 0;
+
+    // statistics
+    size_t high_water = 0;
+    size_t requests   = 0;
+};
+
+/********************************************************************************
+ * \brief Allocate persistent device memory through the handle allocator.
+ *******************************************************************************/
+rocsparse_status rocsparse_device_malloc_memory(rocsparse_handle handle, void** ptr, size_t size);
+
+/********************************************************************************
+ * \brief Release device memory that has been obtained from the given allocator.
+ *******************************************************************************/
+rocsparse_status rocsparse_device_free_memory(const rocsparse_allocator& allocator,
+                                              void* ptr,
+                                              hipStream_t stream = 0);
+
+/********************************************************************************
+ * \brief Obtain a temporary device buffer from the handle workspace. The buffer
+ * is valid until the enclosing rocsparse_workspace_scope ends.
+ *******************************************************************************/
+rocsparse_status rocsparse_workspace_malloc(rocsparse_handle handle, void** ptr, size_t size);
+
+/********************************************************************************
+ * \brief Release the handle workspace, e.g. before the allocator is changed.
+ *******************************************************************************/
+rocsparse_status rocsparse_workspace_release(rocsparse_handle handle);
+
+/********************************************************************************
+ * \brief rocsparse_workspace_scope marks the lifetime of temporary buffers that
+ * are obtained from the handle workspace. When the outermost scope is left, all
+ * temporary buffers are returned to the workspace.
+ *******************************************************************************/
+class rocsparse_workspace_scope
+{
+public:
+    explicit rocsparse_workspace_scope(rocsparse_handle handle);
+    ~rocsparse_workspace_scope();
+
+private:
+    rocsparse_handle handle;
+    size_t offset;
+};
+
+#endif // ALLOCATOR_H
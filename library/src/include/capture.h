@@ -0,0 +1,383 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include "rocsparse.h"
+#include "capture_format.h"
+#include "handle.h"
+
+#include <string>
+#include <vector>
+
+// Placeholder that is logged if operands are not captured
+#define ROCSPARSE_CAPTURE_NONE "<matrix.mtx>"
+
+/********************************************************************************
+ * \brief rocsparse_capture_array describes an array of a capture, arrays are in
+ * device memory unless host is set.
+ *******************************************************************************/
+struct rocsparse_capture_array
+{
+    const void* ptr;
+    size_t size;
+    bool host;
+};
+
+/********************************************************************************
+ * \brief Check whether the operands of routine are captured. Operands are
+ * captured if bench logging is active and ROCSPARSE_CAPTURE_PATH is set, and
+ * the routine matches ROCSPARSE_CAPTURE_FILTER.
+ *******************************************************************************/
+bool rocsparse_capture_begin(rocsparse_handle handle, const char* routine);
+
+/********************************************************************************
+ * \brief Write header and device arrays to a capture file and return its name.
+ * Waits for the handle stream, such that the operands are complete. Operands
+ * whose content has been captured by the handle before are not written again,
+ * the name of the existing capture is returned instead. Returns
+ * ROCSPARSE_CAPTURE_NONE on failure.
+ *******************************************************************************/
+std::string rocsparse_capture_write(rocsparse_handle handle,
+                                    const char* routine,
+                                    const rocsparse_capture_header& header,
+                                    const std::vector<rocsparse_capture_array>& arrays);
+
+// Capture value type of T
+template <typename T>
+inline rocsparse_capture_value rocsparse_capture_value_type();
+
+template <>
+inline rocsparse_capture_value rocsparse_capture_value_type<float>()
+{
+    return rocsparse_capture_value_float;
+}
+
+template <>
+inline rocsparse_capture_value rocsparse_capture_value_type<double>()
+{
+    return rocsparse_capture_value_double;
+}
+
+template <>
+inline rocsparse_capture_value rocsparse_capture_value_type<rocsparse_float_complex>()
+{
+    return rocsparse_capture_value_float_complex;
+}
+
+template <>
+inline rocsparse_capture_value rocsparse_capture_value_type<rocsparse_double_complex>()
+{
+    return rocsparse_capture_value_double_complex;
+}
+
+template <>
+inline rocsparse_capture_value rocsparse_capture_value_type<rocsparse_half>()
+{
+    return rocsparse_capture_value_half;
+}
+
+template <>
+inline rocsparse_capture_value rocsparse_capture_value_type<rocsparse_bfloat16>()
+{
+    return rocsparse_capture_value_bfloat16;
+}
+
+template <typename T>
+inline rocsparse_capture_header rocsparse_capture_make_header(rocsparse_capture_format format,
+                                                              rocsparse_index_base idx_base,
+                                                              rocsparse_int m,
+                                                              rocsparse_int n,
+                                                              rocsparse_int nnz,
+                                                              rocsparse_int ell_width)
+{
+    rocsparse_capture_header header;
+
+    header.magic      = ROCSPARSE_CAPTURE_MAGIC;
+    header.version    = ROCSPARSE_CAPTURE_VERSION;
+    header.format     = format;
+    header.value_type = rocsparse_capture_value_type<T>();
+    header.index_size = sizeof(rocsparse_int);
+    header.idx_base   = idx_base;
+    header.m          = m;
+    header.n          = n;
+    header.nnz        = nnz;
+    header.ell_width  = ell_width;
+
+    return header;
+}
+
+/********************************************************************************
+ * \brief Capture a CSR matrix. Returns the file name that replaces the matrix
+ * file in the log_bench output.
+ *******************************************************************************/
+template <typename T>
+std::string rocsparse_capture_csr(rocsparse_handle handle,
+                                  const char* routine,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const T* csr_val,
+                                  const rocsparse_int* csr_row_ptr,
+                                  const rocsparse_int* csr_col_ind)
+{
+    if(descr == nullptr || m <= 0 || n <= 0 || nnz <= 0 || csr_val == nullptr ||
+       csr_row_ptr == nullptr || csr_col_ind == nullptr ||
+       !rocsparse_capture_begin(handle, routine))
+    {
+        return ROCSPARSE_CAPTURE_NONE;
+    }
+
+    std::vector<rocsparse_capture_array> arrays = {{csr_row_ptr, sizeof(rocsparse_int) * (m + 1)},
+                                                   {csr_col_ind, sizeof(rocsparse_int) * nnz},
+                                                   {csr_val, sizeof(T) * nnz}};
+
+    rocsparse_capture_header header = rocsparse_capture_make_header<T>(
+        rocsparse_capture_format_csr, descr->base, m, n, nnz, 0);
+
+    return rocsparse_capture_write(handle, routine, header, arrays);
+}
+
+/********************************************************************************
+ * \brief Capture a CSC matrix.
+ *******************************************************************************/
+template <typename T>
+std::string rocsparse_capture_csc(rocsparse_handle handle,
+                                  const char* routine,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const T* csc_val,
+                                  const rocsparse_int* csc_col_ptr,
+                                  const rocsparse_int* csc_row_ind)
+{
+    if(descr == nullptr || m <= 0 || n <= 0 || nnz <= 0 || csc_val == nullptr ||
+       csc_col_ptr == nullptr || csc_row_ind == nullptr ||
+       !rocsparse_capture_begin(handle, routine))
+    {
+        return ROCSPARSE_CAPTURE_NONE;
+    }
+
+    std::vector<rocsparse_capture_array> arrays = {{csc_col_ptr, sizeof(rocsparse_int) * (n + 1)},
+                                                   {csc_row_ind, sizeof(rocsparse_int) * nnz},
+                                                   {csc_val, sizeof(T) * nnz}};
+
+    rocsparse_capture_header header = rocsparse_capture_make_header<T>(
+        rocsparse_capture_format_csc, descr->base, m, n, nnz, 0);
+
+    return rocsparse_capture_write(handle, routine, header, arrays);
+}
+
+/********************************************************************************
+ * \brief Capture a COO matrix.
+ *******************************************************************************/
+template <typename T>
+std::string rocsparse_capture_coo(rocsparse_handle handle,
+                                  const char* routine,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  rocsparse_int nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const T* coo_val,
+                                  const rocsparse_int* coo_row_ind,
+                                  const rocsparse_int* coo_col_ind)
+{
+    if(descr == nullptr || m <= 0 || n <= 0 || nnz <= 0 || coo_val == nullptr ||
+       coo_row_ind == nullptr || coo_col_ind == nullptr ||
+       !rocsparse_capture_begin(handle, routine))
+    {
+        return ROCSPARSE_CAPTURE_NONE;
+    }
+
+    std::vector<rocsparse_capture_array> arrays = {{coo_row_ind, sizeof(rocsparse_int) * nnz},
+                                                   {coo_col_ind, sizeof(rocsparse_int) * nnz},
+                                                   {coo_val, sizeof(T) * nnz}};
+
+    rocsparse_capture_header header = rocsparse_capture_make_header<T>(
+        rocsparse_capture_format_coo, descr->base, m, n, nnz, 0);
+
+    return rocsparse_capture_write(handle, routine, header, arrays);
+}
+
+/********************************************************************************
+ * \brief Capture an ELL matrix.
+ *******************************************************************************/
+template <typename T>
+std::string rocsparse_capture_ell(rocsparse_handle handle,
+                                  const char* routine,
+                                  rocsparse_int m,
+                                  rocsparse_int n,
+                                  const rocsparse_mat_descr descr,
+                                  const T* ell_val,
+                                  const rocsparse_int* ell_col_ind,
+                                  rocsparse_int ell_width)
+{
+    if(descr == nullptr || m <= 0 || n <= 0 || ell_width <= 0 || ell_val == nullptr ||
+       ell_col_ind == nullptr || !rocsparse_capture_begin(handle, routine))
+    {
+        return ROCSPARSE_CAPTURE_NONE;
+    }
+
+    size_t ell_nnz = static_cast<size_t>(m) * ell_width;
+
+    std::vector<rocsparse_capture_array> arrays = {{ell_col_ind, sizeof(rocsparse_int) * ell_nnz},
+                                                   {ell_val, sizeof(T) * ell_nnz}};
+
+    rocsparse_capture_header header = rocsparse_capture_make_header<T>(
+        rocsparse_capture_format_ell, descr->base, m, n, 0, ell_width);
+
+    return rocsparse_capture_write(handle, routine, header, arrays);
+}
+
+/********************************************************************************
+ * \brief Capture a HYB matrix.
+ *******************************************************************************/
+template <typename T>
+std::string rocsparse_capture_hyb(rocsparse_handle handle,
+                                  const char* routine,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_hyb_mat hyb)
+{
+    if(descr == nullptr || hyb == nullptr || hyb->m <= 0 || hyb->n <= 0 ||
+       hyb->ell_nnz + hyb->coo_nnz <= 0 || !rocsparse_capture_begin(handle, routine))
+    {
+        return ROCSPARSE_CAPTURE_NONE;
+    }
+
+    std::vector<rocsparse_capture_array> arrays = {
+        {hyb->ell_col_ind, sizeof(rocsparse_int) * hyb->ell_nnz},
+        {hyb->ell_val, sizeof(T) * hyb->ell_nnz},
+        {hyb->coo_row_ind, sizeof(rocsparse_int) * hyb->coo_nnz},
+        {hyb->coo_col_ind, sizeof(rocsparse_int) * hyb->coo_nnz},
+        {hyb->coo_val, sizeof(T) * hyb->coo_nnz}};
+
+    rocsparse_capture_header header = rocsparse_capture_make_header<T>(
+        rocsparse_capture_format_hyb, descr->base, hyb->m, hyb->n, hyb->coo_nnz, hyb->ell_width);
+
+    return rocsparse_capture_write(handle, routine, header, arrays);
+}
+
+/********************************************************************************
+ * \brief Capture a PCSR matrix. The packed column indices are decoded on the
+ * host, such that the matrix is captured in CSR format.
+ *******************************************************************************/
+template <typename T>
+std::string rocsparse_capture_pcsr(rocsparse_handle handle,
+                                   const char* routine,
+                                   const rocsparse_mat_descr descr,
+                                   const rocsparse_pcsr_mat pcsr)
+{
+    if(descr == nullptr || pcsr == nullptr || pcsr->m <= 0 || pcsr->n <= 0 || pcsr->nnz <= 0 ||
+       pcsr->block_dim <= 0 || pcsr->row_ptr == nullptr || pcsr->col_base == nullptr ||
+       pcsr->col_delta == nullptr || !rocsparse_capture_begin(handle, routine))
+    {
+        return ROCSPARSE_CAPTURE_NONE;
+    }
+
+    rocsparse_int m       = pcsr->m;
+    rocsparse_int nnz     = pcsr->nnz;
+    rocsparse_int nblocks = (m - 1) / pcsr->block_dim + 1;
+    size_t delta_size     = pcsr->delta_size;
+
+    if(delta_size != sizeof(unsigned char) && delta_size != sizeof(unsigned short) &&
+       delta_size != sizeof(rocsparse_int))
+    {
+        return ROCSPARSE_CAPTURE_NONE;
+    }
+
+    std::vector<rocsparse_int> row_ptr(m + 1);
+    std::vector<rocsparse_int> col_base(nblocks);
+    std::vector<char> col_delta(delta_size * nnz);
+
+    // The PCSR structure might still be written by the conversion
+    if(hipStreamSynchronize(handle->stream) != hipSuccess ||
+       hipMemcpy(row_ptr.data(),
+                 pcsr->row_ptr,
+                 sizeof(rocsparse_int) * (m + 1),
+                 hipMemcpyDeviceToHost) != hipSuccess ||
+       hipMemcpy(col_base.data(),
+                 pcsr->col_base,
+                 sizeof(rocsparse_int) * nblocks,
+                 hipMemcpyDeviceToHost) != hipSuccess ||
+       hipMemcpy(col_delta.data(), pcsr->col_delta, col_delta.size(), hipMemcpyDeviceToHost) !=
+           hipSuccess)
+    {
+        return ROCSPARSE_CAPTURE_NONE;
+    }
+
+    // Column indices are stored relative to the smallest column index of their row block
+    std::vector<rocsparse_int> col_ind(nnz);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int base = col_base[i / pcsr->block_dim] + descr->base;
+
+        for(rocsparse_int j = row_ptr[i] - descr->base; j < row_ptr[i + 1] - descr->base; ++j)
+        {
+            rocsparse_int delta;
+
+            if(delta_size == sizeof(unsigned char))
+            {
+                delta = reinterpret_cast<const unsigned char*>(col_delta.data())[j];
+            }
+            else if(delta_size == sizeof(unsigned short))
+            {
+                delta = reinterpret_cast<const unsigned short*>(col_delta.data())[j];
+            }
+            else
+            {
+                delta = reinterpret_cast<const rocsparse_int*>(col_delta.data())[j];
+            }
+
+            col_ind[j] = base + delta;
+        }
+    }
+
+    // Pattern only matrices are captured with unit values
+    std::vector<T> ones(pcsr->val == nullptr ? nnz : 0, static_cast<T>(1));
+
+    rocsparse_capture_array val = {pcsr->val, sizeof(T) * nnz, false};
+
+    if(pcsr->val == nullptr)
+    {
+        val.ptr  = ones.data();
+        val.host = true;
+    }
+
+    std::vector<rocsparse_capture_array> arrays = {
+        {row_ptr.data(), sizeof(rocsparse_int) * (m + 1), true},
+        {col_ind.data(), sizeof(rocsparse_int) * nnz, true},
+        val};
+
+    rocsparse_capture_header header = rocsparse_capture_make_header<T>(
+        rocsparse_capture_format_csr, descr->base, m, pcsr->n, nnz, 0);
+
+    return rocsparse_capture_write(handle, routine, header, arrays);
+}
+
+#endif // CAPTURE_H
@@ -0,0 +1,81 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CAPTURE_FORMAT_H
+#define CAPTURE_FORMAT_H
+
+#include <stdint.h>
+
+// Layout of the operand captures that are written alongside log_bench output.
+// A capture file starts with a rocsparse_capture_header, followed by the arrays
+// of the sparse matrix in the order given below. Indices are stored with
+// index_size bytes, values in the captured value type, both in host byte order.
+//
+//   csr  row_ptr[m + 1], col_ind[nnz], val[nnz]
+//   coo  row_ind[nnz], col_ind[nnz], val[nnz]
+//   ell  col_ind[m * ell_width], val[m * ell_width]
+//   hyb  ell col_ind[m * ell_width], ell val[m * ell_width],
+//        coo row_ind[nnz], coo col_ind[nnz], coo val[nnz]
+//   csc  col_ptr[n + 1], row_ind[nnz], val[nnz]
+//
+// ELL padding entries carry a negative column index.
+
+#define ROCSPARSE_CAPTURE_MAGIC 0x43505352 // "RSPC"
+#define ROCSPARSE_CAPTURE_VERSION 1
+
+typedef enum rocsparse_capture_format_
+{
+    rocsparse_capture_format_csr = 0,
+    rocsparse_capture_format_coo = 1,
+    rocsparse_capture_format_ell = 2,
+    rocsparse_capture_format_hyb = 3,
+    rocsparse_capture_format_csc = 4
+} rocsparse_capture_format;
+
+typedef enum rocsparse_capture_value_
+{
+    rocsparse_capture_value_float          = 0,
+    rocsparse_capture_value_double         = 1,
+    rocsparse_capture_value_float_complex  = 2,
+    rocsparse_capture_value_double_complex = 3,
+    rocsparse_capture_value_half           = 4,
+    rocsparse_capture_value_bfloat16       = 5
+} rocsparse_capture_value;
+
+struct rocsparse_capture_header
+{
+    uint32_t magic;      // ROCSPARSE_CAPTURE_MAGIC
+    uint32_t version;    // ROCSPARSE_CAPTURE_VERSION
+    uint32_t format;     // rocsparse_capture_format
+    uint32_t value_type; // rocsparse_capture_value
+    uint32_t index_size; // size of an index in bytes
+    uint32_t idx_base;   // index base of the captured matrix
+    int64_t m;           // number of rows
+    int64_t n;           // number of columns
+    int64_t nnz;         // non-zeros of CSR, CSC and COO, COO part of HYB
+    int64_t ell_width;   // width of ELL, ELL part of HYB
+};
+
+#endif // CAPTURE_FORMAT_H
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef COMPLEX_H
+#define COMPLEX_H
+
+#include "rocsparse.h"
+
+#include <hip/hip_runtime.h>
+
+// Complex numbers are a pair of scalars and thus cannot be passed to the compiler
+// builtins that operate on scalar types only. The following helpers provide the
+// corresponding operations for all value types, splitting complex numbers into
+// their real and imaginary part where required.
+
+// Complex conjugate, identity for real types
+template <typename T>
+static __device__ __host__ __forceinline__ T rocsparse_conj(T val)
+{
+    return val;
+}
+
+template <typename T>
+static __device__ __host__ __forceinline__ rocsparse_complex_num<T>
+    rocsparse_conj(rocsparse_complex_num<T> val)
+{
+    return rocsparse_complex_num<T>(val.x, -val.y);
+}
+
+// Squared magnitude in double precision, used to accumulate norms
+template <typename T>
+static __device__ __host__ __forceinline__ double rocsparse_abs2(T val)
+{
+    return static_cast<double>(val) * static_cast<double>(val);
+}
+
+template <typename T>
+static __device__ __host__ __forceinline__ double rocsparse_abs2(rocsparse_complex_num<T> val)
+{
+    return static_cast<double>(val.x) * static_cast<double>(val.x)
+           + static_cast<double>(val.y) * static_cast<double>(val.y);
+}
+
+// Read-only load through the texture cache
+static __device__ __forceinline__ rocsparse_float_complex __ldg(const rocsparse_float_complex* ptr)
+{
+    return rocsparse_float_complex(__ldg(&ptr->x), __ldg(&ptr->y));
+}
+
+static __device__ __forceinline__ rocsparse_double_complex
+    __ldg(const rocsparse_double_complex* ptr)
+{
+    return rocsparse_double_complex(__ldg(&ptr->x), __ldg(&ptr->y));
+}
+
+// Non-temporal loads and stores
+template <typename T>
+static __device__ __forceinline__ rocsparse_complex_num<T>
+    nontemporal_value_load(const rocsparse_complex_num<T>* ptr)
+{
+    return rocsparse_complex_num<T>(__builtin_nontemporal_load(&ptr->x),
+                                    __builtin_nontemporal_load(&ptr->y));
+}
+
+template <typename T>
+static __device__ __forceinline__ void nontemporal_value_store(T val, T* ptr)
+{
+    __builtin_nontemporal_store(val, ptr);
+}
+
+template <typename T>
+static __device__ __forceinline__ void nontemporal_value_store(rocsparse_complex_num<T> val,
+                                                               rocsparse_complex_num<T>* ptr)
+{
+    __builtin_nontemporal_store(val.x, &ptr->x);
+    __builtin_nontemporal_store(val.y, &ptr->y);
+}
+
+#if defined(__HIP_PLATFORM_HCC__)
+// Loads with acquire and stores with release semantics, used to exchange values
+// between wavefronts that synchronize through a done flag
+template <typename T>
+static __device__ __forceinline__ T atomic_value_load(const T* ptr)
+{
+    T val;
+    __atomic_load(ptr, &val, __ATOMIC_ACQUIRE);
+    return val;
+}
+
+template <typename T>
+static __device__ __forceinline__ rocsparse_complex_num<T>
+    atomic_value_load(const rocsparse_complex_num<T>* ptr)
+{
+    rocsparse_complex_num<T> val;
+    __atomic_load(&ptr->x, &val.x, __ATOMIC_ACQUIRE);
+    __atomic_load(&ptr->y, &val.y, __ATOMIC_ACQUIRE);
+    return val;
+}
+
+template <typename T>
+static __device__ __forceinline__ void atomic_value_store(T val, T* ptr)
+{
+    __atomic_store(ptr, &val, __ATOMIC_RELEASE);
+}
+
+template <typename T>
+static __device__ __forceinline__ void atomic_value_store(rocsparse_complex_num<T> val,
+                                                          rocsparse_complex_num<T>* ptr)
+{
+    __atomic_store(&ptr->x, &val.x, __ATOMIC_RELEASE);
+    __atomic_store(&ptr->y, &val.y, __ATOMIC_RELEASE);
+}
+#endif
+
+// Atomic addition, real and imaginary part are added independently
+template <typename T>
+static __device__ __forceinline__ void atomicAdd(rocsparse_complex_num<T>* ptr,
+                                                 rocsparse_complex_num<T> val)
+{
+    atomicAdd(&ptr->x, val.x);
+    atomicAdd(&ptr->y, val.y);
+}
+
+#endif // COMPLEX_H
@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef HALF_H
+#define HALF_H
+
+#include "rocsparse.h"
+
+#include <hip/hip_runtime.h>
+#include <hip/hip_fp16.h>
+
+// Matrix values can be stored in a 16-bit format (rocsparse_half, rocsparse_bfloat16),
+// while the computation is carried out in single precision. The following helpers
+// load a stored value and return it in compute precision. For matching storage and
+// compute types, they reduce to a plain load.
+
+template <typename T>
+static __device__ __forceinline__ T value_cast(T val)
+{
+    return val;
+}
+
+static __device__ __forceinline__ float value_cast(rocsparse_half val)
+{
+    return __half2float(__ushort_as_half(val.data));
+}
+
+static __device__ __forceinline__ float value_cast(rocsparse_bfloat16 val)
+{
+    // bfloat16 is the upper half of an IEEE single precision number
+    return __uint_as_float(static_cast<unsigned int>(val.data) << 16);
+}
+
+template <typename T>
+static __device__ __forceinline__ T nontemporal_value_load(const T* ptr)
+{
+    return __builtin_nontemporal_load(ptr);
+}
+
+static __device__ __forceinline__ float nontemporal_value_load(const rocsparse_half* ptr)
+{
+    return __half2float(__ushort_as_half(
+        __builtin_nontemporal_load(reinterpret_cast<const unsigned short*>(ptr))));
+}
+
+static __device__ __forceinline__ float nontemporal_value_load(const rocsparse_bfloat16* ptr)
+{
+    unsigned short bits = __builtin_nontemporal_load(reinterpret_cast<const unsigned short*>(ptr));
+
+    return __uint_as_float(static_cast<unsigned int>(bits) << 16);
+}
+
+// Pattern only matrices do not store any values, every entry is implicitly one. Kernels
+// that are instantiated with this storage type never access the value array, such that
+// the value stream is removed at compile time.
+struct rocsparse_pattern_value
+{
+};
+
+// Load the matrix value at position idx in compute precision T
+template <typename T, typename U>
+static __device__ __forceinline__ T matrix_value(const U* val, rocsparse_int idx)
+{
+    return value_cast(val[idx]);
+}
+
+template <typename T>
+static __device__ __forceinline__ T matrix_value(const rocsparse_pattern_value*, rocsparse_int)
+{
+    return static_cast<T>(1);
+}
+
+template <typename T, typename U>
+static __device__ __forceinline__ T nontemporal_matrix_value(const U* val, rocsparse_int idx)
+{
+    return nontemporal_value_load(val + idx);
+}
+
+template <typename T>
+static __device__ __forceinline__ T nontemporal_matrix_value(const rocsparse_pattern_value*,
+                                                             rocsparse_int)
+{
+    return static_cast<T>(1);
+}
+
+// Zero in storage precision, used for padding
+template <typename T>
+static __device__ __forceinline__ T value_zero()
+{
+    return static_cast<T>(0);
+}
+
+template <>
+__device__ __forceinline__ rocsparse_half value_zero<rocsparse_half>()
+{
+    rocsparse_half zero = {0};
+    return zero;
+}
+
+template <>
+__device__ __forceinline__ rocsparse_bfloat16 value_zero<rocsparse_bfloat16>()
+{
+    rocsparse_bfloat16 zero = {0};
+    return zero;
+}
+
+// Copy and pad matrix values in format conversions, no-ops for pattern only matrices
+template <typename T>
+static __device__ __forceinline__ void
+    matrix_value_copy(T* dst, rocsparse_int i, const T* src, rocsparse_int j)
+{
+    dst[i] = src[j];
+}
+
+static __device__ __forceinline__ void matrix_value_copy(rocsparse_pattern_value*,
+                                                         rocsparse_int,
+                                                         const rocsparse_pattern_value*,
+                                                         rocsparse_int)
+{
+}
+
+template <typename T>
+static __device__ __forceinline__ void matrix_value_pad(T* dst, rocsparse_int i)
+{
+    dst[i] = value_zero<T>();
+}
+
+static __device__ __forceinline__ void matrix_value_pad(rocsparse_pattern_value*, rocsparse_int)
+{
+}
+
+#endif // HALF_H
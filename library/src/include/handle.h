@@ -26,15 +26,22 @@
 #define HANDLE_H
 
 #include "rocsparse.h"
+#include "allocator.h"
+#include "pattern.h"
+#include "profile.h"
 
 #include <iostream>
 #include <fstream>
+#include <map>
+#include <string>
 #include <vector>
 #include <hip/hip_runtime_api.h>
 
 /*! \brief typedefs to opaque info structs */
 typedef struct _rocsparse_csrmv_info* rocsparse_csrmv_info;
 typedef struct _rocsparse_csrtr_info* rocsparse_csrtr_info;
+typedef struct _rocsparse_reorder_info* rocsparse_reorder_info;
+typedef struct _rocsparse_cscmspv_info* rocsparse_cscmspv_info;
 
 /********************************************************************************
  * \brief rocsparse_handle is a structure holding the rocsparse library context.
@@ -54,10 +61,12 @@ struct _rocsparse_handle
     rocsparse_status set_stream(hipStream_t user_stream);
     // get stream
     rocsparse_status get_stream(hipStream_t* user_stream) const;
+    // initialize device properties, device buffer and device ones on first use
+    rocsparse_status init_buffer();
 
     // device id
     int device;
-    // device properties
+    // device properties, valid after init_buffer()
     hipDeviceProp_t properties;
     // device wavefront size
     int wavefront_size;
@@ -67,18 +76,43 @@ struct _rocsparse_handle
     rocsparse_pointer_mode pointer_mode = rocsparse_pointer_mode_host;
     // logging mode
     rocsparse_layer_mode layer_mode;
-    // device buffer
-    size_t buffer_size;
-    void* buffer;
-    // device one
-    float* sone;
-    double* done;
+    // device buffer, allocated by init_buffer()
+    size_t buffer_size = 0;
+    void* buffer       = nullptr;
+    // device memory allocator
+    rocsparse_allocator allocator;
+    // workspace for temporary device buffers
+    rocsparse_workspace workspace;
+    // number of device allocations through the allocator
+    size_t device_allocs = 0;
+    // device one, stored behind the device buffer
+    float* sone                    = nullptr;
+    double* done                   = nullptr;
+    rocsparse_float_complex* cone  = nullptr;
+    rocsparse_double_complex* zone = nullptr;
 
     // logging streams
     std::ofstream log_trace_ofs;
     std::ofstream log_bench_ofs;
     std::ostream* log_trace_os = nullptr;
     std::ostream* log_bench_os = nullptr;
+
+    // profiling layer
+    rocsparse_profile profile;
+    std::ofstream log_profile_ofs;
+    std::ostream* log_profile_os                = nullptr;
+    rocsparse_profile_format log_profile_format = rocsparse_profile_format_table;
+
+    // operand capture directory, routine filter and files captured so far, keyed
+    // by routine and content hash
+    std::string capture_path;
+    std::string capture_filter;
+    std::map<std::string, std::string> captured;
+
+    // analysis meta data, shared between matrix info structures with identical
+    // sparsity patterns
+    std::vector<rocsparse_csrmv_info> csrmv_cache;
+    std::vector<rocsparse_csrtr_info> csrtr_cache;
 };
 
 /********************************************************************************
@@ -128,6 +162,53 @@ struct _rocsparse_hyb_mat
     rocsparse_int* coo_row_ind = nullptr;
     rocsparse_int* coo_col_ind = nullptr;
     void* coo_val              = nullptr;
+
+    // value update type
+    rocsparse_hyb_update update = rocsparse_hyb_update_full;
+
+    // CSR entry of each ELL (-1 for padding) and COO slot, only kept for value updates
+    rocsparse_int csr_nnz   = 0;
+    rocsparse_int* csr_perm = nullptr;
+
+    // allocator of the device arrays
+    rocsparse_allocator allocator;
+};
+
+/********************************************************************************
+ * \brief rocsparse_pcsr_mat is a structure holding a CSR matrix with packed
+ * column indices. Each block of consecutive rows stores the smallest column index
+ * of its entries, and each entry stores the distance of its column index to this
+ * base in as few bytes as required for the whole matrix.
+ * It must be initialized using rocsparse_create_pcsr_mat() and the returned
+ * handle must be passed to all subsequent library function calls that involve
+ * the PCSR matrix.
+ * It should be destroyed at the end using rocsparse_destroy_pcsr_mat().
+ *******************************************************************************/
+struct _rocsparse_pcsr_mat
+{
+    // num rows
+    rocsparse_int m = 0;
+    // num cols
+    rocsparse_int n = 0;
+    // num non-zeros
+    rocsparse_int nnz = 0;
+
+    // number of rows sharing a column base
+    rocsparse_int block_dim = 0;
+    // size of a column delta in bytes, 1, 2 or 4
+    rocsparse_int delta_size = 0;
+
+    // row offsets, as in CSR
+    rocsparse_int* row_ptr = nullptr;
+    // smallest zero based column index of each row block
+    rocsparse_int* col_base = nullptr;
+    // column index of each entry relative to the base of its row block
+    void* col_delta = nullptr;
+    // values, NULL for pattern only matrices
+    void* val = nullptr;
+
+    // allocator of the device arrays
+    rocsparse_allocator allocator;
 };
 
 /********************************************************************************
@@ -144,6 +225,41 @@ struct _rocsparse_mat_info
     rocsparse_csrtr_info csrilu0_info     = nullptr;
     rocsparse_csrtr_info csrsv_upper_info = nullptr;
     rocsparse_csrtr_info csrsv_lower_info = nullptr;
+    // multicolor reordered matrix and its analysis data
+    rocsparse_reorder_info reorder_info = nullptr;
+    // row wise pattern and sparse accumulator of cscmspv
+    rocsparse_cscmspv_info cscmspv_info = nullptr;
+
+    // number of fixed-point sweeps of rocsparse_solve_policy_iterative
+    rocsparse_int csrilu0_sweeps = 5;
+    rocsparse_int csrsv_sweeps   = 3;
+    // frontier density at and above which cscmspv uses the pull direction
+    double cscmspv_threshold = 0.05;
+    // device array holding the squared update and solution norms of each sweep of the
+    // last iterative csrilu0, lower and upper triangular solve
+    double* iterative_history = nullptr;
+    // allocator of the sweep history
+    rocsparse_allocator iterative_allocator;
+
+    // device array holding the zero pivots of the last csrilu0, lower and upper
+    // triangular solve of this matrix, in this order
+    rocsparse_int* zero_pivot = nullptr;
+    // allocator of the zero pivots
+    rocsparse_allocator zero_pivot_allocator;
+
+    // low precision copy of the csrilu0 factors, used by mixed precision solves
+    size_t csrilu0_mixed_size = 0;
+    void* csrilu0_mixed_val   = nullptr;
+    // allocator of the low precision factors
+    rocsparse_allocator csrilu0_mixed_allocator;
+
+    // sparsity pattern fingerprint of the matrix and the arrays it has been
+    // computed from
+    rocsparse_pattern_key pattern;
+    const rocsparse_int* pattern_row_ptr = nullptr;
+    const rocsparse_int* pattern_col_ind = nullptr;
+    // re-compute the fingerprint during execution only if the arrays moved, or always
+    rocsparse_pattern_check pattern_check = rocsparse_pattern_check_moved;
 };
 
 /********************************************************************************
@@ -158,15 +274,19 @@ struct _rocsparse_csrmv_info
     size_t size = 0;
     // row blocks
     unsigned long long* row_blocks = nullptr;
+    // allocator of the row blocks
+    rocsparse_allocator allocator;
+
+    // number of matrix info structures and caches sharing this data
+    rocsparse_int use_count = 1;
 
     // some data to verify correct execution
     rocsparse_operation trans;
     rocsparse_int m;
     rocsparse_int n;
     rocsparse_int nnz;
-    const _rocsparse_mat_descr* descr;
-    const rocsparse_int* csr_row_ptr;
-    const rocsparse_int* csr_col_ind;
+    // sparsity pattern that has been analysed
+    rocsparse_pattern_key key;
 };
 
 /********************************************************************************
@@ -178,10 +298,26 @@ struct _rocsparse_csrmv_info
 rocsparse_status rocsparse_create_csrmv_info(rocsparse_csrmv_info* info);
 
 /********************************************************************************
- * \brief Destroy csrmv info.
+ * \brief Destroy csrmv info. If the info is shared, only the reference is
+ * released.
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrmv_info(rocsparse_csrmv_info info);
 
+/********************************************************************************
+ * \brief Look up csrmv info with matching sparsity pattern and operation in the
+ * handle cache. On success, a new reference to the shared info is returned,
+ * otherwise nullptr.
+ *******************************************************************************/
+rocsparse_csrmv_info rocsparse_find_csrmv_info(rocsparse_handle handle,
+                                               const rocsparse_pattern_key& key,
+                                               rocsparse_operation trans);
+
+/********************************************************************************
+ * \brief Insert csrmv info into the handle cache. The least recently inserted
+ * entry is released if the cache is full.
+ *******************************************************************************/
+rocsparse_status rocsparse_cache_csrmv_info(rocsparse_handle handle, rocsparse_csrmv_info info);
+
 struct _rocsparse_csrtr_info
 {
     // maximum depth
@@ -199,15 +335,23 @@ struct _rocsparse_csrtr_info
     rocsparse_int* h_row_map = nullptr;
     // device array to hold pointer to diagonal entry
     rocsparse_int* csr_diag_ind = nullptr;
-    // device pointer to hold zero pivot
-    rocsparse_int* zero_pivot = nullptr;
+    // device pointer to hold the structural zero pivot, i.e. the first row without
+    // diagonal entry. Numerical zero pivots are stored in the matrix info, since this
+    // data is shared between all matrices of identical sparsity pattern
+    rocsparse_int* structural_pivot = nullptr;
+    // allocator of the device arrays, that share a single allocation starting
+    // at d_row_map
+    rocsparse_allocator allocator;
+
+    // number of matrix info structures and caches sharing this data
+    rocsparse_int use_count = 1;
 
     // some data to verify correct execution
     rocsparse_int m;
     rocsparse_int nnz;
-    const _rocsparse_mat_descr* descr;
-    const rocsparse_int* csr_row_ptr;
-    const rocsparse_int* csr_col_ind;
+    rocsparse_fill_mode fill_mode;
+    // sparsity pattern that has been analysed
+    rocsparse_pattern_key key;
 };
 
 /********************************************************************************
@@ -219,10 +363,115 @@ struct _rocsparse_csrtr_info
 rocsparse_status rocsparse_create_csrtr_info(rocsparse_csrtr_info* info);
 
 /********************************************************************************
- * \brief Destroy csrmv info.
+ * \brief Destroy csrtr info. If the info is shared, only the reference is
+ * released.
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrtr_info(rocsparse_csrtr_info info);
 
+/********************************************************************************
+ * \brief Look up csrtr info with matching sparsity pattern and fill mode in the
+ * handle cache. On success, a new reference to the shared info is returned,
+ * otherwise nullptr.
+ *******************************************************************************/
+rocsparse_csrtr_info rocsparse_find_csrtr_info(rocsparse_handle handle,
+                                               const rocsparse_pattern_key& key,
+                                               rocsparse_fill_mode fill_mode);
+
+/********************************************************************************
+ * \brief Insert csrtr info into the handle cache. The least recently inserted
+ * entry is released if the cache is full.
+ *******************************************************************************/
+rocsparse_status rocsparse_cache_csrtr_info(rocsparse_handle handle, rocsparse_csrtr_info info);
+
+struct _rocsparse_reorder_info
+{
+    // number of colors of the reordering
+    rocsparse_int ncolors;
+
+    // device array to hold the multicolor permutation
+    rocsparse_int* perm = nullptr;
+    // device arrays to hold the sparsity pattern of the reordered matrix
+    rocsparse_int* csr_row_ptr = nullptr;
+    rocsparse_int* csr_col_ind = nullptr;
+    // device array to hold the position of each reordered entry in the original matrix
+    rocsparse_int* map = nullptr;
+    // allocator of the device arrays, that share a single allocation starting
+    // at perm
+    rocsparse_allocator allocator;
+
+    // analysis data of the reordered matrix
+    rocsparse_mat_info info = nullptr;
+
+    // some data to verify correct execution
+    rocsparse_int m;
+    rocsparse_int nnz;
+    // sparsity pattern that has been reordered
+    rocsparse_pattern_key key;
+};
+
+/********************************************************************************
+ * \brief rocsparse_reorder_info is a structure holding the multicolor reordering
+ * of a matrix, computed by the csrsv and csrilu0 analysis for
+ * rocsparse_solve_policy_multicolor. It must be initialized using the
+ * rocsparse_create_reorder_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_reorder_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_reorder_info(rocsparse_reorder_info* info);
+
+/********************************************************************************
+ * \brief Destroy reorder info, including the analysis data of the reordered
+ * matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_reorder_info(rocsparse_reorder_info info);
+
+struct _rocsparse_cscmspv_info
+{
+    // device arrays to hold the row wise sparsity pattern of the matrix, used by
+    // the pull direction
+    rocsparse_int* csr_row_ptr = nullptr;
+    rocsparse_int* csr_col_ind = nullptr;
+    // device array to hold the position of each row wise entry in the CSC arrays
+    rocsparse_int* map = nullptr;
+    // sparse accumulator, a dense array of the result that holds the additive
+    // identity outside of the result, the flags of the rows that have been
+    // reached, the list of these rows and their number
+    void* acc            = nullptr;
+    rocsparse_int* flag  = nullptr;
+    rocsparse_int* list  = nullptr;
+    rocsparse_int* count = nullptr;
+    // dense copy of x and the flags of its non-zero entries, used by the pull
+    // direction
+    void* x              = nullptr;
+    rocsparse_int* xflag = nullptr;
+    // allocator of the device arrays, that share a single allocation starting
+    // at csr_row_ptr
+    rocsparse_allocator allocator;
+
+    // semiring and precision whose additive identity the accumulator holds,
+    // -1 if it has not been initialized
+    int acc_state = -1;
+
+    // some data to verify correct execution
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+    rocsparse_index_base base;
+};
+
+/********************************************************************************
+ * \brief rocsparse_cscmspv_info is a structure holding the row wise sparsity
+ * pattern and the sparse accumulator of a matrix, computed by
+ * rocsparse_cscmspv_analysis(). It must be initialized using the
+ * rocsparse_create_cscmspv_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_cscmspv_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_cscmspv_info(rocsparse_cscmspv_info* info);
+
+/********************************************************************************
+ * \brief Destroy cscmspv info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_cscmspv_info(rocsparse_cscmspv_info info);
+
 /********************************************************************************
  * \brief ELL format indexing
  *******************************************************************************/
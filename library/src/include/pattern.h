@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef PATTERN_H
+#define PATTERN_H
+
+#include "rocsparse.h"
+
+/********************************************************************************
+ * \brief rocsparse_pattern_key is a structural fingerprint of a CSR sparsity
+ * pattern. It is computed from the contents of the row pointer and column index
+ * arrays, such that analysis meta data can be validated and re-used independent
+ * of where the matrix is stored.
+ *******************************************************************************/
+struct rocsparse_pattern_key
+{
+    // matrix dimensions
+    rocsparse_int m   = -1;
+    rocsparse_int n   = -1;
+    rocsparse_int nnz = -1;
+    // index base
+    rocsparse_index_base base = rocsparse_index_base_zero;
+    // order independent hash of the row pointer and column index arrays
+    unsigned long long hash = 0;
+};
+
+inline bool operator==(const rocsparse_pattern_key& lhs, const rocsparse_pattern_key& rhs)
+{
+    return lhs.m == rhs.m && lhs.n == rhs.n && lhs.nnz == rhs.nnz && lhs.base == rhs.base &&
+           lhs.hash == rhs.hash;
+}
+
+inline bool operator!=(const rocsparse_pattern_key& lhs, const rocsparse_pattern_key& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/********************************************************************************
+ * \brief Compute the sparsity pattern fingerprint of a CSR matrix. Every entry
+ * of the row pointer and column index arrays is hashed together with its
+ * position, and the contributions are summed up. The sum does not depend on the
+ * order of evaluation, thus the arrays are hashed in parallel chunks on the
+ * device and only a single 64 bit value is copied back to the host.
+ *******************************************************************************/
+rocsparse_status rocsparse_csr_pattern_key(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int nnz,
+                                           rocsparse_index_base base,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_pattern_key* key);
+
+/********************************************************************************
+ * \brief Update the sparsity pattern fingerprint that is stored in the matrix
+ * info. Unless force is set or the pattern check of the matrix info is
+ * rocsparse_pattern_check_always, the fingerprint is only re-computed if the
+ * matrix dimensions changed or its arrays have been moved since the last update.
+ *******************************************************************************/
+rocsparse_status rocsparse_update_pattern_key(rocsparse_handle handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int m,
+                                              rocsparse_int n,
+                                              rocsparse_int nnz,
+                                              rocsparse_index_base base,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              bool force);
+
+#endif // PATTERN_H
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "rocsparse.h"
+
+#include <deque>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <hip/hip_runtime_api.h>
+
+// Histogram buckets per power of two, the histogram covers 1 us to 2^30 us
+#define ROCSPARSE_PROFILE_SUBBUCKETS 4
+#define ROCSPARSE_PROFILE_BUCKETS (1 + 30 * ROCSPARSE_PROFILE_SUBBUCKETS)
+
+// Maximum number of calls that wait for their device time to be resolved
+#define ROCSPARSE_PROFILE_MAX_PENDING 1024
+
+/********************************************************************************
+ * \brief rocsparse_profile_key identifies a routine, its precision and the
+ * shape of the matrix it operates on.
+ *******************************************************************************/
+struct rocsparse_profile_key
+{
+    std::string name;
+    rocsparse_int m;
+    rocsparse_int n;
+    rocsparse_int nnz;
+
+    bool operator<(const rocsparse_profile_key& rhs) const;
+};
+
+/********************************************************************************
+ * \brief rocsparse_profile_stats aggregates all calls of a profile key. Times
+ * are in microseconds, percentiles are obtained from a log scale histogram.
+ *******************************************************************************/
+struct rocsparse_profile_stats
+{
+    size_t calls      = 0;
+    double total      = 0.0;
+    double min        = 0.0;
+    double max        = 0.0;
+    double host_total = 0.0;
+    double bytes      = 0.0;
+
+    std::vector<size_t> histogram = std::vector<size_t>(ROCSPARSE_PROFILE_BUCKETS, 0);
+
+    // add a single call
+    void add(double time, double host_time, size_t call_bytes);
+    // return the time below which the given fraction of calls completed
+    double percentile(double fraction) const;
+};
+
+/********************************************************************************
+ * \brief rocsparse_profile_call is a call whose device time is not known yet.
+ *******************************************************************************/
+struct rocsparse_profile_call
+{
+    rocsparse_profile_key key;
+    hipEvent_t start;
+    hipEvent_t stop;
+    double host_time;
+    size_t bytes;
+};
+
+/********************************************************************************
+ * \brief rocsparse_profile holds the profile of a handle. Device times are
+ * resolved in call order once the stop event of a call has completed, such that
+ * profiling does not synchronize the stream.
+ *******************************************************************************/
+struct rocsparse_profile
+{
+    // constructor
+    rocsparse_profile() = default;
+    // destructor
+    ~rocsparse_profile();
+
+    // obtain a pair of events from the pool
+    hipError_t get_events(hipEvent_t* start, hipEvent_t* stop);
+    // enqueue a call, resolves all completed calls
+    void push(const rocsparse_profile_call& call);
+    // resolve pending calls, waits for all calls if wait is set
+    void resolve(bool wait);
+    // discard all statistics, waits for pending calls
+    void reset();
+    // write statistics, waits for pending calls
+    void write(std::ostream& os, rocsparse_profile_format format);
+
+    std::map<rocsparse_profile_key, rocsparse_profile_stats> stats;
+    std::deque<rocsparse_profile_call> pending;
+    std::vector<hipEvent_t> event_pool;
+};
+
+/********************************************************************************
+ * \brief rocsparse_profile_scope times a library call if the profiling layer is
+ * active. name may contain an X, which is replaced by precision.
+ *******************************************************************************/
+class rocsparse_profile_scope
+{
+public:
+    rocsparse_profile_scope(rocsparse_handle handle,
+                            const char* name,
+                            const char* precision,
+                            rocsparse_int m,
+                            rocsparse_int n,
+                            rocsparse_int nnz,
+                            size_t bytes);
+    ~rocsparse_profile_scope();
+
+    rocsparse_profile_scope(const rocsparse_profile_scope&) = delete;
+    rocsparse_profile_scope& operator=(const rocsparse_profile_scope&) = delete;
+
+private:
+    rocsparse_handle handle_ = nullptr;
+    const char* name_;
+    const char* precision_;
+    rocsparse_int m_;
+    rocsparse_int n_;
+    rocsparse_int nnz_;
+    size_t bytes_;
+    hipEvent_t start_;
+    hipEvent_t stop_;
+    double host_start_;
+};
+
+#endif // PROFILE_H
@@ -0,0 +1,250 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "rocsparse.h"
+#include "trace_format.h"
+
+#include <chrono>
+#include <initializer_list>
+#include <string.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Size of the per thread trace buffer
+#define ROCSPARSE_TRACE_BUFFER_SIZE (64 * 1024)
+
+/********************************************************************************
+ * \brief rocsparse_trace_buffer collects the binary trace records of a single
+ * thread. Records are appended without any synchronization. Full buffers are
+ * appended to the trace file with a single write to a file opened in append
+ * mode, such that no lock is required either.
+ *******************************************************************************/
+struct rocsparse_trace_buffer
+{
+    // constructor
+    rocsparse_trace_buffer();
+    // destructor, flushes pending records
+    ~rocsparse_trace_buffer();
+
+    // append buffered records to the trace file
+    void flush();
+    // append data to the trace file, bypassing the buffer
+    void write(const char* ptr, size_t size);
+
+    // thread id
+    uint32_t thread;
+    // current position in the buffer
+    size_t pos = 0;
+    // buffered records
+    char data[ROCSPARSE_TRACE_BUFFER_SIZE];
+};
+
+// Return the trace buffer of the calling thread
+rocsparse_trace_buffer& rocsparse_trace_thread_buffer();
+
+// Append the pending records of the calling thread to the trace file
+void rocsparse_trace_flush();
+
+// Encoded size of a single argument
+template <typename T>
+inline size_t trace_arg_size(const T&)
+{
+    return 1 + sizeof(uint64_t);
+}
+
+inline size_t trace_arg_size(const float&) { return 1 + sizeof(float); }
+inline size_t trace_arg_size(const rocsparse_float_complex&) { return 1 + 2 * sizeof(float); }
+inline size_t trace_arg_size(const rocsparse_double_complex&) { return 1 + 2 * sizeof(double); }
+
+inline size_t trace_string_length(size_t len)
+{
+    return (len < ROCSPARSE_TRACE_MAX_STRING) ? len : ROCSPARSE_TRACE_MAX_STRING;
+}
+
+inline size_t trace_arg_size(const char* str)
+{
+    return 1 + sizeof(uint32_t) + trace_string_length(strlen(str));
+}
+
+inline size_t trace_arg_size(const std::string& str)
+{
+    return 1 + sizeof(uint32_t) + trace_string_length(str.size());
+}
+
+// Encode a single argument, returns the position behind the argument
+template <typename T>
+inline char* trace_put(char* ptr, rocsparse_trace_arg tag, const T& val)
+{
+    *ptr = static_cast<char>(tag);
+    memcpy(ptr + 1, &val, sizeof(T));
+    return ptr + 1 + sizeof(T);
+}
+
+inline char* trace_encode_scalar(char* ptr, const void* val)
+{
+    return trace_put(
+        ptr, rocsparse_trace_arg_pointer, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(val)));
+}
+
+// Signed integers and enums are recorded as int, unsigned integers as uint
+template <typename T>
+struct trace_is_int
+{
+    static const bool value = std::is_signed<T>::value || std::is_enum<T>::value;
+};
+
+template <typename T>
+inline typename std::enable_if<trace_is_int<T>::value, char*>::type
+    trace_encode_scalar(char* ptr, T val)
+{
+    return trace_put(ptr, rocsparse_trace_arg_int, static_cast<int64_t>(val));
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_unsigned<T>::value, char*>::type
+    trace_encode_scalar(char* ptr, T val)
+{
+    return trace_put(ptr, rocsparse_trace_arg_uint, static_cast<uint64_t>(val));
+}
+
+// Integers, enums and pointers
+template <typename T>
+inline char* trace_encode(char* ptr, const T& val)
+{
+    return trace_encode_scalar(ptr, val);
+}
+
+inline char* trace_encode(char* ptr, const float& val)
+{
+    return trace_put(ptr, rocsparse_trace_arg_float, val);
+}
+
+inline char* trace_encode(char* ptr, const double& val)
+{
+    return trace_put(ptr, rocsparse_trace_arg_double, val);
+}
+
+inline char* trace_encode(char* ptr, const rocsparse_float_complex& val)
+{
+    float v[2] = {val.x, val.y};
+    *ptr       = static_cast<char>(rocsparse_trace_arg_float_complex);
+    memcpy(ptr + 1, v, sizeof(v));
+    return ptr + 1 + sizeof(v);
+}
+
+inline char* trace_encode(char* ptr, const rocsparse_double_complex& val)
+{
+    double v[2] = {val.x, val.y};
+    *ptr        = static_cast<char>(rocsparse_trace_arg_double_complex);
+    memcpy(ptr + 1, v, sizeof(v));
+    return ptr + 1 + sizeof(v);
+}
+
+inline char* trace_encode_string(char* ptr, const char* str, size_t len)
+{
+    uint32_t n = static_cast<uint32_t>(trace_string_length(len));
+
+    ptr = trace_put(ptr, rocsparse_trace_arg_string, n);
+    memcpy(ptr, str, n);
+    return ptr + n;
+}
+
+inline char* trace_encode(char* ptr, const char* str)
+{
+    return trace_encode_string(ptr, str, strlen(str));
+}
+
+inline char* trace_encode(char* ptr, const std::string& str)
+{
+    return trace_encode_string(ptr, str.c_str(), str.size());
+}
+
+/**
+ * @brief Binary trace function
+ *
+ * @details
+ * rocsparse_trace_record   Record head and all arguments in the trace buffer of
+ *                          the calling thread. The resulting record can be
+ *                          decoded into the text that log_arguments would
+ *                          produce for the same arguments.
+ */
+template <typename H, typename... Ts>
+void rocsparse_trace_record(rocsparse_trace_kind kind, const H& head, const Ts&... xs)
+{
+    size_t size = sizeof(rocsparse_trace_header) + trace_arg_size(head);
+    (void)std::initializer_list<int>{((void)(size += trace_arg_size(xs)), 0)...};
+
+    rocsparse_trace_buffer& buf = rocsparse_trace_thread_buffer();
+
+    // Records that exceed the buffer are written directly
+    std::vector<char> large;
+    char* ptr;
+
+    if(size > ROCSPARSE_TRACE_BUFFER_SIZE)
+    {
+        large.resize(size);
+        ptr = large.data();
+    }
+    else
+    {
+        if(buf.pos + size > ROCSPARSE_TRACE_BUFFER_SIZE)
+        {
+            buf.flush();
+        }
+
+        ptr = buf.data + buf.pos;
+    }
+
+    rocsparse_trace_header header = {};
+
+    header.size      = static_cast<uint32_t>(size);
+    header.kind      = static_cast<uint8_t>(kind);
+    header.nargs     = static_cast<uint16_t>(1 + sizeof...(xs));
+    header.thread    = buf.thread;
+    header.timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now().time_since_epoch())
+                           .count();
+
+    char* end = ptr;
+    memcpy(end, &header, sizeof(header));
+    end = trace_encode(end + sizeof(header), head);
+    (void)std::initializer_list<int>{((void)(end = trace_encode(end, xs)), 0)...};
+
+    if(large.empty())
+    {
+        buf.pos += size;
+    }
+    else
+    {
+        buf.flush();
+        buf.write(large.data(), size);
+    }
+}
+
+#endif // TRACE_H
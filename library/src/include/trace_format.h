@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef TRACE_FORMAT_H
+#define TRACE_FORMAT_H
+
+#include <stdint.h>
+
+// Layout of the binary trace written by the log_binary layer. The file starts
+// with a rocsparse_trace_file_header, followed by a sequence of records. Each
+// record consists of a rocsparse_trace_header and nargs arguments. Every argument
+// is a one byte type tag followed by its payload:
+//
+//   int, uint, pointer  8 bytes
+//   float               4 bytes
+//   double              8 bytes
+//   float complex       2 x 4 bytes
+//   double complex      2 x 8 bytes
+//   string              4 byte length followed by the characters
+//
+// The first argument of a record is the routine name (trace) or the command
+// line prefix (bench). Records of different threads are interleaved in the
+// file, but records of a single thread appear in the order they were recorded.
+// All values are stored in host byte order.
+
+#define ROCSPARSE_TRACE_MAGIC 0x54505352 // "RSPT"
+#define ROCSPARSE_TRACE_VERSION 1
+
+// Maximum number of characters recorded per string argument
+#define ROCSPARSE_TRACE_MAX_STRING 1024
+
+typedef enum rocsparse_trace_kind_
+{
+    rocsparse_trace_kind_trace = 0, // log_trace record
+    rocsparse_trace_kind_bench = 1  // log_bench record
+} rocsparse_trace_kind;
+
+typedef enum rocsparse_trace_arg_
+{
+    rocsparse_trace_arg_int            = 0,
+    rocsparse_trace_arg_uint           = 1,
+    rocsparse_trace_arg_float          = 2,
+    rocsparse_trace_arg_double         = 3,
+    rocsparse_trace_arg_pointer        = 4,
+    rocsparse_trace_arg_string         = 5,
+    rocsparse_trace_arg_float_complex  = 6,
+    rocsparse_trace_arg_double_complex = 7
+} rocsparse_trace_arg;
+
+struct rocsparse_trace_file_header
+{
+    uint32_t magic;   // ROCSPARSE_TRACE_MAGIC
+    uint32_t version; // ROCSPARSE_TRACE_VERSION
+};
+
+struct rocsparse_trace_header
+{
+    uint32_t size;      // record size in bytes, including this header
+    uint8_t kind;       // rocsparse_trace_kind
+    uint8_t reserved;   // unused, zero
+    uint16_t nargs;     // number of arguments
+    uint32_t thread;    // id of the recording thread, in order of first record
+    uint32_t pad;       // unused, zero
+    uint64_t timestamp; // steady clock time stamp in nanoseconds
+};
+
+#endif // TRACE_FORMAT_H
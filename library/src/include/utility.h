@@ -28,6 +28,7 @@
 #include "rocsparse.h"
 #include "handle.h"
 #include "logging.h"
+#include "trace.h"
 
 #include <fstream>
 #include <string>
@@ -51,11 +52,22 @@ static inline void rocsparse_one(const rocsparse_handle handle, double** one)
     *one = handle->done;
 }
 
+static inline void rocsparse_one(const rocsparse_handle handle, rocsparse_float_complex** one)
+{
+    *one = handle->cone;
+}
+
+static inline void rocsparse_one(const rocsparse_handle handle, rocsparse_double_complex** one)
+{
+    *one = handle->zone;
+}
+
 // if trace logging is turned on with
 // (handle->layer_mode & rocsparse_layer_mode_log_trace) == true
 // then
 // log_function will call log_arguments to log function
-// arguments with a comma separator
+// arguments with a comma separator, or record them in the
+// binary trace if rocsparse_layer_mode_log_binary is set
 template <typename H, typename... Ts>
 void log_trace(rocsparse_handle handle, H head, Ts&... xs)
 {
@@ -63,6 +75,12 @@ void log_trace(rocsparse_handle handle, H head, Ts&... xs)
     {
         if(handle->layer_mode & rocsparse_layer_mode_log_trace)
         {
+            if(handle->layer_mode & rocsparse_layer_mode_log_binary)
+            {
+                rocsparse_trace_record(rocsparse_trace_kind_trace, head, xs...);
+                return;
+            }
+
             std::string comma_separator = ",";
 
             std::ostream* os = handle->log_trace_os;
@@ -83,6 +101,12 @@ void log_bench(rocsparse_handle handle, H head, std::string precision, Ts&... xs
     {
         if(handle->layer_mode & rocsparse_layer_mode_log_bench)
         {
+            if(handle->layer_mode & rocsparse_layer_mode_log_binary)
+            {
+                rocsparse_trace_record(rocsparse_trace_kind_bench, head, precision, xs...);
+                return;
+            }
+
             std::string space_separator = " ";
 
             std::ostream* os = handle->log_bench_os;
@@ -103,7 +127,18 @@ std::string replaceX(std::string input_string)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'd');
     }
-    /*
+    else if(std::is_same<T, rocsparse_half>::value)
+    {
+        std::replace(input_string.begin(), input_string.end(), 'X', 'h');
+    }
+    else if(std::is_same<T, rocsparse_bfloat16>::value)
+    {
+        size_t pos = input_string.find('X');
+        if(pos != std::string::npos)
+        {
+            input_string.replace(pos, 1, "bf");
+        }
+    }
     else if(std::is_same<T, rocsparse_float_complex>::value)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'c');
@@ -112,12 +147,55 @@ std::string replaceX(std::string input_string)
     {
         std::replace(input_string.begin(), input_string.end(), 'X', 'z');
     }
+    return input_string;
+}
+
+// returns s, d, c, z, h or bf depending on typename T
+template <typename T>
+const char* rocsparse_precision_string()
+{
+    if(std::is_same<T, float>::value)
+    {
+        return "s";
+    }
+    else if(std::is_same<T, double>::value)
+    {
+        return "d";
+    }
     else if(std::is_same<T, rocsparse_half>::value)
     {
-        std::replace(input_string.begin(), input_string.end(), 'X', 'h');
+        return "h";
     }
-    */
-    return input_string;
+    else if(std::is_same<T, rocsparse_bfloat16>::value)
+    {
+        return "bf";
+    }
+    else if(std::is_same<T, rocsparse_float_complex>::value)
+    {
+        return "c";
+    }
+    else if(std::is_same<T, rocsparse_double_complex>::value)
+    {
+        return "z";
+    }
+    return "";
+}
+
+// returns the semiring name that rocsparse-bench accepts for --semiring
+inline const char* rocsparse_semiring_string(rocsparse_semiring semiring)
+{
+    switch(semiring)
+    {
+    case rocsparse_semiring_plus_times:
+        return "plus_times";
+    case rocsparse_semiring_min_plus:
+        return "min_plus";
+    case rocsparse_semiring_max_times:
+        return "max_times";
+    case rocsparse_semiring_or_and:
+        return "or_and";
+    }
+    return "";
 }
 
 #endif // UTILITY_H
@@ -104,6 +104,14 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xdoti",
+                                    rocsparse_precision_string<T>(),
+                                    0,
+                                    0,
+                                    nnz,
+                                    (sizeof(rocsparse_int) + 2 * sizeof(T)) * nnz);
+
     // Quick return if possible
     if(nnz == 0)
     {
@@ -117,6 +125,7 @@ rocsparse_status rocsparse_doti_template(rocsparse_handle handle,
     rocsparse_int nblocks = DOTI_DIM;
 
     // Get workspace from handle device buffer
+    RETURN_IF_ROCSPARSE_ERROR(handle->init_buffer());
     T* workspace = reinterpret_cast<T*>(handle->buffer);
 
     dim3 doti_blocks(nblocks);
@@ -83,6 +83,14 @@ rocsparse_status rocsparse_gthrz_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xgthrz",
+                                    rocsparse_precision_string<T>(),
+                                    0,
+                                    0,
+                                    nnz,
+                                    (sizeof(rocsparse_int) + 3 * sizeof(T)) * nnz);
+
     // Quick return if possible
     if(nnz == 0)
     {
@@ -25,6 +25,9 @@
 #ifndef COOMV_DEVICE_H
 #define COOMV_DEVICE_H
 
+#include "half.h"
+#include "complex.h"
+
 #include <hip/hip_runtime.h>
 
 // Scale kernel for beta != 1.0
@@ -44,13 +47,14 @@ __device__ void coomv_scale_device(rocsparse_int size, T beta, T* __restrict__ d
 // Implementation motivated by papers 'Efficient Sparse Matrix-Vector Multiplication on CUDA',
 // 'Implementing Sparse Matrix-Vector Multiplication on Throughput-Oriented Processors' and
 // 'Segmented operations for sparse matrix computation on vector multiprocessors'
-template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+// T is the compute type, U the storage type of the matrix values
+template <typename T, typename U, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
 static __device__ void coomvn_general_wf_reduce(rocsparse_int nnz,
                                                 rocsparse_int loops,
                                                 T alpha,
                                                 const rocsparse_int* coo_row_ind,
                                                 const rocsparse_int* coo_col_ind,
-                                                const T* coo_val,
+                                                const U* coo_val,
                                                 const T* x,
                                                 T* y,
                                                 rocsparse_int* row_block_red,
@@ -69,7 +73,7 @@ static __device__ void coomvn_general_wf_reduce(rocsparse_int nnz,
     if(lid == 0)
     {
         __builtin_nontemporal_store(-1, row_block_red + wid);
-        __builtin_nontemporal_store(static_cast<T>(0), val_block_red + wid);
+        nontemporal_value_store(static_cast<T>(0), val_block_red + wid);
     }
 
     // Global COO array index start for current wavefront
@@ -106,7 +110,7 @@ static __device__ void coomvn_general_wf_reduce(rocsparse_int nnz,
         if(idx < nnz)
         {
             row = __builtin_nontemporal_load(coo_row_ind + idx) - idx_base;
-            val = alpha * __builtin_nontemporal_load(coo_val + idx) *
+            val = alpha * nontemporal_matrix_value<T>(coo_val, idx) *
                   __ldg(x + __builtin_nontemporal_load(coo_col_ind + idx) - idx_base);
         }
         else
@@ -175,10 +179,44 @@ static __device__ void coomvn_general_wf_reduce(rocsparse_int nnz,
     if(lid == WF_SIZE - 1)
     {
         __builtin_nontemporal_store(row, row_block_red + wid);
-        __builtin_nontemporal_store(val, val_block_red + wid);
+        nontemporal_value_store(val, val_block_red + wid);
     }
 }
 
+// COO SpMV for general, transposed and conjugate transposed matrices
+// Each thread processes a single entry and scatters its contribution into y
+// T is the compute type, U the storage type of the matrix values
+template <typename T, typename U>
+static __device__ void coomvt_device(rocsparse_operation trans,
+                                     rocsparse_int nnz,
+                                     T alpha,
+                                     const rocsparse_int* coo_row_ind,
+                                     const rocsparse_int* coo_col_ind,
+                                     const U* coo_val,
+                                     const T* x,
+                                     T* y,
+                                     rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int row = __builtin_nontemporal_load(coo_row_ind + gid) - idx_base;
+    rocsparse_int col = __builtin_nontemporal_load(coo_col_ind + gid) - idx_base;
+
+    T val = nontemporal_matrix_value<T>(coo_val, gid);
+
+    if(trans == rocsparse_operation_conjugate_transpose)
+    {
+        val = rocsparse_conj(val);
+    }
+
+    atomicAdd(y + col, alpha * val * __ldg(x + row));
+}
+
 // Segmented block reduction kernel
 template <typename T, rocsparse_int BLOCKSIZE>
 static __device__ void segmented_blockreduce(const rocsparse_int* rows, T* vals)
@@ -0,0 +1,270 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef COOMV_SEMIRING_DEVICE_H
+#define COOMV_SEMIRING_DEVICE_H
+
+#include "semiring_device.h"
+
+#include <hip/hip_runtime.h>
+
+// y := beta * y, y is set to the additive identity if beta is the additive identity
+template <rocsparse_semiring S, typename T>
+__device__ void coomv_semiring_scale_device(rocsparse_int size, T beta, T* __restrict__ data)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    data[gid] = (beta == op::zero()) ? op::zero() : op::mul(beta, data[gid]);
+}
+
+// Semiring variant of coomvn_general_wf_reduce, see there for details
+template <rocsparse_semiring S, typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+static __device__ void coomvn_semiring_wf_reduce(rocsparse_int nnz,
+                                                 rocsparse_int loops,
+                                                 T alpha,
+                                                 const rocsparse_int* coo_row_ind,
+                                                 const rocsparse_int* coo_col_ind,
+                                                 const T* coo_val,
+                                                 const T* x,
+                                                 T* y,
+                                                 rocsparse_int* row_block_red,
+                                                 T* val_block_red,
+                                                 rocsparse_index_base idx_base)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocsparse_int tid = hipThreadIdx_x;
+
+    // Lane index (0,...,WF_SIZE)
+    rocsparse_int lid = gid % WF_SIZE;
+    // Wavefront index
+    rocsparse_int wid = gid / WF_SIZE;
+
+    // Initialize block buffers
+    if(lid == 0)
+    {
+        __builtin_nontemporal_store(-1, row_block_red + wid);
+        __builtin_nontemporal_store(op::zero(), val_block_red + wid);
+    }
+
+    // Global COO array index start for current wavefront
+    rocsparse_int offset = wid * loops * WF_SIZE;
+
+    // Shared memory to hold row indices and values for segmented reduction
+    __shared__ rocsparse_int shared_row[BLOCKSIZE];
+    __shared__ T shared_val[BLOCKSIZE];
+
+    // Initialize shared memory
+    shared_row[tid] = -1;
+    shared_val[tid] = op::zero();
+
+    __syncthreads();
+
+    // Quick return when thread is out of bounds
+    if(offset + lid >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int row;
+    T val;
+
+    // Current threads index into COO structure
+    rocsparse_int idx = offset + lid;
+
+    // Each thread processes 'loop' COO entries
+    while(idx < offset + loops * WF_SIZE)
+    {
+        if(idx < nnz)
+        {
+            T a = (coo_val == nullptr) ? op::one() : __builtin_nontemporal_load(coo_val + idx);
+
+            row = __builtin_nontemporal_load(coo_row_ind + idx) - idx_base;
+            val = op::mul(
+                alpha,
+                op::mul(a, __ldg(x + __builtin_nontemporal_load(coo_col_ind + idx) - idx_base)));
+        }
+        else
+        {
+            row = -1;
+            val = op::zero();
+        }
+
+        // First thread in wavefront checks row index from previous loop
+        if(idx > offset && lid == 0)
+        {
+            rocsparse_int prevrow = shared_row[tid + WF_SIZE - 1];
+            if(row == prevrow)
+            {
+                val = op::add(val, shared_val[tid + WF_SIZE - 1]);
+            }
+            else if(prevrow >= 0)
+            {
+                y[prevrow] = op::add(y[prevrow], shared_val[tid + WF_SIZE - 1]);
+            }
+        }
+
+        __syncthreads();
+
+        // Update shared buffers
+        shared_row[tid] = row;
+        shared_val[tid] = val;
+
+        __syncthreads();
+
+#pragma unroll
+        // Segmented wavefront reduction
+        for(rocsparse_int j = 1; j < WF_SIZE; j <<= 1)
+        {
+            if(lid >= j)
+            {
+                if(row == shared_row[tid - j])
+                {
+                    val = op::add(val, shared_val[tid - j]);
+                }
+            }
+            __syncthreads();
+
+            shared_val[tid] = val;
+
+            __syncthreads();
+        }
+
+        // All lanes but the last one write their result in y
+        if(lid < WF_SIZE - 1)
+        {
+            if(row != shared_row[tid + 1] && row >= 0)
+            {
+                y[row] = op::add(y[row], val);
+            }
+        }
+
+        // Keep going for the next iteration
+        idx += WF_SIZE;
+    }
+
+    // Write last entries into buffers for segmented block reduction
+    if(lid == WF_SIZE - 1)
+    {
+        __builtin_nontemporal_store(row, row_block_red + wid);
+        __builtin_nontemporal_store(val, val_block_red + wid);
+    }
+}
+
+// Semiring variant of coomvt_device, each thread scatters a single entry into y
+template <rocsparse_semiring S, typename T>
+static __device__ void coomvt_semiring_device(rocsparse_int nnz,
+                                              T alpha,
+                                              const rocsparse_int* coo_row_ind,
+                                              const rocsparse_int* coo_col_ind,
+                                              const T* coo_val,
+                                              const T* x,
+                                              T* y,
+                                              rocsparse_index_base idx_base)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int row = __builtin_nontemporal_load(coo_row_ind + gid) - idx_base;
+    rocsparse_int col = __builtin_nontemporal_load(coo_col_ind + gid) - idx_base;
+
+    T val = (coo_val == nullptr) ? op::one() : __builtin_nontemporal_load(coo_val + gid);
+
+    semiring_atomic_add<S>(y + col, op::mul(alpha, op::mul(val, __ldg(x + row))));
+}
+
+// Semiring variant of coomvn_general_block_reduce
+template <rocsparse_semiring S, typename T, rocsparse_int BLOCKSIZE>
+__global__ void coomvn_semiring_block_reduce(rocsparse_int nnz,
+                                             const rocsparse_int* __restrict__ row_block_red,
+                                             const T* __restrict__ val_block_red,
+                                             T* y)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    rocsparse_int tid = hipThreadIdx_x;
+
+    // Quick return when thread is out of bounds
+    if(tid >= nnz)
+    {
+        return;
+    }
+
+    // Shared memory to hold row indices and values for segmented reduction
+    __shared__ rocsparse_int shared_row[BLOCKSIZE];
+    __shared__ T shared_val[BLOCKSIZE];
+
+    // Loop over blocks that are subject for segmented reduction
+    for(rocsparse_int i = tid; i < nnz; i += BLOCKSIZE)
+    {
+        // Copy data to reduction buffers
+        shared_row[tid] = row_block_red[i];
+        shared_val[tid] = val_block_red[i];
+
+        __syncthreads();
+
+        // Do segmented block reduction
+#pragma unroll
+        for(rocsparse_int j = 1; j < BLOCKSIZE; j <<= 1)
+        {
+            T val = op::zero();
+            if(tid >= j)
+            {
+                if(shared_row[tid] == shared_row[tid - j])
+                {
+                    val = shared_val[tid - j];
+                }
+            }
+            __syncthreads();
+
+            shared_val[tid] = op::add(shared_val[tid], val);
+            __syncthreads();
+        }
+
+        // Add reduced sum to y if valid
+        rocsparse_int row = shared_row[tid];
+        if(row != shared_row[tid + 1] && row >= 0)
+        {
+            y[row] = op::add(y[row], shared_val[tid]);
+        }
+
+        __syncthreads();
+    }
+}
+
+#endif // COOMV_SEMIRING_DEVICE_H
@@ -0,0 +1,230 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSCMSPV_DEVICE_H
+#define CSCMSPV_DEVICE_H
+
+#include "semiring_device.h"
+
+#include <hip/hip_runtime.h>
+
+// Column index of each row wise entry, csr_col_ind[i] = coo_col_ind[map[i]]
+static __device__ void cscmspv_analysis_gather_device(rocsparse_int nnz,
+                                                      const rocsparse_int* __restrict__ map,
+                                                      const rocsparse_int* __restrict__ coo_col_ind,
+                                                      rocsparse_int* __restrict__ csr_col_ind)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    csr_col_ind[gid] = coo_col_ind[map[gid]];
+}
+
+// Set all entries of the sparse accumulator to the additive identity
+template <typename T>
+__device__ void cscmspv_fill_device(rocsparse_int size, T val, T* __restrict__ data)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    data[gid] = val;
+}
+
+// Dense copy of x and flags of its non-zero entries, used by pull
+template <rocsparse_semiring S, typename T>
+__device__ void cscmspv_scatter_device(rocsparse_int x_nnz,
+                                       const T* __restrict__ x_val,
+                                       const rocsparse_int* __restrict__ x_ind,
+                                       T* __restrict__ x,
+                                       rocsparse_int* __restrict__ xflag,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= x_nnz)
+    {
+        return;
+    }
+
+    rocsparse_int col = x_ind[gid] - idx_base;
+
+    x[col]     = semiring_value<S>(x_val, gid);
+    xflag[col] = 1;
+}
+
+// Reset the flags of the non-zero entries of x
+static __device__ void cscmspv_unmark_device(rocsparse_int x_nnz,
+                                             const rocsparse_int* __restrict__ x_ind,
+                                             rocsparse_int* __restrict__ xflag,
+                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= x_nnz)
+    {
+        return;
+    }
+
+    xflag[x_ind[gid] - idx_base] = 0;
+}
+
+// Push, each subgroup of WF_SIZE threads scatters the column of one non-zero entry
+// of x into the sparse accumulator. Rows that are reached for the first time are
+// appended to the list of the result.
+template <rocsparse_semiring S, typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+static __device__ void cscmspv_push_device(rocsparse_int x_nnz,
+                                           const T* __restrict__ x_val,
+                                           const rocsparse_int* __restrict__ x_ind,
+                                           const rocsparse_int* __restrict__ csc_col_ptr,
+                                           const rocsparse_int* __restrict__ csc_row_ind,
+                                           const T* __restrict__ csc_val,
+                                           T* __restrict__ acc,
+                                           rocsparse_int* __restrict__ flag,
+                                           rocsparse_int* __restrict__ list,
+                                           rocsparse_int* __restrict__ count,
+                                           rocsparse_index_base idx_base)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    rocsparse_int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    rocsparse_int k   = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SIZE;
+
+    if(k >= x_nnz)
+    {
+        return;
+    }
+
+    rocsparse_int col = x_ind[k] - idx_base;
+    T xk              = semiring_value<S>(x_val, k);
+
+    rocsparse_int col_begin = csc_col_ptr[col] - idx_base;
+    rocsparse_int col_end   = csc_col_ptr[col + 1] - idx_base;
+
+    for(rocsparse_int j = col_begin + lid; j < col_end; j += WF_SIZE)
+    {
+        rocsparse_int row = csc_row_ind[j] - idx_base;
+
+        semiring_atomic_add<S>(&acc[row], op::mul(semiring_value<S>(csc_val, j), xk));
+
+        if(atomicCAS(&flag[row], 0, 1) == 0)
+        {
+            list[atomicAdd(count, 1)] = row;
+        }
+    }
+}
+
+// Pull, each subgroup of WF_SIZE threads reduces one row of the matrix with the
+// dense copy of x. Rows with at least one entry in the columns of x are written
+// to the sparse accumulator and appended to the list of the result.
+template <rocsparse_semiring S, typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+static __device__ void cscmspv_pull_device(rocsparse_int m,
+                                           const rocsparse_int* __restrict__ csr_row_ptr,
+                                           const rocsparse_int* __restrict__ csr_col_ind,
+                                           const rocsparse_int* __restrict__ map,
+                                           const T* __restrict__ csc_val,
+                                           const T* __restrict__ x,
+                                           const rocsparse_int* __restrict__ xflag,
+                                           T* __restrict__ acc,
+                                           rocsparse_int* __restrict__ list,
+                                           rocsparse_int* __restrict__ count,
+                                           rocsparse_index_base idx_base)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    rocsparse_int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SIZE;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    T sum               = op::zero();
+    rocsparse_int found = 0;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(xflag[col])
+        {
+            sum   = op::add(sum, op::mul(semiring_value<S>(csc_val, map[j]), x[col]));
+            found = 1;
+        }
+    }
+
+    sum   = semiring_wf_reduce<S, WF_SIZE>(sum);
+    found = semiring_wf_reduce<rocsparse_semiring_or_and, WF_SIZE>(found);
+
+    if(lid == 0 && found)
+    {
+        acc[row]                  = sum;
+        list[atomicAdd(count, 1)] = row;
+    }
+}
+
+// Copy the result from the sparse accumulator and restore its additive identity.
+// y_ind holds the sorted rows of the result on entry.
+template <rocsparse_semiring S, typename T>
+__device__ void cscmspv_gather_device(rocsparse_int y_nnz,
+                                      T alpha,
+                                      T* __restrict__ acc,
+                                      rocsparse_int* __restrict__ flag,
+                                      T* __restrict__ y_val,
+                                      rocsparse_int* __restrict__ y_ind,
+                                      rocsparse_index_base idx_base)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= y_nnz)
+    {
+        return;
+    }
+
+    rocsparse_int row = y_ind[gid];
+
+    if(y_val != nullptr)
+    {
+        y_val[gid] = op::mul(alpha, acc[row]);
+    }
+
+    acc[row]   = op::zero();
+    flag[row]  = 0;
+    y_ind[gid] = row + idx_base;
+}
+
+#endif // CSCMSPV_DEVICE_H
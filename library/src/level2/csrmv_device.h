@@ -25,6 +25,8 @@
 #ifndef CSRMV_DEVICE_H
 #define CSRMV_DEVICE_H
 
+#include "half.h"
+
 #include <hip/hip_runtime.h>
 
 #if defined(__HIP_PLATFORM_HCC__)
@@ -159,12 +161,13 @@ __device__ T wf_reduce(T sum)
 }
 #endif
 
-template <typename T, rocsparse_int WF_SIZE>
+// T is the compute type, U the storage type of the matrix values
+template <typename T, typename U, rocsparse_int WF_SIZE>
 static __device__ void csrmvn_general_device(rocsparse_int m,
                                              T alpha,
                                              const rocsparse_int* row_offset,
                                              const rocsparse_int* csr_col_ind,
-                                             const T* csr_val,
+                                             const U* csr_val,
                                              const T* x,
                                              T beta,
                                              T* y,
@@ -187,7 +190,8 @@ static __device__ void csrmvn_general_device(rocsparse_int m,
         // Loop over non-zero elements
         for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
         {
-            sum = fma(alpha * csr_val[j], __ldg(x + csr_col_ind[j] - idx_base), sum);
+            sum = fma(
+                alpha * matrix_value<T>(csr_val, j), __ldg(x + csr_col_ind[j] - idx_base), sum);
         }
 
         // Obtain row sum using parallel reduction
@@ -264,6 +268,7 @@ static inline __device__ T sum2_reduce(
 }
 
 template <typename T,
+          typename U,
           rocsparse_int BLOCKSIZE,
           rocsparse_int BLOCK_MULTIPLIER,
           rocsparse_int ROWS_FOR_VECTOR,
@@ -274,7 +279,7 @@ __device__ void csrmvn_adaptive_device(unsigned long long* row_blocks,
                                        T alpha,
                                        const rocsparse_int* csr_row_ptr,
                                        const rocsparse_int* csr_col_ind,
-                                       const T* csr_val,
+                                       const U* csr_val,
                                        const T* x,
                                        T beta,
                                        T* y,
@@ -364,7 +369,7 @@ __device__ void csrmvn_adaptive_device(unsigned long long* row_blocks,
             for(rocsparse_int i = 0; i < BLOCKSIZE; i += WG_SIZE)
             {
                 partialSums[lid + i] =
-                    alpha * csr_val[col + i] * x[csr_col_ind[col + i] - idx_base];
+                    alpha * matrix_value<T>(csr_val, col + i) * x[csr_col_ind[col + i] - idx_base];
             }
         }
         else
@@ -379,7 +384,7 @@ __device__ void csrmvn_adaptive_device(unsigned long long* row_blocks,
             for(rocsparse_int i = 0; col + i < csr_row_ptr[stop_row] - idx_base; i += WG_SIZE)
             {
                 partialSums[lid + i] =
-                    alpha * csr_val[col + i] * x[csr_col_ind[col + i] - idx_base];
+                    alpha * matrix_value<T>(csr_val, col + i) * x[csr_col_ind[col + i] - idx_base];
             }
         }
         __syncthreads();
@@ -502,7 +507,8 @@ __device__ void csrmvn_adaptive_device(unsigned long long* row_blocks,
             for(unsigned long long j = vecStart + lid; j < vecEnd; j += WG_SIZE)
             {
                 rocsparse_int col = csr_col_ind[(unsigned int)j] - idx_base;
-                temp_sum          = fma(alpha, csr_val[(unsigned int)j] * x[col], temp_sum);
+                temp_sum =
+                    fma(alpha, matrix_value<T>(csr_val, (unsigned int)j) * x[col], temp_sum);
             }
 
             partialSums[lid] = temp_sum;
@@ -580,13 +586,17 @@ __device__ void csrmvn_adaptive_device(unsigned long long* row_blocks,
             // That increases register pressure and reduces occupancy.
             for(rocsparse_int j = 0; j < vecEnd - col; j += WG_SIZE)
             {
-                temp_sum =
-                    fma(alpha, csr_val[col + j] * x[csr_col_ind[col + j] - idx_base], temp_sum);
+                temp_sum = fma(alpha,
+                               matrix_value<T>(csr_val, col + j) *
+                                   x[csr_col_ind[col + j] - idx_base],
+                               temp_sum);
 #if 2 * WG_SIZE <= BLOCK_MULTIPLIER * BLOCKSIZE
                 // If you can, unroll this loop once. It somewhat helps performance.
                 j += WG_SIZE;
-                temp_sum =
-                    fma(alpha, csr_val[col + j] * x[csr_col_ind[col + j] - idx_base], temp_sum);
+                temp_sum = fma(alpha,
+                               matrix_value<T>(csr_val, col + j) *
+                                   x[csr_col_ind[col + j] - idx_base],
+                               temp_sum);
 #endif
             }
         }
@@ -594,8 +604,10 @@ __device__ void csrmvn_adaptive_device(unsigned long long* row_blocks,
         {
             for(rocsparse_int j = 0; j < vecEnd - col; j += WG_SIZE)
             {
-                temp_sum =
-                    fma(alpha, csr_val[col + j] * x[csr_col_ind[col + j] - idx_base], temp_sum);
+                temp_sum = fma(alpha,
+                               matrix_value<T>(csr_val, col + j) *
+                                   x[csr_col_ind[col + j] - idx_base],
+                               temp_sum);
             }
         }
 
@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRMV_MASKED_DEVICE_H
+#define CSRMV_MASKED_DEVICE_H
+
+#include "csrmv_device.h"
+
+#include <hip/hip_runtime.h>
+
+// Scale the selected rows of y with beta and store the number of non-zero entries of
+// each selected row, such that a prefix sum yields the offsets of the selected rows
+// in the sequence of all selected non-zero entries
+template <typename T>
+static __device__ void csrmv_masked_setup_device(rocsparse_int mask_nnz,
+                                                 const rocsparse_int* __restrict__ mask_ind,
+                                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                                 T beta,
+                                                 T* __restrict__ y,
+                                                 rocsparse_int* __restrict__ mask_ptr,
+                                                 rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid == 0)
+    {
+        mask_ptr[0] = 0;
+    }
+
+    if(gid >= mask_nnz)
+    {
+        return;
+    }
+
+    rocsparse_int row = mask_ind[gid] - idx_base;
+
+    mask_ptr[gid + 1] = csr_row_ptr[row + 1] - csr_row_ptr[row];
+
+    if(beta == static_cast<T>(0))
+    {
+        y[row] = static_cast<T>(0);
+    }
+    else
+    {
+        y[row] *= beta;
+    }
+}
+
+// Each wavefront processes tiles of TILE_SIZE consecutive selected non-zero entries,
+// independent of how they are distributed over the selected rows. Rows that are
+// completely contained in a tile are updated directly, rows that span multiple tiles
+// are accumulated atomically.
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int TILE_SIZE>
+static __device__ void csrmvn_masked_device(rocsparse_int mask_nnz,
+                                            const rocsparse_int* __restrict__ mask_ind,
+                                            const rocsparse_int* __restrict__ mask_ptr,
+                                            T alpha,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const T* __restrict__ csr_val,
+                                            const T* __restrict__ x,
+                                            T* __restrict__ y,
+                                            rocsparse_index_base idx_base)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    rocsparse_int wid = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WF_SIZE;
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Total number of selected non-zero entries
+    rocsparse_int total = mask_ptr[mask_nnz];
+
+    for(rocsparse_int tile_begin = wid * TILE_SIZE; tile_begin < total;
+        tile_begin += nwf * TILE_SIZE)
+    {
+        rocsparse_int tile_end = min(tile_begin + TILE_SIZE, total);
+
+        // Binary search for the last selected row that starts at or before the tile
+        rocsparse_int i  = 0;
+        rocsparse_int hi = mask_nnz - 1;
+
+        while(i < hi)
+        {
+            rocsparse_int mid = (i + hi + 1) >> 1;
+
+            if(mask_ptr[mid] <= tile_begin)
+            {
+                i = mid;
+            }
+            else
+            {
+                hi = mid - 1;
+            }
+        }
+
+        // Loop over the selected rows of the tile
+        for(rocsparse_int pos = tile_begin; pos < tile_end; ++i)
+        {
+            rocsparse_int row_begin = mask_ptr[i];
+            rocsparse_int row_end   = mask_ptr[i + 1];
+            rocsparse_int seg_end   = min(row_end, tile_end);
+
+            // Skip empty rows
+            if(seg_end == pos)
+            {
+                continue;
+            }
+
+            rocsparse_int row   = mask_ind[i] - idx_base;
+            rocsparse_int shift = csr_row_ptr[row] - idx_base - row_begin;
+
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int j = pos + lid; j < seg_end; j += WF_SIZE)
+            {
+                sum = fma(csr_val[j + shift], __ldg(x + csr_col_ind[j + shift] - idx_base), sum);
+            }
+
+            // Obtain row sum using parallel reduction
+            sum = wf_reduce<WF_SIZE>(sum);
+
+            // First thread of each wavefront writes result into global memory
+            if(lid == 0)
+            {
+                if(row_begin >= tile_begin && row_end <= tile_end)
+                {
+                    y[row] = fma(alpha, sum, y[row]);
+                }
+                else
+                {
+                    atomicAdd(&y[row], alpha * sum);
+                }
+            }
+
+            pos = seg_end;
+        }
+    }
+}
+
+#endif // CSRMV_MASKED_DEVICE_H
@@ -0,0 +1,287 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRMV_SEMIRING_DEVICE_H
+#define CSRMV_SEMIRING_DEVICE_H
+
+#include "csrmv_device.h"
+#include "semiring_device.h"
+
+#include <hip/hip_runtime.h>
+
+// Semiring variant of csrmvn_general_device, each wavefront processes one row
+template <rocsparse_semiring S, typename T, rocsparse_int WF_SIZE>
+static __device__ void csrmvn_semiring_general_device(rocsparse_int m,
+                                                      T alpha,
+                                                      const rocsparse_int* row_offset,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      const T* csr_val,
+                                                      const T* x,
+                                                      T beta,
+                                                      T* y,
+                                                      rocsparse_index_base idx_base)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        T sum = op::zero();
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = op::add(sum,
+                          op::mul(semiring_value<S>(csr_val, j),
+                                  __ldg(x + csr_col_ind[j] - idx_base)));
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = semiring_wf_reduce<S, WF_SIZE>(sum);
+
+        // First thread of each wavefront writes result into global memory
+        if(lid == 0)
+        {
+            y[row] = semiring_axpby<S>(alpha, sum, beta, y + row);
+        }
+    }
+}
+
+// Semiring variant of csrmvn_adaptive_device, see there for a detailed description
+// of the row blocks and the CSR-Stream, CSR-Vector and CSR-LongRows cases. Partial
+// results are accumulated without alpha, which is applied once per row instead.
+template <rocsparse_semiring S,
+          typename T,
+          rocsparse_int BLOCKSIZE,
+          rocsparse_int BLOCK_MULTIPLIER,
+          rocsparse_int ROWS_FOR_VECTOR,
+          rocsparse_int WG_BITS,
+          rocsparse_int ROW_BITS,
+          rocsparse_int WG_SIZE>
+static __device__ void csrmvn_semiring_adaptive_device(unsigned long long* row_blocks,
+                                                       T alpha,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       const T* csr_val,
+                                                       const T* x,
+                                                       T beta,
+                                                       T* y,
+                                                       rocsparse_index_base idx_base)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    __shared__ T partialSums[BLOCKSIZE];
+    rocsparse_int gid = hipBlockIdx_x;
+    rocsparse_int lid = hipThreadIdx_x;
+
+    rocsparse_int row = ((row_blocks[gid] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    rocsparse_int stop_row =
+        ((row_blocks[gid + 1] >> (64 - ROW_BITS)) & ((1ULL << ROW_BITS) - 1ULL));
+    rocsparse_int num_rows = stop_row - row;
+
+    // Workgroup ID within a long row, or number of reduce threads for short rows
+    rocsparse_int wg = row_blocks[gid] & ((1 << WG_BITS) - 1);
+
+    rocsparse_int vecStart =
+        rocsparse_mad24(wg, BLOCK_MULTIPLIER * BLOCKSIZE, csr_row_ptr[row] - idx_base);
+    rocsparse_int vecEnd =
+        ((csr_row_ptr[row + 1] - idx_base) > vecStart + BLOCK_MULTIPLIER * BLOCKSIZE)
+            ? vecStart + BLOCK_MULTIPLIER * BLOCKSIZE
+            : (csr_row_ptr[row + 1] - idx_base);
+
+    T temp_sum = op::zero();
+
+    if(num_rows > ROWS_FOR_VECTOR)
+    {
+        // CSR-Stream case
+        rocsparse_int numThreadsForRed = wg;
+
+        // Stream all of this row block's products into local memory
+        rocsparse_int col = csr_row_ptr[row] + lid - idx_base;
+        if(gid != (hipGridDim_x - 1))
+        {
+            for(rocsparse_int i = 0; i < BLOCKSIZE; i += WG_SIZE)
+            {
+                partialSums[lid + i] = op::mul(semiring_value<S>(csr_val, col + i),
+                                               x[csr_col_ind[col + i] - idx_base]);
+            }
+        }
+        else
+        {
+            // Stay in bounds for the last workgroup
+            for(rocsparse_int i = 0; col + i < csr_row_ptr[stop_row] - idx_base; i += WG_SIZE)
+            {
+                partialSums[lid + i] = op::mul(semiring_value<S>(csr_val, col + i),
+                                               x[csr_col_ind[col + i] - idx_base]);
+            }
+        }
+        __syncthreads();
+
+        if(numThreadsForRed > 1)
+        {
+            // {numThreadsForRed} adjacent threads team up to reduce a row
+            rocsparse_int local_row       = row + (lid >> (31 - __clz(numThreadsForRed)));
+            rocsparse_int local_first_val = csr_row_ptr[local_row] - csr_row_ptr[row];
+            rocsparse_int local_last_val  = csr_row_ptr[local_row + 1] - csr_row_ptr[row];
+            rocsparse_int threadInBlock   = lid & (numThreadsForRed - 1);
+
+            if(local_row < stop_row)
+            {
+                for(rocsparse_int local_cur_val = local_first_val + threadInBlock;
+                    local_cur_val < local_last_val;
+                    local_cur_val += numThreadsForRed)
+                {
+                    temp_sum = op::add(temp_sum, partialSums[local_cur_val]);
+                }
+            }
+            __syncthreads();
+
+            partialSums[lid] = temp_sum;
+
+            // Reduce the {numThreadsForRed} partial results of each row
+            for(rocsparse_int i = (WG_SIZE >> 1); i > 0; i >>= 1)
+            {
+                __syncthreads();
+                temp_sum =
+                    semiring_sum2_reduce<S>(temp_sum, partialSums, lid, numThreadsForRed, i);
+            }
+
+            if(threadInBlock == 0 && local_row < stop_row)
+            {
+                y[local_row] = semiring_axpby<S>(alpha, temp_sum, beta, y + local_row);
+            }
+        }
+        else
+        {
+            // Each thread reduces a single row out of local memory
+            rocsparse_int local_row = row + lid;
+            while(local_row < stop_row)
+            {
+                rocsparse_int local_first_val = (csr_row_ptr[local_row] - csr_row_ptr[row]);
+                rocsparse_int local_last_val  = csr_row_ptr[local_row + 1] - csr_row_ptr[row];
+                temp_sum                      = op::zero();
+                for(rocsparse_int local_cur_val = local_first_val; local_cur_val < local_last_val;
+                    local_cur_val++)
+                {
+                    temp_sum = op::add(temp_sum, partialSums[local_cur_val]);
+                }
+
+                y[local_row] = semiring_axpby<S>(alpha, temp_sum, beta, y + local_row);
+                local_row += WG_SIZE;
+            }
+        }
+    }
+    else if(num_rows >= 1 && !wg)
+    {
+        // CSR-Vector case
+        while(row < stop_row)
+        {
+            temp_sum = op::zero();
+            vecStart = csr_row_ptr[row] - idx_base;
+            vecEnd   = csr_row_ptr[row + 1] - idx_base;
+
+            for(unsigned long long j = vecStart + lid; j < vecEnd; j += WG_SIZE)
+            {
+                rocsparse_int col = csr_col_ind[(unsigned int)j] - idx_base;
+                temp_sum          = op::add(
+                    temp_sum, op::mul(semiring_value<S>(csr_val, (unsigned int)j), x[col]));
+            }
+
+            partialSums[lid] = temp_sum;
+
+            // Reduce partial sums
+            for(rocsparse_int i = (WG_SIZE >> 1); i > 0; i >>= 1)
+            {
+                __syncthreads();
+                temp_sum = semiring_sum2_reduce<S>(temp_sum, partialSums, lid, WG_SIZE, i);
+            }
+
+            if(lid == 0)
+            {
+                y[row] = semiring_axpby<S>(alpha, temp_sum, beta, y + row);
+            }
+            ++row;
+        }
+    }
+    else
+    {
+        // CSR-LongRows case. The first workgroup of the row initializes the output
+        // with beta * y, all workgroups then atomically add alpha times their partial
+        // result. This relies on the distributivity of the semiring multiplication.
+        rocsparse_int first_wg_in_row = gid - (row_blocks[gid] & ((1ULL << WG_BITS) - 1ULL));
+        rocsparse_int compare_value   = row_blocks[gid] & (1ULL << WG_BITS);
+
+        if(gid == first_wg_in_row && lid == 0)
+        {
+            y[row] = (beta == op::zero()) ? op::zero() : op::mul(beta, y[row]);
+            __threadfence();
+            atomicXor(&row_blocks[first_wg_in_row], (1ULL << WG_BITS)); // Release other workgroups.
+        }
+
+        // All other workgroups spin until the output has been initialized
+        __syncthreads();
+        while(
+            gid != first_wg_in_row && lid == 0 &&
+            ((atomicMax(&row_blocks[first_wg_in_row], 0ULL) & (1ULL << WG_BITS)) == compare_value))
+            ;
+        __syncthreads();
+
+        // Update the local flag for the next call
+        if(gid != first_wg_in_row && lid == 0)
+            row_blocks[gid] ^= (1ULL << WG_BITS);
+
+        rocsparse_int col = vecStart + lid;
+        for(rocsparse_int j = 0; j < vecEnd - col; j += WG_SIZE)
+        {
+            temp_sum = op::add(temp_sum,
+                               op::mul(semiring_value<S>(csr_val, col + j),
+                                       x[csr_col_ind[col + j] - idx_base]));
+        }
+
+        partialSums[lid] = temp_sum;
+
+        // Reduce partial sums
+        for(rocsparse_int i = (WG_SIZE >> 1); i > 0; i >>= 1)
+        {
+            __syncthreads();
+            temp_sum = semiring_sum2_reduce<S>(temp_sum, partialSums, lid, WG_SIZE, i);
+        }
+
+        if(lid == 0)
+        {
+            semiring_atomic_add<S>(&y[row], op::mul(alpha, temp_sum));
+        }
+    }
+}
+
+#endif // CSRMV_SEMIRING_DEVICE_H
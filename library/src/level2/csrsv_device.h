@@ -25,6 +25,9 @@
 #ifndef CSRSV_DEVICE_H
 #define CSRSV_DEVICE_H
 
+#include "half.h"
+#include "complex.h"
+
 #include <hip/hip_runtime.h>
 
 // Compute intra wavefront maximum and spin summation
@@ -223,7 +226,7 @@ __device__ int __llvm_amdgcn_readlane(int index, int offset) __asm("llvm.amdgcn.
 
 // Swizzle based intra wavefront reduction sum
 template <rocsparse_int WF_SIZE>
-static __device__ __inline__ float wf_reduce(float temp_sum)
+static __device__ __inline__ float csrsv_wf_reduce(float temp_sum)
 {
     typedef union flt_b32
     {
@@ -277,7 +280,7 @@ static __device__ __inline__ float wf_reduce(float temp_sum)
 
 // Swizzle based intra wavefront reduction sum
 template <rocsparse_int WF_SIZE>
-static __device__ __inline__ double wf_reduce(double temp_sum)
+static __device__ __inline__ double csrsv_wf_reduce(double temp_sum)
 {
     typedef union dbl_b32
     {
@@ -336,7 +339,7 @@ static __device__ __inline__ double wf_reduce(double temp_sum)
 }
 #elif defined(__HIP_PLATFORM_NVCC__)
 template <rocsparse_int WF_SIZE, typename T>
-static __device__ __inline__ T wf_reduce(T temp_sum)
+static __device__ __inline__ T csrsv_wf_reduce(T temp_sum)
 {
     // Perform wavefront reduction sum
     for(int i = WF_SIZE >> 1; i >= 1; i >>= 1)
@@ -348,6 +351,16 @@ static __device__ __inline__ T wf_reduce(T temp_sum)
 }
 #endif
 
+// Intra wavefront reduction sum for complex numbers, real and imaginary part are
+// reduced independently
+template <rocsparse_int WF_SIZE, typename T>
+static __device__ __inline__ rocsparse_complex_num<T>
+    csrsv_wf_reduce(rocsparse_complex_num<T> temp_sum)
+{
+    return rocsparse_complex_num<T>(csrsv_wf_reduce<WF_SIZE>(temp_sum.x),
+                                    csrsv_wf_reduce<WF_SIZE>(temp_sum.y));
+}
+
 template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
 __device__ void csrsv_device(rocsparse_int m,
                              T alpha,
@@ -394,7 +407,7 @@ __device__ void csrsv_device(rocsparse_int m,
     if(lid == 0)
     {
         // Lane 0 initializes its local sum with alpha and x
-        local_sum = alpha * __builtin_nontemporal_load(x + row);
+        local_sum = alpha * nontemporal_value_load(x + row);
     }
 
     for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
@@ -403,7 +416,7 @@ __device__ void csrsv_device(rocsparse_int m,
         rocsparse_int local_col = __builtin_nontemporal_load(csr_col_ind + j) - idx_base;
 
         // Local value this lane operates with
-        T local_val = __builtin_nontemporal_load(csr_val + j);
+        T local_val = nontemporal_value_load(csr_val + j);
 
         // Check for numerical zero
         if(local_val == static_cast<T>(0) && local_col == row &&
@@ -474,8 +487,7 @@ __device__ void csrsv_device(rocsparse_int m,
 
 // Load y value bypassing caches
 #if defined(__HIP_PLATFORM_HCC__)
-        T out_val;
-        __atomic_load(&y[local_col], &out_val, __ATOMIC_ACQUIRE);
+        T out_val = atomic_value_load(&y[local_col]);
 #elif defined(__HIP_PLATFORM_NVCC__)
         T out_val = y[local_col];
 #endif
@@ -485,7 +497,7 @@ __device__ void csrsv_device(rocsparse_int m,
     }
 
     // Gather all local sums for each lane
-    local_sum = wf_reduce<WF_SIZE>(local_sum);
+    local_sum = csrsv_wf_reduce<WF_SIZE>(local_sum);
 
     // If we have non unit diagonal, take the diagonal into account
     // For unit diagonal, this would be multiplication with one
@@ -498,7 +510,7 @@ __device__ void csrsv_device(rocsparse_int m,
     {
 // Lane 0 writes the "row is done" flag and stores the rows result in y
 #if defined(__HIP_PLATFORM_HCC__)
-        __atomic_store(&y[row], &local_sum, __ATOMIC_RELEASE);
+        atomic_value_store(local_sum, &y[row]);
         __atomic_store_n(&done_array[row], 1, __ATOMIC_RELEASE);
 #elif defined(__HIP_PLATFORM_NVCC__)
         y[row]    = local_sum;
@@ -0,0 +1,186 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRSV_ITERATIVE_DEVICE_H
+#define CSRSV_ITERATIVE_DEVICE_H
+
+#include "complex.h"
+#include "../level1/doti_device.h"
+
+#include <hip/hip_runtime.h>
+
+// One synchronous Jacobi sweep y_new = D^-1 * (alpha * x - N * y_old) on the triangular
+// part of the matrix, where D is its diagonal and N its strictly triangular part. Each
+// thread computes one row. The squared norms of the update and of the solution are
+// accumulated into history[0] and history[1].
+template <typename T, unsigned int BLOCKSIZE>
+static __device__ void csrsv_iterative_device(rocsparse_int m,
+                                              T alpha,
+                                              const rocsparse_int* __restrict__ csr_row_ptr,
+                                              const rocsparse_int* __restrict__ csr_col_ind,
+                                              const T* __restrict__ csr_val,
+                                              const T* __restrict__ x,
+                                              const T* __restrict__ y_old,
+                                              T* __restrict__ y_new,
+                                              rocsparse_int* __restrict__ zero_pivot,
+                                              double* __restrict__ history,
+                                              rocsparse_index_base idx_base,
+                                              rocsparse_fill_mode fill_mode,
+                                              rocsparse_diag_type diag_type)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ double sdelta[BLOCKSIZE];
+    __shared__ double snorm[BLOCKSIZE];
+
+    sdelta[tid] = 0.0;
+    snorm[tid]  = 0.0;
+
+    if(row < m)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum      = alpha * x[row];
+        T diag_val = static_cast<T>(0);
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            if(col == row)
+            {
+                diag_val = csr_val[j];
+            }
+            else if((fill_mode == rocsparse_fill_mode_lower && col < row) ||
+                    (fill_mode == rocsparse_fill_mode_upper && col > row))
+            {
+                sum -= csr_val[j] * y_old[col];
+            }
+        }
+
+        bool valid = true;
+
+        if(diag_type == rocsparse_diag_type_non_unit)
+        {
+            if(diag_val == static_cast<T>(0))
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, row + idx_base);
+                valid = false;
+            }
+            else
+            {
+                sum /= diag_val;
+            }
+        }
+
+        if(valid)
+        {
+            sdelta[tid] = rocsparse_abs2(sum - y_old[row]);
+            snorm[tid]  = rocsparse_abs2(sum);
+
+            y_new[row] = sum;
+        }
+        else
+        {
+            y_new[row] = y_old[row];
+        }
+    }
+
+    rocsparse_sum_reduce<BLOCKSIZE, double>(tid, sdelta);
+    rocsparse_sum_reduce<BLOCKSIZE, double>(tid, snorm);
+
+    if(tid == 0)
+    {
+        atomicAdd(&history[0], sdelta[0]);
+        atomicAdd(&history[1], snorm[0]);
+    }
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_iterative_host_pointer(rocsparse_int m,
+                                      T alpha,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      const T* __restrict__ csr_val,
+                                      const T* __restrict__ x,
+                                      const T* __restrict__ y_old,
+                                      T* __restrict__ y_new,
+                                      rocsparse_int* __restrict__ zero_pivot,
+                                      double* __restrict__ history,
+                                      rocsparse_index_base idx_base,
+                                      rocsparse_fill_mode fill_mode,
+                                      rocsparse_diag_type diag_type)
+{
+    csrsv_iterative_device<T, BLOCKSIZE>(m,
+                                         alpha,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         csr_val,
+                                         x,
+                                         y_old,
+                                         y_new,
+                                         zero_pivot,
+                                         history,
+                                         idx_base,
+                                         fill_mode,
+                                         diag_type);
+}
+
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_iterative_device_pointer(rocsparse_int m,
+                                        const T* alpha,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                        const T* __restrict__ csr_val,
+                                        const T* __restrict__ x,
+                                        const T* __restrict__ y_old,
+                                        T* __restrict__ y_new,
+                                        rocsparse_int* __restrict__ zero_pivot,
+                                        double* __restrict__ history,
+                                        rocsparse_index_base idx_base,
+                                        rocsparse_fill_mode fill_mode,
+                                        rocsparse_diag_type diag_type)
+{
+    csrsv_iterative_device<T, BLOCKSIZE>(m,
+                                         *alpha,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         csr_val,
+                                         x,
+                                         y_old,
+                                         y_new,
+                                         zero_pivot,
+                                         history,
+                                         idx_base,
+                                         fill_mode,
+                                         diag_type);
+}
+
+#endif // CSRSV_ITERATIVE_DEVICE_H
@@ -26,17 +26,20 @@
 #define ELLMV_DEVICE_H
 
 #include "handle.h"
+#include "half.h"
+#include "complex.h"
 
 #include <hip/hip_runtime.h>
 
 // ELL SpMV for general, non-transposed matrices
-template <typename T>
+// T is the compute type, U the storage type of the matrix values
+template <typename T, typename U>
 static __device__ void ellmvn_device(rocsparse_int m,
                                      rocsparse_int n,
                                      rocsparse_int ell_width,
                                      T alpha,
                                      const rocsparse_int* ell_col_ind,
-                                     const T* ell_val,
+                                     const U* ell_val,
                                      const T* x,
                                      T beta,
                                      T* y,
@@ -57,7 +60,7 @@ static __device__ void ellmvn_device(rocsparse_int m,
 
         if(col >= 0 && col < n)
         {
-            sum = fma(__builtin_nontemporal_load(ell_val + idx), __ldg(x + col), sum);
+            sum = fma(nontemporal_matrix_value<T>(ell_val, idx), __ldg(x + col), sum);
         }
         else
         {
@@ -67,12 +70,80 @@ static __device__ void ellmvn_device(rocsparse_int m,
 
     if(beta != static_cast<T>(0))
     {
-        T yv = __builtin_nontemporal_load(y + ai);
-        __builtin_nontemporal_store(fma(beta, yv, alpha * sum), y + ai);
+        T yv = nontemporal_value_load(y + ai);
+        nontemporal_value_store(fma(beta, yv, alpha * sum), y + ai);
     }
     else
     {
-        __builtin_nontemporal_store(alpha * sum, y + ai);
+        nontemporal_value_store(alpha * sum, y + ai);
+    }
+}
+
+// Scale kernel for the transposed ELL SpMV, y = beta * y
+template <typename T>
+static __device__ void ellmvt_scale_device(rocsparse_int size, T beta, T* y)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    if(beta != static_cast<T>(0))
+    {
+        y[gid] *= beta;
+    }
+    else
+    {
+        y[gid] = static_cast<T>(0);
+    }
+}
+
+// ELL SpMV for general, transposed and conjugate transposed matrices
+// Each thread processes a row of A and scatters its contributions into y
+// T is the compute type, U the storage type of the matrix values
+template <typename T, typename U>
+static __device__ void ellmvt_device(rocsparse_operation trans,
+                                     rocsparse_int m,
+                                     rocsparse_int n,
+                                     rocsparse_int ell_width,
+                                     T alpha,
+                                     const rocsparse_int* ell_col_ind,
+                                     const U* ell_val,
+                                     const T* x,
+                                     T* y,
+                                     rocsparse_index_base idx_base)
+{
+    rocsparse_int ai = hipBlockDim_x * hipBlockIdx_x + hipThreadIdx_x;
+
+    if(ai >= m)
+    {
+        return;
+    }
+
+    T xa = alpha * __ldg(x + ai);
+
+    for(rocsparse_int p = 0; p < ell_width; ++p)
+    {
+        rocsparse_int idx = ELL_IND(ai, p, m, ell_width);
+        rocsparse_int col = __builtin_nontemporal_load(ell_col_ind + idx) - idx_base;
+
+        if(col >= 0 && col < n)
+        {
+            T val = nontemporal_matrix_value<T>(ell_val, idx);
+
+            if(trans == rocsparse_operation_conjugate_transpose)
+            {
+                val = rocsparse_conj(val);
+            }
+
+            atomicAdd(y + col, val * xa);
+        }
+        else
+        {
+            break;
+        }
     }
 }
 
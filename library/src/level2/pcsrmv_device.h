@@ -0,0 +1,89 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef PCSRMV_DEVICE_H
+#define PCSRMV_DEVICE_H
+
+#include "csrmv_device.h"
+
+#include <hip/hip_runtime.h>
+
+// T is the compute type, U the storage type of the matrix values and D the type of
+// the column deltas. The column index of each entry is decoded from the column base
+// of its row block and its delta, such that only the narrow deltas are streamed.
+template <typename T, typename U, typename D, rocsparse_int WF_SIZE>
+static __device__ void pcsrmvn_general_device(rocsparse_int m,
+                                              T alpha,
+                                              rocsparse_int block_dim,
+                                              const rocsparse_int* row_offset,
+                                              const rocsparse_int* col_base,
+                                              const D* col_delta,
+                                              const U* val,
+                                              const T* x,
+                                              T beta,
+                                              T* y,
+                                              rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + tid;
+    rocsparse_int lid = tid & (WF_SIZE - 1);
+    rocsparse_int nwf = hipGridDim_x * hipBlockDim_x / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        // Each wavefront processes one row
+        rocsparse_int row_start = row_offset[row] - idx_base;
+        rocsparse_int row_end   = row_offset[row + 1] - idx_base;
+
+        // Shift x to the column base of the row block
+        const T* xb = x + col_base[row / block_dim];
+
+        T sum = static_cast<T>(0);
+
+        // Loop over non-zero elements
+        for(rocsparse_int j = row_start + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = fma(alpha * matrix_value<T>(val, j), __ldg(xb + col_delta[j]), sum);
+        }
+
+        // Obtain row sum using parallel reduction
+        sum = wf_reduce<WF_SIZE>(sum);
+
+        // First thread of each wavefront writes result into global memory
+        if(lid == 0)
+        {
+            if(beta == static_cast<T>(0))
+            {
+                y[row] = sum;
+            }
+            else
+            {
+                y[row] = fma(beta, y[row], sum);
+            }
+        }
+    }
+}
+
+#endif // PCSRMV_DEVICE_H
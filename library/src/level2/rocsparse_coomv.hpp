@@ -29,6 +29,7 @@
 #include "definitions.h"
 #include "handle.h"
 #include "utility.h"
+#include "capture.h"
 #include "coomv_device.h"
 
 #include <hip/hip_runtime.h>
@@ -51,195 +52,109 @@ coomv_scale_device_pointer(rocsparse_int size, const T* __restrict__ beta, T* __
     coomv_scale_device<T>(size, *beta, data);
 }
 
-template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+template <typename T, typename U, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
 __launch_bounds__(128) __global__
     void coomvn_wf_host_pointer(rocsparse_int nnz,
                                 rocsparse_int loops,
                                 T alpha,
                                 const rocsparse_int* __restrict__ coo_row_ind,
                                 const rocsparse_int* __restrict__ coo_col_ind,
-                                const T* __restrict__ coo_val,
+                                const U* __restrict__ coo_val,
                                 const T* __restrict__ x,
                                 T* __restrict__ y,
                                 rocsparse_int* __restrict__ row_block_red,
                                 T* __restrict__ val_block_red,
                                 rocsparse_index_base idx_base)
 {
-    coomvn_general_wf_reduce<T, BLOCKSIZE, WF_SIZE>(nnz,
-                                                    loops,
-                                                    alpha,
-                                                    coo_row_ind,
-                                                    coo_col_ind,
-                                                    coo_val,
-                                                    x,
-                                                    y,
-                                                    row_block_red,
-                                                    val_block_red,
-                                                    idx_base);
+    coomvn_general_wf_reduce<T, U, BLOCKSIZE, WF_SIZE>(nnz,
+                                                       loops,
+                                                       alpha,
+                                                       coo_row_ind,
+                                                       coo_col_ind,
+                                                       coo_val,
+                                                       x,
+                                                       y,
+                                                       row_block_red,
+                                                       val_block_red,
+                                                       idx_base);
 }
 
-template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+template <typename T, typename U, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
 __launch_bounds__(128) __global__
     void coomvn_wf_device_pointer(rocsparse_int nnz,
                                   rocsparse_int loops,
                                   const T* alpha,
                                   const rocsparse_int* __restrict__ coo_row_ind,
                                   const rocsparse_int* __restrict__ coo_col_ind,
-                                  const T* __restrict__ coo_val,
+                                  const U* __restrict__ coo_val,
                                   const T* __restrict__ x,
                                   T* __restrict__ y,
                                   rocsparse_int* __restrict__ row_block_red,
                                   T* __restrict__ val_block_red,
                                   rocsparse_index_base idx_base)
 {
-    coomvn_general_wf_reduce<T, BLOCKSIZE, WF_SIZE>(nnz,
-                                                    loops,
-                                                    *alpha,
-                                                    coo_row_ind,
-                                                    coo_col_ind,
-                                                    coo_val,
-                                                    x,
-                                                    y,
-                                                    row_block_red,
-                                                    val_block_red,
-                                                    idx_base);
+    coomvn_general_wf_reduce<T, U, BLOCKSIZE, WF_SIZE>(nnz,
+                                                       loops,
+                                                       *alpha,
+                                                       coo_row_ind,
+                                                       coo_col_ind,
+                                                       coo_val,
+                                                       x,
+                                                       y,
+                                                       row_block_red,
+                                                       val_block_red,
+                                                       idx_base);
 }
 
-template <typename T>
-rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
+template <typename T, typename U>
+__global__ void coomvt_kernel_host_pointer(rocsparse_operation trans,
+                                           rocsparse_int nnz,
+                                           T alpha,
+                                           const rocsparse_int* __restrict__ coo_row_ind,
+                                           const rocsparse_int* __restrict__ coo_col_ind,
+                                           const U* __restrict__ coo_val,
+                                           const T* __restrict__ x,
+                                           T* __restrict__ y,
+                                           rocsparse_index_base idx_base)
+{
+    coomvt_device<T, U>(trans, nnz, alpha, coo_row_ind, coo_col_ind, coo_val, x, y, idx_base);
+}
+
+template <typename T, typename U>
+__global__ void coomvt_kernel_device_pointer(rocsparse_operation trans,
+                                             rocsparse_int nnz,
+                                             const T* alpha,
+                                             const rocsparse_int* __restrict__ coo_row_ind,
+                                             const rocsparse_int* __restrict__ coo_col_ind,
+                                             const U* __restrict__ coo_val,
+                                             const T* __restrict__ x,
+                                             T* __restrict__ y,
+                                             rocsparse_index_base idx_base)
+{
+    coomvt_device<T, U>(trans, nnz, *alpha, coo_row_ind, coo_col_ind, coo_val, x, y, idx_base);
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_coomv_dispatch(rocsparse_handle handle,
                                           rocsparse_operation trans,
                                           rocsparse_int m,
                                           rocsparse_int n,
                                           rocsparse_int nnz,
                                           const T* alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T* coo_val,
+                                          const U* coo_val,
                                           const rocsparse_int* coo_row_ind,
                                           const rocsparse_int* coo_col_ind,
                                           const T* x,
                                           const T* beta,
                                           T* y)
 {
-    // Check for valid handle and matrix descriptor
-    if(handle == nullptr)
-    {
-        return rocsparse_status_invalid_handle;
-    }
-    else if(descr == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Logging
-    if(handle->pointer_mode == rocsparse_pointer_mode_host)
-    {
-        log_trace(handle,
-                  replaceX<T>("rocsparse_Xcoomv"),
-                  trans,
-                  m,
-                  n,
-                  nnz,
-                  *alpha,
-                  (const void*&)descr,
-                  (const void*&)coo_val,
-                  (const void*&)coo_row_ind,
-                  (const void*&)coo_col_ind,
-                  (const void*&)x,
-                  *beta,
-                  (const void*&)y);
-
-        log_bench(handle,
-                  "./rocsparse-bench -f coomv -r",
-                  replaceX<T>("X"),
-                  "--mtx <matrix.mtx> ",
-                  "--alpha",
-                  *alpha,
-                  "--beta",
-                  *beta);
-    }
-    else
-    {
-        log_trace(handle,
-                  replaceX<T>("rocsparse_Xcoomv"),
-                  trans,
-                  m,
-                  n,
-                  nnz,
-                  (const void*&)alpha,
-                  (const void*&)descr,
-                  (const void*&)coo_val,
-                  (const void*&)coo_row_ind,
-                  (const void*&)coo_col_ind,
-                  (const void*&)x,
-                  (const void*&)beta,
-                  (const void*&)y);
-    }
-
-    // Check index base
-    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
-    {
-        return rocsparse_status_invalid_value;
-    }
-    // Check matrix type
-    if(descr->type != rocsparse_matrix_type_general)
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
-    }
-
-    // Check sizes
-    if(m < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-    else if(n < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-    else if(nnz < 0)
-    {
-        return rocsparse_status_invalid_size;
-    }
-
-    // Check pointer arguments
-    if(coo_val == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(coo_row_ind == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(coo_col_ind == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(x == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(y == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(alpha == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(beta == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-
-    // Quick return if possible
-    if(m == 0 || n == 0 || nnz == 0)
-    {
-        return rocsparse_status_success;
-    }
-
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Device properties and buffer are initialized on first use
+    RETURN_IF_ROCSPARSE_ERROR(handle->init_buffer());
+
     // Run different coomv kernels
     if(trans == rocsparse_operation_none)
     {
@@ -281,7 +196,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
 
             if(handle->wavefront_size == 32)
             {
-                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, COOMVN_DIM, 32>),
+                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, U, COOMVN_DIM, 32>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -300,7 +215,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
             }
             else if(handle->wavefront_size == 64)
             {
-                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, COOMVN_DIM, 64>),
+                hipLaunchKernelGGL((coomvn_wf_device_pointer<T, U, COOMVN_DIM, 64>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -348,7 +263,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
 
             if(handle->wavefront_size == 32)
             {
-                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, COOMVN_DIM, 32>),
+                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, U, COOMVN_DIM, 32>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -367,7 +282,7 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
             }
             else if(handle->wavefront_size == 64)
             {
-                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, COOMVN_DIM, 64>),
+                hipLaunchKernelGGL((coomvn_wf_host_pointer<T, U, COOMVN_DIM, 64>),
                                    coomvn_blocks,
                                    coomvn_threads,
                                    0,
@@ -402,11 +317,246 @@ rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
 #undef COOMVN_DIM
     }
     else
+    {
+#define COOMVT_DIM 256
+        dim3 coomvt_blocks((nnz - 1) / COOMVT_DIM + 1);
+        dim3 coomvt_threads(COOMVT_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            // Scale y with beta
+            hipLaunchKernelGGL((coomv_scale_device_pointer<T>),
+                               dim3((n - 1) / 1024 + 1),
+                               dim3(1024),
+                               0,
+                               stream,
+                               n,
+                               beta,
+                               y);
+
+            hipLaunchKernelGGL((coomvt_kernel_device_pointer<T, U>),
+                               coomvt_blocks,
+                               coomvt_threads,
+                               0,
+                               stream,
+                               trans,
+                               nnz,
+                               alpha,
+                               coo_row_ind,
+                               coo_col_ind,
+                               coo_val,
+                               x,
+                               y,
+                               descr->base);
+        }
+        else
+        {
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+
+            // If beta == 0.0 we need to set y to 0
+            if(*beta == static_cast<T>(0))
+            {
+                RETURN_IF_HIP_ERROR(hipMemsetAsync(y, 0, sizeof(T) * n, stream));
+            }
+            else if(*beta != static_cast<T>(1))
+            {
+                hipLaunchKernelGGL((coomv_scale_host_pointer<T>),
+                                   dim3((n - 1) / 1024 + 1),
+                                   dim3(1024),
+                                   0,
+                                   stream,
+                                   n,
+                                   *beta,
+                                   y);
+            }
+
+            hipLaunchKernelGGL((coomvt_kernel_host_pointer<T, U>),
+                               coomvt_blocks,
+                               coomvt_threads,
+                               0,
+                               stream,
+                               trans,
+                               nnz,
+                               *alpha,
+                               coo_row_ind,
+                               coo_col_ind,
+                               coo_val,
+                               x,
+                               y,
+                               descr->base);
+        }
+#undef COOMVT_DIM
+    }
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_coomv_template(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int nnz,
+                                          const T* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const U* coo_val,
+                                          const rocsparse_int* coo_row_ind,
+                                          const rocsparse_int* coo_col_ind,
+                                          const T* x,
+                                          const T* beta,
+                                          T* y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<U>("rocsparse_Xcoomv"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)coo_val,
+                  (const void*&)coo_row_ind,
+                  (const void*&)coo_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        std::string mtx = rocsparse_capture_coo(
+            handle, "coomv", m, n, nnz, descr, coo_val, coo_row_ind, coo_col_ind);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f coomv -r",
+                  replaceX<U>("X"),
+                  "--mtx",
+                  mtx,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<U>("rocsparse_Xcoomv"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)coo_val,
+                  (const void*&)coo_row_ind,
+                  (const void*&)coo_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
     {
         // TODO
         return rocsparse_status_not_implemented;
     }
-    return rocsparse_status_success;
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments, coo_val is NULL for pattern only matrices
+    if(coo_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Pattern only matrices do not stream any values
+    size_t val_size = (coo_val != nullptr) ? sizeof(U) : 0;
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcoomv",
+                                    rocsparse_precision_string<U>(),
+                                    m,
+                                    n,
+                                    nnz,
+                                    (val_size + 2 * sizeof(rocsparse_int)) * nnz + sizeof(T) * n +
+                                        2 * sizeof(T) * m);
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Pattern only matrices are processed by kernels that do not load any values
+    if(coo_val == nullptr)
+    {
+        return rocsparse_coomv_dispatch(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha,
+                                        descr,
+                                        static_cast<const rocsparse_pattern_value*>(nullptr),
+                                        coo_row_ind,
+                                        coo_col_ind,
+                                        x,
+                                        beta,
+                                        y);
+    }
+
+    return rocsparse_coomv_dispatch(
+        handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
 }
 
 #endif // ROCSPARSE_COOMV_HPP
@@ -0,0 +1,537 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_COOMV_SEMIRING_HPP
+#define ROCSPARSE_COOMV_SEMIRING_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "capture.h"
+#include "coomv_semiring_device.h"
+
+#include <hip/hip_runtime.h>
+
+template <rocsparse_semiring S, typename T>
+__global__ void coomv_semiring_scale_host_pointer(rocsparse_int size, T beta, T* __restrict__ data)
+{
+    coomv_semiring_scale_device<S, T>(size, beta, data);
+}
+
+template <rocsparse_semiring S, typename T>
+__global__ void coomv_semiring_scale_device_pointer(rocsparse_int size,
+                                                    const T* __restrict__ beta,
+                                                    T* __restrict__ data)
+{
+    if(*beta == rocsparse_semiring_op<S, T>::one())
+    {
+        return;
+    }
+
+    coomv_semiring_scale_device<S, T>(size, *beta, data);
+}
+
+template <rocsparse_semiring S, typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(128) __global__
+    void coomvn_semiring_wf_host_pointer(rocsparse_int nnz,
+                                         rocsparse_int loops,
+                                         T alpha,
+                                         const rocsparse_int* __restrict__ coo_row_ind,
+                                         const rocsparse_int* __restrict__ coo_col_ind,
+                                         const T* __restrict__ coo_val,
+                                         const T* __restrict__ x,
+                                         T* __restrict__ y,
+                                         rocsparse_int* __restrict__ row_block_red,
+                                         T* __restrict__ val_block_red,
+                                         rocsparse_index_base idx_base)
+{
+    coomvn_semiring_wf_reduce<S, T, BLOCKSIZE, WF_SIZE>(nnz,
+                                                        loops,
+                                                        alpha,
+                                                        coo_row_ind,
+                                                        coo_col_ind,
+                                                        coo_val,
+                                                        x,
+                                                        y,
+                                                        row_block_red,
+                                                        val_block_red,
+                                                        idx_base);
+}
+
+template <rocsparse_semiring S, typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(128) __global__
+    void coomvn_semiring_wf_device_pointer(rocsparse_int nnz,
+                                           rocsparse_int loops,
+                                           const T* alpha,
+                                           const rocsparse_int* __restrict__ coo_row_ind,
+                                           const rocsparse_int* __restrict__ coo_col_ind,
+                                           const T* __restrict__ coo_val,
+                                           const T* __restrict__ x,
+                                           T* __restrict__ y,
+                                           rocsparse_int* __restrict__ row_block_red,
+                                           T* __restrict__ val_block_red,
+                                           rocsparse_index_base idx_base)
+{
+    coomvn_semiring_wf_reduce<S, T, BLOCKSIZE, WF_SIZE>(nnz,
+                                                        loops,
+                                                        *alpha,
+                                                        coo_row_ind,
+                                                        coo_col_ind,
+                                                        coo_val,
+                                                        x,
+                                                        y,
+                                                        row_block_red,
+                                                        val_block_red,
+                                                        idx_base);
+}
+
+template <rocsparse_semiring S, typename T>
+__global__ void coomvt_semiring_kernel_host_pointer(rocsparse_int nnz,
+                                                    T alpha,
+                                                    const rocsparse_int* __restrict__ coo_row_ind,
+                                                    const rocsparse_int* __restrict__ coo_col_ind,
+                                                    const T* __restrict__ coo_val,
+                                                    const T* __restrict__ x,
+                                                    T* __restrict__ y,
+                                                    rocsparse_index_base idx_base)
+{
+    coomvt_semiring_device<S, T>(nnz, alpha, coo_row_ind, coo_col_ind, coo_val, x, y, idx_base);
+}
+
+template <rocsparse_semiring S, typename T>
+__global__ void
+    coomvt_semiring_kernel_device_pointer(rocsparse_int nnz,
+                                          const T* alpha,
+                                          const rocsparse_int* __restrict__ coo_row_ind,
+                                          const rocsparse_int* __restrict__ coo_col_ind,
+                                          const T* __restrict__ coo_val,
+                                          const T* __restrict__ x,
+                                          T* __restrict__ y,
+                                          rocsparse_index_base idx_base)
+{
+    coomvt_semiring_device<S, T>(nnz, *alpha, coo_row_ind, coo_col_ind, coo_val, x, y, idx_base);
+}
+
+template <rocsparse_semiring S, typename T>
+rocsparse_status rocsparse_coomv_semiring_dispatch(rocsparse_handle handle,
+                                                   rocsparse_operation trans,
+                                                   rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   rocsparse_int nnz,
+                                                   const T* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T* coo_val,
+                                                   const rocsparse_int* coo_row_ind,
+                                                   const rocsparse_int* coo_col_ind,
+                                                   const T* x,
+                                                   const T* beta,
+                                                   T* y)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Length of y
+    rocsparse_int ysize = (trans == rocsparse_operation_none) ? m : n;
+
+    // Scale y with beta
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((coomv_semiring_scale_device_pointer<S, T>),
+                           dim3((ysize - 1) / 1024 + 1),
+                           dim3(1024),
+                           0,
+                           stream,
+                           ysize,
+                           beta,
+                           y);
+    }
+    else
+    {
+        if(*alpha == op::zero() && *beta == op::one())
+        {
+            return rocsparse_status_success;
+        }
+
+        if(*beta != op::one())
+        {
+            hipLaunchKernelGGL((coomv_semiring_scale_host_pointer<S, T>),
+                               dim3((ysize - 1) / 1024 + 1),
+                               dim3(1024),
+                               0,
+                               stream,
+                               ysize,
+                               *beta,
+                               y);
+        }
+    }
+
+    // Run different coomv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define COOMVN_DIM 128
+        rocsparse_int maxthreads = handle->properties.maxThreadsPerBlock;
+        rocsparse_int nprocs     = handle->properties.multiProcessorCount;
+        rocsparse_int maxblocks  = (nprocs * maxthreads - 1) / COOMVN_DIM + 1;
+        rocsparse_int minblocks  = (nnz - 1) / COOMVN_DIM + 1;
+
+        rocsparse_int nblocks = maxblocks < minblocks ? maxblocks : minblocks;
+        rocsparse_int nwfs    = nblocks * (COOMVN_DIM / handle->wavefront_size);
+        rocsparse_int nloops  = (nnz / handle->wavefront_size + 1) / nwfs + 1;
+
+        dim3 coomvn_blocks(nblocks);
+        dim3 coomvn_threads(COOMVN_DIM);
+
+        // Buffer
+        char* ptr = reinterpret_cast<char*>(handle->buffer);
+        ptr += 256;
+
+        // row block reduction buffer
+        rocsparse_int* row_block_red = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += ((sizeof(rocsparse_int) * nwfs - 1) / 256 + 1) * 256;
+
+        // val block reduction buffer
+        T* val_block_red = reinterpret_cast<T*>(ptr);
+
+        if(handle->wavefront_size != 32 && handle->wavefront_size != 64)
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            if(handle->wavefront_size == 32)
+            {
+                hipLaunchKernelGGL((coomvn_semiring_wf_device_pointer<S, T, COOMVN_DIM, 32>),
+                                   coomvn_blocks,
+                                   coomvn_threads,
+                                   0,
+                                   stream,
+                                   nnz,
+                                   nloops,
+                                   alpha,
+                                   coo_row_ind,
+                                   coo_col_ind,
+                                   coo_val,
+                                   x,
+                                   y,
+                                   row_block_red,
+                                   val_block_red,
+                                   descr->base);
+            }
+            else
+            {
+                hipLaunchKernelGGL((coomvn_semiring_wf_device_pointer<S, T, COOMVN_DIM, 64>),
+                                   coomvn_blocks,
+                                   coomvn_threads,
+                                   0,
+                                   stream,
+                                   nnz,
+                                   nloops,
+                                   alpha,
+                                   coo_row_ind,
+                                   coo_col_ind,
+                                   coo_val,
+                                   x,
+                                   y,
+                                   row_block_red,
+                                   val_block_red,
+                                   descr->base);
+            }
+        }
+        else
+        {
+            if(handle->wavefront_size == 32)
+            {
+                hipLaunchKernelGGL((coomvn_semiring_wf_host_pointer<S, T, COOMVN_DIM, 32>),
+                                   coomvn_blocks,
+                                   coomvn_threads,
+                                   0,
+                                   stream,
+                                   nnz,
+                                   nloops,
+                                   *alpha,
+                                   coo_row_ind,
+                                   coo_col_ind,
+                                   coo_val,
+                                   x,
+                                   y,
+                                   row_block_red,
+                                   val_block_red,
+                                   descr->base);
+            }
+            else
+            {
+                hipLaunchKernelGGL((coomvn_semiring_wf_host_pointer<S, T, COOMVN_DIM, 64>),
+                                   coomvn_blocks,
+                                   coomvn_threads,
+                                   0,
+                                   stream,
+                                   nnz,
+                                   nloops,
+                                   *alpha,
+                                   coo_row_ind,
+                                   coo_col_ind,
+                                   coo_val,
+                                   x,
+                                   y,
+                                   row_block_red,
+                                   val_block_red,
+                                   descr->base);
+            }
+        }
+
+        hipLaunchKernelGGL((coomvn_semiring_block_reduce<S, T, COOMVN_DIM>),
+                           dim3(1),
+                           coomvn_threads,
+                           0,
+                           stream,
+                           nwfs,
+                           row_block_red,
+                           val_block_red,
+                           y);
+#undef COOMVN_DIM
+    }
+    else
+    {
+#define COOMVT_DIM 256
+        dim3 coomvt_blocks((nnz - 1) / COOMVT_DIM + 1);
+        dim3 coomvt_threads(COOMVT_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((coomvt_semiring_kernel_device_pointer<S, T>),
+                               coomvt_blocks,
+                               coomvt_threads,
+                               0,
+                               stream,
+                               nnz,
+                               alpha,
+                               coo_row_ind,
+                               coo_col_ind,
+                               coo_val,
+                               x,
+                               y,
+                               descr->base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((coomvt_semiring_kernel_host_pointer<S, T>),
+                               coomvt_blocks,
+                               coomvt_threads,
+                               0,
+                               stream,
+                               nnz,
+                               *alpha,
+                               coo_row_ind,
+                               coo_col_ind,
+                               coo_val,
+                               x,
+                               y,
+                               descr->base);
+        }
+#undef COOMVT_DIM
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_coomv_semiring_template(rocsparse_handle handle,
+                                                   rocsparse_operation trans,
+                                                   rocsparse_semiring semiring,
+                                                   rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   rocsparse_int nnz,
+                                                   const T* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T* coo_val,
+                                                   const rocsparse_int* coo_row_ind,
+                                                   const rocsparse_int* coo_col_ind,
+                                                   const T* x,
+                                                   const T* beta,
+                                                   T* y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcoomv_semiring"),
+                  trans,
+                  semiring,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)coo_val,
+                  (const void*&)coo_row_ind,
+                  (const void*&)coo_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        std::string mtx = rocsparse_capture_coo(
+            handle, "coomv_semiring", m, n, nnz, descr, coo_val, coo_row_ind, coo_col_ind);
+
+        std::string semiring_name = rocsparse_semiring_string(semiring);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f coomv_semiring -r",
+                  replaceX<T>("X"),
+                  "--mtx",
+                  mtx,
+                  "--semiring",
+                  semiring_name,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcoomv_semiring"),
+                  trans,
+                  semiring,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)coo_val,
+                  (const void*&)coo_row_ind,
+                  (const void*&)coo_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(semiring < rocsparse_semiring_plus_times || semiring > rocsparse_semiring_or_and)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments, coo_val can be NULL for pattern only matrices
+    if(coo_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coo_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcoomv_semiring",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    n,
+                                    nnz,
+                                    (coo_val == nullptr ? 0 : sizeof(T) * nnz)
+                                        + 2 * sizeof(rocsparse_int) * nnz + sizeof(T) * n
+                                        + 2 * sizeof(T) * m);
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Device properties and buffer are initialized on first use
+    RETURN_IF_ROCSPARSE_ERROR(handle->init_buffer());
+
+    switch(semiring)
+    {
+    case rocsparse_semiring_plus_times:
+        return rocsparse_coomv_semiring_dispatch<rocsparse_semiring_plus_times>(
+            handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+    case rocsparse_semiring_min_plus:
+        return rocsparse_coomv_semiring_dispatch<rocsparse_semiring_min_plus>(
+            handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+    case rocsparse_semiring_max_times:
+        return rocsparse_coomv_semiring_dispatch<rocsparse_semiring_max_times>(
+            handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+    case rocsparse_semiring_or_and:
+        return rocsparse_coomv_semiring_dispatch<rocsparse_semiring_or_and>(
+            handle, trans, m, n, nnz, alpha, descr, coo_val, coo_row_ind, coo_col_ind, x, beta, y);
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+#endif // ROCSPARSE_COOMV_SEMIRING_HPP
@@ -0,0 +1,336 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "rocsparse.h"
+#include "rocsparse_cscmspv.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_cscmspv_analysis(rocsparse_handle handle,
+                                                       rocsparse_int m,
+                                                       rocsparse_int n,
+                                                       rocsparse_int nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_int* csc_col_ptr,
+                                                       const rocsparse_int* csc_row_ind,
+                                                       rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_cscmspv_analysis",
+              m,
+              n,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csc_col_ptr,
+              (const void*&)csc_row_ind,
+              (const void*&)info);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csc_col_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Clear previous analysis data
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_cscmspv_info(info->cscmspv_info));
+    info->cscmspv_info = nullptr;
+
+    // Create info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_cscmspv_info(&info->cscmspv_info));
+
+    rocsparse_cscmspv_info cscmspv = info->cscmspv_info;
+
+    cscmspv->m    = m;
+    cscmspv->n    = n;
+    cscmspv->nnz  = nnz;
+    cscmspv->base = descr->base;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Row wise pattern, map, accumulator and dense copy of x share a single
+    // allocation. The accumulator and x are sized for double precision, such that
+    // the analysis can be used for both precisions.
+    size_t ptr_size = sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+    size_t col_size = sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+    size_t acc_size = sizeof(double) * ((m - 1) / 256 + 1) * 256;
+    size_t row_size = sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+    size_t cnt_size = 256;
+    size_t x_size   = sizeof(double) * ((n - 1) / 256 + 1) * 256;
+    size_t xf_size  = sizeof(rocsparse_int) * ((n - 1) / 256 + 1) * 256;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_malloc_memory(
+        handle,
+        (void**)&cscmspv->csr_row_ptr,
+        ptr_size + 2 * col_size + acc_size + 2 * row_size + cnt_size + x_size + xf_size));
+
+    cscmspv->allocator = handle->allocator;
+
+    char* ptr = reinterpret_cast<char*>(cscmspv->csr_row_ptr);
+    ptr += ptr_size;
+
+    cscmspv->csr_col_ind = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += col_size;
+
+    cscmspv->map = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += col_size;
+
+    cscmspv->acc = reinterpret_cast<void*>(ptr);
+    ptr += acc_size;
+
+    cscmspv->flag = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += row_size;
+
+    cscmspv->list = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += row_size;
+
+    cscmspv->count = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += cnt_size;
+
+    cscmspv->x = reinterpret_cast<void*>(ptr);
+    ptr += x_size;
+
+    cscmspv->xflag = reinterpret_cast<rocsparse_int*>(ptr);
+
+    // Flags are restored after each call and only initialized once
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(cscmspv->flag, 0, row_size, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(cscmspv->xflag, 0, xf_size, stream));
+
+    // Temporary buffers
+    rocsparse_workspace_scope workspace_scope(handle);
+
+    rocsparse_int* tmp_keys1;
+    rocsparse_int* tmp_keys2;
+    rocsparse_int* tmp_perm;
+    rocsparse_int* tmp_coo_col;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(handle, (void**)&tmp_keys1, col_size));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(handle, (void**)&tmp_keys2, col_size));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(handle, (void**)&tmp_perm, col_size));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(handle, (void**)&tmp_coo_col, col_size));
+
+    // Stable sort of the entries by rows, the column major order of the CSC matrix
+    // yields sorted columns within each row
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        tmp_keys1, csc_row_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToDevice, stream));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, nnz, tmp_perm));
+
+    hipcub::DoubleBuffer<rocsparse_int> keys(tmp_keys1, tmp_keys2);
+    hipcub::DoubleBuffer<rocsparse_int> vals(tmp_perm, cscmspv->map);
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(m);
+
+    size_t size = 0;
+    void* tmp_hipcub;
+
+    RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortPairs(
+        nullptr, size, keys, vals, nnz, startbit, endbit, stream));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(handle, &tmp_hipcub, size));
+    RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortPairs(
+        tmp_hipcub, size, keys, vals, nnz, startbit, endbit, stream));
+
+    if(vals.Current() != cscmspv->map)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(cscmspv->map,
+                                           vals.Current(),
+                                           sizeof(rocsparse_int) * nnz,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+
+    // Row pointers
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_coo2csr(handle, keys.Current(), nnz, m, cscmspv->csr_row_ptr, descr->base));
+
+    // Column indices
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr2coo(handle, csc_col_ptr, nnz, n, tmp_coo_col, descr->base));
+
+#define CSCMSPV_DIM 512
+    hipLaunchKernelGGL((cscmspv_analysis_gather_kernel),
+                       dim3((nnz - 1) / CSCMSPV_DIM + 1),
+                       dim3(CSCMSPV_DIM),
+                       0,
+                       stream,
+                       nnz,
+                       cscmspv->map,
+                       tmp_coo_col,
+                       cscmspv->csr_col_ind);
+#undef CSCMSPV_DIM
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_cscmspv_clear(rocsparse_handle handle,
+                                                    rocsparse_mat_info info)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_cscmspv_clear", (const void*&)info);
+
+    // Destroy cscmspv info struct
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_cscmspv_info(info->cscmspv_info));
+    info->cscmspv_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_scscmspv(rocsparse_handle handle,
+                                               rocsparse_semiring semiring,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               rocsparse_int nnz,
+                                               const float* alpha,
+                                               const rocsparse_mat_descr descr,
+                                               const float* csc_val,
+                                               const rocsparse_int* csc_col_ptr,
+                                               const rocsparse_int* csc_row_ind,
+                                               rocsparse_mat_info info,
+                                               rocsparse_int x_nnz,
+                                               const float* x_val,
+                                               const rocsparse_int* x_ind,
+                                               rocsparse_int* y_nnz,
+                                               float* y_val,
+                                               rocsparse_int* y_ind)
+{
+    return rocsparse_cscmspv_template<float>(handle,
+                                             semiring,
+                                             m,
+                                             n,
+                                             nnz,
+                                             alpha,
+                                             descr,
+                                             csc_val,
+                                             csc_col_ptr,
+                                             csc_row_ind,
+                                             info,
+                                             x_nnz,
+                                             x_val,
+                                             x_ind,
+                                             y_nnz,
+                                             y_val,
+                                             y_ind);
+}
+
+extern "C" rocsparse_status rocsparse_dcscmspv(rocsparse_handle handle,
+                                               rocsparse_semiring semiring,
+                                               rocsparse_int m,
+                                               rocsparse_int n,
+                                               rocsparse_int nnz,
+                                               const double* alpha,
+                                               const rocsparse_mat_descr descr,
+                                               const double* csc_val,
+                                               const rocsparse_int* csc_col_ptr,
+                                               const rocsparse_int* csc_row_ind,
+                                               rocsparse_mat_info info,
+                                               rocsparse_int x_nnz,
+                                               const double* x_val,
+                                               const rocsparse_int* x_ind,
+                                               rocsparse_int* y_nnz,
+                                               double* y_val,
+                                               rocsparse_int* y_ind)
+{
+    return rocsparse_cscmspv_template<double>(handle,
+                                              semiring,
+                                              m,
+                                              n,
+                                              nnz,
+                                              alpha,
+                                              descr,
+                                              csc_val,
+                                              csc_col_ptr,
+                                              csc_row_ind,
+                                              info,
+                                              x_nnz,
+                                              x_val,
+                                              x_ind,
+                                              y_nnz,
+                                              y_val,
+                                              y_ind);
+}
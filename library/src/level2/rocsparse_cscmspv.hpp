@@ -0,0 +1,655 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSCMSPV_HPP
+#define ROCSPARSE_CSCMSPV_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "capture.h"
+#include "cscmspv_device.h"
+
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+
+__global__ void cscmspv_analysis_gather_kernel(rocsparse_int nnz,
+                                               const rocsparse_int* __restrict__ map,
+                                               const rocsparse_int* __restrict__ coo_col_ind,
+                                               rocsparse_int* __restrict__ csr_col_ind)
+{
+    cscmspv_analysis_gather_device(nnz, map, coo_col_ind, csr_col_ind);
+}
+
+template <typename T>
+__global__ void cscmspv_fill_kernel(rocsparse_int size, T val, T* __restrict__ data)
+{
+    cscmspv_fill_device(size, val, data);
+}
+
+template <rocsparse_semiring S, typename T>
+__global__ void cscmspv_scatter_kernel(rocsparse_int x_nnz,
+                                       const T* __restrict__ x_val,
+                                       const rocsparse_int* __restrict__ x_ind,
+                                       T* __restrict__ x,
+                                       rocsparse_int* __restrict__ xflag,
+                                       rocsparse_index_base idx_base)
+{
+    cscmspv_scatter_device<S>(x_nnz, x_val, x_ind, x, xflag, idx_base);
+}
+
+__global__ void cscmspv_unmark_kernel(rocsparse_int x_nnz,
+                                      const rocsparse_int* __restrict__ x_ind,
+                                      rocsparse_int* __restrict__ xflag,
+                                      rocsparse_index_base idx_base)
+{
+    cscmspv_unmark_device(x_nnz, x_ind, xflag, idx_base);
+}
+
+template <rocsparse_semiring S, typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void cscmspv_push_kernel(rocsparse_int x_nnz,
+                             const T* __restrict__ x_val,
+                             const rocsparse_int* __restrict__ x_ind,
+                             const rocsparse_int* __restrict__ csc_col_ptr,
+                             const rocsparse_int* __restrict__ csc_row_ind,
+                             const T* __restrict__ csc_val,
+                             T* __restrict__ acc,
+                             rocsparse_int* __restrict__ flag,
+                             rocsparse_int* __restrict__ list,
+                             rocsparse_int* __restrict__ count,
+                             rocsparse_index_base idx_base)
+{
+    cscmspv_push_device<S, T, BLOCKSIZE, WF_SIZE>(x_nnz,
+                                                  x_val,
+                                                  x_ind,
+                                                  csc_col_ptr,
+                                                  csc_row_ind,
+                                                  csc_val,
+                                                  acc,
+                                                  flag,
+                                                  list,
+                                                  count,
+                                                  idx_base);
+}
+
+template <rocsparse_semiring S, typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void cscmspv_pull_kernel(rocsparse_int m,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             const rocsparse_int* __restrict__ map,
+                             const T* __restrict__ csc_val,
+                             const T* __restrict__ x,
+                             const rocsparse_int* __restrict__ xflag,
+                             T* __restrict__ acc,
+                             rocsparse_int* __restrict__ list,
+                             rocsparse_int* __restrict__ count,
+                             rocsparse_index_base idx_base)
+{
+    cscmspv_pull_device<S, T, BLOCKSIZE, WF_SIZE>(
+        m, csr_row_ptr, csr_col_ind, map, csc_val, x, xflag, acc, list, count, idx_base);
+}
+
+template <rocsparse_semiring S, typename T>
+__global__ void cscmspv_gather_kernel_host_pointer(rocsparse_int y_nnz,
+                                                   T alpha,
+                                                   T* __restrict__ acc,
+                                                   rocsparse_int* __restrict__ flag,
+                                                   T* __restrict__ y_val,
+                                                   rocsparse_int* __restrict__ y_ind,
+                                                   rocsparse_index_base idx_base)
+{
+    cscmspv_gather_device<S>(y_nnz, alpha, acc, flag, y_val, y_ind, idx_base);
+}
+
+template <rocsparse_semiring S, typename T>
+__global__ void cscmspv_gather_kernel_device_pointer(rocsparse_int y_nnz,
+                                                     const T* __restrict__ alpha,
+                                                     T* __restrict__ acc,
+                                                     rocsparse_int* __restrict__ flag,
+                                                     T* __restrict__ y_val,
+                                                     rocsparse_int* __restrict__ y_ind,
+                                                     rocsparse_index_base idx_base)
+{
+    cscmspv_gather_device<S>(y_nnz, *alpha, acc, flag, y_val, y_ind, idx_base);
+}
+
+#define CSCMSPV_DIM 512
+// Push scatters the columns of x_ind, pull reduces all rows. Either way, one
+// subgroup of WF_SIZE threads processes one column or row, respectively.
+template <rocsparse_semiring S, typename T, rocsparse_int WF_SIZE>
+static void rocsparse_cscmspv_launch(rocsparse_handle handle,
+                                     bool pull,
+                                     const rocsparse_mat_descr descr,
+                                     const T* csc_val,
+                                     const rocsparse_int* csc_col_ptr,
+                                     const rocsparse_int* csc_row_ind,
+                                     rocsparse_cscmspv_info cscmspv,
+                                     rocsparse_int x_nnz,
+                                     const T* x_val,
+                                     const rocsparse_int* x_ind)
+{
+    rocsparse_int m = cscmspv->m;
+
+    T* acc = reinterpret_cast<T*>(cscmspv->acc);
+    T* x   = reinterpret_cast<T*>(cscmspv->x);
+
+    dim3 cscmspv_threads(CSCMSPV_DIM);
+
+    if(pull)
+    {
+        hipLaunchKernelGGL((cscmspv_scatter_kernel<S, T>),
+                           dim3((x_nnz - 1) / CSCMSPV_DIM + 1),
+                           cscmspv_threads,
+                           0,
+                           handle->stream,
+                           x_nnz,
+                           x_val,
+                           x_ind,
+                           x,
+                           cscmspv->xflag,
+                           descr->base);
+
+        hipLaunchKernelGGL((cscmspv_pull_kernel<S, T, CSCMSPV_DIM, WF_SIZE>),
+                           dim3((m - 1) / (CSCMSPV_DIM / WF_SIZE) + 1),
+                           cscmspv_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           cscmspv->csr_row_ptr,
+                           cscmspv->csr_col_ind,
+                           cscmspv->map,
+                           csc_val,
+                           x,
+                           cscmspv->xflag,
+                           acc,
+                           cscmspv->list,
+                           cscmspv->count,
+                           descr->base);
+
+        hipLaunchKernelGGL((cscmspv_unmark_kernel),
+                           dim3((x_nnz - 1) / CSCMSPV_DIM + 1),
+                           cscmspv_threads,
+                           0,
+                           handle->stream,
+                           x_nnz,
+                           x_ind,
+                           cscmspv->xflag,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((cscmspv_push_kernel<S, T, CSCMSPV_DIM, WF_SIZE>),
+                           dim3((x_nnz - 1) / (CSCMSPV_DIM / WF_SIZE) + 1),
+                           cscmspv_threads,
+                           0,
+                           handle->stream,
+                           x_nnz,
+                           x_val,
+                           x_ind,
+                           csc_col_ptr,
+                           csc_row_ind,
+                           csc_val,
+                           acc,
+                           cscmspv->flag,
+                           cscmspv->list,
+                           cscmspv->count,
+                           descr->base);
+    }
+}
+
+template <rocsparse_semiring S, typename T>
+rocsparse_status rocsparse_cscmspv_dispatch(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int n,
+                                            rocsparse_int nnz,
+                                            const T* alpha,
+                                            const rocsparse_mat_descr descr,
+                                            const T* csc_val,
+                                            const rocsparse_int* csc_col_ptr,
+                                            const rocsparse_int* csc_row_ind,
+                                            rocsparse_mat_info info,
+                                            rocsparse_int x_nnz,
+                                            const T* x_val,
+                                            const rocsparse_int* x_ind,
+                                            rocsparse_int* y_nnz,
+                                            T* y_val,
+                                            rocsparse_int* y_ind)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_cscmspv_info cscmspv = info->cscmspv_info;
+
+    // The accumulator is restored to the additive identity after each call, and
+    // only needs to be filled if the semiring or the precision changes
+    int acc_state = 2 * static_cast<int>(S) + (sizeof(T) == sizeof(double) ? 1 : 0);
+
+    if(cscmspv->acc_state != acc_state)
+    {
+        hipLaunchKernelGGL((cscmspv_fill_kernel<T>),
+                           dim3((m - 1) / CSCMSPV_DIM + 1),
+                           dim3(CSCMSPV_DIM),
+                           0,
+                           stream,
+                           m,
+                           op::zero(),
+                           reinterpret_cast<T*>(cscmspv->acc));
+
+        cscmspv->acc_state = acc_state;
+    }
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(cscmspv->count, 0, sizeof(rocsparse_int), stream));
+
+    // Dense frontiers pull, sparse frontiers push. The subgroup size is chosen from
+    // the average length of the rows or columns, respectively.
+    bool pull = static_cast<double>(x_nnz) >= info->cscmspv_threshold * n;
+
+    rocsparse_int nnz_per_item = pull ? nnz / m : nnz / n;
+
+    if(nnz_per_item < 4)
+    {
+        rocsparse_cscmspv_launch<S, T, 2>(
+            handle, pull, descr, csc_val, csc_col_ptr, csc_row_ind, cscmspv, x_nnz, x_val, x_ind);
+    }
+    else if(nnz_per_item < 8)
+    {
+        rocsparse_cscmspv_launch<S, T, 4>(
+            handle, pull, descr, csc_val, csc_col_ptr, csc_row_ind, cscmspv, x_nnz, x_val, x_ind);
+    }
+    else if(nnz_per_item < 16)
+    {
+        rocsparse_cscmspv_launch<S, T, 8>(
+            handle, pull, descr, csc_val, csc_col_ptr, csc_row_ind, cscmspv, x_nnz, x_val, x_ind);
+    }
+    else if(nnz_per_item < 32)
+    {
+        rocsparse_cscmspv_launch<S, T, 16>(
+            handle, pull, descr, csc_val, csc_col_ptr, csc_row_ind, cscmspv, x_nnz, x_val, x_ind);
+    }
+    else if(nnz_per_item < 64 || handle->wavefront_size == 32)
+    {
+        rocsparse_cscmspv_launch<S, T, 32>(
+            handle, pull, descr, csc_val, csc_col_ptr, csc_row_ind, cscmspv, x_nnz, x_val, x_ind);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        rocsparse_cscmspv_launch<S, T, 64>(
+            handle, pull, descr, csc_val, csc_col_ptr, csc_row_ind, cscmspv, x_nnz, x_val, x_ind);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    // Number of entries of the result is required on the host to sort them
+    rocsparse_int nnz_y;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &nnz_y, cscmspv->count, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            y_nnz, cscmspv->count, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        *y_nnz = nnz_y;
+    }
+
+    if(nnz_y == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Sort the rows of the result into y_ind
+    rocsparse_workspace_scope workspace_scope(handle);
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(m);
+
+    size_t size = 0;
+    void* tmp_hipcub;
+
+    RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortKeys(
+        nullptr, size, cscmspv->list, y_ind, nnz_y, startbit, endbit, stream));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(handle, &tmp_hipcub, size));
+    RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortKeys(
+        tmp_hipcub, size, cscmspv->list, y_ind, nnz_y, startbit, endbit, stream));
+
+    // Copy the result and restore the accumulator
+    dim3 gather_blocks((nnz_y - 1) / CSCMSPV_DIM + 1);
+    dim3 gather_threads(CSCMSPV_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((cscmspv_gather_kernel_device_pointer<S, T>),
+                           gather_blocks,
+                           gather_threads,
+                           0,
+                           stream,
+                           nnz_y,
+                           alpha,
+                           reinterpret_cast<T*>(cscmspv->acc),
+                           cscmspv->flag,
+                           y_val,
+                           y_ind,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((cscmspv_gather_kernel_host_pointer<S, T>),
+                           gather_blocks,
+                           gather_threads,
+                           0,
+                           stream,
+                           nnz_y,
+                           *alpha,
+                           reinterpret_cast<T*>(cscmspv->acc),
+                           cscmspv->flag,
+                           y_val,
+                           y_ind,
+                           descr->base);
+    }
+
+    return rocsparse_status_success;
+}
+#undef CSCMSPV_DIM
+
+template <typename T>
+rocsparse_status rocsparse_cscmspv_template(rocsparse_handle handle,
+                                            rocsparse_semiring semiring,
+                                            rocsparse_int m,
+                                            rocsparse_int n,
+                                            rocsparse_int nnz,
+                                            const T* alpha,
+                                            const rocsparse_mat_descr descr,
+                                            const T* csc_val,
+                                            const rocsparse_int* csc_col_ptr,
+                                            const rocsparse_int* csc_row_ind,
+                                            rocsparse_mat_info info,
+                                            rocsparse_int x_nnz,
+                                            const T* x_val,
+                                            const rocsparse_int* x_ind,
+                                            rocsparse_int* y_nnz,
+                                            T* y_val,
+                                            rocsparse_int* y_ind)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcscmspv"),
+                  semiring,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csc_val,
+                  (const void*&)csc_col_ptr,
+                  (const void*&)csc_row_ind,
+                  (const void*&)info,
+                  x_nnz,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  (const void*&)y_nnz,
+                  (const void*&)y_val,
+                  (const void*&)y_ind);
+
+        std::string mtx = rocsparse_capture_csc(
+            handle, "cscmspv", m, n, nnz, descr, csc_val, csc_col_ptr, csc_row_ind);
+
+        std::string semiring_name = rocsparse_semiring_string(semiring);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f cscmspv -r",
+                  replaceX<T>("X"),
+                  "--mtx",
+                  mtx,
+                  "--semiring",
+                  semiring_name,
+                  "--alpha",
+                  *alpha);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcscmspv"),
+                  semiring,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csc_val,
+                  (const void*&)csc_col_ptr,
+                  (const void*&)csc_row_ind,
+                  (const void*&)info,
+                  x_nnz,
+                  (const void*&)x_val,
+                  (const void*&)x_ind,
+                  (const void*&)y_nnz,
+                  (const void*&)y_val,
+                  (const void*&)y_ind);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(semiring < rocsparse_semiring_plus_times || semiring > rocsparse_semiring_or_and)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(x_nnz < 0 || x_nnz > n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments, csc_val and x_val can be NULL for pattern only
+    // operands, y_val if only the indices of the result are required
+    if(csc_col_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csc_row_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_nnz == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcscmspv",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    n,
+                                    nnz,
+                                    (sizeof(T) + sizeof(rocsparse_int)) * (x_nnz + m));
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0 || x_nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(y_nnz, 0, sizeof(rocsparse_int), handle->stream));
+        }
+        else
+        {
+            *y_nnz = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check if info matches current matrix
+    rocsparse_cscmspv_info cscmspv = info->cscmspv_info;
+
+    if(cscmspv == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(cscmspv->m != m || cscmspv->n != n || cscmspv->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(cscmspv->base != descr->base)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Device properties are initialized on first use
+    RETURN_IF_ROCSPARSE_ERROR(handle->init_buffer());
+
+    switch(semiring)
+    {
+    case rocsparse_semiring_plus_times:
+        return rocsparse_cscmspv_dispatch<rocsparse_semiring_plus_times>(handle,
+                                                                         m,
+                                                                         n,
+                                                                         nnz,
+                                                                         alpha,
+                                                                         descr,
+                                                                         csc_val,
+                                                                         csc_col_ptr,
+                                                                         csc_row_ind,
+                                                                         info,
+                                                                         x_nnz,
+                                                                         x_val,
+                                                                         x_ind,
+                                                                         y_nnz,
+                                                                         y_val,
+                                                                         y_ind);
+    case rocsparse_semiring_min_plus:
+        return rocsparse_cscmspv_dispatch<rocsparse_semiring_min_plus>(handle,
+                                                                       m,
+                                                                       n,
+                                                                       nnz,
+                                                                       alpha,
+                                                                       descr,
+                                                                       csc_val,
+                                                                       csc_col_ptr,
+                                                                       csc_row_ind,
+                                                                       info,
+                                                                       x_nnz,
+                                                                       x_val,
+                                                                       x_ind,
+                                                                       y_nnz,
+                                                                       y_val,
+                                                                       y_ind);
+    case rocsparse_semiring_max_times:
+        return rocsparse_cscmspv_dispatch<rocsparse_semiring_max_times>(handle,
+                                                                        m,
+                                                                        n,
+                                                                        nnz,
+                                                                        alpha,
+                                                                        descr,
+                                                                        csc_val,
+                                                                        csc_col_ptr,
+                                                                        csc_row_ind,
+                                                                        info,
+                                                                        x_nnz,
+                                                                        x_val,
+                                                                        x_ind,
+                                                                        y_nnz,
+                                                                        y_val,
+                                                                        y_ind);
+    case rocsparse_semiring_or_and:
+        return rocsparse_cscmspv_dispatch<rocsparse_semiring_or_and>(handle,
+                                                                     m,
+                                                                     n,
+                                                                     nnz,
+                                                                     alpha,
+                                                                     descr,
+                                                                     csc_val,
+                                                                     csc_col_ptr,
+                                                                     csc_row_ind,
+                                                                     info,
+                                                                     x_nnz,
+                                                                     x_val,
+                                                                     x_ind,
+                                                                     y_nnz,
+                                                                     y_val,
+                                                                     y_ind);
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+#endif // ROCSPARSE_CSCMSPV_HPP
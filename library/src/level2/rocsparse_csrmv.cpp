@@ -61,6 +61,36 @@ extern "C" rocsparse_status rocsparse_dcsrmv_analysis(rocsparse_handle handle,
         handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
 }
 
+extern "C" rocsparse_status rocsparse_hcsrmv_analysis(rocsparse_handle handle,
+                                                      rocsparse_operation trans,
+                                                      rocsparse_int m,
+                                                      rocsparse_int n,
+                                                      rocsparse_int nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_half* csr_val,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      rocsparse_mat_info info)
+{
+    return rocsparse_csrmv_analysis_template<rocsparse_half>(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
+extern "C" rocsparse_status rocsparse_bfcsrmv_analysis(rocsparse_handle handle,
+                                                       rocsparse_operation trans,
+                                                       rocsparse_int m,
+                                                       rocsparse_int n,
+                                                       rocsparse_int nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_bfloat16* csr_val,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       rocsparse_mat_info info)
+{
+    return rocsparse_csrmv_analysis_template<rocsparse_bfloat16>(
+        handle, trans, m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+}
+
 extern "C" rocsparse_status rocsparse_csrmv_clear(rocsparse_handle handle, rocsparse_mat_info info)
 {
     // Check for valid handle and matrix descriptor
@@ -144,3 +174,65 @@ extern "C" rocsparse_status rocsparse_dcsrmv(rocsparse_handle handle,
                                             beta,
                                             y);
 }
+
+extern "C" rocsparse_status rocsparse_hcsrmv(rocsparse_handle handle,
+                                             rocsparse_operation trans,
+                                             rocsparse_int m,
+                                             rocsparse_int n,
+                                             rocsparse_int nnz,
+                                             const float* alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_half* csr_val,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_mat_info info,
+                                             const float* x,
+                                             const float* beta,
+                                             float* y)
+{
+    return rocsparse_csrmv_template<float>(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           x,
+                                           beta,
+                                           y);
+}
+
+extern "C" rocsparse_status rocsparse_bfcsrmv(rocsparse_handle handle,
+                                              rocsparse_operation trans,
+                                              rocsparse_int m,
+                                              rocsparse_int n,
+                                              rocsparse_int nnz,
+                                              const float* alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_bfloat16* csr_val,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              rocsparse_mat_info info,
+                                              const float* x,
+                                              const float* beta,
+                                              float* y)
+{
+    return rocsparse_csrmv_template<float>(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           info,
+                                           x,
+                                           beta,
+                                           y);
+}
@@ -28,6 +28,7 @@
 #include "rocsparse.h"
 #include "handle.h"
 #include "utility.h"
+#include "capture.h"
 #include "csrmv_device.h"
 
 #include <hip/hip_runtime.h>
@@ -366,10 +367,14 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle handle,
     {
         return rocsparse_status_invalid_pointer;
     }
-    else if(csr_val == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_csrmv_analysis",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    n,
+                                    nnz,
+                                    sizeof(rocsparse_int) * (m + 1));
 
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
@@ -377,8 +382,29 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle handle,
         return rocsparse_status_success;
     }
 
+    // Fingerprint of the sparsity pattern
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_update_pattern_key(
+        handle, info, m, n, nnz, descr->base, csr_row_ptr, csr_col_ind, true));
+
+    // Analysis data of a matrix with identical pattern can be re-used, independent
+    // of where the matrix is stored
+    if(info->csrmv_info != nullptr && info->csrmv_info->key == info->pattern &&
+       info->csrmv_info->trans == trans)
+    {
+        return rocsparse_status_success;
+    }
+
     // Clear csrmv info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrmv_info(info->csrmv_info));
+    info->csrmv_info = nullptr;
+
+    // Check for analysis data of another matrix info with identical pattern
+    info->csrmv_info = rocsparse_find_csrmv_info(handle, info->pattern, trans);
+
+    if(info->csrmv_info != nullptr)
+    {
+        return rocsparse_status_success;
+    }
 
     // Create csrmv info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrmv_info(&info->csrmv_info));
@@ -402,8 +428,11 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle handle,
     // Allocate memory on device to hold csrmv info, if required
     if(info->csrmv_info->size > 0)
     {
-        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csrmv_info->row_blocks,
-                                      sizeof(unsigned long long) * info->csrmv_info->size));
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_device_malloc_memory(handle,
+                                           (void**)&info->csrmv_info->row_blocks,
+                                           sizeof(unsigned long long) * info->csrmv_info->size));
+        info->csrmv_info->allocator = handle->allocator;
 
         // Copy row blocks information to device
         RETURN_IF_HIP_ERROR(hipMemcpy(info->csrmv_info->row_blocks,
@@ -412,61 +441,63 @@ rocsparse_status rocsparse_csrmv_analysis_template(rocsparse_handle handle,
                                       hipMemcpyHostToDevice));
     }
 
-    // Store some pointers to verify correct execution
-    info->csrmv_info->trans       = trans;
-    info->csrmv_info->m           = m;
-    info->csrmv_info->n           = n;
-    info->csrmv_info->nnz         = nnz;
-    info->csrmv_info->descr       = descr;
-    info->csrmv_info->csr_row_ptr = csr_row_ptr;
-    info->csrmv_info->csr_col_ind = csr_col_ind;
+    // Store some data to verify correct execution
+    info->csrmv_info->trans = trans;
+    info->csrmv_info->m     = m;
+    info->csrmv_info->n     = n;
+    info->csrmv_info->nnz   = nnz;
+    info->csrmv_info->key   = info->pattern;
+
+    // Share analysis data with other matrix info structures
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_cache_csrmv_info(handle, info->csrmv_info));
 
     return rocsparse_status_success;
 }
 
-template <typename T, rocsparse_int WF_SIZE>
+template <typename T, typename U, rocsparse_int WF_SIZE>
 __global__ void csrmvn_general_kernel_host_pointer(rocsparse_int m,
                                                    T alpha,
                                                    const rocsparse_int* __restrict__ csr_row_ptr,
                                                    const rocsparse_int* __restrict__ csr_col_ind,
-                                                   const T* __restrict__ csr_val,
+                                                   const U* __restrict__ csr_val,
                                                    const T* __restrict__ x,
                                                    T beta,
                                                    T* __restrict__ y,
                                                    rocsparse_index_base idx_base)
 {
-    csrmvn_general_device<T, WF_SIZE>(
+    csrmvn_general_device<T, U, WF_SIZE>(
         m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
 }
 
-template <typename T, rocsparse_int WF_SIZE>
+template <typename T, typename U, rocsparse_int WF_SIZE>
 __global__ void csrmvn_general_kernel_device_pointer(rocsparse_int m,
                                                      const T* alpha,
                                                      const rocsparse_int* __restrict__ csr_row_ptr,
                                                      const rocsparse_int* __restrict__ csr_col_ind,
-                                                     const T* __restrict__ csr_val,
+                                                     const U* __restrict__ csr_val,
                                                      const T* __restrict__ x,
                                                      const T* beta,
                                                      T* __restrict__ y,
                                                      rocsparse_index_base idx_base)
 {
-    csrmvn_general_device<T, WF_SIZE>(
+    csrmvn_general_device<T, U, WF_SIZE>(
         m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
 __launch_bounds__(WG_SIZE) __global__
     void csrmvn_adaptive_kernel_host_pointer(unsigned long long* __restrict__ row_blocks,
                                              T alpha,
                                              const rocsparse_int* __restrict__ csr_row_ptr,
                                              const rocsparse_int* __restrict__ csr_col_ind,
-                                             const T* __restrict__ csr_val,
+                                             const U* __restrict__ csr_val,
                                              const T* __restrict__ x,
                                              T beta,
                                              T* __restrict__ y,
                                              rocsparse_index_base idx_base)
 {
     csrmvn_adaptive_device<T,
+                           U,
                            BLOCKSIZE,
                            BLOCK_MULTIPLIER,
                            ROWS_FOR_VECTOR,
@@ -476,19 +507,20 @@ __launch_bounds__(WG_SIZE) __global__
         row_blocks, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
 __launch_bounds__(WG_SIZE) __global__
     void csrmvn_adaptive_kernel_device_pointer(unsigned long long* __restrict__ row_blocks,
                                                const T* alpha,
                                                const rocsparse_int* __restrict__ csr_row_ptr,
                                                const rocsparse_int* __restrict__ csr_col_ind,
-                                               const T* __restrict__ csr_val,
+                                               const U* __restrict__ csr_val,
                                                const T* __restrict__ x,
                                                const T* beta,
                                                T* __restrict__ y,
                                                rocsparse_index_base idx_base)
 {
     csrmvn_adaptive_device<T,
+                           U,
                            BLOCKSIZE,
                            BLOCK_MULTIPLIER,
                            ROWS_FOR_VECTOR,
@@ -498,7 +530,55 @@ __launch_bounds__(WG_SIZE) __global__
         row_blocks, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
+rocsparse_status rocsparse_csrmv_dispatch(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          rocsparse_int nnz,
+                                          const T* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const U* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          rocsparse_mat_info info,
+                                          const T* x,
+                                          const T* beta,
+                                          T* y)
+{
+    if(info == nullptr)
+    {
+        // If csrmv info is not available, call csrmv general
+        return rocsparse_csrmv_general_template(
+            handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+    else if(info->csrmv_info == nullptr)
+    {
+        // If csrmv info is not available, call csrmv general
+        return rocsparse_csrmv_general_template(
+            handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+    }
+    else
+    {
+        // If csrmv info is available, call csrmv adaptive
+        return rocsparse_csrmv_adaptive_template(handle,
+                                                 trans,
+                                                 m,
+                                                 n,
+                                                 nnz,
+                                                 alpha,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 info,
+                                                 x,
+                                                 beta,
+                                                 y);
+    }
+}
+
+template <typename T, typename U>
 rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
                                           rocsparse_operation trans,
                                           rocsparse_int m,
@@ -506,7 +586,7 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
                                           rocsparse_int nnz,
                                           const T* alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T* csr_val,
+                                          const U* csr_val,
                                           const rocsparse_int* csr_row_ptr,
                                           const rocsparse_int* csr_col_ind,
                                           rocsparse_mat_info info,
@@ -528,7 +608,7 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrmv"),
+                  replaceX<U>("rocsparse_Xcsrmv"),
                   trans,
                   m,
                   n,
@@ -543,10 +623,14 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
                   (const void*&)y,
                   (const void*&)info);
 
+        std::string mtx = rocsparse_capture_csr(
+            handle, "csrmv", m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind);
+
         log_bench(handle,
                   "./rocsparse-bench -f csrmv -r",
-                  replaceX<T>("X"),
-                  "--mtx <matrix.mtx> "
+                  replaceX<U>("X"),
+                  "--mtx",
+                  mtx,
                   "--alpha",
                   *alpha,
                   "--beta",
@@ -555,7 +639,7 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xcsrmv"),
+                  replaceX<U>("rocsparse_Xcsrmv"),
                   trans,
                   m,
                   n,
@@ -595,12 +679,8 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
         return rocsparse_status_invalid_size;
     }
 
-    // Check pointer arguments
-    if(csr_val == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(csr_row_ptr == nullptr)
+    // Check pointer arguments, csr_val is NULL for pattern only matrices
+    if(csr_row_ptr == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -625,45 +705,61 @@ rocsparse_status rocsparse_csrmv_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Pattern only matrices do not stream any values
+    size_t val_size = (csr_val != nullptr) ? sizeof(U) : 0;
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsrmv",
+                                    rocsparse_precision_string<U>(),
+                                    m,
+                                    n,
+                                    nnz,
+                                    (val_size + sizeof(rocsparse_int)) * nnz +
+                                        sizeof(rocsparse_int) * (m + 1) + sizeof(T) * n +
+                                        2 * sizeof(T) * m);
+
     // Quick return if possible
     if(m == 0 || n == 0 || nnz == 0)
     {
         return rocsparse_status_success;
     }
 
-    if(info == nullptr)
-    {
-        // If csrmv info is not available, call csrmv general
-        return rocsparse_csrmv_general_template(
-            handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
-    }
-    else if(info->csrmv_info == nullptr)
-    {
-        // If csrmv info is not available, call csrmv general
-        return rocsparse_csrmv_general_template(
-            handle, trans, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
-    }
-    else
+    // Pattern only matrices are processed by kernels that do not load any values
+    if(csr_val == nullptr)
     {
-        // If csrmv info is available, call csrmv adaptive
-        return rocsparse_csrmv_adaptive_template(handle,
-                                                 trans,
-                                                 m,
-                                                 n,
-                                                 nnz,
-                                                 alpha,
-                                                 descr,
-                                                 csr_val,
-                                                 csr_row_ptr,
-                                                 csr_col_ind,
-                                                 info->csrmv_info,
-                                                 x,
-                                                 beta,
-                                                 y);
+        return rocsparse_csrmv_dispatch(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        nnz,
+                                        alpha,
+                                        descr,
+                                        static_cast<const rocsparse_pattern_value*>(nullptr),
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        x,
+                                        beta,
+                                        y);
     }
+
+    return rocsparse_csrmv_dispatch(handle,
+                                    trans,
+                                    m,
+                                    n,
+                                    nnz,
+                                    alpha,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    info,
+                                    x,
+                                    beta,
+                                    y);
 }
 
-template <typename T>
+template <typename T, typename U>
 rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                                                   rocsparse_operation trans,
                                                   rocsparse_int m,
@@ -671,7 +767,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                                                   rocsparse_int nnz,
                                                   const T* alpha,
                                                   const rocsparse_mat_descr descr,
-                                                  const T* csr_val,
+                                                  const U* csr_val,
                                                   const rocsparse_int* csr_row_ptr,
                                                   const rocsparse_int* csr_col_ind,
                                                   const T* x,
@@ -696,7 +792,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 2>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, U, 2>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -713,7 +809,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 4>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, U, 4>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -730,7 +826,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 8>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, U, 8>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -747,7 +843,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 16>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, U, 16>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -764,7 +860,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 32>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, U, 32>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -784,7 +880,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 2>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, U, 2>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -801,7 +897,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 4>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, U, 4>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -818,7 +914,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 8>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, U, 8>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -835,7 +931,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 16>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, U, 16>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -852,7 +948,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 64)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 32>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, U, 32>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -869,7 +965,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, 64>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_device_pointer<T, U, 64>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -901,7 +997,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 2>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, U, 2>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -918,7 +1014,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 4>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, U, 4>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -935,7 +1031,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 8>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, U, 8>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -952,7 +1048,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 16>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, U, 16>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -969,7 +1065,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 32>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, U, 32>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -989,7 +1085,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
             {
                 if(nnz_per_row < 4)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 2>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, U, 2>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1006,7 +1102,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 8)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 4>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, U, 4>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1023,7 +1119,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 16)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 8>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, U, 8>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1040,7 +1136,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 32)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 16>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, U, 16>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1057,7 +1153,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else if(nnz_per_row < 64)
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 32>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, U, 32>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1074,7 +1170,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
                 }
                 else
                 {
-                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, 64>),
+                    hipLaunchKernelGGL((csrmvn_general_kernel_host_pointer<T, U, 64>),
                                        csrmvn_blocks,
                                        csrmvn_threads,
                                        0,
@@ -1105,7 +1201,7 @@ rocsparse_status rocsparse_csrmv_general_template(rocsparse_handle handle,
     return rocsparse_status_success;
 }
 
-template <typename T>
+template <typename T, typename U>
 rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle handle,
                                                    rocsparse_operation trans,
                                                    rocsparse_int m,
@@ -1113,40 +1209,44 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle handle,
                                                    rocsparse_int nnz,
                                                    const T* alpha,
                                                    const rocsparse_mat_descr descr,
-                                                   const T* csr_val,
+                                                   const U* csr_val,
                                                    const rocsparse_int* csr_row_ptr,
                                                    const rocsparse_int* csr_col_ind,
-                                                   rocsparse_csrmv_info info,
+                                                   rocsparse_mat_info info,
                                                    const T* x,
                                                    const T* beta,
                                                    T* y)
 {
+    rocsparse_csrmv_info csrmv = info->csrmv_info;
+
     // Check if info matches current matrix and options
-    if(info->trans != trans)
+    if(csrmv->trans != trans)
     {
         return rocsparse_status_invalid_value;
     }
-    else if(info->m != m)
+    else if(csrmv->m != m)
     {
         return rocsparse_status_invalid_size;
     }
-    else if(info->n != n)
+    else if(csrmv->n != n)
     {
         return rocsparse_status_invalid_size;
     }
-    else if(info->nnz != nnz)
+    else if(csrmv->nnz != nnz)
     {
         return rocsparse_status_invalid_size;
     }
-    else if(info->descr != descr)
+    else if(csrmv->key.base != descr->base)
     {
         return rocsparse_status_invalid_value;
     }
-    else if(info->csr_row_ptr != csr_row_ptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(info->csr_col_ind != csr_col_ind)
+
+    // Re-compute the fingerprint if the matrix has been moved since the analysis,
+    // such that a moved matrix with identical pattern can still be processed
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_update_pattern_key(
+        handle, info, m, n, nnz, descr->base, csr_row_ptr, csr_col_ind, false));
+
+    if(info->pattern != csrmv->key)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -1157,17 +1257,17 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle handle,
     // Run different csrmv kernels
     if(trans == rocsparse_operation_none)
     {
-        dim3 csrmvn_blocks((info->size / 2) - 1);
+        dim3 csrmvn_blocks((csrmv->size / 2) - 1);
         dim3 csrmvn_threads(WG_SIZE);
 
         if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            hipLaunchKernelGGL((csrmvn_adaptive_kernel_device_pointer<T>),
+            hipLaunchKernelGGL((csrmvn_adaptive_kernel_device_pointer<T, U>),
                                csrmvn_blocks,
                                csrmvn_threads,
                                0,
                                stream,
-                               info->row_blocks,
+                               csrmv->row_blocks,
                                alpha,
                                csr_row_ptr,
                                csr_col_ind,
@@ -1184,12 +1284,12 @@ rocsparse_status rocsparse_csrmv_adaptive_template(rocsparse_handle handle,
                 return rocsparse_status_success;
             }
 
-            hipLaunchKernelGGL((csrmvn_adaptive_kernel_host_pointer<T>),
+            hipLaunchKernelGGL((csrmvn_adaptive_kernel_host_pointer<T, U>),
                                csrmvn_blocks,
                                csrmvn_threads,
                                0,
                                stream,
-                               info->row_blocks,
+                               csrmv->row_blocks,
                                *alpha,
                                csr_row_ptr,
                                csr_col_ind,
@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "rocsparse.h"
+#include "rocsparse_csrmv_masked.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_scsrmv_masked(rocsparse_handle handle,
+                                                    rocsparse_operation trans,
+                                                    rocsparse_int m,
+                                                    rocsparse_int n,
+                                                    rocsparse_int nnz,
+                                                    const float* alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const float* csr_val,
+                                                    const rocsparse_int* csr_row_ptr,
+                                                    const rocsparse_int* csr_col_ind,
+                                                    const float* x,
+                                                    const float* beta,
+                                                    rocsparse_int mask_nnz,
+                                                    const rocsparse_int* mask_ind,
+                                                    float* y)
+{
+    return rocsparse_csrmv_masked_template(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           x,
+                                           beta,
+                                           mask_nnz,
+                                           mask_ind,
+                                           y);
+}
+
+extern "C" rocsparse_status rocsparse_dcsrmv_masked(rocsparse_handle handle,
+                                                    rocsparse_operation trans,
+                                                    rocsparse_int m,
+                                                    rocsparse_int n,
+                                                    rocsparse_int nnz,
+                                                    const double* alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const double* csr_val,
+                                                    const rocsparse_int* csr_row_ptr,
+                                                    const rocsparse_int* csr_col_ind,
+                                                    const double* x,
+                                                    const double* beta,
+                                                    rocsparse_int mask_nnz,
+                                                    const rocsparse_int* mask_ind,
+                                                    double* y)
+{
+    return rocsparse_csrmv_masked_template(handle,
+                                           trans,
+                                           m,
+                                           n,
+                                           nnz,
+                                           alpha,
+                                           descr,
+                                           csr_val,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           x,
+                                           beta,
+                                           mask_nnz,
+                                           mask_ind,
+                                           y);
+}
@@ -0,0 +1,508 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRMV_MASKED_HPP
+#define ROCSPARSE_CSRMV_MASKED_HPP
+
+#include "rocsparse.h"
+#include "handle.h"
+#include "utility.h"
+#include "capture.h"
+#include "csrmv_masked_device.h"
+
+#include <hipcub/hipcub.hpp>
+#include <hip/hip_runtime.h>
+
+template <typename T>
+__global__ void
+    csrmv_masked_setup_kernel_host_pointer(rocsparse_int mask_nnz,
+                                           const rocsparse_int* __restrict__ mask_ind,
+                                           const rocsparse_int* __restrict__ csr_row_ptr,
+                                           T beta,
+                                           T* __restrict__ y,
+                                           rocsparse_int* __restrict__ mask_ptr,
+                                           rocsparse_index_base idx_base)
+{
+    csrmv_masked_setup_device(mask_nnz, mask_ind, csr_row_ptr, beta, y, mask_ptr, idx_base);
+}
+
+template <typename T>
+__global__ void
+    csrmv_masked_setup_kernel_device_pointer(rocsparse_int mask_nnz,
+                                             const rocsparse_int* __restrict__ mask_ind,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const T* beta,
+                                             T* __restrict__ y,
+                                             rocsparse_int* __restrict__ mask_ptr,
+                                             rocsparse_index_base idx_base)
+{
+    csrmv_masked_setup_device(mask_nnz, mask_ind, csr_row_ptr, *beta, y, mask_ptr, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int TILE_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_masked_kernel_host_pointer(rocsparse_int mask_nnz,
+                                           const rocsparse_int* __restrict__ mask_ind,
+                                           const rocsparse_int* __restrict__ mask_ptr,
+                                           T alpha,
+                                           const rocsparse_int* __restrict__ csr_row_ptr,
+                                           const rocsparse_int* __restrict__ csr_col_ind,
+                                           const T* __restrict__ csr_val,
+                                           const T* __restrict__ x,
+                                           T* __restrict__ y,
+                                           rocsparse_index_base idx_base)
+{
+    csrmvn_masked_device<T, BLOCKSIZE, WF_SIZE, TILE_SIZE>(
+        mask_nnz, mask_ind, mask_ptr, alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+}
+
+template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, rocsparse_int TILE_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_masked_kernel_device_pointer(rocsparse_int mask_nnz,
+                                             const rocsparse_int* __restrict__ mask_ind,
+                                             const rocsparse_int* __restrict__ mask_ptr,
+                                             const T* alpha,
+                                             const rocsparse_int* __restrict__ csr_row_ptr,
+                                             const rocsparse_int* __restrict__ csr_col_ind,
+                                             const T* __restrict__ csr_val,
+                                             const T* __restrict__ x,
+                                             T* __restrict__ y,
+                                             rocsparse_index_base idx_base)
+{
+    csrmvn_masked_device<T, BLOCKSIZE, WF_SIZE, TILE_SIZE>(
+        mask_nnz, mask_ind, mask_ptr, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, y, idx_base);
+}
+
+#define CSRMVN_MASKED_DIM 256
+#define CSRMVN_MASKED_TILES 8
+template <typename T, rocsparse_int WF_SIZE>
+static void rocsparse_csrmv_masked_launch(rocsparse_handle handle,
+                                          rocsparse_int m,
+                                          rocsparse_int nnz,
+                                          const T* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const T* csr_val,
+                                          const rocsparse_int* csr_row_ptr,
+                                          const rocsparse_int* csr_col_ind,
+                                          const T* x,
+                                          rocsparse_int mask_nnz,
+                                          const rocsparse_int* mask_ind,
+                                          const rocsparse_int* mask_ptr,
+                                          T* y)
+{
+    // Each wavefront processes tiles of a fixed number of selected non-zero entries.
+    // The number of tiles is only known on the device, it is estimated from the
+    // average row length and the remaining tiles are picked up by a grid stride loop.
+#define TILE_SIZE (WF_SIZE * CSRMVN_MASKED_TILES)
+    rocsparse_int maxthreads = handle->properties.maxThreadsPerBlock;
+    rocsparse_int nprocs     = handle->properties.multiProcessorCount;
+    rocsparse_int maxblocks  = (nprocs * maxthreads - 1) / CSRMVN_MASKED_DIM + 1;
+
+    int64_t ntiles    = static_cast<int64_t>(mask_nnz) * (nnz / m + 1) / TILE_SIZE + 1;
+    int64_t minblocks = (ntiles - 1) / (CSRMVN_MASKED_DIM / WF_SIZE) + 1;
+
+    dim3 csrmvn_blocks(std::min(static_cast<int64_t>(maxblocks), minblocks));
+    dim3 csrmvn_threads(CSRMVN_MASKED_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmvn_masked_kernel_device_pointer<T,
+                                                                CSRMVN_MASKED_DIM,
+                                                                WF_SIZE,
+                                                                TILE_SIZE>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           handle->stream,
+                           mask_nnz,
+                           mask_ind,
+                           mask_ptr,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvn_masked_kernel_host_pointer<T,
+                                                              CSRMVN_MASKED_DIM,
+                                                              WF_SIZE,
+                                                              TILE_SIZE>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           handle->stream,
+                           mask_nnz,
+                           mask_ind,
+                           mask_ptr,
+                           *alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           y,
+                           descr->base);
+    }
+#undef TILE_SIZE
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_masked_template(rocsparse_handle handle,
+                                                 rocsparse_operation trans,
+                                                 rocsparse_int m,
+                                                 rocsparse_int n,
+                                                 rocsparse_int nnz,
+                                                 const T* alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T* csr_val,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 const T* x,
+                                                 const T* beta,
+                                                 rocsparse_int mask_nnz,
+                                                 const rocsparse_int* mask_ind,
+                                                 T* y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_masked"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  *beta,
+                  mask_nnz,
+                  (const void*&)mask_ind,
+                  (const void*&)y);
+
+        std::string mtx = rocsparse_capture_csr(
+            handle, "csrmv_masked", m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrmv_masked -r",
+                  replaceX<T>("X"),
+                  "--mtx",
+                  mtx,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_masked"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  mask_nnz,
+                  (const void*&)mask_ind,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(mask_nnz < 0 || mask_nnz > m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(mask_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The amount of data depends on the selected rows, and is estimated from the
+    // average row length
+    double sel_nnz = (m == 0) ? 0.0 : static_cast<double>(nnz) * mask_nnz / m;
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsrmv_masked",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    n,
+                                    nnz,
+                                    (sizeof(T) + sizeof(rocsparse_int)) * sel_nnz
+                                        + sizeof(rocsparse_int) * 3 * mask_nnz
+                                        + 2 * sizeof(T) * mask_nnz);
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0 || mask_nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Device properties and buffer are initialized on first use
+    RETURN_IF_ROCSPARSE_ERROR(handle->init_buffer());
+
+    rocsparse_workspace_scope workspace_scope(handle);
+
+    // Offsets of the selected rows in the sequence of selected non-zero entries
+    rocsparse_int* mask_ptr;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(
+        handle, (void**)&mask_ptr, sizeof(rocsparse_int) * (mask_nnz + 1)));
+
+    // Scale the selected rows of y with beta and compute their lengths
+    dim3 setup_blocks((mask_nnz - 1) / CSRMVN_MASKED_DIM + 1);
+    dim3 setup_threads(CSRMVN_MASKED_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmv_masked_setup_kernel_device_pointer<T>),
+                           setup_blocks,
+                           setup_threads,
+                           0,
+                           stream,
+                           mask_nnz,
+                           mask_ind,
+                           csr_row_ptr,
+                           beta,
+                           y,
+                           mask_ptr,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmv_masked_setup_kernel_host_pointer<T>),
+                           setup_blocks,
+                           setup_threads,
+                           0,
+                           stream,
+                           mask_nnz,
+                           mask_ind,
+                           csr_row_ptr,
+                           *beta,
+                           y,
+                           mask_ptr,
+                           descr->base);
+    }
+
+    // Prefix sum of the row lengths
+    size_t size = 0;
+    void* tmp_hipcub;
+
+    RETURN_IF_HIP_ERROR(
+        hipcub::DeviceScan::InclusiveSum(nullptr, size, mask_ptr, mask_ptr, mask_nnz + 1, stream));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(handle, &tmp_hipcub, size));
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
+        tmp_hipcub, size, mask_ptr, mask_ptr, mask_nnz + 1, stream));
+
+    // The subgroup size is chosen from the average row length
+    rocsparse_int nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        rocsparse_csrmv_masked_launch<T, 2>(handle,
+                                            m,
+                                            nnz,
+                                            alpha,
+                                            descr,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            x,
+                                            mask_nnz,
+                                            mask_ind,
+                                            mask_ptr,
+                                            y);
+    }
+    else if(nnz_per_row < 8)
+    {
+        rocsparse_csrmv_masked_launch<T, 4>(handle,
+                                            m,
+                                            nnz,
+                                            alpha,
+                                            descr,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            x,
+                                            mask_nnz,
+                                            mask_ind,
+                                            mask_ptr,
+                                            y);
+    }
+    else if(nnz_per_row < 16)
+    {
+        rocsparse_csrmv_masked_launch<T, 8>(handle,
+                                            m,
+                                            nnz,
+                                            alpha,
+                                            descr,
+                                            csr_val,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            x,
+                                            mask_nnz,
+                                            mask_ind,
+                                            mask_ptr,
+                                            y);
+    }
+    else if(nnz_per_row < 32)
+    {
+        rocsparse_csrmv_masked_launch<T, 16>(handle,
+                                             m,
+                                             nnz,
+                                             alpha,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             x,
+                                             mask_nnz,
+                                             mask_ind,
+                                             mask_ptr,
+                                             y);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        rocsparse_csrmv_masked_launch<T, 32>(handle,
+                                             m,
+                                             nnz,
+                                             alpha,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             x,
+                                             mask_nnz,
+                                             mask_ind,
+                                             mask_ptr,
+                                             y);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        rocsparse_csrmv_masked_launch<T, 64>(handle,
+                                             m,
+                                             nnz,
+                                             alpha,
+                                             descr,
+                                             csr_val,
+                                             csr_row_ptr,
+                                             csr_col_ind,
+                                             x,
+                                             mask_nnz,
+                                             mask_ind,
+                                             mask_ptr,
+                                             y);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    return rocsparse_status_success;
+}
+#undef CSRMVN_MASKED_TILES
+#undef CSRMVN_MASKED_DIM
+
+#endif // ROCSPARSE_CSRMV_MASKED_HPP
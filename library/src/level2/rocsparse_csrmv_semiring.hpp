@@ -0,0 +1,490 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRMV_SEMIRING_HPP
+#define ROCSPARSE_CSRMV_SEMIRING_HPP
+
+#include "rocsparse.h"
+#include "handle.h"
+#include "utility.h"
+#include "capture.h"
+#include "csrmv_semiring_device.h"
+#include "rocsparse_csrmv.hpp"
+
+#include <hip/hip_runtime.h>
+
+template <rocsparse_semiring S, typename T, rocsparse_int WF_SIZE>
+__global__ void
+    csrmvn_semiring_general_kernel_host_pointer(rocsparse_int m,
+                                                T alpha,
+                                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                                const rocsparse_int* __restrict__ csr_col_ind,
+                                                const T* __restrict__ csr_val,
+                                                const T* __restrict__ x,
+                                                T beta,
+                                                T* __restrict__ y,
+                                                rocsparse_index_base idx_base)
+{
+    csrmvn_semiring_general_device<S, T, WF_SIZE>(
+        m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
+}
+
+template <rocsparse_semiring S, typename T, rocsparse_int WF_SIZE>
+__global__ void
+    csrmvn_semiring_general_kernel_device_pointer(rocsparse_int m,
+                                                  const T* alpha,
+                                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                                  const T* __restrict__ csr_val,
+                                                  const T* __restrict__ x,
+                                                  const T* beta,
+                                                  T* __restrict__ y,
+                                                  rocsparse_index_base idx_base)
+{
+    csrmvn_semiring_general_device<S, T, WF_SIZE>(
+        m, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
+}
+
+template <rocsparse_semiring S, typename T>
+__launch_bounds__(WG_SIZE) __global__
+    void csrmvn_semiring_adaptive_kernel_host_pointer(unsigned long long* __restrict__ row_blocks,
+                                                      T alpha,
+                                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                                      const T* __restrict__ csr_val,
+                                                      const T* __restrict__ x,
+                                                      T beta,
+                                                      T* __restrict__ y,
+                                                      rocsparse_index_base idx_base)
+{
+    csrmvn_semiring_adaptive_device<S,
+                                    T,
+                                    BLOCKSIZE,
+                                    BLOCK_MULTIPLIER,
+                                    ROWS_FOR_VECTOR,
+                                    WG_BITS,
+                                    ROW_BITS,
+                                    WG_SIZE>(
+        row_blocks, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
+}
+
+template <rocsparse_semiring S, typename T>
+__launch_bounds__(WG_SIZE) __global__ void csrmvn_semiring_adaptive_kernel_device_pointer(
+    unsigned long long* __restrict__ row_blocks,
+    const T* alpha,
+    const rocsparse_int* __restrict__ csr_row_ptr,
+    const rocsparse_int* __restrict__ csr_col_ind,
+    const T* __restrict__ csr_val,
+    const T* __restrict__ x,
+    const T* beta,
+    T* __restrict__ y,
+    rocsparse_index_base idx_base)
+{
+    csrmvn_semiring_adaptive_device<S,
+                                    T,
+                                    BLOCKSIZE,
+                                    BLOCK_MULTIPLIER,
+                                    ROWS_FOR_VECTOR,
+                                    WG_BITS,
+                                    ROW_BITS,
+                                    WG_SIZE>(
+        row_blocks, *alpha, csr_row_ptr, csr_col_ind, csr_val, x, *beta, y, idx_base);
+}
+
+#define CSRMVN_SEMIRING_DIM 512
+template <rocsparse_semiring S, typename T, rocsparse_int WF_SIZE>
+static void rocsparse_csrmv_semiring_general_launch(rocsparse_handle handle,
+                                                    rocsparse_int m,
+                                                    const T* alpha,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T* csr_val,
+                                                    const rocsparse_int* csr_row_ptr,
+                                                    const rocsparse_int* csr_col_ind,
+                                                    const T* x,
+                                                    const T* beta,
+                                                    T* y)
+{
+    // One wavefront per row
+    dim3 csrmvn_blocks((m - 1) / (CSRMVN_SEMIRING_DIM / WF_SIZE) + 1);
+    dim3 csrmvn_threads(CSRMVN_SEMIRING_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmvn_semiring_general_kernel_device_pointer<S, T, WF_SIZE>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           beta,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvn_semiring_general_kernel_host_pointer<S, T, WF_SIZE>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           *alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           *beta,
+                           y,
+                           descr->base);
+    }
+}
+#undef CSRMVN_SEMIRING_DIM
+
+template <rocsparse_semiring S, typename T>
+rocsparse_status rocsparse_csrmv_semiring_dispatch(rocsparse_handle handle,
+                                                   rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   rocsparse_int nnz,
+                                                   const T* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T* csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_mat_info info,
+                                                   const T* x,
+                                                   const T* beta,
+                                                   T* y)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    // Nothing to do if alpha is the additive and beta the multiplicative identity
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == op::zero() &&
+       *beta == op::one())
+    {
+        return rocsparse_status_success;
+    }
+
+    if(info == nullptr || info->csrmv_info == nullptr)
+    {
+        // If csrmv info is not available, call csrmv general
+        rocsparse_int nnz_per_row = nnz / m;
+
+        if(nnz_per_row < 4)
+        {
+            rocsparse_csrmv_semiring_general_launch<S, T, 2>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+        }
+        else if(nnz_per_row < 8)
+        {
+            rocsparse_csrmv_semiring_general_launch<S, T, 4>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+        }
+        else if(nnz_per_row < 16)
+        {
+            rocsparse_csrmv_semiring_general_launch<S, T, 8>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+        }
+        else if(nnz_per_row < 32)
+        {
+            rocsparse_csrmv_semiring_general_launch<S, T, 16>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+        }
+        else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+        {
+            rocsparse_csrmv_semiring_general_launch<S, T, 32>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+        }
+        else if(handle->wavefront_size == 64)
+        {
+            rocsparse_csrmv_semiring_general_launch<S, T, 64>(
+                handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, x, beta, y);
+        }
+        else
+        {
+            return rocsparse_status_arch_mismatch;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // If csrmv info is available, call csrmv adaptive
+    rocsparse_csrmv_info csrmv = info->csrmv_info;
+
+    // Check if info matches current matrix and options
+    if(csrmv->trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    else if(csrmv->m != m)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csrmv->n != n)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csrmv->nnz != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(csrmv->key.base != descr->base)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Re-compute the fingerprint if the matrix has been moved since the analysis
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_update_pattern_key(
+        handle, info, m, n, nnz, descr->base, csr_row_ptr, csr_col_ind, false));
+
+    if(info->pattern != csrmv->key)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    dim3 csrmvn_blocks((csrmv->size / 2) - 1);
+    dim3 csrmvn_threads(WG_SIZE);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrmvn_semiring_adaptive_kernel_device_pointer<S, T>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           handle->stream,
+                           csrmv->row_blocks,
+                           alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           beta,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrmvn_semiring_adaptive_kernel_host_pointer<S, T>),
+                           csrmvn_blocks,
+                           csrmvn_threads,
+                           0,
+                           handle->stream,
+                           csrmv->row_blocks,
+                           *alpha,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           x,
+                           *beta,
+                           y,
+                           descr->base);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_semiring_template(rocsparse_handle handle,
+                                                   rocsparse_operation trans,
+                                                   rocsparse_semiring semiring,
+                                                   rocsparse_int m,
+                                                   rocsparse_int n,
+                                                   rocsparse_int nnz,
+                                                   const T* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T* csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_mat_info info,
+                                                   const T* x,
+                                                   const T* beta,
+                                                   T* y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_semiring"),
+                  trans,
+                  semiring,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        std::string mtx = rocsparse_capture_csr(
+            handle, "csrmv_semiring", m, n, nnz, descr, csr_val, csr_row_ptr, csr_col_ind);
+
+        std::string semiring_name = rocsparse_semiring_string(semiring);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f csrmv_semiring -r",
+                  replaceX<T>("X"),
+                  "--mtx",
+                  mtx,
+                  "--semiring",
+                  semiring_name,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_semiring"),
+                  trans,
+                  semiring,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_val,
+                  (const void*&)csr_row_ptr,
+                  (const void*&)csr_col_ind,
+                  (const void*&)info,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(semiring < rocsparse_semiring_plus_times || semiring > rocsparse_semiring_or_and)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments, csr_val can be NULL for pattern only matrices
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsrmv_semiring",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    n,
+                                    nnz,
+                                    (csr_val == nullptr ? 0 : sizeof(T) * nnz)
+                                        + sizeof(rocsparse_int) * (nnz + m + 1) + sizeof(T) * n
+                                        + 2 * sizeof(T) * m);
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    switch(semiring)
+    {
+    case rocsparse_semiring_plus_times:
+        return rocsparse_csrmv_semiring_dispatch<rocsparse_semiring_plus_times>(
+            handle, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y);
+    case rocsparse_semiring_min_plus:
+        return rocsparse_csrmv_semiring_dispatch<rocsparse_semiring_min_plus>(
+            handle, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y);
+    case rocsparse_semiring_max_times:
+        return rocsparse_csrmv_semiring_dispatch<rocsparse_semiring_max_times>(
+            handle, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y);
+    case rocsparse_semiring_or_and:
+        return rocsparse_csrmv_semiring_dispatch<rocsparse_semiring_or_and>(
+            handle, m, n, nnz, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, beta, y);
+    }
+
+    return rocsparse_status_invalid_value;
+}
+
+#endif // ROCSPARSE_CSRMV_SEMIRING_HPP
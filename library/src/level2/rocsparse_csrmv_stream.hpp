@@ -0,0 +1,390 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRMV_STREAM_HPP
+#define ROCSPARSE_CSRMV_STREAM_HPP
+
+#include "rocsparse.h"
+#include "handle.h"
+#include "utility.h"
+#include "rocsparse_csrmv.hpp"
+
+#include <algorithm>
+#include <vector>
+#include <hip/hip_runtime.h>
+
+// Host and device staging buffers of the two panels in flight. The pinned host
+// buffers are released once all copies from them have finished.
+template <typename T>
+struct rocsparse_csrmv_stream_staging
+{
+    // stream of the host to device copies
+    hipStream_t copy_stream = nullptr;
+
+    // start of the copies, after all previous work of the handle stream
+    hipEvent_t ready = nullptr;
+
+    // completion of the copy and of the multiplication of each slot
+    hipEvent_t copied[2]   = {nullptr, nullptr};
+    hipEvent_t computed[2] = {nullptr, nullptr};
+
+    // pinned host buffers
+    rocsparse_int* h_ptr[2] = {nullptr, nullptr};
+    rocsparse_int* h_col[2] = {nullptr, nullptr};
+    T* h_val[2]             = {nullptr, nullptr};
+
+    // device buffers, obtained from the handle workspace
+    rocsparse_int* d_ptr[2] = {nullptr, nullptr};
+    rocsparse_int* d_col[2] = {nullptr, nullptr};
+    T* d_val[2]             = {nullptr, nullptr};
+
+    ~rocsparse_csrmv_stream_staging()
+    {
+        if(copy_stream != nullptr)
+        {
+            hipStreamSynchronize(copy_stream);
+        }
+
+        for(int b = 0; b < 2; ++b)
+        {
+            hipHostFree(h_ptr[b]);
+            hipHostFree(h_col[b]);
+            hipHostFree(h_val[b]);
+
+            if(copied[b] != nullptr)
+            {
+                hipEventDestroy(copied[b]);
+            }
+
+            if(computed[b] != nullptr)
+            {
+                hipEventDestroy(computed[b]);
+            }
+        }
+
+        if(ready != nullptr)
+        {
+            hipEventDestroy(ready);
+        }
+
+        if(copy_stream != nullptr)
+        {
+            hipStreamDestroy(copy_stream);
+        }
+    }
+};
+
+template <typename T>
+rocsparse_status rocsparse_csrmv_stream_template(rocsparse_handle handle,
+                                                 rocsparse_operation trans,
+                                                 rocsparse_int m,
+                                                 rocsparse_int n,
+                                                 rocsparse_int nnz,
+                                                 const T* alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 rocsparse_int panel_nnz,
+                                                 rocsparse_csr_panel_read read_panel,
+                                                 void* user_data,
+                                                 const T* x,
+                                                 const T* beta,
+                                                 T* y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_stream"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_row_ptr,
+                  panel_nnz,
+                  (const void*&)user_data,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        // The streamed matrix might not fit into host memory, and the panel callback
+        // might not be able to read a panel twice, thus it is never captured
+        log_bench(handle,
+                  "./rocsparse-bench -f csrmv_stream -r",
+                  replaceX<T>("X"),
+                  "--mtx <matrix.bin> --panel-nnz",
+                  panel_nnz,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xcsrmv_stream"),
+                  trans,
+                  m,
+                  n,
+                  nnz,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)csr_row_ptr,
+                  panel_nnz,
+                  (const void*&)user_data,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(panel_nnz <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(read_panel == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_index_base idx_base = descr->base;
+
+    // The row pointer array is on the host and has to match nnz
+    if(csr_row_ptr[0] != idx_base || csr_row_ptr[m] - idx_base != nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsrmv_stream",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    n,
+                                    nnz,
+                                    (sizeof(T) + sizeof(rocsparse_int)) * nnz +
+                                        sizeof(rocsparse_int) * (m + 1) + sizeof(T) * n +
+                                        2 * sizeof(T) * m);
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Split the rows into panels of at most panel_nnz entries and rows, rows that are
+    // longer form a panel on their own
+    std::vector<rocsparse_int> panel(1, 0);
+
+    rocsparse_int max_rows = 0;
+    rocsparse_int max_nnz  = 0;
+
+    for(rocsparse_int row_begin = 0; row_begin < m;)
+    {
+        rocsparse_int row_end = row_begin + 1;
+
+        while(row_end < m && row_end - row_begin < panel_nnz &&
+              csr_row_ptr[row_end + 1] - csr_row_ptr[row_begin] <= panel_nnz)
+        {
+            ++row_end;
+        }
+
+        max_rows = std::max(max_rows, row_end - row_begin);
+        max_nnz  = std::max(max_nnz, csr_row_ptr[row_end] - csr_row_ptr[row_begin]);
+
+        panel.push_back(row_end);
+        row_begin = row_end;
+    }
+
+    // Temporary device buffers are obtained from the handle workspace, they are
+    // released after all staging resources
+    rocsparse_workspace_scope workspace_scope(handle);
+    rocsparse_csrmv_stream_staging<T> staging;
+
+    RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&staging.copy_stream, hipStreamNonBlocking));
+    RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&staging.ready, hipEventDisableTiming));
+
+    for(int b = 0; b < 2; ++b)
+    {
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&staging.copied[b], hipEventDisableTiming));
+        RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&staging.computed[b], hipEventDisableTiming));
+
+        RETURN_IF_HIP_ERROR(
+            hipHostMalloc((void**)&staging.h_ptr[b], sizeof(rocsparse_int) * (max_rows + 1)));
+        RETURN_IF_HIP_ERROR(
+            hipHostMalloc((void**)&staging.h_col[b], sizeof(rocsparse_int) * max_nnz));
+        RETURN_IF_HIP_ERROR(hipHostMalloc((void**)&staging.h_val[b], sizeof(T) * max_nnz));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(
+            handle, (void**)&staging.d_ptr[b], sizeof(rocsparse_int) * (max_rows + 1)));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(
+            handle, (void**)&staging.d_col[b], sizeof(rocsparse_int) * max_nnz));
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_workspace_malloc(handle, (void**)&staging.d_val[b], sizeof(T) * max_nnz));
+    }
+
+    // The workspace might still be in use by previous work of the handle stream
+    RETURN_IF_HIP_ERROR(hipEventRecord(staging.ready, handle->stream));
+    RETURN_IF_HIP_ERROR(hipStreamWaitEvent(staging.copy_stream, staging.ready, 0));
+
+    for(size_t k = 0; k + 1 < panel.size(); ++k)
+    {
+        int b = k & 1;
+
+        rocsparse_int row_begin = panel[k];
+        rocsparse_int row_end   = panel[k + 1];
+        rocsparse_int nnz_begin = csr_row_ptr[row_begin] - idx_base;
+        rocsparse_int nnz_end   = csr_row_ptr[row_end] - idx_base;
+
+        // Pinned buffers of the slot are free, once the panel before last has been copied
+        if(k >= 2)
+        {
+            RETURN_IF_HIP_ERROR(hipEventSynchronize(staging.copied[b]));
+        }
+
+        // Panel row pointer, relative to the first entry of the panel
+        for(rocsparse_int i = row_begin; i <= row_end; ++i)
+        {
+            staging.h_ptr[b][i - row_begin] = csr_row_ptr[i] - nnz_begin;
+        }
+
+        // Read the panel, while the previous panel is copied and multiplied
+        rocsparse_status status = read_panel(row_begin,
+                                             row_end,
+                                             nnz_begin,
+                                             nnz_end,
+                                             staging.h_col[b],
+                                             staging.h_val[b],
+                                             user_data);
+
+        if(status != rocsparse_status_success)
+        {
+            return status;
+        }
+
+        // Device buffers of the slot are free, once the panel before last has been multiplied
+        if(k >= 2)
+        {
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(staging.copy_stream, staging.computed[b], 0));
+        }
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(staging.d_ptr[b],
+                                           staging.h_ptr[b],
+                                           sizeof(rocsparse_int) * (row_end - row_begin + 1),
+                                           hipMemcpyHostToDevice,
+                                           staging.copy_stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(staging.d_col[b],
+                                           staging.h_col[b],
+                                           sizeof(rocsparse_int) * (nnz_end - nnz_begin),
+                                           hipMemcpyHostToDevice,
+                                           staging.copy_stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(staging.d_val[b],
+                                           staging.h_val[b],
+                                           sizeof(T) * (nnz_end - nnz_begin),
+                                           hipMemcpyHostToDevice,
+                                           staging.copy_stream));
+        RETURN_IF_HIP_ERROR(hipEventRecord(staging.copied[b], staging.copy_stream));
+
+        // Multiply the panel in the handle stream, once it has arrived
+        RETURN_IF_HIP_ERROR(hipStreamWaitEvent(handle->stream, staging.copied[b], 0));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrmv_general_template(handle,
+                                                                   trans,
+                                                                   row_end - row_begin,
+                                                                   n,
+                                                                   nnz_end - nnz_begin,
+                                                                   alpha,
+                                                                   descr,
+                                                                   staging.d_val[b],
+                                                                   staging.d_ptr[b],
+                                                                   staging.d_col[b],
+                                                                   x,
+                                                                   beta,
+                                                                   y + row_begin));
+        RETURN_IF_HIP_ERROR(hipEventRecord(staging.computed[b], handle->stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+#endif // ROCSPARSE_CSRMV_STREAM_HPP
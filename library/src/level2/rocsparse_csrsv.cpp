@@ -62,6 +62,36 @@ extern "C" rocsparse_status rocsparse_dcsrsv_buffer_size(rocsparse_handle handle
         handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrsv_buffer_size(rocsparse_handle handle,
+                                                         rocsparse_operation trans,
+                                                         rocsparse_int m,
+                                                         rocsparse_int nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const rocsparse_float_complex* csr_val,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         rocsparse_mat_info info,
+                                                         size_t* buffer_size)
+{
+    return rocsparse_csrsv_buffer_size_template<rocsparse_float_complex>(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle handle,
+                                                         rocsparse_operation trans,
+                                                         rocsparse_int m,
+                                                         rocsparse_int nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const rocsparse_double_complex* csr_val,
+                                                         const rocsparse_int* csr_row_ptr,
+                                                         const rocsparse_int* csr_col_ind,
+                                                         rocsparse_mat_info info,
+                                                         size_t* buffer_size)
+{
+    return rocsparse_csrsv_buffer_size_template<rocsparse_double_complex>(
+        handle, trans, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
 extern "C" rocsparse_status rocsparse_scsrsv_analysis(rocsparse_handle handle,
                                                       rocsparse_operation trans,
                                                       rocsparse_int m,
@@ -116,6 +146,60 @@ extern "C" rocsparse_status rocsparse_dcsrsv_analysis(rocsparse_handle handle,
                                                      temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrsv_analysis(rocsparse_handle handle,
+                                                      rocsparse_operation trans,
+                                                      rocsparse_int m,
+                                                      rocsparse_int nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_float_complex* csr_val,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      rocsparse_mat_info info,
+                                                      rocsparse_analysis_policy analysis,
+                                                      rocsparse_solve_policy solve,
+                                                      void* temp_buffer)
+{
+    return rocsparse_csrsv_analysis_template<rocsparse_float_complex>(handle,
+                                                                      trans,
+                                                                      m,
+                                                                      nnz,
+                                                                      descr,
+                                                                      csr_val,
+                                                                      csr_row_ptr,
+                                                                      csr_col_ind,
+                                                                      info,
+                                                                      analysis,
+                                                                      solve,
+                                                                      temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrsv_analysis(rocsparse_handle handle,
+                                                      rocsparse_operation trans,
+                                                      rocsparse_int m,
+                                                      rocsparse_int nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_double_complex* csr_val,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      rocsparse_mat_info info,
+                                                      rocsparse_analysis_policy analysis,
+                                                      rocsparse_solve_policy solve,
+                                                      void* temp_buffer)
+{
+    return rocsparse_csrsv_analysis_template<rocsparse_double_complex>(handle,
+                                                                       trans,
+                                                                       m,
+                                                                       nnz,
+                                                                       descr,
+                                                                       csr_val,
+                                                                       csr_row_ptr,
+                                                                       csr_col_ind,
+                                                                       info,
+                                                                       analysis,
+                                                                       solve,
+                                                                       temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrsv_clear(rocsparse_handle handle,
                                                   const rocsparse_mat_descr descr,
                                                   rocsparse_mat_info info)
@@ -140,24 +224,33 @@ extern "C" rocsparse_status rocsparse_csrsv_clear(rocsparse_handle handle,
     // Determine which info meta data should be deleted
     if(descr->fill_mode == rocsparse_fill_mode_lower)
     {
-        // If meta data is shared, do not delete anything
-        if(info->csrilu0_info == info->csrsv_lower_info)
-        {
-            info->csrsv_lower_info = nullptr;
-
-            return rocsparse_status_success;
-        }
-
+        // Shared meta data is only released once its last owner is cleared
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
         info->csrsv_lower_info = nullptr;
     }
     else if(descr->fill_mode == rocsparse_fill_mode_upper)
     {
-        // Upper info has no shares (yet)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
         info->csrsv_upper_info = nullptr;
     }
 
+    // Meta data of the multicolor reordered matrix
+    if(info->reorder_info != nullptr)
+    {
+        rocsparse_mat_info reorder = info->reorder_info->info;
+
+        if(descr->fill_mode == rocsparse_fill_mode_lower)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(reorder->csrsv_lower_info));
+            reorder->csrsv_lower_info = nullptr;
+        }
+        else if(descr->fill_mode == rocsparse_fill_mode_upper)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(reorder->csrsv_upper_info));
+            reorder->csrsv_upper_info = nullptr;
+        }
+    }
+
     return rocsparse_status_success;
 }
 
@@ -223,6 +316,68 @@ extern "C" rocsparse_status rocsparse_dcsrsv_solve(rocsparse_handle handle,
                                                   temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrsv_solve(rocsparse_handle handle,
+                                                   rocsparse_operation trans,
+                                                   rocsparse_int m,
+                                                   rocsparse_int nnz,
+                                                   const rocsparse_float_complex* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const rocsparse_float_complex* csr_val,
+                                                   const rocsparse_int* csr_row_ind,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_mat_info info,
+                                                   const rocsparse_float_complex* x,
+                                                   rocsparse_float_complex* y,
+                                                   rocsparse_solve_policy policy,
+                                                   void* temp_buffer)
+{
+    return rocsparse_csrsv_solve_template<rocsparse_float_complex>(handle,
+                                                                   trans,
+                                                                   m,
+                                                                   nnz,
+                                                                   alpha,
+                                                                   descr,
+                                                                   csr_val,
+                                                                   csr_row_ind,
+                                                                   csr_col_ind,
+                                                                   info,
+                                                                   x,
+                                                                   y,
+                                                                   policy,
+                                                                   temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrsv_solve(rocsparse_handle handle,
+                                                   rocsparse_operation trans,
+                                                   rocsparse_int m,
+                                                   rocsparse_int nnz,
+                                                   const rocsparse_double_complex* alpha,
+                                                   const rocsparse_mat_descr descr,
+                                                   const rocsparse_double_complex* csr_val,
+                                                   const rocsparse_int* csr_row_ind,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_mat_info info,
+                                                   const rocsparse_double_complex* x,
+                                                   rocsparse_double_complex* y,
+                                                   rocsparse_solve_policy policy,
+                                                   void* temp_buffer)
+{
+    return rocsparse_csrsv_solve_template<rocsparse_double_complex>(handle,
+                                                                    trans,
+                                                                    m,
+                                                                    nnz,
+                                                                    alpha,
+                                                                    descr,
+                                                                    csr_val,
+                                                                    csr_row_ind,
+                                                                    csr_col_ind,
+                                                                    info,
+                                                                    x,
+                                                                    y,
+                                                                    policy,
+                                                                    temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
                                                        const rocsparse_mat_descr descr,
                                                        rocsparse_mat_info info,
@@ -251,7 +406,7 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
     hipStream_t stream = handle->stream;
 
     // Determine the info meta data place
-    rocsparse_csrtr_info csrsv = nullptr;
+    rocsparse_csrtr_info* target = nullptr;
 
     // For hipSPARSE compatibility mode, we allow descr == nullptr
     // In this case, only lower OR upper is populated and we can use the right
@@ -260,11 +415,11 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
     {
         if(info->csrsv_lower_info != nullptr)
         {
-            csrsv = info->csrsv_lower_info;
+            target = &info->csrsv_lower_info;
         }
         else
         {
-            csrsv = info->csrsv_upper_info;
+            target = &info->csrsv_upper_info;
         }
     }
     else
@@ -272,11 +427,39 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
         // Switch between upper and lower triangular
         if(descr->fill_mode == rocsparse_fill_mode_lower)
         {
-            csrsv = info->csrsv_lower_info;
+            target = &info->csrsv_lower_info;
+        }
+        else
+        {
+            target = &info->csrsv_upper_info;
+        }
+    }
+
+    rocsparse_csrtr_info csrsv = *target;
+
+    // Fall back to the meta data of the multicolor reordered matrix, whose zero
+    // pivot is reported with respect to the original matrix
+    if(csrsv == nullptr && info->reorder_info != nullptr)
+    {
+        rocsparse_reorder_info reorder = info->reorder_info;
+        rocsparse_mat_info reordered   = reorder->info;
+
+        if(descr == nullptr)
+        {
+            target = (reordered->csrsv_lower_info != nullptr) ? &reordered->csrsv_lower_info
+                                                              : &reordered->csrsv_upper_info;
         }
         else
         {
-            csrsv = info->csrsv_upper_info;
+            target = (descr->fill_mode == rocsparse_fill_mode_lower)
+                         ? &reordered->csrsv_lower_info
+                         : &reordered->csrsv_upper_info;
+        }
+
+        if(*target != nullptr)
+        {
+            return rocsparse_reorder_zero_pivot(
+                handle, reorder, rocsparse_zero_pivot(reordered, target), position);
         }
     }
 
@@ -296,6 +479,9 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
         return rocsparse_status_success;
     }
 
+    // Zero pivot of the last solve of this matrix
+    const rocsparse_int* zero_pivot = rocsparse_zero_pivot(info, target);
+
     // Differentiate between pointer modes
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
@@ -303,7 +489,7 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
         rocsparse_int pivot;
 
         RETURN_IF_HIP_ERROR(
-            hipMemcpy(&pivot, csrsv->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            hipMemcpy(&pivot, zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
 
         if(pivot == std::numeric_limits<rocsparse_int>::max())
         {
@@ -311,8 +497,8 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMemcpy(
-                position, csrsv->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToDevice));
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(position, zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToDevice));
 
             return rocsparse_status_zero_pivot;
         }
@@ -321,7 +507,7 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
     {
         // rocsparse_pointer_mode_host
         RETURN_IF_HIP_ERROR(
-            hipMemcpy(position, csrsv->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            hipMemcpy(position, zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
 
         // If no zero pivot is found, set -1
         if(*position == std::numeric_limits<rocsparse_int>::max())
@@ -336,3 +522,47 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle handle,
 
     return rocsparse_status_success;
 }
+
+extern "C" rocsparse_status rocsparse_csrsv_convergence(rocsparse_handle handle,
+                                                        const rocsparse_mat_descr descr,
+                                                        rocsparse_mat_info info,
+                                                        double* history)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrsv_convergence",
+              (const void*&)descr,
+              (const void*&)info,
+              (const void*&)history);
+
+    // Check pointer arguments
+    if(history == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Lower triangular sweeps follow the csrilu0 sweeps, upper triangular sweeps follow
+    // the lower ones
+    rocsparse_int offset = info->csrilu0_sweeps;
+
+    if(descr->fill_mode == rocsparse_fill_mode_upper)
+    {
+        offset += info->csrsv_sweeps;
+    }
+
+    return rocsparse_iterative_convergence(handle, info, offset, info->csrsv_sweeps, history);
+}
@@ -29,9 +29,14 @@
 #include "definitions.h"
 #include "handle.h"
 #include "utility.h"
+#include "capture.h"
 #include "csrsv_device.h"
+#include "csrsv_iterative_device.h"
+#include "../reorder/rocsparse_reorder.hpp"
 
+#include <cmath>
 #include <limits>
+#include <vector>
 #include <hip/hip_runtime.h>
 #include <hipcub/hipcub.hpp>
 
@@ -85,6 +90,12 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle handle,
         return rocsparse_status_not_implemented;
     }
 
+    // Check operation, only the non-transposed system is supported
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     // Check sizes
     if(m < 0)
     {
@@ -192,14 +203,14 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle handle,
     // hipcub buffer
     void* hipcub_buffer = reinterpret_cast<void*>(ptr);
 
-    // Allocate buffer to hold diagonal entry point
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->csr_diag_ind, sizeof(rocsparse_int) * m));
+    // Allocate a single buffer to hold row map, diagonal entry points and structural zero
+    // pivot
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_malloc_memory(
+        handle, (void**)&info->d_row_map, sizeof(rocsparse_int) * (2 * m + 2)));
+    info->allocator = handle->allocator;
 
-    // Allocate buffer to hold zero pivot
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->zero_pivot, sizeof(rocsparse_int)));
-
-    // Allocate buffer to hold row map
-    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->d_row_map, sizeof(rocsparse_int) * (m + 1)));
+    info->csr_diag_ind     = info->d_row_map + m + 1;
+    info->structural_pivot = info->csr_diag_ind + m;
 
     // Allocate host buffer to hold row map
     RETURN_IF_HIP_ERROR(hipHostMalloc((void**)&info->h_row_map, sizeof(rocsparse_int) * (m + 1)));
@@ -210,7 +221,7 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle handle,
     // Initialize zero pivot
     rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
     RETURN_IF_HIP_ERROR(
-        hipMemcpy(info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+        hipMemcpy(info->structural_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice));
 
 // Run analysis
 #define CSRILU0_DIM 1024
@@ -236,7 +247,7 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle handle,
                                d_max_depth,
                                d_total_spin,
                                d_max_nnz,
-                               info->zero_pivot,
+                               info->structural_pivot,
                                descr->base);
         }
         else if(descr->fill_mode == rocsparse_fill_mode_lower)
@@ -255,7 +266,7 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle handle,
                                d_max_depth,
                                d_total_spin,
                                d_max_nnz,
-                               info->zero_pivot,
+                               info->structural_pivot,
                                descr->base);
         }
     }
@@ -277,7 +288,7 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle handle,
                                d_max_depth,
                                d_total_spin,
                                d_max_nnz,
-                               info->zero_pivot,
+                               info->structural_pivot,
                                descr->base);
         }
         else if(descr->fill_mode == rocsparse_fill_mode_lower)
@@ -296,7 +307,7 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle handle,
                                d_max_depth,
                                d_total_spin,
                                d_max_nnz,
-                               info->zero_pivot,
+                               info->structural_pivot,
                                descr->base);
         }
     }
@@ -352,12 +363,236 @@ static rocsparse_status rocsparse_csrtr_analysis(rocsparse_handle handle,
                                        hipMemcpyHostToDevice,
                                        stream));
 
-    // Store some pointers to verify correct execution
-    info->m           = m;
-    info->nnz         = nnz;
-    info->descr       = descr;
-    info->csr_row_ptr = csr_row_ptr;
-    info->csr_col_ind = csr_col_ind;
+    // Store some data to verify correct execution
+    info->m         = m;
+    info->nnz       = nnz;
+    info->fill_mode = descr->fill_mode;
+
+    return rocsparse_status_success;
+}
+
+// Zero pivot of the given analysis data of a matrix info. Analysis data is shared between
+// matrices of identical sparsity pattern, thus numerical zero pivots are stored per matrix
+// info, in the order csrilu0, lower and upper triangular solve.
+static rocsparse_int* rocsparse_zero_pivot(rocsparse_mat_info info,
+                                           const rocsparse_csrtr_info* target)
+{
+    if(target == &info->csrilu0_info)
+    {
+        return info->zero_pivot;
+    }
+
+    return info->zero_pivot + ((target == &info->csrsv_lower_info) ? 1 : 2);
+}
+
+// Reset the zero pivot of the given analysis data to its structural zero pivot, or to no
+// zero pivot for unit diagonals. This is done at the start of every factorization and solve,
+// such that only zero pivots of the current values are reported.
+static rocsparse_status rocsparse_reset_zero_pivot(rocsparse_handle handle,
+                                                   rocsparse_mat_info info,
+                                                   const rocsparse_csrtr_info* target,
+                                                   rocsparse_diag_type diag_type)
+{
+    rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
+
+    if(info->zero_pivot == nullptr)
+    {
+        rocsparse_int none[3] = {max, max, max};
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_malloc_memory(
+            handle, (void**)&info->zero_pivot, sizeof(rocsparse_int) * 3));
+
+        info->zero_pivot_allocator = handle->allocator;
+
+        RETURN_IF_HIP_ERROR(hipMemcpy(
+            info->zero_pivot, none, sizeof(rocsparse_int) * 3, hipMemcpyHostToDevice));
+    }
+
+    rocsparse_int* zero_pivot = rocsparse_zero_pivot(info, target);
+
+    if(diag_type == rocsparse_diag_type_unit)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(zero_pivot,
+                                           (*target)->structural_pivot,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           handle->stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+// Validate the sparsity pattern of the matrix against the pattern of its analysis data.
+// The fingerprint is only re-computed if the arrays have been moved since the last call,
+// or on every call with rocsparse_pattern_check_always.
+static rocsparse_status rocsparse_csrtr_check_pattern(rocsparse_handle handle,
+                                                      rocsparse_int m,
+                                                      rocsparse_int nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      rocsparse_mat_info info,
+                                                      const rocsparse_pattern_key& key)
+{
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_update_pattern_key(
+        handle, info, m, m, nnz, descr->base, csr_row_ptr, csr_col_ind, false));
+
+    return (info->pattern == key) ? rocsparse_status_success : rocsparse_status_invalid_pointer;
+}
+
+static rocsparse_status rocsparse_csrtr_analysis_reuse(rocsparse_handle handle,
+                                                       rocsparse_operation trans,
+                                                       rocsparse_int m,
+                                                       rocsparse_int nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_int* csr_row_ptr,
+                                                       const rocsparse_int* csr_col_ind,
+                                                       rocsparse_mat_info info,
+                                                       rocsparse_csrtr_info* target,
+                                                       rocsparse_analysis_policy analysis,
+                                                       void* temp_buffer)
+{
+    // Fingerprint of the sparsity pattern
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_update_pattern_key(
+        handle, info, m, m, nnz, descr->base, csr_row_ptr, csr_col_ind, true));
+
+    // Differentiate the analysis policies
+    if(analysis == rocsparse_analysis_policy_reuse)
+    {
+        // We try to re-use already analyzed data of a matrix with identical
+        // sparsity pattern and fill mode, independent of where it is stored.
+
+        // If meta data is already available, do nothing
+        if(*target != nullptr && (*target)->key == info->pattern &&
+           (*target)->fill_mode == descr->fill_mode)
+        {
+            return rocsparse_reset_zero_pivot(handle, info, target, rocsparse_diag_type_non_unit);
+        }
+
+        // Check for other meta data of this matrix info
+        rocsparse_csrtr_info candidates[] = {
+            info->csrilu0_info, info->csrsv_lower_info, info->csrsv_upper_info};
+        rocsparse_csrtr_info reuse = nullptr;
+
+        for(rocsparse_csrtr_info candidate : candidates)
+        {
+            if(candidate != nullptr && candidate->key == info->pattern &&
+               candidate->fill_mode == descr->fill_mode)
+            {
+                reuse = candidate;
+                ++reuse->use_count;
+                break;
+            }
+        }
+
+        // Check for meta data of other matrix info structures
+        if(reuse == nullptr)
+        {
+            reuse = rocsparse_find_csrtr_info(handle, info->pattern, descr->fill_mode);
+        }
+
+        // If data has been found, use it
+        if(reuse != nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(*target));
+            *target = reuse;
+
+            return rocsparse_reset_zero_pivot(handle, info, target, rocsparse_diag_type_non_unit);
+        }
+    }
+
+    // User is explicitly asking to force a re-analysis, or no valid data has been
+    // found to be re-used.
+
+    // Clear info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(*target));
+    *target = nullptr;
+
+    // Create info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(target));
+
+    // Perform analysis
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(
+        handle, trans, m, nnz, descr, csr_row_ptr, csr_col_ind, *target, temp_buffer));
+
+    (*target)->key = info->pattern;
+
+    // Share analysis data with other matrix info structures
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_cache_csrtr_info(handle, *target));
+
+    // Until the first factorization or solve, the structural zero pivot is reported
+    return rocsparse_reset_zero_pivot(handle, info, target, rocsparse_diag_type_non_unit);
+}
+
+// Sweep history of the iterative solve policy. It holds the squared update and solution
+// norms of each sweep of the last csrilu0, lower and upper triangular solve, in this order.
+static rocsparse_status
+    rocsparse_iterative_history(rocsparse_handle handle, rocsparse_mat_info info, double** history)
+{
+    if(info->iterative_history == nullptr)
+    {
+        size_t size = sizeof(double) * 2 * (info->csrilu0_sweeps + 2 * info->csrsv_sweeps);
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_device_malloc_memory(handle, (void**)&info->iterative_history, size));
+
+        info->iterative_allocator = handle->allocator;
+
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(info->iterative_history, 0, size, handle->stream));
+    }
+
+    *history = info->iterative_history;
+
+    return rocsparse_status_success;
+}
+
+// Relative update norms ||x_k - x_{k-1}|| / ||x_k|| of the given sweeps of the history
+static rocsparse_status rocsparse_iterative_convergence(rocsparse_handle handle,
+                                                       rocsparse_mat_info info,
+                                                       rocsparse_int offset,
+                                                       rocsparse_int sweeps,
+                                                       double* convergence)
+{
+    std::vector<double> hnorms(2 * sweeps, 0.0);
+    std::vector<double> hconvergence(sweeps, 0.0);
+
+    // Without iterative computation, the history remains zero
+    if(info->iterative_history != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(hnorms.data(),
+                                      info->iterative_history + 2 * offset,
+                                      sizeof(double) * 2 * sweeps,
+                                      hipMemcpyDeviceToHost));
+    }
+
+    for(rocsparse_int i = 0; i < sweeps; ++i)
+    {
+        double delta = hnorms[2 * i];
+        double norm  = hnorms[2 * i + 1];
+
+        hconvergence[i] = (norm > 0.0) ? std::sqrt(delta / norm) : std::sqrt(delta);
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(convergence,
+                                      hconvergence.data(),
+                                      sizeof(double) * sweeps,
+                                      hipMemcpyHostToDevice));
+    }
+    else
+    {
+        for(rocsparse_int i = 0; i < sweeps; ++i)
+        {
+            convergence[i] = hconvergence[i];
+        }
+    }
 
     return rocsparse_status_success;
 }
@@ -418,6 +653,12 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle handle,
         return rocsparse_status_not_implemented;
     }
 
+    // Check operation, only the non-transposed system is supported
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
     // Check analysis policy
     if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force)
     {
@@ -425,7 +666,8 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle handle,
     }
 
     // Check solve policy
-    if(solve != rocsparse_solve_policy_auto)
+    if(solve != rocsparse_solve_policy_auto && solve != rocsparse_solve_policy_multicolor &&
+       solve != rocsparse_solve_policy_iterative)
     {
         return rocsparse_status_invalid_value;
     }
@@ -458,90 +700,63 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsrsv_analysis",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    m,
+                                    nnz,
+                                    sizeof(rocsparse_int) * (m + 1 + nnz));
+
     // Quick return if possible
     if(m == 0 || nnz == 0)
     {
         return rocsparse_status_success;
     }
 
-    // Switch between lower and upper triangular analysis
-    if(descr->fill_mode == rocsparse_fill_mode_upper)
+    // Multicolor policy analyses the reordered matrix
+    if(solve == rocsparse_solve_policy_multicolor)
     {
-        // This is currently the only case where we need upper triangular analysis,
-        // therefore we ignore the analysis policy
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_reorder_analysis(
+            handle, m, nnz, descr, csr_row_ptr, csr_col_ind, info));
+
+        rocsparse_reorder_info reorder = info->reorder_info;
+
+        rocsparse_csrtr_info* target = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                           ? &reorder->info->csrsv_upper_info
+                                           : &reorder->info->csrsv_lower_info;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis_reuse(handle,
+                                                                 trans,
+                                                                 m,
+                                                                 nnz,
+                                                                 descr,
+                                                                 reorder->csr_row_ptr,
+                                                                 reorder->csr_col_ind,
+                                                                 reorder->info,
+                                                                 target,
+                                                                 analysis,
+                                                                 temp_buffer));
 
-        // Clear csrsv info
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_upper_info));
-
-        // Create csrsv info
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csrsv_upper_info));
-
-        // Perform analysis
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(handle,
-                                                           trans,
-                                                           m,
-                                                           nnz,
-                                                           descr,
-                                                           csr_row_ptr,
-                                                           csr_col_ind,
-                                                           info->csrsv_upper_info,
-                                                           temp_buffer));
+        return rocsparse_status_success;
     }
-    else
-    {
-        // Differentiate the analysis policies
-        if(analysis == rocsparse_analysis_policy_reuse)
-        {
-            // We try to re-use already analyzed lower part, if available.
-            // It is the user's responsibility that this data is still valid,
-            // since he passed the 'reuse' flag.
-
-            // If csrsv meta data is already available, do nothing
-            if(info->csrsv_lower_info != nullptr)
-            {
-                return rocsparse_status_success;
-            }
-
-            // Check for other lower analysis meta data
-            rocsparse_csrtr_info reuse = nullptr;
 
-            // csrilu0 meta data
-            if(info->csrilu0_info != nullptr)
-            {
-                reuse = info->csrilu0_info;
-            }
-
-            // TODO add more crossover data here
-
-            // If data has been found, use it
-            if(reuse != nullptr)
-            {
-                info->csrsv_lower_info = reuse;
-
-                return rocsparse_status_success;
-            }
-        }
-
-        // User is explicitly asking to force a re-analysis, or no valid data has been
-        // found to be re-used.
-
-        // Clear csrsv info
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
-
-        // Create csrsv info
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csrsv_lower_info));
-
-        // Perform analysis
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(handle,
-                                                           trans,
-                                                           m,
-                                                           nnz,
-                                                           descr,
-                                                           csr_row_ptr,
-                                                           csr_col_ind,
-                                                           info->csrsv_lower_info,
-                                                           temp_buffer));
-    }
+    // Switch between lower and upper triangular analysis
+    rocsparse_csrtr_info* target = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                       ? &info->csrsv_upper_info
+                                       : &info->csrsv_lower_info;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis_reuse(handle,
+                                                             trans,
+                                                             m,
+                                                             nnz,
+                                                             descr,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             info,
+                                                             target,
+                                                             analysis,
+                                                             temp_buffer));
 
     return rocsparse_status_success;
 }
@@ -612,6 +827,116 @@ __launch_bounds__(BLOCKSIZE) __global__
                                         diag_type);
 }
 
+template <typename T>
+rocsparse_status rocsparse_csrsv_iterative_solve(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                const T* alpha,
+                                                const rocsparse_mat_descr descr,
+                                                const T* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_mat_info info,
+                                                const T* x,
+                                                T* y)
+{
+    rocsparse_csrtr_info* target = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                       ? &info->csrsv_upper_info
+                                       : &info->csrsv_lower_info;
+
+    // Analysis has to be performed before the solve
+    if(*target == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Re-initialize zero pivot, unit diagonals remove structural zeros
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_reset_zero_pivot(handle, info, target, descr->diag_type));
+
+    rocsparse_int* zero_pivot = rocsparse_zero_pivot(info, target);
+
+    // Sweep history of this fill mode
+    double* history;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_iterative_history(handle, info, &history));
+
+    rocsparse_int sweeps = info->csrsv_sweeps;
+
+    history += 2 * info->csrilu0_sweeps;
+    history += (descr->fill_mode == rocsparse_fill_mode_upper) ? 2 * sweeps : 0;
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(history, 0, sizeof(double) * 2 * sweeps, stream));
+
+    // Double buffered iterates, starting from y = 0
+    rocsparse_workspace_scope workspace_scope(handle);
+
+    T* buffer[2];
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_workspace_malloc(handle, (void**)&buffer[0], sizeof(T) * m));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_workspace_malloc(handle, (void**)&buffer[1], sizeof(T) * m));
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(buffer[0], 0, sizeof(T) * m, stream));
+
+#define CSRSV_ITERATIVE_DIM 256
+    dim3 csrsv_blocks((m - 1) / CSRSV_ITERATIVE_DIM + 1);
+    dim3 csrsv_threads(CSRSV_ITERATIVE_DIM);
+
+    for(rocsparse_int sweep = 0; sweep < sweeps; ++sweep)
+    {
+        // The last sweep writes the result
+        const T* y_old = buffer[sweep & 1];
+        T*       y_new = (sweep == sweeps - 1) ? y : buffer[(sweep + 1) & 1];
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((csrsv_iterative_device_pointer<T, CSRSV_ITERATIVE_DIM>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y_old,
+                               y_new,
+                               zero_pivot,
+                               history + 2 * sweep,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrsv_iterative_host_pointer<T, CSRSV_ITERATIVE_DIM>),
+                               csrsv_blocks,
+                               csrsv_threads,
+                               0,
+                               stream,
+                               m,
+                               *alpha,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               csr_val,
+                               x,
+                               y_old,
+                               y_new,
+                               zero_pivot,
+                               history + 2 * sweep,
+                               descr->base,
+                               descr->fill_mode,
+                               descr->diag_type);
+        }
+    }
+#undef CSRSV_ITERATIVE_DIM
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle handle,
                                                 rocsparse_operation trans,
@@ -661,10 +986,14 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle handle,
                   policy,
                   (const void*&)temp_buffer);
 
+        std::string mtx = rocsparse_capture_csr(
+            handle, "csrsv", m, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind);
+
         log_bench(handle,
                   "./rocsparse-bench -f csrsv -r",
                   replaceX<T>("X"),
-                  "--mtx <matrix.mtx> ",
+                  "--mtx",
+                  mtx,
                   "--alpha",
                   *alpha);
     }
@@ -698,6 +1027,19 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle handle,
         return rocsparse_status_not_implemented;
     }
 
+    // Check operation, only the non-transposed system is supported
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto && policy != rocsparse_solve_policy_multicolor &&
+       policy != rocsparse_solve_policy_iterative)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
     // Check sizes
     if(m < 0)
     {
@@ -738,12 +1080,90 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsrsv",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    m,
+                                    nnz,
+                                    (sizeof(T) + sizeof(rocsparse_int)) * nnz +
+                                        sizeof(rocsparse_int) * (m + 1) + 2 * sizeof(T) * m);
+
     // Quick return if possible
     if(m == 0 || nnz == 0)
     {
         return rocsparse_status_success;
     }
 
+    // Multicolor policy solves with the reordered matrix, P * A * P^T * P * y = P * x
+    if(policy == rocsparse_solve_policy_multicolor)
+    {
+        rocsparse_reorder_info reorder = info->reorder_info;
+
+        // Reordering has to be computed by the analysis
+        if(reorder == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_check_pattern(
+            handle, m, nnz, descr, csr_row_ptr, csr_col_ind, info, reorder->key));
+
+        rocsparse_workspace_scope workspace_scope(handle);
+
+        T* csr_val_B;
+        T* x_B;
+        T* y_B;
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_workspace_malloc(handle, (void**)&csr_val_B, sizeof(T) * nnz));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(handle, (void**)&x_B, sizeof(T) * m));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(handle, (void**)&y_B, sizeof(T) * m));
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_reorder_gather(handle, nnz, reorder->map, csr_val, csr_val_B));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_reorder_gather(handle, m, reorder->perm, x, x_B));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_solve_template(handle,
+                                                                 trans,
+                                                                 m,
+                                                                 nnz,
+                                                                 alpha,
+                                                                 descr,
+                                                                 csr_val_B,
+                                                                 reorder->csr_row_ptr,
+                                                                 reorder->csr_col_ind,
+                                                                 reorder->info,
+                                                                 x_B,
+                                                                 y_B,
+                                                                 rocsparse_solve_policy_auto,
+                                                                 temp_buffer));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_reorder_scatter(handle, m, reorder->perm, y_B, y));
+
+        return rocsparse_status_success;
+    }
+
+    rocsparse_csrtr_info csrtr = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                     ? info->csrsv_upper_info
+                                     : info->csrsv_lower_info;
+
+    // Analysis has to be performed before the solve
+    if(csrtr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_check_pattern(
+        handle, m, nnz, descr, csr_row_ptr, csr_col_ind, info, csrtr->key));
+
+    // Iterative policy approximates the solution by a fixed number of Jacobi sweeps
+    if(policy == rocsparse_solve_policy_iterative)
+    {
+        return rocsparse_csrsv_iterative_solve(
+            handle, m, alpha, descr, csr_val, csr_row_ptr, csr_col_ind, info, x, y);
+    }
+
     // Stream
     hipStream_t stream = handle->stream;
 
@@ -760,17 +1180,16 @@ rocsparse_status rocsparse_csrsv_solve_template(rocsparse_handle handle,
     // Initialize buffers
     RETURN_IF_HIP_ERROR(hipMemsetAsync(d_done_array, 0, sizeof(rocsparse_int) * m, stream));
 
-    rocsparse_csrtr_info csrsv = (descr->fill_mode == rocsparse_fill_mode_upper)
-                                     ? info->csrsv_upper_info
-                                     : info->csrsv_lower_info;
+    rocsparse_csrtr_info* target = (descr->fill_mode == rocsparse_fill_mode_upper)
+                                       ? &info->csrsv_upper_info
+                                       : &info->csrsv_lower_info;
 
-    // If diag type is unit, re-initialize zero pivot to remove structural zeros
-    if(descr->diag_type == rocsparse_diag_type_unit)
-    {
-        rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
-        RETURN_IF_HIP_ERROR(
-            hipMemcpy(csrsv->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice));
-    }
+    rocsparse_csrtr_info csrsv = *target;
+
+    // Re-initialize zero pivot, unit diagonals remove structural zeros
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_reset_zero_pivot(handle, info, target, descr->diag_type));
+
+    rocsparse_int* zero_pivot = rocsparse_zero_pivot(info, target);
 
 /*
 #define CSRSV_DIM 1024
@@ -815,7 +1234,7 @@ CSRSV_DIM + 1);
                                        d_done_array,
                                        csrsv->d_row_map,
                                        depth_offset,
-                                       csrsv->zero_pivot,
+                                       zero_pivot,
                                        descr->base,
                                        descr->fill_mode,
                                        descr->diag_type);
@@ -837,7 +1256,7 @@ CSRSV_DIM + 1);
                                        d_done_array,
                                        csrsv->d_row_map,
                                        depth_offset,
-                                       csrsv->zero_pivot,
+                                       zero_pivot,
                                        descr->base,
                                        descr->fill_mode,
                                        descr->diag_type);
@@ -867,7 +1286,7 @@ CSRSV_DIM + 1);
                                        d_done_array,
                                        csrsv->d_row_map,
                                        depth_offset,
-                                       csrsv->zero_pivot,
+                                       zero_pivot,
                                        descr->base,
                                        descr->fill_mode,
                                        descr->diag_type);
@@ -889,7 +1308,7 @@ CSRSV_DIM + 1);
                                        d_done_array,
                                        csrsv->d_row_map,
                                        depth_offset,
-                                       csrsv->zero_pivot,
+                                       zero_pivot,
                                        descr->base,
                                        descr->fill_mode,
                                        descr->diag_type);
@@ -930,7 +1349,7 @@ CSRSV_DIM + 1);
                                    d_done_array,
                                    csrsv->d_row_map,
                                    depth_offset,
-                                   csrsv->zero_pivot,
+                                   zero_pivot,
                                    descr->base,
                                    descr->fill_mode,
                                    descr->diag_type);
@@ -952,7 +1371,7 @@ CSRSV_DIM + 1);
                                    d_done_array,
                                    csrsv->d_row_map,
                                    depth_offset,
-                                   csrsv->zero_pivot,
+                                   zero_pivot,
                                    descr->base,
                                    descr->fill_mode,
                                    descr->diag_type);
@@ -982,7 +1401,7 @@ CSRSV_DIM + 1);
                                    d_done_array,
                                    csrsv->d_row_map,
                                    depth_offset,
-                                   csrsv->zero_pivot,
+                                   zero_pivot,
                                    descr->base,
                                    descr->fill_mode,
                                    descr->diag_type);
@@ -1004,7 +1423,7 @@ CSRSV_DIM + 1);
                                    d_done_array,
                                    csrsv->d_row_map,
                                    depth_offset,
-                                   csrsv->zero_pivot,
+                                   zero_pivot,
                                    descr->base,
                                    descr->fill_mode,
                                    descr->diag_type);
@@ -1041,7 +1460,7 @@ CSRSV_DIM + 1);
                                d_done_array,
                                csrsv->d_row_map,
                                0,
-                               csrsv->zero_pivot,
+                               zero_pivot,
                                descr->base,
                                descr->fill_mode,
                                descr->diag_type);
@@ -1063,7 +1482,7 @@ CSRSV_DIM + 1);
                                d_done_array,
                                csrsv->d_row_map,
                                0,
-                               csrsv->zero_pivot,
+                               zero_pivot,
                                descr->base,
                                descr->fill_mode,
                                descr->diag_type);
@@ -1093,7 +1512,7 @@ CSRSV_DIM + 1);
                                d_done_array,
                                csrsv->d_row_map,
                                0,
-                               csrsv->zero_pivot,
+                               zero_pivot,
                                descr->base,
                                descr->fill_mode,
                                descr->diag_type);
@@ -1115,7 +1534,7 @@ CSRSV_DIM + 1);
                                d_done_array,
                                csrsv->d_row_map,
                                0,
-                               csrsv->zero_pivot,
+                               zero_pivot,
                                descr->base,
                                descr->fill_mode,
                                descr->diag_type);
@@ -63,3 +63,71 @@ extern "C" rocsparse_status rocsparse_dellmv(rocsparse_handle handle,
     return rocsparse_ellmv_template<double>(
         handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
 }
+
+extern "C" rocsparse_status rocsparse_cellmv(rocsparse_handle handle,
+                                             rocsparse_operation trans,
+                                             rocsparse_int m,
+                                             rocsparse_int n,
+                                             const rocsparse_float_complex* alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_float_complex* ell_val,
+                                             const rocsparse_int* ell_col_ind,
+                                             rocsparse_int ell_width,
+                                             const rocsparse_float_complex* x,
+                                             const rocsparse_float_complex* beta,
+                                             rocsparse_float_complex* y)
+{
+    return rocsparse_ellmv_template<rocsparse_float_complex>(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
+extern "C" rocsparse_status rocsparse_zellmv(rocsparse_handle handle,
+                                             rocsparse_operation trans,
+                                             rocsparse_int m,
+                                             rocsparse_int n,
+                                             const rocsparse_double_complex* alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_double_complex* ell_val,
+                                             const rocsparse_int* ell_col_ind,
+                                             rocsparse_int ell_width,
+                                             const rocsparse_double_complex* x,
+                                             const rocsparse_double_complex* beta,
+                                             rocsparse_double_complex* y)
+{
+    return rocsparse_ellmv_template<rocsparse_double_complex>(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
+extern "C" rocsparse_status rocsparse_hellmv(rocsparse_handle handle,
+                                             rocsparse_operation trans,
+                                             rocsparse_int m,
+                                             rocsparse_int n,
+                                             const float* alpha,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_half* ell_val,
+                                             const rocsparse_int* ell_col_ind,
+                                             rocsparse_int ell_width,
+                                             const float* x,
+                                             const float* beta,
+                                             float* y)
+{
+    return rocsparse_ellmv_template<float>(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
+
+extern "C" rocsparse_status rocsparse_bfellmv(rocsparse_handle handle,
+                                              rocsparse_operation trans,
+                                              rocsparse_int m,
+                                              rocsparse_int n,
+                                              const float* alpha,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_bfloat16* ell_val,
+                                              const rocsparse_int* ell_col_ind,
+                                              rocsparse_int ell_width,
+                                              const float* x,
+                                              const float* beta,
+                                              float* y)
+{
+    return rocsparse_ellmv_template<float>(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
+}
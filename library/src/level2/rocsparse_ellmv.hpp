@@ -29,48 +29,240 @@
 #include "definitions.h"
 #include "handle.h"
 #include "utility.h"
+#include "capture.h"
 #include "ellmv_device.h"
 
 #include <hip/hip_runtime.h>
 
-template <typename T>
+template <typename T, typename U>
 __global__ void ellmvn_kernel_host_pointer(rocsparse_int m,
                                            rocsparse_int n,
                                            rocsparse_int ell_width,
                                            T alpha,
                                            const rocsparse_int* __restrict__ ell_col_ind,
-                                           const T* __restrict__ ell_val,
+                                           const U* __restrict__ ell_val,
                                            const T* __restrict__ x,
                                            T beta,
                                            T* __restrict__ y,
                                            rocsparse_index_base idx_base)
 {
-    ellmvn_device(m, n, ell_width, alpha, ell_col_ind, ell_val, x, beta, y, idx_base);
+    ellmvn_device<T, U>(m, n, ell_width, alpha, ell_col_ind, ell_val, x, beta, y, idx_base);
 }
 
-template <typename T>
+template <typename T, typename U>
 __global__ void ellmvn_kernel_device_pointer(rocsparse_int m,
                                              rocsparse_int n,
                                              rocsparse_int ell_width,
                                              const T* alpha,
                                              const rocsparse_int* __restrict__ ell_col_ind,
-                                             const T* __restrict__ ell_val,
+                                             const U* __restrict__ ell_val,
                                              const T* __restrict__ x,
                                              const T* beta,
                                              T* __restrict__ y,
                                              rocsparse_index_base idx_base)
 {
-    ellmvn_device(m, n, ell_width, *alpha, ell_col_ind, ell_val, x, *beta, y, idx_base);
+    ellmvn_device<T, U>(m, n, ell_width, *alpha, ell_col_ind, ell_val, x, *beta, y, idx_base);
 }
 
 template <typename T>
+__global__ void ellmvt_scale_kernel_host_pointer(rocsparse_int size, T beta, T* __restrict__ y)
+{
+    ellmvt_scale_device<T>(size, beta, y);
+}
+
+template <typename T>
+__global__ void
+ellmvt_scale_kernel_device_pointer(rocsparse_int size, const T* beta, T* __restrict__ y)
+{
+    if(*beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    ellmvt_scale_device<T>(size, *beta, y);
+}
+
+template <typename T, typename U>
+__global__ void ellmvt_kernel_host_pointer(rocsparse_operation trans,
+                                           rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int ell_width,
+                                           T alpha,
+                                           const rocsparse_int* __restrict__ ell_col_ind,
+                                           const U* __restrict__ ell_val,
+                                           const T* __restrict__ x,
+                                           T* __restrict__ y,
+                                           rocsparse_index_base idx_base)
+{
+    ellmvt_device<T, U>(trans, m, n, ell_width, alpha, ell_col_ind, ell_val, x, y, idx_base);
+}
+
+template <typename T, typename U>
+__global__ void ellmvt_kernel_device_pointer(rocsparse_operation trans,
+                                             rocsparse_int m,
+                                             rocsparse_int n,
+                                             rocsparse_int ell_width,
+                                             const T* alpha,
+                                             const rocsparse_int* __restrict__ ell_col_ind,
+                                             const U* __restrict__ ell_val,
+                                             const T* __restrict__ x,
+                                             T* __restrict__ y,
+                                             rocsparse_index_base idx_base)
+{
+    ellmvt_device<T, U>(trans, m, n, ell_width, *alpha, ell_col_ind, ell_val, x, y, idx_base);
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_ellmv_dispatch(rocsparse_handle handle,
+                                          rocsparse_operation trans,
+                                          rocsparse_int m,
+                                          rocsparse_int n,
+                                          const T* alpha,
+                                          const rocsparse_mat_descr descr,
+                                          const U* ell_val,
+                                          const rocsparse_int* ell_col_ind,
+                                          rocsparse_int ell_width,
+                                          const T* x,
+                                          const T* beta,
+                                          T* y)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Run different ellmv kernels
+    if(trans == rocsparse_operation_none)
+    {
+#define ELLMVN_DIM 512
+        dim3 ellmvn_blocks((m - 1) / ELLMVN_DIM + 1);
+        dim3 ellmvn_threads(ELLMVN_DIM);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            hipLaunchKernelGGL((ellmvn_kernel_device_pointer<T, U>),
+                               ellmvn_blocks,
+                               ellmvn_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               ell_width,
+                               alpha,
+                               ell_col_ind,
+                               ell_val,
+                               x,
+                               beta,
+                               y,
+                               descr->base);
+        }
+        else
+        {
+            if(*alpha == 0.0 && *beta == 1.0)
+            {
+                return rocsparse_status_success;
+            }
+
+            hipLaunchKernelGGL((ellmvn_kernel_host_pointer<T, U>),
+                               ellmvn_blocks,
+                               ellmvn_threads,
+                               0,
+                               stream,
+                               m,
+                               n,
+                               ell_width,
+                               *alpha,
+                               ell_col_ind,
+                               ell_val,
+                               x,
+                               *beta,
+                               y,
+                               descr->base);
+        }
+#undef ELLMVN_DIM
+    }
+    else
+    {
+#define ELLMVT_DIM 512
+        dim3 ellmvt_blocks((m - 1) / ELLMVT_DIM + 1);
+        dim3 ellmvt_threads(ELLMVT_DIM);
+        dim3 ellmvt_scale_blocks((n - 1) / ELLMVT_DIM + 1);
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            // Scale y with beta
+            hipLaunchKernelGGL((ellmvt_scale_kernel_device_pointer<T>),
+                               ellmvt_scale_blocks,
+                               ellmvt_threads,
+                               0,
+                               stream,
+                               n,
+                               beta,
+                               y);
+
+            hipLaunchKernelGGL((ellmvt_kernel_device_pointer<T, U>),
+                               ellmvt_blocks,
+                               ellmvt_threads,
+                               0,
+                               stream,
+                               trans,
+                               m,
+                               n,
+                               ell_width,
+                               alpha,
+                               ell_col_ind,
+                               ell_val,
+                               x,
+                               y,
+                               descr->base);
+        }
+        else
+        {
+            if(*alpha == static_cast<T>(0) && *beta == static_cast<T>(1))
+            {
+                return rocsparse_status_success;
+            }
+
+            // Scale y with beta
+            if(*beta != static_cast<T>(1))
+            {
+                hipLaunchKernelGGL((ellmvt_scale_kernel_host_pointer<T>),
+                                   ellmvt_scale_blocks,
+                                   ellmvt_threads,
+                                   0,
+                                   stream,
+                                   n,
+                                   *beta,
+                                   y);
+            }
+
+            hipLaunchKernelGGL((ellmvt_kernel_host_pointer<T, U>),
+                               ellmvt_blocks,
+                               ellmvt_threads,
+                               0,
+                               stream,
+                               trans,
+                               m,
+                               n,
+                               ell_width,
+                               *alpha,
+                               ell_col_ind,
+                               ell_val,
+                               x,
+                               y,
+                               descr->base);
+        }
+#undef ELLMVT_DIM
+    }
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
 rocsparse_status rocsparse_ellmv_template(rocsparse_handle handle,
                                           rocsparse_operation trans,
                                           rocsparse_int m,
                                           rocsparse_int n,
                                           const T* alpha,
                                           const rocsparse_mat_descr descr,
-                                          const T* ell_val,
+                                          const U* ell_val,
                                           const rocsparse_int* ell_col_ind,
                                           rocsparse_int ell_width,
                                           const T* x,
@@ -91,7 +283,7 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xellmv"),
+                  replaceX<U>("rocsparse_Xellmv"),
                   trans,
                   m,
                   n,
@@ -104,10 +296,14 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle handle,
                   *beta,
                   (const void*&)y);
 
+        std::string mtx = rocsparse_capture_ell(
+            handle, "ellmv", m, n, descr, ell_val, ell_col_ind, ell_width);
+
         log_bench(handle,
                   "./rocsparse-bench -f ellmv -r",
-                  replaceX<T>("X"),
-                  "--mtx <matrix.mtx> "
+                  replaceX<U>("X"),
+                  "--mtx",
+                  mtx,
                   "--alpha",
                   *alpha,
                   "--beta",
@@ -116,7 +312,7 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle handle,
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xellmv"),
+                  replaceX<U>("rocsparse_Xellmv"),
                   trans,
                   m,
                   n,
@@ -155,12 +351,8 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle handle,
         return rocsparse_status_invalid_size;
     }
 
-    // Check pointer arguments
-    if(ell_val == nullptr)
-    {
-        return rocsparse_status_invalid_pointer;
-    }
-    else if(ell_col_ind == nullptr)
+    // Check pointer arguments, ell_val is NULL for pattern only matrices
+    if(ell_col_ind == nullptr)
     {
         return rocsparse_status_invalid_pointer;
     }
@@ -187,71 +379,43 @@ rocsparse_status rocsparse_ellmv_template(rocsparse_handle handle,
         return rocsparse_status_invalid_size;
     }
 
+    // Pattern only matrices do not stream any values
+    size_t val_size = (ell_val != nullptr) ? sizeof(U) : 0;
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xellmv",
+                                    rocsparse_precision_string<U>(),
+                                    m,
+                                    n,
+                                    m * ell_width,
+                                    (val_size + sizeof(rocsparse_int)) * m * ell_width +
+                                        sizeof(T) * n + 2 * sizeof(T) * m);
+
     // Quick return if possible
     if(m == 0 || n == 0 || ell_width == 0)
     {
         return rocsparse_status_success;
     }
 
-    // Stream
-    hipStream_t stream = handle->stream;
-
-    // Run different ellmv kernels
-    if(trans == rocsparse_operation_none)
-    {
-#define ELLMVN_DIM 512
-        dim3 ellmvn_blocks((m - 1) / ELLMVN_DIM + 1);
-        dim3 ellmvn_threads(ELLMVN_DIM);
-
-        if(handle->pointer_mode == rocsparse_pointer_mode_device)
-        {
-            hipLaunchKernelGGL((ellmvn_kernel_device_pointer<T>),
-                               ellmvn_blocks,
-                               ellmvn_threads,
-                               0,
-                               stream,
-                               m,
-                               n,
-                               ell_width,
-                               alpha,
-                               ell_col_ind,
-                               ell_val,
-                               x,
-                               beta,
-                               y,
-                               descr->base);
-        }
-        else
-        {
-            if(*alpha == 0.0 && *beta == 1.0)
-            {
-                return rocsparse_status_success;
-            }
-
-            hipLaunchKernelGGL((ellmvn_kernel_host_pointer<T>),
-                               ellmvn_blocks,
-                               ellmvn_threads,
-                               0,
-                               stream,
-                               m,
-                               n,
-                               ell_width,
-                               *alpha,
-                               ell_col_ind,
-                               ell_val,
-                               x,
-                               *beta,
-                               y,
-                               descr->base);
-        }
-#undef ELLMVN_DIM
-    }
-    else
+    // Pattern only matrices are processed by kernels that do not load any values
+    if(ell_val == nullptr)
     {
-        // TODO
-        return rocsparse_status_not_implemented;
+        return rocsparse_ellmv_dispatch(handle,
+                                        trans,
+                                        m,
+                                        n,
+                                        alpha,
+                                        descr,
+                                        static_cast<const rocsparse_pattern_value*>(nullptr),
+                                        ell_col_ind,
+                                        ell_width,
+                                        x,
+                                        beta,
+                                        y);
     }
-    return rocsparse_status_success;
+
+    return rocsparse_ellmv_dispatch(
+        handle, trans, m, n, alpha, descr, ell_val, ell_col_ind, ell_width, x, beta, y);
 }
 
 #endif // ROCSPARSE_ELLMV_HPP
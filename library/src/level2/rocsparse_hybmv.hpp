@@ -29,12 +29,14 @@
 #include "definitions.h"
 #include "handle.h"
 #include "utility.h"
+#include "capture.h"
 #include "rocsparse_coomv.hpp"
 #include "rocsparse_ellmv.hpp"
 
 #include <hip/hip_runtime_api.h>
 
-template <typename T>
+// T is the compute type, U the storage type of the HYB matrix values
+template <typename T, typename U = T>
 rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
                                           rocsparse_operation trans,
                                           const T* alpha,
@@ -62,7 +64,7 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
     if(handle->pointer_mode == rocsparse_pointer_mode_host)
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xhybmv"),
+                  replaceX<U>("rocsparse_Xhybmv"),
                   trans,
                   *alpha,
                   (const void*&)descr,
@@ -71,10 +73,13 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
                   *beta,
                   (const void*&)y);
 
+        std::string mtx = rocsparse_capture_hyb<U>(handle, "hybmv", descr, hyb);
+
         log_bench(handle,
                   "./rocsparse-bench -f hybmv -r",
-                  replaceX<T>("X"),
-                  "--mtx <matrix.mtx> "
+                  replaceX<U>("X"),
+                  "--mtx",
+                  mtx,
                   "--alpha",
                   *alpha,
                   "--beta",
@@ -83,7 +88,7 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
     else
     {
         log_trace(handle,
-                  replaceX<T>("rocsparse_Xhybmv"),
+                  replaceX<U>("rocsparse_Xhybmv"),
                   trans,
                   (const void*&)alpha,
                   (const void*&)descr,
@@ -126,7 +131,7 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
         return rocsparse_status_invalid_size;
     }
 
-    // Check ELL-HYB structure
+    // Check ELL-HYB structure, values are NULL for pattern only matrices
     if(hyb->ell_nnz > 0)
     {
         if(hyb->ell_width < 0)
@@ -137,13 +142,9 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
         {
             return rocsparse_status_invalid_pointer;
         }
-        else if(hyb->ell_val == nullptr)
-        {
-            return rocsparse_status_invalid_pointer;
-        }
     }
 
-    // Check COO-HYB structure
+    // Check COO-HYB structure, values are NULL for pattern only matrices
     if(hyb->coo_nnz > 0)
     {
         if(hyb->coo_row_ind == nullptr)
@@ -154,10 +155,6 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
         {
             return rocsparse_status_invalid_pointer;
         }
-        else if(hyb->coo_val == nullptr)
-        {
-            return rocsparse_status_invalid_pointer;
-        }
     }
 
     // Check pointer arguments
@@ -178,84 +175,74 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Pattern only matrices do not stream any values
+    size_t ell_val_size = (hyb->ell_val != nullptr) ? sizeof(U) : 0;
+    size_t coo_val_size = (hyb->coo_val != nullptr) ? sizeof(U) : 0;
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xhybmv",
+                                    rocsparse_precision_string<U>(),
+                                    hyb->m,
+                                    hyb->n,
+                                    hyb->ell_nnz + hyb->coo_nnz,
+                                    (ell_val_size + sizeof(rocsparse_int)) * hyb->ell_nnz +
+                                        (coo_val_size + 2 * sizeof(rocsparse_int)) * hyb->coo_nnz +
+                                        sizeof(T) * hyb->n + 2 * sizeof(T) * hyb->m);
+
     // Quick return if possible
     if(hyb->m == 0 || hyb->n == 0 || hyb->ell_nnz + hyb->coo_nnz == 0)
     {
         return rocsparse_status_success;
     }
 
-    // Run different hybmv kernels
-    if(trans == rocsparse_operation_none)
+    // Run ELL part followed by COO part, for all operation types. Beta is applied only
+    // once, by the first part that is processed.
+
+    // ELL part
+    if(hyb->ell_nnz > 0)
     {
-        // ELL part
-        if(hyb->ell_nnz > 0)
-        {
-            RETURN_IF_ROCSPARSE_ERROR(rocsparse_ellmv_template(handle,
-                                                               trans,
-                                                               hyb->m,
-                                                               hyb->n,
-                                                               alpha,
-                                                               descr,
-                                                               (T*)hyb->ell_val,
-                                                               hyb->ell_col_ind,
-                                                               hyb->ell_width,
-                                                               x,
-                                                               beta,
-                                                               y));
-        }
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_ellmv_template(handle,
+                                                           trans,
+                                                           hyb->m,
+                                                           hyb->n,
+                                                           alpha,
+                                                           descr,
+                                                           (const U*)hyb->ell_val,
+                                                           hyb->ell_col_ind,
+                                                           hyb->ell_width,
+                                                           x,
+                                                           beta,
+                                                           y));
+    }
 
-        // COO part
-        if(hyb->coo_nnz > 0)
+    // COO part
+    if(hyb->coo_nnz > 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
         {
-            if(handle->pointer_mode == rocsparse_pointer_mode_device)
+            // Beta is applied by ELL part, IF ell_nnz > 0
+            if(hyb->ell_nnz > 0)
             {
-                // Beta is applied by ELL part, IF ell_nnz > 0
-                if(hyb->ell_nnz > 0)
-                {
-                    T* coo_beta = NULL;
-                    rocsparse_one(handle, &coo_beta);
+                T* coo_beta = NULL;
+                RETURN_IF_ROCSPARSE_ERROR(handle->init_buffer());
+                rocsparse_one(handle, &coo_beta);
 
-                    RETURN_IF_ROCSPARSE_ERROR(rocsparse_coomv_template(handle,
-                                                                       trans,
-                                                                       hyb->m,
-                                                                       hyb->n,
-                                                                       hyb->coo_nnz,
-                                                                       alpha,
-                                                                       descr,
-                                                                       (T*)hyb->coo_val,
-                                                                       hyb->coo_row_ind,
-                                                                       hyb->coo_col_ind,
-                                                                       x,
-                                                                       coo_beta,
-                                                                       y));
-                }
-                else
-                {
-                    RETURN_IF_ROCSPARSE_ERROR(rocsparse_coomv_template(handle,
-                                                                       trans,
-                                                                       hyb->m,
-                                                                       hyb->n,
-                                                                       hyb->coo_nnz,
-                                                                       alpha,
-                                                                       descr,
-                                                                       (T*)hyb->coo_val,
-                                                                       hyb->coo_row_ind,
-                                                                       hyb->coo_col_ind,
-                                                                       x,
-                                                                       beta,
-                                                                       y));
-                }
+                RETURN_IF_ROCSPARSE_ERROR(rocsparse_coomv_template(handle,
+                                                                   trans,
+                                                                   hyb->m,
+                                                                   hyb->n,
+                                                                   hyb->coo_nnz,
+                                                                   alpha,
+                                                                   descr,
+                                                                   (const U*)hyb->coo_val,
+                                                                   hyb->coo_row_ind,
+                                                                   hyb->coo_col_ind,
+                                                                   x,
+                                                                   coo_beta,
+                                                                   y));
             }
             else
             {
-                if(*alpha == 0.0 && *beta == 1.0)
-                {
-                    return rocsparse_status_success;
-                }
-
-                // Beta is applied by ELL part, IF ell_nnz > 0
-                T coo_beta = (hyb->ell_nnz > 0) ? 1.0 : *beta;
-
                 RETURN_IF_ROCSPARSE_ERROR(rocsparse_coomv_template(handle,
                                                                    trans,
                                                                    hyb->m,
@@ -263,20 +250,40 @@ rocsparse_status rocsparse_hybmv_template(rocsparse_handle handle,
                                                                    hyb->coo_nnz,
                                                                    alpha,
                                                                    descr,
-                                                                   (T*)hyb->coo_val,
+                                                                   (const U*)hyb->coo_val,
                                                                    hyb->coo_row_ind,
                                                                    hyb->coo_col_ind,
                                                                    x,
-                                                                   &coo_beta,
+                                                                   beta,
                                                                    y));
             }
         }
+        else
+        {
+            if(*alpha == 0.0 && *beta == 1.0)
+            {
+                return rocsparse_status_success;
+            }
+
+            // Beta is applied by ELL part, IF ell_nnz > 0
+            T coo_beta = (hyb->ell_nnz > 0) ? static_cast<T>(1) : *beta;
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_coomv_template(handle,
+                                                               trans,
+                                                               hyb->m,
+                                                               hyb->n,
+                                                               hyb->coo_nnz,
+                                                               alpha,
+                                                               descr,
+                                                               (const U*)hyb->coo_val,
+                                                               hyb->coo_row_ind,
+                                                               hyb->coo_col_ind,
+                                                               x,
+                                                               &coo_beta,
+                                                               y));
+        }
     }
-    else
-    {
-        // TODO
-        return rocsparse_status_not_implemented;
-    }
+
     return rocsparse_status_success;
 }
 
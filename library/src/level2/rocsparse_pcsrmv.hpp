@@ -0,0 +1,374 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_PCSRMV_HPP
+#define ROCSPARSE_PCSRMV_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "capture.h"
+#include "pcsrmv_device.h"
+
+#include <hip/hip_runtime.h>
+
+template <typename T, typename U, typename D, rocsparse_int WF_SIZE>
+__global__ void pcsrmvn_general_kernel_host_pointer(rocsparse_int m,
+                                                    T alpha,
+                                                    rocsparse_int block_dim,
+                                                    const rocsparse_int* __restrict__ row_ptr,
+                                                    const rocsparse_int* __restrict__ col_base,
+                                                    const D* __restrict__ col_delta,
+                                                    const U* __restrict__ val,
+                                                    const T* __restrict__ x,
+                                                    T beta,
+                                                    T* __restrict__ y,
+                                                    rocsparse_index_base idx_base)
+{
+    pcsrmvn_general_device<T, U, D, WF_SIZE>(
+        m, alpha, block_dim, row_ptr, col_base, col_delta, val, x, beta, y, idx_base);
+}
+
+template <typename T, typename U, typename D, rocsparse_int WF_SIZE>
+__global__ void pcsrmvn_general_kernel_device_pointer(rocsparse_int m,
+                                                      const T* alpha,
+                                                      rocsparse_int block_dim,
+                                                      const rocsparse_int* __restrict__ row_ptr,
+                                                      const rocsparse_int* __restrict__ col_base,
+                                                      const D* __restrict__ col_delta,
+                                                      const U* __restrict__ val,
+                                                      const T* __restrict__ x,
+                                                      const T* beta,
+                                                      T* __restrict__ y,
+                                                      rocsparse_index_base idx_base)
+{
+    pcsrmvn_general_device<T, U, D, WF_SIZE>(
+        m, *alpha, block_dim, row_ptr, col_base, col_delta, val, x, *beta, y, idx_base);
+}
+
+#define PCSRMVN_DIM 512
+template <typename T, typename U, typename D, rocsparse_int WF_SIZE>
+static void rocsparse_pcsrmv_launch(rocsparse_handle handle,
+                                    const T* alpha,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_pcsr_mat pcsr,
+                                    const U* val,
+                                    const T* x,
+                                    const T* beta,
+                                    T* y)
+{
+    dim3 pcsrmvn_blocks((pcsr->m - 1) / PCSRMVN_DIM + 1);
+    dim3 pcsrmvn_threads(PCSRMVN_DIM);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((pcsrmvn_general_kernel_device_pointer<T, U, D, WF_SIZE>),
+                           pcsrmvn_blocks,
+                           pcsrmvn_threads,
+                           0,
+                           handle->stream,
+                           pcsr->m,
+                           alpha,
+                           pcsr->block_dim,
+                           pcsr->row_ptr,
+                           pcsr->col_base,
+                           (const D*)pcsr->col_delta,
+                           val,
+                           x,
+                           beta,
+                           y,
+                           descr->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((pcsrmvn_general_kernel_host_pointer<T, U, D, WF_SIZE>),
+                           pcsrmvn_blocks,
+                           pcsrmvn_threads,
+                           0,
+                           handle->stream,
+                           pcsr->m,
+                           *alpha,
+                           pcsr->block_dim,
+                           pcsr->row_ptr,
+                           pcsr->col_base,
+                           (const D*)pcsr->col_delta,
+                           val,
+                           x,
+                           *beta,
+                           y,
+                           descr->base);
+    }
+}
+#undef PCSRMVN_DIM
+
+template <typename T, typename U, typename D>
+static rocsparse_status rocsparse_pcsrmv_general(rocsparse_handle handle,
+                                                 const T* alpha,
+                                                 const rocsparse_mat_descr descr,
+                                                 const rocsparse_pcsr_mat pcsr,
+                                                 const U* val,
+                                                 const T* x,
+                                                 const T* beta,
+                                                 T* y)
+{
+    // The subgroup size is chosen from the average row length
+    rocsparse_int nnz_per_row = pcsr->nnz / pcsr->m;
+
+    if(nnz_per_row < 4)
+    {
+        rocsparse_pcsrmv_launch<T, U, D, 2>(handle, alpha, descr, pcsr, val, x, beta, y);
+    }
+    else if(nnz_per_row < 8)
+    {
+        rocsparse_pcsrmv_launch<T, U, D, 4>(handle, alpha, descr, pcsr, val, x, beta, y);
+    }
+    else if(nnz_per_row < 16)
+    {
+        rocsparse_pcsrmv_launch<T, U, D, 8>(handle, alpha, descr, pcsr, val, x, beta, y);
+    }
+    else if(nnz_per_row < 32)
+    {
+        rocsparse_pcsrmv_launch<T, U, D, 16>(handle, alpha, descr, pcsr, val, x, beta, y);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        rocsparse_pcsrmv_launch<T, U, D, 32>(handle, alpha, descr, pcsr, val, x, beta, y);
+    }
+    else if(handle->wavefront_size == 64)
+    {
+        rocsparse_pcsrmv_launch<T, U, D, 64>(handle, alpha, descr, pcsr, val, x, beta, y);
+    }
+    else
+    {
+        return rocsparse_status_arch_mismatch;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+static rocsparse_status rocsparse_pcsrmv_dispatch(rocsparse_handle handle,
+                                                  const T* alpha,
+                                                  const rocsparse_mat_descr descr,
+                                                  const rocsparse_pcsr_mat pcsr,
+                                                  const U* val,
+                                                  const T* x,
+                                                  const T* beta,
+                                                  T* y)
+{
+    // Column deltas are decoded with the type selected during conversion
+    if(pcsr->delta_size == sizeof(unsigned char))
+    {
+        return rocsparse_pcsrmv_general<T, U, unsigned char>(
+            handle, alpha, descr, pcsr, val, x, beta, y);
+    }
+    else if(pcsr->delta_size == sizeof(unsigned short))
+    {
+        return rocsparse_pcsrmv_general<T, U, unsigned short>(
+            handle, alpha, descr, pcsr, val, x, beta, y);
+    }
+    else
+    {
+        return rocsparse_pcsrmv_general<T, U, rocsparse_int>(
+            handle, alpha, descr, pcsr, val, x, beta, y);
+    }
+}
+
+template <typename T>
+rocsparse_status rocsparse_pcsrmv_template(rocsparse_handle handle,
+                                           rocsparse_operation trans,
+                                           const T* alpha,
+                                           const rocsparse_mat_descr descr,
+                                           const rocsparse_pcsr_mat pcsr,
+                                           const T* x,
+                                           const T* beta,
+                                           T* y)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(pcsr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xpcsrmv"),
+                  trans,
+                  *alpha,
+                  (const void*&)descr,
+                  (const void*&)pcsr,
+                  (const void*&)x,
+                  *beta,
+                  (const void*&)y);
+
+        std::string mtx = rocsparse_capture_pcsr<T>(handle, "pcsrmv", descr, pcsr);
+
+        log_bench(handle,
+                  "./rocsparse-bench -f pcsrmv -r",
+                  replaceX<T>("X"),
+                  "--mtx",
+                  mtx,
+                  "--alpha",
+                  *alpha,
+                  "--beta",
+                  *beta);
+    }
+    else
+    {
+        log_trace(handle,
+                  replaceX<T>("rocsparse_Xpcsrmv"),
+                  trans,
+                  (const void*&)alpha,
+                  (const void*&)descr,
+                  (const void*&)pcsr,
+                  (const void*&)x,
+                  (const void*&)beta,
+                  (const void*&)y);
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+    if(trans != rocsparse_operation_none)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(pcsr->m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(pcsr->n < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(pcsr->nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check PCSR structure, values are NULL for pattern only matrices
+    if(pcsr->m > 0 && pcsr->n > 0)
+    {
+        if(pcsr->delta_size != sizeof(unsigned char) &&
+           pcsr->delta_size != sizeof(unsigned short) &&
+           pcsr->delta_size != sizeof(rocsparse_int))
+        {
+            return rocsparse_status_invalid_value;
+        }
+        else if(pcsr->row_ptr == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(pcsr->col_base == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+        else if(pcsr->nnz > 0 && pcsr->col_delta == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+    }
+
+    // Check pointer arguments
+    if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(beta == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Pattern only matrices do not stream any values
+    size_t val_size = (pcsr->val != nullptr) ? sizeof(T) : 0;
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xpcsrmv",
+                                    rocsparse_precision_string<T>(),
+                                    pcsr->m,
+                                    pcsr->n,
+                                    pcsr->nnz,
+                                    (val_size + pcsr->delta_size) * pcsr->nnz +
+                                        sizeof(rocsparse_int) * (pcsr->m + 1) +
+                                        sizeof(rocsparse_int) * (pcsr->m / pcsr->block_dim + 1) +
+                                        sizeof(T) * pcsr->n + 2 * sizeof(T) * pcsr->m);
+
+    // Quick return if possible
+    if(pcsr->m == 0 || pcsr->n == 0 || pcsr->nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Nothing to do if alpha == 0 and beta == 1
+    if(handle->pointer_mode == rocsparse_pointer_mode_host && *alpha == 0.0 && *beta == 1.0)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(pcsr->val == nullptr)
+    {
+        return rocsparse_pcsrmv_dispatch(handle,
+                                         alpha,
+                                         descr,
+                                         pcsr,
+                                         static_cast<const rocsparse_pattern_value*>(nullptr),
+                                         x,
+                                         beta,
+                                         y);
+    }
+
+    return rocsparse_pcsrmv_dispatch(handle, alpha, descr, pcsr, (const T*)pcsr->val, x, beta, y);
+}
+
+#endif // ROCSPARSE_PCSRMV_HPP
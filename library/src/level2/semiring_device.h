@@ -0,0 +1,187 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef SEMIRING_DEVICE_H
+#define SEMIRING_DEVICE_H
+
+#include "rocsparse.h"
+
+#include <hip/hip_runtime.h>
+
+// Additive identity, multiplicative identity, addition and multiplication of the
+// semirings that are supported by the semiring SpMV kernels
+template <rocsparse_semiring S, typename T>
+struct rocsparse_semiring_op;
+
+template <typename T>
+struct rocsparse_semiring_op<rocsparse_semiring_plus_times, T>
+{
+    static __device__ __host__ __forceinline__ T zero() { return static_cast<T>(0); }
+    static __device__ __host__ __forceinline__ T one() { return static_cast<T>(1); }
+    static __device__ __host__ __forceinline__ T add(T a, T b) { return a + b; }
+    static __device__ __host__ __forceinline__ T mul(T a, T b) { return a * b; }
+};
+
+template <typename T>
+struct rocsparse_semiring_op<rocsparse_semiring_min_plus, T>
+{
+    static __device__ __host__ __forceinline__ T zero() { return static_cast<T>(INFINITY); }
+    static __device__ __host__ __forceinline__ T one() { return static_cast<T>(0); }
+    static __device__ __host__ __forceinline__ T add(T a, T b) { return (a < b) ? a : b; }
+    static __device__ __host__ __forceinline__ T mul(T a, T b) { return a + b; }
+};
+
+template <typename T>
+struct rocsparse_semiring_op<rocsparse_semiring_max_times, T>
+{
+    static __device__ __host__ __forceinline__ T zero() { return static_cast<T>(0); }
+    static __device__ __host__ __forceinline__ T one() { return static_cast<T>(1); }
+    static __device__ __host__ __forceinline__ T add(T a, T b) { return (a > b) ? a : b; }
+    static __device__ __host__ __forceinline__ T mul(T a, T b) { return a * b; }
+};
+
+template <typename T>
+struct rocsparse_semiring_op<rocsparse_semiring_or_and, T>
+{
+    static __device__ __host__ __forceinline__ T zero() { return static_cast<T>(0); }
+    static __device__ __host__ __forceinline__ T one() { return static_cast<T>(1); }
+    static __device__ __host__ __forceinline__ T add(T a, T b)
+    {
+        return (a != static_cast<T>(0) || b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    }
+    static __device__ __host__ __forceinline__ T mul(T a, T b)
+    {
+        return (a != static_cast<T>(0) && b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    }
+};
+
+// Value of a matrix entry, pattern only matrices without values store the
+// multiplicative identity implicitly
+template <rocsparse_semiring S, typename T>
+static __device__ __forceinline__ T semiring_value(const T* val, rocsparse_int idx)
+{
+    return (val == nullptr) ? rocsparse_semiring_op<S, T>::one() : val[idx];
+}
+
+// y := alpha * ax + beta * y, y is not read if beta is the additive identity
+template <rocsparse_semiring S, typename T>
+static __device__ __forceinline__ T semiring_axpby(T alpha, T ax, T beta, const T* y)
+{
+    typedef rocsparse_semiring_op<S, T> op;
+
+    ax = op::mul(alpha, ax);
+
+    return (beta == op::zero()) ? ax : op::add(ax, op::mul(beta, *y));
+}
+
+// Butterfly wavefront reduction, all lanes hold the result afterwards
+template <rocsparse_semiring S, rocsparse_int WF_SIZE, typename T>
+static __device__ __forceinline__ T semiring_wf_reduce(T sum)
+{
+    for(rocsparse_int i = WF_SIZE >> 1; i > 0; i >>= 1)
+    {
+#if defined(__HIP_PLATFORM_HCC__)
+        sum = rocsparse_semiring_op<S, T>::add(sum, __shfl_xor(sum, i));
+#elif defined(__HIP_PLATFORM_NVCC__)
+        sum = rocsparse_semiring_op<S, T>::add(sum, __shfl_xor_sync(0xffffffff, sum, i));
+#endif
+    }
+
+    return sum;
+}
+
+// Tree reduction step in shared memory, see sum2_reduce
+template <rocsparse_semiring S, typename T>
+static __device__ __forceinline__ T semiring_sum2_reduce(
+    T cur_sum, T* partial, rocsparse_int lid, rocsparse_int max_size, rocsparse_int reduc_size)
+{
+    if(max_size > reduc_size)
+    {
+        cur_sum = rocsparse_semiring_op<S, T>::add(cur_sum, partial[lid + reduc_size]);
+        __syncthreads();
+        partial[lid] = cur_sum;
+    }
+    return cur_sum;
+}
+
+// Atomic semiring addition. Native atomics are used for the arithmetic semiring,
+// all others use a compare and swap loop that returns early if the stored value
+// does not change, which is the common case for min and max.
+template <rocsparse_semiring S>
+static __device__ __forceinline__ void semiring_atomic_add(float* address, float val)
+{
+    if(S == rocsparse_semiring_plus_times)
+    {
+        atomicAdd(address, val);
+        return;
+    }
+
+    unsigned int newVal;
+    unsigned int prevVal;
+
+    do
+    {
+        float cur = *address;
+        float res = rocsparse_semiring_op<S, float>::add(cur, val);
+
+        if(res == cur)
+        {
+            return;
+        }
+
+        prevVal = __float_as_uint(cur);
+        newVal  = __float_as_uint(res);
+    } while(atomicCAS((unsigned int*)address, prevVal, newVal) != prevVal);
+}
+
+template <rocsparse_semiring S>
+static __device__ __forceinline__ void semiring_atomic_add(double* address, double val)
+{
+    if(S == rocsparse_semiring_plus_times)
+    {
+        atomicAdd(address, val);
+        return;
+    }
+
+    unsigned long long newVal;
+    unsigned long long prevVal;
+
+    do
+    {
+        double cur = *address;
+        double res = rocsparse_semiring_op<S, double>::add(cur, val);
+
+        if(res == cur)
+        {
+            return;
+        }
+
+        prevVal = __double_as_longlong(cur);
+        newVal  = __double_as_longlong(res);
+    } while(atomicCAS((unsigned long long*)address, prevVal, newVal) != prevVal);
+}
+
+#endif // SEMIRING_DEVICE_H
@@ -290,6 +290,16 @@ rocsparse_status rocsparse_csrmm_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsrmm",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    k,
+                                    nnz,
+                                    (sizeof(T) + sizeof(rocsparse_int)) * nnz +
+                                        sizeof(rocsparse_int) * (m + 1) + sizeof(T) * k * n +
+                                        2 * sizeof(T) * m * n);
+
     // Quick return if possible
     if(m == 0 || n == 0 || k == 0 || nnz == 0)
     {
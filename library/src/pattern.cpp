@@ -0,0 +1,211 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "definitions.h"
+#include "handle.h"
+#include "pattern.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+// splitmix64 finalizer, scatters (position, value) pairs over all 64 bits
+static __device__ __forceinline__ unsigned long long pattern_mix(unsigned long long z)
+{
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+template <rocsparse_int n>
+static __device__ void pattern_sum_reduce(rocsparse_int tid, unsigned long long* x)
+{
+    // clang-format off
+    __syncthreads();
+    if(n > 512) { if(tid < 512 && tid + 512 < n) { x[tid] += x[tid + 512]; } __syncthreads(); }
+    if(n > 256) { if(tid < 256 && tid + 256 < n) { x[tid] += x[tid + 256]; } __syncthreads(); }
+    if(n > 128) { if(tid < 128 && tid + 128 < n) { x[tid] += x[tid + 128]; } __syncthreads(); }
+    if(n >  64) { if(tid <  64 && tid +  64 < n) { x[tid] += x[tid +  64]; } __syncthreads(); }
+    if(n >  32) { if(tid <  32 && tid +  32 < n) { x[tid] += x[tid +  32]; } __syncthreads(); }
+    if(n >  16) { if(tid <  16 && tid +  16 < n) { x[tid] += x[tid +  16]; } __syncthreads(); }
+    if(n >   8) { if(tid <   8 && tid +   8 < n) { x[tid] += x[tid +   8]; } __syncthreads(); }
+    if(n >   4) { if(tid <   4 && tid +   4 < n) { x[tid] += x[tid +   4]; } __syncthreads(); }
+    if(n >   2) { if(tid <   2 && tid +   2 < n) { x[tid] += x[tid +   2]; } __syncthreads(); }
+    if(n >   1) { if(tid <   1 && tid +   1 < n) { x[tid] += x[tid +   1]; } __syncthreads(); }
+    // clang-format on
+}
+
+// Each block hashes a strided chunk of the row pointer and column index arrays
+// and writes its partial sum to the workspace
+template <rocsparse_int NB>
+__launch_bounds__(NB) __global__
+    void csr_pattern_hash_part1(rocsparse_int m,
+                                rocsparse_int nnz,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                unsigned long long* __restrict__ workspace)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * NB + tid;
+    rocsparse_int inc = hipGridDim_x * NB;
+
+    __shared__ unsigned long long sdata[NB];
+
+    unsigned long long sum = 0;
+
+    for(rocsparse_int i = gid; i < m + 1; i += inc)
+    {
+        unsigned long long entry = (static_cast<unsigned long long>(i) << 32)
+                                   | static_cast<unsigned int>(csr_row_ptr[i]);
+        sum += pattern_mix(entry);
+    }
+
+    // Column indices are salted to distinguish them from row pointer entries
+    for(rocsparse_int i = gid; i < nnz; i += inc)
+    {
+        unsigned long long entry = (static_cast<unsigned long long>(i) << 32)
+                                   | static_cast<unsigned int>(csr_col_ind[i]);
+        sum += pattern_mix(entry ^ 0x9e3779b97f4a7c15ULL);
+    }
+
+    sdata[tid] = sum;
+
+    pattern_sum_reduce<NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+// Single block that sums up the partial sums of all blocks
+template <rocsparse_int NB>
+__launch_bounds__(NB) __global__
+    void csr_pattern_hash_part2(rocsparse_int size, unsigned long long* __restrict__ workspace)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+
+    __shared__ unsigned long long sdata[NB];
+
+    sdata[tid] = (tid < size) ? workspace[tid] : 0;
+
+    pattern_sum_reduce<NB>(tid, sdata);
+
+    if(tid == 0)
+    {
+        workspace[0] = sdata[0];
+    }
+}
+
+/********************************************************************************
+ * \brief Compute the sparsity pattern fingerprint of a CSR matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_csr_pattern_key(rocsparse_handle handle,
+                                           rocsparse_int m,
+                                           rocsparse_int n,
+                                           rocsparse_int nnz,
+                                           rocsparse_index_base base,
+                                           const rocsparse_int* csr_row_ptr,
+                                           const rocsparse_int* csr_col_ind,
+                                           rocsparse_pattern_key* key)
+{
+    key->m    = m;
+    key->n    = n;
+    key->nnz  = nnz;
+    key->base = base;
+    key->hash = 0;
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Partial sums are stored in the handle buffer
+    RETURN_IF_ROCSPARSE_ERROR(handle->init_buffer());
+    unsigned long long* workspace = reinterpret_cast<unsigned long long*>(handle->buffer);
+
+#define PATTERN_DIM 256
+    rocsparse_int blocks = std::min((std::max(m + 1, nnz) - 1) / PATTERN_DIM + 1, PATTERN_DIM);
+
+    hipLaunchKernelGGL((csr_pattern_hash_part1<PATTERN_DIM>),
+                       dim3(blocks),
+                       dim3(PATTERN_DIM),
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       workspace);
+
+    hipLaunchKernelGGL((csr_pattern_hash_part2<PATTERN_DIM>),
+                       dim3(1),
+                       dim3(PATTERN_DIM),
+                       0,
+                       stream,
+                       blocks,
+                       workspace);
+#undef PATTERN_DIM
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &key->hash, workspace, sizeof(unsigned long long), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Update the sparsity pattern fingerprint that is stored in the matrix
+ * info.
+ *******************************************************************************/
+rocsparse_status rocsparse_update_pattern_key(rocsparse_handle handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int m,
+                                              rocsparse_int n,
+                                              rocsparse_int nnz,
+                                              rocsparse_index_base base,
+                                              const rocsparse_int* csr_row_ptr,
+                                              const rocsparse_int* csr_col_ind,
+                                              bool force)
+{
+    // Arrays that have not been moved are assumed to be unchanged, unless forced
+    if(force == false && info->pattern_check == rocsparse_pattern_check_moved &&
+       info->pattern_row_ptr == csr_row_ptr && info->pattern_col_ind == csr_col_ind &&
+       info->pattern.m == m && info->pattern.n == n && info->pattern.nnz == nnz &&
+       info->pattern.base == base)
+    {
+        return rocsparse_status_success;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_key(
+        handle, m, n, nnz, base, csr_row_ptr, csr_col_ind, &info->pattern));
+
+    info->pattern_row_ptr = csr_row_ptr;
+    info->pattern_col_ind = csr_col_ind;
+
+    return rocsparse_status_success;
+}
@@ -25,6 +25,8 @@
 #ifndef CSRILU0_DEVICE_H
 #define CSRILU0_DEVICE_H
 
+#include "complex.h"
+
 #include <hip/hip_runtime.h>
 
 template <typename T, rocsparse_int BLOCKSIZE, rocsparse_int WF_SIZE, unsigned int HASH>
@@ -132,8 +134,7 @@ __global__ void csrilu0_hash_kernel(rocsparse_int m,
 
 // Load diagonal entry
 #if defined(__HIP_PLATFORM_HCC__)
-        T diag_val;
-        __atomic_load(&csr_val[local_diag], &diag_val, __ATOMIC_ACQUIRE);
+        T diag_val = atomic_value_load(&csr_val[local_diag]);
 #elif defined(__HIP_PLATFORM_NVCC__)
         T diag_val          = csr_val[local_diag];
 #endif
@@ -176,8 +177,7 @@ __global__ void csrilu0_hash_kernel(rocsparse_int m,
                 {
 // Entry found, do ILU computation
 #if defined(__HIP_PLATFORM_HCC__)
-                    T val_k;
-                    __atomic_load(&csr_val[k], &val_k, __ATOMIC_ACQUIRE);
+                    T val_k = atomic_value_load(&csr_val[k]);
 #elif defined(__HIP_PLATFORM_NVCC__)
                     T val_k = csr_val[k];
 #endif
@@ -262,8 +262,7 @@ __global__ void csrilu0_binsearch_kernel(rocsparse_int m,
 
 // Load diagonal entry
 #if defined(__HIP_PLATFORM_HCC__)
-        T diag_val;
-        __atomic_load(&csr_val[local_diag], &diag_val, __ATOMIC_ACQUIRE);
+        T diag_val = atomic_value_load(&csr_val[local_diag]);
 #elif defined(__HIP_PLATFORM_NVCC__)
         // TODO
         volatile T diag_val      = csr_val[local_diag];
@@ -317,8 +316,7 @@ __global__ void csrilu0_binsearch_kernel(rocsparse_int m,
             {
 // If a match has been found, do ILU computation
 #if defined(__HIP_PLATFORM_HCC__)
-                T val_k;
-                __atomic_load(&csr_val[k], &val_k, __ATOMIC_ACQUIRE);
+                T val_k = atomic_value_load(&csr_val[k]);
 #elif defined(__HIP_PLATFORM_NVCC__)
                 volatile T val_k = csr_val[k];
 #endif
@@ -0,0 +1,229 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRILU0_ITERATIVE_DEVICE_H
+#define CSRILU0_ITERATIVE_DEVICE_H
+
+#include "complex.h"
+#include "../level1/doti_device.h"
+
+#include <hip/hip_runtime.h>
+
+// Row of the non-zero entry idx, e.g. the last row whose row pointer does not exceed idx
+static __device__ __forceinline__ rocsparse_int
+    csrilu0_iterative_row(rocsparse_int m,
+                          const rocsparse_int* __restrict__ csr_row_ptr,
+                          rocsparse_int idx,
+                          rocsparse_index_base idx_base)
+{
+    rocsparse_int left  = 0;
+    rocsparse_int right = m - 1;
+
+    while(left < right)
+    {
+        rocsparse_int mid = (left + right + 1) >> 1;
+
+        if(csr_row_ptr[mid] - idx_base <= idx)
+        {
+            left = mid;
+        }
+        else
+        {
+            right = mid - 1;
+        }
+    }
+
+    return left;
+}
+
+// Position of column col within [begin, end), or -1 if it is not part of the pattern
+static __device__ __forceinline__ rocsparse_int
+    csrilu0_iterative_find(const rocsparse_int* __restrict__ csr_col_ind,
+                           rocsparse_int begin,
+                           rocsparse_int end,
+                           rocsparse_int col)
+{
+    rocsparse_int left  = begin;
+    rocsparse_int right = end - 1;
+
+    while(left <= right)
+    {
+        rocsparse_int mid = (left + right) >> 1;
+        rocsparse_int key = csr_col_ind[mid];
+
+        if(key == col)
+        {
+            return mid;
+        }
+        else if(key < col)
+        {
+            left = mid + 1;
+        }
+        else
+        {
+            right = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+// Initial guess of the fixed-point iteration, L = tril(A) * diag(A)^-1 and U = triu(A)
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrilu0_iterative_init_kernel(rocsparse_int m,
+                                       rocsparse_int nnz,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val_A,
+                                       T* __restrict__ csr_val,
+                                       const rocsparse_int* __restrict__ csr_diag_ind,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(idx >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int row = csrilu0_iterative_row(m, csr_row_ptr, idx, idx_base);
+    rocsparse_int col = csr_col_ind[idx] - idx_base;
+
+    T val = csr_val_A[idx];
+
+    if(col < row)
+    {
+        rocsparse_int diag = csr_diag_ind[col];
+
+        if(diag != -1 && csr_val_A[diag] != static_cast<T>(0))
+        {
+            val /= csr_val_A[diag];
+        }
+    }
+
+    csr_val[idx] = val;
+}
+
+// One asynchronous sweep of the fine-grained ILU(0) fixed-point iteration. Each thread
+// updates a single entry of the factors in place, using whatever values the other entries
+// currently hold. The squared norms of the update and of the factors are accumulated into
+// history[0] and history[1].
+template <typename T, unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrilu0_iterative_sweep_kernel(rocsparse_int m,
+                                        rocsparse_int nnz,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        const rocsparse_int* __restrict__ csr_col_ind,
+                                        const T* __restrict__ csr_val_A,
+                                        T* csr_val,
+                                        const rocsparse_int* __restrict__ csr_diag_ind,
+                                        rocsparse_int* __restrict__ zero_pivot,
+                                        double* __restrict__ history,
+                                        rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ double sdelta[BLOCKSIZE];
+    __shared__ double snorm[BLOCKSIZE];
+
+    sdelta[tid] = 0.0;
+    snorm[tid]  = 0.0;
+
+    if(idx < nnz)
+    {
+        rocsparse_int row = csrilu0_iterative_row(m, csr_row_ptr, idx, idx_base);
+        rocsparse_int col = csr_col_ind[idx] - idx_base;
+
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        rocsparse_int bound = min(row, col);
+
+        // a_ij - sum_{k < min(i, j)} l_ik * u_kj
+        T sum = csr_val_A[idx];
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int k = csr_col_ind[j] - idx_base;
+
+            // Columns are sorted
+            if(k >= bound)
+            {
+                break;
+            }
+
+            rocsparse_int pos = csrilu0_iterative_find(csr_col_ind,
+                                                       csr_row_ptr[k] - idx_base,
+                                                       csr_row_ptr[k + 1] - idx_base,
+                                                       col + idx_base);
+
+            if(pos != -1)
+            {
+                sum -= csr_val[j] * csr_val[pos];
+            }
+        }
+
+        bool valid = true;
+
+        // Entries of L are scaled by the diagonal of U
+        if(row > col)
+        {
+            rocsparse_int diag = csr_diag_ind[col];
+            T diag_val         = (diag == -1) ? static_cast<T>(0) : csr_val[diag];
+
+            if(diag_val == static_cast<T>(0))
+            {
+                // We are looking for the first zero pivot
+                atomicMin(zero_pivot, col + idx_base);
+                valid = false;
+            }
+            else
+            {
+                sum /= diag_val;
+            }
+        }
+
+        if(valid)
+        {
+            sdelta[tid] = rocsparse_abs2(sum - csr_val[idx]);
+            snorm[tid]  = rocsparse_abs2(sum);
+
+            csr_val[idx] = sum;
+        }
+    }
+
+    rocsparse_sum_reduce<BLOCKSIZE, double>(tid, sdelta);
+    rocsparse_sum_reduce<BLOCKSIZE, double>(tid, snorm);
+
+    if(tid == 0)
+    {
+        atomicAdd(&history[0], sdelta[0]);
+        atomicAdd(&history[1], snorm[0]);
+    }
+}
+
+#endif // CSRILU0_ITERATIVE_DEVICE_H
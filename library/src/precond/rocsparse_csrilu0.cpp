@@ -75,6 +75,50 @@ extern "C" rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle hand
                                         buffer_size);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrilu0_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int m,
+                                                           rocsparse_int nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const rocsparse_float_complex* csr_val,
+                                                           const rocsparse_int* csr_row_ptr,
+                                                           const rocsparse_int* csr_col_ind,
+                                                           rocsparse_mat_info info,
+                                                           size_t* buffer_size)
+{
+    return rocsparse_ccsrsv_buffer_size(handle,
+                                        rocsparse_operation_none,
+                                        m,
+                                        nnz,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int m,
+                                                           rocsparse_int nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const rocsparse_double_complex* csr_val,
+                                                           const rocsparse_int* csr_row_ptr,
+                                                           const rocsparse_int* csr_col_ind,
+                                                           rocsparse_mat_info info,
+                                                           size_t* buffer_size)
+{
+    return rocsparse_zcsrsv_buffer_size(handle,
+                                        rocsparse_operation_none,
+                                        m,
+                                        nnz,
+                                        descr,
+                                        csr_val,
+                                        csr_row_ptr,
+                                        csr_col_ind,
+                                        info,
+                                        buffer_size);
+}
+
 extern "C" rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle handle,
                                                         rocsparse_int m,
                                                         rocsparse_int nnz,
@@ -125,6 +169,56 @@ extern "C" rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle handle,
                                                        temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrilu0_analysis(rocsparse_handle handle,
+                                                        rocsparse_int m,
+                                                        rocsparse_int nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const rocsparse_float_complex* csr_val,
+                                                        const rocsparse_int* csr_row_ptr,
+                                                        const rocsparse_int* csr_col_ind,
+                                                        rocsparse_mat_info info,
+                                                        rocsparse_analysis_policy analysis,
+                                                        rocsparse_solve_policy solve,
+                                                        void* temp_buffer)
+{
+    return rocsparse_csrilu0_analysis_template<rocsparse_float_complex>(handle,
+                                                                        m,
+                                                                        nnz,
+                                                                        descr,
+                                                                        csr_val,
+                                                                        csr_row_ptr,
+                                                                        csr_col_ind,
+                                                                        info,
+                                                                        analysis,
+                                                                        solve,
+                                                                        temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrilu0_analysis(rocsparse_handle handle,
+                                                        rocsparse_int m,
+                                                        rocsparse_int nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const rocsparse_double_complex* csr_val,
+                                                        const rocsparse_int* csr_row_ptr,
+                                                        const rocsparse_int* csr_col_ind,
+                                                        rocsparse_mat_info info,
+                                                        rocsparse_analysis_policy analysis,
+                                                        rocsparse_solve_policy solve,
+                                                        void* temp_buffer)
+{
+    return rocsparse_csrilu0_analysis_template<rocsparse_double_complex>(handle,
+                                                                         m,
+                                                                         nnz,
+                                                                         descr,
+                                                                         csr_val,
+                                                                         csr_row_ptr,
+                                                                         csr_col_ind,
+                                                                         info,
+                                                                         analysis,
+                                                                         solve,
+                                                                         temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle,
                                                     rocsparse_mat_info info)
 {
@@ -141,17 +235,29 @@ extern "C" rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle,
     // Logging
     log_trace(handle, "rocsparse_csrilu0_clear", (const void*&)info);
 
-    // If meta data is shared, do not delete anything
-    if(info->csrilu0_info == info->csrsv_lower_info || info->csrilu0_info == info->csrsv_upper_info)
+    // Clear mixed precision factors
+    if(info->csrilu0_mixed_val != nullptr)
     {
-        info->csrilu0_info = nullptr;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(
+            info->csrilu0_mixed_allocator, info->csrilu0_mixed_val, handle->stream));
 
-        return rocsparse_status_success;
+        info->csrilu0_mixed_size = 0;
+        info->csrilu0_mixed_val  = nullptr;
     }
 
+    // Shared meta data is only released once its last owner is cleared
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
     info->csrilu0_info = nullptr;
 
+    // Meta data of the multicolor reordered matrix
+    if(info->reorder_info != nullptr)
+    {
+        rocsparse_mat_info reorder = info->reorder_info->info;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(reorder->csrilu0_info));
+        reorder->csrilu0_info = nullptr;
+    }
+
     return rocsparse_status_success;
 }
 
@@ -185,6 +291,36 @@ extern "C" rocsparse_status rocsparse_dcsrilu0(rocsparse_handle handle,
         handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
+extern "C" rocsparse_status rocsparse_ccsrilu0(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               rocsparse_float_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               rocsparse_solve_policy policy,
+                                               void* temp_buffer)
+{
+    return rocsparse_csrilu0_template<rocsparse_float_complex>(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_zcsrilu0(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               rocsparse_double_complex* csr_val,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_mat_info info,
+                                               rocsparse_solve_policy policy,
+                                               void* temp_buffer)
+{
+    return rocsparse_csrilu0_template<rocsparse_double_complex>(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
 extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle handle,
                                                          rocsparse_mat_info info,
                                                          rocsparse_int* position)
@@ -211,6 +347,17 @@ extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle handle
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Fall back to the meta data of the multicolor reordered matrix, whose zero
+    // pivot is reported with respect to the original matrix
+    if(info->csrilu0_info == nullptr && info->reorder_info != nullptr &&
+       info->reorder_info->info->csrilu0_info != nullptr)
+    {
+        rocsparse_mat_info reordered    = info->reorder_info->info;
+        const rocsparse_int* zero_pivot = rocsparse_zero_pivot(reordered, &reordered->csrilu0_info);
+
+        return rocsparse_reorder_zero_pivot(handle, info->reorder_info, zero_pivot, position);
+    }
+
     // If m == 0 || nnz == 0 it can happen, that info structure is not created.
     // In this case, always return -1.
     if(info->csrilu0_info == nullptr)
@@ -227,14 +374,17 @@ extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle handle
         return rocsparse_status_success;
     }
 
+    // Zero pivot of the last factorization of this matrix
+    const rocsparse_int* zero_pivot = rocsparse_zero_pivot(info, &info->csrilu0_info);
+
     // Differentiate between pointer modes
     if(handle->pointer_mode == rocsparse_pointer_mode_device)
     {
         // rocsparse_pointer_mode_device
         rocsparse_int pivot;
 
-        RETURN_IF_HIP_ERROR(hipMemcpy(
-            &pivot, info->csrilu0_info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&pivot, zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
 
         if(pivot == std::numeric_limits<rocsparse_int>::max())
         {
@@ -242,10 +392,8 @@ extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle handle
         }
         else
         {
-            RETURN_IF_HIP_ERROR(hipMemcpy(position,
-                                          info->csrilu0_info->zero_pivot,
-                                          sizeof(rocsparse_int),
-                                          hipMemcpyDeviceToDevice));
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(position, zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToDevice));
 
             return rocsparse_status_zero_pivot;
         }
@@ -253,10 +401,8 @@ extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle handle
     else
     {
         // rocsparse_pointer_mode_host
-        RETURN_IF_HIP_ERROR(hipMemcpy(position,
-                                      info->csrilu0_info->zero_pivot,
-                                      sizeof(rocsparse_int),
-                                      hipMemcpyDeviceToHost));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(position, zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
 
         // If no zero pivot is found, set -1
         if(*position == std::numeric_limits<rocsparse_int>::max())
@@ -271,3 +417,28 @@ extern "C" rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle handle
 
     return rocsparse_status_success;
 }
+
+extern "C" rocsparse_status
+    rocsparse_csrilu0_convergence(rocsparse_handle handle, rocsparse_mat_info info, double* history)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrilu0_convergence", (const void*&)info, (const void*&)history);
+
+    // Check pointer arguments
+    if(history == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_iterative_convergence(handle, info, 0, info->csrilu0_sweeps, history);
+}
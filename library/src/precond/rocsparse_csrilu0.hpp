@@ -28,7 +28,9 @@
 #include "definitions.h"
 #include "rocsparse.h"
 #include "utility.h"
+#include "capture.h"
 #include "csrilu0_device.h"
+#include "csrilu0_iterative_device.h"
 #include "../level2/rocsparse_csrsv.hpp"
 
 #include <hip/hip_runtime.h>
@@ -91,7 +93,8 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle handle,
     }
 
     // Check solve policy
-    if(solve != rocsparse_solve_policy_auto)
+    if(solve != rocsparse_solve_policy_auto && solve != rocsparse_solve_policy_multicolor &&
+       solve != rocsparse_solve_policy_iterative)
     {
         return rocsparse_status_invalid_value;
     }
@@ -124,64 +127,141 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsrilu0_analysis",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    m,
+                                    nnz,
+                                    sizeof(rocsparse_int) * (m + 1 + nnz));
+
     // Quick return if possible
     if(m == 0 || nnz == 0)
     {
         return rocsparse_status_success;
     }
 
-    // Differentiate the analysis policies
-    if(analysis == rocsparse_analysis_policy_reuse)
+    // Multicolor policy analyses the reordered matrix
+    if(solve == rocsparse_solve_policy_multicolor)
     {
-        // We try to re-use already analyzed lower part, if available.
-        // It is the user's responsibility that this data is still valid,
-        // since he passed the 'reuse' flag.
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_reorder_analysis(
+            handle, m, nnz, descr, csr_row_ptr, csr_col_ind, info));
+
+        rocsparse_reorder_info reorder = info->reorder_info;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis_reuse(handle,
+                                                                 rocsparse_operation_none,
+                                                                 m,
+                                                                 nnz,
+                                                                 descr,
+                                                                 reorder->csr_row_ptr,
+                                                                 reorder->csr_col_ind,
+                                                                 reorder->info,
+                                                                 &reorder->info->csrilu0_info,
+                                                                 analysis,
+                                                                 temp_buffer));
 
-        // If csrilu0 meta data is already available, do nothing
-        if(info->csrilu0_info != nullptr)
-        {
-            return rocsparse_status_success;
-        }
+        return rocsparse_status_success;
+    }
 
-        // Check for other lower analysis meta data
-        rocsparse_csrtr_info reuse = nullptr;
+    // Perform analysis, or re-use data of a matrix with identical sparsity pattern
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis_reuse(handle,
+                                                             rocsparse_operation_none,
+                                                             m,
+                                                             nnz,
+                                                             descr,
+                                                             csr_row_ptr,
+                                                             csr_col_ind,
+                                                             info,
+                                                             &info->csrilu0_info,
+                                                             analysis,
+                                                             temp_buffer));
 
-        // csrsv_lower meta data
-        if(info->csrsv_lower_info != nullptr)
-        {
-            reuse = info->csrsv_lower_info;
-        }
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_iterative(rocsparse_handle handle,
+                                            rocsparse_int m,
+                                            rocsparse_int nnz,
+                                            const rocsparse_mat_descr descr,
+                                            T* csr_val,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            rocsparse_mat_info info)
+{
+    // Analysis has to be performed before the factorization
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
 
-        // TODO add more crossover data here
+    // Stream
+    hipStream_t stream = handle->stream;
 
-        // If data has been found, use it
-        if(reuse != nullptr)
-        {
-            info->csrilu0_info = reuse;
+    // Sweep history of the factorization
+    double* history;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_iterative_history(handle, info, &history));
 
-            return rocsparse_status_success;
-        }
-    }
+    rocsparse_int sweeps = info->csrilu0_sweeps;
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(history, 0, sizeof(double) * 2 * sweeps, stream));
+
+    // Sweeps require the values of A, while the factors are updated in place
+    rocsparse_workspace_scope workspace_scope(handle);
 
-    // User is explicitly asking to force a re-analysis, or no valid data has been
-    // found to be re-used.
+    T* csr_val_A;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_workspace_malloc(handle, (void**)&csr_val_A, sizeof(T) * nnz));
 
-    // Clear csrilu0 info
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrilu0_info));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        csr_val_A, csr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
 
-    // Create csrilu0 info
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrtr_info(&info->csrilu0_info));
+    // Re-initialize zero pivot, such that pivots of previous factorizations are not reported
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_reset_zero_pivot(
+        handle, info, &info->csrilu0_info, rocsparse_diag_type_non_unit));
 
-    // Perform analysis
-    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_analysis(handle,
-                                                       rocsparse_operation_none,
-                                                       m,
-                                                       nnz,
-                                                       descr,
-                                                       csr_row_ptr,
-                                                       csr_col_ind,
-                                                       info->csrilu0_info,
-                                                       temp_buffer));
+    rocsparse_int* zero_pivot = rocsparse_zero_pivot(info, &info->csrilu0_info);
+
+#define CSRILU0_ITERATIVE_DIM 256
+    dim3 csrilu0_blocks((nnz - 1) / CSRILU0_ITERATIVE_DIM + 1);
+    dim3 csrilu0_threads(CSRILU0_ITERATIVE_DIM);
+
+    hipLaunchKernelGGL((csrilu0_iterative_init_kernel<T, CSRILU0_ITERATIVE_DIM>),
+                       csrilu0_blocks,
+                       csrilu0_threads,
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val_A,
+                       csr_val,
+                       info->csrilu0_info->csr_diag_ind,
+                       descr->base);
+
+    // Fixed number of sweeps, convergence is monitored through the history only, such
+    // that no synchronization with the host is required
+    for(rocsparse_int sweep = 0; sweep < sweeps; ++sweep)
+    {
+        hipLaunchKernelGGL((csrilu0_iterative_sweep_kernel<T, CSRILU0_ITERATIVE_DIM>),
+                           csrilu0_blocks,
+                           csrilu0_threads,
+                           0,
+                           stream,
+                           m,
+                           nnz,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val_A,
+                           csr_val,
+                           info->csrilu0_info->csr_diag_ind,
+                           zero_pivot,
+                           history + 2 * sweep,
+                           descr->base);
+    }
+#undef CSRILU0_ITERATIVE_DIM
 
     return rocsparse_status_success;
 }
@@ -225,7 +305,11 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
               policy,
               (const void*&)temp_buffer);
 
-    log_bench(handle, "./rocsparse-bench -f csrilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+    // Operands are captured before they are factorized in place
+    std::string mtx = rocsparse_capture_csr(
+        handle, "csrilu0", m, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind);
+
+    log_bench(handle, "./rocsparse-bench -f csrilu0 -r", replaceX<T>("X"), "--mtx", mtx);
 
     // Check index base
     if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
@@ -238,6 +322,13 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
         return rocsparse_status_not_implemented;
     }
 
+    // Check solve policy
+    if(policy != rocsparse_solve_policy_auto && policy != rocsparse_solve_policy_multicolor &&
+       policy != rocsparse_solve_policy_iterative)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
     // Check sizes
     if(m < 0)
     {
@@ -266,15 +357,87 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_Xcsrilu0",
+                                    rocsparse_precision_string<T>(),
+                                    m,
+                                    m,
+                                    nnz,
+                                    (2 * sizeof(T) + sizeof(rocsparse_int)) * nnz +
+                                        sizeof(rocsparse_int) * (m + 1));
+
     // Quick return if possible
     if(m == 0 || nnz == 0)
     {
         return rocsparse_status_success;
     }
 
+    // Multicolor policy factorizes the reordered matrix, the factors are stored in
+    // the original layout
+    if(policy == rocsparse_solve_policy_multicolor)
+    {
+        rocsparse_reorder_info reorder = info->reorder_info;
+
+        // Reordering has to be computed by the analysis
+        if(reorder == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_check_pattern(
+            handle, m, nnz, descr, csr_row_ptr, csr_col_ind, info, reorder->key));
+
+        rocsparse_workspace_scope workspace_scope(handle);
+
+        T* csr_val_B;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_workspace_malloc(handle, (void**)&csr_val_B, sizeof(T) * nnz));
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_reorder_gather(handle, nnz, reorder->map, csr_val, csr_val_B));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrilu0_template(handle,
+                                                             m,
+                                                             nnz,
+                                                             descr,
+                                                             csr_val_B,
+                                                             reorder->csr_row_ptr,
+                                                             reorder->csr_col_ind,
+                                                             reorder->info,
+                                                             rocsparse_solve_policy_auto,
+                                                             temp_buffer));
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_reorder_scatter(handle, nnz, reorder->map, csr_val_B, csr_val));
+
+        return rocsparse_status_success;
+    }
+
+    // Analysis has to be performed before the factorization
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrtr_check_pattern(
+        handle, m, nnz, descr, csr_row_ptr, csr_col_ind, info, info->csrilu0_info->key));
+
+    // Iterative policy approximates the factors by a fixed number of fixed-point sweeps
+    if(policy == rocsparse_solve_policy_iterative)
+    {
+        return rocsparse_csrilu0_iterative(
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info);
+    }
+
     // Stream
     hipStream_t stream = handle->stream;
 
+    // Re-initialize zero pivot, the analysis data might be shared with other matrices
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_reset_zero_pivot(
+        handle, info, &info->csrilu0_info, rocsparse_diag_type_non_unit));
+
+    rocsparse_int* zero_pivot = rocsparse_zero_pivot(info, &info->csrilu0_info);
+
     // Buffer
     char* ptr = reinterpret_cast<char*>(temp_buffer);
 
@@ -308,7 +471,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
         else if(info->csrilu0_info->max_nnz <= 64)
@@ -325,7 +488,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
         else if(info->csrilu0_info->max_nnz <= 128)
@@ -342,7 +505,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
         else if(info->csrilu0_info->max_nnz <= 256)
@@ -359,7 +522,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
         else if(info->csrilu0_info->max_nnz <= 512)
@@ -376,7 +539,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
         else
@@ -393,7 +556,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
     }
@@ -413,7 +576,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
         else if(info->csrilu0_info->max_nnz <= 128)
@@ -430,7 +593,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
         else if(info->csrilu0_info->max_nnz <= 256)
@@ -447,7 +610,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
         else if(info->csrilu0_info->max_nnz <= 512)
@@ -464,7 +627,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
         else if(info->csrilu0_info->max_nnz <= 1024)
@@ -481,7 +644,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
         else
@@ -498,7 +661,7 @@ rocsparse_status rocsparse_csrilu0_template(rocsparse_handle handle,
                                info->csrilu0_info->csr_diag_ind,
                                d_done_array,
                                info->csrilu0_info->d_row_map,
-                               info->csrilu0_info->zero_pivot,
+                               zero_pivot,
                                descr->base);
         }
     }
@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "rocsparse.h"
+#include "rocsparse_csrilu0_mixed.hpp"
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_dscsrilu0(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_mat_info info,
+                                                rocsparse_solve_policy policy,
+                                                void* temp_buffer)
+{
+    return rocsparse_csrilu0_mixed_template<double, float>(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+extern "C" rocsparse_status rocsparse_dscsrilu0_solve_buffer_size(rocsparse_handle handle,
+                                                                  rocsparse_int m,
+                                                                  rocsparse_int nnz,
+                                                                  const rocsparse_mat_descr descr,
+                                                                  const double* csr_val,
+                                                                  const rocsparse_int* csr_row_ptr,
+                                                                  const rocsparse_int* csr_col_ind,
+                                                                  rocsparse_mat_info info,
+                                                                  size_t* buffer_size)
+{
+    return rocsparse_csrilu0_mixed_solve_buffer_size_template<double, float>(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+extern "C" rocsparse_status rocsparse_dscsrilu0_solve(rocsparse_handle handle,
+                                                      rocsparse_int m,
+                                                      rocsparse_int nnz,
+                                                      const rocsparse_mat_descr descr,
+                                                      const double* csr_val,
+                                                      const rocsparse_int* csr_row_ptr,
+                                                      const rocsparse_int* csr_col_ind,
+                                                      rocsparse_mat_info info,
+                                                      const double* b,
+                                                      double* x,
+                                                      rocsparse_int max_iter,
+                                                      double tol,
+                                                      rocsparse_int* iter,
+                                                      double* res,
+                                                      rocsparse_solve_policy policy,
+                                                      void* temp_buffer)
+{
+    return rocsparse_csrilu0_mixed_solve_template<double, float>(handle,
+                                                                 m,
+                                                                 nnz,
+                                                                 descr,
+                                                                 csr_val,
+                                                                 csr_row_ptr,
+                                                                 csr_col_ind,
+                                                                 info,
+                                                                 b,
+                                                                 x,
+                                                                 max_iter,
+                                                                 tol,
+                                                                 iter,
+                                                                 res,
+                                                                 policy,
+                                                                 temp_buffer);
+}
@@ -0,0 +1,665 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRILU0_MIXED_HPP
+#define ROCSPARSE_CSRILU0_MIXED_HPP
+
+#include "definitions.h"
+#include "rocsparse.h"
+#include "utility.h"
+#include "capture.h"
+#include "csrilu0_mixed_device.h"
+#include "rocsparse_csrilu0.hpp"
+#include "../level2/rocsparse_csrsv.hpp"
+// csrmv has to be included last, it defines BLOCKSIZE
+#include "../level2/rocsparse_csrmv.hpp"
+
+#include <hip/hip_runtime.h>
+
+// T is the working precision of the system, U the precision of the factors
+template <typename T, typename U>
+rocsparse_status rocsparse_csrilu0_mixed_template(rocsparse_handle handle,
+                                                  rocsparse_int m,
+                                                  rocsparse_int nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T* csr_val,
+                                                  const rocsparse_int* csr_row_ptr,
+                                                  const rocsparse_int* csr_col_ind,
+                                                  rocsparse_mat_info info,
+                                                  rocsparse_solve_policy policy,
+                                                  void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_dscsrilu0",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_dscsrilu0",
+                                    "",
+                                    m,
+                                    m,
+                                    nnz,
+                                    (sizeof(T) + 2 * sizeof(U) + sizeof(rocsparse_int)) * nnz +
+                                        sizeof(rocsparse_int) * (m + 1));
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // csrilu0 analysis is required. Its meta data only depends on the sparsity
+    // pattern, thus it might have been obtained in any precision. The multicolor
+    // policy holds it with the reordered matrix.
+    rocsparse_mat_info meta = info;
+
+    if(policy == rocsparse_solve_policy_multicolor)
+    {
+        if(info->reorder_info == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        meta = info->reorder_info->info;
+    }
+
+    if(meta->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // (Re-)allocate the low precision factors, if required
+    if(info->csrilu0_mixed_size < sizeof(U) * nnz)
+    {
+        if(info->csrilu0_mixed_val != nullptr)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(
+                info->csrilu0_mixed_allocator, info->csrilu0_mixed_val, stream));
+
+            info->csrilu0_mixed_size = 0;
+            info->csrilu0_mixed_val  = nullptr;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_device_malloc_memory(handle, &info->csrilu0_mixed_val, sizeof(U) * nnz));
+        info->csrilu0_mixed_allocator = handle->allocator;
+        info->csrilu0_mixed_size = sizeof(U) * nnz;
+    }
+
+    U* csr_val_low = reinterpret_cast<U*>(info->csrilu0_mixed_val);
+
+#define CSRILU0_MIXED_DIM 512
+    dim3 convert_blocks((nnz - 1) / CSRILU0_MIXED_DIM + 1);
+    dim3 convert_threads(CSRILU0_MIXED_DIM);
+
+    hipLaunchKernelGGL((csrilu0_mixed_convert_kernel<T, U>),
+                       convert_blocks,
+                       convert_threads,
+                       0,
+                       stream,
+                       nnz,
+                       csr_val,
+                       csr_val_low);
+#undef CSRILU0_MIXED_DIM
+
+    // Factorize the low precision copy, A itself is kept for the residual computation
+    return rocsparse_csrilu0_template<U>(
+        handle, m, nnz, descr, csr_val_low, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrilu0_mixed_solve_buffer_size_template(
+    rocsparse_handle handle,
+    rocsparse_int m,
+    rocsparse_int nnz,
+    const rocsparse_mat_descr descr,
+    const T* csr_val,
+    const rocsparse_int* csr_row_ptr,
+    const rocsparse_int* csr_col_ind,
+    rocsparse_mat_info info,
+    size_t* buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_dscsrilu0_solve_buffer_size",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Triangular solve buffer, this also checks all remaining arguments
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size_template(handle,
+                                                                   rocsparse_operation_none,
+                                                                   m,
+                                                                   nnz,
+                                                                   descr,
+                                                                   csr_val,
+                                                                   csr_row_ptr,
+                                                                   csr_col_ind,
+                                                                   info,
+                                                                   buffer_size));
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // T residual[m]
+    *buffer_size += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    // U residual[m], U intermediate solution[m] and U correction[m]
+    *buffer_size += sizeof(U) * ((m - 1) / 256 + 1) * 256 * 3;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilu0_mixed_nrm(rocsparse_handle handle,
+                                             rocsparse_int m,
+                                             const T* x,
+                                             T* result)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define NRM_DIM 1024
+    rocsparse_int nblocks = NRM_DIM;
+
+    // Get workspace from handle device buffer
+    RETURN_IF_ROCSPARSE_ERROR(handle->init_buffer());
+    T* workspace = reinterpret_cast<T*>(handle->buffer);
+
+    dim3 nrm_blocks(nblocks);
+    dim3 nrm_threads(NRM_DIM);
+
+    hipLaunchKernelGGL((csrilu0_mixed_nrm_part1<T, NRM_DIM>),
+                       nrm_blocks,
+                       nrm_threads,
+                       0,
+                       stream,
+                       m,
+                       x,
+                       workspace);
+
+    hipLaunchKernelGGL((csrilu0_mixed_nrm_part2<T, NRM_DIM>),
+                       dim3(1),
+                       nrm_threads,
+                       0,
+                       stream,
+                       nblocks,
+                       workspace);
+#undef NRM_DIM
+
+    RETURN_IF_HIP_ERROR(hipMemcpy(result, workspace, sizeof(T), hipMemcpyDeviceToHost));
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrilu0_mixed_refine(rocsparse_handle handle,
+                                                rocsparse_int m,
+                                                rocsparse_int nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const T* csr_val,
+                                                const rocsparse_int* csr_row_ptr,
+                                                const rocsparse_int* csr_col_ind,
+                                                rocsparse_mat_info info,
+                                                const T* b,
+                                                T* x,
+                                                rocsparse_int max_iter,
+                                                T tol,
+                                                rocsparse_int* iter,
+                                                T* res,
+                                                rocsparse_solve_policy policy,
+                                                void* temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // T residual
+    T* r = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    // U residual
+    U* r_low = reinterpret_cast<U*>(ptr);
+    ptr += sizeof(U) * ((m - 1) / 256 + 1) * 256;
+
+    // U intermediate solution of the lower triangular solve
+    U* t = reinterpret_cast<U*>(ptr);
+    ptr += sizeof(U) * ((m - 1) / 256 + 1) * 256;
+
+    // U correction
+    U* z = reinterpret_cast<U*>(ptr);
+    ptr += sizeof(U) * ((m - 1) / 256 + 1) * 256;
+
+    // Remaining buffer is used by the triangular solves
+    void* csrsv_buffer = reinterpret_cast<void*>(ptr);
+
+    // Descriptors of the unit lower and the upper triangular factor
+    _rocsparse_mat_descr descr_L = *descr;
+    _rocsparse_mat_descr descr_U = *descr;
+
+    descr_L.fill_mode = rocsparse_fill_mode_lower;
+    descr_L.diag_type = rocsparse_diag_type_unit;
+    descr_U.fill_mode = rocsparse_fill_mode_upper;
+    descr_U.diag_type = rocsparse_diag_type_non_unit;
+
+    const U* csr_val_low = reinterpret_cast<const U*>(info->csrilu0_mixed_val);
+
+    T one       = static_cast<T>(1);
+    T minus_one = static_cast<T>(-1);
+    U one_low   = static_cast<U>(1);
+
+    // Scale of the relative residual
+    T nrm_b;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrilu0_mixed_nrm(handle, m, b, &nrm_b));
+
+    if(nrm_b == static_cast<T>(0))
+    {
+        nrm_b = one;
+    }
+
+#define CSRILU0_MIXED_DIM 512
+    dim3 csrilu0_mixed_blocks((m - 1) / CSRILU0_MIXED_DIM + 1);
+    dim3 csrilu0_mixed_threads(CSRILU0_MIXED_DIM);
+
+    for(rocsparse_int k = 0;; ++k)
+    {
+        // r = b - A * x in working precision
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(r, b, sizeof(T) * m, hipMemcpyDeviceToDevice, stream));
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrmv_template<T, T>(handle,
+                                                                  rocsparse_operation_none,
+                                                                  m,
+                                                                  m,
+                                                                  nnz,
+                                                                  &minus_one,
+                                                                  descr,
+                                                                  csr_val,
+                                                                  csr_row_ptr,
+                                                                  csr_col_ind,
+                                                                  info,
+                                                                  x,
+                                                                  &one,
+                                                                  r)));
+
+        T nrm_r;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrilu0_mixed_nrm(handle, m, r, &nrm_r));
+
+        *iter = k;
+        *res  = nrm_r / nrm_b;
+
+        // Check for convergence
+        if(*res <= tol || k == max_iter || nrm_r == static_cast<T>(0))
+        {
+            break;
+        }
+
+        // Solve L * U * z = r / ||r|| in low precision
+        hipLaunchKernelGGL((csrilu0_mixed_scale_kernel<T, U>),
+                           csrilu0_mixed_blocks,
+                           csrilu0_mixed_threads,
+                           0,
+                           stream,
+                           m,
+                           one / nrm_r,
+                           r,
+                           r_low);
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_solve_template(handle,
+                                                                 rocsparse_operation_none,
+                                                                 m,
+                                                                 nnz,
+                                                                 &one_low,
+                                                                 &descr_L,
+                                                                 csr_val_low,
+                                                                 csr_row_ptr,
+                                                                 csr_col_ind,
+                                                                 info,
+                                                                 r_low,
+                                                                 t,
+                                                                 policy,
+                                                                 csrsv_buffer));
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_solve_template(handle,
+                                                                 rocsparse_operation_none,
+                                                                 m,
+                                                                 nnz,
+                                                                 &one_low,
+                                                                 &descr_U,
+                                                                 csr_val_low,
+                                                                 csr_row_ptr,
+                                                                 csr_col_ind,
+                                                                 info,
+                                                                 t,
+                                                                 z,
+                                                                 policy,
+                                                                 csrsv_buffer));
+
+        // x = x + ||r|| * z in working precision
+        hipLaunchKernelGGL((csrilu0_mixed_update_kernel<T, U>),
+                           csrilu0_mixed_blocks,
+                           csrilu0_mixed_threads,
+                           0,
+                           stream,
+                           m,
+                           nrm_r,
+                           z,
+                           x);
+    }
+#undef CSRILU0_MIXED_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrilu0_mixed_solve_template(rocsparse_handle handle,
+                                                        rocsparse_int m,
+                                                        rocsparse_int nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T* csr_val,
+                                                        const rocsparse_int* csr_row_ptr,
+                                                        const rocsparse_int* csr_col_ind,
+                                                        rocsparse_mat_info info,
+                                                        const T* b,
+                                                        T* x,
+                                                        rocsparse_int max_iter,
+                                                        T tol,
+                                                        rocsparse_int* iter,
+                                                        T* res,
+                                                        rocsparse_solve_policy policy,
+                                                        void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_dscsrilu0_solve",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              (const void*&)b,
+              (const void*&)x,
+              max_iter,
+              tol,
+              (const void*&)iter,
+              (const void*&)res,
+              policy,
+              (const void*&)temp_buffer);
+
+    std::string mtx = rocsparse_capture_csr(
+        handle, "csrilu0_mixed", m, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrilu0_mixed -r d",
+              "--mtx",
+              mtx,
+              "--iters",
+              max_iter);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        // TODO
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(max_iter < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(b == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(iter == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(res == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_dscsrilu0_solve",
+                                    "",
+                                    m,
+                                    m,
+                                    nnz,
+                                    (sizeof(U) + sizeof(rocsparse_int)) * nnz +
+                                        sizeof(rocsparse_int) * (m + 1) + 2 * sizeof(T) * m);
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        *iter = 0;
+        *res  = static_cast<T>(0);
+
+        return rocsparse_status_success;
+    }
+
+    // Low precision factors and the triangular analysis of both factors are required,
+    // the multicolor policy holds the analysis with the reordered matrix
+    rocsparse_mat_info meta = info;
+
+    if(policy == rocsparse_solve_policy_multicolor)
+    {
+        if(info->reorder_info == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        meta = info->reorder_info->info;
+    }
+
+    if(info->csrilu0_mixed_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(meta->csrsv_lower_info == nullptr || meta->csrsv_upper_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // All scalars are passed internally by host pointer
+    rocsparse_pointer_mode pointer_mode = handle->pointer_mode;
+    handle->pointer_mode                = rocsparse_pointer_mode_host;
+
+    rocsparse_status status = rocsparse_csrilu0_mixed_refine<T, U>(handle,
+                                                                   m,
+                                                                   nnz,
+                                                                   descr,
+                                                                   csr_val,
+                                                                   csr_row_ptr,
+                                                                   csr_col_ind,
+                                                                   info,
+                                                                   b,
+                                                                   x,
+                                                                   max_iter,
+                                                                   tol,
+                                                                   iter,
+                                                                   res,
+                                                                   policy,
+                                                                   temp_buffer);
+
+    handle->pointer_mode = pointer_mode;
+
+    return status;
+}
+
+#endif // ROCSPARSE_CSRILU0_MIXED_HPP
@@ -0,0 +1,374 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "profile.h"
+#include "definitions.h"
+#include "handle.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <math.h>
+
+// Host time stamp in microseconds
+static double profile_time_us()
+{
+    return std::chrono::duration<double, std::micro>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/*******************************************************************************
+ * rocsparse_profile_key
+ ******************************************************************************/
+bool rocsparse_profile_key::operator<(const rocsparse_profile_key& rhs) const
+{
+    if(name != rhs.name)
+    {
+        return name < rhs.name;
+    }
+    if(m != rhs.m)
+    {
+        return m < rhs.m;
+    }
+    if(n != rhs.n)
+    {
+        return n < rhs.n;
+    }
+    return nnz < rhs.nnz;
+}
+
+/*******************************************************************************
+ * rocsparse_profile_stats
+ ******************************************************************************/
+// Upper bound of a histogram bucket in microseconds
+static double profile_bucket_bound(int bucket)
+{
+    return pow(2.0, static_cast<double>(bucket) / ROCSPARSE_PROFILE_SUBBUCKETS);
+}
+
+void rocsparse_profile_stats::add(double time, double host_time, size_t call_bytes)
+{
+    min = (calls == 0 || time < min) ? time : min;
+    max = (calls == 0 || time > max) ? time : max;
+
+    ++calls;
+    total += time;
+    host_total += host_time;
+    bytes += call_bytes;
+
+    // Bucket 0 holds all calls below 1 us
+    int bucket = 0;
+
+    if(time >= 1.0)
+    {
+        bucket = 1 + static_cast<int>(log2(time) * ROCSPARSE_PROFILE_SUBBUCKETS);
+        bucket = std::min(bucket, ROCSPARSE_PROFILE_BUCKETS - 1);
+    }
+
+    ++histogram[bucket];
+}
+
+double rocsparse_profile_stats::percentile(double fraction) const
+{
+    size_t rank  = static_cast<size_t>(ceil(fraction * calls));
+    size_t count = 0;
+
+    for(int i = 0; i < ROCSPARSE_PROFILE_BUCKETS; ++i)
+    {
+        count += histogram[i];
+
+        if(count >= rank && count > 0)
+        {
+            // Upper bound of the bucket, clamped to the observed range
+            return std::max(min, std::min(max, profile_bucket_bound(i)));
+        }
+    }
+
+    return max;
+}
+
+/*******************************************************************************
+ * rocsparse_profile
+ ******************************************************************************/
+rocsparse_profile::~rocsparse_profile()
+{
+    resolve(true);
+
+    for(size_t i = 0; i < event_pool.size(); ++i)
+    {
+        PRINT_IF_HIP_ERROR(hipEventDestroy(event_pool[i]));
+    }
+}
+
+hipError_t rocsparse_profile::get_events(hipEvent_t* start, hipEvent_t* stop)
+{
+    hipEvent_t events[2];
+
+    for(int i = 0; i < 2; ++i)
+    {
+        if(event_pool.empty())
+        {
+            hipError_t err = hipEventCreate(&events[i]);
+
+            if(err != hipSuccess)
+            {
+                if(i == 1)
+                {
+                    event_pool.push_back(events[0]);
+                }
+
+                return err;
+            }
+        }
+        else
+        {
+            events[i] = event_pool.back();
+            event_pool.pop_back();
+        }
+    }
+
+    *start = events[0];
+    *stop  = events[1];
+
+    return hipSuccess;
+}
+
+void rocsparse_profile::push(const rocsparse_profile_call& call)
+{
+    pending.push_back(call);
+
+    // Bound the number of pending calls, waiting for the oldest ones only
+    resolve(false);
+
+    while(pending.size() > ROCSPARSE_PROFILE_MAX_PENDING)
+    {
+        hipEventSynchronize(pending.front().stop);
+        resolve(false);
+    }
+}
+
+void rocsparse_profile::resolve(bool wait)
+{
+    while(!pending.empty())
+    {
+        rocsparse_profile_call& call = pending.front();
+
+        if(wait)
+        {
+            hipEventSynchronize(call.stop);
+        }
+        else if(hipEventQuery(call.stop) != hipSuccess)
+        {
+            break;
+        }
+
+        float time;
+        if(hipEventElapsedTime(&time, call.start, call.stop) == hipSuccess)
+        {
+            stats[call.key].add(time * 1e3, call.host_time, call.bytes);
+        }
+
+        event_pool.push_back(call.start);
+        event_pool.push_back(call.stop);
+        pending.pop_front();
+    }
+}
+
+void rocsparse_profile::reset()
+{
+    resolve(true);
+    stats.clear();
+}
+
+// Quote string for JSON output
+static std::string profile_json_string(const std::string& str)
+{
+    std::string quoted = "\"";
+
+    for(size_t i = 0; i < str.size(); ++i)
+    {
+        if(str[i] == '"' || str[i] == '\\')
+        {
+            quoted += '\\';
+        }
+        quoted += str[i];
+    }
+
+    return quoted + "\"";
+}
+
+void rocsparse_profile::write(std::ostream& os, rocsparse_profile_format format)
+{
+    resolve(true);
+
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision     = os.precision();
+
+    os << std::fixed << std::setprecision(2);
+
+    if(format == rocsparse_profile_format_json)
+    {
+        os << "[";
+
+        for(auto it = stats.begin(); it != stats.end(); ++it)
+        {
+            const rocsparse_profile_key& key = it->first;
+            const rocsparse_profile_stats& s = it->second;
+
+            os << (it == stats.begin() ? "\n" : ",\n") << "  {\"routine\": "
+               << profile_json_string(key.name) << ", \"m\": " << key.m << ", \"n\": " << key.n
+               << ", \"nnz\": " << key.nnz << ", \"calls\": " << s.calls
+               << ", \"total_us\": " << s.total << ", \"min_us\": " << s.min
+               << ", \"avg_us\": " << s.total / s.calls << ", \"p50_us\": " << s.percentile(0.5)
+               << ", \"p90_us\": " << s.percentile(0.9) << ", \"p99_us\": " << s.percentile(0.99)
+               << ", \"max_us\": " << s.max << ", \"host_avg_us\": " << s.host_total / s.calls
+               << ", \"bytes\": " << s.bytes
+               << ", \"gbyte_s\": " << (s.total > 0.0 ? s.bytes / s.total * 1e-3 : 0.0)
+               << ", \"histogram\": [";
+
+            // Non empty buckets as pairs of upper bound and number of calls
+            bool first = true;
+
+            for(int i = 0; i < ROCSPARSE_PROFILE_BUCKETS; ++i)
+            {
+                if(s.histogram[i] == 0)
+                {
+                    continue;
+                }
+
+                os << (first ? "[" : ", [") << profile_bucket_bound(i) << ", " << s.histogram[i]
+                   << "]";
+                first = false;
+            }
+
+            os << "]}";
+        }
+
+        os << "\n]\n";
+    }
+    else
+    {
+        os << "\nrocSPARSE profile, times in microseconds\n";
+        os << std::left << std::setw(36) << "routine" << std::right << std::setw(10) << "m"
+           << std::setw(10) << "n" << std::setw(12) << "nnz" << std::setw(10) << "calls"
+           << std::setw(14) << "total" << std::setw(12) << "min" << std::setw(12) << "avg"
+           << std::setw(12) << "p50" << std::setw(12) << "p90" << std::setw(12) << "p99"
+           << std::setw(12) << "max" << std::setw(12) << "host avg" << std::setw(10) << "GB/s"
+           << "\n";
+
+        for(auto it = stats.begin(); it != stats.end(); ++it)
+        {
+            const rocsparse_profile_key& key = it->first;
+            const rocsparse_profile_stats& s = it->second;
+
+            os << std::left << std::setw(36) << key.name << std::right << std::setw(10) << key.m
+               << std::setw(10) << key.n << std::setw(12) << key.nnz << std::setw(10) << s.calls
+               << std::setw(14) << s.total << std::setw(12) << s.min << std::setw(12)
+               << s.total / s.calls << std::setw(12) << s.percentile(0.5) << std::setw(12)
+               << s.percentile(0.9) << std::setw(12) << s.percentile(0.99) << std::setw(12)
+               << s.max << std::setw(12) << s.host_total / s.calls << std::setw(10)
+               << (s.total > 0.0 ? s.bytes / s.total * 1e-3 : 0.0) << "\n";
+        }
+    }
+
+    os.flags(flags);
+    os.precision(precision);
+    os.flush();
+}
+
+/*******************************************************************************
+ * rocsparse_profile_scope
+ ******************************************************************************/
+rocsparse_profile_scope::rocsparse_profile_scope(rocsparse_handle handle,
+                                                 const char* name,
+                                                 const char* precision,
+                                                 rocsparse_int m,
+                                                 rocsparse_int n,
+                                                 rocsparse_int nnz,
+                                                 size_t bytes)
+    : name_(name)
+    , precision_(precision)
+    , m_(m)
+    , n_(n)
+    , nnz_(nnz)
+    , bytes_(bytes)
+{
+    if(handle == nullptr || !(handle->layer_mode & rocsparse_layer_mode_log_profile))
+    {
+        return;
+    }
+
+    // Calls that cannot be timed are not profiled
+    if(handle->profile.get_events(&start_, &stop_) != hipSuccess)
+    {
+        return;
+    }
+
+    if(hipEventRecord(start_, handle->stream) != hipSuccess)
+    {
+        handle->profile.event_pool.push_back(start_);
+        handle->profile.event_pool.push_back(stop_);
+        return;
+    }
+
+    handle_     = handle;
+    host_start_ = profile_time_us();
+}
+
+rocsparse_profile_scope::~rocsparse_profile_scope()
+{
+    if(handle_ == nullptr)
+    {
+        return;
+    }
+
+    double host_time = profile_time_us() - host_start_;
+
+    if(hipEventRecord(stop_, handle_->stream) != hipSuccess)
+    {
+        handle_->profile.event_pool.push_back(start_);
+        handle_->profile.event_pool.push_back(stop_);
+        return;
+    }
+
+    rocsparse_profile_call call;
+
+    call.key.name  = name_;
+    call.key.m     = m_;
+    call.key.n     = n_;
+    call.key.nnz   = nnz_;
+    call.start     = start_;
+    call.stop      = stop_;
+    call.host_time = host_time;
+    call.bytes     = bytes_;
+
+    size_t pos = call.key.name.find('X');
+    if(pos != std::string::npos)
+    {
+        call.key.name.replace(pos, 1, precision_);
+    }
+
+    handle_->profile.push(call);
+}
@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRCOLOR_DEVICE_H
+#define CSRCOLOR_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// Random priority of a row, ties are broken by the row index
+static __device__ __forceinline__ unsigned int csrcolor_hash(rocsparse_int row)
+{
+    unsigned int h = static_cast<unsigned int>(row) * 0x9e3779b9u;
+
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+
+    return h;
+}
+
+static __device__ __forceinline__ bool
+    csrcolor_greater(unsigned int hash_a, rocsparse_int a, unsigned int hash_b, rocsparse_int b)
+{
+    return hash_a > hash_b || (hash_a == hash_b && a > b);
+}
+
+// Jones-Plassmann selection, each uncolored row whose priority is a local maximum
+// (selection 1) or a local minimum (selection 2) among its uncolored neighbors is a
+// candidate for the colors of this round
+__global__ void csrcolor_select_kernel(rocsparse_int m,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const rocsparse_int* __restrict__ coloring,
+                                       rocsparse_int* __restrict__ selection,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(coloring[row] != -1)
+    {
+        selection[row] = 0;
+        return;
+    }
+
+    unsigned int hash = csrcolor_hash(row);
+
+    bool is_max = true;
+    bool is_min = true;
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col == row || coloring[col] != -1)
+        {
+            continue;
+        }
+
+        unsigned int col_hash = csrcolor_hash(col);
+
+        if(csrcolor_greater(col_hash, col, hash, row))
+        {
+            is_max = false;
+        }
+        else
+        {
+            is_min = false;
+        }
+    }
+
+    selection[row] = is_max ? 1 : (is_min ? 2 : 0);
+}
+
+// Only the row that owns an entry sees the edge to its column. Of two adjacent
+// candidates of the same set, the column is removed, such that each set remains
+// independent also for unsymmetric sparsity patterns. The global extremum is never
+// removed, thus every round colors at least one row.
+__global__ void csrcolor_conflict_kernel(rocsparse_int m,
+                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                         const rocsparse_int* __restrict__ csr_col_ind,
+                                         rocsparse_int* selection,
+                                         rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int set = selection[row];
+
+    if(set == 0)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col != row && selection[col] == set)
+        {
+            selection[col] = 0;
+        }
+    }
+}
+
+// Assign the colors of this round and count the colored rows
+__global__ void csrcolor_assign_kernel(rocsparse_int m,
+                                       rocsparse_int color,
+                                       const rocsparse_int* __restrict__ selection,
+                                       rocsparse_int* __restrict__ coloring,
+                                       rocsparse_int* __restrict__ stats)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int set = selection[row];
+
+    if(set == 0)
+    {
+        return;
+    }
+
+    coloring[row] = color + set - 1;
+
+    // stats[0] counts the rows colored in this round, stats[1] the rows of the
+    // minimum set, which can be empty
+    atomicAdd(&stats[0], 1);
+
+    if(set == 2)
+    {
+        atomicAdd(&stats[1], 1);
+    }
+}
+
+// Identity permutation, sorted along the colors
+__global__ void csrcolor_identity_kernel(rocsparse_int m, rocsparse_int* __restrict__ identity)
+{
+    rocsparse_int row = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    identity[row] = row;
+}
+
+#endif // CSRCOLOR_DEVICE_H
@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRPERMUTE_DEVICE_H
+#define CSRPERMUTE_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// Compute the inverse permutation, invperm[perm[i]] = i
+__global__ void csrpermute_inverse_kernel(rocsparse_int m,
+                                          const rocsparse_int* __restrict__ perm,
+                                          rocsparse_int* __restrict__ invperm)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    invperm[perm[gid]] = gid;
+}
+
+// Row i of the permuted matrix holds the entries of row perm[i] of the original matrix.
+// The row lengths are written shifted by one, such that an inclusive scan over m + 1
+// elements yields the row pointer array.
+__global__ void csrpermute_nnz_per_row_kernel(rocsparse_int m,
+                                              const rocsparse_int* __restrict__ csr_row_ptr,
+                                              const rocsparse_int* __restrict__ perm,
+                                              rocsparse_int* __restrict__ csr_row_ptr_B,
+                                              rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid == 0)
+    {
+        csr_row_ptr_B[0] = idx_base;
+    }
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row = perm[gid];
+
+    csr_row_ptr_B[gid + 1] = csr_row_ptr[row + 1] - csr_row_ptr[row];
+}
+
+// Copy the column entries of each row to its new position, renumber them by the inverse
+// permutation and store the position of each entry within the original matrix. Each row
+// is processed by a sub-wavefront of WF_SIZE threads.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrpermute_fill_kernel(rocsparse_int m,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                const rocsparse_int* __restrict__ perm,
+                                const rocsparse_int* __restrict__ invperm,
+                                const rocsparse_int* __restrict__ csr_row_ptr_B,
+                                rocsparse_int* __restrict__ csr_col_ind_B,
+                                rocsparse_int* __restrict__ map,
+                                rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    rocsparse_int row = gid / WF_SIZE;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int src_begin = csr_row_ptr[perm[row]] - idx_base;
+    rocsparse_int src_end   = csr_row_ptr[perm[row] + 1] - idx_base;
+    rocsparse_int dst_begin = csr_row_ptr_B[row] - idx_base;
+
+    for(rocsparse_int j = src_begin + lid; j < src_end; j += WF_SIZE)
+    {
+        rocsparse_int idx = dst_begin + j - src_begin;
+
+        csr_col_ind_B[idx] = invperm[csr_col_ind[j] - idx_base] + idx_base;
+        map[idx]           = j;
+    }
+}
+
+#endif // CSRPERMUTE_DEVICE_H
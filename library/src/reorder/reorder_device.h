@@ -0,0 +1,65 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef REORDER_DEVICE_H
+#define REORDER_DEVICE_H
+
+#include <hip/hip_runtime.h>
+
+// y[i] = x[ind[i]], with zero based indices
+template <typename T>
+__global__ void reorder_gather_kernel(rocsparse_int n,
+                                      const rocsparse_int* __restrict__ ind,
+                                      const T* __restrict__ x,
+                                      T* __restrict__ y)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= n)
+    {
+        return;
+    }
+
+    y[gid] = x[ind[gid]];
+}
+
+// y[ind[i]] = x[i], with zero based indices
+template <typename T>
+__global__ void reorder_scatter_kernel(rocsparse_int n,
+                                       const rocsparse_int* __restrict__ ind,
+                                       const T* __restrict__ x,
+                                       T* __restrict__ y)
+{
+    rocsparse_int gid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(gid >= n)
+    {
+        return;
+    }
+
+    y[ind[gid]] = x[gid];
+}
+
+#endif // REORDER_DEVICE_H
@@ -0,0 +1,328 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "csrcolor_device.h"
+
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+
+extern "C" rocsparse_status rocsparse_csrcolor_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int m,
+                                                           rocsparse_int nnz,
+                                                           const rocsparse_int* csr_row_ptr,
+                                                           const rocsparse_int* csr_col_ind,
+                                                           size_t* buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrcolor_buffer_size",
+              m,
+              nnz,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        *buffer_size = 0;
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    // Statistics of a coloring round
+    *buffer_size = 256;
+
+    // Selection buffer
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Identity and sorted color buffers
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256 * 2;
+
+    // hipcub buffer for sorting the rows by color
+    size_t size;
+    RETURN_IF_HIP_ERROR(
+        hipcub::DeviceRadixSort::SortPairs(nullptr, size, ptr, ptr, ptr, ptr, m, 0, 32, stream));
+
+    *buffer_size += ((size - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrcolor(rocsparse_handle handle,
+                                               rocsparse_int m,
+                                               rocsparse_int nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_int* csr_row_ptr,
+                                               const rocsparse_int* csr_col_ind,
+                                               rocsparse_int* ncolors,
+                                               rocsparse_int* coloring,
+                                               rocsparse_int* perm,
+                                               void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrcolor",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)ncolors,
+              (const void*&)coloring,
+              (const void*&)perm,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrcolor", "--mtx <matrix.mtx>");
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments, the permutation is optional
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(ncolors == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coloring == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_csrcolor",
+                                    "",
+                                    m,
+                                    m,
+                                    nnz,
+                                    sizeof(rocsparse_int) * (m + 1 + nnz + 2 * m));
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(ncolors, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *ncolors = 0;
+        }
+        return rocsparse_status_success;
+    }
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Statistics of a coloring round
+    rocsparse_int* stats = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += 256;
+
+    // Selection buffer
+    rocsparse_int* selection = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Identity buffer
+    rocsparse_int* identity = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Sorted color buffer
+    rocsparse_int* sorted = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // hipcub buffer
+    void* tmp_buffer = reinterpret_cast<void*>(ptr);
+
+    // All rows are uncolored
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(coloring, -1, sizeof(rocsparse_int) * m, stream));
+
+#define CSRCOLOR_DIM 512
+    dim3 csrcolor_blocks((m - 1) / CSRCOLOR_DIM + 1);
+    dim3 csrcolor_threads(CSRCOLOR_DIM);
+
+    // Each round colors the independent sets of local maxima and local minima,
+    // such that two colors are assigned per round
+    rocsparse_int colored = 0;
+    rocsparse_int colors  = 0;
+
+    while(colored < m)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(stats, 0, sizeof(rocsparse_int) * 2, stream));
+
+        hipLaunchKernelGGL((csrcolor_select_kernel),
+                           csrcolor_blocks,
+                           csrcolor_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           coloring,
+                           selection,
+                           descr->base);
+
+        hipLaunchKernelGGL((csrcolor_conflict_kernel),
+                           csrcolor_blocks,
+                           csrcolor_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           selection,
+                           descr->base);
+
+        hipLaunchKernelGGL((csrcolor_assign_kernel),
+                           csrcolor_blocks,
+                           csrcolor_threads,
+                           0,
+                           stream,
+                           m,
+                           colors,
+                           selection,
+                           coloring,
+                           stats);
+
+        rocsparse_int hstats[2];
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            hstats, stats, sizeof(rocsparse_int) * 2, hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // The global maximum is never removed from the selection
+        if(hstats[0] == 0)
+        {
+            return rocsparse_status_internal_error;
+        }
+
+        colored += hstats[0];
+        colors += (hstats[1] > 0) ? 2 : 1;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            ncolors, &colors, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    else
+    {
+        *ncolors = colors;
+    }
+
+    // Quick return if the permutation is not requested
+    if(perm == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stable sort of the rows by color, rows of the same color keep their order
+    hipLaunchKernelGGL(
+        (csrcolor_identity_kernel), csrcolor_blocks, csrcolor_threads, 0, stream, m, identity);
+#undef CSRCOLOR_DIM
+
+    unsigned int endbit = rocsparse_clz(colors);
+
+    size_t size;
+    RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortPairs(
+        nullptr, size, coloring, sorted, identity, perm, m, 0, endbit, stream));
+    RETURN_IF_HIP_ERROR(hipcub::DeviceRadixSort::SortPairs(
+        tmp_buffer, size, coloring, sorted, identity, perm, m, 0, endbit, stream));
+
+    return rocsparse_status_success;
+}
@@ -0,0 +1,359 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "csrpermute_device.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+#include <hipcub/hipcub.hpp>
+
+extern "C" rocsparse_status rocsparse_csrpermute_buffer_size(rocsparse_handle handle,
+                                                             rocsparse_int m,
+                                                             rocsparse_int nnz,
+                                                             const rocsparse_int* csr_row_ptr,
+                                                             const rocsparse_int* csr_col_ind,
+                                                             size_t* buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrpermute_buffer_size",
+              m,
+              nnz,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        *buffer_size = 0;
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    // hipcub buffer for the row pointer scan
+    size_t size;
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(nullptr, size, ptr, ptr, m + 1, stream));
+
+    // csrsort buffer, the hipcub buffer is no longer required when sorting
+    size_t sort_size;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrsort_buffer_size(handle, m, m, nnz, csr_row_ptr, csr_col_ind, &sort_size));
+
+    *buffer_size = ((std::max(size, sort_size) - 1) / 256 + 1) * 256;
+
+    // inverse permutation buffer
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrpermute(rocsparse_handle handle,
+                                                 rocsparse_int m,
+                                                 rocsparse_int nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 const rocsparse_int* perm,
+                                                 rocsparse_int* csr_row_ptr_B,
+                                                 rocsparse_int* csr_col_ind_B,
+                                                 rocsparse_int* map,
+                                                 void* temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrpermute",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)perm,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)map,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrrcm", "--mtx <matrix.mtx>");
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(map == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_csrpermute",
+                                    "",
+                                    m,
+                                    m,
+                                    nnz,
+                                    sizeof(rocsparse_int) * (4 * m + 2 + 6 * nnz));
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Temporary buffer entry points
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // inverse permutation buffer
+    rocsparse_int* invperm = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // hipcub and csrsort buffer
+    void* tmp_buffer = reinterpret_cast<void*>(ptr);
+
+#define CSRPERMUTE_DIM 512
+    dim3 csrpermute_blocks((m - 1) / CSRPERMUTE_DIM + 1);
+    dim3 csrpermute_threads(CSRPERMUTE_DIM);
+
+    hipLaunchKernelGGL((csrpermute_inverse_kernel),
+                       csrpermute_blocks,
+                       csrpermute_threads,
+                       0,
+                       stream,
+                       m,
+                       perm,
+                       invperm);
+
+    // Row lengths of the permuted matrix
+    hipLaunchKernelGGL((csrpermute_nnz_per_row_kernel),
+                       csrpermute_blocks,
+                       csrpermute_threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       perm,
+                       csr_row_ptr_B,
+                       descr->base);
+
+    // Inclusive sum to obtain the row pointer array
+    size_t size;
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
+        nullptr, size, csr_row_ptr_B, csr_row_ptr_B, m + 1, stream));
+    RETURN_IF_HIP_ERROR(hipcub::DeviceScan::InclusiveSum(
+        tmp_buffer, size, csr_row_ptr_B, csr_row_ptr_B, m + 1, stream));
+
+    // Quick return if there are no entries to move
+    if(nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Move the columns, the sub-wavefront size depends on the average row length
+    rocsparse_int nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        dim3 csrpermute_fill_blocks((m - 1) / (CSRPERMUTE_DIM / 2) + 1);
+        hipLaunchKernelGGL((csrpermute_fill_kernel<CSRPERMUTE_DIM, 2>),
+                           csrpermute_fill_blocks,
+                           csrpermute_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           perm,
+                           invperm,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           map,
+                           descr->base);
+    }
+    else if(nnz_per_row < 8)
+    {
+        dim3 csrpermute_fill_blocks((m - 1) / (CSRPERMUTE_DIM / 4) + 1);
+        hipLaunchKernelGGL((csrpermute_fill_kernel<CSRPERMUTE_DIM, 4>),
+                           csrpermute_fill_blocks,
+                           csrpermute_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           perm,
+                           invperm,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           map,
+                           descr->base);
+    }
+    else if(nnz_per_row < 16)
+    {
+        dim3 csrpermute_fill_blocks((m - 1) / (CSRPERMUTE_DIM / 8) + 1);
+        hipLaunchKernelGGL((csrpermute_fill_kernel<CSRPERMUTE_DIM, 8>),
+                           csrpermute_fill_blocks,
+                           csrpermute_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           perm,
+                           invperm,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           map,
+                           descr->base);
+    }
+    else if(nnz_per_row < 32)
+    {
+        dim3 csrpermute_fill_blocks((m - 1) / (CSRPERMUTE_DIM / 16) + 1);
+        hipLaunchKernelGGL((csrpermute_fill_kernel<CSRPERMUTE_DIM, 16>),
+                           csrpermute_fill_blocks,
+                           csrpermute_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           perm,
+                           invperm,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           map,
+                           descr->base);
+    }
+    else
+    {
+        dim3 csrpermute_fill_blocks((m - 1) / (CSRPERMUTE_DIM / 32) + 1);
+        hipLaunchKernelGGL((csrpermute_fill_kernel<CSRPERMUTE_DIM, 32>),
+                           csrpermute_fill_blocks,
+                           csrpermute_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           perm,
+                           invperm,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           map,
+                           descr->base);
+    }
+#undef CSRPERMUTE_DIM
+
+    // Renumbered columns are unsorted, sort them and carry along the entry map
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsort(
+        handle, m, m, nnz, descr, csr_row_ptr_B, csr_col_ind_B, map, tmp_buffer));
+
+    return rocsparse_status_success;
+}
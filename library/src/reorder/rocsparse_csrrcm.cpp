@@ -0,0 +1,325 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+// Breadth first search from root through the unnumbered nodes, appends the visited nodes
+// to order level by level. Neighbors are visited in order of increasing degree, as
+// required by the Cuthill-McKee ordering. Returns the number of levels.
+static rocsparse_int rcm_bfs(rocsparse_int root,
+                             const std::vector<rocsparse_int>& adj_ptr,
+                             const std::vector<rocsparse_int>& adj_ind,
+                             std::vector<char>& numbered,
+                             std::vector<rocsparse_int>& order,
+                             rocsparse_int& last_level)
+{
+    size_t begin = order.size();
+
+    order.push_back(root);
+    numbered[root] = 1;
+
+    rocsparse_int levels = 0;
+
+    for(size_t level_begin = begin; level_begin < order.size(); ++levels)
+    {
+        size_t level_end = order.size();
+        last_level       = static_cast<rocsparse_int>(level_begin);
+
+        for(size_t k = level_begin; k < level_end; ++k)
+        {
+            rocsparse_int u     = order[k];
+            size_t first_child = order.size();
+
+            for(rocsparse_int j = adj_ptr[u]; j < adj_ptr[u + 1]; ++j)
+            {
+                rocsparse_int v = adj_ind[j];
+
+                if(!numbered[v])
+                {
+                    numbered[v] = 1;
+                    order.push_back(v);
+                }
+            }
+
+            std::sort(order.begin() + first_child,
+                      order.end(),
+                      [&](rocsparse_int a, rocsparse_int b) {
+                          rocsparse_int deg_a = adj_ptr[a + 1] - adj_ptr[a];
+                          rocsparse_int deg_b = adj_ptr[b + 1] - adj_ptr[b];
+                          return deg_a < deg_b || (deg_a == deg_b && a < b);
+                      });
+        }
+
+        level_begin = level_end;
+    }
+
+    return levels;
+}
+
+// Reverse Cuthill-McKee ordering of the graph given by adjacency lists, each connected
+// component starts at a pseudo-peripheral node found by the George-Liu algorithm
+static void rcm_order(rocsparse_int m,
+                      const std::vector<rocsparse_int>& adj_ptr,
+                      const std::vector<rocsparse_int>& adj_ind,
+                      std::vector<rocsparse_int>& order)
+{
+    std::vector<char> numbered(m, 0);
+    std::vector<rocsparse_int> search;
+
+    order.clear();
+    order.reserve(m);
+
+    for(rocsparse_int start = 0; start < m; ++start)
+    {
+        if(numbered[start])
+        {
+            continue;
+        }
+
+        // Pseudo-peripheral node of the component of start
+        rocsparse_int root = start;
+        rocsparse_int last_level;
+        rocsparse_int eccentricity = -1;
+
+        while(true)
+        {
+            search.clear();
+
+            rocsparse_int levels = rcm_bfs(root, adj_ptr, adj_ind, numbered, search, last_level);
+
+            for(size_t k = 0; k < search.size(); ++k)
+            {
+                numbered[search[k]] = 0;
+            }
+
+            if(levels <= eccentricity)
+            {
+                break;
+            }
+
+            eccentricity = levels;
+
+            // Continue with a node of minimum degree in the last level
+            rocsparse_int next = search[last_level];
+
+            for(size_t k = last_level; k < search.size(); ++k)
+            {
+                if(adj_ptr[search[k] + 1] - adj_ptr[search[k]] < adj_ptr[next + 1] - adj_ptr[next])
+                {
+                    next = search[k];
+                }
+            }
+
+            if(next == root)
+            {
+                break;
+            }
+
+            root = next;
+        }
+
+        rcm_bfs(root, adj_ptr, adj_ind, numbered, order, last_level);
+    }
+
+    std::reverse(order.begin(), order.end());
+}
+
+extern "C" rocsparse_status rocsparse_csrrcm(rocsparse_handle handle,
+                                             rocsparse_int m,
+                                             rocsparse_int nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_int* perm)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrcm",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)perm);
+
+    log_bench(handle, "./rocsparse-bench -f csrrcm", "--mtx <matrix.mtx>");
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_profile_scope profile(handle,
+                                    "rocsparse_csrrcm",
+                                    "",
+                                    m,
+                                    m,
+                                    nnz,
+                                    sizeof(rocsparse_int) * (2 * m + 1 + nnz));
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The ordering is a sequential graph traversal, it is computed on the host
+    std::vector<rocsparse_int> hcsr_row_ptr(m + 1);
+    std::vector<rocsparse_int> hcsr_col_ind(nnz);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hcsr_row_ptr.data(),
+                                       csr_row_ptr,
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hcsr_col_ind.data(),
+                                       csr_col_ind,
+                                       sizeof(rocsparse_int) * nnz,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    rocsparse_int base = (descr->base == rocsparse_index_base_one) ? 1 : 0;
+
+    // Adjacency lists of the structure of A + A^T without diagonal
+    std::vector<rocsparse_int> adj_ptr(m + 1, 0);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = hcsr_row_ptr[i] - base; j < hcsr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = hcsr_col_ind[j] - base;
+
+            if(col < 0 || col >= m)
+            {
+                return rocsparse_status_invalid_value;
+            }
+
+            if(col != i)
+            {
+                ++adj_ptr[i + 1];
+                ++adj_ptr[col + 1];
+            }
+        }
+    }
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        adj_ptr[i + 1] += adj_ptr[i];
+    }
+
+    std::vector<rocsparse_int> adj_ind(adj_ptr[m]);
+    std::vector<rocsparse_int> fill(adj_ptr.begin(), adj_ptr.end() - 1);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        for(rocsparse_int j = hcsr_row_ptr[i] - base; j < hcsr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = hcsr_col_ind[j] - base;
+
+            if(col != i)
+            {
+                adj_ind[fill[i]++]   = col;
+                adj_ind[fill[col]++] = i;
+            }
+        }
+    }
+
+    // Remove duplicates, such that degrees count distinct neighbors
+    rocsparse_int nadj = 0;
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int row_begin = adj_ptr[i];
+        rocsparse_int row_end   = adj_ptr[i + 1];
+
+        std::sort(adj_ind.begin() + row_begin, adj_ind.begin() + row_end);
+
+        adj_ptr[i] = nadj;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            if(j == row_begin || adj_ind[j] != adj_ind[j - 1])
+            {
+                adj_ind[nadj++] = adj_ind[j];
+            }
+        }
+    }
+
+    adj_ptr[m] = nadj;
+
+    std::vector<rocsparse_int> order;
+    rcm_order(m, adj_ptr, adj_ind, order);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        perm, order.data(), sizeof(rocsparse_int) * m, hipMemcpyHostToDevice, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
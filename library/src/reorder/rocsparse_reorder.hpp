@@ -0,0 +1,244 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef ROCSPARSE_REORDER_HPP
+#define ROCSPARSE_REORDER_HPP
+
+#include "rocsparse.h"
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+#include "reorder_device.h"
+
+#include <algorithm>
+#include <limits>
+#include <hip/hip_runtime.h>
+
+// Compute the multicolor reordering B = P * A * P^T of a matrix for the
+// rocsparse_solve_policy_multicolor solve policy. The reordering only depends on the
+// sparsity pattern and is reused as long as the pattern does not change.
+static rocsparse_status rocsparse_reorder_analysis(rocsparse_handle handle,
+                                                   rocsparse_int m,
+                                                   rocsparse_int nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_mat_info info)
+{
+    // Fingerprint of the sparsity pattern
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_update_pattern_key(
+        handle, info, m, m, nnz, descr->base, csr_row_ptr, csr_col_ind, true));
+
+    // If the reordering is already available, do nothing
+    if(info->reorder_info != nullptr && info->reorder_info->key == info->pattern)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clear info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_reorder_info(info->reorder_info));
+    info->reorder_info = nullptr;
+
+    // Create info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_reorder_info(&info->reorder_info));
+
+    rocsparse_reorder_info reorder = info->reorder_info;
+
+    reorder->m   = m;
+    reorder->nnz = nnz;
+
+    // Permutation, reordered pattern and map share a single allocation
+    size_t perm_size = sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+    size_t ptr_size  = sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+    size_t col_size  = sizeof(rocsparse_int) * ((nnz - 1) / 256 + 1) * 256;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_malloc_memory(
+        handle, (void**)&reorder->perm, perm_size + ptr_size + 2 * col_size));
+
+    reorder->allocator = handle->allocator;
+
+    char* ptr = reinterpret_cast<char*>(reorder->perm);
+
+    reorder->csr_row_ptr = reinterpret_cast<rocsparse_int*>(ptr + perm_size);
+    reorder->csr_col_ind = reinterpret_cast<rocsparse_int*>(ptr + perm_size + ptr_size);
+    reorder->map = reinterpret_cast<rocsparse_int*>(ptr + perm_size + ptr_size + col_size);
+
+    // Temporary buffer, shared by coloring and permutation
+    size_t color_buffer_size;
+    size_t permute_buffer_size;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrcolor_buffer_size(
+        handle, m, nnz, csr_row_ptr, csr_col_ind, &color_buffer_size));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrpermute_buffer_size(
+        handle, m, nnz, csr_row_ptr, csr_col_ind, &permute_buffer_size));
+
+    rocsparse_workspace_scope workspace_scope(handle);
+
+    void* temp_buffer;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_malloc(
+        handle, &temp_buffer, std::max(color_buffer_size, permute_buffer_size)));
+
+    rocsparse_int* coloring;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_workspace_malloc(handle, (void**)&coloring, sizeof(rocsparse_int) * m));
+
+    // Number of colors is returned to the host
+    rocsparse_pointer_mode mode = handle->pointer_mode;
+    handle->pointer_mode        = rocsparse_pointer_mode_host;
+
+    rocsparse_status status = rocsparse_csrcolor(handle,
+                                                 m,
+                                                 nnz,
+                                                 descr,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 &reorder->ncolors,
+                                                 coloring,
+                                                 reorder->perm,
+                                                 temp_buffer);
+
+    handle->pointer_mode = mode;
+
+    RETURN_IF_ROCSPARSE_ERROR(status);
+
+    // Reordered sparsity pattern
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrpermute(handle,
+                                                   m,
+                                                   nnz,
+                                                   descr,
+                                                   csr_row_ptr,
+                                                   csr_col_ind,
+                                                   reorder->perm,
+                                                   reorder->csr_row_ptr,
+                                                   reorder->csr_col_ind,
+                                                   reorder->map,
+                                                   temp_buffer));
+
+    // Analysis data of the reordered matrix
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&reorder->info));
+
+    reorder->key = info->pattern;
+
+    return rocsparse_status_success;
+}
+
+// y[i] = x[ind[i]]
+template <typename T>
+rocsparse_status rocsparse_reorder_gather(
+    rocsparse_handle handle, rocsparse_int n, const rocsparse_int* ind, const T* x, T* y)
+{
+    if(n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+#define REORDER_DIM 512
+    dim3 reorder_blocks((n - 1) / REORDER_DIM + 1);
+    dim3 reorder_threads(REORDER_DIM);
+
+    hipLaunchKernelGGL((reorder_gather_kernel<T>),
+                       reorder_blocks,
+                       reorder_threads,
+                       0,
+                       handle->stream,
+                       n,
+                       ind,
+                       x,
+                       y);
+#undef REORDER_DIM
+
+    return rocsparse_status_success;
+}
+
+// y[ind[i]] = x[i]
+template <typename T>
+rocsparse_status rocsparse_reorder_scatter(
+    rocsparse_handle handle, rocsparse_int n, const rocsparse_int* ind, const T* x, T* y)
+{
+    if(n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+#define REORDER_DIM 512
+    dim3 reorder_blocks((n - 1) / REORDER_DIM + 1);
+    dim3 reorder_threads(REORDER_DIM);
+
+    hipLaunchKernelGGL((reorder_scatter_kernel<T>),
+                       reorder_blocks,
+                       reorder_threads,
+                       0,
+                       handle->stream,
+                       n,
+                       ind,
+                       x,
+                       y);
+#undef REORDER_DIM
+
+    return rocsparse_status_success;
+}
+
+// Report the zero pivot of the reordered matrix with respect to the rows of the
+// original matrix
+static rocsparse_status rocsparse_reorder_zero_pivot(rocsparse_handle handle,
+                                                     rocsparse_reorder_info reorder,
+                                                     const rocsparse_int* zero_pivot,
+                                                     rocsparse_int* position)
+{
+    rocsparse_int pivot;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpy(&pivot, zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+    if(pivot == std::numeric_limits<rocsparse_int>::max())
+    {
+        pivot = -1;
+    }
+    else
+    {
+        rocsparse_int row = pivot - reorder->key.base;
+
+        if(row >= 0 && row < reorder->m)
+        {
+            RETURN_IF_HIP_ERROR(
+                hipMemcpy(&row, reorder->perm + row, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+            pivot = row + reorder->key.base;
+        }
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(position, &pivot, sizeof(rocsparse_int), hipMemcpyHostToDevice));
+    }
+    else
+    {
+        *position = pivot;
+    }
+
+    return (pivot == -1) ? rocsparse_status_success : rocsparse_status_zero_pivot;
+}
+
+#endif // ROCSPARSE_REORDER_HPP
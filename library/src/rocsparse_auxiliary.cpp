@@ -112,6 +112,125 @@ rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle handle, rocsparse_p
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ *! \brief Set device memory allocator used for all subsequent library function
+ * calls.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_allocator(rocsparse_handle handle,
+                                         rocsparse_device_malloc malloc_func,
+                                         rocsparse_device_free free_func,
+                                         void* user_data)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle,
+              "rocsparse_set_allocator",
+              (const void*&)malloc_func,
+              (const void*&)free_func,
+              user_data);
+
+    // Both callbacks are required
+    if((malloc_func == nullptr) != (free_func == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Workspace has been obtained from the previous allocator
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_workspace_release(handle));
+
+    handle->allocator.malloc_func = malloc_func;
+    handle->allocator.free_func   = free_func;
+    handle->allocator.user_data   = user_data;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ *! \brief Get device memory statistics of the library context.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_memory_stats(rocsparse_handle handle, rocsparse_memory_stats* stats)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(stats == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    stats->workspace_size       = handle->workspace.size;
+    stats->workspace_high_water = handle->workspace.high_water;
+    stats->workspace_requests   = handle->workspace.requests;
+    stats->device_allocs        = handle->device_allocs;
+
+    log_trace(handle, "rocsparse_get_memory_stats", (const void*&)stats);
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Write the profile summary of the handle.
+ *******************************************************************************/
+rocsparse_status rocsparse_write_profile(rocsparse_handle handle,
+                                         rocsparse_profile_format format,
+                                         const char* path)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_write_profile", format, (const void*&)path);
+
+    if(format != rocsparse_profile_format_table && format != rocsparse_profile_format_json)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(path == nullptr)
+    {
+        handle->profile.write(handle->log_profile_os ? *handle->log_profile_os : std::cerr,
+                              format);
+        return rocsparse_status_success;
+    }
+
+    std::ofstream ofs(path);
+
+    if(!ofs.is_open())
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    handle->profile.write(ofs, format);
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Discard the profile summary of the handle.
+ *******************************************************************************/
+rocsparse_status rocsparse_reset_profile(rocsparse_handle handle)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    log_trace(handle, "rocsparse_reset_profile");
+
+    handle->profile.reset();
+
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  *! \brief Set rocsparse stream used for all subsequent library function calls.
  * If not set, all hip kernels will take the default NULL stream.
@@ -399,30 +518,104 @@ rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb)
     try
     {
         // Clean up ELL part
-        if(hyb->ell_col_ind != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->ell_col_ind));
-        }
-        if(hyb->ell_val != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->ell_val));
-        }
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(hyb->allocator, hyb->ell_col_ind));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(hyb->allocator, hyb->ell_val));
 
         // Clean up COO part
-        if(hyb->coo_row_ind != nullptr)
-        {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_row_ind));
-        }
-        if(hyb->coo_col_ind != nullptr)
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(hyb->allocator, hyb->coo_row_ind));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(hyb->allocator, hyb->coo_col_ind));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(hyb->allocator, hyb->coo_val));
+
+        // Clean up value update mapping
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(hyb->allocator, hyb->csr_perm));
+
+        delete hyb;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Set the value update type of the HYB matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_hyb_mat_update(rocsparse_hyb_mat hyb, rocsparse_hyb_update update)
+{
+    // Check if hyb structure is valid
+    if(hyb == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    if(update != rocsparse_hyb_update_full && update != rocsparse_hyb_update_values)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    hyb->update = update;
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Returns the value update type of the HYB matrix.
+ *******************************************************************************/
+rocsparse_hyb_update rocsparse_get_hyb_mat_update(const rocsparse_hyb_mat hyb)
+{
+    // If hyb structure is invalid, default update type is returned
+    if(hyb == nullptr)
+    {
+        return rocsparse_hyb_update_full;
+    }
+    return hyb->update;
+}
+
+/********************************************************************************
+ * \brief rocsparse_create_pcsr_mat is a structure holding the rocsparse PCSR
+ * matrix. It must be initialized using rocsparse_create_pcsr_mat()
+ * and the retured handle must be passed to all subsequent library function
+ * calls that involve the PCSR matrix.
+ * It should be destroyed at the end using rocsparse_destroy_pcsr_mat().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_pcsr_mat(rocsparse_pcsr_mat* pcsr)
+{
+    if(pcsr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
         {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_col_ind));
+            *pcsr = new _rocsparse_pcsr_mat;
         }
-        if(hyb->coo_val != nullptr)
+        catch(const rocsparse_status& status)
         {
-            RETURN_IF_HIP_ERROR(hipFree(hyb->coo_val));
+            return status;
         }
+        return rocsparse_status_success;
+    }
+}
 
-        delete hyb;
+/********************************************************************************
+ * \brief Destroy PCSR matrix.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_pcsr_mat(rocsparse_pcsr_mat pcsr)
+{
+    if(pcsr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Destruct
+    try
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(pcsr->allocator, pcsr->row_ptr));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(pcsr->allocator, pcsr->col_base));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(pcsr->allocator, pcsr->col_delta));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_device_free_memory(pcsr->allocator, pcsr->val));
+
+        delete pcsr;
     }
     catch(const rocsparse_status& status)
     {
@@ -431,6 +624,19 @@ rocsparse_status rocsparse_destroy_hyb_mat(rocsparse_hyb_mat hyb)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Returns the column delta size of the PCSR matrix in bytes.
+ *******************************************************************************/
+rocsparse_int rocsparse_get_pcsr_mat_delta_size(const rocsparse_pcsr_mat pcsr)
+{
+    // If pcsr structure is invalid, no column deltas are stored
+    if(pcsr == nullptr)
+    {
+        return 0;
+    }
+    return pcsr->delta_size;
+}
+
 /********************************************************************************
  * \brief rocsparse_mat_info is a structure holding the matrix info data that is
  * gathered during the analysis routines. It must be initialized by calling
@@ -469,13 +675,7 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         return rocsparse_status_success;
     }
 
-    // Uncouple shared meta data
-    // TODO add more crossover data here
-    if(info->csrsv_lower_info == info->csrilu0_info)
-    {
-        info->csrsv_lower_info = nullptr;
-    }
-
+    // Shared meta data is reference counted and released by each of its owners
     // Clear csrmv info struct
     if(info->csrmv_info != nullptr)
     {
@@ -500,6 +700,39 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrtr_info(info->csrsv_lower_info));
     }
 
+    // Clear mixed precision csrilu0 factors
+    if(info->csrilu0_mixed_val != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_device_free_memory(info->csrilu0_mixed_allocator, info->csrilu0_mixed_val));
+    }
+
+    // Clear multicolor reordering
+    if(info->reorder_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_reorder_info(info->reorder_info));
+    }
+
+    // Clear cscmspv info struct
+    if(info->cscmspv_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_cscmspv_info(info->cscmspv_info));
+    }
+
+    // Clear sweep history of the iterative policy
+    if(info->iterative_history != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_device_free_memory(info->iterative_allocator, info->iterative_history));
+    }
+
+    // Clear zero pivots
+    if(info->zero_pivot != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_device_free_memory(info->zero_pivot_allocator, info->zero_pivot));
+    }
+
     // Destruct
     try
     {
@@ -512,6 +745,109 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Set the number of fixed-point sweeps of rocsparse_solve_policy_iterative.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_mat_info_sweeps(rocsparse_mat_info info,
+                                               rocsparse_int csrilu0_sweeps,
+                                               rocsparse_int csrsv_sweeps)
+{
+    // Check if info structure has been created
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(csrilu0_sweeps <= 0 || csrsv_sweeps <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // The sweep history depends on the number of sweeps
+    if(info->iterative_history != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_device_free_memory(info->iterative_allocator, info->iterative_history));
+        info->iterative_history = nullptr;
+    }
+
+    info->csrilu0_sweeps = csrilu0_sweeps;
+    info->csrsv_sweeps   = csrsv_sweeps;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get the number of fixed-point sweeps of rocsparse_solve_policy_iterative.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_mat_info_sweeps(const rocsparse_mat_info info,
+                                               rocsparse_int* csrilu0_sweeps,
+                                               rocsparse_int* csrsv_sweeps)
+{
+    // Check if info structure has been created
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrilu0_sweeps == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csrsv_sweeps == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *csrilu0_sweeps = info->csrilu0_sweeps;
+    *csrsv_sweeps   = info->csrsv_sweeps;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Set the frontier density at which cscmspv switches from push to pull.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_mat_info_cscmspv_threshold(rocsparse_mat_info info,
+                                                          double threshold)
+{
+    // Check if info structure has been created
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(!(threshold >= 0.0))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    info->cscmspv_threshold = threshold;
+
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Set when the sparsity pattern is validated during execution.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_mat_info_pattern_check(rocsparse_mat_info info,
+                                                      rocsparse_pattern_check check)
+{
+    // Check if info structure has been created
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(check != rocsparse_pattern_check_moved && check != rocsparse_pattern_check_always)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    info->pattern_check = check;
+
+    return rocsparse_status_success;
+}
+
 #ifdef __cplusplus
 }
 #endif
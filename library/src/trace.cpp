@@ -0,0 +1,137 @@
+/* ************************************************************************
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "trace.h"
+
+#include <atomic>
+#include <fcntl.h>
+#include <memory>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Open the trace file and write the file header. The file name is taken from
+// ROCSPARSE_LOG_BINARY_PATH and defaults to rocsparse_trace.bin
+static int rocsparse_trace_open()
+{
+    const char* path = getenv("ROCSPARSE_LOG_BINARY_PATH");
+
+    if(path == NULL)
+    {
+        path = "rocsparse_trace.bin";
+    }
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+
+    if(fd < 0)
+    {
+        fprintf(stderr, "rocsparse: cannot open trace file %s\n", path);
+        return -1;
+    }
+
+    rocsparse_trace_file_header header;
+
+    header.magic   = ROCSPARSE_TRACE_MAGIC;
+    header.version = ROCSPARSE_TRACE_VERSION;
+
+    if(::write(fd, &header, sizeof(header)) != sizeof(header))
+    {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+// The trace file is shared by all threads and handles of the process and stays
+// open until the process terminates
+static int rocsparse_trace_file()
+{
+    static int fd = rocsparse_trace_open();
+    return fd;
+}
+
+/*******************************************************************************
+ * constructor
+ ******************************************************************************/
+rocsparse_trace_buffer::rocsparse_trace_buffer()
+{
+    static std::atomic<uint32_t> num_threads(0);
+    thread = num_threads++;
+}
+
+/*******************************************************************************
+ * destructor
+ ******************************************************************************/
+rocsparse_trace_buffer::~rocsparse_trace_buffer() { flush(); }
+
+/*******************************************************************************
+ * flush
+ ******************************************************************************/
+void rocsparse_trace_buffer::flush()
+{
+    write(data, pos);
+    pos = 0;
+}
+
+/*******************************************************************************
+ * write:
+   A single write per chunk keeps the records of different threads from
+   interleaving, as the file is opened in append mode
+ ******************************************************************************/
+void rocsparse_trace_buffer::write(const char* ptr, size_t size)
+{
+    int fd = rocsparse_trace_file();
+
+    while(fd >= 0 && size > 0)
+    {
+        ssize_t n = ::write(fd, ptr, size);
+
+        if(n <= 0)
+        {
+            break;
+        }
+
+        ptr += n;
+        size -= n;
+    }
+}
+
+/*******************************************************************************
+ * The buffer is allocated on first use, to keep large objects out of thread
+ * local storage of threads that never trace
+ ******************************************************************************/
+rocsparse_trace_buffer& rocsparse_trace_thread_buffer()
+{
+    static thread_local std::unique_ptr<rocsparse_trace_buffer> buf;
+
+    if(buf == nullptr)
+    {
+        buf.reset(new rocsparse_trace_buffer);
+    }
+
+    return *buf;
+}
+
+void rocsparse_trace_flush() { rocsparse_trace_thread_buffer().flush(); }